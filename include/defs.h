@@ -2,6 +2,8 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct kmem_cache;
+struct vma;
 struct pipe;
 struct proc;
 struct rtcdate;
@@ -21,8 +23,14 @@ void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
 void            panic(char*) __attribute__((noreturn));
 
+// e820.c
+void            e820init(void);
+int             e820range(int, uintp*, uintp*);
+extern uintp    memtop;
+
 // exec.c
 int             exec(char*, char**);
+int             execproc(struct proc*, char*, char**);
 
 // file.c
 struct file*    filealloc(void);
@@ -32,6 +40,7 @@ void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             writeinode(struct inode*, char*, uint, int);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
@@ -65,8 +74,21 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+char*           kallocpages(int);
+void            kfreepages(char*, int);
+int             kpageorder(char*);
+void            krefpages(char*, int);
+void            ksplitpages(char*, int);
+char*           kalloc_zeroed(void);
+void            kfree_zeroed(char*);
+void            kref(char*);
+int             ktryref(char*);
+void            ksettext(char*);
+int             krefcount(char*);
+int             kzerofill(void);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kallocdump(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -77,7 +99,9 @@ int             cpunum(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(uchar, int);
 void            lapicstartap(uchar, uint);
+void            lapictimer(uint);
 void            microdelay(int);
 
 // log.c
@@ -96,13 +120,18 @@ void            mpstartthem(void);
 int             acpiinit(void);
 
 // cpuid.c
+extern uint     featuresExt;  // CPUID leaf 1 %ecx
 void            cpuidinit(void);
 
+// kstat.c
+void            kstatinit(void);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
 // pipe.c
+void            pipeinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
@@ -113,16 +142,24 @@ int             pipewrite(struct pipe*, char*, int);
 struct proc*    copyproc(struct proc*);
 void            exit(void);
 int             fork(void);
+int             spawn(char*, char**, int*);
+struct proc*    pickvictim(int);
+void            dropvictim(struct proc*);
 int             growproc(int);
 int             kill(int);
 void            pinit(void);
 void            procdump(void);
+void            rqdump(void);
+int             schedtick(void);
+void            schedkick(void);
+int             setpriority(int, int);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
+void            wakeupone(void*);
 void            yield(void);
 
 // swtch.S
@@ -138,6 +175,15 @@ void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// slab.c
+void            slabinit(void);
+struct kmem_cache* kmem_cache_create(char*, uint);
+void*           kmem_cache_alloc(struct kmem_cache*);
+void            kmem_cache_free(struct kmem_cache*, void*);
+void*           kmalloc(uint);
+void            kmfree(void*);
+void            slabdump(void);
+
 // string.c
 int             memcmp(const void*, const void*, uint);
 void*           memmove(void*, const void*, uint);
@@ -147,6 +193,22 @@ int             strlen(const char*);
 int             strncmp(const char*, const char*, uint);
 char*           strncpy(char*, const char*, int);
 
+// swap.c
+void            swapinit(void);
+int             swapout(char*);
+void            swapin(uint, char*);
+void            swapdup(uint);
+void            swapfree(uint);
+void            swapcount(int, int);
+void            swapdump(void);
+
+// text.c
+void            textinit(void);
+char*           textget(struct inode*, uint, uint);
+void            textadd(struct inode*, uint, uint, char*);
+void            textdrop(char*);
+void            textdump(void);
+
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
@@ -160,6 +222,9 @@ void            syscall(void);
 void            timerinit(void);
 
 // trap.c
+void            clockalarm(uint);
+uint            clockidle(void);
+void            clockupdate(void);
 void            idtinit(void);
 extern uint     ticks;
 void            tvinit(void);
@@ -177,16 +242,33 @@ void            kvmalloc(void);
 void            vmenable(void);
 pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
-int             allocuvm(pde_t*, uint, uint);
-int             deallocuvm(pde_t*, uintp, uintp);
+uintp           allocuvm(pde_t*, uintp, uintp);
+uintp           deallocuvm(pde_t*, uintp, uintp);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
-int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
-pde_t*          copyuvm(pde_t*, uint);
+pde_t*          copyuvm(pde_t*, uintp);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
-int             copyout(pde_t*, uint, void*, uint);
-void            clearpteu(pde_t *pgdir, char *uva);
+void            flushuvm(struct proc*);
+void            newasid(struct proc*, int);
+void            tlbdump(void);
+pde_t*          pgtalloc(void);
+void            pgtdump(void);
+void            tlbintr(void);
+void            tlbshootdown(struct proc*, uintp, uintp);
+int             copyout(pde_t*, uintp, void*, uintp);
+int             pagefault(uintp, uint);
+void            uvminit(void);
+int             touchuvm(uintp, uintp, int);
+void            freevmas(struct vma*);
+int             uvmcheck(uintp, uintp);
+uintp           uvmend(uintp, int);
+uintp           heaplimit(void);
+int             syncvmas(pde_t*, struct vma*, uintp, uintp);
+uintp           mmapuvm(uintp, int, int, struct inode*, uint, uint);
+int             munmapuvm(uintp, uintp);
+int             fillshared(void);
+int             reclaim(int, int);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
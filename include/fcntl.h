@@ -2,3 +2,5 @@
 #define O_WRONLY  0x001
 #define O_RDWR    0x002
 #define O_CREATE  0x200
+
+#define NSPAWNFD  3       // descriptors spawn() can pass to the child
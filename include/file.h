@@ -15,6 +15,8 @@ struct inode {
   uint inum;          // Inode number
   int ref;            // Reference count
   int flags;          // I_BUSY, I_VALID
+  struct inode *next; // icache.list
+  uint gen;           // contents version, for the text cache
 
   short type;         // copy of disk inode
   short major;
@@ -41,6 +43,7 @@ extern struct devsw devsw[];
 // major device numbers
 #define CONSOLE 1
 #define CPUID   2
+#define KSTAT   3
 
 //PAGEBREAK!
 // Blank page.
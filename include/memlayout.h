@@ -1,28 +1,44 @@
 // Memory layout
 
 #define EXTMEM  0x100000            // Start of extended memory
-#define PHYSTOP 0xE000000           // Top physical memory
+#define PHYSTOP 0xE000000           // Top physical memory if there is no E820 map
 #define DEVSPACE 0xFE000000         // Other devices are at high addresses
 
+#define E820MAP  0x500              // bootasm.S leaves the BIOS memory map here
+#define E820MAX  32                 // max entries in the map
+
 // Key addresses for address space layout (see kmap in vm.c for layout)
 #if X64
 #define KERNBASE 0xFFFFFFFF80000000 // First kernel virtual address
 #define DEVBASE  0xFFFFFFFF40000000 // First device virtual address
+#define PHYSBASE 0xFFFF800000000000 // Direct map of all physical memory
+#define PHYSLIMIT 0x1000000000      // Memory above 64GB is not used
+#define USERTOP  0x800000000000     // End of user address space (47 bits)
 #else
 #define KERNBASE 0x80000000         // First kernel virtual address
 #define DEVBASE  0xFE000000         // First device virtual address
+#define PHYSBASE KERNBASE
+#define PHYSLIMIT PHYSTOP
+#define USERTOP  KERNBASE
 #endif
 #define KERNLINK (KERNBASE+EXTMEM)  // Address where kernel is linked
 
 #ifndef __ASSEMBLER__
 
-static inline uintp v2p(void *a) { return ((uintp) (a)) - ((uintp)KERNBASE); }
-static inline void *p2v(uintp a) { return (void *) ((a) + ((uintp)KERNBASE)); }
+// On x86-64 the kernel image is linked at KERNBASE but other
+// physical memory is reached through the direct map at PHYSBASE,
+// so v2p() accepts either; p2v() always returns a direct map address.
+static inline uintp v2p(void *a) {
+  if((uintp)a >= (uintp)KERNBASE)
+    return (uintp)a - (uintp)KERNBASE;
+  return (uintp)a - (uintp)PHYSBASE;
+}
+static inline void *p2v(uintp a) { return (void *) ((a) + ((uintp)PHYSBASE)); }
 
 #endif
 
-#define V2P(a) (((uintp) (a)) - KERNBASE)
-#define P2V(a) (((void *) (a)) + KERNBASE)
+#define V2P(a) (((uintp) (a)) - KERNBASE)  // kernel image addresses only
+#define P2V(a) (((void *) (a)) + PHYSBASE)
 #define IO2V(a) (((void *) (a)) + DEVBASE - DEVSPACE)
 
 #define V2P_WO(x) ((x) - KERNBASE)    // same as V2P, but without casts
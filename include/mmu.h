@@ -38,6 +38,9 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_PCIDE       0x00020000      // Process-context identifiers
+
+#define CR3_NOFLUSH     (1ULL << 63)    // Keep the new PCID's TLB entries
 
 #define SEG_KCODE 1  // kernel code
 #define SEG_KDATA 2  // kernel data+stack
@@ -126,8 +129,14 @@ struct segdesc {
 #define PGSHIFT         12      // log2(PGSIZE)
 #define PTXSHIFT        12      // offset of PTX in a linear address
 #define PDXSHIFT        21      // offset of PDX in a linear address
+#define PDPTXSHIFT      30      // offset of PDPTX in a linear address
+#define PML4XSHIFT      39      // offset of PML4X in a linear address
 
 #define PXMASK          0x1FF
+
+// page directory pointer table and page map level 4 indexes
+#define PDPTX(va)       (((uintp)(va) >> PDPTXSHIFT) & PXMASK)
+#define PML4X(va)       (((uintp)(va) >> PML4XSHIFT) & PXMASK)
 #else
 #define NPDENTRIES      1024    // # directory entries per page directory
 #define NPTENTRIES      1024    // # PTEs per page table
@@ -140,6 +149,10 @@ struct segdesc {
 #define PXMASK          0x3FF
 #endif
 
+// A page directory entry with PTE_PS set maps a huge page.
+#define HUGEPGSIZE      ((uintp)1 << PDXSHIFT)  // bytes mapped by a huge page
+#define HUGEORDER       (PDXSHIFT - PGSHIFT)    // its kallocpages() order
+
 #define PGROUNDUP(sz)  (((sz)+((uintp)PGSIZE-1)) & ~((uintp)(PGSIZE-1)))
 #define PGROUNDDOWN(a) (((a)) & ~((uintp)(PGSIZE-1)))
 
@@ -153,6 +166,14 @@ struct segdesc {
 #define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
 #define PTE_MBZ         0x180   // Bits must be zero
+#define PTE_COW         0x200   // Copy-on-write (software-defined)
+#define PTE_SHARED      0x400   // Shared across fork (software-defined)
+#define PTE_SWAP        0x800   // Swapped out; address is the slot (software-defined)
+
+// Page fault error codes
+#define FEC_PR          0x1     // Page fault caused by protection violation
+#define FEC_WR          0x2     // Page fault caused by a write
+#define FEC_U           0x4     // Page fault occured while in user mode
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uintp)(pte) & ~0xFFF)
@@ -1,14 +1,28 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define NPRIO         8  // scheduling priority levels
+#define NICEMIN     -20  // nice values, highest priority
+#define NICEMAX      19  // ... to lowest
+#define PRIODECAY   100  // ticks between raising queued processes a level
+#define TICKLESSMAX 100  // most ticks a CPU may go without a timer interrupt
+#define NPCID         8  // PCIDs each CPU gives recently run processes
+#define KCACHESIZE   32  // free pages cached per CPU by kalloc
+#define MAXORDER     10  // largest kallocpages() block is 2^MAXORDER pages
+#define NZEROPAGE   256  // pre-zeroed pages kept for kalloc_zeroed()
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NVMA         16  // file-backed memory regions per process
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
+#define STACKMAX  1048576  // bytes a user stack may grow to
+#define STACKGAP    65536  // unmapped gap kept below a stack's limit
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       2000  // size of file system in blocks
+#define SWAPDEV         0  // device number of the disk holding swap
+#define SWAPSTART    2048  // first block of swap, past the kernel image
+#define SWAPSIZE    32768  // size of swap in blocks
+#define SWAPBATCH      16  // pages reclaim() frees at a time
 
@@ -1,6 +1,15 @@
 // Segments in proc->gdt.
 #define NSEGS     7
 
+// Per-CPU cache of free pages; see kalloc.c.
+struct kcache {
+  int n;                       // Number of pages in page[]
+  char *page[KCACHESIZE];      // Free pages, most recently freed last
+  uint hit;                    // kalloc()s served from page[]
+  uint miss;                   // kalloc()s that refilled from kmem
+  uint drain;                  // kfree()s that drained to kmem
+};
+
 // Per-CPU state
 struct cpu {
   uchar id;                    // index into cpus[] below
@@ -11,10 +20,22 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
+  struct kcache kcache;        // Free pages owned by this cpu
+  uint64 loaded;               // asid of the last user page table loaded
+  uint nflush;                 // User page table loads that flushed the TLB
+  uint nkeep;                  // ... that kept entries tagged with a PCID
+  uint nskip;                  // ... that were not needed at all
+  pde_t *uvm;                  // User page table in %cr3, or 0
+  uint ntlbsent;               // TLB shootdown IPIs sent
+  uint ntlbbatch;              // ... requests added to a pending IPI
+  uint ntlbavoid;              // ... shootdowns no other CPU needed
 
   // Cpu-local storage variables; see below
 #if X64
   void *local;
+  int pcid;                    // Is CR4.PCIDE set?
+  uint64 pcidasid[NPCID];      // asid whose TLB entries PCID i+1 holds
+  uint pcidnext;               // Next PCID slot to recycle
 #else
   struct cpu *cpu;
   struct proc *proc;           // The currently-running process.
@@ -72,11 +93,25 @@ struct context {
 };
 #endif
 
+// A region of user memory whose pages are filled in on first
+// touch (see pagefault in vm.c): a program segment set up by
+// exec, or a mapping made by mmap.
+struct vma {
+  uintp start;                 // First address, page aligned
+  uintp end;                   // End address, page aligned; 0 if free
+  int prot;                    // PTE_W if writable
+  int flags;                   // MAP_SHARED or MAP_PRIVATE, MAP_GROWSDOWN
+  struct inode *ip;            // Backing file; 0 if anonymous
+  uint off;                    // File offset of start
+  uint filesz;                 // Bytes from the file; the rest are zero
+};
+
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
 struct proc {
   uintp sz;                     // Size of process memory (bytes)
+  uint64 asid;                 // Names pgdir's contents in the TLB
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
@@ -85,14 +120,36 @@ struct proc {
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *wqnext;         // Links in chan's wait queue
+  struct proc *wqprev;
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
+  struct vma vma[NVMA];        // Mapped memory regions
+  uint nhuge;                  // Huge pages mapped in on first touch
+  uint nsmall;                 // Small pages mapped in on first touch
+  uint nhugefail;              // Huge page wanted, none free
+  uint nhugesplit;             // Huge pages split into small ones
+  int swappable;               // Not using its page table in the kernel
+  int swapping;                // reclaim() is taking its pages; don't run
+  uintp clock;                 // Where reclaim() looks at its pages next
+  int rqcpu;                   // Run queue it is on or goes back to
+  struct proc *rqnext;         // Next in that run queue (SCHED_MLFQ)
+  struct proc *rqleft;         // Children in that run queue's tree
+  struct proc *rqright;
+  uint64 rqtsc;                // When it was last queued
+  uint64 runtsc;               // When it last started running
+  uint64 vruntime;             // Weighted CPU time; relative while asleep
+  int nice;                    // NICEMIN..NICEMAX; sets weight, base priority
+  int prio;                    // Current priority level, 0 highest
+  int slice;                   // Ticks run of its time slice (SCHED_MLFQ)
   char name[16];               // Process name (debugging)
+  struct proc *next;           // Next in ptable.list
 };
 
-// Process memory is laid out contiguously, low addresses first:
+// Process memory is laid out low addresses first:
 //   text
 //   original data and bss
-//   fixed-size stack
-//   expandable heap
+//   expandable heap, up to sz
+//   mmap regions, placed top down below the stack's limit
+//   stack, growing down from USERTOP on demand (see uvmcheck)
@@ -21,3 +21,9 @@
 #define SYS_mkdir  20
 #define SYS_close  21
 #define SYS_chmod  22
+#define SYS_mmap   23
+#define SYS_munmap 24
+#define SYS_msync  25
+#define SYS_spawn  26
+#define SYS_setpriority 27
+#define SYS_nice   28
@@ -4,11 +4,14 @@ typedef unsigned char  uchar;
 
 typedef unsigned int  uint32;
 typedef unsigned long uint64;
+typedef long          int64;   // same width as uint64
 
 #if X64
 typedef unsigned long uintp;
+typedef long          intp;
 #else
 typedef unsigned int  uintp;
+typedef int           intp;
 #endif
 
 typedef uintp pde_t;
@@ -24,6 +24,12 @@ char* sbrk(int);
 int sleep(int);		/* POSIX incompatible */
 int uptime(void);	/* POSIX incompatible */
 int chmod(const char *, int);
+void* mmap(void*, uintp, int, int, int, int);
+int munmap(void*, uintp);
+int msync(void*, uintp);
+int spawn(char*, char**, int*);
+int setpriority(int, int);
+int nice(int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -129,6 +129,15 @@ hlt(void)
   asm volatile("hlt");
 }
 
+// Enable interrupts and halt.  sti takes effect only after the
+// next instruction, so an interrupt already pending wakes the
+// hlt rather than being taken just before it.
+static inline void
+stihlt(void)
+{
+  asm volatile("sti; hlt");
+}
+
 static inline uint
 xchg(volatile uint *addr, uintp newval)
 {
@@ -156,6 +165,42 @@ lcr3(uintp val)
   asm volatile("mov %0,%%cr3" : : "r" (val));
 }
 
+static inline uintp
+rcr3(void)
+{
+  uintp val;
+  asm volatile("mov %%cr3,%0" : "=r" (val));
+  return val;
+}
+
+static inline uintp
+rcr4(void)
+{
+  uintp val;
+  asm volatile("mov %%cr4,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+lcr4(uintp val)
+{
+  asm volatile("mov %0,%%cr4" : : "r" (val));
+}
+
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+}
+
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return (unsigned long long)hi << 32 | lo;
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
@@ -123,10 +123,11 @@ static int acpi_config_smp(struct acpi_madt *madt) {
   return -1;
 }
 
+// The tables must lie in memory that the boot page tables map.
 #if X64
-#define PHYSLIMIT 0x80000000
+#define ACPILIMIT 0x80000000
 #else
-#define PHYSLIMIT 0x0E000000
+#define ACPILIMIT 0x0E000000
 #endif
 
 int acpiinit(void) {
@@ -136,13 +137,13 @@ int acpiinit(void) {
   struct acpi_madt *madt = 0;
 
   rdsp = find_rdsp();
-  if (rdsp->rsdt_addr_phys > PHYSLIMIT)
+  if (rdsp->rsdt_addr_phys > ACPILIMIT)
     goto notmapped;
   rsdt = p2v(rdsp->rsdt_addr_phys);
   count = (rsdt->header.length - sizeof(*rsdt)) / 4;
   for (n = 0; n < count; n++) {
     struct acpi_desc_header *hdr = p2v(rsdt->entry[n]);
-    if (rsdt->entry[n] > PHYSLIMIT)
+    if (rsdt->entry[n] > ACPILIMIT)
       goto notmapped;
 #if DEBUG
     uchar sig[5], id[7], tableid[9], creator[5];
@@ -161,6 +162,6 @@ int acpiinit(void) {
   return acpi_config_smp(madt);
 
 notmapped:
-  cprintf("acpi: tables above 0x%x not mapped.\n", PHYSLIMIT);
+  cprintf("acpi: tables above 0x%x not mapped.\n", ACPILIMIT);
   return -1;
 }
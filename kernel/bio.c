@@ -56,15 +56,27 @@ binit(void)
   }
 }
 
+// brelse() wakes one process waiting for a buffer.  If that
+// process, having slept on waited, goes on without taking it
+// (the buffer was recycled for another block meanwhile), pass
+// the wakeup on to the next one.  Caller holds bcache.lock.
+static void
+passon(struct buf *waited, struct buf *b)
+{
+  if(waited && waited != b && !(waited->flags & B_BUSY))
+    wakeupone(waited);
+}
+
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return B_BUSY buffer.
 static struct buf*
 bget(uint dev, uint blockno)
 {
-  struct buf *b;
+  struct buf *b, *waited;
 
   acquire(&bcache.lock);
+  waited = 0;
 
  loop:
   // Is the block already cached?
@@ -72,10 +84,13 @@ bget(uint dev, uint blockno)
     if(b->dev == dev && b->blockno == blockno){
       if(!(b->flags & B_BUSY)){
         b->flags |= B_BUSY;
+        passon(waited, b);
         release(&bcache.lock);
         return b;
       }
+      passon(waited, b);
       sleep(b, &bcache.lock);
+      waited = b;
       goto loop;
     }
   }
@@ -85,6 +100,7 @@ bget(uint dev, uint blockno)
   // hasn't yet committed the changes to the buffer.
   for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
     if((b->flags & B_BUSY) == 0 && (b->flags & B_DIRTY) == 0){
+      passon(waited, b);
       b->dev = dev;
       b->blockno = blockno;
       b->flags = B_BUSY;
@@ -136,7 +152,9 @@ brelse(struct buf *b)
   bcache.head.next = b;
 
   b->flags &= ~B_BUSY;
-  wakeup(b);
+  // Only one waiter can have it.  The one woken either takes
+  // b or finds someone else has, who will wake the next.
+  wakeupone(b);
 
   release(&bcache.lock);
 }
@@ -0,0 +1,104 @@
+// Physical memory map.
+//
+// bootasm.S asks the BIOS for its E820 memory map while still in
+// real mode and leaves it at physical address E820MAP.  e820init()
+// turns the usable entries into a sorted list of page-aligned
+// ranges that the page allocator and the kernel direct map use.
+// If there is no map (e.g. the kernel was started by some other
+// loader), assume [0, PHYSTOP) is RAM.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+
+#define E820MAGIC 0x534d4150  // 'SMAP'
+#define E820_RAM  1
+
+struct e820map {
+  uint32 magic;
+  uint32 n;
+  struct {
+    uint32 addrlo;
+    uint32 addrhi;
+    uint32 lenlo;
+    uint32 lenhi;
+    uint32 type;
+    uint32 attr;
+  } entry[E820MAX];
+};
+
+static struct {
+  int n;
+  struct {
+    uintp start;
+    uintp end;
+  } range[E820MAX];
+} mem;
+
+uintp memtop;   // end of the highest usable range
+
+// Add [start, end) to the sorted list of ranges.
+static void
+addrange(uint64 start, uint64 end)
+{
+  int i;
+
+  start = PGROUNDUP(start);
+  end = PGROUNDDOWN(end);
+  if(end > PHYSLIMIT)
+    end = PHYSLIMIT;
+  if(start >= end || mem.n == E820MAX)
+    return;
+
+  for(i = mem.n; i > 0 && mem.range[i-1].start > start; i--)
+    mem.range[i] = mem.range[i-1];
+  mem.range[i].start = start;
+  mem.range[i].end = end;
+  mem.n++;
+}
+
+void
+e820init(void)
+{
+  struct e820map *m;
+  uint64 addr, end;
+  int i;
+
+  m = (struct e820map*)P2V(E820MAP);
+  if(m->magic == E820MAGIC){
+    for(i = 0; i < m->n && i < E820MAX; i++){
+      if(m->entry[i].type != E820_RAM)
+        continue;
+#if X64
+      addr = (uint64)m->entry[i].addrhi << 32 | m->entry[i].addrlo;
+      end = addr + ((uint64)m->entry[i].lenhi << 32 | m->entry[i].lenlo);
+#else
+      // Cannot address memory above 4GB.
+      if(m->entry[i].addrhi)
+        continue;
+      addr = m->entry[i].addrlo;
+      end = addr + m->entry[i].lenlo;
+      if(m->entry[i].lenhi || end < addr)
+        end = 0xFFFFFFFF;
+#endif
+      addrange(addr, end);
+    }
+  }
+  if(mem.n == 0)
+    addrange(0, PHYSTOP);
+  memtop = mem.range[mem.n-1].end;
+}
+
+// Return the i'th usable range of physical memory in
+// *start and *end.  Returns 0 if there is no such range.
+int
+e820range(int i, uintp *start, uintp *end)
+{
+  if(i < 0 || i >= mem.n)
+    return 0;
+  *start = mem.range[i].start;
+  *end = mem.range[i].end;
+  return 1;
+}
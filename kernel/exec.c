@@ -6,9 +6,13 @@
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
+#include "mman.h"
 
+// Replace the user image of p, which is either the current
+// process or a new one that spawn() is setting up and that has
+// no image yet, with the program in path.
 int
-exec(char *path, char **argv)
+execproc(struct proc *p, char *path, char **argv)
 {
   char *s, *last;
   int i, off;
@@ -17,10 +21,16 @@ exec(char *path, char **argv)
   struct inode *ip;
   struct proghdr ph;
   pde_t *pgdir, *oldpgdir;
+  struct vma *vmas, *v;
+
+  if((vmas = kmalloc(NVMA * sizeof(*vmas))) == 0)
+    return -1;
+  memset(vmas, 0, NVMA * sizeof(*vmas));
 
   begin_op();
   if((ip = namei(path)) == 0){
     end_op();
+    kmfree(vmas);
     return -1;
   }
   ilock(ip);
@@ -35,8 +45,10 @@ exec(char *path, char **argv)
   if((pgdir = setupkvm()) == 0)
     goto bad;
 
-  // Load program into memory.
+  // Record where each segment comes from in the file;
+  // pagefault() reads the pages in as the program touches them.
   sz = 0;
+  v = vmas;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -44,24 +56,41 @@ exec(char *path, char **argv)
       continue;
     if(ph.memsz < ph.filesz)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+    if(ph.vaddr % PGSIZE != 0 || ph.vaddr < sz)
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr || ph.vaddr + ph.memsz > USERTOP)
       goto bad;
-    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+    if(ph.memsz == 0)
+      continue;
+    if(v == vmas + NVMA)
       goto bad;
+    v->start = ph.vaddr;
+    v->end = PGROUNDUP(ph.vaddr + ph.memsz);
+    v->prot = (ph.flags & ELF_PROG_FLAG_WRITE) ? PTE_W : 0;
+    v->flags = MAP_PRIVATE;
+    v->ip = idup(ip);
+    v->off = ph.off;
+    v->filesz = ph.filesz;
+    sz = v->end;
+    v++;
   }
   iunlockput(ip);
   end_op();
   ip = 0;
 
-  // Allocate two pages at the next page boundary.
-  // Make the first inaccessible.  Use the second as the user stack.
-  // The first page is used as a guarded page to limit the stack's memory to one page
-  // As the first page isn't used and thus accessing it would cause an exception.
-  sz = PGROUNDUP(sz);
-  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+  // The stack is a region of its own at the top of the address
+  // space, which grows down a page at a time as the program
+  // touches it, up to STACKMAX.  Allocate its first page now
+  // for the arguments.
+  if(sz > USERTOP - STACKMAX - STACKGAP || v == vmas + NVMA)
+    goto bad;
+  v->start = USERTOP - PGSIZE;
+  v->end = USERTOP;
+  v->prot = PTE_W;
+  v->flags = MAP_PRIVATE | MAP_GROWSDOWN;
+  if(allocuvm(pgdir, v->start, v->end) == 0)
     goto bad;
-  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
-  sp = sz;
+  sp = v->end;
 
   // Push argument strings, prepare rest of stack in ustack.
   for(argc = 0; argv[argc]; argc++) {
@@ -79,8 +108,8 @@ exec(char *path, char **argv)
   ustack[2] = sp - (argc+1)*sizeof(uintp);  // argv pointer
 
 #if X64
-  proc->tf->rdi = argc;
-  proc->tf->rsi = sp - (argc+1)*sizeof(uintp);
+  p->tf->rdi = argc;
+  p->tf->rsi = sp - (argc+1)*sizeof(uintp);
 #endif
 
   sp -= (3+argc+1) * sizeof(uintp);
@@ -91,24 +120,41 @@ exec(char *path, char **argv)
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(proc->name, last, sizeof(proc->name));
+  safestrcpy(p->name, last, sizeof(p->name));
 
   // Commit to the user image.
-  oldpgdir = proc->pgdir;
-  proc->pgdir = pgdir;
-  proc->sz = sz;
-  proc->tf->eip = elf.entry;  // main
-  proc->tf->esp = sp;
-  switchuvm(proc);
-  freevm(oldpgdir);
+  oldpgdir = p->pgdir;
+  p->pgdir = pgdir;
+  p->sz = sz;
+  p->tf->eip = elf.entry;  // main
+  p->tf->esp = sp;
+  if(oldpgdir){
+    flushuvm(p);
+    syncvmas(oldpgdir, p->vma, 0, USERTOP);
+    freevm(oldpgdir);
+    begin_op();
+    freevmas(p->vma);
+    end_op();
+  }
+  memmove(p->vma, vmas, NVMA * sizeof(*vmas));
+  kmfree(vmas);
   return 0;
 
  bad:
   if(pgdir)
     freevm(pgdir);
-  if(ip){
+  if(ip)
     iunlockput(ip);
-    end_op();
-  }
+  else
+    begin_op();
+  freevmas(vmas);
+  end_op();
+  kmfree(vmas);
   return -1;
 }
+
+int
+exec(char *path, char **argv)
+{
+  return execproc(proc, path, argv);
+}
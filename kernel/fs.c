@@ -156,15 +156,28 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 
+//
+// In-memory inodes are allocated from a slab cache by iget()
+// and freed by iput() when the last reference goes away, so
+// icache.list holds exactly the inodes with ref > 0.
+
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *list;
+  struct kmem_cache *cache;
 } icache;
 
+// Source of inode generation numbers.  An inode gets a new one
+// each time it is read in from disk and each time it is written,
+// so a (dev, inum, gen) triple names one version of a file's
+// contents, even across inode cache evictions.
+static uint nextgen;
+
 void
 iinit(void)
 {
   initlock(&icache.lock, "icache");
+  icache.cache = kmem_cache_create("inode", sizeof(struct inode));
 }
 
 static struct inode* iget(uint dev, uint inum);
@@ -223,31 +236,28 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+  for(ip = icache.list; ip; ip = ip->next){
+    if(ip->dev == dev && ip->inum == inum){
       ip->ref++;
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Allocate a new inode cache entry.
+  if((ip = kmem_cache_alloc(icache.cache)) == 0)
     panic("iget: no inodes");
-
-  ip = empty;
+  memset(ip, 0, sizeof(*ip));
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
-  ip->flags = 0;
+  ip->next = icache.list;
+  icache.list = ip;
   release(&icache.lock);
 
   return ip;
@@ -294,6 +304,7 @@ ilock(struct inode *ip)
     ip->mode = dip->mode;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->gen = __sync_add_and_fetch(&nextgen, 1);
     ip->flags |= I_VALID;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -314,8 +325,8 @@ iunlock(struct inode *ip)
 }
 
 // Drop a reference to an in-memory inode.
-// If that was the last reference, the inode cache entry can
-// be recycled.
+// If that was the last reference, the inode cache entry is
+// freed.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 // All calls to iput() must be inside a transaction in
@@ -323,6 +334,8 @@ iunlock(struct inode *ip)
 void
 iput(struct inode *ip)
 {
+  struct inode **pp;
+
   acquire(&icache.lock);
   if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
     // inode has no links and no other references: truncate and free.
@@ -337,7 +350,12 @@ iput(struct inode *ip)
     ip->flags = 0;
     wakeup(ip);
   }
-  ip->ref--;
+  if(--ip->ref == 0){
+    for(pp = &icache.list; *pp != ip; pp = &(*pp)->next)
+      ;
+    *pp = ip->next;
+    kmem_cache_free(icache.cache, ip);
+  }
   release(&icache.lock);
 }
 
@@ -421,6 +439,7 @@ itrunc(struct inode *ip)
   }
 
   ip->size = 0;
+  ip->gen = __sync_add_and_fetch(&nextgen, 1);
   iupdate(ip);
 }
 
@@ -485,6 +504,7 @@ writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
+  ip->gen = __sync_add_and_fetch(&nextgen, 1);
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
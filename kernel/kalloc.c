@@ -1,6 +1,7 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, or physically
+// contiguous blocks of 2^order pages.
 
 #include "types.h"
 #include "defs.h"
@@ -8,47 +9,251 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "x86.h"
+#include "proc.h"
 
 void freerange(void *vstart, void *vend);
+static char* kzeropop(void);
 extern char end[]; // first address after kernel loaded from ELF file
 
-struct run {
-  struct run *next;
+// One per physical page below memtop.
+// A free block of 2^order pages is represented by its first
+// page, which has PG_FREE set and sits on kmem.free[order].
+// An allocated page counts its references, so that pages can
+// be shared copy-on-write; kfree() frees it when the last
+// reference goes away.
+struct page {
+  struct page *next;   // free list links
+  struct page *prev;
+  uchar flags;
+  uchar order;         // order of the block this page heads
+  uint ref;            // references to an allocated page
 };
+#define PG_FREE 0x1    // heads a free block in the buddy lists
+#define PG_TEXT 0x2    // listed in the text cache (see text.c)
 
+// Free memory is kept by a binary buddy allocator: a free block
+// of order k is 2^k pages long and starts at a page number that
+// is a multiple of 2^k.  Its buddy is the block of the same
+// order whose page number differs only in bit k; when both are
+// free they are merged into one block of order k+1.
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct page *pages;            // page descriptors, indexed by pfn
+  uint npages;                   // number of descriptors
+  char *early;                   // end of the range kinit1() freed
+  struct page *free[MAXORDER+1]; // free blocks of each order
+  uint nfree[MAXORDER+1];        // length of each free list
 } kmem;
 
+// Pages that have already been zeroed, for kalloc_zeroed().
+// Idle CPUs keep the pool topped up (see kzerofill), so the
+// zeroing is usually off the critical path of fork, exec and
+// sbrk.  Emptied page tables are recycled into it as well (see
+// kfree_zeroed).  The pool is chained through the page descriptors.
+struct {
+  struct spinlock lock;
+  struct page *list;
+  uint n;
+  uint hit;            // kalloc_zeroed() served from the pool
+  uint miss;           // kalloc_zeroed() had to zero a page itself
+  uint recycled;       // pages kfree_zeroed() put in the pool
+} kzero;
+
+// Once kinit2() has run, kalloc() and kfree() go through a small
+// per-CPU cache of free pages (cpu->kcache) and only take kmem.lock
+// to move KCACHEBATCH pages at a time between the cache and the
+// buddy lists.
+#define KCACHEBATCH (KCACHESIZE/2)
+
+static struct page*
+v2page(void *v)
+{
+  return &kmem.pages[v2p(v) >> PGSHIFT];
+}
+
+static char*
+page2v(struct page *pg)
+{
+  return p2v((uintp)(pg - kmem.pages) << PGSHIFT);
+}
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// kinit1() also carves the page descriptor array out of the
+// front of its range, and moves the end of the range up by as
+// much, so that machines with a lot of memory (and so a large
+// array) still get the same number of pages to start with.
+// kinit2() frees only memory that e820init() found to be usable.
 void
 kinit1(void *vstart, void *vend)
 {
+  uintp sz;
+
   initlock(&kmem.lock, "kmem");
+  initlock(&kzero.lock, "kzero");
   kmem.use_lock = 0;
-  freerange(vstart, vend);
+  kmem.npages = memtop >> PGSHIFT;
+  sz = PGROUNDUP(kmem.npages * sizeof(struct page));
+  kmem.pages = (struct page*)p2v(PGROUNDUP(v2p(vstart)));
+  memset(kmem.pages, 0, sz);
+  kmem.early = (char*)p2v(v2p(vend)) + sz;
+  freerange((char*)kmem.pages + sz, kmem.early);
 }
 
 void
 kinit2(void *vstart, void *vend)
 {
-  freerange(vstart, vend);
+  uintp start, end, lo, hi;
+  int i;
+
+  lo = v2p(vstart);
+  if(lo < v2p(kmem.early))
+    lo = v2p(kmem.early);
+  hi = v2p(vend);
+  for(i = 0; e820range(i, &start, &end); i++){
+    if(start < lo)
+      start = lo;
+    if(end > hi)
+      end = hi;
+    if(start < end)
+      freerange(p2v(start), p2v(end));
+  }
   kmem.use_lock = 1;
 }
 
+static void
+pushfree(struct page *pg, int order)
+{
+  pg->flags |= PG_FREE;
+  pg->order = order;
+  pg->prev = 0;
+  pg->next = kmem.free[order];
+  if(pg->next)
+    pg->next->prev = pg;
+  kmem.free[order] = pg;
+  kmem.nfree[order]++;
+}
+
+static void
+unlinkfree(struct page *pg, int order)
+{
+  if(pg->prev)
+    pg->prev->next = pg->next;
+  else
+    kmem.free[order] = pg->next;
+  if(pg->next)
+    pg->next->prev = pg->prev;
+  pg->flags &= ~PG_FREE;
+  kmem.nfree[order]--;
+}
+
+// Take a block of 2^order pages off the buddy lists, splitting
+// a larger block if necessary.  Caller holds kmem.lock.
+static struct page*
+buddyalloc(int order)
+{
+  struct page *pg;
+  int k;
+
+  for(k = order; k <= MAXORDER; k++)
+    if(kmem.free[k])
+      break;
+  if(k > MAXORDER)
+    return 0;
+  pg = kmem.free[k];
+  unlinkfree(pg, k);
+  while(k > order){
+    k--;
+    pushfree(pg + (1 << k), k);
+  }
+  pg->order = order;
+  return pg;
+}
+
+// Return a block of 2^order pages to the buddy lists,
+// merging it with its buddy for as long as the buddy is free.
+// Caller holds kmem.lock.
+static void
+buddyfree(struct page *pg, int order)
+{
+  struct page *b;
+  uint pfn, bpfn;
+
+  if(pg->flags & PG_FREE)
+    panic("buddyfree");
+  pfn = pg - kmem.pages;
+  while(order < MAXORDER){
+    bpfn = pfn ^ (1 << order);
+    if(bpfn >= kmem.npages)
+      break;
+    b = &kmem.pages[bpfn];
+    if(!(b->flags & PG_FREE) || b->order != order)
+      break;
+    unlinkfree(b, order);
+    pfn &= ~(1 << order);
+    order++;
+  }
+  pushfree(&kmem.pages[pfn], order);
+}
+
+// Give [vstart, vend) to the buddy allocator as the largest
+// aligned blocks that fit.  Only the descriptor of each block's
+// first page is touched, so this is quick even for a lot of memory.
 void
 freerange(void *vstart, void *vend)
 {
-  char *p;
-  p = (char*)PGROUNDUP((uintp)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
-    kfree(p);
+  uintp pfn, epfn;
+  int order;
+
+  pfn = PGROUNDUP(v2p(vstart)) >> PGSHIFT;
+  epfn = PGROUNDDOWN(v2p(vend)) >> PGSHIFT;
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  while(pfn < epfn){
+    for(order = MAXORDER; order > 0; order--)
+      if(pfn % (1 << order) == 0 && pfn + (1 << order) <= epfn)
+        break;
+#ifdef DEBUG
+    memset(p2v(pfn << PGSHIFT), 1, PGSIZE << order);
+#endif
+    buddyfree(&kmem.pages[pfn], order);
+    pfn += 1 << order;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Move up to n pages from the buddy lists into kc.
+// Caller has interrupts off.
+static void
+krefill(struct kcache *kc, int n)
+{
+  struct page *pg;
+
+  acquire(&kmem.lock);
+  while(n-- > 0 && (pg = buddyalloc(0)) != 0)
+    kc->page[kc->n++] = page2v(pg);
+  release(&kmem.lock);
+}
+
+// Move the n least recently freed pages in kc back to
+// the buddy lists.  Caller has interrupts off.
+static void
+kdrain(struct kcache *kc, int n)
+{
+  int i;
+
+  acquire(&kmem.lock);
+  for(i = 0; i < n; i++)
+    buddyfree(v2page(kc->page[i]), 0);
+  release(&kmem.lock);
+  kc->n -= n;
+  memmove(kc->page, kc->page + n, kc->n * sizeof(kc->page[0]));
 }
 
 //PAGEBREAK: 21
@@ -59,21 +264,63 @@ freerange(void *vstart, void *vend)
 void
 kfree(char *v)
 {
-  struct run *r;
+  struct kcache *kc;
 
-  if((uintp)v % PGSIZE || v < end || v2p(v) >= PHYSTOP)
+  if((uintp)v % PGSIZE || v2p(v) < v2p(end) || v2p(v) >= memtop)
     panic("kfree");
+  if(v2page(v)->ref < 1)
+    panic("kfree: ref");
+  if(__sync_sub_and_fetch(&v2page(v)->ref, 1) > 0)
+    return;   // still shared
+  if(v2page(v)->flags & PG_TEXT){
+    v2page(v)->flags &= ~PG_TEXT;
+    textdrop(v);
+  }
 
+#ifdef DEBUG
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  if(!kmem.use_lock){
+    buddyfree(v2page(v), 0);
+    return;
+  }
+
+  pushcli();
+  kc = &cpu->kcache;
+  if(kc->n == KCACHESIZE){
+    kc->drain++;
+    kdrain(kc, KCACHEBATCH);
+  }
+  kc->page[kc->n++] = v;
+  popcli();
+}
+
+// Allocate a page from this CPU's cache or the buddy lists.
+static char*
+kalloc1(void)
+{
+  struct kcache *kc;
+  struct page *pg;
+  char *v;
+
+  if(!kmem.use_lock){
+    pg = buddyalloc(0);
+    return pg ? page2v(pg) : 0;
+  }
+
+  pushcli();
+  kc = &cpu->kcache;
+  if(kc->n > 0)
+    kc->hit++;
+  else {
+    kc->miss++;
+    krefill(kc, KCACHEBATCH);
+  }
+  v = kc->n > 0 ? kc->page[--kc->n] : 0;
+  popcli();
+  return v;
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -82,15 +329,332 @@ kfree(char *v)
 char*
 kalloc(void)
 {
-  struct run *r;
+  char *v;
+
+  if((v = kalloc1()) == 0 && kmem.use_lock)
+    v = kzeropop();   // last resort: the zeroed pool
+  if(v)
+    v2page(v)->ref = 1;
+  return v;
+}
+
+// Add a reference to the allocated page at v.
+void
+kref(char *v)
+{
+  if(v2page(v)->ref < 1)
+    panic("kref");
+  __sync_add_and_fetch(&v2page(v)->ref, 1);
+}
+
+// Add a reference to the page at v if it is still allocated.
+// Returns 0 if its last reference has already gone, which the
+// text cache needs, since it looks pages up without owning them.
+int
+ktryref(char *v)
+{
+  uint ref;
 
+  do {
+    if((ref = v2page(v)->ref) == 0)
+      return 0;
+  } while(!__sync_bool_compare_and_swap(&v2page(v)->ref, ref, ref+1));
+  return 1;
+}
+
+// Mark the allocated page at v as listed in the text cache,
+// so that kfree() tells the cache when the page goes away.
+void
+ksettext(char *v)
+{
+  v2page(v)->flags |= PG_TEXT;
+}
+
+// Return the number of references to the allocated page at v.
+int
+krefcount(char *v)
+{
+  return v2page(v)->ref;
+}
+
+// Zero the page at v.  On x86-64 use non-temporal stores,
+// so that zeroing pages ahead of time does not push
+// useful data out of the cache.
+static void
+zeropage(char *v)
+{
+#if X64
+  uint64 *p;
+
+  for(p = (uint64*)v; p < (uint64*)(v + PGSIZE); p += 4){
+    asm volatile("movnti %1, %0" : "=m" (p[0]) : "r" (0UL));
+    asm volatile("movnti %1, %0" : "=m" (p[1]) : "r" (0UL));
+    asm volatile("movnti %1, %0" : "=m" (p[2]) : "r" (0UL));
+    asm volatile("movnti %1, %0" : "=m" (p[3]) : "r" (0UL));
+  }
+  asm volatile("sfence" ::: "memory");
+#else
+  memset(v, 0, PGSIZE);
+#endif
+}
+
+// Take a page off the zeroed pool, or return 0 if it is empty.
+// Caller holds kzero.lock.
+static struct page*
+kzeropop1(void)
+{
+  struct page *pg;
+
+  if((pg = kzero.list) != 0){
+    kzero.list = pg->next;
+    kzero.n--;
+  }
+  return pg;
+}
+
+static char*
+kzeropop(void)
+{
+  struct page *pg;
+
+  acquire(&kzero.lock);
+  pg = kzeropop1();
+  release(&kzero.lock);
+  return pg ? page2v(pg) : 0;
+}
+
+// Allocate one page of zeroed physical memory.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc_zeroed(void)
+{
+  struct page *pg;
+  char *v;
+
+  if(kmem.use_lock){
+    acquire(&kzero.lock);
+    if((pg = kzeropop1()) != 0)
+      kzero.hit++;
+    else
+      kzero.miss++;
+    release(&kzero.lock);
+    if(pg){
+      pg->ref = 1;
+      return page2v(pg);
+    }
+  }
+  if((v = kalloc()) == 0)
+    return 0;
+  memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Zero one free page and add it to the zeroed pool.
+// Called by idle CPUs from scheduler().  Returns 0 if
+// the pool is already full or there is no free memory.
+int
+kzerofill(void)
+{
+  struct page *pg;
+  char *v;
+
+  if(!kmem.use_lock || kzero.n >= NZEROPAGE)
+    return 0;
+  if((v = kalloc1()) == 0)
+    return 0;
+  zeropage(v);
+  pg = v2page(v);
+  acquire(&kzero.lock);
+  pg->next = kzero.list;
+  kzero.list = pg;
+  kzero.n++;
+  release(&kzero.lock);
+  return 1;
+}
+
+// Free the page at v, which the caller knows to be all zeros
+// (an emptied page table, say), into the zeroed pool so that
+// kalloc_zeroed() can hand it out again without clearing it.
+void
+kfree_zeroed(char *v)
+{
+  struct page *pg;
+
+  if(!kmem.use_lock || kzero.n >= NZEROPAGE){
+    kfree(v);
+    return;
+  }
+  pg = v2page(v);
+  if(pg->ref < 1)
+    panic("kfree_zeroed: ref");
+  if(__sync_sub_and_fetch(&pg->ref, 1) > 0)
+    return;   // still shared
+  acquire(&kzero.lock);
+  pg->next = kzero.list;
+  kzero.list = pg;
+  kzero.n++;
+  kzero.recycled++;
+  release(&kzero.lock);
+}
+
+// Allocate 2^order physically contiguous pages, aligned
+// to their size.  Returns 0 if no block that large is free.
+char*
+kallocpages(int order)
+{
+  struct page *pg;
+
+  if(order == 0)
+    return kalloc();
+  if(order < 0 || order > MAXORDER)
+    return 0;
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  pg = buddyalloc(order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  if(pg == 0)
+    return 0;
+  pg->ref = 1;
+  return page2v(pg);
+}
+
+// Drop a reference to a block returned by kallocpages(order),
+// freeing it with the last one.  If ksplitpages() has split
+// the block since, drop a reference to each of its pages.
+void
+kfreepages(char *v, int order)
+{
+  struct page *pg;
+  int i, split, last;
+
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  if(order < 0 || order > MAXORDER || (v2p(v) >> PGSHIFT) % (1 << order))
+    panic("kfreepages");
+  if(v2p(v) < v2p(end) || v2p(v) + (PGSIZE << order) > memtop)
+    panic("kfreepages");
+  pg = v2page(v);
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  split = pg->order != order;
+  if(split && pg->order != 0)
+    panic("kfreepages: wrong order");
+  last = 0;
+  if(!split){
+    if(pg->ref < 1)
+      panic("kfreepages: ref");
+    last = --pg->ref == 0;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  if(split){
+    for(i = 0; i < (1 << order); i++)
+      kfree(v + i*PGSIZE);
+    return;
+  }
+  if(!last)
+    return;   // still shared
+
+#ifdef DEBUG
+  memset(v, 1, PGSIZE << order);
+#endif
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  buddyfree(pg, order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Add a reference to the block at v, returned by
+// kallocpages(order), or to each of its pages if ksplitpages()
+// has split it since.
+void
+krefpages(char *v, int order)
+{
+  struct page *pg;
+  int i;
+
+  pg = v2page(v);
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
+  if(pg->order == order){
+    if(pg->ref < 1)
+      panic("krefpages");
+    pg->ref++;
+  } else
+    for(i = 0; i < (1 << order); i++)
+      kref(v + i*PGSIZE);
   if(kmem.use_lock)
     release(&kmem.lock);
-  return (char*)r;
 }
 
+// Turn the block at v, returned by kallocpages(order), into
+// 2^order separately allocated pages, each of which must
+// later be freed with kfree().  Each page starts with the
+// block's references: whoever shared the block shares it.
+// Does nothing if another sharer has split it already.
+void
+ksplitpages(char *v, int order)
+{
+  struct page *pg;
+  int i;
+
+  pg = v2page(v);
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(pg->order != order && pg->order != 0)
+    panic("ksplitpages");
+  if(pg->ref < 1)
+    panic("ksplitpages: ref");
+  if(pg->order == order)
+    for(i = 0; i < (1 << order); i++){
+      pg[i].order = 0;
+      pg[i].ref = pg->ref;
+    }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
+
+// Return the order that the block at v was allocated with.
+int
+kpageorder(char *v)
+{
+  return v2page(v)->order;
+}
+
+// Print per-CPU cache hit rates and, for every order, how many
+// free blocks of that size the buddy allocator holds.
+// For debugging; reads other CPUs' counters without locking.
+void
+kallocdump(void)
+{
+  struct kcache *kc;
+  uint cached, total;
+  int i;
+
+  cached = 0;
+  for(i = 0; i < ncpu; i++){
+    kc = &cpus[i].kcache;
+    cached += kc->n;
+    cprintf("cpu%d: kcache %d pages, hit %d miss %d drain %d",
+            i, kc->n, kc->hit, kc->miss, kc->drain);
+    if(kc->hit + kc->miss)
+      cprintf(" (%d%% local)", kc->hit * 100 / (kc->hit + kc->miss));
+    cprintf("\n");
+  }
+
+  acquire(&kmem.lock);
+  total = 0;
+  for(i = 0; i <= MAXORDER; i++){
+    cprintf("order %d (%d KB): %d free\n", i, 4 << i, kmem.nfree[i]);
+    total += kmem.nfree[i] << i;
+  }
+  release(&kmem.lock);
+  cprintf("kmem: %d free pages, %d in per-cpu caches\n", total, cached);
+  cprintf("kzero: %d zeroed pages, hit %d miss %d recycled %d\n",
+          kzero.n, kzero.hit, kzero.miss, kzero.recycled);
+}
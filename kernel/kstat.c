@@ -0,0 +1,34 @@
+// Kernel statistics device.
+// Reading /kstat prints the counters kept by various kernel
+// subsystems to the console, the same way /cpuid prints CPU features.
+
+#include "types.h"
+#include "defs.h"
+#include "fs.h"
+#include "file.h"
+
+static int
+kstat_read(struct inode *ip, char *buf, int n)
+{
+  kallocdump();
+  slabdump();
+  tlbdump();
+  pgtdump();
+  swapdump();
+  textdump();
+  rqdump();
+  return 0;
+}
+
+static int
+kstat_write(struct inode *ip, char *buf, int n)
+{
+  return -1;
+}
+
+void
+kstatinit(void)
+{
+  devsw[KSTAT].write = kstat_write;
+  devsw[KSTAT].read = kstat_read;
+}
@@ -42,6 +42,8 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+#define TICKCOUNT 10000000   // timer counts per clock tick
+
 volatile uint *lapic;  // Initialized in mp.c
 
 static void
@@ -67,7 +69,7 @@ lapicinit(void)
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000); 
+  lapicw(TICR, TICKCOUNT);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -143,6 +145,33 @@ microdelay(int us)
 {
 }
 
+// Make this CPU's timer interrupt every tick if n is 0, or
+// otherwise just once, n ticks from now (n <= TICKLESSMAX).
+void
+lapictimer(uint n)
+{
+  if(!lapic)
+    return;
+  if(n == 0){
+    lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+    lapicw(TICR, TICKCOUNT);
+  } else {
+    lapicw(TIMER, T_IRQ0 + IRQ_TIMER);   // one-shot
+    lapicw(TICR, n * TICKCOUNT);
+  }
+}
+
+// Send interrupt vector to the CPU with the given APIC ID.
+// Caller has interrupts off, so nothing else uses the ICR.
+void
+lapicipi(uchar apicid, int vector)
+{
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 #define CMOS_PORT    0x70
 #define CMOS_RETURN  0x71
 
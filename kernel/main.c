@@ -17,30 +17,50 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
+#if DEBUG
+  uint64 t0, t1;
+
+  t0 = rdtsc();
+#endif
   uartearlyinit();
+  e820init();      // physical memory map
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
+  uvminit();       // shared zero page
   if (acpiinit()) // try to use acpi for machine info
     mpinit();      // otherwise use bios MP tables
   lapicinit();
+  cpuidinit();     // CPU features, needed by seginit
   seginit();       // set up segments
   cprintf("\ncpu%d: starting xv6\n\n", cpu->id);
   picinit();       // interrupt controller
   ioapicinit();    // another interrupt controller
   consoleinit();   // I/O devices & their interrupts
   uartinit();      // serial port
+  slabinit();      // kernel object allocator
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
+  pipeinit();      // pipe cache
   iinit();         // inode cache
   ideinit();       // disk
+  swapinit();      // swap space
+  textinit();      // shared program text
   if(!ismp)
     timerinit();   // uniprocessor timer
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+#if DEBUG
+  t1 = rdtsc();
+#endif
+  kinit2(P2V(4*1024*1024), P2V(memtop)); // must come after startothers()
+#if DEBUG
+  cprintf("boot: %d MB, kinit2 %d Kcycles, main %d Kcycles\n",
+          (int)(memtop >> 20), (int)((rdtsc() - t1) >> 10),
+          (int)((rdtsc() - t0) >> 10));
+#endif
   userinit();      // first user process
-  cpuidinit();
+  kstatinit();
   // Finish setting up this processor in mpmain.
   mpmain();
 }
@@ -77,10 +97,13 @@ void entry32mp(void);
 // Use PTE_PS in page directory entry to enable 4Mbyte pages.
 __attribute__((__aligned__(PGSIZE)))
 pde_t entrypgdir[NPDENTRIES] = {
-  // Map VA's [0, 4MB) to PA's [0, 4MB)
+  // Map VA's [0, 8MB) to PA's [0, 8MB)
   [0] = (0) | PTE_P | PTE_W | PTE_PS,
-  // Map VA's [KERNBASE, KERNBASE+4MB) to PA's [0, 4MB)
+  [1] = (1<<PDXSHIFT) | PTE_P | PTE_W | PTE_PS,
+  // Map VA's [KERNBASE, KERNBASE+8MB) to PA's [0, 8MB);
+  // kinit1() puts the page descriptors above 4MB.
   [KERNBASE>>PDXSHIFT] = (0) | PTE_P | PTE_W | PTE_PS,
+  [(KERNBASE>>PDXSHIFT)+1] = (1<<PDXSHIFT) | PTE_P | PTE_W | PTE_PS,
 };
 #endif /* X64 */
 
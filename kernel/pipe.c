@@ -18,6 +18,14 @@ struct pipe {
   int writeopen;  // write fd is still open
 };
 
+static struct kmem_cache *pipecache;
+
+void
+pipeinit(void)
+{
+  pipecache = kmem_cache_create("pipe", sizeof(struct pipe));
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -27,7 +35,7 @@ pipealloc(struct file **f0, struct file **f1)
   *f0 = *f1 = 0;
   if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
     goto bad;
-  if((p = (struct pipe*)kalloc()) == 0)
+  if((p = kmem_cache_alloc(pipecache)) == 0)
     goto bad;
   p->readopen = 1;
   p->writeopen = 1;
@@ -47,7 +55,7 @@ pipealloc(struct file **f0, struct file **f1)
 //PAGEBREAK: 20
  bad:
   if(p)
-    kfree((char*)p);
+    kmem_cache_free(pipecache, p);
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -68,7 +76,7 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
-    kfree((char*)p);
+    kmem_cache_free(pipecache, p);
   } else
     release(&p->lock);
 }
@@ -83,15 +91,20 @@ pipewrite(struct pipe *p, char *addr, int n)
   for(i = 0; i < n; i++){
     while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
       if(p->readopen == 0 || proc->killed){
+        // Pass on a wakeup meant for a writer that can use it.
+        if(p->nwrite != p->nread + PIPESIZE)
+          wakeupone(&p->nwrite);
         release(&p->lock);
         return -1;
       }
-      wakeup(&p->nread);
+      wakeupone(&p->nread);
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
     p->data[p->nwrite++ % PIPESIZE] = addr[i];
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  wakeupone(&p->nread);  //DOC: pipewrite-wakeup1
+  if(p->nwrite != p->nread + PIPESIZE)
+    wakeupone(&p->nwrite);   // room left for another writer
   release(&p->lock);
   return n;
 }
@@ -104,6 +117,9 @@ piperead(struct pipe *p, char *addr, int n)
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
     if(proc->killed){
+      // Pass on a wakeup meant for a reader that can use it.
+      if(p->nread != p->nwrite)
+        wakeupone(&p->nread);
       release(&p->lock);
       return -1;
     }
@@ -114,7 +130,9 @@ piperead(struct pipe *p, char *addr, int n)
       break;
     addr[i] = p->data[p->nread++ % PIPESIZE];
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  if(p->nread != p->nwrite)
+    wakeupone(&p->nread);    // data left for another reader
+  wakeupone(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
   return i;
 }
@@ -4,31 +4,683 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
+#include "traps.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "fcntl.h"
 
+// Process structures come from the "proc" slab cache and are
+// chained on ptable.list from allocproc() until wait() reaps them.
+// NPROC still bounds how many can exist at once.
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct proc *list;
+  int nproc;
+  struct kmem_cache *cache;
 } ptable;
 
+// Each CPU has a queue of RUNNABLE processes, with its own lock;
+// a CPU whose queue is empty steals from the others.  A process
+// goes back on the queue of the CPU it last ran on (rqcpu) when
+// it becomes RUNNABLE, so the only migrations are steals.
+// A CPU stops its timer while it is idle or has nothing queued
+// behind the process it runs, apart from an interrupt by the
+// next tick a sleeper waits for; queueing a process interrupts
+// a CPU that needs to notice.
+//
+// How a CPU chooses among the processes it has queued is a
+// build option.  By default it shares itself out fairly: each
+// process accumulates virtual runtime, the CPU time it has used
+// divided by a weight that its nice value gives it (one step of
+// nice is worth about 25% more or less CPU), and the CPU runs
+// the queued process that has the least.  The queue is a tree
+// ordered by virtual runtime.  While a process is asleep its
+// virtual runtime is kept relative to the least on its queue,
+// so a process that sleeps does not bank CPU time; when it
+// wakes it goes back no more than WAKECREDIT behind the least,
+// which lets processes waiting on I/O or the user run soon.
+// A stolen process keeps its place relative to the least.
+//
+// Built with SCHED_MLFQ (make SCHED=mlfq), a queue instead holds
+// one list per priority level, 0 the highest, and the CPU runs
+// the first process of the highest level that has one
+// (multilevel feedback).  A process's level starts at the
+// base level its nice value gives it.  Using up a time slice
+// moves it down a level, with longer slices further down;
+// waking from sleep moves it back to its base level, so that
+// processes waiting on I/O or the user run ahead of ones that
+// compute.  Every PRIODECAY ticks each CPU moves the processes
+// it has queued up a level, so the penalty decays and nothing
+// waits forever.  Under either policy the base level is what
+// scheduling latency is reported by.
+//
+// The queue lock of the CPU a process runs on, rather than
+// ptable.lock, is what the process holds across swtch() into
+// the scheduler and back, and so protects the RUNNABLE <->
+// RUNNING transitions.  ptable.lock still covers the process
+// list and parent links.  Several run queue locks are taken
+// lowest CPU first.
+#define BASEPRIO(nice)  (((nice) - NICEMIN) * NPRIO / (NICEMAX - NICEMIN + 1))
+#define SLICE(prio)     (1 + (prio) / 2)   // ticks
+#define NICE0WEIGHT     1024
+#define WAKECREDIT      (1 << 18)   // virtual runtime, in 64-cycle units
+
+struct runq {
+  struct spinlock lock;
+#ifdef SCHED_MLFQ
+  struct {
+    struct proc *head;         // next to run
+    struct proc *tail;
+  } q[NPRIO];
+#else
+  struct proc *root;           // tree of queued processes
+  uint64 minvr;                // least virtual runtime; never goes back
+#endif
+  int n;                       // processes queued
+  int idle;                    // CPU is halted waiting for work
+  int tickless;                // CPU's timer is stopped (see settimer)
+  uint ticks;                  // clock ticks taken by this CPU
+  uint nswitch;                // processes switched to
+  uint nsteal;                 // processes taken from other CPUs
+  struct {
+    uint n;                    // processes switched to
+    uint wait;                 // Kcycles they spent RUNNABLE
+    uint max;                  // longest of those waits
+  } lat[NPRIO];
+};
+
+static struct runq runq[NCPU];
+
+// Sleeping processes, on queues hashed by wait channel, so that
+// wakeup() only looks at processes sleeping on channels that
+// hash alike.  A queue's lock is what sleep() and wakeup() hold
+// for its channels.  Lock order: ptable.lock, then wait queue
+// locks, then run queue locks.
+#define NWAITQ 61   // prime, so that aligned channels spread out
+
+struct waitq {
+  struct spinlock lock;
+  struct proc *head;           // longest asleep
+  struct proc *tail;
+};
+
+static struct waitq waitq[NWAITQ];
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  ptable.cache = kmem_cache_create("proc", sizeof(struct proc));
+  for(i = 0; i < NCPU; i++)
+    initlock(&runq[i].lock, "runq");
+  for(i = 0; i < NWAITQ; i++)
+    initlock(&waitq[i].lock, "waitq");
+}
+
+static struct waitq*
+chanwq(void *chan)
+{
+  return &waitq[(uintp)chan % NWAITQ];
+}
+
+// Take p off wq.  Caller holds wq->lock.
+static void
+unlinkwait(struct waitq *wq, struct proc *p)
+{
+  if(p->wqprev)
+    p->wqprev->wqnext = p->wqnext;
+  else
+    wq->head = p->wqnext;
+  if(p->wqnext)
+    p->wqnext->wqprev = p->wqprev;
+  else
+    wq->tail = p->wqprev;
+}
+
+// Lock the run queue of the CPU that p last ran on.
+// Returns the queue.
+static struct runq*
+lockrq(struct proc *p)
+{
+  struct runq *rq;
+
+  for(;;){
+    rq = &runq[p->rqcpu];
+    acquire(&rq->lock);
+    if(rq == &runq[p->rqcpu])
+      return rq;
+    release(&rq->lock);   // stolen meanwhile
+  }
+}
+
+#ifdef SCHED_MLFQ
+// Append p to the list for its level on rq.
+// Caller holds rq->lock.
+static void
+enqueue(struct runq *rq, struct proc *p)
+{
+  p->rqnext = 0;
+  if(rq->q[p->prio].tail)
+    rq->q[p->prio].tail->rqnext = p;
+  else
+    rq->q[p->prio].head = p;
+  rq->q[p->prio].tail = p;
+  rq->n++;
+}
+
+// Take p, which follows prev, off the list for its level
+// on rq.  Caller holds rq->lock.
+static void
+unlinkrq(struct runq *rq, struct proc *p, struct proc *prev)
+{
+  if(prev)
+    prev->rqnext = p->rqnext;
+  else
+    rq->q[p->prio].head = p->rqnext;
+  if(rq->q[p->prio].tail == p)
+    rq->q[p->prio].tail = prev;
+  rq->n--;
+}
+
+// Take p off rq.  Caller holds rq->lock.
+static void
+unqueue(struct runq *rq, struct proc *p)
+{
+  struct proc *q, *prev;
+
+  for(prev = 0, q = rq->q[p->prio].head; q != p; prev = q, q = q->rqnext)
+    if(q == 0)
+      panic("unqueue");
+  unlinkrq(rq, p, prev);
+}
+
+// Remove and return the first process on rq that may run,
+// from the highest level that has one, or, if last is set,
+// the last one of that level.  Returns 0 if there is none.
+// Caller holds rq->lock.
+static struct proc*
+dequeue(struct runq *rq, int last)
+{
+  struct proc *p, *prev, *q, *qprev;
+  int i;
+
+  for(i = 0; i < NPRIO; i++){
+    q = qprev = 0;
+    for(prev = 0, p = rq->q[i].head; p; prev = p, p = p->rqnext){
+      if(p->swapping)
+        continue;
+      q = p;
+      qprev = prev;
+      if(!last)
+        break;
+    }
+    if(q){
+      unlinkrq(rq, q, qprev);
+      return q;
+    }
+  }
+  return 0;
+}
+
+// Move each process queued on rq up a level, unless it is
+// at its base level already.  Caller holds rq->lock.
+static void
+decay(struct runq *rq)
+{
+  struct proc *p, *prev, *next;
+  int i;
+
+  for(i = 1; i < NPRIO; i++){
+    for(prev = 0, p = rq->q[i].head; p; p = next){
+      next = p->rqnext;
+      if(p->prio <= BASEPRIO(p->nice)){
+        prev = p;
+        continue;
+      }
+      unlinkrq(rq, p, prev);
+      p->prio--;
+      enqueue(rq, p);
+    }
+  }
+}
+
+// Put p, which just stopped running on this CPU, back on rq if
+// it is RUNNABLE.  Caller holds rq->lock.
+static void
+putback(struct runq *rq, struct proc *p)
+{
+  if(p->state == RUNNABLE){
+    p->rqtsc = rdtsc();
+    enqueue(rq, p);
+  }
+}
+
+// Start p, about to be queued on rq after sleeping or being
+// created, at its base level.  Caller holds rq->lock.
+static void
+place(struct runq *rq, struct proc *p)
+{
+  p->prio = BASEPRIO(p->nice);
+  p->slice = 0;
+}
+
+// p has been taken off queue v to go on rq.
+static void
+migrate(struct runq *v, struct runq *rq, struct proc *p)
+{
+}
+
+// Charge a tick to proc, running on this CPU.  Returns 1 if it
+// should yield: its time slice is used up, and it has dropped
+// a priority level, or a process of a higher level is waiting.
+// Caller holds rq->lock.
+static int
+preempt(struct runq *rq)
+{
+  int i, r;
+
+  if(rq->ticks % PRIODECAY == 0)
+    decay(rq);
+  r = 0;
+  if(++proc->slice >= SLICE(proc->prio)){
+    proc->slice = 0;
+    if(proc->prio < NPRIO-1)
+      proc->prio++;
+    r = 1;
+  }
+  for(i = 0; i < proc->prio; i++)
+    if(rq->q[i].head)
+      r = 1;
+  return r;
+}
+
+// Set p's nice value and move it to its new base level.
+// Caller holds the lock of p's run queue.
+static void
+renice(struct runq *rq, struct proc *p, int nice)
+{
+  p->nice = nice;
+  if(p->state == RUNNABLE){
+    unqueue(rq, p);
+    p->prio = BASEPRIO(nice);
+    enqueue(rq, p);
+  } else
+    p->prio = BASEPRIO(nice);
+}
+
+#else
+// CPU time weights by nice value, NICEMIN first.
+// Each step is about 1.25 times the next.
+static int niceweight[NICEMAX - NICEMIN + 1] = {
+  88761, 71755, 56483, 46273, 36291,
+  29154, 23254, 18705, 14949, 11916,
+   9548,  7620,  6100,  4904,  3906,
+   3121,  2501,  1991,  1586,  1277,
+   1024,   820,   655,   526,   423,
+    335,   272,   215,   172,   137,
+    110,    87,    70,    56,    45,
+     36,    29,    23,    18,    15,
+};
+
+// Virtual runtimes wrap around, so compare them by difference.
+static int
+vrless(uint64 a, uint64 b)
+{
+  return (int64)(a - b) < 0;
+}
+
+// Does p come before q in a run queue tree?
+static int
+before(struct proc *p, struct proc *q)
+{
+  if(p->vruntime != q->vruntime)
+    return vrless(p->vruntime, q->vruntime);
+  return p->pid < q->pid;
+}
+
+// The tree is a treap: a search tree in run order that is also
+// a heap on a hash of the pid, which keeps it balanced with
+// high probability.
+static uint
+heapkey(struct proc *p)
+{
+  return p->pid * 2654435761U;
+}
+
+// Insert p into the subtree at *t.
+static void
+treeinsert(struct proc **t, struct proc *p)
+{
+  struct proc *q;
+
+  if((q = *t) == 0){
+    p->rqleft = p->rqright = 0;
+    *t = p;
+  } else if(before(p, q)){
+    treeinsert(&q->rqleft, p);
+    if(heapkey(q->rqleft) > heapkey(q)){
+      *t = q->rqleft;
+      q->rqleft = (*t)->rqright;
+      (*t)->rqright = q;
+    }
+  } else {
+    treeinsert(&q->rqright, p);
+    if(heapkey(q->rqright) > heapkey(q)){
+      *t = q->rqright;
+      q->rqright = (*t)->rqleft;
+      (*t)->rqleft = q;
+    }
+  }
+}
+
+// Remove p from the tree at *t, by rotating it down
+// until it has at most one child.
+static void
+treeremove(struct proc **t, struct proc *p)
+{
+  struct proc *q;
+
+  while(*t != p){
+    if(*t == 0)
+      panic("treeremove");
+    t = before(p, *t) ? &(*t)->rqleft : &(*t)->rqright;
+  }
+  for(;;){
+    if(p->rqleft == 0){
+      *t = p->rqright;
+      return;
+    }
+    if(p->rqright == 0){
+      *t = p->rqleft;
+      return;
+    }
+    if(heapkey(p->rqleft) > heapkey(p->rqright)){
+      q = p->rqleft;
+      p->rqleft = q->rqright;
+      q->rqright = p;
+      *t = q;
+      t = &q->rqright;
+    } else {
+      q = p->rqright;
+      p->rqright = q->rqleft;
+      q->rqleft = p;
+      *t = q;
+      t = &q->rqleft;
+    }
+  }
+}
+
+// Return the first process in run order in the tree at t that
+// may run, or, if last is set, the last.  Returns 0 if none.
+static struct proc*
+treefirst(struct proc *t, int last)
+{
+  struct proc *p;
+
+  if(t == 0)
+    return 0;
+  if((p = treefirst(last ? t->rqright : t->rqleft, last)) != 0)
+    return p;
+  if(!t->swapping)
+    return t;
+  return treefirst(last ? t->rqleft : t->rqright, last);
+}
+
+// Add p to rq.  Caller holds rq->lock.
+static void
+enqueue(struct runq *rq, struct proc *p)
+{
+  treeinsert(&rq->root, p);
+  rq->n++;
+}
+
+// Remove and return the process on rq with the least virtual
+// runtime that may run, or, if last is set, the most.
+// Returns 0 if there is none.  Caller holds rq->lock.
+static struct proc*
+dequeue(struct runq *rq, int last)
+{
+  struct proc *p;
+
+  if((p = treefirst(rq->root, last)) != 0){
+    treeremove(&rq->root, p);
+    rq->n--;
+  }
+  return p;
+}
+
+// Charge p, which has been running on this CPU, for the time
+// since p->runtsc, and move rq->minvr up to the least of p
+// and the queued processes.  Caller holds rq->lock.
+static void
+charge(struct runq *rq, struct proc *p)
+{
+  struct proc *q;
+  uint64 now, vr;
+  int64 t;
+  uint d;
+
+  now = rdtsc();
+  // Whole 64-cycle units, bounded so that the product below
+  // fits in 32 bits (and 32-bit kernels need no 64-bit divide).
+  // renice() may charge p from another CPU, whose TSC can be
+  // a little behind.
+  if((t = now - p->runtsc) < 0)
+    d = 0;
+  else if(t >= (1 << 27))
+    d = 1 << 21;
+  else
+    d = t >> 6;
+  p->runtsc = now;
+  p->vruntime += d * NICE0WEIGHT / niceweight[p->nice - NICEMIN];
+
+  vr = p->vruntime;
+  if((q = rq->root) != 0){
+    while(q->rqleft)
+      q = q->rqleft;
+    if(vrless(q->vruntime, vr))
+      vr = q->vruntime;
+  }
+  if(vrless(rq->minvr, vr))
+    rq->minvr = vr;
+}
+
+// Put p, which just stopped running on this CPU, back on rq if
+// it is RUNNABLE; otherwise make its virtual runtime relative
+// until setrunnable() places it again.  Caller holds rq->lock.
+static void
+putback(struct runq *rq, struct proc *p)
+{
+  charge(rq, p);
+  if(p->state == RUNNABLE){
+    p->rqtsc = rdtsc();
+    enqueue(rq, p);
+  } else
+    p->vruntime -= rq->minvr;
+}
+
+// Give p, about to be queued on rq after sleeping or being
+// created, an absolute virtual runtime no further than
+// WAKECREDIT behind the least.  Caller holds rq->lock.
+static void
+place(struct runq *rq, struct proc *p)
+{
+  p->vruntime += rq->minvr;
+  if(vrless(p->vruntime, rq->minvr - WAKECREDIT))
+    p->vruntime = rq->minvr - WAKECREDIT;
+  p->prio = BASEPRIO(p->nice);
+}
+
+// p has been taken off queue v to go on rq.
+// Caller holds both locks.
+static void
+migrate(struct runq *v, struct runq *rq, struct proc *p)
+{
+  p->vruntime = p->vruntime - v->minvr + rq->minvr;
+}
+
+// Charge a tick to proc, running on this CPU.  Returns 1 if a
+// queued process is now behind it.  Caller holds rq->lock.
+static int
+preempt(struct runq *rq)
+{
+  struct proc *p;
+
+  charge(rq, proc);
+  p = treefirst(rq->root, 0);
+  return p && vrless(p->vruntime, proc->vruntime);
+}
+
+// Set p's nice value.  Its place in the tree does not change,
+// only how fast its virtual runtime grows from now on.
+// Caller holds the lock of p's run queue.
+static void
+renice(struct runq *rq, struct proc *p, int nice)
+{
+  if(p->state == RUNNING)
+    charge(rq, p);
+  p->nice = nice;
+  p->prio = BASEPRIO(nice);
+}
+
+#endif
+
+// Set this CPU's timer for what it is about to do: tick if
+// processes are queued to take turns with the one it runs,
+// otherwise stop until the next tick a sleeper waits for.
+// Caller holds rq->lock.
+static void
+settimer(struct runq *rq)
+{
+  uint n;
+
+  n = rq->n > 0 ? 0 : clockidle();
+  if(n == 0 && !rq->tickless)
+    return;   // ticking already
+  lapictimer(n);
+  rq->tickless = n > 0;
+}
+
+// A process has just been queued on rq.  Interrupt rq's CPU
+// if it is halted or has stopped its timer, so that it gets
+// to run; if rq's CPU is busy, interrupt an idle CPU too, so
+// that it steals.  Caller holds rq->lock.
+static void
+notify(struct runq *rq)
+{
+  int i;
+
+  if(rq == &runq[cpu->id]){
+    if(rq->tickless)
+      settimer(rq);
+  } else if(rq->idle || rq->tickless)
+    lapicipi(cpus[rq - runq].apicid, T_RESCHED);
+  if(rq->idle)
+    return;
+  for(i = 0; i < ncpu; i++){
+    if(runq[i].idle && i != cpu->id){   // racy, but only a hint
+      lapicipi(cpus[i].apicid, T_RESCHED);
+      break;
+    }
+  }
+}
+
+// Make p RUNNABLE and queue it on the CPU it last ran on.
+// If p is asleep, caller must hold the lock of the wait
+// queue it slept on, and have taken it off.
+static void
+setrunnable(struct proc *p)
+{
+  struct runq *rq;
+
+  rq = lockrq(p);
+  place(rq, p);
+  p->state = RUNNABLE;
+  p->rqtsc = rdtsc();
+  enqueue(rq, p);
+  notify(rq);
+  release(&rq->lock);
+}
+
+// Is a process queued on another CPU?  Racy, but an idle CPU
+// looks after saying it is idle, and setrunnable() looks for
+// idle CPUs after queueing, so one of the two sees the other.
+static int
+stealable(void)
+{
+  int i;
+
+  for(i = 0; i < ncpu; i++)
+    if(runq[i].n > 0 && i != cpu->id)
+      return 1;
+  return 0;
+}
+
+// Move a process from another CPU's queue to rq, this CPU's
+// queue, taking the one that CPU would run last, whose cache
+// state is likely the coldest.  Caller holds rq->lock, which may be
+// dropped and retaken to keep to the lock order.
+// Returns 1 if a process was moved.
+static int
+steal(struct runq *rq)
+{
+  struct runq *v;
+  struct proc *p;
+  int i;
+
+  for(i = 1; i < ncpu; i++){
+    v = &runq[(cpu->id + i) % ncpu];
+    if(v->n == 0)
+      continue;   // racy, but only a hint
+    if(v < rq){
+      release(&rq->lock);
+      acquire(&v->lock);
+      acquire(&rq->lock);
+    } else
+      acquire(&v->lock);
+    if((p = dequeue(v, 1)) != 0){
+      migrate(v, rq, p);
+      p->rqcpu = cpu->id;
+      enqueue(rq, p);
+      rq->nsteal++;
+    }
+    release(&v->lock);
+    if(p)
+      return 1;
+  }
+  return 0;
+}
+
+// Unlink p from the process list and free it.
+// Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &ptable.list; *pp; pp = &(*pp)->next){
+    if(*pp == p){
+      *pp = p->next;
+      ptable.nproc--;
+      kmem_cache_free(ptable.cache, p);
+      return;
+    }
+  }
+  panic("freeproc");
 }
 
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
+// Allocate a new proc and add it to the process table.
+// If successful, set its state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
 static struct proc*
@@ -37,21 +689,29 @@ allocproc(void)
   struct proc *p;
   char *sp;
 
-  acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-  release(&ptable.lock);
-  return 0;
+  if((p = kmem_cache_alloc(ptable.cache)) == 0)
+    return 0;
+  memset(p, 0, sizeof(*p));
+  newasid(p, 0);
 
-found:
+  acquire(&ptable.lock);
+  if(ptable.nproc >= NPROC){
+    release(&ptable.lock);
+    kmem_cache_free(ptable.cache, p);
+    return 0;
+  }
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->next = ptable.list;
+  ptable.list = p;
+  ptable.nproc++;
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -101,26 +761,29 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  p->state = RUNNABLE;
+  setrunnable(p);
 }
 
 // Grow current process's memory by n bytes.
+// Growing only reserves address space; pages are
+// allocated when first touched (see pagefault).
 // Return 0 on success, -1 on failure.
 int
 growproc(int n)
 {
-  uint sz;
+  uintp sz;
   
   sz = proc->sz;
   if(n > 0){
-    if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
+    if(sz + n > heaplimit() || sz + n < sz)
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
       return -1;
+    tlbshootdown(proc, sz, proc->sz);
   }
   proc->sz = sz;
-  switchuvm(proc);
   return 0;
 }
 
@@ -133,17 +796,27 @@ fork(void)
   int i, pid;
   struct proc *np;
 
+  // Pages of shared mappings must exist to be shared.
+  if(fillshared() < 0)
+    return -1;
+
   // Allocate process.
   if((np = allocproc()) == 0)
     return -1;
 
   // Copy process state from p.
-  if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0){
+  // Mapped regions may lie above proc->sz.
+  while((np->pgdir = copyuvm(proc->pgdir, USERTOP)) == 0)
+    if(reclaim(SWAPBATCH, 0) == 0)
+      break;
+  if(np->pgdir == 0){
     kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
+  flushuvm(proc);  // copyuvm made our writable pages read-only
   np->sz = proc->sz;
   np->parent = proc;
   *np->tf = *proc->tf;
@@ -155,19 +828,136 @@ fork(void)
     if(proc->ofile[i])
       np->ofile[i] = filedup(proc->ofile[i]);
   np->cwd = idup(proc->cwd);
+  for(i = 0; i < NVMA; i++){
+    np->vma[i] = proc->vma[i];
+    if(np->vma[i].ip)
+      idup(np->vma[i].ip);
+  }
 
   safestrcpy(np->name, proc->name, sizeof(proc->name));
+  np->nice = proc->nice;
  
   pid = np->pid;
 
-  // lock to force the compiler to emit the np->state write last.
-  acquire(&ptable.lock);
-  np->state = RUNNABLE;
-  release(&ptable.lock);
+  np->rqcpu = cpu->id;
+  setrunnable(np);
   
   return pid;
 }
 
+// Create a new process running the program in path, like
+// fork() followed by exec() in the child, but without copying
+// the current process's memory only to throw it away.  If fds
+// is not 0, the child's file descriptors 0..NSPAWNFD-1 are the
+// current process's fds[0..NSPAWNFD-1], or closed where those
+// are negative, and it has no others; otherwise it inherits
+// them all, as with fork().  Returns the child's pid, or -1.
+int
+spawn(char *path, char **argv, int *fds)
+{
+  int i, pid;
+  struct proc *np;
+
+  if(fds)
+    for(i = 0; i < NSPAWNFD; i++)
+      if(fds[i] >= NOFILE || (fds[i] >= 0 && proc->ofile[fds[i]] == 0))
+        return -1;
+
+  if((np = allocproc()) == 0)
+    return -1;
+  *np->tf = *proc->tf;
+  np->tf->eax = 0;
+  if(execproc(np, path, argv) < 0){
+    kfree(np->kstack);
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
+  np->parent = proc;
+
+  if(fds){
+    for(i = 0; i < NSPAWNFD; i++)
+      if(fds[i] >= 0)
+        np->ofile[i] = filedup(proc->ofile[fds[i]]);
+  } else {
+    for(i = 0; i < NOFILE; i++)
+      if(proc->ofile[i])
+        np->ofile[i] = filedup(proc->ofile[i]);
+  }
+  np->cwd = idup(proc->cwd);
+  np->nice = proc->nice;
+
+  pid = np->pid;
+
+  np->rqcpu = cpu->id;
+  setrunnable(np);
+
+  return pid;
+}
+
+// Choose a process for reclaim() to take pages from, in
+// turn: one that is not running and is not using its page
+// table in the kernel (see swappable), or, if self is set,
+// the current process.  Keep it from running until
+// dropvictim().  Returns 0 if there is none.
+struct proc*
+pickvictim(int self)
+{
+  static int lastpid;
+  struct proc *p, *next, *first;
+  struct runq *rq;
+  int tries;
+
+  acquire(&ptable.lock);
+  tries = 0;
+again:
+  next = first = 0;
+  for(p = ptable.list; p; p = p->next){
+    if(p->pgdir == 0 || p->swapping)
+      continue;
+    if(p == proc){
+      if(!self)
+        continue;
+    } else if(!p->swappable || (p->state != RUNNABLE && p->state != SLEEPING))
+      continue;
+    if(p->pid > lastpid && (next == 0 || p->pid < next->pid))
+      next = p;
+    if(first == 0 || p->pid < first->pid)
+      first = p;
+  }
+  if(next == 0)
+    next = first;
+  if(next){
+    lastpid = next->pid;
+    if(next != proc){
+      // A RUNNABLE process may have been scheduled since
+      // we looked; only its queue lock keeps it still.
+      rq = lockrq(next);
+      if(next->state == RUNNING){
+        release(&rq->lock);
+        if(++tries < NPROC)
+          goto again;
+        next = 0;
+      } else {
+        next->swapping = 1;
+        release(&rq->lock);
+      }
+    }
+  }
+  release(&ptable.lock);
+  return next;
+}
+
+// Let a process chosen by pickvictim() run again.
+void
+dropvictim(struct proc *p)
+{
+  acquire(&ptable.lock);
+  p->swapping = 0;
+  release(&ptable.lock);
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
@@ -188,27 +978,31 @@ exit(void)
     }
   }
 
+  syncvmas(proc->pgdir, proc->vma, 0, USERTOP);
   begin_op();
   iput(proc->cwd);
+  freevmas(proc->vma);
   end_op();
   proc->cwd = 0;
 
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(proc->parent);
+  wakeup(proc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.list; p; p = p->next){
     if(p->parent == proc){
       p->parent = initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup(initproc);
     }
   }
 
   // Jump into the scheduler, never to return.
+  lockrq(proc);
   proc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
@@ -225,21 +1019,18 @@ wait(void)
   for(;;){
     // Scan through table looking for zombie children.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    for(p = ptable.list; p; p = p->next){
       if(p->parent != proc)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
-        // Found one.
+        // Found one.  Once its CPU's queue lock is free,
+        // that CPU has switched away from it for good.
+        release(&lockrq(p)->lock);
         pid = p->pid;
         kfree(p->kstack);
-        p->kstack = 0;
         freevm(p->pgdir);
-        p->state = UNUSED;
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
+        freeproc(p);
         release(&ptable.lock);
         return pid;
       }
@@ -251,7 +1042,7 @@ wait(void)
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in proc_exit.)
     sleep(proc, &ptable.lock);  //DOC: wait-sleep
   }
 }
@@ -260,57 +1051,98 @@ wait(void)
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
-//  - choose a process to run
+//  - choose a process to run from this CPU's queue,
+//    or steal one from another CPU's
 //  - swtch to start running that process
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
 void
 scheduler(void)
 {
-  struct proc *p = 0;
+  struct runq *rq;
+  struct proc *p;
+  uint wait;
+  int ran = 0, halt;
 
+  rq = &runq[cpu->id];
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // no runnable processes? (did we hit the end of the table last time?)
-    // if so, wait for irq before trying again.
-    if (p == &ptable.proc[NPROC])
-      hlt();
+    // no runnable processes last time around?
+    // if so, zero a page for kalloc_zeroed(), or if there is
+    // nothing left to zero, wait for irq before trying again.
+    if(!ran && !kzerofill()){
+      // With interrupts off until hlt, a notify() sent once
+      // idle is set can't be taken too early and missed; one
+      // that found idle clear queued before we looked at n.
+      cli();
+      acquire(&rq->lock);
+      rq->idle = 1;
+      settimer(rq);
+      halt = rq->n == 0;
+      release(&rq->lock);
+      if(halt && !stealable())
+        stihlt();
+      rq->idle = 0;
+    }
+    ran = 0;
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
+    acquire(&rq->lock);
+    for(;;){
+      if((p = dequeue(rq, 0)) == 0){
+        // steal() may drop rq->lock, and then nothing keeps
+        // wait() from freeing the page table we are on.
+        if(cpu->uvm){
+          switchkvm();
+          cpu->uvm = 0;
+        }
+        if(steal(rq))
+          continue;
+        break;
+      }
+      ran = 1;
+      wait = (rdtsc() - p->rqtsc) >> 10;
+      rq->lat[p->prio].n++;
+      rq->lat[p->prio].wait += wait;
+      if(wait > rq->lat[p->prio].max)
+        rq->lat[p->prio].max = wait;
 
       // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
+      // to release rq->lock and then reacquire it
       // before jumping back to us.
       proc = p;
       switchuvm(p);
       p->state = RUNNING;
+      p->runtsc = rdtsc();
+      rq->nswitch++;
+      settimer(rq);
       swtch(&cpu->scheduler, proc->context);
-      switchkvm();
 
       // Process is done running for now.
       // It should have changed its p->state before coming back.
+      // Stay on its page table until we pick another process:
+      // switchuvm() can skip reloading %cr3 if it is p again,
+      // and holding rq->lock (until steal() drops it, above)
+      // keeps wait() from freeing it and other CPUs from
+      // stealing it.
       proc = 0;
+      putback(rq, p);
     }
-    release(&ptable.lock);
+    release(&rq->lock);
 
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
-// and have changed proc->state.
+// Enter scheduler.  Must hold only the current CPU's
+// queue lock and have changed proc->state.
 void
 sched(void)
 {
   int intena;
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&runq[cpu->id].lock))
+    panic("sched runq lock");
   if(cpu->ncli != 1)
     panic("sched locks");
   if(proc->state == RUNNING)
@@ -322,14 +1154,78 @@ sched(void)
   cpu->intena = intena;
 }
 
+// Charge a clock tick to the current process, which the
+// timer interrupt found running on this CPU.  Returns 1 if it
+// should yield to a queued process.
+int
+schedtick(void)
+{
+  struct runq *rq;
+  int r;
+
+  rq = &runq[cpu->id];
+  acquire(&rq->lock);
+  rq->ticks++;
+  if((r = preempt(rq)) == 0)
+    settimer(rq);   // stop ticking if alone, or re-arm
+  release(&rq->lock);
+  return r;
+}
+
+// Handle a T_RESCHED interrupt from notify(): a process has
+// been queued here, or there is one to steal.  Waking from
+// hlt() is enough for an idle CPU; one that is running a
+// process needs its timer back so that they take turns.
+void
+schedkick(void)
+{
+  struct runq *rq;
+
+  rq = &runq[cpu->id];
+  acquire(&rq->lock);
+  if(rq->tickless && !rq->idle)
+    settimer(rq);
+  release(&rq->lock);
+}
+
+// Set the nice value of process pid, clamped to
+// [NICEMIN, NICEMAX].
+// Returns 0, or -1 if there is no such process.
+int
+setpriority(int pid, int nice)
+{
+  struct proc *p;
+  struct runq *rq;
+
+  if(nice < NICEMIN)
+    nice = NICEMIN;
+  if(nice > NICEMAX)
+    nice = NICEMAX;
+  acquire(&ptable.lock);
+  for(p = ptable.list; p; p = p->next){
+    if(p->pid == pid && p->state != ZOMBIE){
+      rq = lockrq(p);
+      renice(rq, p, nice);
+      release(&rq->lock);
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
 // Give up the CPU for one scheduling round.
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  proc->state = RUNNABLE;
+  struct runq *rq;
+
+  rq = &runq[cpu->id];
+  acquire(&rq->lock);  //DOC: yieldlock
+  proc->state = RUNNABLE;   // scheduler() queues it
   sched();
-  release(&ptable.lock);
+  release(&runq[cpu->id].lock);   // may be another CPU now
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -338,8 +1234,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding the queue lock from scheduler.
+  release(&runq[cpu->id].lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -357,58 +1253,86 @@ forkret(void)
 void
 sleep(void *chan, struct spinlock *lk)
 {
+  struct waitq *wq;
+
   if(proc == 0)
     panic("sleep");
 
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
-  // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
-  // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
+  // Must acquire chan's wait queue lock in order to
+  // get on the queue and change p->state.
+  // Once we hold it, we can be guaranteed that
+  // we won't miss any wakeup (wakeup runs with
+  // it locked), so it's okay to release lk.
+  wq = chanwq(chan);
+  if(lk != &wq->lock){  //DOC: sleeplock0
+    acquire(&wq->lock);  //DOC: sleeplock1
     release(lk);
   }
 
-  // Go to sleep.
+  // Go to sleep.  Holding the run queue lock across sched()
+  // keeps a wakeup from queueing us to run before we are
+  // off this CPU's stack.
   proc->chan = chan;
+  proc->wqnext = 0;
+  proc->wqprev = wq->tail;
+  if(wq->tail)
+    wq->tail->wqnext = proc;
+  else
+    wq->head = proc;
+  wq->tail = proc;
+  lockrq(proc);
   proc->state = SLEEPING;
+  release(&wq->lock);
   sched();
+  release(&runq[cpu->id].lock);
 
   // Tidy up.
   proc->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  acquire(lk);  //DOC: sleeplock2
 }
 
-//PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
+// Wake up processes sleeping on chan: all of them, or if
+// one is set, only the one that has slept longest.
 static void
-wakeup1(void *chan)
+wakeup1(void *chan, int one)
 {
-  struct proc *p;
+  struct waitq *wq;
+  struct proc *p, *next;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  wq = chanwq(chan);
+  acquire(&wq->lock);
+  for(p = wq->head; p; p = next){
+    next = p->wqnext;
+    if(p->chan != chan)
+      continue;
+    unlinkwait(wq, p);
+    setrunnable(p);
+    if(one)
+      break;
+  }
+  release(&wq->lock);
 }
 
 // Wake up all processes sleeping on chan.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  wakeup1(chan, 0);
+}
+
+// Wake up one process sleeping on chan.  For resources only
+// one process can use at a time, where waking them all would
+// just send the rest back to sleep.  The process woken must
+// pass the wakeup on if it leaves some of the resource.
+void
+wakeupone(void *chan)
+{
+  wakeup1(chan, 1);
 }
 
 // Kill the process with the given pid.
@@ -418,14 +1342,23 @@ int
 kill(int pid)
 {
   struct proc *p;
+  struct waitq *wq;
+  void *chan;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.list; p; p = p->next){
     if(p->pid == pid){
       p->killed = 1;
       // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+      if((chan = p->chan) != 0){
+        wq = chanwq(chan);
+        acquire(&wq->lock);
+        if(p->state == SLEEPING && p->chan == chan){
+          unlinkwait(wq, p);
+          setrunnable(p);
+        }
+        release(&wq->lock);
+      }
       release(&ptable.lock);
       return 0;
     }
@@ -454,14 +1387,16 @@ procdump(void)
   char *state;
   uintp pc[10];
   
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.list; p; p = p->next){
     if(p->state == UNUSED)
       continue;
     if(p->state && p->state < NELEM(states) && states[p->state])
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s (%d huge, %d small, %d huge failed, %d split)",
+            p->pid, state, p->name, p->nhuge, p->nsmall, p->nhugefail,
+            p->nhugesplit);
     if(p->state == SLEEPING){
       getstackpcs((uintp*)p->context->ebp, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -470,3 +1405,29 @@ procdump(void)
     cprintf("\n");
   }
 }
+
+// Print per-CPU scheduling counts.  For debugging; reads
+// them without locking.
+void
+rqdump(void)
+{
+  uint n, wait, max;
+  int i, j;
+
+  for(i = 0; i < ncpu; i++)
+    cprintf("cpu%d: %d queued, %d switches, %d steals, %d ticks%s\n",
+            i, runq[i].n, runq[i].nswitch, runq[i].nsteal, runq[i].ticks,
+            runq[i].tickless ? " (tickless)" : "");
+  for(j = 0; j < NPRIO; j++){
+    n = wait = max = 0;
+    for(i = 0; i < ncpu; i++){
+      n += runq[i].lat[j].n;
+      wait += runq[i].lat[j].wait;
+      if(runq[i].lat[j].max > max)
+        max = runq[i].lat[j].max;
+    }
+    if(n)
+      cprintf("prio %d: %d runs, waited %d Kcycles on average, %d at most\n",
+              j, n, wait / n, max);
+  }
+}
@@ -0,0 +1,296 @@
+// Slab allocator for small kernel objects.
+//
+// A kmem_cache hands out objects of one fixed size, carved out of
+// single pages ("slabs") obtained from kalloc().  Each slab starts
+// with a struct slab header; the free objects in a slab are chained
+// through their first word.  Slabs with at least one free object
+// sit on the cache's partial list.
+//
+// Each CPU also keeps a short stack of recently freed objects per
+// cache, so most allocations and frees only disable interrupts
+// instead of taking the cache lock.
+//
+// kmalloc() rounds a request up to one of a set of power-of-two
+// size classes, each backed by its own cache; anything bigger
+// than the largest class gets whole pages from kallocpages().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "x86.h"
+#include "proc.h"
+
+#define NKMCACHE   16   // maximum number of caches
+#define KMCPUSIZE  16   // objects cached per CPU in each cache
+#define KMMINSHIFT 4    // smallest kmalloc size class is 16 bytes
+#define KMMAXSHIFT 11   // largest kmalloc size class is 2048 bytes
+
+struct slab {
+  struct slab *next;         // partial list
+  struct slab *prev;
+  struct kmem_cache *cache;
+  void *freelist;            // free objects in this slab
+  uint inuse;                // allocated objects, including
+                             // those held by per-CPU caches
+};
+
+struct kmem_cache {
+  char *name;
+  uint size;                 // object size, rounded up
+  uint perslab;              // objects per slab
+  struct spinlock lock;
+  struct slab *partial;      // slabs with free objects
+  uint nslab;                // slabs owned by this cache
+  uint nobj;                 // objects taken out of the slabs
+  struct {
+    int n;
+    void *obj[KMCPUSIZE];
+  } cpu[NCPU];
+};
+
+static struct {
+  struct spinlock lock;
+  int ncache;
+  struct kmem_cache cache[NKMCACHE];
+  struct kmem_cache *kmalloc[KMMAXSHIFT+1];
+} slabs;
+
+static char *kmnames[KMMAXSHIFT+1] = {
+[4]  "kmalloc-16",
+[5]  "kmalloc-32",
+[6]  "kmalloc-64",
+[7]  "kmalloc-128",
+[8]  "kmalloc-256",
+[9]  "kmalloc-512",
+[10] "kmalloc-1024",
+[11] "kmalloc-2048",
+};
+
+void
+slabinit(void)
+{
+  int i;
+
+  initlock(&slabs.lock, "slabs");
+  for(i = KMMINSHIFT; i <= KMMAXSHIFT; i++)
+    slabs.kmalloc[i] = kmem_cache_create(kmnames[i], 1 << i);
+}
+
+// Create a cache of objects of the given size.
+// Panics if there is no room for another cache,
+// since caches are only created during boot.
+struct kmem_cache*
+kmem_cache_create(char *name, uint size)
+{
+  struct kmem_cache *c;
+
+  size = (size + sizeof(uintp) - 1) & ~(sizeof(uintp) - 1);
+  if(size > PGSIZE - sizeof(struct slab))
+    panic("kmem_cache_create: too big");
+
+  acquire(&slabs.lock);
+  if(slabs.ncache == NKMCACHE)
+    panic("kmem_cache_create: too many caches");
+  c = &slabs.cache[slabs.ncache++];
+  release(&slabs.lock);
+
+  memset(c, 0, sizeof(*c));
+  c->name = name;
+  c->size = size;
+  c->perslab = (PGSIZE - sizeof(struct slab)) / size;
+  initlock(&c->lock, name);
+  return c;
+}
+
+// Carve a fresh page into a slab of free objects.
+static struct slab*
+newslab(struct kmem_cache *c)
+{
+  struct slab *s;
+  char *obj;
+  int i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  s->cache = c;
+  s->inuse = 0;
+  s->freelist = 0;
+  obj = (char*)(s + 1);
+  for(i = 0; i < c->perslab; i++, obj += c->size){
+    *(void**)obj = s->freelist;
+    s->freelist = obj;
+  }
+  return s;
+}
+
+static void
+unlinkslab(struct kmem_cache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+static void
+pushslab(struct kmem_cache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(c->partial)
+    c->partial->prev = s;
+  c->partial = s;
+}
+
+// Move up to n objects from the slabs into this CPU's cache.
+// Caller has interrupts off.
+static void
+refill(struct kmem_cache *c, int n)
+{
+  struct slab *s;
+  int id;
+
+  id = cpu->id;
+  acquire(&c->lock);
+  while(n > 0){
+    if((s = c->partial) == 0){
+      // Don't hold the cache lock across kalloc().
+      release(&c->lock);
+      s = newslab(c);
+      acquire(&c->lock);
+      if(s == 0)
+        break;
+      c->nslab++;
+      pushslab(c, s);
+    }
+    while(n > 0 && s->freelist){
+      c->cpu[id].obj[c->cpu[id].n++] = s->freelist;
+      s->freelist = *(void**)s->freelist;
+      s->inuse++;
+      c->nobj++;
+      n--;
+    }
+    if(s->freelist == 0)
+      unlinkslab(c, s);
+  }
+  release(&c->lock);
+}
+
+// Return the n oldest objects in this CPU's cache to their slabs,
+// freeing any slab that becomes empty.  Caller has interrupts off.
+static void
+drain(struct kmem_cache *c, int n)
+{
+  struct slab *s;
+  void *obj;
+  int i, id;
+
+  id = cpu->id;
+  acquire(&c->lock);
+  for(i = 0; i < n; i++){
+    obj = c->cpu[id].obj[i];
+    s = (struct slab*)PGROUNDDOWN((uintp)obj);
+    if(s->freelist == 0)
+      pushslab(c, s);
+    *(void**)obj = s->freelist;
+    s->freelist = obj;
+    c->nobj--;
+    if(--s->inuse == 0 && c->partial != s){
+      // Keep one empty slab around to absorb alloc/free churn.
+      unlinkslab(c, s);
+      c->nslab--;
+      kfree((char*)s);
+    }
+  }
+  release(&c->lock);
+  c->cpu[id].n -= n;
+  memmove(c->cpu[id].obj, c->cpu[id].obj + n, c->cpu[id].n * sizeof(void*));
+}
+
+// Allocate an object from cache c.
+// Returns 0 if memory cannot be allocated.
+void*
+kmem_cache_alloc(struct kmem_cache *c)
+{
+  void *obj;
+  int id;
+
+  pushcli();
+  id = cpu->id;
+  if(c->cpu[id].n == 0)
+    refill(c, KMCPUSIZE/2);
+  obj = 0;
+  if(c->cpu[id].n > 0)
+    obj = c->cpu[id].obj[--c->cpu[id].n];
+  popcli();
+  return obj;
+}
+
+// Free an object allocated from cache c.
+void
+kmem_cache_free(struct kmem_cache *c, void *obj)
+{
+  struct slab *s;
+  int id;
+
+  s = (struct slab*)PGROUNDDOWN((uintp)obj);
+  if(s->cache != c)
+    panic("kmem_cache_free");
+  pushcli();
+  id = cpu->id;
+  if(c->cpu[id].n == KMCPUSIZE)
+    drain(c, KMCPUSIZE/2);
+  c->cpu[id].obj[c->cpu[id].n++] = obj;
+  popcli();
+}
+
+// Allocate n bytes of kernel memory.
+// Returns 0 if memory cannot be allocated.
+void*
+kmalloc(uint n)
+{
+  int shift;
+
+  for(shift = KMMINSHIFT; shift <= KMMAXSHIFT; shift++)
+    if(n <= (1 << shift))
+      return kmem_cache_alloc(slabs.kmalloc[shift]);
+  for(shift = 0; (PGSIZE << shift) < n; shift++)
+    ;
+  return kallocpages(shift);
+}
+
+// Free memory returned by kmalloc().
+void
+kmfree(void *v)
+{
+  struct slab *s;
+
+  // Slab objects are never page aligned: the header comes first.
+  if((uintp)v % PGSIZE){
+    s = (struct slab*)PGROUNDDOWN((uintp)v);
+    kmem_cache_free(s->cache, v);
+  } else
+    kfreepages(v, kpageorder(v));
+}
+
+// Print per-cache usage.  For debugging; reads the
+// per-CPU counts without locking.
+void
+slabdump(void)
+{
+  struct kmem_cache *c;
+  int i, cached;
+
+  for(c = slabs.cache; c < slabs.cache + slabs.ncache; c++){
+    cached = 0;
+    for(i = 0; i < ncpu; i++)
+      cached += c->cpu[i].n;
+    cprintf("%s: %d bytes, %d in use, %d cached, %d slabs\n",
+            c->name, c->size, c->nobj - cached, cached, c->nslab);
+  }
+}
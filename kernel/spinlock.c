@@ -88,7 +88,7 @@ getstackpcs(uintp *ebp, uintp pcs[])
   int i;
   
   for(i = 0; i < 10; i++){
-    if(ebp == 0 || ebp < (uintp*)KERNBASE || ebp == (uintp*)0xffffffff)
+    if(ebp == 0 || ebp < (uintp*)PHYSBASE || ebp == (uintp*)0xffffffff)
       break;
     pcs[i] = ebp[1];     // saved %eip
     ebp = (uintp*)ebp[0]; // saved %ebp
@@ -0,0 +1,161 @@
+// Swap space.
+//
+// When memory runs out, reclaim() (in vm.c) writes user pages
+// out to a swap area on the boot disk, past the kernel image,
+// and pagefault() reads them back in.  The area is divided
+// into page-sized slots.  A swapped-out page's PTE holds its
+// slot number in place of the physical address, with PTE_SWAP
+// set and PTE_P clear.  fork shares swapped-out pages like any
+// others, so each slot has a reference count.
+//
+// Swap I/O goes straight to the disk driver through a buffer
+// of its own, so swap traffic does not push file system blocks
+// out of the buffer cache.  The buffer is allocated statically,
+// since swapping happens when memory has run out; one page is
+// moved at a time.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "buf.h"
+
+#define NSWAP   (SWAPSIZE / (PGSIZE/BSIZE))   // slots
+
+static struct {
+  struct spinlock lock;
+  uchar ref[NSWAP];    // references to each slot; 0 if free
+  uint nused;          // slots in use
+  uint next;           // where to start looking for a free slot
+  uint nout;           // pages written out
+  uint nin;            // pages read back in
+  uint ndrop;          // clean file pages dropped instead
+  uint nfail;          // reclaim() found nothing to take
+  int busy;            // buf is in use
+  struct buf buf;      // for swapio()
+} swap;
+
+void
+swapinit(void)
+{
+  initlock(&swap.lock, "swap");
+}
+
+// Read or write the page at v from or to swap slot s.
+static void
+swapio(uint s, char *v, int write)
+{
+  struct buf *b;
+  int i;
+
+  acquire(&swap.lock);
+  while(swap.busy)
+    sleep(&swap.busy, &swap.lock);
+  swap.busy = 1;
+  release(&swap.lock);
+
+  b = &swap.buf;
+  for(i = 0; i < PGSIZE/BSIZE; i++){
+    b->dev = SWAPDEV;
+    b->blockno = SWAPSTART + s*(PGSIZE/BSIZE) + i;
+    b->flags = B_BUSY;
+    if(write){
+      memmove(b->data, v + i*BSIZE, BSIZE);
+      b->flags |= B_DIRTY;
+    }
+    iderw(b);
+    if(!write)
+      memmove(v + i*BSIZE, b->data, BSIZE);
+  }
+
+  acquire(&swap.lock);
+  swap.busy = 0;
+  wakeupone(&swap.busy);
+  release(&swap.lock);
+}
+
+// Write the page at v to a free slot.  May sleep.
+// Returns the slot, or -1 if swap is full.
+int
+swapout(char *v)
+{
+  uint i, s;
+
+  acquire(&swap.lock);
+  for(i = 0; i < NSWAP; i++){
+    s = (swap.next + i) % NSWAP;
+    if(swap.ref[s] == 0)
+      break;
+  }
+  if(i == NSWAP){
+    release(&swap.lock);
+    return -1;
+  }
+  swap.ref[s] = 1;
+  swap.nused++;
+  swap.next = s + 1;
+  swap.nout++;
+  release(&swap.lock);
+
+  swapio(s, v, 1);
+  return s;
+}
+
+// Read slot s into the page at v, and drop the caller's
+// reference to the slot.  May sleep.
+void
+swapin(uint s, char *v)
+{
+  swapio(s, v, 0);
+  acquire(&swap.lock);
+  swap.nin++;
+  release(&swap.lock);
+  swapfree(s);
+}
+
+// Add a reference to slot s.
+void
+swapdup(uint s)
+{
+  acquire(&swap.lock);
+  if(s >= NSWAP || swap.ref[s] == 0 || swap.ref[s] == 255)
+    panic("swapdup");
+  swap.ref[s]++;
+  release(&swap.lock);
+}
+
+// Drop a reference to slot s.
+void
+swapfree(uint s)
+{
+  acquire(&swap.lock);
+  if(s >= NSWAP || swap.ref[s] == 0)
+    panic("swapfree");
+  if(--swap.ref[s] == 0)
+    swap.nused--;
+  release(&swap.lock);
+}
+
+// Count a clean file page dropped instead of swapped out,
+// and a reclaim() that came back empty-handed.
+void
+swapcount(int dropped, int failed)
+{
+  acquire(&swap.lock);
+  swap.ndrop += dropped;
+  swap.nfail += failed;
+  release(&swap.lock);
+}
+
+// Print swap usage and traffic.  For debugging.
+void
+swapdump(void)
+{
+  acquire(&swap.lock);
+  cprintf("swap: %d/%d slots used, %d pages out, %d in, %d dropped, "
+          "%d reclaim failures\n",
+          swap.nused, NSWAP, swap.nout, swap.nin, swap.ndrop, swap.nfail);
+  release(&swap.lock);
+}
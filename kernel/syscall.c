@@ -17,7 +17,7 @@
 int
 fetchint(uintp addr, int *ip)
 {
-  if(addr >= proc->sz || addr+sizeof(int) > proc->sz)
+  if(!uvmcheck(addr, sizeof(int)))
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -26,7 +26,7 @@ fetchint(uintp addr, int *ip)
 int
 fetchuintp(uintp addr, uintp *ip)
 {
-  if(addr >= proc->sz || addr+sizeof(uintp) > proc->sz)
+  if(!uvmcheck(addr, sizeof(uintp)))
     return -1;
   *ip = *(uintp*)(addr);
   return 0;
@@ -35,15 +35,16 @@ fetchuintp(uintp addr, uintp *ip)
 // Fetch the nul-terminated string at addr from the current process.
 // Doesn't actually copy the string - just sets *pp to point at it.
 // Returns length of string, not including nul.
+// The string must lie in memory no other process can write
+// (see uvmend), so it can't change after this check.
 int
 fetchstr(uintp addr, char **pp)
 {
   char *s, *ep;
 
-  if(addr >= proc->sz)
+  if((ep = (char*)uvmend(addr, 0)) == 0)
     return -1;
   *pp = (char*)addr;
-  ep = (char*)proc->sz;
   for(s = *pp; s < ep; s++)
     if(*s == 0)
       return s - *pp;
@@ -106,7 +107,7 @@ argptr(int n, char **pp, int size)
 
   if(arguintp(n, &i) < 0)
     return -1;
-  if(i >= proc->sz || i+size > proc->sz)
+  if(!uvmcheck(i, size))
     return -1;
   *pp = (char*)i;
   return 0;
@@ -114,8 +115,6 @@ argptr(int n, char **pp, int size)
 
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
-// (There is no shared writable memory, so the string can't change
-// between this check and being used by the kernel.)
 int
 argstr(int n, char **pp)
 {
@@ -125,30 +124,36 @@ argstr(int n, char **pp)
   return fetchstr(addr, pp);
 }
 
-extern int sys_chdir(void);
-extern int sys_close(void);
-extern int sys_dup(void);
-extern int sys_exec(void);
-extern int sys_exit(void);
-extern int sys_fork(void);
-extern int sys_fstat(void);
-extern int sys_getpid(void);
-extern int sys_kill(void);
-extern int sys_link(void);
-extern int sys_mkdir(void);
-extern int sys_mknod(void);
-extern int sys_open(void);
-extern int sys_pipe(void);
-extern int sys_read(void);
-extern int sys_sbrk(void);
-extern int sys_sleep(void);
-extern int sys_unlink(void);
-extern int sys_wait(void);
-extern int sys_write(void);
-extern int sys_uptime(void);
-extern int sys_chmod(void);
-
-static int (*syscalls[])(void) = {
+extern intp sys_chdir(void);
+extern intp sys_close(void);
+extern intp sys_dup(void);
+extern intp sys_exec(void);
+extern intp sys_exit(void);
+extern intp sys_fork(void);
+extern intp sys_fstat(void);
+extern intp sys_getpid(void);
+extern intp sys_kill(void);
+extern intp sys_link(void);
+extern intp sys_mkdir(void);
+extern intp sys_mknod(void);
+extern intp sys_open(void);
+extern intp sys_pipe(void);
+extern intp sys_read(void);
+extern intp sys_sbrk(void);
+extern intp sys_sleep(void);
+extern intp sys_unlink(void);
+extern intp sys_wait(void);
+extern intp sys_write(void);
+extern intp sys_uptime(void);
+extern intp sys_chmod(void);
+extern intp sys_mmap(void);
+extern intp sys_munmap(void);
+extern intp sys_msync(void);
+extern intp sys_spawn(void);
+extern intp sys_setpriority(void);
+extern intp sys_nice(void);
+
+static intp (*syscalls[])(void) = {
 [SYS_fork]    = sys_fork,
 [SYS_exit]    = sys_exit,
 [SYS_wait]    = sys_wait,
@@ -171,6 +176,12 @@ static int (*syscalls[])(void) = {
 [SYS_mkdir]   = sys_mkdir,
 [SYS_close]   = sys_close,
 [SYS_chmod]   = sys_chmod,
+[SYS_mmap]    = sys_mmap,
+[SYS_munmap]  = sys_munmap,
+[SYS_msync]   = sys_msync,
+[SYS_spawn]   = sys_spawn,
+[SYS_setpriority] = sys_setpriority,
+[SYS_nice]    = sys_nice,
 };
 
 void
@@ -13,6 +13,7 @@
 #include "fs.h"
 #include "file.h"
 #include "fcntl.h"
+#include "mman.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -49,7 +50,7 @@ fdalloc(struct file *f)
   return -1;
 }
 
-int
+intp
 sys_dup(void)
 {
   struct file *f;
@@ -63,7 +64,7 @@ sys_dup(void)
   return fd;
 }
 
-int
+intp
 sys_read(void)
 {
   struct file *f;
@@ -72,10 +73,12 @@ sys_read(void)
 
   if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
     return -1;
+  if(touchuvm((uintp)p, n, 1) < 0)
+    return -1;
   return fileread(f, p, n);
 }
 
-int
+intp
 sys_write(void)
 {
   struct file *f;
@@ -84,10 +87,12 @@ sys_write(void)
 
   if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
     return -1;
+  if(touchuvm((uintp)p, n, 0) < 0)
+    return -1;
   return filewrite(f, p, n);
 }
 
-int
+intp
 sys_close(void)
 {
   int fd;
@@ -100,7 +105,7 @@ sys_close(void)
   return 0;
 }
 
-int
+intp
 sys_fstat(void)
 {
   struct file *f;
@@ -108,11 +113,13 @@ sys_fstat(void)
   
   if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
     return -1;
+  if(touchuvm((uintp)st, sizeof(*st), 1) < 0)
+    return -1;
   return filestat(f, st);
 }
 
 // Create the path new as a link to the same inode as old.
-int
+intp
 sys_link(void)
 {
   char name[DIRSIZ], *new, *old;
@@ -178,7 +185,7 @@ isdirempty(struct inode *dp)
 }
 
 //PAGEBREAK!
-int
+intp
 sys_unlink(void)
 {
   struct inode *ip, *dp;
@@ -280,7 +287,7 @@ create(char *path, short type, short major, short minor)
   return ip;
 }
 
-int
+intp
 sys_open(void)
 {
   char *path;
@@ -330,7 +337,7 @@ sys_open(void)
   return fd;
 }
 
-int
+intp
 sys_mkdir(void)
 {
   char *path;
@@ -346,7 +353,7 @@ sys_mkdir(void)
   return 0;
 }
 
-int
+intp
 sys_mknod(void)
 {
   struct inode *ip;
@@ -367,7 +374,7 @@ sys_mknod(void)
   return 0;
 }
 
-int
+intp
 sys_chdir(void)
 {
   char *path;
@@ -391,19 +398,19 @@ sys_chdir(void)
   return 0;
 }
 
-int
-sys_exec(void)
+// Fetch the nth word-sized system call argument as a
+// null-terminated array of at most MAXARG-1 strings.
+static int
+argargv(int n, char **argv)
 {
-  char *path, *argv[MAXARG];
   int i;
   uintp uargv, uarg;
 
-  if(argstr(0, &path) < 0 || arguintp(1, &uargv) < 0){
+  if(arguintp(n, &uargv) < 0)
     return -1;
-  }
-  memset(argv, 0, sizeof(argv));
+  memset(argv, 0, MAXARG * sizeof(char*));
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
     if(fetchuintp(uargv+sizeof(uintp)*i, &uarg) < 0)
       return -1;
@@ -414,10 +421,39 @@ sys_exec(void)
     if(fetchstr(uarg, &argv[i]) < 0)
       return -1;
   }
+  return 0;
+}
+
+intp
+sys_exec(void)
+{
+  char *path, *argv[MAXARG];
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0){
+    return -1;
+  }
   return exec(path, argv);
 }
 
-int
+intp
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG];
+  int *ufds, fds[NSPAWNFD];
+  uintp a;
+
+  if(argstr(0, &path) < 0 || argargv(1, argv) < 0 || arguintp(2, &a) < 0)
+    return -1;
+  if(a == 0)
+    return spawn(path, argv, 0);
+  // Copy the descriptors in, so they can't change under spawn().
+  if(argptr(2, (void*)&ufds, sizeof(fds)) < 0)
+    return -1;
+  memmove(fds, ufds, sizeof(fds));
+  return spawn(path, argv, fds);
+}
+
+intp
 sys_pipe(void)
 {
   int *fd;
@@ -426,6 +462,8 @@ sys_pipe(void)
 
   if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
     return -1;
+  if(touchuvm((uintp)fd, 2*sizeof(fd[0]), 1) < 0)
+    return -1;
   if(pipealloc(&rf, &wf) < 0)
     return -1;
   fd0 = -1;
@@ -441,7 +479,7 @@ sys_pipe(void)
   return 0;
 }
 
-int
+intp
 sys_chmod(void)
 {
     char *path;
@@ -461,3 +499,66 @@ sys_chmod(void)
     end_op();
     return 0;
 }
+
+intp
+sys_mmap(void)
+{
+  uintp len, addr;
+  int prot, flags, fd, off;
+  uint filesz;
+  struct file *f;
+
+  // The address hint (argument 0) is ignored.
+  if(arguintp(1, &len) < 0 || argint(2, &prot) < 0 || argint(3, &flags) < 0 ||
+     argint(4, &fd) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE) || (flags & MAP_GROWSDOWN))
+    return -1;
+  prot = (prot & PROT_WRITE) ? PTE_W : 0;
+  if(flags & MAP_ANONYMOUS)
+    return mmapuvm(len, prot, flags & ~MAP_ANONYMOUS, 0, 0, 0);
+
+  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+    return -1;
+  if(f->type != FD_INODE || !f->readable || off < 0 || off % PGSIZE)
+    return -1;
+  if((flags & MAP_SHARED) && prot && !f->writable)
+    return -1;
+  ilock(f->ip);
+  if(f->ip->type != T_FILE){
+    iunlock(f->ip);
+    return -1;
+  }
+  filesz = 0;
+  if(off < f->ip->size)
+    filesz = f->ip->size - off < len ? f->ip->size - off : len;
+  iunlock(f->ip);
+  addr = mmapuvm(len, prot, flags, f->ip, off, filesz);
+  return addr;
+}
+
+intp
+sys_munmap(void)
+{
+  uintp addr, len;
+
+  if(arguintp(0, &addr) < 0 || arguintp(1, &len) < 0)
+    return -1;
+  return munmapuvm(addr, len);
+}
+
+intp
+sys_msync(void)
+{
+  uintp addr, len;
+  int r;
+
+  if(arguintp(0, &addr) < 0 || arguintp(1, &len) < 0)
+    return -1;
+  if(addr % PGSIZE || addr + len < addr)
+    return -1;
+  r = syncvmas(proc->pgdir, proc->vma, addr, addr + len);
+  // So later writes set the dirty bits again.
+  tlbshootdown(proc, addr, addr + len);
+  return r;
+}
@@ -7,26 +7,33 @@
 #include "mmu.h"
 #include "proc.h"
 
-int
+intp
 sys_fork(void)
 {
   return fork();
 }
 
-int
+intp
 sys_exit(void)
 {
   exit();
   return 0;  // not reached
 }
 
-int
+intp
 sys_wait(void)
 {
-  return wait();
+  int pid;
+
+  // Nothing here touches user memory, so reclaim()
+  // may take pages while we wait.
+  proc->swappable = 1;
+  pid = wait();
+  proc->swappable = 0;
+  return pid;
 }
 
-int
+intp
 sys_kill(void)
 {
   int pid;
@@ -36,7 +43,7 @@ sys_kill(void)
   return kill(pid);
 }
 
-int
+intp
 sys_getpid(void)
 {
   return proc->pid;
@@ -56,7 +63,7 @@ sys_sbrk(void)
   return addr;
 }
 
-int
+intp
 sys_sleep(void)
 {
   int n;
@@ -65,27 +72,58 @@ sys_sleep(void)
   if(argint(0, &n) < 0)
     return -1;
   acquire(&tickslock);
+  clockupdate();
   ticks0 = ticks;
+  proc->swappable = 1;   // as in sys_wait
   while(ticks - ticks0 < n){
     if(proc->killed){
+      proc->swappable = 0;
       release(&tickslock);
       return -1;
     }
+    clockalarm(ticks0 + n);
     sleep(&ticks, &tickslock);
   }
+  proc->swappable = 0;
   release(&tickslock);
   return 0;
 }
 
-// return how many clock tick interrupts have occurred
+// return how many clock ticks have passed
 // since start.
-int
+intp
 sys_uptime(void)
 {
   uint xticks;
   
   acquire(&tickslock);
+  clockupdate();
   xticks = ticks;
   release(&tickslock);
   return xticks;
 }
+
+// Set the nice value of a process.
+intp
+sys_setpriority(void)
+{
+  int pid, nice;
+
+  if(argint(0, &pid) < 0 || argint(1, &nice) < 0)
+    return -1;
+  return setpriority(pid, nice);
+}
+
+// Add to the current process's nice value.
+// Returns the new value.
+intp
+sys_nice(void)
+{
+  int incr;
+
+  if(argint(0, &incr) < 0)
+    return -1;
+  if(setpriority(proc->pid, proc->nice + incr) < 0)
+    return -1;
+  return proc->nice;
+}
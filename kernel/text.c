@@ -0,0 +1,162 @@
+// Text cache.
+//
+// Processes running the same program share the pages of its
+// read-only segments instead of each reading in a copy.  When
+// filefill() (in vm.c) reads a page of a read-only private
+// mapping, it lists the page here under the file's (dev, inum,
+// gen) and the file offset; the next process to fault on the
+// same page of the same version of the file maps the listed
+// page read-only and takes a reference to it.
+//
+// The cache does not hold a reference of its own, so a page
+// lives only as long as some process maps it.  kfree() calls
+// textdrop() when the last reference to a listed page goes
+// away, and a lookup that races with that gets a miss.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NTEXTHASH 64
+
+struct textpage {
+  uint dev;                // key: which version of which file,
+  uint inum;
+  uint gen;
+  uint off;                // where in it,
+  uint n;                  // and how many bytes (the rest is zero)
+  char *page;
+  struct textpage *next;   // key hash chain
+  struct textpage *pnext;  // page hash chain
+};
+
+static struct {
+  struct spinlock lock;
+  struct kmem_cache *cache;
+  struct textpage *key[NTEXTHASH];
+  struct textpage *page[NTEXTHASH];
+  uint n;                  // pages listed
+  uint hit;
+  uint miss;
+} text;
+
+static uint
+keyhash(uint inum, uint gen, uint off)
+{
+  return (inum * 31 + gen * 7 + off / PGSIZE) % NTEXTHASH;
+}
+
+static uint
+pagehash(char *page)
+{
+  return ((uintp)page / PGSIZE) % NTEXTHASH;
+}
+
+void
+textinit(void)
+{
+  initlock(&text.lock, "text");
+  text.cache = kmem_cache_create("textpage", sizeof(struct textpage));
+}
+
+static struct textpage*
+lookup(struct inode *ip, uint off, uint n)
+{
+  struct textpage *t;
+
+  for(t = text.key[keyhash(ip->inum, ip->gen, off)]; t; t = t->next)
+    if(t->dev == ip->dev && t->inum == ip->inum && t->gen == ip->gen &&
+       t->off == off && t->n == n)
+      return t;
+  return 0;
+}
+
+// Look up the page holding n bytes of locked inode ip at off.
+// Returns it with a reference added for the caller, or 0.
+char*
+textget(struct inode *ip, uint off, uint n)
+{
+  struct textpage *t;
+  char *page;
+
+  page = 0;
+  acquire(&text.lock);
+  if((t = lookup(ip, off, n)) != 0 && ktryref(t->page))
+    page = t->page;
+  if(page)
+    text.hit++;
+  else
+    text.miss++;
+  release(&text.lock);
+  return page;
+}
+
+// List page, just read from n bytes of locked inode ip at off.
+// If there is no memory for the entry, or another entry for
+// the same contents is still on its way out, just don't.
+void
+textadd(struct inode *ip, uint off, uint n, char *page)
+{
+  struct textpage *t;
+  uint h;
+
+  if((t = kmem_cache_alloc(text.cache)) == 0)
+    return;
+  acquire(&text.lock);
+  if(lookup(ip, off, n)){
+    release(&text.lock);
+    kmem_cache_free(text.cache, t);
+    return;
+  }
+  t->dev = ip->dev;
+  t->inum = ip->inum;
+  t->gen = ip->gen;
+  t->off = off;
+  t->n = n;
+  t->page = page;
+  h = keyhash(ip->inum, ip->gen, off);
+  t->next = text.key[h];
+  text.key[h] = t;
+  h = pagehash(page);
+  t->pnext = text.page[h];
+  text.page[h] = t;
+  text.n++;
+  ksettext(page);
+  release(&text.lock);
+}
+
+// The last reference to listed page has gone; forget it.
+// Called by kfree().
+void
+textdrop(char *page)
+{
+  struct textpage *t, **pp;
+
+  acquire(&text.lock);
+  for(pp = &text.page[pagehash(page)]; (t = *pp) != 0; pp = &t->pnext)
+    if(t->page == page)
+      break;
+  if(t == 0)
+    panic("textdrop");
+  *pp = t->pnext;
+  for(pp = &text.key[keyhash(t->inum, t->gen, t->off)]; *pp != t; pp = &(*pp)->next)
+    ;
+  *pp = t->next;
+  text.n--;
+  release(&text.lock);
+  kmem_cache_free(text.cache, t);
+}
+
+// Print text cache usage.  For debugging.
+void
+textdump(void)
+{
+  acquire(&text.lock);
+  cprintf("text: %d pages shared, %d hits, %d misses\n",
+          text.n, text.hit, text.miss);
+  release(&text.lock);
+}
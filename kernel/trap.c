@@ -11,8 +11,22 @@
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uintp vectors[];  // in vectors.S: array of 256 entry pointers
+
+// Time.  ticks counts clock ticks since boot.  At first CPU 0
+// counts its timer interrupts, and times the TSC against the
+// first CALTICKS of them.  From then on ticks is brought up to
+// date from the TSC, by any CPU's timer interrupt and by those
+// who read it, so that a CPU may stop its timer while it has
+// nothing to switch between (see settimer() in proc.c), as long
+// as it asks for an interrupt by the next tick that a sleeping
+// process waits for.
+#define CALTICKS 10
+
 struct spinlock tickslock;
 uint ticks;
+static uint nextwake;       // next tick a sleeper waits for
+static uint64 ticktsc;      // TSC when tick number ticks began
+static uint tscpertick;     // 0 until timed
 
 #ifndef X64
 void
@@ -34,6 +48,95 @@ idtinit(void)
 }
 #endif
 
+// Wake the sleepers on ticks if the next one is due.
+// Caller holds tickslock.
+static void
+tickwake(void)
+{
+  if((int)(ticks - nextwake) >= 0){
+    nextwake = ticks + TICKLESSMAX;
+    wakeup(&ticks);
+  }
+}
+
+// Count a timer interrupt on CPU 0 while the TSC is being
+// timed.  Caller holds tickslock.
+static void
+clockcount(void)
+{
+  uint64 tsc;
+
+  tsc = rdtsc();
+  ticks++;
+  if(ticks == 1)
+    ticktsc = tsc;
+  else if(ticks == 1 + CALTICKS){
+    tscpertick = (tsc - ticktsc) / CALTICKS;
+    ticktsc = tsc;
+  }
+  tickwake();
+}
+
+// Bring ticks up to date.  Caller holds tickslock.
+void
+clockupdate(void)
+{
+  int64 d;
+  uint n;
+
+  if(tscpertick == 0)
+    return;
+  // CPUs' TSCs are only roughly in step: this one may be a
+  // little behind the one that last moved ticktsc.
+  if((d = rdtsc() - ticktsc) < 0)
+    return;
+  n = d / tscpertick;
+  if(n == 0)
+    return;
+  // clockidle() reads these without the lock, ticktsc first.
+  ticks += n;
+  __sync_synchronize();
+  ticktsc += (uint64)n * tscpertick;
+  tickwake();
+}
+
+// Ask for the sleepers on ticks to be woken by tick t.
+// Caller holds tickslock.
+void
+clockalarm(uint t)
+{
+  if((int)(t - nextwake) < 0)
+    nextwake = t;
+}
+
+// Return how many ticks this CPU's timer may stay stopped:
+// until the next tick a sleeper waits for, and no more than
+// TICKLESSMAX.  Returns 0 if the timer must keep ticking.
+// Reads the clock without tickslock, since callers hold a run
+// queue lock; a sleeper's CPU sees the sleeper's own alarm,
+// and a read that races with clockupdate() only comes out
+// short.
+uint
+clockidle(void)
+{
+  uint64 tsc;
+  int64 d;
+  int n;
+
+  if(tscpertick == 0)
+    return 0;
+  tsc = ticktsc;
+  __sync_synchronize();
+  if((d = rdtsc() - tsc) < 0)
+    d = 0;   // TSC behind, as in clockupdate()
+  n = nextwake - ticks - (uint)(d / tscpertick);
+  if(n < 1)
+    n = 1;
+  if(n > TICKLESSMAX)
+    n = TICKLESSMAX;
+  return n;
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
@@ -50,12 +153,12 @@ trap(struct trapframe *tf)
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpu->id == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
-    }
+    acquire(&tickslock);
+    if(tscpertick)
+      clockupdate();
+    else if(cpu->id == 0)
+      clockcount();
+    release(&tickslock);
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -70,12 +173,26 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_TLBFLUSH:
+    tlbintr();
+    lapiceoi();
+    break;
+  case T_RESCHED:
+    schedkick();
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
             cpu->id, tf->cs, tf->eip);
     lapiceoi();
     break;
+
+  case T_PGFLT:
+    // Copy-on-write and other faults the VM system can fix.
+    if(pagefault(rcr2(), tf->err) == 0)
+      break;
+    // fall through
    
   //PAGEBREAK: 13
   default:
@@ -99,10 +216,18 @@ trap(struct trapframe *tf)
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU on clock tick, once its
+  // time slice is up (see schedtick).
   // If interrupts were on while locks held, would need to check nlock.
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+     schedtick()){
+    // Preempted in user space, the process is not in the
+    // middle of using its page table: reclaim() may take its
+    // pages while it waits to run again.
+    proc->swappable = (tf->cs&3) == DPL_USER;
     yield();
+    proc->swappable = 0;
+  }
 
   // Check if the process has been killed since we yielded
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
@@ -4,8 +4,11 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "traps.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
+#include "mman.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
@@ -41,6 +44,114 @@ seginit(void)
 }
 #endif
 
+// The first address past the aligned block of 2^shift bytes
+// that contains va.
+#define NEXTBLOCK(va, shift) (((uintp)(va) | (((uintp)1 << (shift)) - 1)) + 1)
+
+// Page-table page statistics, for /kstat.
+static struct {
+  uint alloc;          // page-table pages allocated
+  uint forks;          // page tables copied by copyuvm()
+  uint forktables;     // ... and the page-table pages they needed
+} pgt;
+
+// Allocate an empty page-table page.  freevm() hands emptied
+// ones back to the zeroed pool, so this is usually cheap.
+pde_t*
+pgtalloc(void)
+{
+  pde_t *t;
+
+  if((t = (pde_t*)kalloc_zeroed()) != 0)
+    __sync_add_and_fetch(&pgt.alloc, 1);
+  return t;
+}
+
+#if X64
+// Return the address of the entry in table t for va at the
+// level whose index starts at bit shift, after following it
+// down to the next level's table.  If alloc!=0, create that
+// table if it is missing.
+static pde_t*
+nextlevel(pde_t *t, const void *va, int shift, int alloc)
+{
+  pde_t *pde, *next;
+
+  pde = &t[((uintp)va >> shift) & PXMASK];
+  if(!(*pde & PTE_P)){
+    if(!alloc || (next = pgtalloc()) == 0)
+      return 0;
+    *pde = v2p(next) | PTE_P | PTE_W | PTE_U;
+  }
+  return (pde_t*)p2v(PTE_ADDR(*pde));
+}
+#endif
+
+// Return the address of the page directory entry in pgdir
+// for virtual address va: the one that points at va's page
+// table, or maps a huge page.  On x86-64 pgdir is the PML4,
+// and the PDPT and page directory in between are created
+// if alloc!=0.
+static pde_t*
+walkpde(pde_t *pgdir, const void *va, int alloc)
+{
+#if X64
+  pde_t *pdpt, *pd;
+
+  if((pdpt = nextlevel(pgdir, va, PML4XSHIFT, alloc)) == 0)
+    return 0;
+  if((pd = nextlevel(pdpt, va, PDPTXSHIFT, alloc)) == 0)
+    return 0;
+  return &pd[PDX(va)];
+#else
+  return &pgdir[PDX(va)];
+#endif
+}
+
+// Return the first address at or above the page-aligned
+// address va that might be mapped in pgdir, by skipping the
+// blocks that have no page table (or, on x86-64, no PDPT or
+// page directory either).  Used to walk sparse address spaces.
+static uintp
+skipholes(pde_t *pgdir, uintp va)
+{
+  pde_t *t;
+
+  t = pgdir;
+#if X64
+  if(!(t[PML4X(va)] & PTE_P))
+    return NEXTBLOCK(va, PML4XSHIFT);
+  t = (pde_t*)p2v(PTE_ADDR(t[PML4X(va)]));
+  if(!(t[PDPTX(va)] & PTE_P))
+    return NEXTBLOCK(va, PDPTXSHIFT);
+  t = (pde_t*)p2v(PTE_ADDR(t[PDPTX(va)]));
+#endif
+  if(!(t[PDX(va)] & PTE_P))
+    return NEXTBLOCK(va, PDXSHIFT);
+  return va;
+}
+
+// Return how many page-table pages walkpgdir(pgdir, va, 1)
+// has to create.
+static int
+missingtables(pde_t *pgdir, uintp va)
+{
+  pde_t *t;
+
+  t = pgdir;
+#if X64
+  if(!(t[PML4X(va)] & PTE_P))
+    return 3;
+  t = (pde_t*)p2v(PTE_ADDR(t[PML4X(va)]));
+  if(!(t[PDPTX(va)] & PTE_P))
+    return 2;
+  t = (pde_t*)p2v(PTE_ADDR(t[PDPTX(va)]));
+#endif
+  if(!(t[PDX(va)] & PTE_P))
+    return 1;
+  return 0;
+}
+
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
 // create any required page table pages.
@@ -50,14 +161,16 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   pde_t *pde;
   pte_t *pgtab;
 
-  pde = &pgdir[PDX(va)];
+  if((pde = walkpde(pgdir, va, alloc)) == 0)
+    return 0;
+  if(*pde & PTE_PS)
+    panic("walkpgdir: huge page");
   if(*pde & PTE_P){
     pgtab = (pte_t*)p2v(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+    // pgtalloc() makes sure all those PTE_P bits are zero.
+    if(!alloc || (pgtab = (pte_t*)pgtalloc()) == 0)
       return 0;
-    // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table 
     // entries, if necessary.
@@ -134,9 +247,15 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = pgtalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
+  if(kpgdir){
+    // The kernel half is the same in every page table:
+    // share kpgdir's page tables instead of building new ones.
+    memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+            (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
+    return pgdir;
+  }
   if (p2v(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -176,10 +295,196 @@ switchuvm(struct proc *p)
   if(p->pgdir == 0)
     panic("switchuvm: no pgdir");
   lcr3(v2p(p->pgdir));  // switch to new address space
+  cpu->uvm = p->pgdir;
+  cpu->nflush++;
   popcli();
 }
+
+// Without PCIDs, switchuvm() always flushes the TLB, so there
+// is nothing to do.
+void
+newasid(struct proc *p, int keep)
+{
+}
+
+void
+tlbdump(void)
+{
+  int i;
+
+  for(i = 0; i < ncpu; i++){
+    cprintf("cpu%d: uvm switch flush %d\n", i, cpus[i].nflush);
+    cprintf("cpu%d: shootdown ipi %d batched %d avoided %d\n",
+            i, cpus[i].ntlbsent, cpus[i].ntlbbatch, cpus[i].ntlbavoid);
+  }
+}
 #endif
 
+// p's page table changed in a way that can leave stale TLB
+// entries behind (pages removed, remapped or write-protected):
+// make sure no CPU uses them, including this one.
+void
+flushuvm(struct proc *p)
+{
+  newasid(p, 0);
+  if(p == proc)
+    switchuvm(p);
+}
+
+// TLB shootdowns.
+//
+// Each CPU records in cpu->uvm the user page table it has
+// loaded, if any.  When entries for a page table change, the
+// CPUs that have it loaded must invalidate them before the
+// old pages can be reused.  Other CPUs only have entries
+// cached under the old asid, which newasid() retires.
+//
+// Remote CPUs are asked with an IPI.  Requests go on the
+// target's queue; if the queue already holds requests, an IPI
+// is on its way and the new request is batched with them.
+
+#define NTLBREQ   8    // queued shootdown requests per CPU
+#define TLBINVLPG 32   // largest range invalidated page by page
+
+static struct {
+  struct spinlock lock;
+  struct {
+    struct {
+      pde_t *pgdir;
+      uintp start;
+      uintp end;
+    } req[NTLBREQ];
+    int n;                 // requests queued
+    int all;               // queue overflowed: flush everything
+    uint posted;           // requests ever queued
+    volatile uint done;    // requests ever handled
+  } q[NCPU];
+} tlb;
+
+// Invalidate this CPU's entries for [start, end) of the
+// loaded page table.
+static void
+tlbinval(uintp start, uintp end)
+{
+  uintp a;
+
+  if((end - start) / PGSIZE > TLBINVLPG){
+    lcr3(rcr3());   // flushes the current PCID only
+    return;
+  }
+  for(a = start; a < end; a += PGSIZE)
+    invlpg((void*)a);
+}
+
+// Handle the shootdown requests queued for this CPU.
+// Called with interrupts off.
+void
+tlbintr(void)
+{
+  int i, n, all, id;
+  uint posted;
+  pde_t *pgdir[NTLBREQ];
+  uintp start[NTLBREQ], end[NTLBREQ];
+
+  id = cpu->id;
+  acquire(&tlb.lock);
+  n = tlb.q[id].n;
+  all = tlb.q[id].all;
+  posted = tlb.q[id].posted;
+  for(i = 0; i < n; i++){
+    pgdir[i] = tlb.q[id].req[i].pgdir;
+    start[i] = tlb.q[id].req[i].start;
+    end[i] = tlb.q[id].req[i].end;
+  }
+  tlb.q[id].n = 0;
+  tlb.q[id].all = 0;
+  release(&tlb.lock);
+
+  if(all)
+    lcr3(rcr3());
+  else
+    for(i = 0; i < n; i++)
+      if(cpu->uvm == pgdir[i])
+        tlbinval(start[i], end[i]);
+  tlb.q[id].done = posted;
+}
+
+// Ask CPU c to invalidate [start, end) of pgdir.
+// Returns the request's sequence number.
+static uint
+tlbpost(struct cpu *c, pde_t *pgdir, uintp start, uintp end)
+{
+  int id, n, pending;
+  uint seq;
+
+  id = c->id;
+  acquire(&tlb.lock);
+  n = tlb.q[id].n;
+  pending = n > 0 || tlb.q[id].all;
+  if(n < NTLBREQ){
+    tlb.q[id].req[n].pgdir = pgdir;
+    tlb.q[id].req[n].start = start;
+    tlb.q[id].req[n].end = end;
+    tlb.q[id].n++;
+  } else
+    tlb.q[id].all = 1;
+  seq = ++tlb.q[id].posted;
+  release(&tlb.lock);
+
+  if(!pending){
+    lapicipi(c->apicid, T_TLBFLUSH);
+    cpu->ntlbsent++;
+  } else
+    cpu->ntlbbatch++;
+  return seq;
+}
+
+// The PTEs for user addresses [start, end) of p's page table
+// changed: make sure no CPU still uses the old ones.  Returns
+// once every CPU that has the page table loaded has dropped them,
+// so the caller must not hold a lock those CPUs might spin on.
+void
+tlbshootdown(struct proc *p, uintp start, uintp end)
+{
+  struct cpu *c;
+  uint seq[NCPU];
+  int mine, n;
+
+  start = PGROUNDDOWN(start);
+  pushcli();
+  mine = cpu->uvm == p->pgdir;
+  if(mine)
+    tlbinval(start, end);
+  newasid(p, mine);
+  __sync_synchronize();   // publish the asid before looking at cpu->uvm
+
+  n = 0;
+  for(c = cpus; c < cpus+ncpu; c++){
+    seq[c->id] = 0;
+    if(c != cpu && c->uvm == p->pgdir){
+      seq[c->id] = tlbpost(c, p->pgdir, start, end);
+      n++;
+    }
+  }
+  if(n == 0){
+    cpu->ntlbavoid++;
+    popcli();
+    return;
+  }
+
+  // Wait for the other CPUs, serving our own queue meanwhile
+  // in case one of them is waiting for us with interrupts off.
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(seq[c->id] == 0)
+      continue;
+    while((int)(tlb.q[c->id].done - seq[c->id]) < 0){
+      if(tlb.q[cpu->id].n || tlb.q[cpu->id].all)
+        tlbintr();
+    }
+  }
+  popcli();
+}
+
 // Load the initcode into address 0 of pgdir.
 // sz must be less than a page.
 void
@@ -189,72 +494,67 @@ inituvm(pde_t *pgdir, char *init, uint sz)
   
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, v2p(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
 
-// Load a program segment into pgdir.  addr must be page-aligned
-// and the pages from addr to addr+sz must already be mapped.
-int
-loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
-{
-  uint i, pa, n;
-  pte_t *pte;
-
-  if((uintp) addr % PGSIZE != 0)
-    panic("loaduvm: addr must be page aligned");
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
-      panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
-    if(sz - i < PGSIZE)
-      n = sz - i;
-    else
-      n = PGSIZE;
-    if(readi(ip, p2v(pa), offset+i, n) != n)
-      return -1;
-  }
-  return 0;
-}
-
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
-int
-allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+uintp
+allocuvm(pde_t *pgdir, uintp oldsz, uintp newsz)
 {
   char *mem;
   uintp a;
 
-#if !defined(X64)
-  if(newsz >= KERNBASE)
+  if(newsz > USERTOP)
     return 0;
-#endif
   if(newsz < oldsz)
     return oldsz;
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     mappages(pgdir, (char*)a, PGSIZE, v2p(mem), PTE_W|PTE_U);
   }
   return newsz;
 }
 
+// Replace the huge page mapped by pde with a page table that
+// maps the same memory with small pages.  If the huge page is
+// shared copy-on-write, so are the small ones.  Callers must
+// flush the TLB.  Returns -1 if out of memory.
+static int
+splithuge(pde_t *pde)
+{
+  pte_t *pgtab;
+  uintp pa, flags;
+  int i;
+
+  if((pgtab = (pte_t*)kalloc()) == 0)
+    return -1;
+  pa = PTE_ADDR(*pde);
+  flags = PTE_FLAGS(*pde) & ~PTE_PS;
+  ksplitpages(p2v(pa), HUGEORDER);
+  for(i = 0; i < NPTENTRIES; i++)
+    pgtab[i] = (pa + i*PGSIZE) | flags;
+  *pde = v2p(pgtab) | PTE_P | PTE_W | PTE_U;
+  return 0;
+}
+
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
 // process size.  Returns the new process size.
-int
+uintp
 deallocuvm(pde_t *pgdir, uintp oldsz, uintp newsz)
 {
+  pde_t *pde;
   pte_t *pte;
   uintp a, pa;
 
@@ -263,77 +563,140 @@ deallocuvm(pde_t *pgdir, uintp oldsz, uintp newsz)
 
   a = PGROUNDUP(newsz);
   for(; a  < oldsz; a += PGSIZE){
+    if((a = skipholes(pgdir, a)) >= oldsz)
+      break;
+    pde = walkpde(pgdir, (char*)a, 0);
+    if(*pde & PTE_PS){
+      if(a % HUGEPGSIZE == 0 && a + HUGEPGSIZE <= oldsz){
+        kfreepages(p2v(PTE_ADDR(*pde)), HUGEORDER);
+        *pde = 0;
+        a += HUGEPGSIZE - PGSIZE;
+        continue;
+      }
+      // Only part of it goes.  If there is no memory to split
+      // it, leave it all mapped; freevm() will get it.
+      if(splithuge(pde) < 0){
+        a = NEXTBLOCK(a, PDXSHIFT) - PGSIZE;
+        continue;
+      }
+      proc->nhugesplit++;
+    }
     pte = walkpgdir(pgdir, (char*)a, 0);
-    if(!pte)
-      a += (NPTENTRIES - 1) * PGSIZE;
-    else if((*pte & PTE_P) != 0){
+    if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
       char *v = p2v(pa);
       kfree(v);
       *pte = 0;
+    } else if(*pte & PTE_SWAP){
+      swapfree(PTE_ADDR(*pte) >> PGSHIFT);
+      *pte = 0;
     }
   }
   return newsz;
 }
 
+// Free the first n tables that the entries of table t point
+// to, and the depth-1 levels of tables below each of them,
+// clearing the entries.  The tables must map no pages, so
+// that they are all zeros once their own entries are cleared.
+static void
+freetables(pde_t *t, int n, int depth)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!(t[i] & PTE_P))
+      continue;
+    if(depth > 1)
+      freetables((pde_t*)p2v(PTE_ADDR(t[i])), NPDENTRIES, depth - 1);
+    kfree_zeroed(p2v(PTE_ADDR(t[i])));
+    t[i] = 0;
+  }
+}
+
+// The number of entries in the user half of a top-level table.
+#if X64
+#define NUSERPDE  PML4X(USERTOP)
+#define UVMDEPTH  3
+#else
+#define NUSERPDE  PDX(USERTOP)
+#define UVMDEPTH  1
+#endif
+
 // Free a page table and all the physical memory pages
 // in the user part.
 void
 freevm(pde_t *pgdir)
 {
-  uint i;
   if(pgdir == 0)
     panic("freevm: no pgdir");
-  deallocuvm(pgdir, 0x3fa00000, 0);
-  for(i = 0; i < NPDENTRIES-2; i++){
-    if(pgdir[i] & PTE_P){
-      char * v = p2v(PTE_ADDR(pgdir[i]));
-      kfree(v);
-    }
-  }
-  kfree((char*)pgdir);
-}
-
-// Clear PTE_U on a page. Used to create an inaccessible
-// page beneath the user stack.
-void
-clearpteu(pde_t *pgdir, char *uva)
-{
-  pte_t *pte;
-
-  pte = walkpgdir(pgdir, uva, 0);
-  if(pte == 0)
-    panic("clearpteu");
-  *pte &= ~PTE_U;
+  deallocuvm(pgdir, USERTOP, 0);
+  freetables(pgdir, NUSERPDE, UVMDEPTH);
+  // The kernel half points at tables shared by every
+  // page table; just forget it.
+  memset(&pgdir[NUSERPDE], 0, (NPDENTRIES - NUSERPDE) * sizeof(pde_t));
+  kfree_zeroed((char*)pgdir);
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child.  Writable pages are not copied but
+// shared copy-on-write: both page tables map them read-only
+// with PTE_COW set, and the first write to one by either
+// process makes a private copy (see pagefault).  Pages of
+// MAP_SHARED regions (PTE_SHARED) stay writable in both.
+// Huge pages are shared the same way, whole (see hugecow).
+// The caller must flush the TLB if pgdir is the current
+// page table.
 pde_t*
-copyuvm(pde_t *pgdir, uint sz)
+copyuvm(pde_t *pgdir, uintp sz)
 {
-  pde_t *d;
-  pte_t *pte;
+  pde_t *d, *pde, *dpde;
+  pte_t *pte, *dpte;
   uintp pa, i, flags;
-  char *mem;
+  int ntables;
 
   if((d = setupkvm()) == 0)
     return 0;
+  ntables = 1;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+    if((i = skipholes(pgdir, i)) >= sz)
+      break;
+    pde = walkpde(pgdir, (void*)i, 0);
+    if(*pde & PTE_PS){
+      // No page table below it.
+      ntables += missingtables(d, i) - 1;
+      if((dpde = walkpde(d, (void*)i, 1)) == 0)
+        goto bad;
+      if((*pde & PTE_W) && !(*pde & PTE_SHARED))
+        *pde = (*pde & ~PTE_W) | PTE_COW;
+      krefpages(p2v(PTE_ADDR(*pde)), HUGEORDER);
+      *dpde = *pde;
+      i = NEXTBLOCK(i, PDXSHIFT) - PGSIZE;
+      continue;
+    }
+    pte = walkpgdir(pgdir, (void *) i, 0);
+    if(!(*pte & (PTE_P | PTE_SWAP)))
+      continue;   // not touched yet
+    ntables += missingtables(d, i);
+    if((dpte = walkpgdir(d, (void*)i, 1)) == 0)
+      goto bad;
+    if(*pte & PTE_SWAP){
+      // Both processes will read their own copy back in.
+      swapdup(PTE_ADDR(*pte) >> PGSHIFT);
+      *dpte = *pte;
+      continue;
+    }
+    if((*pte & PTE_W) && !(*pte & PTE_SHARED))
+      *pte = (*pte & ~PTE_W) | PTE_COW;
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)p2v(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, v2p(mem), flags) < 0)
-      goto bad;
+    kref(p2v(pa));
+    *dpte = pa | flags;
   }
+  __sync_add_and_fetch(&pgt.forks, 1);
+  __sync_add_and_fetch(&pgt.forktables, ntables);
   return d;
 
 bad:
@@ -341,15 +704,746 @@ bad:
   return 0;
 }
 
+// A page of zeros, mapped copy-on-write wherever a process
+// reads memory that it has never written.
+static char *zeropg;
+
+// Set up state shared by all user address spaces.
+void
+uvminit(void)
+{
+  if((zeropg = kalloc_zeroed()) == 0)
+    panic("uvminit");
+  initlock(&tlb.lock, "tlb");
+}
+
+// Return the region in vma[NVMA] that contains va, or 0.
+static struct vma*
+findvma(struct vma *vma, uintp va)
+{
+  struct vma *v;
+
+  for(v = vma; v < vma + NVMA; v++)
+    if(v->end && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Return the lowest address that region v keeps other memory
+// away from.  For the stack that is below the most it may grow
+// to, less a guard gap, so that neither the heap nor an mmap
+// region can end up right under it.
+static uintp
+vmabottom(struct vma *v)
+{
+  if(v->flags & MAP_GROWSDOWN)
+    return v->end - STACKMAX - STACKGAP;
+  return v->start;
+}
+
+// If va lies in the space the current process's stack may
+// grow down into, extend the stack region to cover it.
+// Returns the stack region, or 0.
+static struct vma*
+growstack(uintp va)
+{
+  struct vma *v;
+
+  for(v = proc->vma; v < proc->vma + NVMA; v++){
+    if(v->end && (v->flags & MAP_GROWSDOWN)){
+      if(va >= v->start || va < v->end - STACKMAX)
+        return 0;
+      v->start = PGROUNDDOWN(va);
+      return v;
+    }
+  }
+  return 0;
+}
+
+// Return the lowest address the heap of the current process
+// cannot grow past: the bottom of the first mapped region above
+// it, or USERTOP.
+uintp
+heaplimit(void)
+{
+  struct vma *v;
+  uintp lim;
+
+  lim = USERTOP;
+  for(v = proc->vma; v < proc->vma + NVMA; v++)
+    if(v->end && v->start >= proc->sz && vmabottom(v) < lim)
+      lim = vmabottom(v);
+  return lim;
+}
+
+// Return 1 if the len bytes at user address va are all in the
+// current process's memory: below proc->sz, or inside a single
+// mapped region.  An address below the stack but within its
+// limit counts as well, and the stack grows down to cover it;
+// since the page fault handler and system calls checking user
+// pointers both come through here, the stack grows on demand.
+int
+uvmcheck(uintp va, uintp len)
+{
+  if(va + len < va)
+    return 0;
+  if(va + len <= proc->sz)
+    return 1;
+  return va + len <= uvmend(va, 1);
+}
+
+// Return the end of the current process's memory that user
+// address va lies in: proc->sz, or the end of va's region,
+// growing the stack as uvmcheck() does.  Shared regions count
+// only if shared is set.  Returns 0 if va is not mapped.
+uintp
+uvmend(uintp va, int shared)
+{
+  struct vma *v;
+
+  if(va < proc->sz)
+    return proc->sz;
+  if((v = findvma(proc->vma, va)) == 0 && (v = growstack(va)) == 0)
+    return 0;
+  if((v->flags & MAP_SHARED) && !shared)
+    return 0;
+  return v->end;
+}
+
+// Drop the file references held by the regions in vma[NVMA]
+// and mark them free.  Must be called inside a transaction,
+// since it may iput() the last reference to a file.
+void
+freevmas(struct vma *vma)
+{
+  struct vma *v;
+
+  for(v = vma; v < vma + NVMA; v++){
+    if(v->end && v->ip)
+      iput(v->ip);
+    memset(v, 0, sizeof(*v));
+  }
+}
+
+// Drop the pages of region v below user address a.
+static void
+trimvma(struct vma *v, uintp a)
+{
+  uintp d;
+
+  d = a - v->start;
+  v->filesz = v->filesz > d ? v->filesz - d : 0;
+  v->off += d;
+  v->start = a;
+}
+
+// Write the dirty pages of region v between user addresses
+// start and end back to its file, if it is a shared file
+// mapping.  pgdir is the page table that maps v.
+// Returns -1 if a write fails.
+static int
+syncvma(pde_t *pgdir, struct vma *v, uintp start, uintp end)
+{
+  pte_t *pte;
+  uintp a;
+  uint off, n;
+
+  if(v->ip == 0 || !(v->flags & MAP_SHARED) || !(v->prot & PTE_W))
+    return 0;
+  if(start < v->start)
+    start = v->start;
+  if(end > v->end)
+    end = v->end;
+  for(a = PGROUNDDOWN(start); a < end; a += PGSIZE){
+    if((a = skipholes(pgdir, a)) >= end)
+      break;
+    pte = walkpgdir(pgdir, (void*)a, 0);
+    if(!(*pte & PTE_P) || !(*pte & PTE_D))
+      continue;
+    off = a - v->start;
+    if(off >= v->filesz)
+      break;
+    n = v->filesz - off < PGSIZE ? v->filesz - off : PGSIZE;
+    if(writeinode(v->ip, p2v(PTE_ADDR(*pte)), v->off + off, n) != n)
+      return -1;
+    *pte &= ~PTE_D;
+  }
+  return 0;
+}
+
+// Write the dirty pages of the shared file mappings in vma[NVMA]
+// that lie between start and end back to their files.
+// The caller must flush the TLB if pgdir is in use, so that
+// later writes mark the pages dirty again.
+int
+syncvmas(pde_t *pgdir, struct vma *vma, uintp start, uintp end)
+{
+  struct vma *v;
+  int r;
+
+  r = 0;
+  for(v = vma; v < vma + NVMA; v++)
+    if(v->end && v->start < end && v->end > start)
+      if(syncvma(pgdir, v, start, end) < 0)
+        r = -1;
+  return r;
+}
+
+// Map len bytes of the file ip starting at offset off (or zeros,
+// if ip is 0) into the current process, at an address below
+// USERTOP and above the heap.  Pages are filled in on first
+// touch.  Takes a reference to ip.
+// Returns the address, or -1 if there is no room.
+uintp
+mmapuvm(uintp len, int prot, int flags, struct inode *ip, uint off, uint filesz)
+{
+  struct vma *v, *free;
+  uintp top;
+
+  len = PGROUNDUP(len);
+  if(len == 0 || len > USERTOP)
+    return -1;
+  free = 0;
+  for(v = proc->vma; v < proc->vma + NVMA; v++)
+    if(v->end == 0)
+      free = v;
+  if(free == 0)
+    return -1;
+
+  // Find the highest gap below USERTOP that fits.
+  top = USERTOP;
+again:
+  if(top < len || top - len < PGROUNDUP(proc->sz))
+    return -1;
+  for(v = proc->vma; v < proc->vma + NVMA; v++){
+    if(v->end && vmabottom(v) < top && v->end > top - len){
+      top = vmabottom(v);
+      goto again;
+    }
+  }
+
+  free->start = top - len;
+  free->end = top;
+  free->prot = prot;
+  free->flags = flags;
+  free->ip = ip ? idup(ip) : 0;
+  free->off = off;
+  free->filesz = filesz;
+  return free->start;
+}
+
+// Remove the mappings of the current process between user
+// addresses addr and addr+len, writing back dirty pages of
+// shared file mappings first.  Returns -1 if the range is not
+// page aligned, overlaps the heap, or would split a region
+// when there is no free slot for the second half.
+int
+munmapuvm(uintp addr, uintp len)
+{
+  struct vma *v, *nv;
+  uintp end, a, b;
+
+  len = PGROUNDUP(len);
+  end = addr + len;
+  if(addr % PGSIZE || end < addr || end > USERTOP || addr < PGROUNDUP(proc->sz))
+    return -1;
+
+  // Make sure a split will succeed before changing anything.
+  for(v = proc->vma; v < proc->vma + NVMA; v++){
+    if(v->end && v->start < addr && v->end > end){
+      for(nv = proc->vma; nv < proc->vma + NVMA; nv++)
+        if(nv->end == 0)
+          break;
+      if(nv == proc->vma + NVMA)
+        return -1;
+    }
+  }
+
+  syncvmas(proc->pgdir, proc->vma, addr, end);
+
+  for(v = proc->vma; v < proc->vma + NVMA; v++){
+    if(v->end == 0 || v->start >= end || v->end <= addr)
+      continue;
+    a = v->start > addr ? v->start : addr;
+    b = v->end < end ? v->end : end;
+    deallocuvm(proc->pgdir, b, a);
+    if(a > v->start && b < v->end){
+      // Punch a hole: [b, end) moves to a new slot.
+      for(nv = proc->vma; nv->end; nv++)
+        ;
+      *nv = *v;
+      if(nv->ip)
+        idup(nv->ip);
+      trimvma(nv, b);
+      v->end = a;
+      v->flags &= ~MAP_GROWSDOWN;   // only the top part is the stack
+    } else if(a > v->start)
+      v->end = a;
+    else if(b < v->end)
+      trimvma(v, b);
+    else {
+      if(v->ip){
+        begin_op();
+        iput(v->ip);
+        end_op();
+      }
+      memset(v, 0, sizeof(*v));
+    }
+  }
+  tlbshootdown(proc, addr, end);
+  return 0;
+}
+
+// Read the page at user address va in from region v's file,
+// and map it at pte.  Pages of read-only private regions, such
+// as program text, are shared through the text cache with
+// every other process mapping the same page of the same file.
+// Returns -1 if out of memory, 1 if the file can't be read
+// (e.g. the page lies past its end).
+static int
+filefill(struct vma *v, pte_t *pte, uintp va)
+{
+  char *mem;
+  uint off, n;
+  int text;
+
+  off = va - v->start;
+  n = 0;
+  if(off < v->filesz)
+    n = v->filesz - off < PGSIZE ? v->filesz - off : PGSIZE;
+  text = !(v->prot & PTE_W) && !(v->flags & MAP_SHARED);
+  ilock(v->ip);
+  if(text && (mem = textget(v->ip, v->off + off, n)) != 0){
+    iunlock(v->ip);
+    *pte = v2p(mem) | PTE_P | PTE_U | v->prot;
+    return 0;
+  }
+  if((mem = kalloc()) == 0){
+    iunlock(v->ip);
+    return -1;
+  }
+  memset(mem + n, 0, PGSIZE - n);
+  if(readi(v->ip, mem, v->off + off, n) != n){
+    iunlock(v->ip);
+    kfree(mem);
+    return 1;
+  }
+  if(text)
+    textadd(v->ip, v->off + off, n, mem);
+  iunlock(v->ip);
+  *pte = v2p(mem) | PTE_P | PTE_U | v->prot;
+  return 0;
+}
+
+// Read the swapped-out page whose PTE is pte back in.
+// Returns -1 if out of memory.
+static int
+swapfill(pte_t *pte)
+{
+  char *mem;
+  uintp flags;
+
+  if((mem = kalloc()) == 0)
+    return -1;
+  flags = PTE_FLAGS(*pte) & ~PTE_SWAP;
+  swapin(PTE_ADDR(*pte) >> PGSHIFT, mem);
+  // The page is this process's own copy now.
+  if(flags & PTE_COW)
+    flags = (flags & ~PTE_COW) | PTE_W;
+  *pte = v2p(mem) | flags | PTE_P;
+  return 0;
+}
+
+// Fill the unmapped page at user address va, whose pte
+// is pte, on first touch: with a fresh zeroed page for a
+// write, or with the shared zero page for a read.
+// Returns -1 if out of memory.
+static int
+zerofill(pte_t *pte, uintp va, int write)
+{
+  char *mem;
+
+  if(write){
+    if((mem = kalloc_zeroed()) == 0)
+      return -1;
+    *pte = v2p(mem) | PTE_P | PTE_W | PTE_U;
+  } else {
+    kref(zeropg);
+    *pte = v2p(zeropg) | PTE_P | PTE_U | PTE_COW;
+  }
+  return 0;
+}
+
+// Back the whole huge-page-sized, aligned block of user memory
+// around va with one zeroed huge page, if that block has not
+// been touched yet and is anonymous, writable memory: heap, or
+// an anonymous mapping.  Returns -1 if the block does not
+// qualify or there is no free contiguous memory for it, in
+// which case the caller falls back to small pages.
+static int
+hugefill(uintp va)
+{
+  pde_t *pde;
+  struct vma *v, *w;
+  uintp h;
+  char *mem;
+
+  h = va & ~(HUGEPGSIZE - 1);
+  if(h + HUGEPGSIZE > USERTOP)
+    return -1;
+  if((pde = walkpde(proc->pgdir, (void*)h, 1)) == 0 || (*pde & PTE_P))
+    return -1;
+  v = findvma(proc->vma, h);
+  if(v){
+    if(v->ip || !(v->prot & PTE_W) || h + HUGEPGSIZE > v->end)
+      return -1;
+    if(v->flags & MAP_GROWSDOWN)
+      return -1;   // the stack grows a page at a time
+  } else {
+    if(h + HUGEPGSIZE > proc->sz)
+      return -1;
+    for(w = proc->vma; w < proc->vma + NVMA; w++)
+      if(w->end && w->start < h + HUGEPGSIZE && w->end > h)
+        return -1;   // part of it is a program segment
+  }
+  if((mem = kallocpages(HUGEORDER)) == 0){
+    proc->nhugefail++;
+    return -1;
+  }
+  memset(mem, 0, HUGEPGSIZE);
+  *pde = v2p(mem) | PTE_P | PTE_W | PTE_U | PTE_PS;
+  if(v && (v->flags & MAP_SHARED))
+    *pde |= PTE_SHARED;
+  proc->nhuge++;
+  return 0;
+}
+
+// Give the current process a private, writable copy of the
+// copy-on-write page mapped by pte at user address va.
+// Returns -1 if out of memory.
+static int
+cowcopy(pte_t *pte, uintp va)
+{
+  uintp pa;
+  char *mem;
+
+  pa = PTE_ADDR(*pte);
+  if(p2v(pa) == zeropg){
+    if((mem = kalloc_zeroed()) == 0)
+      return -1;
+    *pte = v2p(mem) | ((PTE_FLAGS(*pte) | PTE_W) & ~PTE_COW);
+    kfree(zeropg);
+  } else if(krefcount(p2v(pa)) == 1){
+    // Nobody else shares it any more; just take it over.
+    *pte = (*pte | PTE_W) & ~PTE_COW;
+  } else {
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, p2v(pa), PGSIZE);
+    *pte = v2p(mem) | ((PTE_FLAGS(*pte) | PTE_W) & ~PTE_COW);
+    kfree(p2v(pa));
+  }
+  tlbshootdown(proc, va, va + PGSIZE);
+  return 0;
+}
+
+// Give the current process a private, writable copy of the
+// copy-on-write huge page mapped by pde, around user address
+// va.  If there is no free huge page to copy it to, split it
+// and copy just the small page at va; the others stay shared.
+// Returns -1 if out of memory.
+static int
+hugecow(pde_t *pde, uintp va)
+{
+  uintp pa, h;
+  pte_t *pte;
+  char *mem;
+
+  pa = PTE_ADDR(*pde);
+  h = va & ~(HUGEPGSIZE - 1);
+  if(kpageorder(p2v(pa)) == HUGEORDER && krefcount(p2v(pa)) == 1){
+    // Nobody else shares it any more; just take it over.
+    *pde = (*pde | PTE_W) & ~PTE_COW;
+  } else if((mem = kallocpages(HUGEORDER)) != 0){
+    memmove(mem, p2v(pa), HUGEPGSIZE);
+    *pde = v2p(mem) | ((PTE_FLAGS(*pde) | PTE_W) & ~PTE_COW);
+    kfreepages(p2v(pa), HUGEORDER);
+  } else {
+    proc->nhugefail++;
+    if(splithuge(pde) < 0)
+      return -1;
+    proc->nhugesplit++;
+    tlbshootdown(proc, h, h + HUGEPGSIZE);
+    pte = walkpgdir(proc->pgdir, (void*)va, 0);
+    return cowcopy(pte, va);
+  }
+  tlbshootdown(proc, h, h + HUGEPGSIZE);
+  return 0;
+}
+
+// Fill the page at user address va of the current process
+// on first touch, from its file if it is in a region and
+// with zeros otherwise, or from swap if it was swapped out.
+// pte is its PTE, which is not present.  Returns -1 if out
+// of memory, 1 if the page is read-only and write is set or
+// its file can't be read.
+static int
+fillpage(pte_t *pte, uintp va, int write)
+{
+  struct vma *v;
+
+  int r;
+
+  if(*pte & PTE_SWAP)
+    return swapfill(pte);
+  v = findvma(proc->vma, va);
+  if(v && write && !(v->prot & PTE_W))
+    return 1;
+  if(v && v->ip)
+    r = filefill(v, pte, va);
+  else if(v && (v->flags & MAP_SHARED))
+    r = zerofill(pte, va, 1);   // needs a page of its own to share
+  else
+    r = zerofill(pte, va, write);
+  if(r != 0)
+    return r;
+  proc->nsmall++;
+  if(v && !(v->prot & PTE_W))
+    *pte &= ~(PTE_W | PTE_COW);   // read-only: a write must fault
+  if(v && (v->flags & MAP_SHARED))
+    *pte |= PTE_SHARED;
+  return 0;
+}
+
+// Fill in every page of the current process's MAP_SHARED
+// regions.  fork calls this first, since a page that does not
+// exist yet when the page table is copied cannot be shared.
+// Returns -1 if out of memory.
+int
+fillshared(void)
+{
+  struct vma *v;
+
+  for(v = proc->vma; v < proc->vma + NVMA; v++)
+    if(v->end && (v->flags & MAP_SHARED))
+      if(touchuvm(v->start, v->end - v->start, v->prot & PTE_W) < 0)
+        return -1;
+  return 0;
+}
+
+// Take up to n pages from process p, which reclaim() has
+// chosen, using the CLOCK algorithm: p->clock sweeps through
+// p's address space, passing over (and clearing PTE_A in) the
+// pages used since its last visit.  Unused pages are written
+// to swap, or just dropped if they are clean pages of a file,
+// which filefill() can read again.  Pages that other page
+// tables also map are left alone.  Returns the number taken.
+static int
+evictuvm(struct proc *p, int n)
+{
+  char *mem, *freed[SWAPBATCH];
+  pde_t *pde;
+  pte_t *pte;
+  struct vma *v;
+  uintp a, start;
+  int i, s, nfreed, ndrop;
+
+  if(n > SWAPBATCH)
+    n = SWAPBATCH;
+  nfreed = ndrop = 0;
+  start = p->clock;
+  for(a = start; a < USERTOP && nfreed < n; a += PGSIZE){
+    if((a = skipholes(p->pgdir, a)) >= USERTOP)
+      break;
+    pde = walkpde(p->pgdir, (void*)a, 0);
+    if(*pde & PTE_PS){
+      a = NEXTBLOCK(a, PDXSHIFT) - PGSIZE;
+      continue;
+    }
+    pte = walkpgdir(p->pgdir, (void*)a, 0);
+    if(!(*pte & PTE_P) || !(*pte & PTE_U) || (*pte & PTE_SHARED))
+      continue;
+    mem = p2v(PTE_ADDR(*pte));
+    if(krefcount(mem) > 1)
+      continue;
+    if(*pte & PTE_A){
+      *pte &= ~PTE_A;   // second chance
+      continue;
+    }
+    v = findvma(p->vma, a);
+    if(v && v->ip && !(*pte & PTE_D)){
+      *pte = 0;
+      ndrop++;
+    } else {
+      if((s = swapout(mem)) < 0)
+        break;
+      *pte = ((uintp)s << PGSHIFT) | PTE_SWAP |
+             (PTE_FLAGS(*pte) & ~(PTE_P | PTE_A | PTE_D));
+    }
+    freed[nfreed++] = mem;
+  }
+  p->clock = a < USERTOP ? a : 0;
+
+  // Drop the old translations, and the cached PTE_A bits,
+  // before the pages can be reused.
+  tlbshootdown(p, start, a);
+  for(i = 0; i < nfreed; i++)
+    kfree(freed[i]);
+  swapcount(ndrop, 0);
+  return nfreed;
+}
+
+// Free up to n pages of user memory by taking them from
+// processes that are not using their address spaces in the
+// kernel, and, if self is set, from the current process.
+// May sleep; the caller must hold no locks and no pointers
+// into its own page table.  Returns the number of pages freed.
+int
+reclaim(int n, int self)
+{
+  struct proc *p;
+  int got, tries;
+
+  got = 0;
+  for(tries = 0; got < n && tries < NPROC; tries++){
+    if((p = pickvictim(self)) == 0)
+      break;
+    got += evictuvm(p, n - got);
+    dropvictim(p);
+  }
+  if(got == 0)
+    swapcount(0, 1);
+  return got;
+}
+
+// Resolve a fault on the page at user address va in the
+// current process.  Returns 0 if it is resolved, -1 if
+// out of memory, and 1 if it is a real fault.
+static int
+pagefault1(uintp va, uint err)
+{
+  pde_t *pde;
+  pte_t *pte;
+
+  if((pde = walkpde(proc->pgdir, (void*)va, 1)) == 0)
+    return -1;
+  if(*pde & PTE_PS){
+    if((*pde & PTE_U) && (err & FEC_WR) && (*pde & PTE_COW))
+      return hugecow(pde, va);
+    return 1;   // huge pages are always present
+  }
+  if(hugefill(va) == 0)
+    return 0;
+  if((pte = walkpgdir(proc->pgdir, (void*)va, 1)) == 0)
+    return -1;
+  if(!(*pte & PTE_P))
+    return fillpage(pte, va, err & FEC_WR);
+  if((*pte & PTE_U) && (err & FEC_WR) && (*pte & PTE_COW))
+    return cowcopy(pte, va);
+  return 1;
+}
+
+// Handle a page fault at user address va in the current
+// process; err is the error code pushed by the processor.
+// Called from trap() for faults in both user and kernel mode.
+// If memory runs out, reclaim some and try again; a fault
+// from user space may give up pages of the process itself.
+// Returns 0 if the fault was resolved and the faulting
+// instruction can be restarted, -1 if it is a real fault.
+int
+pagefault(uintp va, uint err)
+{
+  int r;
+
+  if(proc == 0 || !uvmcheck(va, 1))
+    return -1;
+  while((r = pagefault1(PGROUNDDOWN(va), err)) < 0)
+    if(reclaim(SWAPBATCH, err & FEC_U) == 0)
+      break;
+  return r == 0 ? 0 : -1;
+}
+
+// Fill in and copy the pages for touchuvm().  Returns 0 on
+// success, -1 if out of memory, and 1 if a page may not be
+// written or can't be read in.
+static int
+touchuvm1(uintp va, uintp len, int write)
+{
+  pde_t *pde;
+  pte_t *pte;
+  uintp a, last;
+  int r;
+
+  a = PGROUNDDOWN(va);
+  last = PGROUNDDOWN(va + len - 1);
+  for(; a <= last; a += PGSIZE){
+    if((pde = walkpde(proc->pgdir, (void*)a, 1)) == 0)
+      return -1;
+    if(!(*pde & PTE_P))
+      hugefill(a);
+    if((*pde & PTE_PS) && write && (*pde & PTE_COW))
+      if(hugecow(pde, a) < 0)
+        return -1;
+    if(*pde & PTE_PS){
+      a = NEXTBLOCK(a, PDXSHIFT) - PGSIZE;
+      continue;
+    }
+    if((pte = walkpgdir(proc->pgdir, (void*)a, 1)) == 0)
+      return -1;
+    if(!(*pte & PTE_P)){
+      if((r = fillpage(pte, a, write)) != 0)
+        return r;
+    } else if(write && (*pte & PTE_COW)){
+      if(cowcopy(pte, a) < 0)
+        return -1;
+    }
+  }
+  return 0;
+}
+
+// Make sure the kernel can read (or, if write is set, write)
+// the len bytes at user address va in the current process
+// without taking a page fault, by filling in untouched pages,
+// reading swapped-out ones back in and doing any copy-on-write
+// copies now.
+// System calls that copy to or from user memory while holding
+// locks call this first: filling a page from a file may sleep,
+// and running out of memory should fail the call rather than
+// fault in the middle of the kernel.  reclaim() leaves the
+// pages alone for the rest of the system call.
+// Returns -1 if out of memory or the range is not user memory.
+int
+touchuvm(uintp va, uintp len, int write)
+{
+  int r;
+
+  if(!uvmcheck(va, len))
+    return -1;
+  if(len == 0)
+    return 0;
+  while((r = touchuvm1(va, len, write)) < 0)
+    if(reclaim(SWAPBATCH, 0) == 0)
+      break;
+  return r == 0 ? 0 : -1;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
 uva2ka(pde_t *pgdir, char *uva)
 {
+  pde_t *pde;
   pte_t *pte;
 
+  if((pde = walkpde(pgdir, uva, 0)) == 0)
+    return 0;
+  if(*pde & PTE_PS){
+    if((*pde & PTE_U) == 0)
+      return 0;
+    return (char*)p2v(PTE_ADDR(*pde) + PGROUNDDOWN((uintp)uva % HUGEPGSIZE));
+  }
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -360,14 +1454,14 @@ uva2ka(pde_t *pgdir, char *uva)
 // Most useful when pgdir is not the current page table.
 // uva2ka ensures this only works for PTE_U pages.
 int
-copyout(pde_t *pgdir, uint va, void *p, uint len)
+copyout(pde_t *pgdir, uintp va, void *p, uintp len)
 {
   char *buf, *pa0;
   uintp n, va0;
 
   buf = (char*)p;
   while(len > 0){
-    va0 = (uint)PGROUNDDOWN(va);
+    va0 = PGROUNDDOWN(va);
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -382,6 +1476,15 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   return 0;
 }
 
+// Print how many page-table pages have been allocated, and how
+// many a fork needs on average.  For debugging; no locking.
+void
+pgtdump(void)
+{
+  cprintf("pgtab: %d pages allocated, %d forks, %d pages per fork\n",
+          pgt.alloc, pgt.forks, pgt.forks ? pgt.forktables / pgt.forks : 0);
+}
+
 //PAGEBREAK!
 // Blank page.
 //PAGEBREAK!
@@ -31,12 +31,14 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "cpuid.h"
 
 __thread struct cpu *cpu;
 __thread struct proc *proc;
 
 static pde_t *kpml4;
 static pde_t *kpdpt;
+static pde_t *kphyspdpt;
 static pde_t *iopgdir;
 static pde_t *kpgdir0;
 static pde_t *kpgdir1;
@@ -114,41 +116,89 @@ seginit(void)
   lgdt((void*) gdt, 8 * sizeof(uint64));
 
   ltr(SEG_TSS << 3);
+
+  // Tag TLB entries with PCIDs if we can (see switchuvm).
+  // %cr3 holds kpml4 with PCID 0 here, as CR4.PCIDE requires.
+  if (featuresExt & CPUID_LEAF_1_PCID) {
+    lcr4(rcr4() | CR4_PCIDE);
+    c->pcid = 1;
+  }
 };
 
-// The core xv6 code only knows about two levels of page tables,
-// so we will create all four, but only return the second level.
-// because we need to find the other levels later, we'll stash
-// backpointers to them in the top two entries of the level two
-// table.
+// A process's page table is a whole PML4.  The lower half,
+// below USERTOP, is the user's 47-bit address space; walkpgdir
+// in vm.c fills in its PDPTs and page directories on demand.
+// The upper half shares the kernel's PDPTs.
 pde_t*
 setupkvm(void)
 {
-  pde_t *pml4 = (pde_t*) kalloc();
-  pde_t *pdpt = (pde_t*) kalloc();
-  pde_t *pgdir = (pde_t*) kalloc();
+  pde_t *pml4 = pgtalloc();
 
-  memset(pml4, 0, PGSIZE);
-  memset(pdpt, 0, PGSIZE);
-  memset(pgdir, 0, PGSIZE);
+  if (pml4 == 0)
+    return 0;
   pml4[511] = v2p(kpdpt) | PTE_P | PTE_W | PTE_U;
-  pml4[0] = v2p(pdpt) | PTE_P | PTE_W | PTE_U;
-  pdpt[0] = v2p(pgdir) | PTE_P | PTE_W | PTE_U; 
+  pml4[PML4X(PHYSBASE)] = v2p(kphyspdpt) | PTE_P | PTE_W;
+  return pml4;
+};
+
+// How many bytes of [pa, pa+len) lie in usable RAM?
+static uintp
+ramsize(uintp pa, uintp len)
+{
+  uintp start, end, n;
+  int i;
 
-  // virtual backpointers
-  pgdir[511] = ((uintp) pml4) | PTE_P;
-  pgdir[510] = ((uintp) pdpt) | PTE_P;
+  n = 0;
+  for(i = 0; e820range(i, &start, &end); i++){
+    if(start < pa)
+      start = pa;
+    if(end > pa + len)
+      end = pa + len;
+    if(start < end)
+      n += end - start;
+  }
+  return n;
+}
 
-  return pgdir;
-};
+// Return the direct map's page directory entry for the 2MB at pa.
+// Usable RAM is mapped write-back.  The holes between the E820
+// ranges may be device memory, so they are mapped uncached, like
+// iopgdir; the kernel still reads firmware tables (ACPI, MP) there.
+// A 2MB page that holds both gets a page table of 4KB pages.
+static pde_t
+physpde(uintp pa)
+{
+  pte_t *pt;
+  uintp a;
+  int n;
+
+  a = ramsize(pa, 1L << PDXSHIFT);
+  if (a >= 1L << PDXSHIFT)
+    return pa | PTE_PS | PTE_P | PTE_W;
+  if (a == 0)
+    return pa | PTE_PS | PTE_P | PTE_W | PTE_PWT | PTE_PCD;
+  if ((pt = (pte_t*) kalloc()) == 0)
+    panic("kvmalloc: direct map");
+  for (n = 0; n < NPTENTRIES; n++) {
+    a = pa + ((uintp)n << PTXSHIFT);
+    pt[n] = a | PTE_P | PTE_W;
+    if (ramsize(a, PGSIZE) < PGSIZE)
+      pt[n] |= PTE_PWT | PTE_PCD;
+  }
+  return v2p(pt) | PTE_P | PTE_W;
+}
 
 // Allocate one page table for the machine for the kernel address
 // space for scheduler processes.
 //
-// linear map the first 4GB of physical memory starting at 0xFFFFFFFF80000000
+// linear map the first 2GB of physical memory starting at 0xFFFFFFFF80000000
+// for the kernel image, and all of physical memory up to memtop
+// starting at PHYSBASE (the direct map, see p2v and physpde).
 void
 kvmalloc(void)
 {
+  pde_t *pd;
+  uintp pa;
   int n;
   kpml4 = (pde_t*) kalloc();
   kpdpt = (pde_t*) kalloc();
@@ -163,32 +213,121 @@ kvmalloc(void)
   kpdpt[510] = v2p(kpgdir0) | PTE_P | PTE_W;
   kpdpt[509] = v2p(iopgdir) | PTE_P | PTE_W;
   for (n = 0; n < NPDENTRIES; n++) {
-    kpgdir0[n] = (n << PDXSHIFT) | PTE_PS | PTE_P | PTE_W;
-    kpgdir1[n] = ((n + 512) << PDXSHIFT) | PTE_PS | PTE_P | PTE_W;
+    kpgdir0[n] = physpde((uintp)n << PDXSHIFT);
+    kpgdir1[n] = physpde((uintp)(n + 512) << PDXSHIFT);
   }
   for (n = 0; n < 16; n++)
     iopgdir[n] = (DEVSPACE + (n << PDXSHIFT)) | PTE_PS | PTE_P | PTE_W | PTE_PWT | PTE_PCD;
+
+  // One page directory of 2MB pages per GB of the direct map.
+  kphyspdpt = (pde_t*) kalloc();
+  memset(kphyspdpt, 0, PGSIZE);
+  kpml4[PML4X(PHYSBASE)] = v2p(kphyspdpt) | PTE_P | PTE_W;
+  for (pa = 0; pa < memtop; pa += 1L << PDPTXSHIFT) {
+    if ((pd = (pde_t*) kalloc()) == 0)
+      panic("kvmalloc: direct map");
+    for (n = 0; n < NPDENTRIES; n++)
+      pd[n] = physpde(pa + ((uintp)n << PDXSHIFT));
+    kphyspdpt[PDPTX(pa)] = v2p(pd) | PTE_P | PTE_W;
+  }
   switchkvm();
 }
 
+// Switch to the kernel-only page table.  With PCIDs, this
+// does not flush the TLB: the kernel uses PCID 0, and user
+// entries stay cached under their own PCIDs.  (Called before
+// seginit() sets up cpu, so it checks %cr4 instead.)
 void
 switchkvm(void)
 {
-  lcr3(v2p(kpml4));
+  lcr3(v2p(kpml4) | ((rcr4() & CR4_PCIDE) ? CR3_NOFLUSH : 0));
 }
 
+// Each process's page table has an address space id (p->asid)
+// that changes whenever the page table changes in a way that
+// could leave stale TLB entries behind (see newasid).  With
+// PCIDs, each CPU lends its PCIDs 1..NPCID to the asids it ran
+// most recently.  Switching to an asid that still holds a PCID
+// keeps the entries cached under it; otherwise the least
+// recently assigned PCID is taken over and flushed.
 void
 switchuvm(struct proc *p)
 {
-  void *pml4;
   uint *tss;
+  uintp cr3;
+  int i;
+
   pushcli();
   if(p->pgdir == 0)
     panic("switchuvm: no pgdir");
   tss = (uint*) (((char*) cpu->local) + 1024);
   tss_set_rsp(tss, 0, (uintp)proc->kstack + KSTACKSIZE);
-  pml4 = (void*) PTE_ADDR(p->pgdir[511]);
-  lcr3(v2p(pml4));
+  if (cpu->loaded == p->asid && PTE_ADDR(rcr3()) == v2p(p->pgdir)) {
+    cpu->nskip++;
+    popcli();
+    return;
+  }
+  cr3 = v2p(p->pgdir);
+  if (cpu->pcid) {
+    for (i = 0; i < NPCID; i++)
+      if (cpu->pcidasid[i] == p->asid)
+        break;
+    if (i < NPCID) {
+      cr3 |= (i + 1) | CR3_NOFLUSH;
+      cpu->nkeep++;
+    } else {
+      i = cpu->pcidnext++ % NPCID;
+      cpu->pcidasid[i] = p->asid;
+      cr3 |= i + 1;
+      cpu->nflush++;
+    }
+  } else
+    cpu->nflush++;
+  lcr3(cr3);
+  cpu->loaded = p->asid;
+  cpu->uvm = p->pgdir;
   popcli();
 }
 
+// Give p's page table a new asid, so that no CPU will use TLB
+// entries it cached for the old contents.  If keep is set, the
+// caller has already invalidated the changed entries on this
+// CPU (with invlpg), so the rest can stay in use here.
+void
+newasid(struct proc *p, int keep)
+{
+  static uint64 nextasid;
+  uint64 old;
+  int i;
+
+  old = p->asid;
+  p->asid = __sync_add_and_fetch(&nextasid, 1);
+  if (!keep)
+    return;
+  pushcli();
+  if (cpu->loaded == old) {
+    cpu->loaded = p->asid;
+    for (i = 0; i < NPCID; i++)
+      if (cpu->pcidasid[i] == old)
+        cpu->pcidasid[i] = p->asid;
+  }
+  popcli();
+}
+
+// Print how often each CPU had to flush its TLB when it
+// switched address spaces, and its TLB shootdowns.
+// For debugging; no locking.
+void
+tlbdump(void)
+{
+  int i;
+
+  for (i = 0; i < ncpu; i++) {
+    cprintf("cpu%d: %s, uvm switch flush %d keep %d skip %d\n",
+            i, cpus[i].pcid ? "pcid" : "no pcid",
+            cpus[i].nflush, cpus[i].nkeep, cpus[i].nskip);
+    cprintf("cpu%d: shootdown ipi %d batched %d avoided %d\n",
+            i, cpus[i].ntlbsent, cpus[i].ntlbbatch, cpus[i].ntlbavoid);
+  }
+}
+
@@ -0,0 +1,181 @@
+
+out/bootblock.o:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+    7c00:	fa                   	cli
+    7c01:	31 c0                	xor    %eax,%eax
+    7c03:	8e d8                	mov    %eax,%ds
+    7c05:	8e c0                	mov    %eax,%es
+    7c07:	8e d0                	mov    %eax,%ss
+
+00007c09 <seta20.1>:
+    7c09:	e4 64                	in     $0x64,%al
+    7c0b:	a8 02                	test   $0x2,%al
+    7c0d:	75 fa                	jne    7c09 <seta20.1>
+    7c0f:	b0 d1                	mov    $0xd1,%al
+    7c11:	e6 64                	out    %al,$0x64
+
+00007c13 <seta20.2>:
+    7c13:	e4 64                	in     $0x64,%al
+    7c15:	a8 02                	test   $0x2,%al
+    7c17:	75 fa                	jne    7c13 <seta20.2>
+    7c19:	b0 df                	mov    $0xdf,%al
+    7c1b:	e6 60                	out    %al,$0x60
+    7c1d:	0f 01 16             	lgdtl  (%esi)
+    7c20:	68 7c 0f 20 c0       	push   $0xc0200f7c
+    7c25:	66 83 c8 01          	or     $0x1,%ax
+    7c29:	0f 22 c0             	mov    %eax,%cr0
+    7c2c:	ea                   	.byte 0xea
+    7c2d:	31 7c 08 00          	xor    %edi,0x0(%eax,%ecx,1)
+
+00007c31 <start32>:
+    7c31:	66 b8 10 00          	mov    $0x10,%ax
+    7c35:	8e d8                	mov    %eax,%ds
+    7c37:	8e c0                	mov    %eax,%es
+    7c39:	8e d0                	mov    %eax,%ss
+    7c3b:	66 b8 00 00          	mov    $0x0,%ax
+    7c3f:	8e e0                	mov    %eax,%fs
+    7c41:	8e e8                	mov    %eax,%gs
+    7c43:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+    7c48:	e8 bb 00 00 00       	call   7d08 <bootmain>
+
+00007c4d <spin>:
+    7c4d:	eb fe                	jmp    7c4d <spin>
+    7c4f:	90                   	nop
+
+00007c50 <gdt>:
+	...
+    7c58:	ff                   	(bad)
+    7c59:	ff 00                	incl   (%eax)
+    7c5b:	00 00                	add    %al,(%eax)
+    7c5d:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7c64:	00                   	.byte 0x0
+    7c65:	92                   	xchg   %eax,%edx
+    7c66:	cf                   	iret
+	...
+
+00007c68 <gdtdesc>:
+    7c68:	17                   	pop    %ss
+    7c69:	00 50 7c             	add    %dl,0x7c(%eax)
+	...
+
+00007c6e <readseg>:
+    7c6e:	55                   	push   %ebp
+    7c6f:	89 e5                	mov    %esp,%ebp
+    7c71:	57                   	push   %edi
+    7c72:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+    7c75:	89 ca                	mov    %ecx,%edx
+    7c77:	56                   	push   %esi
+    7c78:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+    7c7e:	c1 e9 09             	shr    $0x9,%ecx
+    7c81:	53                   	push   %ebx
+    7c82:	29 d0                	sub    %edx,%eax
+    7c84:	8d 71 01             	lea    0x1(%ecx),%esi
+    7c87:	53                   	push   %ebx
+    7c88:	89 c3                	mov    %eax,%ebx
+    7c8a:	89 7d f0             	mov    %edi,-0x10(%ebp)
+    7c8d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    7c90:	39 c3                	cmp    %eax,%ebx
+    7c92:	73 6e                	jae    7d02 <readseg+0x94>
+    7c94:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7c99:	ec                   	in     (%dx),%al
+    7c9a:	83 e0 c0             	and    $0xffffffc0,%eax
+    7c9d:	3c 40                	cmp    $0x40,%al
+    7c9f:	75 f3                	jne    7c94 <readseg+0x26>
+    7ca1:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7ca6:	b0 01                	mov    $0x1,%al
+    7ca8:	ee                   	out    %al,(%dx)
+    7ca9:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7cae:	89 f0                	mov    %esi,%eax
+    7cb0:	ee                   	out    %al,(%dx)
+    7cb1:	89 f0                	mov    %esi,%eax
+    7cb3:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7cb8:	c1 e8 08             	shr    $0x8,%eax
+    7cbb:	ee                   	out    %al,(%dx)
+    7cbc:	89 f0                	mov    %esi,%eax
+    7cbe:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7cc3:	c1 e8 10             	shr    $0x10,%eax
+    7cc6:	ee                   	out    %al,(%dx)
+    7cc7:	89 f0                	mov    %esi,%eax
+    7cc9:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7cce:	c1 e8 18             	shr    $0x18,%eax
+    7cd1:	83 c8 e0             	or     $0xffffffe0,%eax
+    7cd4:	ee                   	out    %al,(%dx)
+    7cd5:	b0 20                	mov    $0x20,%al
+    7cd7:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cdc:	ee                   	out    %al,(%dx)
+    7cdd:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7ce2:	ec                   	in     (%dx),%al
+    7ce3:	83 e0 c0             	and    $0xffffffc0,%eax
+    7ce6:	3c 40                	cmp    $0x40,%al
+    7ce8:	75 f3                	jne    7cdd <readseg+0x6f>
+    7cea:	89 df                	mov    %ebx,%edi
+    7cec:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7cf1:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7cf6:	fc                   	cld
+    7cf7:	f3 6d                	rep insl (%dx),%es:(%edi)
+    7cf9:	81 c3 00 02 00 00    	add    $0x200,%ebx
+    7cff:	46                   	inc    %esi
+    7d00:	eb 8b                	jmp    7c8d <readseg+0x1f>
+    7d02:	58                   	pop    %eax
+    7d03:	5b                   	pop    %ebx
+    7d04:	5e                   	pop    %esi
+    7d05:	5f                   	pop    %edi
+    7d06:	5d                   	pop    %ebp
+    7d07:	c3                   	ret
+
+00007d08 <bootmain>:
+    7d08:	55                   	push   %ebp
+    7d09:	31 c9                	xor    %ecx,%ecx
+    7d0b:	ba 00 20 00 00       	mov    $0x2000,%edx
+    7d10:	b8 00 00 01 00       	mov    $0x10000,%eax
+    7d15:	89 e5                	mov    %esp,%ebp
+    7d17:	57                   	push   %edi
+    7d18:	53                   	push   %ebx
+    7d19:	bb 00 00 01 00       	mov    $0x10000,%ebx
+    7d1e:	e8 4b ff ff ff       	call   7c6e <readseg>
+    7d23:	81 3b 02 b0 ad 1b    	cmpl   $0x1badb002,(%ebx)
+    7d29:	75 18                	jne    7d43 <bootmain+0x3b>
+    7d2b:	8b 43 04             	mov    0x4(%ebx),%eax
+    7d2e:	8b 53 08             	mov    0x8(%ebx),%edx
+    7d31:	01 c2                	add    %eax,%edx
+    7d33:	81 fa fe 4f 52 e4    	cmp    $0xe4524ffe,%edx
+    7d39:	75 08                	jne    7d43 <bootmain+0x3b>
+    7d3b:	0f ba e0 10          	bt     $0x10,%eax
+    7d3f:	72 0f                	jb     7d50 <bootmain+0x48>
+    7d41:	eb 47                	jmp    7d8a <bootmain+0x82>
+    7d43:	83 c3 04             	add    $0x4,%ebx
+    7d46:	81 fb 00 20 01 00    	cmp    $0x12000,%ebx
+    7d4c:	75 d5                	jne    7d23 <bootmain+0x1b>
+    7d4e:	eb 3a                	jmp    7d8a <bootmain+0x82>
+    7d50:	8b 43 10             	mov    0x10(%ebx),%eax
+    7d53:	8b 7b 0c             	mov    0xc(%ebx),%edi
+    7d56:	39 c7                	cmp    %eax,%edi
+    7d58:	72 30                	jb     7d8a <bootmain+0x82>
+    7d5a:	8b 53 14             	mov    0x14(%ebx),%edx
+    7d5d:	39 c2                	cmp    %eax,%edx
+    7d5f:	72 29                	jb     7d8a <bootmain+0x82>
+    7d61:	8d 8c 03 00 00 ff ff 	lea    -0x10000(%ebx,%eax,1),%ecx
+    7d68:	29 c2                	sub    %eax,%edx
+    7d6a:	29 f9                	sub    %edi,%ecx
+    7d6c:	e8 fd fe ff ff       	call   7c6e <readseg>
+    7d71:	8b 4b 18             	mov    0x18(%ebx),%ecx
+    7d74:	8b 7b 14             	mov    0x14(%ebx),%edi
+    7d77:	39 cf                	cmp    %ecx,%edi
+    7d79:	73 07                	jae    7d82 <bootmain+0x7a>
+    7d7b:	29 f9                	sub    %edi,%ecx
+    7d7d:	31 c0                	xor    %eax,%eax
+    7d7f:	fc                   	cld
+    7d80:	f3 aa                	rep stos %al,%es:(%edi)
+    7d82:	8b 43 1c             	mov    0x1c(%ebx),%eax
+    7d85:	5b                   	pop    %ebx
+    7d86:	5f                   	pop    %edi
+    7d87:	5d                   	pop    %ebp
+    7d88:	ff e0                	jmp    *%eax
+    7d8a:	5b                   	pop    %ebx
+    7d8b:	5f                   	pop    %edi
+    7d8c:	5d                   	pop    %ebp
+    7d8d:	c3                   	ret
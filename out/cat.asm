@@ -0,0 +1,951 @@
+
+.fs/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	41 55                	push   %r13
+   6:	41 54                	push   %r12
+   8:	53                   	push   %rbx
+   9:	50                   	push   %rax
+  int fd, i;
+
+  if(argc <= 1){
+   a:	83 ff 01             	cmp    $0x1,%edi
+   d:	7f 09                	jg     18 <main+0x18>
+    cat(0);
+   f:	31 ff                	xor    %edi,%edi
+  11:	e8 54 00 00 00       	call   6a <cat>
+    exit();
+  16:	eb 33                	jmp    4b <main+0x4b>
+  18:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  1b:	48 8d 5e 08          	lea    0x8(%rsi),%rbx
+  1f:	4c 8d 6c c6 10       	lea    0x10(%rsi,%rax,8),%r13
+  }
+
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+  24:	48 8b 3b             	mov    (%rbx),%rdi
+  27:	31 f6                	xor    %esi,%esi
+  29:	e8 0c 02 00 00       	call   23a <open>
+  2e:	41 89 c4             	mov    %eax,%r12d
+  31:	85 c0                	test   %eax,%eax
+  33:	79 1b                	jns    50 <main+0x50>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  35:	48 8b 13             	mov    (%rbx),%rdx
+  38:	48 c7 c6 31 06 00 00 	mov    $0x631,%rsi
+  3f:	bf 01 00 00 00       	mov    $0x1,%edi
+  44:	31 c0                	xor    %eax,%eax
+  46:	e8 d8 02 00 00       	call   323 <printf>
+      exit();
+  4b:	e8 aa 01 00 00       	call   1fa <exit>
+    }
+    cat(fd);
+  50:	89 c7                	mov    %eax,%edi
+  for(i = 1; i < argc; i++){
+  52:	48 83 c3 08          	add    $0x8,%rbx
+    cat(fd);
+  56:	e8 0f 00 00 00       	call   6a <cat>
+    close(fd);
+  5b:	44 89 e7             	mov    %r12d,%edi
+  5e:	e8 bf 01 00 00       	call   222 <close>
+  for(i = 1; i < argc; i++){
+  63:	4c 39 eb             	cmp    %r13,%rbx
+  66:	75 bc                	jne    24 <main+0x24>
+  68:	eb e1                	jmp    4b <main+0x4b>
+
+000000000000006a <cat>:
+{
+  6a:	55                   	push   %rbp
+  6b:	48 89 e5             	mov    %rsp,%rbp
+  6e:	53                   	push   %rbx
+  6f:	89 fb                	mov    %edi,%ebx
+  71:	52                   	push   %rdx
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  72:	ba 00 02 00 00       	mov    $0x200,%edx
+  77:	48 c7 c6 60 08 00 00 	mov    $0x860,%rsi
+  7e:	89 df                	mov    %ebx,%edi
+  80:	e8 8d 01 00 00       	call   212 <read>
+  85:	89 c2                	mov    %eax,%edx
+  87:	85 c0                	test   %eax,%eax
+  89:	7e 13                	jle    9e <cat+0x34>
+    write(1, buf, n);
+  8b:	48 c7 c6 60 08 00 00 	mov    $0x860,%rsi
+  92:	bf 01 00 00 00       	mov    $0x1,%edi
+  97:	e8 7e 01 00 00       	call   21a <write>
+  9c:	eb d4                	jmp    72 <cat+0x8>
+  if(n < 0){
+  9e:	74 18                	je     b8 <cat+0x4e>
+    printf(1, "cat: read error\n");
+  a0:	48 c7 c6 20 06 00 00 	mov    $0x620,%rsi
+  a7:	bf 01 00 00 00       	mov    $0x1,%edi
+  ac:	31 c0                	xor    %eax,%eax
+  ae:	e8 70 02 00 00       	call   323 <printf>
+    exit();
+  b3:	e8 42 01 00 00       	call   1fa <exit>
+}
+  b8:	58                   	pop    %rax
+  b9:	5b                   	pop    %rbx
+  ba:	5d                   	pop    %rbp
+  bb:	c3                   	ret
+
+00000000000000bc <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  bc:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  bf:	31 d2                	xor    %edx,%edx
+  c1:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+  c4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  c7:	48 ff c2             	inc    %rdx
+  ca:	84 c9                	test   %cl,%cl
+  cc:	75 f3                	jne    c1 <strcpy+0x5>
+    ;
+  return os;
+}
+  ce:	c3                   	ret
+
+00000000000000cf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+  cf:	31 c9                	xor    %ecx,%ecx
+  d1:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+  d5:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+  d9:	84 c0                	test   %al,%al
+  db:	74 07                	je     e4 <strcmp+0x15>
+  dd:	48 ff c1             	inc    %rcx
+  e0:	38 d0                	cmp    %dl,%al
+  e2:	74 ed                	je     d1 <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+  e4:	29 d0                	sub    %edx,%eax
+}
+  e6:	c3                   	ret
+
+00000000000000e7 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+  e7:	31 d2                	xor    %edx,%edx
+  e9:	48 89 d0             	mov    %rdx,%rax
+  ec:	48 ff c2             	inc    %rdx
+  ef:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  f4:	75 f3                	jne    e9 <strlen+0x2>
+    ;
+  return n;
+}
+  f6:	c3                   	ret
+
+00000000000000f7 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f7:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  fa:	89 d1                	mov    %edx,%ecx
+  fc:	89 f0                	mov    %esi,%eax
+  fe:	fc                   	cld
+  ff:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 101:	4c 89 c0             	mov    %r8,%rax
+ 104:	c3                   	ret
+
+0000000000000105 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+ 105:	48 89 f8             	mov    %rdi,%rax
+ 108:	8a 10                	mov    (%rax),%dl
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	74 0a                	je     118 <strchr+0x13>
+    if(*s == c)
+ 10e:	40 38 f2             	cmp    %sil,%dl
+ 111:	74 07                	je     11a <strchr+0x15>
+  for(; *s; s++)
+ 113:	48 ff c0             	inc    %rax
+ 116:	eb f0                	jmp    108 <strchr+0x3>
+      return (char*)s;
+  return 0;
+ 118:	31 c0                	xor    %eax,%eax
+}
+ 11a:	c3                   	ret
+
+000000000000011b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 11b:	55                   	push   %rbp
+ 11c:	48 89 e5             	mov    %rsp,%rbp
+ 11f:	41 56                	push   %r14
+ 121:	41 89 f6             	mov    %esi,%r14d
+ 124:	41 55                	push   %r13
+ 126:	41 54                	push   %r12
+ 128:	49 89 fc             	mov    %rdi,%r12
+ 12b:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 12c:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+ 131:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+ 135:	41 89 dd             	mov    %ebx,%r13d
+ 138:	44 39 f3             	cmp    %r14d,%ebx
+ 13b:	7d 29                	jge    166 <gets+0x4b>
+    cc = read(0, &c, 1);
+ 13d:	31 ff                	xor    %edi,%edi
+ 13f:	ba 01 00 00 00       	mov    $0x1,%edx
+ 144:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 148:	e8 c5 00 00 00       	call   212 <read>
+    if(cc < 1)
+ 14d:	85 c0                	test   %eax,%eax
+ 14f:	7e 15                	jle    166 <gets+0x4b>
+      break;
+    buf[i++] = c;
+ 151:	8a 45 df             	mov    -0x21(%rbp),%al
+ 154:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+ 159:	48 ff c3             	inc    %rbx
+ 15c:	3c 0a                	cmp    $0xa,%al
+ 15e:	74 0a                	je     16a <gets+0x4f>
+ 160:	3c 0d                	cmp    $0xd,%al
+ 162:	75 d1                	jne    135 <gets+0x1a>
+ 164:	eb 04                	jmp    16a <gets+0x4f>
+ 166:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 16a:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 16d:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 170:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 175:	5a                   	pop    %rdx
+ 176:	59                   	pop    %rcx
+ 177:	5b                   	pop    %rbx
+ 178:	41 5c                	pop    %r12
+ 17a:	41 5d                	pop    %r13
+ 17c:	41 5e                	pop    %r14
+ 17e:	5d                   	pop    %rbp
+ 17f:	c3                   	ret
+
+0000000000000180 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 180:	55                   	push   %rbp
+ 181:	48 89 e5             	mov    %rsp,%rbp
+ 184:	41 55                	push   %r13
+ 186:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 189:	31 f6                	xor    %esi,%esi
+{
+ 18b:	41 54                	push   %r12
+ 18d:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 191:	53                   	push   %rbx
+ 192:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 193:	e8 a2 00 00 00       	call   23a <open>
+  if(fd < 0)
+ 198:	85 c0                	test   %eax,%eax
+ 19a:	78 16                	js     1b2 <stat+0x32>
+ 19c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 19e:	89 c7                	mov    %eax,%edi
+ 1a0:	4c 89 ee             	mov    %r13,%rsi
+ 1a3:	e8 aa 00 00 00       	call   252 <fstat>
+  close(fd);
+ 1a8:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 1aa:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 1ad:	e8 70 00 00 00       	call   222 <close>
+  return r;
+}
+ 1b2:	5a                   	pop    %rdx
+ 1b3:	44 89 e0             	mov    %r12d,%eax
+ 1b6:	5b                   	pop    %rbx
+ 1b7:	41 5c                	pop    %r12
+ 1b9:	41 5d                	pop    %r13
+ 1bb:	5d                   	pop    %rbp
+ 1bc:	c3                   	ret
+
+00000000000001bd <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 1bd:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 1bf:	0f be 17             	movsbl (%rdi),%edx
+ 1c2:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 1c5:	80 f9 09             	cmp    $0x9,%cl
+ 1c8:	77 0c                	ja     1d6 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 1ca:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 1cd:	48 ff c7             	inc    %rdi
+ 1d0:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 1d4:	eb e9                	jmp    1bf <atoi+0x2>
+  return n;
+}
+ 1d6:	c3                   	ret
+
+00000000000001d7 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 1d7:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1da:	31 c9                	xor    %ecx,%ecx
+ 1dc:	89 d7                	mov    %edx,%edi
+ 1de:	29 cf                	sub    %ecx,%edi
+ 1e0:	85 ff                	test   %edi,%edi
+ 1e2:	7e 0d                	jle    1f1 <memmove+0x1a>
+    *dst++ = *src++;
+ 1e4:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 1e8:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 1ec:	48 ff c1             	inc    %rcx
+ 1ef:	eb eb                	jmp    1dc <memmove+0x5>
+  return vdst;
+}
+ 1f1:	c3                   	ret
+
+00000000000001f2 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 1f2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1f7:	cd 40                	int    $0x40
+ 1f9:	c3                   	ret
+
+00000000000001fa <exit>:
+SYSCALL(exit)
+ 1fa:	b8 02 00 00 00       	mov    $0x2,%eax
+ 1ff:	cd 40                	int    $0x40
+ 201:	c3                   	ret
+
+0000000000000202 <wait>:
+SYSCALL(wait)
+ 202:	b8 03 00 00 00       	mov    $0x3,%eax
+ 207:	cd 40                	int    $0x40
+ 209:	c3                   	ret
+
+000000000000020a <pipe>:
+SYSCALL(pipe)
+ 20a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 20f:	cd 40                	int    $0x40
+ 211:	c3                   	ret
+
+0000000000000212 <read>:
+SYSCALL(read)
+ 212:	b8 05 00 00 00       	mov    $0x5,%eax
+ 217:	cd 40                	int    $0x40
+ 219:	c3                   	ret
+
+000000000000021a <write>:
+SYSCALL(write)
+ 21a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 21f:	cd 40                	int    $0x40
+ 221:	c3                   	ret
+
+0000000000000222 <close>:
+SYSCALL(close)
+ 222:	b8 15 00 00 00       	mov    $0x15,%eax
+ 227:	cd 40                	int    $0x40
+ 229:	c3                   	ret
+
+000000000000022a <kill>:
+SYSCALL(kill)
+ 22a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 22f:	cd 40                	int    $0x40
+ 231:	c3                   	ret
+
+0000000000000232 <exec>:
+SYSCALL(exec)
+ 232:	b8 07 00 00 00       	mov    $0x7,%eax
+ 237:	cd 40                	int    $0x40
+ 239:	c3                   	ret
+
+000000000000023a <open>:
+SYSCALL(open)
+ 23a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 23f:	cd 40                	int    $0x40
+ 241:	c3                   	ret
+
+0000000000000242 <mknod>:
+SYSCALL(mknod)
+ 242:	b8 11 00 00 00       	mov    $0x11,%eax
+ 247:	cd 40                	int    $0x40
+ 249:	c3                   	ret
+
+000000000000024a <unlink>:
+SYSCALL(unlink)
+ 24a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 24f:	cd 40                	int    $0x40
+ 251:	c3                   	ret
+
+0000000000000252 <fstat>:
+SYSCALL(fstat)
+ 252:	b8 08 00 00 00       	mov    $0x8,%eax
+ 257:	cd 40                	int    $0x40
+ 259:	c3                   	ret
+
+000000000000025a <link>:
+SYSCALL(link)
+ 25a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 25f:	cd 40                	int    $0x40
+ 261:	c3                   	ret
+
+0000000000000262 <mkdir>:
+SYSCALL(mkdir)
+ 262:	b8 14 00 00 00       	mov    $0x14,%eax
+ 267:	cd 40                	int    $0x40
+ 269:	c3                   	ret
+
+000000000000026a <chdir>:
+SYSCALL(chdir)
+ 26a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 26f:	cd 40                	int    $0x40
+ 271:	c3                   	ret
+
+0000000000000272 <dup>:
+SYSCALL(dup)
+ 272:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 277:	cd 40                	int    $0x40
+ 279:	c3                   	ret
+
+000000000000027a <getpid>:
+SYSCALL(getpid)
+ 27a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 27f:	cd 40                	int    $0x40
+ 281:	c3                   	ret
+
+0000000000000282 <sbrk>:
+SYSCALL(sbrk)
+ 282:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 287:	cd 40                	int    $0x40
+ 289:	c3                   	ret
+
+000000000000028a <sleep>:
+SYSCALL(sleep)
+ 28a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 28f:	cd 40                	int    $0x40
+ 291:	c3                   	ret
+
+0000000000000292 <uptime>:
+SYSCALL(uptime)
+ 292:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 297:	cd 40                	int    $0x40
+ 299:	c3                   	ret
+
+000000000000029a <chmod>:
+SYSCALL(chmod)
+ 29a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 29f:	cd 40                	int    $0x40
+ 2a1:	c3                   	ret
+
+00000000000002a2 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 2a2:	55                   	push   %rbp
+ 2a3:	48 89 e5             	mov    %rsp,%rbp
+ 2a6:	41 54                	push   %r12
+ 2a8:	41 89 fc             	mov    %edi,%r12d
+ 2ab:	89 d7                	mov    %edx,%edi
+ 2ad:	53                   	push   %rbx
+ 2ae:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 2b2:	85 f6                	test   %esi,%esi
+ 2b4:	79 0f                	jns    2c5 <printint+0x23>
+ 2b6:	80 e1 01             	and    $0x1,%cl
+ 2b9:	74 0a                	je     2c5 <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 2bb:	f7 de                	neg    %esi
+    neg = 1;
+ 2bd:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 2c3:	eb 03                	jmp    2c8 <printint+0x26>
+  neg = 0;
+ 2c5:	45 31 c0             	xor    %r8d,%r8d
+ 2c8:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 2ca:	89 f0                	mov    %esi,%eax
+ 2cc:	31 d2                	xor    %edx,%edx
+ 2ce:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 2d1:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 2d4:	f7 f7                	div    %edi
+ 2d6:	8a 92 50 06 00 00    	mov    0x650(%rdx),%dl
+ 2dc:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 2e0:	89 f2                	mov    %esi,%edx
+ 2e2:	89 c6                	mov    %eax,%esi
+ 2e4:	39 fa                	cmp    %edi,%edx
+ 2e6:	73 e2                	jae    2ca <printint+0x28>
+  if(neg)
+ 2e8:	45 85 c0             	test   %r8d,%r8d
+ 2eb:	74 0a                	je     2f7 <printint+0x55>
+    buf[i++] = digits[x % base];
+ 2ed:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 2ef:	48 63 c3             	movslq %ebx,%rax
+ 2f2:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 2f7:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 2fa:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 2fe:	ba 01 00 00 00       	mov    $0x1,%edx
+ 303:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 307:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 30a:	48 ff cb             	dec    %rbx
+ 30d:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 310:	e8 05 ff ff ff       	call   21a <write>
+  while(--i >= 0)
+ 315:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 318:	75 e0                	jne    2fa <printint+0x58>
+}
+ 31a:	48 83 c4 20          	add    $0x20,%rsp
+ 31e:	5b                   	pop    %rbx
+ 31f:	41 5c                	pop    %r12
+ 321:	5d                   	pop    %rbp
+ 322:	c3                   	ret
+
+0000000000000323 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 323:	55                   	push   %rbp
+ 324:	48 89 e5             	mov    %rsp,%rbp
+ 327:	41 55                	push   %r13
+ 329:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 32b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 32f:	53                   	push   %rbx
+ 330:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 334:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 338:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 33c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 340:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 344:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 348:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 34c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 350:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 352:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 359:	84 c0                	test   %al,%al
+ 35b:	0f 84 6f 01 00 00    	je     4d0 <printf+0x1ad>
+ 361:	89 fb                	mov    %edi,%ebx
+ 363:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 366:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 369:	83 fa 25             	cmp    $0x25,%edx
+ 36c:	75 44                	jne    3b2 <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 36e:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 373:	49 ff c4             	inc    %r12
+ 376:	45 84 ed             	test   %r13b,%r13b
+ 379:	0f 84 51 01 00 00    	je     4d0 <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 37f:	41 0f b6 c5          	movzbl %r13b,%eax
+ 383:	41 0f be d5          	movsbl %r13b,%edx
+ 387:	83 f8 64             	cmp    $0x64,%eax
+ 38a:	74 7c                	je     408 <printf+0xe5>
+ 38c:	7f 29                	jg     3b7 <printf+0x94>
+ 38e:	83 f8 25             	cmp    $0x25,%eax
+ 391:	74 4c                	je     3df <printf+0xbc>
+ 393:	83 f8 63             	cmp    $0x63,%eax
+ 396:	75 33                	jne    3cb <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 398:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 39b:	83 fa 2f             	cmp    $0x2f,%edx
+ 39e:	0f 87 1b 01 00 00    	ja     4bf <printf+0x19c>
+ 3a4:	89 d0                	mov    %edx,%eax
+ 3a6:	83 c2 08             	add    $0x8,%edx
+ 3a9:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3ad:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3b0:	8b 00                	mov    (%rax),%eax
+ 3b2:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 3b5:	eb 2c                	jmp    3e3 <printf+0xc0>
+ 3b7:	83 f8 73             	cmp    $0x73,%eax
+ 3ba:	0f 84 aa 00 00 00    	je     46a <printf+0x147>
+ 3c0:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 3c6:	83 fa 70             	cmp    $0x70,%edx
+ 3c9:	74 6b                	je     436 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 3cb:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 3cf:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3d4:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 3d8:	89 df                	mov    %ebx,%edi
+ 3da:	e8 3b fe ff ff       	call   21a <write>
+        putc(fd, c);
+ 3df:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 3e3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3e8:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 3ec:	89 df                	mov    %ebx,%edi
+ 3ee:	e8 27 fe ff ff       	call   21a <write>
+  for(i = 0; fmt[i]; i++){
+ 3f3:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 3f8:	49 ff c4             	inc    %r12
+ 3fb:	84 c0                	test   %al,%al
+ 3fd:	0f 85 63 ff ff ff    	jne    366 <printf+0x43>
+ 403:	e9 c8 00 00 00       	jmp    4d0 <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 408:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 40b:	83 fa 2f             	cmp    $0x2f,%edx
+ 40e:	77 0e                	ja     41e <printf+0xfb>
+ 410:	89 d0                	mov    %edx,%eax
+ 412:	83 c2 08             	add    $0x8,%edx
+ 415:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 419:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 41c:	eb 0c                	jmp    42a <printf+0x107>
+ 41e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 422:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 426:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 42a:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 42f:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 434:	eb 29                	jmp    45f <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 436:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 439:	83 fa 2f             	cmp    $0x2f,%edx
+ 43c:	77 0e                	ja     44c <printf+0x129>
+ 43e:	89 d0                	mov    %edx,%eax
+ 440:	83 c2 08             	add    $0x8,%edx
+ 443:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 447:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 44a:	eb 0c                	jmp    458 <printf+0x135>
+ 44c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 450:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 454:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 458:	31 c9                	xor    %ecx,%ecx
+ 45a:	ba 10 00 00 00       	mov    $0x10,%edx
+ 45f:	8b 30                	mov    (%rax),%esi
+ 461:	89 df                	mov    %ebx,%edi
+ 463:	e8 3a fe ff ff       	call   2a2 <printint>
+ 468:	eb 89                	jmp    3f3 <printf+0xd0>
+        s = va_arg(ap, char*);
+ 46a:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 46d:	83 fa 2f             	cmp    $0x2f,%edx
+ 470:	77 0e                	ja     480 <printf+0x15d>
+ 472:	89 d0                	mov    %edx,%eax
+ 474:	83 c2 08             	add    $0x8,%edx
+ 477:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 47b:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 47e:	eb 0c                	jmp    48c <printf+0x169>
+ 480:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 484:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 488:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 48c:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 48f:	4d 85 ed             	test   %r13,%r13
+ 492:	75 07                	jne    49b <printf+0x178>
+          s = "(null)";
+ 494:	49 c7 c5 46 06 00 00 	mov    $0x646,%r13
+        while(*s != 0){
+ 49b:	41 8a 45 00          	mov    0x0(%r13),%al
+ 49f:	84 c0                	test   %al,%al
+ 4a1:	0f 84 4c ff ff ff    	je     3f3 <printf+0xd0>
+          putc(fd, *s);
+ 4a7:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 4aa:	ba 01 00 00 00       	mov    $0x1,%edx
+ 4af:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 4b3:	89 df                	mov    %ebx,%edi
+          s++;
+ 4b5:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 4b8:	e8 5d fd ff ff       	call   21a <write>
+          s++;
+ 4bd:	eb dc                	jmp    49b <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 4bf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 4c3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4c7:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 4cb:	e9 e0 fe ff ff       	jmp    3b0 <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 4d0:	48 83 c4 58          	add    $0x58,%rsp
+ 4d4:	5b                   	pop    %rbx
+ 4d5:	41 5c                	pop    %r12
+ 4d7:	41 5d                	pop    %r13
+ 4d9:	5d                   	pop    %rbp
+ 4da:	c3                   	ret
+
+00000000000004db <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 4db:	48 8b 05 7e 05 00 00 	mov    0x57e(%rip),%rax        # a60 <freep>
+{
+ 4e2:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 4e5:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 4e9:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 4ec:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 4ef:	48 39 f2             	cmp    %rsi,%rdx
+ 4f2:	72 0c                	jb     500 <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 4f4:	48 39 c6             	cmp    %rax,%rsi
+ 4f7:	73 f0                	jae    4e9 <free+0xe>
+ 4f9:	48 39 c2             	cmp    %rax,%rdx
+ 4fc:	72 eb                	jb     4e9 <free+0xe>
+ 4fe:	eb 05                	jmp    505 <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 500:	48 39 c6             	cmp    %rax,%rsi
+ 503:	73 f4                	jae    4f9 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 505:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 508:	49 89 f8             	mov    %rdi,%r8
+ 50b:	48 c1 e7 04          	shl    $0x4,%rdi
+ 50f:	48 01 f7             	add    %rsi,%rdi
+ 512:	48 39 f8             	cmp    %rdi,%rax
+ 515:	75 0e                	jne    525 <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 517:	44 03 40 08          	add    0x8(%rax),%r8d
+ 51b:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 51f:	48 8b 02             	mov    (%rdx),%rax
+ 522:	48 8b 00             	mov    (%rax),%rax
+ 525:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 529:	8b 42 08             	mov    0x8(%rdx),%eax
+ 52c:	48 89 c7             	mov    %rax,%rdi
+ 52f:	48 c1 e0 04          	shl    $0x4,%rax
+ 533:	48 01 d0             	add    %rdx,%rax
+ 536:	48 39 c6             	cmp    %rax,%rsi
+ 539:	75 0a                	jne    545 <free+0x6a>
+    p->s.size += bp->s.size;
+ 53b:	03 79 f8             	add    -0x8(%rcx),%edi
+ 53e:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 541:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 545:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 548:	48 89 15 11 05 00 00 	mov    %rdx,0x511(%rip)        # a60 <freep>
+}
+ 54f:	c3                   	ret
+
+0000000000000550 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 550:	55                   	push   %rbp
+ 551:	48 89 e5             	mov    %rsp,%rbp
+ 554:	41 55                	push   %r13
+ 556:	41 54                	push   %r12
+ 558:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 559:	89 fb                	mov    %edi,%ebx
+{
+ 55b:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 55c:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 560:	48 8b 0d f9 04 00 00 	mov    0x4f9(%rip),%rcx        # a60 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 567:	48 c1 eb 04          	shr    $0x4,%rbx
+ 56b:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 56d:	48 85 c9             	test   %rcx,%rcx
+ 570:	75 25                	jne    597 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 572:	48 c7 05 e3 04 00 00 	movq   $0xa70,0x4e3(%rip)        # a60 <freep>
+ 579:	70 0a 00 00 
+    base.s.size = 0;
+ 57d:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 57f:	48 c7 05 e6 04 00 00 	movq   $0xa70,0x4e6(%rip)        # a70 <base>
+ 586:	70 0a 00 00 
+    base.s.size = 0;
+ 58a:	89 0d e8 04 00 00    	mov    %ecx,0x4e8(%rip)        # a78 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 590:	48 c7 c1 70 0a 00 00 	mov    $0xa70,%rcx
+  if(nu < 4096)
+ 597:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 59d:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 5a0:	44 39 e3             	cmp    %r12d,%ebx
+ 5a3:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 5a7:	45 89 e5             	mov    %r12d,%r13d
+ 5aa:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 5ae:	8b 50 08             	mov    0x8(%rax),%edx
+ 5b1:	39 da                	cmp    %ebx,%edx
+ 5b3:	72 26                	jb     5db <malloc+0x8b>
+      if(p->s.size == nunits)
+ 5b5:	75 08                	jne    5bf <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 5b7:	48 8b 10             	mov    (%rax),%rdx
+ 5ba:	48 89 11             	mov    %rdx,(%rcx)
+ 5bd:	eb 0f                	jmp    5ce <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 5bf:	29 da                	sub    %ebx,%edx
+ 5c1:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 5c4:	48 c1 e2 04          	shl    $0x4,%rdx
+ 5c8:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 5cb:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 5ce:	48 89 0d 8b 04 00 00 	mov    %rcx,0x48b(%rip)        # a60 <freep>
+      return (void*)(p + 1);
+ 5d5:	48 83 c0 10          	add    $0x10,%rax
+ 5d9:	eb 3a                	jmp    615 <malloc+0xc5>
+    }
+    if(p == freep)
+ 5db:	48 39 05 7e 04 00 00 	cmp    %rax,0x47e(%rip)        # a60 <freep>
+ 5e2:	75 27                	jne    60b <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 5e4:	44 89 ef             	mov    %r13d,%edi
+ 5e7:	e8 96 fc ff ff       	call   282 <sbrk>
+  if(p == (char*)-1)
+ 5ec:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 5f0:	74 21                	je     613 <malloc+0xc3>
+  hp->s.size = nu;
+ 5f2:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 5f6:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 5fa:	e8 dc fe ff ff       	call   4db <free>
+  return freep;
+ 5ff:	48 8b 05 5a 04 00 00 	mov    0x45a(%rip),%rax        # a60 <freep>
+      if((p = morecore(nunits)) == 0)
+ 606:	48 85 c0             	test   %rax,%rax
+ 609:	74 08                	je     613 <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 60b:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 60e:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 611:	eb 9b                	jmp    5ae <malloc+0x5e>
+        return 0;
+ 613:	31 c0                	xor    %eax,%eax
+  }
+}
+ 615:	5a                   	pop    %rdx
+ 616:	5b                   	pop    %rbx
+ 617:	41 5c                	pop    %r12
+ 619:	41 5d                	pop    %r13
+ 61b:	5d                   	pop    %rbp
+ 61c:	c3                   	ret
@@ -0,0 +1,946 @@
+
+.fs/chmod:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	41 56                	push   %r14
+   6:	41 55                	push   %r13
+   8:	41 54                	push   %r12
+   a:	53                   	push   %rbx
+   b:	48 83 ec 20          	sub    $0x20,%rsp
+  if (argc < 3) exit();
+   f:	83 ff 02             	cmp    $0x2,%edi
+  12:	7e 2e                	jle    42 <main+0x42>
+
+  int fd;
+  struct stat st;
+  int mode;
+
+  char *path = argv[2];
+  14:	4c 8b 6e 10          	mov    0x10(%rsi),%r13
+  18:	49 89 f6             	mov    %rsi,%r14
+  if ((fd = open(path, 0)) < 0) {
+  1b:	31 f6                	xor    %esi,%esi
+  1d:	4c 89 ef             	mov    %r13,%rdi
+  20:	e8 1f 02 00 00       	call   244 <open>
+  25:	41 89 c4             	mov    %eax,%r12d
+  28:	85 c0                	test   %eax,%eax
+  2a:	79 1b                	jns    47 <main+0x47>
+    printf(2, "chmod: cannot open %s\n", path);
+  2c:	4c 89 ea             	mov    %r13,%rdx
+  2f:	48 c7 c6 30 06 00 00 	mov    $0x630,%rsi
+  36:	bf 02 00 00 00       	mov    $0x2,%edi
+  3b:	31 c0                	xor    %eax,%eax
+  3d:	e8 eb 02 00 00       	call   32d <printf>
+    exit();
+  42:	e8 bd 01 00 00       	call   204 <exit>
+  }
+  if (fstat(fd, &st) < 0) {
+  47:	48 8d 75 c4          	lea    -0x3c(%rbp),%rsi
+  4b:	89 c7                	mov    %eax,%edi
+  4d:	e8 0a 02 00 00       	call   25c <fstat>
+  52:	85 c0                	test   %eax,%eax
+  54:	79 20                	jns    76 <main+0x76>
+    printf(2, "chmod: cannot stat %s\n", path);
+  56:	4c 89 ea             	mov    %r13,%rdx
+  59:	48 c7 c6 47 06 00 00 	mov    $0x647,%rsi
+  60:	bf 02 00 00 00       	mov    $0x2,%edi
+  65:	31 c0                	xor    %eax,%eax
+  67:	e8 c1 02 00 00       	call   32d <printf>
+    close(fd);
+  6c:	44 89 e7             	mov    %r12d,%edi
+  6f:	e8 b8 01 00 00       	call   22c <close>
+    exit();
+  74:	eb cc                	jmp    42 <main+0x42>
+  }
+  mode = st.mode;
+  close(fd);
+  76:	44 89 e7             	mov    %r12d,%edi
+  mode = st.mode;
+  79:	8b 5d d8             	mov    -0x28(%rbp),%ebx
+  close(fd);
+  7c:	e8 ab 01 00 00       	call   22c <close>
+
+  if (strcmp(argv[1], "-x") == 0)
+  81:	49 8b 7e 08          	mov    0x8(%r14),%rdi
+  85:	48 c7 c6 5e 06 00 00 	mov    $0x65e,%rsi
+  8c:	e8 48 00 00 00       	call   d9 <strcmp>
+  91:	85 c0                	test   %eax,%eax
+  93:	75 08                	jne    9d <main+0x9d>
+    chmod(path, 0x677 & mode);
+  95:	81 e3 77 06 00 00    	and    $0x677,%ebx
+  9b:	eb 1a                	jmp    b7 <main+0xb7>
+  else if (strcmp(argv[1], "+x") == 0)
+  9d:	49 8b 7e 08          	mov    0x8(%r14),%rdi
+  a1:	48 c7 c6 61 06 00 00 	mov    $0x661,%rsi
+  a8:	e8 2c 00 00 00       	call   d9 <strcmp>
+  ad:	85 c0                	test   %eax,%eax
+  af:	75 91                	jne    42 <main+0x42>
+    chmod(path, 0x777 & mode);
+  b1:	81 e3 77 07 00 00    	and    $0x777,%ebx
+  b7:	89 de                	mov    %ebx,%esi
+  b9:	4c 89 ef             	mov    %r13,%rdi
+  bc:	e8 e3 01 00 00       	call   2a4 <chmod>
+  c1:	e9 7c ff ff ff       	jmp    42 <main+0x42>
+
+00000000000000c6 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  c6:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  c9:	31 d2                	xor    %edx,%edx
+  cb:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+  ce:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  d1:	48 ff c2             	inc    %rdx
+  d4:	84 c9                	test   %cl,%cl
+  d6:	75 f3                	jne    cb <strcpy+0x5>
+    ;
+  return os;
+}
+  d8:	c3                   	ret
+
+00000000000000d9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+  d9:	31 c9                	xor    %ecx,%ecx
+  db:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+  df:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+  e3:	84 c0                	test   %al,%al
+  e5:	74 07                	je     ee <strcmp+0x15>
+  e7:	48 ff c1             	inc    %rcx
+  ea:	38 d0                	cmp    %dl,%al
+  ec:	74 ed                	je     db <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+  ee:	29 d0                	sub    %edx,%eax
+}
+  f0:	c3                   	ret
+
+00000000000000f1 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f1:	31 d2                	xor    %edx,%edx
+  f3:	48 89 d0             	mov    %rdx,%rax
+  f6:	48 ff c2             	inc    %rdx
+  f9:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  fe:	75 f3                	jne    f3 <strlen+0x2>
+    ;
+  return n;
+}
+ 100:	c3                   	ret
+
+0000000000000101 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 101:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 104:	89 d1                	mov    %edx,%ecx
+ 106:	89 f0                	mov    %esi,%eax
+ 108:	fc                   	cld
+ 109:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 10b:	4c 89 c0             	mov    %r8,%rax
+ 10e:	c3                   	ret
+
+000000000000010f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+ 10f:	48 89 f8             	mov    %rdi,%rax
+ 112:	8a 10                	mov    (%rax),%dl
+ 114:	84 d2                	test   %dl,%dl
+ 116:	74 0a                	je     122 <strchr+0x13>
+    if(*s == c)
+ 118:	40 38 f2             	cmp    %sil,%dl
+ 11b:	74 07                	je     124 <strchr+0x15>
+  for(; *s; s++)
+ 11d:	48 ff c0             	inc    %rax
+ 120:	eb f0                	jmp    112 <strchr+0x3>
+      return (char*)s;
+  return 0;
+ 122:	31 c0                	xor    %eax,%eax
+}
+ 124:	c3                   	ret
+
+0000000000000125 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 125:	55                   	push   %rbp
+ 126:	48 89 e5             	mov    %rsp,%rbp
+ 129:	41 56                	push   %r14
+ 12b:	41 89 f6             	mov    %esi,%r14d
+ 12e:	41 55                	push   %r13
+ 130:	41 54                	push   %r12
+ 132:	49 89 fc             	mov    %rdi,%r12
+ 135:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 136:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+ 13b:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+ 13f:	41 89 dd             	mov    %ebx,%r13d
+ 142:	44 39 f3             	cmp    %r14d,%ebx
+ 145:	7d 29                	jge    170 <gets+0x4b>
+    cc = read(0, &c, 1);
+ 147:	31 ff                	xor    %edi,%edi
+ 149:	ba 01 00 00 00       	mov    $0x1,%edx
+ 14e:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 152:	e8 c5 00 00 00       	call   21c <read>
+    if(cc < 1)
+ 157:	85 c0                	test   %eax,%eax
+ 159:	7e 15                	jle    170 <gets+0x4b>
+      break;
+    buf[i++] = c;
+ 15b:	8a 45 df             	mov    -0x21(%rbp),%al
+ 15e:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+ 163:	48 ff c3             	inc    %rbx
+ 166:	3c 0a                	cmp    $0xa,%al
+ 168:	74 0a                	je     174 <gets+0x4f>
+ 16a:	3c 0d                	cmp    $0xd,%al
+ 16c:	75 d1                	jne    13f <gets+0x1a>
+ 16e:	eb 04                	jmp    174 <gets+0x4f>
+ 170:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 174:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 177:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 17a:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 17f:	5a                   	pop    %rdx
+ 180:	59                   	pop    %rcx
+ 181:	5b                   	pop    %rbx
+ 182:	41 5c                	pop    %r12
+ 184:	41 5d                	pop    %r13
+ 186:	41 5e                	pop    %r14
+ 188:	5d                   	pop    %rbp
+ 189:	c3                   	ret
+
+000000000000018a <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 18a:	55                   	push   %rbp
+ 18b:	48 89 e5             	mov    %rsp,%rbp
+ 18e:	41 55                	push   %r13
+ 190:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 193:	31 f6                	xor    %esi,%esi
+{
+ 195:	41 54                	push   %r12
+ 197:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 19b:	53                   	push   %rbx
+ 19c:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 19d:	e8 a2 00 00 00       	call   244 <open>
+  if(fd < 0)
+ 1a2:	85 c0                	test   %eax,%eax
+ 1a4:	78 16                	js     1bc <stat+0x32>
+ 1a6:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1a8:	89 c7                	mov    %eax,%edi
+ 1aa:	4c 89 ee             	mov    %r13,%rsi
+ 1ad:	e8 aa 00 00 00       	call   25c <fstat>
+  close(fd);
+ 1b2:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 1b4:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 1b7:	e8 70 00 00 00       	call   22c <close>
+  return r;
+}
+ 1bc:	5a                   	pop    %rdx
+ 1bd:	44 89 e0             	mov    %r12d,%eax
+ 1c0:	5b                   	pop    %rbx
+ 1c1:	41 5c                	pop    %r12
+ 1c3:	41 5d                	pop    %r13
+ 1c5:	5d                   	pop    %rbp
+ 1c6:	c3                   	ret
+
+00000000000001c7 <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 1c7:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 1c9:	0f be 17             	movsbl (%rdi),%edx
+ 1cc:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 1cf:	80 f9 09             	cmp    $0x9,%cl
+ 1d2:	77 0c                	ja     1e0 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 1d4:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 1d7:	48 ff c7             	inc    %rdi
+ 1da:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 1de:	eb e9                	jmp    1c9 <atoi+0x2>
+  return n;
+}
+ 1e0:	c3                   	ret
+
+00000000000001e1 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 1e1:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1e4:	31 c9                	xor    %ecx,%ecx
+ 1e6:	89 d7                	mov    %edx,%edi
+ 1e8:	29 cf                	sub    %ecx,%edi
+ 1ea:	85 ff                	test   %edi,%edi
+ 1ec:	7e 0d                	jle    1fb <memmove+0x1a>
+    *dst++ = *src++;
+ 1ee:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 1f2:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 1f6:	48 ff c1             	inc    %rcx
+ 1f9:	eb eb                	jmp    1e6 <memmove+0x5>
+  return vdst;
+}
+ 1fb:	c3                   	ret
+
+00000000000001fc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 1fc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 201:	cd 40                	int    $0x40
+ 203:	c3                   	ret
+
+0000000000000204 <exit>:
+SYSCALL(exit)
+ 204:	b8 02 00 00 00       	mov    $0x2,%eax
+ 209:	cd 40                	int    $0x40
+ 20b:	c3                   	ret
+
+000000000000020c <wait>:
+SYSCALL(wait)
+ 20c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 211:	cd 40                	int    $0x40
+ 213:	c3                   	ret
+
+0000000000000214 <pipe>:
+SYSCALL(pipe)
+ 214:	b8 04 00 00 00       	mov    $0x4,%eax
+ 219:	cd 40                	int    $0x40
+ 21b:	c3                   	ret
+
+000000000000021c <read>:
+SYSCALL(read)
+ 21c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 221:	cd 40                	int    $0x40
+ 223:	c3                   	ret
+
+0000000000000224 <write>:
+SYSCALL(write)
+ 224:	b8 10 00 00 00       	mov    $0x10,%eax
+ 229:	cd 40                	int    $0x40
+ 22b:	c3                   	ret
+
+000000000000022c <close>:
+SYSCALL(close)
+ 22c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 231:	cd 40                	int    $0x40
+ 233:	c3                   	ret
+
+0000000000000234 <kill>:
+SYSCALL(kill)
+ 234:	b8 06 00 00 00       	mov    $0x6,%eax
+ 239:	cd 40                	int    $0x40
+ 23b:	c3                   	ret
+
+000000000000023c <exec>:
+SYSCALL(exec)
+ 23c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 241:	cd 40                	int    $0x40
+ 243:	c3                   	ret
+
+0000000000000244 <open>:
+SYSCALL(open)
+ 244:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 249:	cd 40                	int    $0x40
+ 24b:	c3                   	ret
+
+000000000000024c <mknod>:
+SYSCALL(mknod)
+ 24c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 251:	cd 40                	int    $0x40
+ 253:	c3                   	ret
+
+0000000000000254 <unlink>:
+SYSCALL(unlink)
+ 254:	b8 12 00 00 00       	mov    $0x12,%eax
+ 259:	cd 40                	int    $0x40
+ 25b:	c3                   	ret
+
+000000000000025c <fstat>:
+SYSCALL(fstat)
+ 25c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 261:	cd 40                	int    $0x40
+ 263:	c3                   	ret
+
+0000000000000264 <link>:
+SYSCALL(link)
+ 264:	b8 13 00 00 00       	mov    $0x13,%eax
+ 269:	cd 40                	int    $0x40
+ 26b:	c3                   	ret
+
+000000000000026c <mkdir>:
+SYSCALL(mkdir)
+ 26c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 271:	cd 40                	int    $0x40
+ 273:	c3                   	ret
+
+0000000000000274 <chdir>:
+SYSCALL(chdir)
+ 274:	b8 09 00 00 00       	mov    $0x9,%eax
+ 279:	cd 40                	int    $0x40
+ 27b:	c3                   	ret
+
+000000000000027c <dup>:
+SYSCALL(dup)
+ 27c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 281:	cd 40                	int    $0x40
+ 283:	c3                   	ret
+
+0000000000000284 <getpid>:
+SYSCALL(getpid)
+ 284:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 289:	cd 40                	int    $0x40
+ 28b:	c3                   	ret
+
+000000000000028c <sbrk>:
+SYSCALL(sbrk)
+ 28c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 291:	cd 40                	int    $0x40
+ 293:	c3                   	ret
+
+0000000000000294 <sleep>:
+SYSCALL(sleep)
+ 294:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+000000000000029c <uptime>:
+SYSCALL(uptime)
+ 29c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+00000000000002a4 <chmod>:
+SYSCALL(chmod)
+ 2a4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+00000000000002ac <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 2ac:	55                   	push   %rbp
+ 2ad:	48 89 e5             	mov    %rsp,%rbp
+ 2b0:	41 54                	push   %r12
+ 2b2:	41 89 fc             	mov    %edi,%r12d
+ 2b5:	89 d7                	mov    %edx,%edi
+ 2b7:	53                   	push   %rbx
+ 2b8:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 2bc:	85 f6                	test   %esi,%esi
+ 2be:	79 0f                	jns    2cf <printint+0x23>
+ 2c0:	80 e1 01             	and    $0x1,%cl
+ 2c3:	74 0a                	je     2cf <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 2c5:	f7 de                	neg    %esi
+    neg = 1;
+ 2c7:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 2cd:	eb 03                	jmp    2d2 <printint+0x26>
+  neg = 0;
+ 2cf:	45 31 c0             	xor    %r8d,%r8d
+ 2d2:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 2d4:	89 f0                	mov    %esi,%eax
+ 2d6:	31 d2                	xor    %edx,%edx
+ 2d8:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 2db:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 2de:	f7 f7                	div    %edi
+ 2e0:	8a 92 70 06 00 00    	mov    0x670(%rdx),%dl
+ 2e6:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 2ea:	89 f2                	mov    %esi,%edx
+ 2ec:	89 c6                	mov    %eax,%esi
+ 2ee:	39 fa                	cmp    %edi,%edx
+ 2f0:	73 e2                	jae    2d4 <printint+0x28>
+  if(neg)
+ 2f2:	45 85 c0             	test   %r8d,%r8d
+ 2f5:	74 0a                	je     301 <printint+0x55>
+    buf[i++] = digits[x % base];
+ 2f7:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 2f9:	48 63 c3             	movslq %ebx,%rax
+ 2fc:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 301:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 304:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 308:	ba 01 00 00 00       	mov    $0x1,%edx
+ 30d:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 311:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 314:	48 ff cb             	dec    %rbx
+ 317:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 31a:	e8 05 ff ff ff       	call   224 <write>
+  while(--i >= 0)
+ 31f:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 322:	75 e0                	jne    304 <printint+0x58>
+}
+ 324:	48 83 c4 20          	add    $0x20,%rsp
+ 328:	5b                   	pop    %rbx
+ 329:	41 5c                	pop    %r12
+ 32b:	5d                   	pop    %rbp
+ 32c:	c3                   	ret
+
+000000000000032d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 32d:	55                   	push   %rbp
+ 32e:	48 89 e5             	mov    %rsp,%rbp
+ 331:	41 55                	push   %r13
+ 333:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 335:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 339:	53                   	push   %rbx
+ 33a:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 33e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 342:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 346:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 34a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 34e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 352:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 356:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 35a:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 35c:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 363:	84 c0                	test   %al,%al
+ 365:	0f 84 6f 01 00 00    	je     4da <printf+0x1ad>
+ 36b:	89 fb                	mov    %edi,%ebx
+ 36d:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 370:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 373:	83 fa 25             	cmp    $0x25,%edx
+ 376:	75 44                	jne    3bc <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 378:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 37d:	49 ff c4             	inc    %r12
+ 380:	45 84 ed             	test   %r13b,%r13b
+ 383:	0f 84 51 01 00 00    	je     4da <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 389:	41 0f b6 c5          	movzbl %r13b,%eax
+ 38d:	41 0f be d5          	movsbl %r13b,%edx
+ 391:	83 f8 64             	cmp    $0x64,%eax
+ 394:	74 7c                	je     412 <printf+0xe5>
+ 396:	7f 29                	jg     3c1 <printf+0x94>
+ 398:	83 f8 25             	cmp    $0x25,%eax
+ 39b:	74 4c                	je     3e9 <printf+0xbc>
+ 39d:	83 f8 63             	cmp    $0x63,%eax
+ 3a0:	75 33                	jne    3d5 <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 3a2:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3a5:	83 fa 2f             	cmp    $0x2f,%edx
+ 3a8:	0f 87 1b 01 00 00    	ja     4c9 <printf+0x19c>
+ 3ae:	89 d0                	mov    %edx,%eax
+ 3b0:	83 c2 08             	add    $0x8,%edx
+ 3b3:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3b7:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3ba:	8b 00                	mov    (%rax),%eax
+ 3bc:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 3bf:	eb 2c                	jmp    3ed <printf+0xc0>
+ 3c1:	83 f8 73             	cmp    $0x73,%eax
+ 3c4:	0f 84 aa 00 00 00    	je     474 <printf+0x147>
+ 3ca:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 3d0:	83 fa 70             	cmp    $0x70,%edx
+ 3d3:	74 6b                	je     440 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 3d5:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 3d9:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3de:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 3e2:	89 df                	mov    %ebx,%edi
+ 3e4:	e8 3b fe ff ff       	call   224 <write>
+        putc(fd, c);
+ 3e9:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 3ed:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3f2:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 3f6:	89 df                	mov    %ebx,%edi
+ 3f8:	e8 27 fe ff ff       	call   224 <write>
+  for(i = 0; fmt[i]; i++){
+ 3fd:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 402:	49 ff c4             	inc    %r12
+ 405:	84 c0                	test   %al,%al
+ 407:	0f 85 63 ff ff ff    	jne    370 <printf+0x43>
+ 40d:	e9 c8 00 00 00       	jmp    4da <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 412:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 415:	83 fa 2f             	cmp    $0x2f,%edx
+ 418:	77 0e                	ja     428 <printf+0xfb>
+ 41a:	89 d0                	mov    %edx,%eax
+ 41c:	83 c2 08             	add    $0x8,%edx
+ 41f:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 423:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 426:	eb 0c                	jmp    434 <printf+0x107>
+ 428:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 42c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 430:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 434:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 439:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 43e:	eb 29                	jmp    469 <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 440:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 443:	83 fa 2f             	cmp    $0x2f,%edx
+ 446:	77 0e                	ja     456 <printf+0x129>
+ 448:	89 d0                	mov    %edx,%eax
+ 44a:	83 c2 08             	add    $0x8,%edx
+ 44d:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 451:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 454:	eb 0c                	jmp    462 <printf+0x135>
+ 456:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 45a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 45e:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 462:	31 c9                	xor    %ecx,%ecx
+ 464:	ba 10 00 00 00       	mov    $0x10,%edx
+ 469:	8b 30                	mov    (%rax),%esi
+ 46b:	89 df                	mov    %ebx,%edi
+ 46d:	e8 3a fe ff ff       	call   2ac <printint>
+ 472:	eb 89                	jmp    3fd <printf+0xd0>
+        s = va_arg(ap, char*);
+ 474:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 477:	83 fa 2f             	cmp    $0x2f,%edx
+ 47a:	77 0e                	ja     48a <printf+0x15d>
+ 47c:	89 d0                	mov    %edx,%eax
+ 47e:	83 c2 08             	add    $0x8,%edx
+ 481:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 485:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 488:	eb 0c                	jmp    496 <printf+0x169>
+ 48a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 48e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 492:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 496:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 499:	4d 85 ed             	test   %r13,%r13
+ 49c:	75 07                	jne    4a5 <printf+0x178>
+          s = "(null)";
+ 49e:	49 c7 c5 64 06 00 00 	mov    $0x664,%r13
+        while(*s != 0){
+ 4a5:	41 8a 45 00          	mov    0x0(%r13),%al
+ 4a9:	84 c0                	test   %al,%al
+ 4ab:	0f 84 4c ff ff ff    	je     3fd <printf+0xd0>
+          putc(fd, *s);
+ 4b1:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 4b4:	ba 01 00 00 00       	mov    $0x1,%edx
+ 4b9:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 4bd:	89 df                	mov    %ebx,%edi
+          s++;
+ 4bf:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 4c2:	e8 5d fd ff ff       	call   224 <write>
+          s++;
+ 4c7:	eb dc                	jmp    4a5 <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 4c9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 4cd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4d1:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 4d5:	e9 e0 fe ff ff       	jmp    3ba <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 4da:	48 83 c4 58          	add    $0x58,%rsp
+ 4de:	5b                   	pop    %rbx
+ 4df:	41 5c                	pop    %r12
+ 4e1:	41 5d                	pop    %r13
+ 4e3:	5d                   	pop    %rbp
+ 4e4:	c3                   	ret
+
+00000000000004e5 <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 4e5:	48 8b 05 74 03 00 00 	mov    0x374(%rip),%rax        # 860 <freep>
+{
+ 4ec:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 4ef:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 4f3:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 4f6:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 4f9:	48 39 f2             	cmp    %rsi,%rdx
+ 4fc:	72 0c                	jb     50a <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 4fe:	48 39 c6             	cmp    %rax,%rsi
+ 501:	73 f0                	jae    4f3 <free+0xe>
+ 503:	48 39 c2             	cmp    %rax,%rdx
+ 506:	72 eb                	jb     4f3 <free+0xe>
+ 508:	eb 05                	jmp    50f <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 50a:	48 39 c6             	cmp    %rax,%rsi
+ 50d:	73 f4                	jae    503 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 50f:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 512:	49 89 f8             	mov    %rdi,%r8
+ 515:	48 c1 e7 04          	shl    $0x4,%rdi
+ 519:	48 01 f7             	add    %rsi,%rdi
+ 51c:	48 39 f8             	cmp    %rdi,%rax
+ 51f:	75 0e                	jne    52f <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 521:	44 03 40 08          	add    0x8(%rax),%r8d
+ 525:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 529:	48 8b 02             	mov    (%rdx),%rax
+ 52c:	48 8b 00             	mov    (%rax),%rax
+ 52f:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 533:	8b 42 08             	mov    0x8(%rdx),%eax
+ 536:	48 89 c7             	mov    %rax,%rdi
+ 539:	48 c1 e0 04          	shl    $0x4,%rax
+ 53d:	48 01 d0             	add    %rdx,%rax
+ 540:	48 39 c6             	cmp    %rax,%rsi
+ 543:	75 0a                	jne    54f <free+0x6a>
+    p->s.size += bp->s.size;
+ 545:	03 79 f8             	add    -0x8(%rcx),%edi
+ 548:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 54b:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 54f:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 552:	48 89 15 07 03 00 00 	mov    %rdx,0x307(%rip)        # 860 <freep>
+}
+ 559:	c3                   	ret
+
+000000000000055a <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 55a:	55                   	push   %rbp
+ 55b:	48 89 e5             	mov    %rsp,%rbp
+ 55e:	41 55                	push   %r13
+ 560:	41 54                	push   %r12
+ 562:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 563:	89 fb                	mov    %edi,%ebx
+{
+ 565:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 566:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 56a:	48 8b 0d ef 02 00 00 	mov    0x2ef(%rip),%rcx        # 860 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 571:	48 c1 eb 04          	shr    $0x4,%rbx
+ 575:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 577:	48 85 c9             	test   %rcx,%rcx
+ 57a:	75 25                	jne    5a1 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 57c:	48 c7 05 d9 02 00 00 	movq   $0x870,0x2d9(%rip)        # 860 <freep>
+ 583:	70 08 00 00 
+    base.s.size = 0;
+ 587:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 589:	48 c7 05 dc 02 00 00 	movq   $0x870,0x2dc(%rip)        # 870 <base>
+ 590:	70 08 00 00 
+    base.s.size = 0;
+ 594:	89 0d de 02 00 00    	mov    %ecx,0x2de(%rip)        # 878 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 59a:	48 c7 c1 70 08 00 00 	mov    $0x870,%rcx
+  if(nu < 4096)
+ 5a1:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 5a7:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 5aa:	44 39 e3             	cmp    %r12d,%ebx
+ 5ad:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 5b1:	45 89 e5             	mov    %r12d,%r13d
+ 5b4:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 5b8:	8b 50 08             	mov    0x8(%rax),%edx
+ 5bb:	39 da                	cmp    %ebx,%edx
+ 5bd:	72 26                	jb     5e5 <malloc+0x8b>
+      if(p->s.size == nunits)
+ 5bf:	75 08                	jne    5c9 <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 5c1:	48 8b 10             	mov    (%rax),%rdx
+ 5c4:	48 89 11             	mov    %rdx,(%rcx)
+ 5c7:	eb 0f                	jmp    5d8 <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 5c9:	29 da                	sub    %ebx,%edx
+ 5cb:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 5ce:	48 c1 e2 04          	shl    $0x4,%rdx
+ 5d2:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 5d5:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 5d8:	48 89 0d 81 02 00 00 	mov    %rcx,0x281(%rip)        # 860 <freep>
+      return (void*)(p + 1);
+ 5df:	48 83 c0 10          	add    $0x10,%rax
+ 5e3:	eb 3a                	jmp    61f <malloc+0xc5>
+    }
+    if(p == freep)
+ 5e5:	48 39 05 74 02 00 00 	cmp    %rax,0x274(%rip)        # 860 <freep>
+ 5ec:	75 27                	jne    615 <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 5ee:	44 89 ef             	mov    %r13d,%edi
+ 5f1:	e8 96 fc ff ff       	call   28c <sbrk>
+  if(p == (char*)-1)
+ 5f6:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 5fa:	74 21                	je     61d <malloc+0xc3>
+  hp->s.size = nu;
+ 5fc:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 600:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 604:	e8 dc fe ff ff       	call   4e5 <free>
+  return freep;
+ 609:	48 8b 05 50 02 00 00 	mov    0x250(%rip),%rax        # 860 <freep>
+      if((p = morecore(nunits)) == 0)
+ 610:	48 85 c0             	test   %rax,%rax
+ 613:	74 08                	je     61d <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 615:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 618:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 61b:	eb 9b                	jmp    5b8 <malloc+0x5e>
+        return 0;
+ 61d:	31 c0                	xor    %eax,%eax
+  }
+}
+ 61f:	5a                   	pop    %rdx
+ 620:	5b                   	pop    %rbx
+ 621:	41 5c                	pop    %r12
+ 623:	41 5d                	pop    %r13
+ 625:	5d                   	pop    %rbp
+ 626:	c3                   	ret
@@ -0,0 +1,898 @@
+
+.fs/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	41 56                	push   %r14
+  int i;
+
+  for(i = 1; i < argc; i++)
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+   6:	49 c7 c6 c0 05 00 00 	mov    $0x5c0,%r14
+{
+   d:	41 55                	push   %r13
+   f:	49 89 f5             	mov    %rsi,%r13
+  12:	41 54                	push   %r12
+  14:	41 89 fc             	mov    %edi,%r12d
+  17:	53                   	push   %rbx
+  for(i = 1; i < argc; i++)
+  18:	bb 01 00 00 00       	mov    $0x1,%ebx
+  1d:	41 39 dc             	cmp    %ebx,%r12d
+  20:	7e 2e                	jle    50 <main+0x50>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  22:	8d 43 01             	lea    0x1(%rbx),%eax
+  25:	48 c7 c1 c2 05 00 00 	mov    $0x5c2,%rcx
+  2c:	49 8b 54 dd 00       	mov    0x0(%r13,%rbx,8),%rdx
+  31:	48 c7 c6 c4 05 00 00 	mov    $0x5c4,%rsi
+  38:	41 39 c4             	cmp    %eax,%r12d
+  3b:	bf 01 00 00 00       	mov    $0x1,%edi
+  40:	49 0f 4f ce          	cmovg  %r14,%rcx
+  44:	31 c0                	xor    %eax,%eax
+  46:	48 ff c3             	inc    %rbx
+  49:	e8 6e 02 00 00       	call   2bc <printf>
+  for(i = 1; i < argc; i++)
+  4e:	eb cd                	jmp    1d <main+0x1d>
+  exit();
+  50:	e8 3e 01 00 00       	call   193 <exit>
+
+0000000000000055 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  55:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  58:	31 d2                	xor    %edx,%edx
+  5a:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+  5d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  60:	48 ff c2             	inc    %rdx
+  63:	84 c9                	test   %cl,%cl
+  65:	75 f3                	jne    5a <strcpy+0x5>
+    ;
+  return os;
+}
+  67:	c3                   	ret
+
+0000000000000068 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+  68:	31 c9                	xor    %ecx,%ecx
+  6a:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+  6e:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+  72:	84 c0                	test   %al,%al
+  74:	74 07                	je     7d <strcmp+0x15>
+  76:	48 ff c1             	inc    %rcx
+  79:	38 d0                	cmp    %dl,%al
+  7b:	74 ed                	je     6a <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+  7d:	29 d0                	sub    %edx,%eax
+}
+  7f:	c3                   	ret
+
+0000000000000080 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+  80:	31 d2                	xor    %edx,%edx
+  82:	48 89 d0             	mov    %rdx,%rax
+  85:	48 ff c2             	inc    %rdx
+  88:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  8d:	75 f3                	jne    82 <strlen+0x2>
+    ;
+  return n;
+}
+  8f:	c3                   	ret
+
+0000000000000090 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  90:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  93:	89 d1                	mov    %edx,%ecx
+  95:	89 f0                	mov    %esi,%eax
+  97:	fc                   	cld
+  98:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+  9a:	4c 89 c0             	mov    %r8,%rax
+  9d:	c3                   	ret
+
+000000000000009e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+  9e:	48 89 f8             	mov    %rdi,%rax
+  a1:	8a 10                	mov    (%rax),%dl
+  a3:	84 d2                	test   %dl,%dl
+  a5:	74 0a                	je     b1 <strchr+0x13>
+    if(*s == c)
+  a7:	40 38 f2             	cmp    %sil,%dl
+  aa:	74 07                	je     b3 <strchr+0x15>
+  for(; *s; s++)
+  ac:	48 ff c0             	inc    %rax
+  af:	eb f0                	jmp    a1 <strchr+0x3>
+      return (char*)s;
+  return 0;
+  b1:	31 c0                	xor    %eax,%eax
+}
+  b3:	c3                   	ret
+
+00000000000000b4 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  b4:	55                   	push   %rbp
+  b5:	48 89 e5             	mov    %rsp,%rbp
+  b8:	41 56                	push   %r14
+  ba:	41 89 f6             	mov    %esi,%r14d
+  bd:	41 55                	push   %r13
+  bf:	41 54                	push   %r12
+  c1:	49 89 fc             	mov    %rdi,%r12
+  c4:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  c5:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  ca:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+  ce:	41 89 dd             	mov    %ebx,%r13d
+  d1:	44 39 f3             	cmp    %r14d,%ebx
+  d4:	7d 29                	jge    ff <gets+0x4b>
+    cc = read(0, &c, 1);
+  d6:	31 ff                	xor    %edi,%edi
+  d8:	ba 01 00 00 00       	mov    $0x1,%edx
+  dd:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+  e1:	e8 c5 00 00 00       	call   1ab <read>
+    if(cc < 1)
+  e6:	85 c0                	test   %eax,%eax
+  e8:	7e 15                	jle    ff <gets+0x4b>
+      break;
+    buf[i++] = c;
+  ea:	8a 45 df             	mov    -0x21(%rbp),%al
+  ed:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+  f2:	48 ff c3             	inc    %rbx
+  f5:	3c 0a                	cmp    $0xa,%al
+  f7:	74 0a                	je     103 <gets+0x4f>
+  f9:	3c 0d                	cmp    $0xd,%al
+  fb:	75 d1                	jne    ce <gets+0x1a>
+  fd:	eb 04                	jmp    103 <gets+0x4f>
+  ff:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 103:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 106:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 109:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 10e:	5a                   	pop    %rdx
+ 10f:	59                   	pop    %rcx
+ 110:	5b                   	pop    %rbx
+ 111:	41 5c                	pop    %r12
+ 113:	41 5d                	pop    %r13
+ 115:	41 5e                	pop    %r14
+ 117:	5d                   	pop    %rbp
+ 118:	c3                   	ret
+
+0000000000000119 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 119:	55                   	push   %rbp
+ 11a:	48 89 e5             	mov    %rsp,%rbp
+ 11d:	41 55                	push   %r13
+ 11f:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 122:	31 f6                	xor    %esi,%esi
+{
+ 124:	41 54                	push   %r12
+ 126:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 12a:	53                   	push   %rbx
+ 12b:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 12c:	e8 a2 00 00 00       	call   1d3 <open>
+  if(fd < 0)
+ 131:	85 c0                	test   %eax,%eax
+ 133:	78 16                	js     14b <stat+0x32>
+ 135:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 137:	89 c7                	mov    %eax,%edi
+ 139:	4c 89 ee             	mov    %r13,%rsi
+ 13c:	e8 aa 00 00 00       	call   1eb <fstat>
+  close(fd);
+ 141:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 143:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 146:	e8 70 00 00 00       	call   1bb <close>
+  return r;
+}
+ 14b:	5a                   	pop    %rdx
+ 14c:	44 89 e0             	mov    %r12d,%eax
+ 14f:	5b                   	pop    %rbx
+ 150:	41 5c                	pop    %r12
+ 152:	41 5d                	pop    %r13
+ 154:	5d                   	pop    %rbp
+ 155:	c3                   	ret
+
+0000000000000156 <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 156:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 158:	0f be 17             	movsbl (%rdi),%edx
+ 15b:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 15e:	80 f9 09             	cmp    $0x9,%cl
+ 161:	77 0c                	ja     16f <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 163:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 166:	48 ff c7             	inc    %rdi
+ 169:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 16d:	eb e9                	jmp    158 <atoi+0x2>
+  return n;
+}
+ 16f:	c3                   	ret
+
+0000000000000170 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 170:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 173:	31 c9                	xor    %ecx,%ecx
+ 175:	89 d7                	mov    %edx,%edi
+ 177:	29 cf                	sub    %ecx,%edi
+ 179:	85 ff                	test   %edi,%edi
+ 17b:	7e 0d                	jle    18a <memmove+0x1a>
+    *dst++ = *src++;
+ 17d:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 181:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 185:	48 ff c1             	inc    %rcx
+ 188:	eb eb                	jmp    175 <memmove+0x5>
+  return vdst;
+}
+ 18a:	c3                   	ret
+
+000000000000018b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 18b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 190:	cd 40                	int    $0x40
+ 192:	c3                   	ret
+
+0000000000000193 <exit>:
+SYSCALL(exit)
+ 193:	b8 02 00 00 00       	mov    $0x2,%eax
+ 198:	cd 40                	int    $0x40
+ 19a:	c3                   	ret
+
+000000000000019b <wait>:
+SYSCALL(wait)
+ 19b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 1a0:	cd 40                	int    $0x40
+ 1a2:	c3                   	ret
+
+00000000000001a3 <pipe>:
+SYSCALL(pipe)
+ 1a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 1a8:	cd 40                	int    $0x40
+ 1aa:	c3                   	ret
+
+00000000000001ab <read>:
+SYSCALL(read)
+ 1ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 1b0:	cd 40                	int    $0x40
+ 1b2:	c3                   	ret
+
+00000000000001b3 <write>:
+SYSCALL(write)
+ 1b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 1b8:	cd 40                	int    $0x40
+ 1ba:	c3                   	ret
+
+00000000000001bb <close>:
+SYSCALL(close)
+ 1bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 1c0:	cd 40                	int    $0x40
+ 1c2:	c3                   	ret
+
+00000000000001c3 <kill>:
+SYSCALL(kill)
+ 1c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 1c8:	cd 40                	int    $0x40
+ 1ca:	c3                   	ret
+
+00000000000001cb <exec>:
+SYSCALL(exec)
+ 1cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 1d0:	cd 40                	int    $0x40
+ 1d2:	c3                   	ret
+
+00000000000001d3 <open>:
+SYSCALL(open)
+ 1d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 1d8:	cd 40                	int    $0x40
+ 1da:	c3                   	ret
+
+00000000000001db <mknod>:
+SYSCALL(mknod)
+ 1db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 1e0:	cd 40                	int    $0x40
+ 1e2:	c3                   	ret
+
+00000000000001e3 <unlink>:
+SYSCALL(unlink)
+ 1e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 1e8:	cd 40                	int    $0x40
+ 1ea:	c3                   	ret
+
+00000000000001eb <fstat>:
+SYSCALL(fstat)
+ 1eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 1f0:	cd 40                	int    $0x40
+ 1f2:	c3                   	ret
+
+00000000000001f3 <link>:
+SYSCALL(link)
+ 1f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 1f8:	cd 40                	int    $0x40
+ 1fa:	c3                   	ret
+
+00000000000001fb <mkdir>:
+SYSCALL(mkdir)
+ 1fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 200:	cd 40                	int    $0x40
+ 202:	c3                   	ret
+
+0000000000000203 <chdir>:
+SYSCALL(chdir)
+ 203:	b8 09 00 00 00       	mov    $0x9,%eax
+ 208:	cd 40                	int    $0x40
+ 20a:	c3                   	ret
+
+000000000000020b <dup>:
+SYSCALL(dup)
+ 20b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 210:	cd 40                	int    $0x40
+ 212:	c3                   	ret
+
+0000000000000213 <getpid>:
+SYSCALL(getpid)
+ 213:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 218:	cd 40                	int    $0x40
+ 21a:	c3                   	ret
+
+000000000000021b <sbrk>:
+SYSCALL(sbrk)
+ 21b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 220:	cd 40                	int    $0x40
+ 222:	c3                   	ret
+
+0000000000000223 <sleep>:
+SYSCALL(sleep)
+ 223:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 228:	cd 40                	int    $0x40
+ 22a:	c3                   	ret
+
+000000000000022b <uptime>:
+SYSCALL(uptime)
+ 22b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 230:	cd 40                	int    $0x40
+ 232:	c3                   	ret
+
+0000000000000233 <chmod>:
+SYSCALL(chmod)
+ 233:	b8 16 00 00 00       	mov    $0x16,%eax
+ 238:	cd 40                	int    $0x40
+ 23a:	c3                   	ret
+
+000000000000023b <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 23b:	55                   	push   %rbp
+ 23c:	48 89 e5             	mov    %rsp,%rbp
+ 23f:	41 54                	push   %r12
+ 241:	41 89 fc             	mov    %edi,%r12d
+ 244:	89 d7                	mov    %edx,%edi
+ 246:	53                   	push   %rbx
+ 247:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 24b:	85 f6                	test   %esi,%esi
+ 24d:	79 0f                	jns    25e <printint+0x23>
+ 24f:	80 e1 01             	and    $0x1,%cl
+ 252:	74 0a                	je     25e <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 254:	f7 de                	neg    %esi
+    neg = 1;
+ 256:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 25c:	eb 03                	jmp    261 <printint+0x26>
+  neg = 0;
+ 25e:	45 31 c0             	xor    %r8d,%r8d
+ 261:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 263:	89 f0                	mov    %esi,%eax
+ 265:	31 d2                	xor    %edx,%edx
+ 267:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 26a:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 26d:	f7 f7                	div    %edi
+ 26f:	8a 92 d0 05 00 00    	mov    0x5d0(%rdx),%dl
+ 275:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 279:	89 f2                	mov    %esi,%edx
+ 27b:	89 c6                	mov    %eax,%esi
+ 27d:	39 fa                	cmp    %edi,%edx
+ 27f:	73 e2                	jae    263 <printint+0x28>
+  if(neg)
+ 281:	45 85 c0             	test   %r8d,%r8d
+ 284:	74 0a                	je     290 <printint+0x55>
+    buf[i++] = digits[x % base];
+ 286:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 288:	48 63 c3             	movslq %ebx,%rax
+ 28b:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 290:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 293:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 297:	ba 01 00 00 00       	mov    $0x1,%edx
+ 29c:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 2a0:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 2a3:	48 ff cb             	dec    %rbx
+ 2a6:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 2a9:	e8 05 ff ff ff       	call   1b3 <write>
+  while(--i >= 0)
+ 2ae:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 2b1:	75 e0                	jne    293 <printint+0x58>
+}
+ 2b3:	48 83 c4 20          	add    $0x20,%rsp
+ 2b7:	5b                   	pop    %rbx
+ 2b8:	41 5c                	pop    %r12
+ 2ba:	5d                   	pop    %rbp
+ 2bb:	c3                   	ret
+
+00000000000002bc <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 2bc:	55                   	push   %rbp
+ 2bd:	48 89 e5             	mov    %rsp,%rbp
+ 2c0:	41 55                	push   %r13
+ 2c2:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 2c4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 2c8:	53                   	push   %rbx
+ 2c9:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 2cd:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 2d1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 2d5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 2d9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 2dd:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 2e1:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 2e5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 2e9:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 2eb:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 2f2:	84 c0                	test   %al,%al
+ 2f4:	0f 84 6f 01 00 00    	je     469 <printf+0x1ad>
+ 2fa:	89 fb                	mov    %edi,%ebx
+ 2fc:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 2ff:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 302:	83 fa 25             	cmp    $0x25,%edx
+ 305:	75 44                	jne    34b <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 307:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 30c:	49 ff c4             	inc    %r12
+ 30f:	45 84 ed             	test   %r13b,%r13b
+ 312:	0f 84 51 01 00 00    	je     469 <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 318:	41 0f b6 c5          	movzbl %r13b,%eax
+ 31c:	41 0f be d5          	movsbl %r13b,%edx
+ 320:	83 f8 64             	cmp    $0x64,%eax
+ 323:	74 7c                	je     3a1 <printf+0xe5>
+ 325:	7f 29                	jg     350 <printf+0x94>
+ 327:	83 f8 25             	cmp    $0x25,%eax
+ 32a:	74 4c                	je     378 <printf+0xbc>
+ 32c:	83 f8 63             	cmp    $0x63,%eax
+ 32f:	75 33                	jne    364 <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 331:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 334:	83 fa 2f             	cmp    $0x2f,%edx
+ 337:	0f 87 1b 01 00 00    	ja     458 <printf+0x19c>
+ 33d:	89 d0                	mov    %edx,%eax
+ 33f:	83 c2 08             	add    $0x8,%edx
+ 342:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 346:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 349:	8b 00                	mov    (%rax),%eax
+ 34b:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 34e:	eb 2c                	jmp    37c <printf+0xc0>
+ 350:	83 f8 73             	cmp    $0x73,%eax
+ 353:	0f 84 aa 00 00 00    	je     403 <printf+0x147>
+ 359:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 35f:	83 fa 70             	cmp    $0x70,%edx
+ 362:	74 6b                	je     3cf <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 364:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 368:	ba 01 00 00 00       	mov    $0x1,%edx
+ 36d:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 371:	89 df                	mov    %ebx,%edi
+ 373:	e8 3b fe ff ff       	call   1b3 <write>
+        putc(fd, c);
+ 378:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 37c:	ba 01 00 00 00       	mov    $0x1,%edx
+ 381:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 385:	89 df                	mov    %ebx,%edi
+ 387:	e8 27 fe ff ff       	call   1b3 <write>
+  for(i = 0; fmt[i]; i++){
+ 38c:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 391:	49 ff c4             	inc    %r12
+ 394:	84 c0                	test   %al,%al
+ 396:	0f 85 63 ff ff ff    	jne    2ff <printf+0x43>
+ 39c:	e9 c8 00 00 00       	jmp    469 <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 3a1:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3a4:	83 fa 2f             	cmp    $0x2f,%edx
+ 3a7:	77 0e                	ja     3b7 <printf+0xfb>
+ 3a9:	89 d0                	mov    %edx,%eax
+ 3ab:	83 c2 08             	add    $0x8,%edx
+ 3ae:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3b2:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3b5:	eb 0c                	jmp    3c3 <printf+0x107>
+ 3b7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3bb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3bf:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3c3:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3c8:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3cd:	eb 29                	jmp    3f8 <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 3cf:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3d2:	83 fa 2f             	cmp    $0x2f,%edx
+ 3d5:	77 0e                	ja     3e5 <printf+0x129>
+ 3d7:	89 d0                	mov    %edx,%eax
+ 3d9:	83 c2 08             	add    $0x8,%edx
+ 3dc:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3e0:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3e3:	eb 0c                	jmp    3f1 <printf+0x135>
+ 3e5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3e9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3ed:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3f1:	31 c9                	xor    %ecx,%ecx
+ 3f3:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3f8:	8b 30                	mov    (%rax),%esi
+ 3fa:	89 df                	mov    %ebx,%edi
+ 3fc:	e8 3a fe ff ff       	call   23b <printint>
+ 401:	eb 89                	jmp    38c <printf+0xd0>
+        s = va_arg(ap, char*);
+ 403:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 406:	83 fa 2f             	cmp    $0x2f,%edx
+ 409:	77 0e                	ja     419 <printf+0x15d>
+ 40b:	89 d0                	mov    %edx,%eax
+ 40d:	83 c2 08             	add    $0x8,%edx
+ 410:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 414:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 417:	eb 0c                	jmp    425 <printf+0x169>
+ 419:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 41d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 421:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 425:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 428:	4d 85 ed             	test   %r13,%r13
+ 42b:	75 07                	jne    434 <printf+0x178>
+          s = "(null)";
+ 42d:	49 c7 c5 c9 05 00 00 	mov    $0x5c9,%r13
+        while(*s != 0){
+ 434:	41 8a 45 00          	mov    0x0(%r13),%al
+ 438:	84 c0                	test   %al,%al
+ 43a:	0f 84 4c ff ff ff    	je     38c <printf+0xd0>
+          putc(fd, *s);
+ 440:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 443:	ba 01 00 00 00       	mov    $0x1,%edx
+ 448:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 44c:	89 df                	mov    %ebx,%edi
+          s++;
+ 44e:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 451:	e8 5d fd ff ff       	call   1b3 <write>
+          s++;
+ 456:	eb dc                	jmp    434 <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 458:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 45c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 460:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 464:	e9 e0 fe ff ff       	jmp    349 <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 469:	48 83 c4 58          	add    $0x58,%rsp
+ 46d:	5b                   	pop    %rbx
+ 46e:	41 5c                	pop    %r12
+ 470:	41 5d                	pop    %r13
+ 472:	5d                   	pop    %rbp
+ 473:	c3                   	ret
+
+0000000000000474 <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 474:	48 8b 05 45 03 00 00 	mov    0x345(%rip),%rax        # 7c0 <freep>
+{
+ 47b:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 47e:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 482:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 485:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 488:	48 39 f2             	cmp    %rsi,%rdx
+ 48b:	72 0c                	jb     499 <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 48d:	48 39 c6             	cmp    %rax,%rsi
+ 490:	73 f0                	jae    482 <free+0xe>
+ 492:	48 39 c2             	cmp    %rax,%rdx
+ 495:	72 eb                	jb     482 <free+0xe>
+ 497:	eb 05                	jmp    49e <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 499:	48 39 c6             	cmp    %rax,%rsi
+ 49c:	73 f4                	jae    492 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 49e:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 4a1:	49 89 f8             	mov    %rdi,%r8
+ 4a4:	48 c1 e7 04          	shl    $0x4,%rdi
+ 4a8:	48 01 f7             	add    %rsi,%rdi
+ 4ab:	48 39 f8             	cmp    %rdi,%rax
+ 4ae:	75 0e                	jne    4be <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 4b0:	44 03 40 08          	add    0x8(%rax),%r8d
+ 4b4:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 4b8:	48 8b 02             	mov    (%rdx),%rax
+ 4bb:	48 8b 00             	mov    (%rax),%rax
+ 4be:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 4c2:	8b 42 08             	mov    0x8(%rdx),%eax
+ 4c5:	48 89 c7             	mov    %rax,%rdi
+ 4c8:	48 c1 e0 04          	shl    $0x4,%rax
+ 4cc:	48 01 d0             	add    %rdx,%rax
+ 4cf:	48 39 c6             	cmp    %rax,%rsi
+ 4d2:	75 0a                	jne    4de <free+0x6a>
+    p->s.size += bp->s.size;
+ 4d4:	03 79 f8             	add    -0x8(%rcx),%edi
+ 4d7:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 4da:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 4de:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 4e1:	48 89 15 d8 02 00 00 	mov    %rdx,0x2d8(%rip)        # 7c0 <freep>
+}
+ 4e8:	c3                   	ret
+
+00000000000004e9 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 4e9:	55                   	push   %rbp
+ 4ea:	48 89 e5             	mov    %rsp,%rbp
+ 4ed:	41 55                	push   %r13
+ 4ef:	41 54                	push   %r12
+ 4f1:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4f2:	89 fb                	mov    %edi,%ebx
+{
+ 4f4:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4f5:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 4f9:	48 8b 0d c0 02 00 00 	mov    0x2c0(%rip),%rcx        # 7c0 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 500:	48 c1 eb 04          	shr    $0x4,%rbx
+ 504:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 506:	48 85 c9             	test   %rcx,%rcx
+ 509:	75 25                	jne    530 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 50b:	48 c7 05 aa 02 00 00 	movq   $0x7d0,0x2aa(%rip)        # 7c0 <freep>
+ 512:	d0 07 00 00 
+    base.s.size = 0;
+ 516:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 518:	48 c7 05 ad 02 00 00 	movq   $0x7d0,0x2ad(%rip)        # 7d0 <base>
+ 51f:	d0 07 00 00 
+    base.s.size = 0;
+ 523:	89 0d af 02 00 00    	mov    %ecx,0x2af(%rip)        # 7d8 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 529:	48 c7 c1 d0 07 00 00 	mov    $0x7d0,%rcx
+  if(nu < 4096)
+ 530:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 536:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 539:	44 39 e3             	cmp    %r12d,%ebx
+ 53c:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 540:	45 89 e5             	mov    %r12d,%r13d
+ 543:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 547:	8b 50 08             	mov    0x8(%rax),%edx
+ 54a:	39 da                	cmp    %ebx,%edx
+ 54c:	72 26                	jb     574 <malloc+0x8b>
+      if(p->s.size == nunits)
+ 54e:	75 08                	jne    558 <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 550:	48 8b 10             	mov    (%rax),%rdx
+ 553:	48 89 11             	mov    %rdx,(%rcx)
+ 556:	eb 0f                	jmp    567 <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 558:	29 da                	sub    %ebx,%edx
+ 55a:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 55d:	48 c1 e2 04          	shl    $0x4,%rdx
+ 561:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 564:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 567:	48 89 0d 52 02 00 00 	mov    %rcx,0x252(%rip)        # 7c0 <freep>
+      return (void*)(p + 1);
+ 56e:	48 83 c0 10          	add    $0x10,%rax
+ 572:	eb 3a                	jmp    5ae <malloc+0xc5>
+    }
+    if(p == freep)
+ 574:	48 39 05 45 02 00 00 	cmp    %rax,0x245(%rip)        # 7c0 <freep>
+ 57b:	75 27                	jne    5a4 <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 57d:	44 89 ef             	mov    %r13d,%edi
+ 580:	e8 96 fc ff ff       	call   21b <sbrk>
+  if(p == (char*)-1)
+ 585:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 589:	74 21                	je     5ac <malloc+0xc3>
+  hp->s.size = nu;
+ 58b:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 58f:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 593:	e8 dc fe ff ff       	call   474 <free>
+  return freep;
+ 598:	48 8b 05 21 02 00 00 	mov    0x221(%rip),%rax        # 7c0 <freep>
+      if((p = morecore(nunits)) == 0)
+ 59f:	48 85 c0             	test   %rax,%rax
+ 5a2:	74 08                	je     5ac <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 5a4:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 5a7:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 5aa:	eb 9b                	jmp    547 <malloc+0x5e>
+        return 0;
+ 5ac:	31 c0                	xor    %eax,%eax
+  }
+}
+ 5ae:	5a                   	pop    %rdx
+ 5af:	5b                   	pop    %rbx
+ 5b0:	41 5c                	pop    %r12
+ 5b2:	41 5d                	pop    %r13
+ 5b4:	5d                   	pop    %rbp
+ 5b5:	c3                   	ret
@@ -0,0 +1,511 @@
+
+.fs/forktest:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+  forktest();
+   4:	e8 34 00 00 00       	call   3d <forktest>
+  exit();
+   9:	e8 06 02 00 00       	call   214 <exit>
+
+000000000000000e <printf>:
+{
+   e:	55                   	push   %rbp
+   f:	48 89 e5             	mov    %rsp,%rbp
+  12:	41 54                	push   %r12
+  14:	41 89 fc             	mov    %edi,%r12d
+  write(fd, s, strlen(s));
+  17:	48 89 f7             	mov    %rsi,%rdi
+{
+  1a:	48 83 ec 18          	sub    $0x18,%rsp
+  write(fd, s, strlen(s));
+  1e:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+  22:	e8 da 00 00 00       	call   101 <strlen>
+  27:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  2b:	44 89 e7             	mov    %r12d,%edi
+  2e:	89 c2                	mov    %eax,%edx
+  30:	e8 ff 01 00 00       	call   234 <write>
+}
+  35:	48 83 c4 18          	add    $0x18,%rsp
+  39:	41 5c                	pop    %r12
+  3b:	5d                   	pop    %rbp
+  3c:	c3                   	ret
+
+000000000000003d <forktest>:
+{
+  3d:	55                   	push   %rbp
+  printf(1, "fork test\n");
+  3e:	48 c7 c6 bc 02 00 00 	mov    $0x2bc,%rsi
+  45:	bf 01 00 00 00       	mov    $0x1,%edi
+  4a:	31 c0                	xor    %eax,%eax
+{
+  4c:	48 89 e5             	mov    %rsp,%rbp
+  4f:	53                   	push   %rbx
+  for(n=0; n<N; n++){
+  50:	31 db                	xor    %ebx,%ebx
+{
+  52:	51                   	push   %rcx
+  printf(1, "fork test\n");
+  53:	e8 b6 ff ff ff       	call   e <printf>
+    pid = fork();
+  58:	e8 af 01 00 00       	call   20c <fork>
+    if(pid < 0)
+  5d:	85 c0                	test   %eax,%eax
+  5f:	78 2b                	js     8c <forktest+0x4f>
+    if(pid == 0)
+  61:	74 22                	je     85 <forktest+0x48>
+  for(n=0; n<N; n++){
+  63:	ff c3                	inc    %ebx
+  65:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  6b:	75 eb                	jne    58 <forktest+0x1b>
+    printf(1, "fork claimed to work N times!\n", N);
+  6d:	ba e8 03 00 00       	mov    $0x3e8,%edx
+  72:	48 c7 c6 c7 02 00 00 	mov    $0x2c7,%rsi
+  79:	bf 01 00 00 00       	mov    $0x1,%edi
+  7e:	31 c0                	xor    %eax,%eax
+  80:	e8 89 ff ff ff       	call   e <printf>
+    exit();
+  85:	e8 8a 01 00 00       	call   214 <exit>
+  for(; n > 0; n--){
+  8a:	ff cb                	dec    %ebx
+  8c:	85 db                	test   %ebx,%ebx
+  8e:	74 12                	je     a2 <forktest+0x65>
+    if(wait() < 0){
+  90:	e8 87 01 00 00       	call   21c <wait>
+  95:	85 c0                	test   %eax,%eax
+  97:	79 f1                	jns    8a <forktest+0x4d>
+      printf(1, "wait stopped early\n");
+  99:	48 c7 c6 e6 02 00 00 	mov    $0x2e6,%rsi
+  a0:	eb 10                	jmp    b2 <forktest+0x75>
+  if(wait() != -1){
+  a2:	e8 75 01 00 00       	call   21c <wait>
+  a7:	ff c0                	inc    %eax
+  a9:	74 15                	je     c0 <forktest+0x83>
+    printf(1, "wait got too many\n");
+  ab:	48 c7 c6 fa 02 00 00 	mov    $0x2fa,%rsi
+  b2:	bf 01 00 00 00       	mov    $0x1,%edi
+  b7:	31 c0                	xor    %eax,%eax
+  b9:	e8 50 ff ff ff       	call   e <printf>
+    exit();
+  be:	eb c5                	jmp    85 <forktest+0x48>
+}
+  c0:	5a                   	pop    %rdx
+  printf(1, "fork test OK\n");
+  c1:	48 c7 c6 0d 03 00 00 	mov    $0x30d,%rsi
+}
+  c8:	5b                   	pop    %rbx
+  printf(1, "fork test OK\n");
+  c9:	bf 01 00 00 00       	mov    $0x1,%edi
+  ce:	31 c0                	xor    %eax,%eax
+}
+  d0:	5d                   	pop    %rbp
+  printf(1, "fork test OK\n");
+  d1:	e9 38 ff ff ff       	jmp    e <printf>
+
+00000000000000d6 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  d6:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  d9:	31 d2                	xor    %edx,%edx
+  db:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+  de:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  e1:	48 ff c2             	inc    %rdx
+  e4:	84 c9                	test   %cl,%cl
+  e6:	75 f3                	jne    db <strcpy+0x5>
+    ;
+  return os;
+}
+  e8:	c3                   	ret
+
+00000000000000e9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+  e9:	31 c9                	xor    %ecx,%ecx
+  eb:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+  ef:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+  f3:	84 c0                	test   %al,%al
+  f5:	74 07                	je     fe <strcmp+0x15>
+  f7:	48 ff c1             	inc    %rcx
+  fa:	38 d0                	cmp    %dl,%al
+  fc:	74 ed                	je     eb <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+  fe:	29 d0                	sub    %edx,%eax
+}
+ 100:	c3                   	ret
+
+0000000000000101 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 101:	31 d2                	xor    %edx,%edx
+ 103:	48 89 d0             	mov    %rdx,%rax
+ 106:	48 ff c2             	inc    %rdx
+ 109:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+ 10e:	75 f3                	jne    103 <strlen+0x2>
+    ;
+  return n;
+}
+ 110:	c3                   	ret
+
+0000000000000111 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 111:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 114:	89 d1                	mov    %edx,%ecx
+ 116:	89 f0                	mov    %esi,%eax
+ 118:	fc                   	cld
+ 119:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 11b:	4c 89 c0             	mov    %r8,%rax
+ 11e:	c3                   	ret
+
+000000000000011f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+ 11f:	48 89 f8             	mov    %rdi,%rax
+ 122:	8a 10                	mov    (%rax),%dl
+ 124:	84 d2                	test   %dl,%dl
+ 126:	74 0a                	je     132 <strchr+0x13>
+    if(*s == c)
+ 128:	40 38 f2             	cmp    %sil,%dl
+ 12b:	74 07                	je     134 <strchr+0x15>
+  for(; *s; s++)
+ 12d:	48 ff c0             	inc    %rax
+ 130:	eb f0                	jmp    122 <strchr+0x3>
+      return (char*)s;
+  return 0;
+ 132:	31 c0                	xor    %eax,%eax
+}
+ 134:	c3                   	ret
+
+0000000000000135 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 135:	55                   	push   %rbp
+ 136:	48 89 e5             	mov    %rsp,%rbp
+ 139:	41 56                	push   %r14
+ 13b:	41 89 f6             	mov    %esi,%r14d
+ 13e:	41 55                	push   %r13
+ 140:	41 54                	push   %r12
+ 142:	49 89 fc             	mov    %rdi,%r12
+ 145:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 146:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+ 14b:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+ 14f:	41 89 dd             	mov    %ebx,%r13d
+ 152:	44 39 f3             	cmp    %r14d,%ebx
+ 155:	7d 29                	jge    180 <gets+0x4b>
+    cc = read(0, &c, 1);
+ 157:	31 ff                	xor    %edi,%edi
+ 159:	ba 01 00 00 00       	mov    $0x1,%edx
+ 15e:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 162:	e8 c5 00 00 00       	call   22c <read>
+    if(cc < 1)
+ 167:	85 c0                	test   %eax,%eax
+ 169:	7e 15                	jle    180 <gets+0x4b>
+      break;
+    buf[i++] = c;
+ 16b:	8a 45 df             	mov    -0x21(%rbp),%al
+ 16e:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+ 173:	48 ff c3             	inc    %rbx
+ 176:	3c 0a                	cmp    $0xa,%al
+ 178:	74 0a                	je     184 <gets+0x4f>
+ 17a:	3c 0d                	cmp    $0xd,%al
+ 17c:	75 d1                	jne    14f <gets+0x1a>
+ 17e:	eb 04                	jmp    184 <gets+0x4f>
+ 180:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 184:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 187:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 18a:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 18f:	5a                   	pop    %rdx
+ 190:	59                   	pop    %rcx
+ 191:	5b                   	pop    %rbx
+ 192:	41 5c                	pop    %r12
+ 194:	41 5d                	pop    %r13
+ 196:	41 5e                	pop    %r14
+ 198:	5d                   	pop    %rbp
+ 199:	c3                   	ret
+
+000000000000019a <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 19a:	55                   	push   %rbp
+ 19b:	48 89 e5             	mov    %rsp,%rbp
+ 19e:	41 55                	push   %r13
+ 1a0:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1a3:	31 f6                	xor    %esi,%esi
+{
+ 1a5:	41 54                	push   %r12
+ 1a7:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 1ab:	53                   	push   %rbx
+ 1ac:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 1ad:	e8 a2 00 00 00       	call   254 <open>
+  if(fd < 0)
+ 1b2:	85 c0                	test   %eax,%eax
+ 1b4:	78 16                	js     1cc <stat+0x32>
+ 1b6:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1b8:	89 c7                	mov    %eax,%edi
+ 1ba:	4c 89 ee             	mov    %r13,%rsi
+ 1bd:	e8 aa 00 00 00       	call   26c <fstat>
+  close(fd);
+ 1c2:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 1c4:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 1c7:	e8 70 00 00 00       	call   23c <close>
+  return r;
+}
+ 1cc:	5a                   	pop    %rdx
+ 1cd:	44 89 e0             	mov    %r12d,%eax
+ 1d0:	5b                   	pop    %rbx
+ 1d1:	41 5c                	pop    %r12
+ 1d3:	41 5d                	pop    %r13
+ 1d5:	5d                   	pop    %rbp
+ 1d6:	c3                   	ret
+
+00000000000001d7 <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 1d7:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 1d9:	0f be 17             	movsbl (%rdi),%edx
+ 1dc:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 1df:	80 f9 09             	cmp    $0x9,%cl
+ 1e2:	77 0c                	ja     1f0 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 1e4:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 1e7:	48 ff c7             	inc    %rdi
+ 1ea:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 1ee:	eb e9                	jmp    1d9 <atoi+0x2>
+  return n;
+}
+ 1f0:	c3                   	ret
+
+00000000000001f1 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 1f1:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1f4:	31 c9                	xor    %ecx,%ecx
+ 1f6:	89 d7                	mov    %edx,%edi
+ 1f8:	29 cf                	sub    %ecx,%edi
+ 1fa:	85 ff                	test   %edi,%edi
+ 1fc:	7e 0d                	jle    20b <memmove+0x1a>
+    *dst++ = *src++;
+ 1fe:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 202:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 206:	48 ff c1             	inc    %rcx
+ 209:	eb eb                	jmp    1f6 <memmove+0x5>
+  return vdst;
+}
+ 20b:	c3                   	ret
+
+000000000000020c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 20c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 211:	cd 40                	int    $0x40
+ 213:	c3                   	ret
+
+0000000000000214 <exit>:
+SYSCALL(exit)
+ 214:	b8 02 00 00 00       	mov    $0x2,%eax
+ 219:	cd 40                	int    $0x40
+ 21b:	c3                   	ret
+
+000000000000021c <wait>:
+SYSCALL(wait)
+ 21c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 221:	cd 40                	int    $0x40
+ 223:	c3                   	ret
+
+0000000000000224 <pipe>:
+SYSCALL(pipe)
+ 224:	b8 04 00 00 00       	mov    $0x4,%eax
+ 229:	cd 40                	int    $0x40
+ 22b:	c3                   	ret
+
+000000000000022c <read>:
+SYSCALL(read)
+ 22c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 231:	cd 40                	int    $0x40
+ 233:	c3                   	ret
+
+0000000000000234 <write>:
+SYSCALL(write)
+ 234:	b8 10 00 00 00       	mov    $0x10,%eax
+ 239:	cd 40                	int    $0x40
+ 23b:	c3                   	ret
+
+000000000000023c <close>:
+SYSCALL(close)
+ 23c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 241:	cd 40                	int    $0x40
+ 243:	c3                   	ret
+
+0000000000000244 <kill>:
+SYSCALL(kill)
+ 244:	b8 06 00 00 00       	mov    $0x6,%eax
+ 249:	cd 40                	int    $0x40
+ 24b:	c3                   	ret
+
+000000000000024c <exec>:
+SYSCALL(exec)
+ 24c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 251:	cd 40                	int    $0x40
+ 253:	c3                   	ret
+
+0000000000000254 <open>:
+SYSCALL(open)
+ 254:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 259:	cd 40                	int    $0x40
+ 25b:	c3                   	ret
+
+000000000000025c <mknod>:
+SYSCALL(mknod)
+ 25c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 261:	cd 40                	int    $0x40
+ 263:	c3                   	ret
+
+0000000000000264 <unlink>:
+SYSCALL(unlink)
+ 264:	b8 12 00 00 00       	mov    $0x12,%eax
+ 269:	cd 40                	int    $0x40
+ 26b:	c3                   	ret
+
+000000000000026c <fstat>:
+SYSCALL(fstat)
+ 26c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 271:	cd 40                	int    $0x40
+ 273:	c3                   	ret
+
+0000000000000274 <link>:
+SYSCALL(link)
+ 274:	b8 13 00 00 00       	mov    $0x13,%eax
+ 279:	cd 40                	int    $0x40
+ 27b:	c3                   	ret
+
+000000000000027c <mkdir>:
+SYSCALL(mkdir)
+ 27c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 281:	cd 40                	int    $0x40
+ 283:	c3                   	ret
+
+0000000000000284 <chdir>:
+SYSCALL(chdir)
+ 284:	b8 09 00 00 00       	mov    $0x9,%eax
+ 289:	cd 40                	int    $0x40
+ 28b:	c3                   	ret
+
+000000000000028c <dup>:
+SYSCALL(dup)
+ 28c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 291:	cd 40                	int    $0x40
+ 293:	c3                   	ret
+
+0000000000000294 <getpid>:
+SYSCALL(getpid)
+ 294:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 299:	cd 40                	int    $0x40
+ 29b:	c3                   	ret
+
+000000000000029c <sbrk>:
+SYSCALL(sbrk)
+ 29c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2a1:	cd 40                	int    $0x40
+ 2a3:	c3                   	ret
+
+00000000000002a4 <sleep>:
+SYSCALL(sleep)
+ 2a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2a9:	cd 40                	int    $0x40
+ 2ab:	c3                   	ret
+
+00000000000002ac <uptime>:
+SYSCALL(uptime)
+ 2ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2b1:	cd 40                	int    $0x40
+ 2b3:	c3                   	ret
+
+00000000000002b4 <chmod>:
+SYSCALL(chmod)
+ 2b4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 2b9:	cd 40                	int    $0x40
+ 2bb:	c3                   	ret
@@ -0,0 +1,1162 @@
+
+.fs/grep:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	41 57                	push   %r15
+   6:	41 56                	push   %r14
+   8:	41 55                	push   %r13
+   a:	41 54                	push   %r12
+   c:	53                   	push   %rbx
+   d:	50                   	push   %rax
+  int fd, i;
+  char *pattern;
+  
+  if(argc <= 1){
+   e:	83 ff 01             	cmp    $0x1,%edi
+  11:	7f 15                	jg     28 <main+0x28>
+    printf(2, "usage: grep pattern [file ...]\n");
+  13:	48 c7 c6 c0 07 00 00 	mov    $0x7c0,%rsi
+  1a:	bf 02 00 00 00       	mov    $0x2,%edi
+  1f:	31 c0                	xor    %eax,%eax
+  21:	e8 9d 04 00 00       	call   4c3 <printf>
+    exit();
+  26:	eb 16                	jmp    3e <main+0x3e>
+  }
+  pattern = argv[1];
+  28:	4c 8b 7e 08          	mov    0x8(%rsi),%r15
+  2c:	41 89 fc             	mov    %edi,%r12d
+  
+  if(argc <= 2){
+  2f:	83 ff 02             	cmp    $0x2,%edi
+  32:	75 0f                	jne    43 <main+0x43>
+    grep(pattern, 0);
+  34:	31 f6                	xor    %esi,%esi
+  36:	4c 89 ff             	mov    %r15,%rdi
+  39:	e8 39 01 00 00       	call   177 <grep>
+    exit();
+  3e:	e8 57 03 00 00       	call   39a <exit>
+  43:	48 8d 5e 10          	lea    0x10(%rsi),%rbx
+  }
+
+  for(i = 2; i < argc; i++){
+  47:	41 be 02 00 00 00    	mov    $0x2,%r14d
+    if((fd = open(argv[i], 0)) < 0){
+  4d:	48 8b 3b             	mov    (%rbx),%rdi
+  50:	31 f6                	xor    %esi,%esi
+  52:	e8 83 03 00 00       	call   3da <open>
+  57:	41 89 c5             	mov    %eax,%r13d
+  5a:	85 c0                	test   %eax,%eax
+  5c:	79 18                	jns    76 <main+0x76>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  5e:	48 8b 13             	mov    (%rbx),%rdx
+  61:	48 c7 c6 e0 07 00 00 	mov    $0x7e0,%rsi
+  68:	bf 01 00 00 00       	mov    $0x1,%edi
+  6d:	31 c0                	xor    %eax,%eax
+  6f:	e8 4f 04 00 00       	call   4c3 <printf>
+      exit();
+  74:	eb c8                	jmp    3e <main+0x3e>
+    }
+    grep(pattern, fd);
+  76:	89 c6                	mov    %eax,%esi
+  78:	4c 89 ff             	mov    %r15,%rdi
+  for(i = 2; i < argc; i++){
+  7b:	41 ff c6             	inc    %r14d
+  7e:	48 83 c3 08          	add    $0x8,%rbx
+    grep(pattern, fd);
+  82:	e8 f0 00 00 00       	call   177 <grep>
+    close(fd);
+  87:	44 89 ef             	mov    %r13d,%edi
+  8a:	e8 33 03 00 00       	call   3c2 <close>
+  for(i = 2; i < argc; i++){
+  8f:	45 39 f4             	cmp    %r14d,%r12d
+  92:	7f b9                	jg     4d <main+0x4d>
+  94:	eb a8                	jmp    3e <main+0x3e>
+
+0000000000000096 <matchstar>:
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+  96:	55                   	push   %rbp
+  97:	48 89 e5             	mov    %rsp,%rbp
+  9a:	41 55                	push   %r13
+  9c:	41 89 fd             	mov    %edi,%r13d
+  9f:	41 54                	push   %r12
+  a1:	49 89 f4             	mov    %rsi,%r12
+  a4:	53                   	push   %rbx
+  a5:	48 89 d3             	mov    %rdx,%rbx
+  a8:	51                   	push   %rcx
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+  a9:	48 89 de             	mov    %rbx,%rsi
+  ac:	4c 89 e7             	mov    %r12,%rdi
+  af:	e8 28 00 00 00       	call   dc <matchhere>
+  b4:	85 c0                	test   %eax,%eax
+  b6:	75 17                	jne    cf <matchstar+0x39>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+  b8:	0f be 13             	movsbl (%rbx),%edx
+  bb:	84 d2                	test   %dl,%dl
+  bd:	74 15                	je     d4 <matchstar+0x3e>
+  bf:	48 ff c3             	inc    %rbx
+  c2:	44 39 ea             	cmp    %r13d,%edx
+  c5:	74 e2                	je     a9 <matchstar+0x13>
+  c7:	41 83 fd 2e          	cmp    $0x2e,%r13d
+  cb:	74 dc                	je     a9 <matchstar+0x13>
+  cd:	eb 05                	jmp    d4 <matchstar+0x3e>
+      return 1;
+  cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  return 0;
+}
+  d4:	5a                   	pop    %rdx
+  d5:	5b                   	pop    %rbx
+  d6:	41 5c                	pop    %r12
+  d8:	41 5d                	pop    %r13
+  da:	5d                   	pop    %rbp
+  db:	c3                   	ret
+
+00000000000000dc <matchhere>:
+{
+  dc:	48 89 f2             	mov    %rsi,%rdx
+  if(re[0] == '\0')
+  df:	8a 07                	mov    (%rdi),%al
+  e1:	84 c0                	test   %al,%al
+  e3:	74 40                	je     125 <matchhere+0x49>
+  if(re[1] == '*')
+  e5:	40 8a 77 01          	mov    0x1(%rdi),%sil
+  e9:	40 80 fe 2a          	cmp    $0x2a,%sil
+  ed:	75 09                	jne    f8 <matchhere+0x1c>
+    return matchstar(re[0], re+2, text);
+  ef:	48 8d 77 02          	lea    0x2(%rdi),%rsi
+  f3:	0f be f8             	movsbl %al,%edi
+  f6:	eb 9e                	jmp    96 <matchstar>
+    return *text == '\0';
+  f8:	8a 0a                	mov    (%rdx),%cl
+  if(re[0] == '$' && re[1] == '\0')
+  fa:	3c 24                	cmp    $0x24,%al
+  fc:	75 13                	jne    111 <matchhere+0x35>
+  fe:	40 84 f6             	test   %sil,%sil
+ 101:	75 08                	jne    10b <matchhere+0x2f>
+    return *text == '\0';
+ 103:	31 c0                	xor    %eax,%eax
+ 105:	84 c9                	test   %cl,%cl
+ 107:	0f 94 c0             	sete   %al
+ 10a:	c3                   	ret
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 10b:	84 c9                	test   %cl,%cl
+ 10d:	75 0a                	jne    119 <matchhere+0x3d>
+ 10f:	eb 1a                	jmp    12b <matchhere+0x4f>
+ 111:	84 c9                	test   %cl,%cl
+ 113:	74 16                	je     12b <matchhere+0x4f>
+ 115:	3c 2e                	cmp    $0x2e,%al
+ 117:	74 04                	je     11d <matchhere+0x41>
+ 119:	38 c8                	cmp    %cl,%al
+ 11b:	75 0e                	jne    12b <matchhere+0x4f>
+    return matchhere(re+1, text+1);
+ 11d:	48 ff c2             	inc    %rdx
+ 120:	48 ff c7             	inc    %rdi
+ 123:	eb ba                	jmp    df <matchhere+0x3>
+    return 1;
+ 125:	b8 01 00 00 00       	mov    $0x1,%eax
+ 12a:	c3                   	ret
+  return 0;
+ 12b:	31 c0                	xor    %eax,%eax
+}
+ 12d:	c3                   	ret
+
+000000000000012e <match>:
+{
+ 12e:	55                   	push   %rbp
+ 12f:	48 89 e5             	mov    %rsp,%rbp
+ 132:	41 54                	push   %r12
+ 134:	49 89 fc             	mov    %rdi,%r12
+ 137:	48 83 ec 18          	sub    $0x18,%rsp
+  if(re[0] == '^')
+ 13b:	80 3f 5e             	cmpb   $0x5e,(%rdi)
+ 13e:	75 1a                	jne    15a <match+0x2c>
+}
+ 140:	48 83 c4 18          	add    $0x18,%rsp
+    return matchhere(re+1, text);
+ 144:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+}
+ 148:	41 5c                	pop    %r12
+ 14a:	5d                   	pop    %rbp
+    return matchhere(re+1, text);
+ 14b:	eb 8f                	jmp    dc <matchhere>
+  }while(*text++ != '\0');
+ 14d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+ 151:	48 ff c6             	inc    %rsi
+ 154:	80 7e ff 00          	cmpb   $0x0,-0x1(%rsi)
+ 158:	74 15                	je     16f <match+0x41>
+    if(matchhere(re, text))
+ 15a:	4c 89 e7             	mov    %r12,%rdi
+ 15d:	48 89 75 e8          	mov    %rsi,-0x18(%rbp)
+ 161:	e8 76 ff ff ff       	call   dc <matchhere>
+ 166:	85 c0                	test   %eax,%eax
+ 168:	74 e3                	je     14d <match+0x1f>
+      return 1;
+ 16a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 16f:	48 83 c4 18          	add    $0x18,%rsp
+ 173:	41 5c                	pop    %r12
+ 175:	5d                   	pop    %rbp
+ 176:	c3                   	ret
+
+0000000000000177 <grep>:
+{
+ 177:	55                   	push   %rbp
+ 178:	48 89 e5             	mov    %rsp,%rbp
+ 17b:	41 57                	push   %r15
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 17d:	41 bf ff 03 00 00    	mov    $0x3ff,%r15d
+{
+ 183:	41 56                	push   %r14
+ 185:	41 55                	push   %r13
+ 187:	41 54                	push   %r12
+ 189:	53                   	push   %rbx
+  m = 0;
+ 18a:	31 db                	xor    %ebx,%ebx
+{
+ 18c:	48 83 ec 18          	sub    $0x18,%rsp
+ 190:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+ 194:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 197:	44 89 fa             	mov    %r15d,%edx
+ 19a:	48 63 f3             	movslq %ebx,%rsi
+ 19d:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+ 1a0:	29 da                	sub    %ebx,%edx
+ 1a2:	48 81 c6 a0 0a 00 00 	add    $0xaa0,%rsi
+ 1a9:	e8 04 02 00 00       	call   3b2 <read>
+ 1ae:	85 c0                	test   %eax,%eax
+ 1b0:	0f 8e 97 00 00 00    	jle    24d <grep+0xd6>
+    m += n;
+ 1b6:	01 c3                	add    %eax,%ebx
+    p = buf;
+ 1b8:	49 c7 c4 a0 0a 00 00 	mov    $0xaa0,%r12
+    buf[m] = '\0';
+ 1bf:	48 63 c3             	movslq %ebx,%rax
+ 1c2:	c6 80 a0 0a 00 00 00 	movb   $0x0,0xaa0(%rax)
+    while((q = strchr(p, '\n')) != 0){
+ 1c9:	be 0a 00 00 00       	mov    $0xa,%esi
+ 1ce:	4c 89 e7             	mov    %r12,%rdi
+ 1d1:	e8 cf 00 00 00       	call   2a5 <strchr>
+ 1d6:	49 89 c5             	mov    %rax,%r13
+ 1d9:	48 85 c0             	test   %rax,%rax
+ 1dc:	74 36                	je     214 <grep+0x9d>
+      *q = 0;
+ 1de:	41 c6 45 00 00       	movb   $0x0,0x0(%r13)
+      if(match(pattern, p)){
+ 1e3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+ 1e7:	4c 89 e6             	mov    %r12,%rsi
+        write(1, p, q+1 - p);
+ 1ea:	4d 8d 75 01          	lea    0x1(%r13),%r14
+      if(match(pattern, p)){
+ 1ee:	e8 3b ff ff ff       	call   12e <match>
+ 1f3:	85 c0                	test   %eax,%eax
+ 1f5:	74 18                	je     20f <grep+0x98>
+        *q = '\n';
+ 1f7:	41 c6 45 00 0a       	movb   $0xa,0x0(%r13)
+        write(1, p, q+1 - p);
+ 1fc:	44 89 f2             	mov    %r14d,%edx
+ 1ff:	4c 89 e6             	mov    %r12,%rsi
+ 202:	bf 01 00 00 00       	mov    $0x1,%edi
+ 207:	44 29 e2             	sub    %r12d,%edx
+ 20a:	e8 ab 01 00 00       	call   3ba <write>
+      p = q+1;
+ 20f:	4d 89 f4             	mov    %r14,%r12
+ 212:	eb b5                	jmp    1c9 <grep+0x52>
+    if(p == buf)
+ 214:	49 81 fc a0 0a 00 00 	cmp    $0xaa0,%r12
+ 21b:	74 29                	je     246 <grep+0xcf>
+    if(m > 0){
+ 21d:	85 db                	test   %ebx,%ebx
+ 21f:	0f 8e 72 ff ff ff    	jle    197 <grep+0x20>
+      m -= p - buf;
+ 225:	4c 89 e0             	mov    %r12,%rax
+      memmove(buf, p, m);
+ 228:	4c 89 e6             	mov    %r12,%rsi
+ 22b:	48 c7 c7 a0 0a 00 00 	mov    $0xaa0,%rdi
+      m -= p - buf;
+ 232:	48 2d a0 0a 00 00    	sub    $0xaa0,%rax
+ 238:	29 c3                	sub    %eax,%ebx
+      memmove(buf, p, m);
+ 23a:	89 da                	mov    %ebx,%edx
+ 23c:	e8 36 01 00 00       	call   377 <memmove>
+ 241:	e9 51 ff ff ff       	jmp    197 <grep+0x20>
+      m = 0;
+ 246:	31 db                	xor    %ebx,%ebx
+ 248:	e9 4a ff ff ff       	jmp    197 <grep+0x20>
+}
+ 24d:	48 83 c4 18          	add    $0x18,%rsp
+ 251:	5b                   	pop    %rbx
+ 252:	41 5c                	pop    %r12
+ 254:	41 5d                	pop    %r13
+ 256:	41 5e                	pop    %r14
+ 258:	41 5f                	pop    %r15
+ 25a:	5d                   	pop    %rbp
+ 25b:	c3                   	ret
+
+000000000000025c <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 25c:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 25f:	31 d2                	xor    %edx,%edx
+ 261:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+ 264:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+ 267:	48 ff c2             	inc    %rdx
+ 26a:	84 c9                	test   %cl,%cl
+ 26c:	75 f3                	jne    261 <strcpy+0x5>
+    ;
+  return os;
+}
+ 26e:	c3                   	ret
+
+000000000000026f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+ 26f:	31 c9                	xor    %ecx,%ecx
+ 271:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+ 275:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+ 279:	84 c0                	test   %al,%al
+ 27b:	74 07                	je     284 <strcmp+0x15>
+ 27d:	48 ff c1             	inc    %rcx
+ 280:	38 d0                	cmp    %dl,%al
+ 282:	74 ed                	je     271 <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+ 284:	29 d0                	sub    %edx,%eax
+}
+ 286:	c3                   	ret
+
+0000000000000287 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 287:	31 d2                	xor    %edx,%edx
+ 289:	48 89 d0             	mov    %rdx,%rax
+ 28c:	48 ff c2             	inc    %rdx
+ 28f:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+ 294:	75 f3                	jne    289 <strlen+0x2>
+    ;
+  return n;
+}
+ 296:	c3                   	ret
+
+0000000000000297 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 297:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 29a:	89 d1                	mov    %edx,%ecx
+ 29c:	89 f0                	mov    %esi,%eax
+ 29e:	fc                   	cld
+ 29f:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2a1:	4c 89 c0             	mov    %r8,%rax
+ 2a4:	c3                   	ret
+
+00000000000002a5 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+ 2a5:	48 89 f8             	mov    %rdi,%rax
+ 2a8:	8a 10                	mov    (%rax),%dl
+ 2aa:	84 d2                	test   %dl,%dl
+ 2ac:	74 0a                	je     2b8 <strchr+0x13>
+    if(*s == c)
+ 2ae:	40 38 f2             	cmp    %sil,%dl
+ 2b1:	74 07                	je     2ba <strchr+0x15>
+  for(; *s; s++)
+ 2b3:	48 ff c0             	inc    %rax
+ 2b6:	eb f0                	jmp    2a8 <strchr+0x3>
+      return (char*)s;
+  return 0;
+ 2b8:	31 c0                	xor    %eax,%eax
+}
+ 2ba:	c3                   	ret
+
+00000000000002bb <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2bb:	55                   	push   %rbp
+ 2bc:	48 89 e5             	mov    %rsp,%rbp
+ 2bf:	41 56                	push   %r14
+ 2c1:	41 89 f6             	mov    %esi,%r14d
+ 2c4:	41 55                	push   %r13
+ 2c6:	41 54                	push   %r12
+ 2c8:	49 89 fc             	mov    %rdi,%r12
+ 2cb:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2cc:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+ 2d1:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+ 2d5:	41 89 dd             	mov    %ebx,%r13d
+ 2d8:	44 39 f3             	cmp    %r14d,%ebx
+ 2db:	7d 29                	jge    306 <gets+0x4b>
+    cc = read(0, &c, 1);
+ 2dd:	31 ff                	xor    %edi,%edi
+ 2df:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2e4:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 2e8:	e8 c5 00 00 00       	call   3b2 <read>
+    if(cc < 1)
+ 2ed:	85 c0                	test   %eax,%eax
+ 2ef:	7e 15                	jle    306 <gets+0x4b>
+      break;
+    buf[i++] = c;
+ 2f1:	8a 45 df             	mov    -0x21(%rbp),%al
+ 2f4:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+ 2f9:	48 ff c3             	inc    %rbx
+ 2fc:	3c 0a                	cmp    $0xa,%al
+ 2fe:	74 0a                	je     30a <gets+0x4f>
+ 300:	3c 0d                	cmp    $0xd,%al
+ 302:	75 d1                	jne    2d5 <gets+0x1a>
+ 304:	eb 04                	jmp    30a <gets+0x4f>
+ 306:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 30a:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 30d:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 310:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 315:	5a                   	pop    %rdx
+ 316:	59                   	pop    %rcx
+ 317:	5b                   	pop    %rbx
+ 318:	41 5c                	pop    %r12
+ 31a:	41 5d                	pop    %r13
+ 31c:	41 5e                	pop    %r14
+ 31e:	5d                   	pop    %rbp
+ 31f:	c3                   	ret
+
+0000000000000320 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 320:	55                   	push   %rbp
+ 321:	48 89 e5             	mov    %rsp,%rbp
+ 324:	41 55                	push   %r13
+ 326:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 329:	31 f6                	xor    %esi,%esi
+{
+ 32b:	41 54                	push   %r12
+ 32d:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 331:	53                   	push   %rbx
+ 332:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 333:	e8 a2 00 00 00       	call   3da <open>
+  if(fd < 0)
+ 338:	85 c0                	test   %eax,%eax
+ 33a:	78 16                	js     352 <stat+0x32>
+ 33c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 33e:	89 c7                	mov    %eax,%edi
+ 340:	4c 89 ee             	mov    %r13,%rsi
+ 343:	e8 aa 00 00 00       	call   3f2 <fstat>
+  close(fd);
+ 348:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 34a:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 34d:	e8 70 00 00 00       	call   3c2 <close>
+  return r;
+}
+ 352:	5a                   	pop    %rdx
+ 353:	44 89 e0             	mov    %r12d,%eax
+ 356:	5b                   	pop    %rbx
+ 357:	41 5c                	pop    %r12
+ 359:	41 5d                	pop    %r13
+ 35b:	5d                   	pop    %rbp
+ 35c:	c3                   	ret
+
+000000000000035d <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 35d:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 35f:	0f be 17             	movsbl (%rdi),%edx
+ 362:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 365:	80 f9 09             	cmp    $0x9,%cl
+ 368:	77 0c                	ja     376 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 36a:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 36d:	48 ff c7             	inc    %rdi
+ 370:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 374:	eb e9                	jmp    35f <atoi+0x2>
+  return n;
+}
+ 376:	c3                   	ret
+
+0000000000000377 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 377:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 37a:	31 c9                	xor    %ecx,%ecx
+ 37c:	89 d7                	mov    %edx,%edi
+ 37e:	29 cf                	sub    %ecx,%edi
+ 380:	85 ff                	test   %edi,%edi
+ 382:	7e 0d                	jle    391 <memmove+0x1a>
+    *dst++ = *src++;
+ 384:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 388:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 38c:	48 ff c1             	inc    %rcx
+ 38f:	eb eb                	jmp    37c <memmove+0x5>
+  return vdst;
+}
+ 391:	c3                   	ret
+
+0000000000000392 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 392:	b8 01 00 00 00       	mov    $0x1,%eax
+ 397:	cd 40                	int    $0x40
+ 399:	c3                   	ret
+
+000000000000039a <exit>:
+SYSCALL(exit)
+ 39a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 39f:	cd 40                	int    $0x40
+ 3a1:	c3                   	ret
+
+00000000000003a2 <wait>:
+SYSCALL(wait)
+ 3a2:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a7:	cd 40                	int    $0x40
+ 3a9:	c3                   	ret
+
+00000000000003aa <pipe>:
+SYSCALL(pipe)
+ 3aa:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3af:	cd 40                	int    $0x40
+ 3b1:	c3                   	ret
+
+00000000000003b2 <read>:
+SYSCALL(read)
+ 3b2:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+00000000000003ba <write>:
+SYSCALL(write)
+ 3ba:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+00000000000003c2 <close>:
+SYSCALL(close)
+ 3c2:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+00000000000003ca <kill>:
+SYSCALL(kill)
+ 3ca:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+00000000000003d2 <exec>:
+SYSCALL(exec)
+ 3d2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+00000000000003da <open>:
+SYSCALL(open)
+ 3da:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+00000000000003e2 <mknod>:
+SYSCALL(mknod)
+ 3e2:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+00000000000003ea <unlink>:
+SYSCALL(unlink)
+ 3ea:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+00000000000003f2 <fstat>:
+SYSCALL(fstat)
+ 3f2:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+00000000000003fa <link>:
+SYSCALL(link)
+ 3fa:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+0000000000000402 <mkdir>:
+SYSCALL(mkdir)
+ 402:	b8 14 00 00 00       	mov    $0x14,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+000000000000040a <chdir>:
+SYSCALL(chdir)
+ 40a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+0000000000000412 <dup>:
+SYSCALL(dup)
+ 412:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+000000000000041a <getpid>:
+SYSCALL(getpid)
+ 41a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+0000000000000422 <sbrk>:
+SYSCALL(sbrk)
+ 422:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+000000000000042a <sleep>:
+SYSCALL(sleep)
+ 42a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+0000000000000432 <uptime>:
+SYSCALL(uptime)
+ 432:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+000000000000043a <chmod>:
+SYSCALL(chmod)
+ 43a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+0000000000000442 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 442:	55                   	push   %rbp
+ 443:	48 89 e5             	mov    %rsp,%rbp
+ 446:	41 54                	push   %r12
+ 448:	41 89 fc             	mov    %edi,%r12d
+ 44b:	89 d7                	mov    %edx,%edi
+ 44d:	53                   	push   %rbx
+ 44e:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 452:	85 f6                	test   %esi,%esi
+ 454:	79 0f                	jns    465 <printint+0x23>
+ 456:	80 e1 01             	and    $0x1,%cl
+ 459:	74 0a                	je     465 <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 45b:	f7 de                	neg    %esi
+    neg = 1;
+ 45d:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 463:	eb 03                	jmp    468 <printint+0x26>
+  neg = 0;
+ 465:	45 31 c0             	xor    %r8d,%r8d
+ 468:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 46a:	89 f0                	mov    %esi,%eax
+ 46c:	31 d2                	xor    %edx,%edx
+ 46e:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 471:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 474:	f7 f7                	div    %edi
+ 476:	8a 92 00 08 00 00    	mov    0x800(%rdx),%dl
+ 47c:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 480:	89 f2                	mov    %esi,%edx
+ 482:	89 c6                	mov    %eax,%esi
+ 484:	39 fa                	cmp    %edi,%edx
+ 486:	73 e2                	jae    46a <printint+0x28>
+  if(neg)
+ 488:	45 85 c0             	test   %r8d,%r8d
+ 48b:	74 0a                	je     497 <printint+0x55>
+    buf[i++] = digits[x % base];
+ 48d:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 48f:	48 63 c3             	movslq %ebx,%rax
+ 492:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 497:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 49a:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 49e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 4a3:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 4a7:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 4aa:	48 ff cb             	dec    %rbx
+ 4ad:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 4b0:	e8 05 ff ff ff       	call   3ba <write>
+  while(--i >= 0)
+ 4b5:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 4b8:	75 e0                	jne    49a <printint+0x58>
+}
+ 4ba:	48 83 c4 20          	add    $0x20,%rsp
+ 4be:	5b                   	pop    %rbx
+ 4bf:	41 5c                	pop    %r12
+ 4c1:	5d                   	pop    %rbp
+ 4c2:	c3                   	ret
+
+00000000000004c3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4c3:	55                   	push   %rbp
+ 4c4:	48 89 e5             	mov    %rsp,%rbp
+ 4c7:	41 55                	push   %r13
+ 4c9:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 4cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 4cf:	53                   	push   %rbx
+ 4d0:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 4d4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 4d8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 4dc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 4e0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 4e4:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 4e8:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 4ec:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 4f0:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 4f2:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 4f9:	84 c0                	test   %al,%al
+ 4fb:	0f 84 6f 01 00 00    	je     670 <printf+0x1ad>
+ 501:	89 fb                	mov    %edi,%ebx
+ 503:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 506:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 509:	83 fa 25             	cmp    $0x25,%edx
+ 50c:	75 44                	jne    552 <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 50e:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 513:	49 ff c4             	inc    %r12
+ 516:	45 84 ed             	test   %r13b,%r13b
+ 519:	0f 84 51 01 00 00    	je     670 <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 51f:	41 0f b6 c5          	movzbl %r13b,%eax
+ 523:	41 0f be d5          	movsbl %r13b,%edx
+ 527:	83 f8 64             	cmp    $0x64,%eax
+ 52a:	74 7c                	je     5a8 <printf+0xe5>
+ 52c:	7f 29                	jg     557 <printf+0x94>
+ 52e:	83 f8 25             	cmp    $0x25,%eax
+ 531:	74 4c                	je     57f <printf+0xbc>
+ 533:	83 f8 63             	cmp    $0x63,%eax
+ 536:	75 33                	jne    56b <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 538:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 53b:	83 fa 2f             	cmp    $0x2f,%edx
+ 53e:	0f 87 1b 01 00 00    	ja     65f <printf+0x19c>
+ 544:	89 d0                	mov    %edx,%eax
+ 546:	83 c2 08             	add    $0x8,%edx
+ 549:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 54d:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 550:	8b 00                	mov    (%rax),%eax
+ 552:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 555:	eb 2c                	jmp    583 <printf+0xc0>
+ 557:	83 f8 73             	cmp    $0x73,%eax
+ 55a:	0f 84 aa 00 00 00    	je     60a <printf+0x147>
+ 560:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 566:	83 fa 70             	cmp    $0x70,%edx
+ 569:	74 6b                	je     5d6 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 56b:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 56f:	ba 01 00 00 00       	mov    $0x1,%edx
+ 574:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 578:	89 df                	mov    %ebx,%edi
+ 57a:	e8 3b fe ff ff       	call   3ba <write>
+        putc(fd, c);
+ 57f:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 583:	ba 01 00 00 00       	mov    $0x1,%edx
+ 588:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 58c:	89 df                	mov    %ebx,%edi
+ 58e:	e8 27 fe ff ff       	call   3ba <write>
+  for(i = 0; fmt[i]; i++){
+ 593:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 598:	49 ff c4             	inc    %r12
+ 59b:	84 c0                	test   %al,%al
+ 59d:	0f 85 63 ff ff ff    	jne    506 <printf+0x43>
+ 5a3:	e9 c8 00 00 00       	jmp    670 <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 5a8:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 5ab:	83 fa 2f             	cmp    $0x2f,%edx
+ 5ae:	77 0e                	ja     5be <printf+0xfb>
+ 5b0:	89 d0                	mov    %edx,%eax
+ 5b2:	83 c2 08             	add    $0x8,%edx
+ 5b5:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 5b9:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 5bc:	eb 0c                	jmp    5ca <printf+0x107>
+ 5be:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 5c2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 5c6:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 5ca:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 5cf:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 5d4:	eb 29                	jmp    5ff <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 5d6:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 5d9:	83 fa 2f             	cmp    $0x2f,%edx
+ 5dc:	77 0e                	ja     5ec <printf+0x129>
+ 5de:	89 d0                	mov    %edx,%eax
+ 5e0:	83 c2 08             	add    $0x8,%edx
+ 5e3:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 5e7:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 5ea:	eb 0c                	jmp    5f8 <printf+0x135>
+ 5ec:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 5f0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 5f4:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 5f8:	31 c9                	xor    %ecx,%ecx
+ 5fa:	ba 10 00 00 00       	mov    $0x10,%edx
+ 5ff:	8b 30                	mov    (%rax),%esi
+ 601:	89 df                	mov    %ebx,%edi
+ 603:	e8 3a fe ff ff       	call   442 <printint>
+ 608:	eb 89                	jmp    593 <printf+0xd0>
+        s = va_arg(ap, char*);
+ 60a:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 60d:	83 fa 2f             	cmp    $0x2f,%edx
+ 610:	77 0e                	ja     620 <printf+0x15d>
+ 612:	89 d0                	mov    %edx,%eax
+ 614:	83 c2 08             	add    $0x8,%edx
+ 617:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 61b:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 61e:	eb 0c                	jmp    62c <printf+0x169>
+ 620:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 624:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 628:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 62c:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 62f:	4d 85 ed             	test   %r13,%r13
+ 632:	75 07                	jne    63b <printf+0x178>
+          s = "(null)";
+ 634:	49 c7 c5 f6 07 00 00 	mov    $0x7f6,%r13
+        while(*s != 0){
+ 63b:	41 8a 45 00          	mov    0x0(%r13),%al
+ 63f:	84 c0                	test   %al,%al
+ 641:	0f 84 4c ff ff ff    	je     593 <printf+0xd0>
+          putc(fd, *s);
+ 647:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 64a:	ba 01 00 00 00       	mov    $0x1,%edx
+ 64f:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 653:	89 df                	mov    %ebx,%edi
+          s++;
+ 655:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 658:	e8 5d fd ff ff       	call   3ba <write>
+          s++;
+ 65d:	eb dc                	jmp    63b <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 65f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 663:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 667:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 66b:	e9 e0 fe ff ff       	jmp    550 <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	48 83 c4 58          	add    $0x58,%rsp
+ 674:	5b                   	pop    %rbx
+ 675:	41 5c                	pop    %r12
+ 677:	41 5d                	pop    %r13
+ 679:	5d                   	pop    %rbp
+ 67a:	c3                   	ret
+
+000000000000067b <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 67b:	48 8b 05 1e 08 00 00 	mov    0x81e(%rip),%rax        # ea0 <freep>
+{
+ 682:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 685:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 689:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 68c:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 68f:	48 39 f2             	cmp    %rsi,%rdx
+ 692:	72 0c                	jb     6a0 <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 694:	48 39 c6             	cmp    %rax,%rsi
+ 697:	73 f0                	jae    689 <free+0xe>
+ 699:	48 39 c2             	cmp    %rax,%rdx
+ 69c:	72 eb                	jb     689 <free+0xe>
+ 69e:	eb 05                	jmp    6a5 <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a0:	48 39 c6             	cmp    %rax,%rsi
+ 6a3:	73 f4                	jae    699 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6a5:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 6a8:	49 89 f8             	mov    %rdi,%r8
+ 6ab:	48 c1 e7 04          	shl    $0x4,%rdi
+ 6af:	48 01 f7             	add    %rsi,%rdi
+ 6b2:	48 39 f8             	cmp    %rdi,%rax
+ 6b5:	75 0e                	jne    6c5 <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 6b7:	44 03 40 08          	add    0x8(%rax),%r8d
+ 6bb:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6bf:	48 8b 02             	mov    (%rdx),%rax
+ 6c2:	48 8b 00             	mov    (%rax),%rax
+ 6c5:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6c9:	8b 42 08             	mov    0x8(%rdx),%eax
+ 6cc:	48 89 c7             	mov    %rax,%rdi
+ 6cf:	48 c1 e0 04          	shl    $0x4,%rax
+ 6d3:	48 01 d0             	add    %rdx,%rax
+ 6d6:	48 39 c6             	cmp    %rax,%rsi
+ 6d9:	75 0a                	jne    6e5 <free+0x6a>
+    p->s.size += bp->s.size;
+ 6db:	03 79 f8             	add    -0x8(%rcx),%edi
+ 6de:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 6e1:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 6e5:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 6e8:	48 89 15 b1 07 00 00 	mov    %rdx,0x7b1(%rip)        # ea0 <freep>
+}
+ 6ef:	c3                   	ret
+
+00000000000006f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6f0:	55                   	push   %rbp
+ 6f1:	48 89 e5             	mov    %rsp,%rbp
+ 6f4:	41 55                	push   %r13
+ 6f6:	41 54                	push   %r12
+ 6f8:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6f9:	89 fb                	mov    %edi,%ebx
+{
+ 6fb:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6fc:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 700:	48 8b 0d 99 07 00 00 	mov    0x799(%rip),%rcx        # ea0 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 707:	48 c1 eb 04          	shr    $0x4,%rbx
+ 70b:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 70d:	48 85 c9             	test   %rcx,%rcx
+ 710:	75 25                	jne    737 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 712:	48 c7 05 83 07 00 00 	movq   $0xeb0,0x783(%rip)        # ea0 <freep>
+ 719:	b0 0e 00 00 
+    base.s.size = 0;
+ 71d:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 71f:	48 c7 05 86 07 00 00 	movq   $0xeb0,0x786(%rip)        # eb0 <base>
+ 726:	b0 0e 00 00 
+    base.s.size = 0;
+ 72a:	89 0d 88 07 00 00    	mov    %ecx,0x788(%rip)        # eb8 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 730:	48 c7 c1 b0 0e 00 00 	mov    $0xeb0,%rcx
+  if(nu < 4096)
+ 737:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 73d:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 740:	44 39 e3             	cmp    %r12d,%ebx
+ 743:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 747:	45 89 e5             	mov    %r12d,%r13d
+ 74a:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 74e:	8b 50 08             	mov    0x8(%rax),%edx
+ 751:	39 da                	cmp    %ebx,%edx
+ 753:	72 26                	jb     77b <malloc+0x8b>
+      if(p->s.size == nunits)
+ 755:	75 08                	jne    75f <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 757:	48 8b 10             	mov    (%rax),%rdx
+ 75a:	48 89 11             	mov    %rdx,(%rcx)
+ 75d:	eb 0f                	jmp    76e <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 75f:	29 da                	sub    %ebx,%edx
+ 761:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 764:	48 c1 e2 04          	shl    $0x4,%rdx
+ 768:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 76b:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 76e:	48 89 0d 2b 07 00 00 	mov    %rcx,0x72b(%rip)        # ea0 <freep>
+      return (void*)(p + 1);
+ 775:	48 83 c0 10          	add    $0x10,%rax
+ 779:	eb 3a                	jmp    7b5 <malloc+0xc5>
+    }
+    if(p == freep)
+ 77b:	48 39 05 1e 07 00 00 	cmp    %rax,0x71e(%rip)        # ea0 <freep>
+ 782:	75 27                	jne    7ab <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 784:	44 89 ef             	mov    %r13d,%edi
+ 787:	e8 96 fc ff ff       	call   422 <sbrk>
+  if(p == (char*)-1)
+ 78c:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 790:	74 21                	je     7b3 <malloc+0xc3>
+  hp->s.size = nu;
+ 792:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 796:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 79a:	e8 dc fe ff ff       	call   67b <free>
+  return freep;
+ 79f:	48 8b 05 fa 06 00 00 	mov    0x6fa(%rip),%rax        # ea0 <freep>
+      if((p = morecore(nunits)) == 0)
+ 7a6:	48 85 c0             	test   %rax,%rax
+ 7a9:	74 08                	je     7b3 <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 7ab:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7ae:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 7b1:	eb 9b                	jmp    74e <malloc+0x5e>
+        return 0;
+ 7b3:	31 c0                	xor    %eax,%eax
+  }
+}
+ 7b5:	5a                   	pop    %rdx
+ 7b6:	5b                   	pop    %rbx
+ 7b7:	41 5c                	pop    %r12
+ 7b9:	41 5d                	pop    %r13
+ 7bb:	5d                   	pop    %rbp
+ 7bc:	c3                   	ret
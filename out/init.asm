@@ -0,0 +1,947 @@
+
+.fs/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	55                   	push   %rbp
+  int pid, wpid;
+
+
+  if(open("console", O_RDWR) < 0){
+   1:	be 02 00 00 00       	mov    $0x2,%esi
+   6:	48 c7 c7 40 06 00 00 	mov    $0x640,%rdi
+{
+   d:	48 89 e5             	mov    %rsp,%rbp
+  10:	53                   	push   %rbx
+  11:	50                   	push   %rax
+  if(open("console", O_RDWR) < 0){
+  12:	e8 43 02 00 00       	call   25a <open>
+  17:	85 c0                	test   %eax,%eax
+  19:	79 27                	jns    42 <main+0x42>
+    mknod("console", 1, 1);
+  1b:	be 01 00 00 00       	mov    $0x1,%esi
+  20:	48 c7 c7 40 06 00 00 	mov    $0x640,%rdi
+  27:	ba 01 00 00 00       	mov    $0x1,%edx
+  2c:	e8 31 02 00 00       	call   262 <mknod>
+    open("console", O_RDWR);
+  31:	be 02 00 00 00       	mov    $0x2,%esi
+  36:	48 c7 c7 40 06 00 00 	mov    $0x640,%rdi
+  3d:	e8 18 02 00 00       	call   25a <open>
+  }
+  dup(0);  // stdout
+  42:	31 ff                	xor    %edi,%edi
+  44:	e8 49 02 00 00       	call   292 <dup>
+  dup(0);  // stderr
+  49:	31 ff                	xor    %edi,%edi
+  4b:	e8 42 02 00 00       	call   292 <dup>
+
+  mknod("cpuid", CPUID, 1);
+  50:	ba 01 00 00 00       	mov    $0x1,%edx
+  55:	be 02 00 00 00       	mov    $0x2,%esi
+  5a:	48 c7 c7 48 06 00 00 	mov    $0x648,%rdi
+  61:	e8 fc 01 00 00       	call   262 <mknod>
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  66:	48 c7 c6 4e 06 00 00 	mov    $0x64e,%rsi
+  6d:	bf 01 00 00 00       	mov    $0x1,%edi
+  72:	31 c0                	xor    %eax,%eax
+  74:	e8 ca 02 00 00       	call   343 <printf>
+    pid = fork();
+  79:	e8 94 01 00 00       	call   212 <fork>
+  7e:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  80:	85 c0                	test   %eax,%eax
+  82:	79 09                	jns    8d <main+0x8d>
+      printf(1, "init: fork failed\n");
+  84:	48 c7 c6 61 06 00 00 	mov    $0x661,%rsi
+  8b:	eb 1c                	jmp    a9 <main+0xa9>
+      exit();
+    }
+    if(pid == 0){
+  8d:	75 42                	jne    d1 <main+0xd1>
+      exec("sh", argv);
+  8f:	48 c7 c6 80 08 00 00 	mov    $0x880,%rsi
+  96:	48 c7 c7 74 06 00 00 	mov    $0x674,%rdi
+  9d:	e8 b0 01 00 00       	call   252 <exec>
+      printf(1, "init: exec sh failed\n");
+  a2:	48 c7 c6 77 06 00 00 	mov    $0x677,%rsi
+  a9:	bf 01 00 00 00       	mov    $0x1,%edi
+  ae:	31 c0                	xor    %eax,%eax
+  b0:	e8 8e 02 00 00       	call   343 <printf>
+      exit();
+  b5:	e8 60 01 00 00       	call   21a <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  ba:	39 c3                	cmp    %eax,%ebx
+  bc:	74 a8                	je     66 <main+0x66>
+      printf(1, "zombie!\n");
+  be:	48 c7 c6 8d 06 00 00 	mov    $0x68d,%rsi
+  c5:	bf 01 00 00 00       	mov    $0x1,%edi
+  ca:	31 c0                	xor    %eax,%eax
+  cc:	e8 72 02 00 00       	call   343 <printf>
+    while((wpid=wait()) >= 0 && wpid != pid)
+  d1:	e8 4c 01 00 00       	call   222 <wait>
+  d6:	85 c0                	test   %eax,%eax
+  d8:	79 e0                	jns    ba <main+0xba>
+  da:	eb 8a                	jmp    66 <main+0x66>
+
+00000000000000dc <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  dc:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  df:	31 d2                	xor    %edx,%edx
+  e1:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+  e4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  e7:	48 ff c2             	inc    %rdx
+  ea:	84 c9                	test   %cl,%cl
+  ec:	75 f3                	jne    e1 <strcpy+0x5>
+    ;
+  return os;
+}
+  ee:	c3                   	ret
+
+00000000000000ef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+  ef:	31 c9                	xor    %ecx,%ecx
+  f1:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+  f5:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+  f9:	84 c0                	test   %al,%al
+  fb:	74 07                	je     104 <strcmp+0x15>
+  fd:	48 ff c1             	inc    %rcx
+ 100:	38 d0                	cmp    %dl,%al
+ 102:	74 ed                	je     f1 <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+ 104:	29 d0                	sub    %edx,%eax
+}
+ 106:	c3                   	ret
+
+0000000000000107 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 107:	31 d2                	xor    %edx,%edx
+ 109:	48 89 d0             	mov    %rdx,%rax
+ 10c:	48 ff c2             	inc    %rdx
+ 10f:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+ 114:	75 f3                	jne    109 <strlen+0x2>
+    ;
+  return n;
+}
+ 116:	c3                   	ret
+
+0000000000000117 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 117:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 11a:	89 d1                	mov    %edx,%ecx
+ 11c:	89 f0                	mov    %esi,%eax
+ 11e:	fc                   	cld
+ 11f:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 121:	4c 89 c0             	mov    %r8,%rax
+ 124:	c3                   	ret
+
+0000000000000125 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+ 125:	48 89 f8             	mov    %rdi,%rax
+ 128:	8a 10                	mov    (%rax),%dl
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	74 0a                	je     138 <strchr+0x13>
+    if(*s == c)
+ 12e:	40 38 f2             	cmp    %sil,%dl
+ 131:	74 07                	je     13a <strchr+0x15>
+  for(; *s; s++)
+ 133:	48 ff c0             	inc    %rax
+ 136:	eb f0                	jmp    128 <strchr+0x3>
+      return (char*)s;
+  return 0;
+ 138:	31 c0                	xor    %eax,%eax
+}
+ 13a:	c3                   	ret
+
+000000000000013b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 13b:	55                   	push   %rbp
+ 13c:	48 89 e5             	mov    %rsp,%rbp
+ 13f:	41 56                	push   %r14
+ 141:	41 89 f6             	mov    %esi,%r14d
+ 144:	41 55                	push   %r13
+ 146:	41 54                	push   %r12
+ 148:	49 89 fc             	mov    %rdi,%r12
+ 14b:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 14c:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+ 151:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+ 155:	41 89 dd             	mov    %ebx,%r13d
+ 158:	44 39 f3             	cmp    %r14d,%ebx
+ 15b:	7d 29                	jge    186 <gets+0x4b>
+    cc = read(0, &c, 1);
+ 15d:	31 ff                	xor    %edi,%edi
+ 15f:	ba 01 00 00 00       	mov    $0x1,%edx
+ 164:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 168:	e8 c5 00 00 00       	call   232 <read>
+    if(cc < 1)
+ 16d:	85 c0                	test   %eax,%eax
+ 16f:	7e 15                	jle    186 <gets+0x4b>
+      break;
+    buf[i++] = c;
+ 171:	8a 45 df             	mov    -0x21(%rbp),%al
+ 174:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+ 179:	48 ff c3             	inc    %rbx
+ 17c:	3c 0a                	cmp    $0xa,%al
+ 17e:	74 0a                	je     18a <gets+0x4f>
+ 180:	3c 0d                	cmp    $0xd,%al
+ 182:	75 d1                	jne    155 <gets+0x1a>
+ 184:	eb 04                	jmp    18a <gets+0x4f>
+ 186:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 18a:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 18d:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 190:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 195:	5a                   	pop    %rdx
+ 196:	59                   	pop    %rcx
+ 197:	5b                   	pop    %rbx
+ 198:	41 5c                	pop    %r12
+ 19a:	41 5d                	pop    %r13
+ 19c:	41 5e                	pop    %r14
+ 19e:	5d                   	pop    %rbp
+ 19f:	c3                   	ret
+
+00000000000001a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1a0:	55                   	push   %rbp
+ 1a1:	48 89 e5             	mov    %rsp,%rbp
+ 1a4:	41 55                	push   %r13
+ 1a6:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1a9:	31 f6                	xor    %esi,%esi
+{
+ 1ab:	41 54                	push   %r12
+ 1ad:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 1b1:	53                   	push   %rbx
+ 1b2:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 1b3:	e8 a2 00 00 00       	call   25a <open>
+  if(fd < 0)
+ 1b8:	85 c0                	test   %eax,%eax
+ 1ba:	78 16                	js     1d2 <stat+0x32>
+ 1bc:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1be:	89 c7                	mov    %eax,%edi
+ 1c0:	4c 89 ee             	mov    %r13,%rsi
+ 1c3:	e8 aa 00 00 00       	call   272 <fstat>
+  close(fd);
+ 1c8:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 1ca:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 1cd:	e8 70 00 00 00       	call   242 <close>
+  return r;
+}
+ 1d2:	5a                   	pop    %rdx
+ 1d3:	44 89 e0             	mov    %r12d,%eax
+ 1d6:	5b                   	pop    %rbx
+ 1d7:	41 5c                	pop    %r12
+ 1d9:	41 5d                	pop    %r13
+ 1db:	5d                   	pop    %rbp
+ 1dc:	c3                   	ret
+
+00000000000001dd <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 1dd:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 1df:	0f be 17             	movsbl (%rdi),%edx
+ 1e2:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 1e5:	80 f9 09             	cmp    $0x9,%cl
+ 1e8:	77 0c                	ja     1f6 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 1ea:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 1ed:	48 ff c7             	inc    %rdi
+ 1f0:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 1f4:	eb e9                	jmp    1df <atoi+0x2>
+  return n;
+}
+ 1f6:	c3                   	ret
+
+00000000000001f7 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 1f7:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 1fa:	31 c9                	xor    %ecx,%ecx
+ 1fc:	89 d7                	mov    %edx,%edi
+ 1fe:	29 cf                	sub    %ecx,%edi
+ 200:	85 ff                	test   %edi,%edi
+ 202:	7e 0d                	jle    211 <memmove+0x1a>
+    *dst++ = *src++;
+ 204:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 208:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 20c:	48 ff c1             	inc    %rcx
+ 20f:	eb eb                	jmp    1fc <memmove+0x5>
+  return vdst;
+}
+ 211:	c3                   	ret
+
+0000000000000212 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 212:	b8 01 00 00 00       	mov    $0x1,%eax
+ 217:	cd 40                	int    $0x40
+ 219:	c3                   	ret
+
+000000000000021a <exit>:
+SYSCALL(exit)
+ 21a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 21f:	cd 40                	int    $0x40
+ 221:	c3                   	ret
+
+0000000000000222 <wait>:
+SYSCALL(wait)
+ 222:	b8 03 00 00 00       	mov    $0x3,%eax
+ 227:	cd 40                	int    $0x40
+ 229:	c3                   	ret
+
+000000000000022a <pipe>:
+SYSCALL(pipe)
+ 22a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 22f:	cd 40                	int    $0x40
+ 231:	c3                   	ret
+
+0000000000000232 <read>:
+SYSCALL(read)
+ 232:	b8 05 00 00 00       	mov    $0x5,%eax
+ 237:	cd 40                	int    $0x40
+ 239:	c3                   	ret
+
+000000000000023a <write>:
+SYSCALL(write)
+ 23a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 23f:	cd 40                	int    $0x40
+ 241:	c3                   	ret
+
+0000000000000242 <close>:
+SYSCALL(close)
+ 242:	b8 15 00 00 00       	mov    $0x15,%eax
+ 247:	cd 40                	int    $0x40
+ 249:	c3                   	ret
+
+000000000000024a <kill>:
+SYSCALL(kill)
+ 24a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 24f:	cd 40                	int    $0x40
+ 251:	c3                   	ret
+
+0000000000000252 <exec>:
+SYSCALL(exec)
+ 252:	b8 07 00 00 00       	mov    $0x7,%eax
+ 257:	cd 40                	int    $0x40
+ 259:	c3                   	ret
+
+000000000000025a <open>:
+SYSCALL(open)
+ 25a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 25f:	cd 40                	int    $0x40
+ 261:	c3                   	ret
+
+0000000000000262 <mknod>:
+SYSCALL(mknod)
+ 262:	b8 11 00 00 00       	mov    $0x11,%eax
+ 267:	cd 40                	int    $0x40
+ 269:	c3                   	ret
+
+000000000000026a <unlink>:
+SYSCALL(unlink)
+ 26a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 26f:	cd 40                	int    $0x40
+ 271:	c3                   	ret
+
+0000000000000272 <fstat>:
+SYSCALL(fstat)
+ 272:	b8 08 00 00 00       	mov    $0x8,%eax
+ 277:	cd 40                	int    $0x40
+ 279:	c3                   	ret
+
+000000000000027a <link>:
+SYSCALL(link)
+ 27a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 27f:	cd 40                	int    $0x40
+ 281:	c3                   	ret
+
+0000000000000282 <mkdir>:
+SYSCALL(mkdir)
+ 282:	b8 14 00 00 00       	mov    $0x14,%eax
+ 287:	cd 40                	int    $0x40
+ 289:	c3                   	ret
+
+000000000000028a <chdir>:
+SYSCALL(chdir)
+ 28a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 28f:	cd 40                	int    $0x40
+ 291:	c3                   	ret
+
+0000000000000292 <dup>:
+SYSCALL(dup)
+ 292:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 297:	cd 40                	int    $0x40
+ 299:	c3                   	ret
+
+000000000000029a <getpid>:
+SYSCALL(getpid)
+ 29a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 29f:	cd 40                	int    $0x40
+ 2a1:	c3                   	ret
+
+00000000000002a2 <sbrk>:
+SYSCALL(sbrk)
+ 2a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2a7:	cd 40                	int    $0x40
+ 2a9:	c3                   	ret
+
+00000000000002aa <sleep>:
+SYSCALL(sleep)
+ 2aa:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2af:	cd 40                	int    $0x40
+ 2b1:	c3                   	ret
+
+00000000000002b2 <uptime>:
+SYSCALL(uptime)
+ 2b2:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2b7:	cd 40                	int    $0x40
+ 2b9:	c3                   	ret
+
+00000000000002ba <chmod>:
+SYSCALL(chmod)
+ 2ba:	b8 16 00 00 00       	mov    $0x16,%eax
+ 2bf:	cd 40                	int    $0x40
+ 2c1:	c3                   	ret
+
+00000000000002c2 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 2c2:	55                   	push   %rbp
+ 2c3:	48 89 e5             	mov    %rsp,%rbp
+ 2c6:	41 54                	push   %r12
+ 2c8:	41 89 fc             	mov    %edi,%r12d
+ 2cb:	89 d7                	mov    %edx,%edi
+ 2cd:	53                   	push   %rbx
+ 2ce:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 2d2:	85 f6                	test   %esi,%esi
+ 2d4:	79 0f                	jns    2e5 <printint+0x23>
+ 2d6:	80 e1 01             	and    $0x1,%cl
+ 2d9:	74 0a                	je     2e5 <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 2db:	f7 de                	neg    %esi
+    neg = 1;
+ 2dd:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 2e3:	eb 03                	jmp    2e8 <printint+0x26>
+  neg = 0;
+ 2e5:	45 31 c0             	xor    %r8d,%r8d
+ 2e8:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 2ea:	89 f0                	mov    %esi,%eax
+ 2ec:	31 d2                	xor    %edx,%edx
+ 2ee:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 2f1:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 2f4:	f7 f7                	div    %edi
+ 2f6:	8a 92 a0 06 00 00    	mov    0x6a0(%rdx),%dl
+ 2fc:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 300:	89 f2                	mov    %esi,%edx
+ 302:	89 c6                	mov    %eax,%esi
+ 304:	39 fa                	cmp    %edi,%edx
+ 306:	73 e2                	jae    2ea <printint+0x28>
+  if(neg)
+ 308:	45 85 c0             	test   %r8d,%r8d
+ 30b:	74 0a                	je     317 <printint+0x55>
+    buf[i++] = digits[x % base];
+ 30d:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 30f:	48 63 c3             	movslq %ebx,%rax
+ 312:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 317:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 31a:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 31e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 323:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 327:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 32a:	48 ff cb             	dec    %rbx
+ 32d:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 330:	e8 05 ff ff ff       	call   23a <write>
+  while(--i >= 0)
+ 335:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 338:	75 e0                	jne    31a <printint+0x58>
+}
+ 33a:	48 83 c4 20          	add    $0x20,%rsp
+ 33e:	5b                   	pop    %rbx
+ 33f:	41 5c                	pop    %r12
+ 341:	5d                   	pop    %rbp
+ 342:	c3                   	ret
+
+0000000000000343 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 343:	55                   	push   %rbp
+ 344:	48 89 e5             	mov    %rsp,%rbp
+ 347:	41 55                	push   %r13
+ 349:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 34b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 34f:	53                   	push   %rbx
+ 350:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 354:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 358:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 35c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 360:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 364:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 368:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 36c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 370:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 372:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 379:	84 c0                	test   %al,%al
+ 37b:	0f 84 6f 01 00 00    	je     4f0 <printf+0x1ad>
+ 381:	89 fb                	mov    %edi,%ebx
+ 383:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 386:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 389:	83 fa 25             	cmp    $0x25,%edx
+ 38c:	75 44                	jne    3d2 <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 38e:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 393:	49 ff c4             	inc    %r12
+ 396:	45 84 ed             	test   %r13b,%r13b
+ 399:	0f 84 51 01 00 00    	je     4f0 <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 39f:	41 0f b6 c5          	movzbl %r13b,%eax
+ 3a3:	41 0f be d5          	movsbl %r13b,%edx
+ 3a7:	83 f8 64             	cmp    $0x64,%eax
+ 3aa:	74 7c                	je     428 <printf+0xe5>
+ 3ac:	7f 29                	jg     3d7 <printf+0x94>
+ 3ae:	83 f8 25             	cmp    $0x25,%eax
+ 3b1:	74 4c                	je     3ff <printf+0xbc>
+ 3b3:	83 f8 63             	cmp    $0x63,%eax
+ 3b6:	75 33                	jne    3eb <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 3b8:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3bb:	83 fa 2f             	cmp    $0x2f,%edx
+ 3be:	0f 87 1b 01 00 00    	ja     4df <printf+0x19c>
+ 3c4:	89 d0                	mov    %edx,%eax
+ 3c6:	83 c2 08             	add    $0x8,%edx
+ 3c9:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3cd:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3d0:	8b 00                	mov    (%rax),%eax
+ 3d2:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 3d5:	eb 2c                	jmp    403 <printf+0xc0>
+ 3d7:	83 f8 73             	cmp    $0x73,%eax
+ 3da:	0f 84 aa 00 00 00    	je     48a <printf+0x147>
+ 3e0:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 3e6:	83 fa 70             	cmp    $0x70,%edx
+ 3e9:	74 6b                	je     456 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 3eb:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 3ef:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3f4:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 3f8:	89 df                	mov    %ebx,%edi
+ 3fa:	e8 3b fe ff ff       	call   23a <write>
+        putc(fd, c);
+ 3ff:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 403:	ba 01 00 00 00       	mov    $0x1,%edx
+ 408:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 40c:	89 df                	mov    %ebx,%edi
+ 40e:	e8 27 fe ff ff       	call   23a <write>
+  for(i = 0; fmt[i]; i++){
+ 413:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 418:	49 ff c4             	inc    %r12
+ 41b:	84 c0                	test   %al,%al
+ 41d:	0f 85 63 ff ff ff    	jne    386 <printf+0x43>
+ 423:	e9 c8 00 00 00       	jmp    4f0 <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 428:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 42b:	83 fa 2f             	cmp    $0x2f,%edx
+ 42e:	77 0e                	ja     43e <printf+0xfb>
+ 430:	89 d0                	mov    %edx,%eax
+ 432:	83 c2 08             	add    $0x8,%edx
+ 435:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 439:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 43c:	eb 0c                	jmp    44a <printf+0x107>
+ 43e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 442:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 446:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 44a:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 44f:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 454:	eb 29                	jmp    47f <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 456:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 459:	83 fa 2f             	cmp    $0x2f,%edx
+ 45c:	77 0e                	ja     46c <printf+0x129>
+ 45e:	89 d0                	mov    %edx,%eax
+ 460:	83 c2 08             	add    $0x8,%edx
+ 463:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 467:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 46a:	eb 0c                	jmp    478 <printf+0x135>
+ 46c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 470:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 474:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 478:	31 c9                	xor    %ecx,%ecx
+ 47a:	ba 10 00 00 00       	mov    $0x10,%edx
+ 47f:	8b 30                	mov    (%rax),%esi
+ 481:	89 df                	mov    %ebx,%edi
+ 483:	e8 3a fe ff ff       	call   2c2 <printint>
+ 488:	eb 89                	jmp    413 <printf+0xd0>
+        s = va_arg(ap, char*);
+ 48a:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 48d:	83 fa 2f             	cmp    $0x2f,%edx
+ 490:	77 0e                	ja     4a0 <printf+0x15d>
+ 492:	89 d0                	mov    %edx,%eax
+ 494:	83 c2 08             	add    $0x8,%edx
+ 497:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 49b:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 49e:	eb 0c                	jmp    4ac <printf+0x169>
+ 4a0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 4a4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4a8:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 4ac:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 4af:	4d 85 ed             	test   %r13,%r13
+ 4b2:	75 07                	jne    4bb <printf+0x178>
+          s = "(null)";
+ 4b4:	49 c7 c5 96 06 00 00 	mov    $0x696,%r13
+        while(*s != 0){
+ 4bb:	41 8a 45 00          	mov    0x0(%r13),%al
+ 4bf:	84 c0                	test   %al,%al
+ 4c1:	0f 84 4c ff ff ff    	je     413 <printf+0xd0>
+          putc(fd, *s);
+ 4c7:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 4ca:	ba 01 00 00 00       	mov    $0x1,%edx
+ 4cf:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 4d3:	89 df                	mov    %ebx,%edi
+          s++;
+ 4d5:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 4d8:	e8 5d fd ff ff       	call   23a <write>
+          s++;
+ 4dd:	eb dc                	jmp    4bb <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 4df:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 4e3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4e7:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 4eb:	e9 e0 fe ff ff       	jmp    3d0 <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 4f0:	48 83 c4 58          	add    $0x58,%rsp
+ 4f4:	5b                   	pop    %rbx
+ 4f5:	41 5c                	pop    %r12
+ 4f7:	41 5d                	pop    %r13
+ 4f9:	5d                   	pop    %rbp
+ 4fa:	c3                   	ret
+
+00000000000004fb <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 4fb:	48 8b 05 8e 03 00 00 	mov    0x38e(%rip),%rax        # 890 <freep>
+{
+ 502:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 505:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 509:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 50c:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 50f:	48 39 f2             	cmp    %rsi,%rdx
+ 512:	72 0c                	jb     520 <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 514:	48 39 c6             	cmp    %rax,%rsi
+ 517:	73 f0                	jae    509 <free+0xe>
+ 519:	48 39 c2             	cmp    %rax,%rdx
+ 51c:	72 eb                	jb     509 <free+0xe>
+ 51e:	eb 05                	jmp    525 <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 520:	48 39 c6             	cmp    %rax,%rsi
+ 523:	73 f4                	jae    519 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 525:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 528:	49 89 f8             	mov    %rdi,%r8
+ 52b:	48 c1 e7 04          	shl    $0x4,%rdi
+ 52f:	48 01 f7             	add    %rsi,%rdi
+ 532:	48 39 f8             	cmp    %rdi,%rax
+ 535:	75 0e                	jne    545 <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 537:	44 03 40 08          	add    0x8(%rax),%r8d
+ 53b:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 53f:	48 8b 02             	mov    (%rdx),%rax
+ 542:	48 8b 00             	mov    (%rax),%rax
+ 545:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 549:	8b 42 08             	mov    0x8(%rdx),%eax
+ 54c:	48 89 c7             	mov    %rax,%rdi
+ 54f:	48 c1 e0 04          	shl    $0x4,%rax
+ 553:	48 01 d0             	add    %rdx,%rax
+ 556:	48 39 c6             	cmp    %rax,%rsi
+ 559:	75 0a                	jne    565 <free+0x6a>
+    p->s.size += bp->s.size;
+ 55b:	03 79 f8             	add    -0x8(%rcx),%edi
+ 55e:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 561:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 565:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 568:	48 89 15 21 03 00 00 	mov    %rdx,0x321(%rip)        # 890 <freep>
+}
+ 56f:	c3                   	ret
+
+0000000000000570 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 570:	55                   	push   %rbp
+ 571:	48 89 e5             	mov    %rsp,%rbp
+ 574:	41 55                	push   %r13
+ 576:	41 54                	push   %r12
+ 578:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 579:	89 fb                	mov    %edi,%ebx
+{
+ 57b:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 57c:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 580:	48 8b 0d 09 03 00 00 	mov    0x309(%rip),%rcx        # 890 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 587:	48 c1 eb 04          	shr    $0x4,%rbx
+ 58b:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 58d:	48 85 c9             	test   %rcx,%rcx
+ 590:	75 25                	jne    5b7 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 592:	48 c7 05 f3 02 00 00 	movq   $0x8a0,0x2f3(%rip)        # 890 <freep>
+ 599:	a0 08 00 00 
+    base.s.size = 0;
+ 59d:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 59f:	48 c7 05 f6 02 00 00 	movq   $0x8a0,0x2f6(%rip)        # 8a0 <base>
+ 5a6:	a0 08 00 00 
+    base.s.size = 0;
+ 5aa:	89 0d f8 02 00 00    	mov    %ecx,0x2f8(%rip)        # 8a8 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 5b0:	48 c7 c1 a0 08 00 00 	mov    $0x8a0,%rcx
+  if(nu < 4096)
+ 5b7:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 5bd:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 5c0:	44 39 e3             	cmp    %r12d,%ebx
+ 5c3:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 5c7:	45 89 e5             	mov    %r12d,%r13d
+ 5ca:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 5ce:	8b 50 08             	mov    0x8(%rax),%edx
+ 5d1:	39 da                	cmp    %ebx,%edx
+ 5d3:	72 26                	jb     5fb <malloc+0x8b>
+      if(p->s.size == nunits)
+ 5d5:	75 08                	jne    5df <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 5d7:	48 8b 10             	mov    (%rax),%rdx
+ 5da:	48 89 11             	mov    %rdx,(%rcx)
+ 5dd:	eb 0f                	jmp    5ee <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 5df:	29 da                	sub    %ebx,%edx
+ 5e1:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 5e4:	48 c1 e2 04          	shl    $0x4,%rdx
+ 5e8:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 5eb:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 5ee:	48 89 0d 9b 02 00 00 	mov    %rcx,0x29b(%rip)        # 890 <freep>
+      return (void*)(p + 1);
+ 5f5:	48 83 c0 10          	add    $0x10,%rax
+ 5f9:	eb 3a                	jmp    635 <malloc+0xc5>
+    }
+    if(p == freep)
+ 5fb:	48 39 05 8e 02 00 00 	cmp    %rax,0x28e(%rip)        # 890 <freep>
+ 602:	75 27                	jne    62b <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 604:	44 89 ef             	mov    %r13d,%edi
+ 607:	e8 96 fc ff ff       	call   2a2 <sbrk>
+  if(p == (char*)-1)
+ 60c:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 610:	74 21                	je     633 <malloc+0xc3>
+  hp->s.size = nu;
+ 612:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 616:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 61a:	e8 dc fe ff ff       	call   4fb <free>
+  return freep;
+ 61f:	48 8b 05 6a 02 00 00 	mov    0x26a(%rip),%rax        # 890 <freep>
+      if((p = morecore(nunits)) == 0)
+ 626:	48 85 c0             	test   %rax,%rax
+ 629:	74 08                	je     633 <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 62b:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 62e:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 631:	eb 9b                	jmp    5ce <malloc+0x5e>
+        return 0;
+ 633:	31 c0                	xor    %eax,%eax
+  }
+}
+ 635:	5a                   	pop    %rdx
+ 636:	5b                   	pop    %rbx
+ 637:	41 5c                	pop    %r12
+ 639:	41 5d                	pop    %r13
+ 63b:	5d                   	pop    %rbp
+ 63c:	c3                   	ret
@@ -0,0 +1,18664 @@
+
+out/kernel.elf:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+ffffffff80100000 <begin>:
+ffffffff80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%rax),%dh
+ffffffff80100006:	01 00                	add    %eax,(%rax)
+ffffffff80100008:	fe 4f 51             	decb   0x51(%rdi)
+ffffffff8010000b:	e4 00                	in     $0x0,%al
+ffffffff8010000d:	00 10                	add    %dl,(%rax)
+ffffffff8010000f:	00 00                	add    %al,(%rax)
+ffffffff80100011:	00 10                	add    %dl,(%rax)
+ffffffff80100013:	00 00                	add    %al,(%rax)
+ffffffff80100015:	c0 10 00             	rclb   $0x0,(%rax)
+ffffffff80100018:	00 80 11 00 20 00    	add    %al,0x200011(%rax)
+ffffffff8010001e:	10 00                	adc    %al,(%rax)
+
+ffffffff80100020 <mboot_entry>:
+  .long mboot_entry_addr
+
+mboot_entry:
+
+# zero 4 pages for our bootstrap page tables
+  xor %eax, %eax
+ffffffff80100020:	31 c0                	xor    %eax,%eax
+  mov $0x1000, %edi
+ffffffff80100022:	bf 00 10 00 00       	mov    $0x1000,%edi
+  mov $0x5000, %ecx
+ffffffff80100027:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  rep stosb
+ffffffff8010002c:	f3 aa                	rep stos %al,%es:(%rdi)
+
+# P4ML[0] -> 0x2000 (PDPT-A)
+  mov $(0x2000 | 3), %eax
+ffffffff8010002e:	b8 03 20 00 00       	mov    $0x2003,%eax
+  mov %eax, 0x1000
+ffffffff80100033:	a3 00 10 00 00 b8 03 	movabs %eax,0x3003b800001000
+ffffffff8010003a:	30 00 
+
+# P4ML[511] -> 0x3000 (PDPT-B)
+  mov $(0x3000 | 3), %eax
+ffffffff8010003c:	00 a3 f8 1f 00 00    	add    %ah,0x1ff8(%rbx)
+  mov %eax, 0x1FF8
+
+# PDPT-A[0] -> 0x4000 (PD)
+  mov $(0x4000 | 3), %eax
+ffffffff80100042:	b8 03 40 00 00       	mov    $0x4003,%eax
+  mov %eax, 0x2000
+ffffffff80100047:	a3 00 20 00 00 b8 03 	movabs %eax,0x4003b800002000
+ffffffff8010004e:	40 00 
+
+# PDPT-B[510] -> 0x4000 (PD)
+  mov $(0x4000 | 3), %eax
+ffffffff80100050:	00 a3 f0 3f 00 00    	add    %ah,0x3ff0(%rbx)
+  mov %eax, 0x3FF0
+
+# PD[0..511] -> 0..1022MB
+  mov $0x83, %eax
+ffffffff80100056:	b8 83 00 00 00       	mov    $0x83,%eax
+  mov $0x4000, %ebx
+ffffffff8010005b:	bb 00 40 00 00       	mov    $0x4000,%ebx
+  mov $512, %ecx
+ffffffff80100060:	b9 00 02 00 00       	mov    $0x200,%ecx
+
+ffffffff80100065 <ptbl_loop>:
+ptbl_loop:
+  mov %eax, (%ebx)
+ffffffff80100065:	89 03                	mov    %eax,(%rbx)
+  add $0x200000, %eax
+ffffffff80100067:	05 00 00 20 00       	add    $0x200000,%eax
+  add $0x8, %ebx
+ffffffff8010006c:	83 c3 08             	add    $0x8,%ebx
+  dec %ecx
+ffffffff8010006f:	49 75 f3             	rex.WB jne ffffffff80100065 <ptbl_loop>
+
+# Clear ebx for initial processor boot.
+# When secondary processors boot, they'll call through
+# entry32mp (from entryother), but with a nonzero ebx.
+# We'll reuse these bootstrap pagetables and GDT.
+  xor %ebx, %ebx
+ffffffff80100072:	31 db                	xor    %ebx,%ebx
+
+ffffffff80100074 <entry32mp>:
+
+.global entry32mp
+entry32mp:
+# CR3 -> 0x1000 (P4ML)
+  mov $0x1000, %eax
+ffffffff80100074:	b8 00 10 00 00       	mov    $0x1000,%eax
+  mov %eax, %cr3
+ffffffff80100079:	0f 22 d8             	mov    %rax,%cr3
+
+  lgdt (gdtr64 - mboot_header + mboot_load_addr)
+ffffffff8010007c:	0f 01 15 b0 00 10 00 	lgdt   0x1000b0(%rip)        # ffffffff80200133 <end+0xe8133>
+
+# Enable PAE - CR4.PAE=1
+  mov %cr4, %eax
+ffffffff80100083:	0f 20 e0             	mov    %cr4,%rax
+  bts $5, %eax
+ffffffff80100086:	0f ba e8 05          	bts    $0x5,%eax
+  mov %eax, %cr4
+ffffffff8010008a:	0f 22 e0             	mov    %rax,%cr4
+
+# enable long mode - EFER.LME=1
+  mov $0xc0000080, %ecx
+ffffffff8010008d:	b9 80 00 00 c0       	mov    $0xc0000080,%ecx
+  rdmsr
+ffffffff80100092:	0f 32                	rdmsr
+  bts $8, %eax
+ffffffff80100094:	0f ba e8 08          	bts    $0x8,%eax
+  wrmsr
+ffffffff80100098:	0f 30                	wrmsr
+
+# enable paging
+  mov %cr0, %eax
+ffffffff8010009a:	0f 20 c0             	mov    %cr0,%rax
+  bts $31, %eax
+ffffffff8010009d:	0f ba e8 1f          	bts    $0x1f,%eax
+  mov %eax, %cr0
+ffffffff801000a1:	0f 22 c0             	mov    %rax,%cr0
+
+# shift to 64bit segment
+  ljmp $8,$(entry64low - mboot_header + mboot_load_addr)
+ffffffff801000a4:	ea                   	(bad)
+ffffffff801000a5:	e0 00                	loopne ffffffff801000a7 <entry32mp+0x33>
+ffffffff801000a7:	10 00                	adc    %al,(%rax)
+ffffffff801000a9:	08 00                	or     %al,(%rax)
+ffffffff801000ab:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+ffffffff801000b0 <gdtr64>:
+ffffffff801000b0:	17                   	(bad)
+ffffffff801000b1:	00 c0                	add    %al,%al
+ffffffff801000b3:	00 10                	add    %dl,(%rax)
+ffffffff801000b5:	00 00                	add    %al,(%rax)
+ffffffff801000b7:	00 00                	add    %al,(%rax)
+ffffffff801000b9:	00 66 0f             	add    %ah,0xf(%rsi)
+ffffffff801000bc:	1f                   	(bad)
+ffffffff801000bd:	44 00 00             	add    %r8b,(%rax)
+
+ffffffff801000c0 <gdt64_begin>:
+	...
+ffffffff801000cc:	00 98 20 00 00 00    	add    %bl,0x20(%rax)
+ffffffff801000d2:	00 00                	add    %al,(%rax)
+ffffffff801000d4:	00                   	.byte 0x0
+ffffffff801000d5:	90                   	nop
+	...
+
+ffffffff801000d8 <gdt64_end>:
+ffffffff801000d8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+ffffffff801000df:	00 
+
+ffffffff801000e0 <entry64low>:
+gdt64_end:
+
+.align 16
+.code64
+entry64low:
+  movq $entry64high, %rax
+ffffffff801000e0:	48 c7 c0 e9 00 10 80 	mov    $0xffffffff801000e9,%rax
+  jmp *%rax
+ffffffff801000e7:	ff e0                	jmp    *%rax
+
+ffffffff801000e9 <_start>:
+.global _start
+_start:
+entry64high:
+
+# ensure data segment registers are sane
+  xor %rax, %rax
+ffffffff801000e9:	48 31 c0             	xor    %rax,%rax
+  mov %ax, %ss
+ffffffff801000ec:	8e d0                	mov    %eax,%ss
+  mov %ax, %ds
+ffffffff801000ee:	8e d8                	mov    %eax,%ds
+  mov %ax, %es
+ffffffff801000f0:	8e c0                	mov    %eax,%es
+  mov %ax, %fs
+ffffffff801000f2:	8e e0                	mov    %eax,%fs
+  mov %ax, %gs
+ffffffff801000f4:	8e e8                	mov    %eax,%gs
+
+# check to see if we're booting a secondary core
+  test %ebx, %ebx
+ffffffff801000f6:	85 db                	test   %ebx,%ebx
+  jnz entry64mp
+ffffffff801000f8:	75 11                	jne    ffffffff8010010b <entry64mp>
+
+# setup initial stack
+  mov $0xFFFFFFFF80010000, %rax
+ffffffff801000fa:	48 c7 c0 00 00 01 80 	mov    $0xffffffff80010000,%rax
+  mov %rax, %rsp
+ffffffff80100101:	48 89 c4             	mov    %rax,%rsp
+
+# enter main()
+  jmp main
+ffffffff80100104:	e9 52 49 00 00       	jmp    ffffffff80104a5b <main>
+
+ffffffff80100109 <__deadloop>:
+
+.global __deadloop
+__deadloop:
+# we should never return here...
+  jmp .
+ffffffff80100109:	eb fe                	jmp    ffffffff80100109 <__deadloop>
+
+ffffffff8010010b <entry64mp>:
+
+entry64mp:
+# obtain kstack from data block before entryother
+  mov $0x7000, %rax
+ffffffff8010010b:	48 c7 c0 00 70 00 00 	mov    $0x7000,%rax
+  mov -16(%rax), %rsp
+ffffffff80100112:	48 8b 60 f0          	mov    -0x10(%rax),%rsp
+  jmp mpenter
+ffffffff80100116:	e9 05 4a 00 00       	jmp    ffffffff80104b20 <mpenter>
+
+ffffffff8010011b <wrmsr>:
+
+.global wrmsr
+wrmsr:
+  mov %rdi, %rcx     # arg0 -> msrnum
+ffffffff8010011b:	48 89 f9             	mov    %rdi,%rcx
+  mov %rsi, %rax     # val.low -> eax
+ffffffff8010011e:	48 89 f0             	mov    %rsi,%rax
+  shr $32, %rsi
+ffffffff80100121:	48 c1 ee 20          	shr    $0x20,%rsi
+  mov %rsi, %rdx     # val.high -> edx
+ffffffff80100125:	48 89 f2             	mov    %rsi,%rdx
+  wrmsr
+ffffffff80100128:	0f 30                	wrmsr
+  retq
+ffffffff8010012a:	c3                   	ret
+
+ffffffff8010012b <binit>:
+  struct buf head;
+} bcache;
+
+void
+binit(void)
+{
+ffffffff8010012b:	55                   	push   %rbp
+ffffffff8010012c:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010012f:	48 83 ec 10          	sub    $0x10,%rsp
+  struct buf *b;
+
+  initlock(&bcache.lock, "bcache");
+ffffffff80100133:	48 c7 c6 18 a5 10 80 	mov    $0xffffffff8010a518,%rsi
+ffffffff8010013a:	48 c7 c7 00 c0 10 80 	mov    $0xffffffff8010c000,%rdi
+ffffffff80100141:	e8 54 68 00 00       	call   ffffffff8010699a <initlock>
+
+//PAGEBREAK!
+  // Create linked list of buffers
+  bcache.head.prev = &bcache.head;
+ffffffff80100146:	48 c7 05 d7 ff 00 00 	movq   $0xffffffff80110118,0xffd7(%rip)        # ffffffff80110128 <bcache+0x4128>
+ffffffff8010014d:	18 01 11 80 
+  bcache.head.next = &bcache.head;
+ffffffff80100151:	48 c7 05 d4 ff 00 00 	movq   $0xffffffff80110118,0xffd4(%rip)        # ffffffff80110130 <bcache+0x4130>
+ffffffff80100158:	18 01 11 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+ffffffff8010015c:	48 c7 45 f8 68 c0 10 	movq   $0xffffffff8010c068,-0x8(%rbp)
+ffffffff80100163:	80 
+ffffffff80100164:	eb 48                	jmp    ffffffff801001ae <binit+0x83>
+    b->next = bcache.head.next;
+ffffffff80100166:	48 8b 15 c3 ff 00 00 	mov    0xffc3(%rip),%rdx        # ffffffff80110130 <bcache+0x4130>
+ffffffff8010016d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100171:	48 89 50 18          	mov    %rdx,0x18(%rax)
+    b->prev = &bcache.head;
+ffffffff80100175:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100179:	48 c7 40 10 18 01 11 	movq   $0xffffffff80110118,0x10(%rax)
+ffffffff80100180:	80 
+    b->dev = -1;
+ffffffff80100181:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100185:	c7 40 04 ff ff ff ff 	movl   $0xffffffff,0x4(%rax)
+    bcache.head.next->prev = b;
+ffffffff8010018c:	48 8b 05 9d ff 00 00 	mov    0xff9d(%rip),%rax        # ffffffff80110130 <bcache+0x4130>
+ffffffff80100193:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80100197:	48 89 50 10          	mov    %rdx,0x10(%rax)
+    bcache.head.next = b;
+ffffffff8010019b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010019f:	48 89 05 8a ff 00 00 	mov    %rax,0xff8a(%rip)        # ffffffff80110130 <bcache+0x4130>
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+ffffffff801001a6:	48 81 45 f8 28 02 00 	addq   $0x228,-0x8(%rbp)
+ffffffff801001ad:	00 
+ffffffff801001ae:	48 c7 c0 18 01 11 80 	mov    $0xffffffff80110118,%rax
+ffffffff801001b5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ffffffff801001b9:	72 ab                	jb     ffffffff80100166 <binit+0x3b>
+  }
+}
+ffffffff801001bb:	90                   	nop
+ffffffff801001bc:	90                   	nop
+ffffffff801001bd:	c9                   	leave
+ffffffff801001be:	c3                   	ret
+
+ffffffff801001bf <bget>:
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return B_BUSY buffer.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+ffffffff801001bf:	55                   	push   %rbp
+ffffffff801001c0:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801001c3:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801001c7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ffffffff801001ca:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  struct buf *b;
+
+  acquire(&bcache.lock);
+ffffffff801001cd:	48 c7 c7 00 c0 10 80 	mov    $0xffffffff8010c000,%rdi
+ffffffff801001d4:	e8 f6 67 00 00       	call   ffffffff801069cf <acquire>
+
+ loop:
+  // Is the block already cached?
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+ffffffff801001d9:	48 8b 05 50 ff 00 00 	mov    0xff50(%rip),%rax        # ffffffff80110130 <bcache+0x4130>
+ffffffff801001e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff801001e4:	eb 6c                	jmp    ffffffff80100252 <bget+0x93>
+    if(b->dev == dev && b->blockno == blockno){
+ffffffff801001e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801001ea:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff801001ed:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ffffffff801001f0:	75 54                	jne    ffffffff80100246 <bget+0x87>
+ffffffff801001f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801001f6:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff801001f9:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+ffffffff801001fc:	75 48                	jne    ffffffff80100246 <bget+0x87>
+      if(!(b->flags & B_BUSY)){
+ffffffff801001fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100202:	8b 00                	mov    (%rax),%eax
+ffffffff80100204:	83 e0 01             	and    $0x1,%eax
+ffffffff80100207:	85 c0                	test   %eax,%eax
+ffffffff80100209:	75 26                	jne    ffffffff80100231 <bget+0x72>
+        b->flags |= B_BUSY;
+ffffffff8010020b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010020f:	8b 00                	mov    (%rax),%eax
+ffffffff80100211:	83 c8 01             	or     $0x1,%eax
+ffffffff80100214:	89 c2                	mov    %eax,%edx
+ffffffff80100216:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010021a:	89 10                	mov    %edx,(%rax)
+        release(&bcache.lock);
+ffffffff8010021c:	48 c7 c7 00 c0 10 80 	mov    $0xffffffff8010c000,%rdi
+ffffffff80100223:	e8 7e 68 00 00       	call   ffffffff80106aa6 <release>
+        return b;
+ffffffff80100228:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010022c:	e9 a4 00 00 00       	jmp    ffffffff801002d5 <bget+0x116>
+      }
+      sleep(b, &bcache.lock);
+ffffffff80100231:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100235:	48 c7 c6 00 c0 10 80 	mov    $0xffffffff8010c000,%rsi
+ffffffff8010023c:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010023f:	e8 0c 64 00 00       	call   ffffffff80106650 <sleep>
+      goto loop;
+ffffffff80100244:	eb 93                	jmp    ffffffff801001d9 <bget+0x1a>
+  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+ffffffff80100246:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010024a:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff8010024e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80100252:	48 81 7d f8 18 01 11 	cmpq   $0xffffffff80110118,-0x8(%rbp)
+ffffffff80100259:	80 
+ffffffff8010025a:	75 8a                	jne    ffffffff801001e6 <bget+0x27>
+  }
+
+  // Not cached; recycle some non-busy and clean buffer.
+  // "clean" because B_DIRTY and !B_BUSY means log.c
+  // hasn't yet committed the changes to the buffer.
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+ffffffff8010025c:	48 8b 05 c5 fe 00 00 	mov    0xfec5(%rip),%rax        # ffffffff80110128 <bcache+0x4128>
+ffffffff80100263:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80100267:	eb 56                	jmp    ffffffff801002bf <bget+0x100>
+    if((b->flags & B_BUSY) == 0 && (b->flags & B_DIRTY) == 0){
+ffffffff80100269:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010026d:	8b 00                	mov    (%rax),%eax
+ffffffff8010026f:	83 e0 01             	and    $0x1,%eax
+ffffffff80100272:	85 c0                	test   %eax,%eax
+ffffffff80100274:	75 3d                	jne    ffffffff801002b3 <bget+0xf4>
+ffffffff80100276:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010027a:	8b 00                	mov    (%rax),%eax
+ffffffff8010027c:	83 e0 04             	and    $0x4,%eax
+ffffffff8010027f:	85 c0                	test   %eax,%eax
+ffffffff80100281:	75 30                	jne    ffffffff801002b3 <bget+0xf4>
+      b->dev = dev;
+ffffffff80100283:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100287:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff8010028a:	89 50 04             	mov    %edx,0x4(%rax)
+      b->blockno = blockno;
+ffffffff8010028d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100291:	8b 55 e8             	mov    -0x18(%rbp),%edx
+ffffffff80100294:	89 50 08             	mov    %edx,0x8(%rax)
+      b->flags = B_BUSY;
+ffffffff80100297:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010029b:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+      release(&bcache.lock);
+ffffffff801002a1:	48 c7 c7 00 c0 10 80 	mov    $0xffffffff8010c000,%rdi
+ffffffff801002a8:	e8 f9 67 00 00       	call   ffffffff80106aa6 <release>
+      return b;
+ffffffff801002ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801002b1:	eb 22                	jmp    ffffffff801002d5 <bget+0x116>
+  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
+ffffffff801002b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801002b7:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff801002bb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff801002bf:	48 81 7d f8 18 01 11 	cmpq   $0xffffffff80110118,-0x8(%rbp)
+ffffffff801002c6:	80 
+ffffffff801002c7:	75 a0                	jne    ffffffff80100269 <bget+0xaa>
+    }
+  }
+  panic("bget: no buffers");
+ffffffff801002c9:	48 c7 c7 1f a5 10 80 	mov    $0xffffffff8010a51f,%rdi
+ffffffff801002d0:	e8 5a 06 00 00       	call   ffffffff8010092f <panic>
+}
+ffffffff801002d5:	c9                   	leave
+ffffffff801002d6:	c3                   	ret
+
+ffffffff801002d7 <bread>:
+
+// Return a B_BUSY buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+ffffffff801002d7:	55                   	push   %rbp
+ffffffff801002d8:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801002db:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801002df:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ffffffff801002e2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  struct buf *b;
+
+  b = bget(dev, blockno);
+ffffffff801002e5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+ffffffff801002e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff801002eb:	89 d6                	mov    %edx,%esi
+ffffffff801002ed:	89 c7                	mov    %eax,%edi
+ffffffff801002ef:	e8 cb fe ff ff       	call   ffffffff801001bf <bget>
+ffffffff801002f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(!(b->flags & B_VALID)) {
+ffffffff801002f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801002fc:	8b 00                	mov    (%rax),%eax
+ffffffff801002fe:	83 e0 02             	and    $0x2,%eax
+ffffffff80100301:	85 c0                	test   %eax,%eax
+ffffffff80100303:	75 0c                	jne    ffffffff80100311 <bread+0x3a>
+    iderw(b);
+ffffffff80100305:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100309:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010030c:	e8 81 36 00 00       	call   ffffffff80103992 <iderw>
+  }
+  return b;
+ffffffff80100311:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80100315:	c9                   	leave
+ffffffff80100316:	c3                   	ret
+
+ffffffff80100317 <bwrite>:
+
+// Write b's contents to disk.  Must be B_BUSY.
+void
+bwrite(struct buf *b)
+{
+ffffffff80100317:	55                   	push   %rbp
+ffffffff80100318:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010031b:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff8010031f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if((b->flags & B_BUSY) == 0)
+ffffffff80100323:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100327:	8b 00                	mov    (%rax),%eax
+ffffffff80100329:	83 e0 01             	and    $0x1,%eax
+ffffffff8010032c:	85 c0                	test   %eax,%eax
+ffffffff8010032e:	75 0c                	jne    ffffffff8010033c <bwrite+0x25>
+    panic("bwrite");
+ffffffff80100330:	48 c7 c7 30 a5 10 80 	mov    $0xffffffff8010a530,%rdi
+ffffffff80100337:	e8 f3 05 00 00       	call   ffffffff8010092f <panic>
+  b->flags |= B_DIRTY;
+ffffffff8010033c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100340:	8b 00                	mov    (%rax),%eax
+ffffffff80100342:	83 c8 04             	or     $0x4,%eax
+ffffffff80100345:	89 c2                	mov    %eax,%edx
+ffffffff80100347:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010034b:	89 10                	mov    %edx,(%rax)
+  iderw(b);
+ffffffff8010034d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100351:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100354:	e8 39 36 00 00       	call   ffffffff80103992 <iderw>
+}
+ffffffff80100359:	90                   	nop
+ffffffff8010035a:	c9                   	leave
+ffffffff8010035b:	c3                   	ret
+
+ffffffff8010035c <brelse>:
+
+// Release a B_BUSY buffer.
+// Move to the head of the MRU list.
+void
+brelse(struct buf *b)
+{
+ffffffff8010035c:	55                   	push   %rbp
+ffffffff8010035d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80100360:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80100364:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if((b->flags & B_BUSY) == 0)
+ffffffff80100368:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010036c:	8b 00                	mov    (%rax),%eax
+ffffffff8010036e:	83 e0 01             	and    $0x1,%eax
+ffffffff80100371:	85 c0                	test   %eax,%eax
+ffffffff80100373:	75 0c                	jne    ffffffff80100381 <brelse+0x25>
+    panic("brelse");
+ffffffff80100375:	48 c7 c7 37 a5 10 80 	mov    $0xffffffff8010a537,%rdi
+ffffffff8010037c:	e8 ae 05 00 00       	call   ffffffff8010092f <panic>
+
+  acquire(&bcache.lock);
+ffffffff80100381:	48 c7 c7 00 c0 10 80 	mov    $0xffffffff8010c000,%rdi
+ffffffff80100388:	e8 42 66 00 00       	call   ffffffff801069cf <acquire>
+
+  b->next->prev = b->prev;
+ffffffff8010038d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80100391:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff80100395:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80100399:	48 8b 52 10          	mov    0x10(%rdx),%rdx
+ffffffff8010039d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  b->prev->next = b->next;
+ffffffff801003a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801003a5:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff801003a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff801003ad:	48 8b 52 18          	mov    0x18(%rdx),%rdx
+ffffffff801003b1:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  b->next = bcache.head.next;
+ffffffff801003b5:	48 8b 15 74 fd 00 00 	mov    0xfd74(%rip),%rdx        # ffffffff80110130 <bcache+0x4130>
+ffffffff801003bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801003c0:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  b->prev = &bcache.head;
+ffffffff801003c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801003c8:	48 c7 40 10 18 01 11 	movq   $0xffffffff80110118,0x10(%rax)
+ffffffff801003cf:	80 
+  bcache.head.next->prev = b;
+ffffffff801003d0:	48 8b 05 59 fd 00 00 	mov    0xfd59(%rip),%rax        # ffffffff80110130 <bcache+0x4130>
+ffffffff801003d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff801003db:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  bcache.head.next = b;
+ffffffff801003df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801003e3:	48 89 05 46 fd 00 00 	mov    %rax,0xfd46(%rip)        # ffffffff80110130 <bcache+0x4130>
+
+  b->flags &= ~B_BUSY;
+ffffffff801003ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801003ee:	8b 00                	mov    (%rax),%eax
+ffffffff801003f0:	83 e0 fe             	and    $0xfffffffe,%eax
+ffffffff801003f3:	89 c2                	mov    %eax,%edx
+ffffffff801003f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801003f9:	89 10                	mov    %edx,(%rax)
+  wakeup(b);
+ffffffff801003fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801003ff:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100402:	e8 5d 63 00 00       	call   ffffffff80106764 <wakeup>
+
+  release(&bcache.lock);
+ffffffff80100407:	48 c7 c7 00 c0 10 80 	mov    $0xffffffff8010c000,%rdi
+ffffffff8010040e:	e8 93 66 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff80100413:	90                   	nop
+ffffffff80100414:	c9                   	leave
+ffffffff80100415:	c3                   	ret
+
+ffffffff80100416 <inb>:
+// Routines to let C code use special x86 instructions.
+
+static inline uchar
+inb(ushort port)
+{
+ffffffff80100416:	55                   	push   %rbp
+ffffffff80100417:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010041a:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff8010041e:	89 f8                	mov    %edi,%eax
+ffffffff80100420:	66 89 45 ec          	mov    %ax,-0x14(%rbp)
+  uchar data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+ffffffff80100424:	0f b7 45 ec          	movzwl -0x14(%rbp),%eax
+ffffffff80100428:	89 c2                	mov    %eax,%edx
+ffffffff8010042a:	ec                   	in     (%dx),%al
+ffffffff8010042b:	88 45 ff             	mov    %al,-0x1(%rbp)
+  return data;
+ffffffff8010042e:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+}
+ffffffff80100432:	c9                   	leave
+ffffffff80100433:	c3                   	ret
+
+ffffffff80100434 <outb>:
+               "memory", "cc");
+}
+
+static inline void
+outb(ushort port, uchar data)
+{
+ffffffff80100434:	55                   	push   %rbp
+ffffffff80100435:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80100438:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff8010043c:	89 fa                	mov    %edi,%edx
+ffffffff8010043e:	89 f0                	mov    %esi,%eax
+ffffffff80100440:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+ffffffff80100444:	88 45 f8             	mov    %al,-0x8(%rbp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+ffffffff80100447:	0f b6 45 f8          	movzbl -0x8(%rbp),%eax
+ffffffff8010044b:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+ffffffff8010044f:	ee                   	out    %al,(%dx)
+}
+ffffffff80100450:	90                   	nop
+ffffffff80100451:	c9                   	leave
+ffffffff80100452:	c3                   	ret
+
+ffffffff80100453 <lidt>:
+
+struct gatedesc;
+
+static inline void
+lidt(struct gatedesc *p, int size)
+{
+ffffffff80100453:	55                   	push   %rbp
+ffffffff80100454:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80100457:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff8010045b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff8010045f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  volatile ushort pd[5];
+
+  pd[0] = size-1;
+ffffffff80100462:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80100465:	83 e8 01             	sub    $0x1,%eax
+ffffffff80100468:	66 89 45 f6          	mov    %ax,-0xa(%rbp)
+  pd[1] = (uintp)p;
+ffffffff8010046c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100470:	66 89 45 f8          	mov    %ax,-0x8(%rbp)
+  pd[2] = (uintp)p >> 16;
+ffffffff80100474:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100478:	48 c1 e8 10          	shr    $0x10,%rax
+ffffffff8010047c:	66 89 45 fa          	mov    %ax,-0x6(%rbp)
+#if X64
+  pd[3] = (uintp)p >> 32;
+ffffffff80100480:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100484:	48 c1 e8 20          	shr    $0x20,%rax
+ffffffff80100488:	66 89 45 fc          	mov    %ax,-0x4(%rbp)
+  pd[4] = (uintp)p >> 48;
+ffffffff8010048c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100490:	48 c1 e8 30          	shr    $0x30,%rax
+ffffffff80100494:	66 89 45 fe          	mov    %ax,-0x2(%rbp)
+#endif
+  asm volatile("lidt (%0)" : : "r" (pd));
+ffffffff80100498:	48 8d 45 f6          	lea    -0xa(%rbp),%rax
+ffffffff8010049c:	0f 01 18             	lidt   (%rax)
+}
+ffffffff8010049f:	90                   	nop
+ffffffff801004a0:	c9                   	leave
+ffffffff801004a1:	c3                   	ret
+
+ffffffff801004a2 <cli>:
+  asm volatile("movw %0, %%gs" : : "r" (v));
+}
+
+static inline void
+cli(void)
+{
+ffffffff801004a2:	55                   	push   %rbp
+ffffffff801004a3:	48 89 e5             	mov    %rsp,%rbp
+  asm volatile("cli");
+ffffffff801004a6:	fa                   	cli
+}
+ffffffff801004a7:	90                   	nop
+ffffffff801004a8:	5d                   	pop    %rbp
+ffffffff801004a9:	c3                   	ret
+
+ffffffff801004aa <printptr>:
+} cons;
+
+static char digits[] = "0123456789abcdef";
+
+static void
+printptr(uintp x) {
+ffffffff801004aa:	55                   	push   %rbp
+ffffffff801004ab:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801004ae:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801004b2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  for (i = 0; i < (sizeof(uintp) * 2); i++, x <<= 4)
+ffffffff801004b6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff801004bd:	eb 22                	jmp    ffffffff801004e1 <printptr+0x37>
+    consputc(digits[x >> (sizeof(uintp) * 8 - 4)]);
+ffffffff801004bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801004c3:	48 c1 e8 3c          	shr    $0x3c,%rax
+ffffffff801004c7:	0f b6 80 00 b0 10 80 	movzbl -0x7fef5000(%rax),%eax
+ffffffff801004ce:	0f be c0             	movsbl %al,%eax
+ffffffff801004d1:	89 c7                	mov    %eax,%edi
+ffffffff801004d3:	e8 8e 06 00 00       	call   ffffffff80100b66 <consputc>
+  for (i = 0; i < (sizeof(uintp) * 2); i++, x <<= 4)
+ffffffff801004d8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff801004dc:	48 c1 65 e8 04       	shlq   $0x4,-0x18(%rbp)
+ffffffff801004e1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801004e4:	83 f8 0f             	cmp    $0xf,%eax
+ffffffff801004e7:	76 d6                	jbe    ffffffff801004bf <printptr+0x15>
+}
+ffffffff801004e9:	90                   	nop
+ffffffff801004ea:	90                   	nop
+ffffffff801004eb:	c9                   	leave
+ffffffff801004ec:	c3                   	ret
+
+ffffffff801004ed <printint>:
+
+static void
+printint(int xx, int base, int sign)
+{
+ffffffff801004ed:	55                   	push   %rbp
+ffffffff801004ee:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801004f1:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff801004f5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ffffffff801004f8:	89 75 d8             	mov    %esi,-0x28(%rbp)
+ffffffff801004fb:	89 55 d4             	mov    %edx,-0x2c(%rbp)
+  char buf[16];
+  int i;
+  uint x;
+
+  if(sign && (sign = xx < 0))
+ffffffff801004fe:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+ffffffff80100502:	74 1c                	je     ffffffff80100520 <printint+0x33>
+ffffffff80100504:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80100507:	c1 e8 1f             	shr    $0x1f,%eax
+ffffffff8010050a:	0f b6 c0             	movzbl %al,%eax
+ffffffff8010050d:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+ffffffff80100510:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+ffffffff80100514:	74 0a                	je     ffffffff80100520 <printint+0x33>
+    x = -xx;
+ffffffff80100516:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80100519:	f7 d8                	neg    %eax
+ffffffff8010051b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+ffffffff8010051e:	eb 06                	jmp    ffffffff80100526 <printint+0x39>
+  else
+    x = xx;
+ffffffff80100520:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80100523:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  i = 0;
+ffffffff80100526:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  do{
+    buf[i++] = digits[x % base];
+ffffffff8010052d:	8b 4d d8             	mov    -0x28(%rbp),%ecx
+ffffffff80100530:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80100533:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff80100538:	f7 f1                	div    %ecx
+ffffffff8010053a:	89 d1                	mov    %edx,%ecx
+ffffffff8010053c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010053f:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff80100542:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ffffffff80100545:	89 ca                	mov    %ecx,%edx
+ffffffff80100547:	0f b6 92 00 b0 10 80 	movzbl -0x7fef5000(%rdx),%edx
+ffffffff8010054e:	48 98                	cltq
+ffffffff80100550:	88 54 05 e0          	mov    %dl,-0x20(%rbp,%rax,1)
+  }while((x /= base) != 0);
+ffffffff80100554:	8b 75 d8             	mov    -0x28(%rbp),%esi
+ffffffff80100557:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff8010055a:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff8010055f:	f7 f6                	div    %esi
+ffffffff80100561:	89 45 f8             	mov    %eax,-0x8(%rbp)
+ffffffff80100564:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ffffffff80100568:	75 c3                	jne    ffffffff8010052d <printint+0x40>
+
+  if(sign)
+ffffffff8010056a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+ffffffff8010056e:	74 26                	je     ffffffff80100596 <printint+0xa9>
+    buf[i++] = '-';
+ffffffff80100570:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100573:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff80100576:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ffffffff80100579:	48 98                	cltq
+ffffffff8010057b:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ffffffff80100580:	eb 14                	jmp    ffffffff80100596 <printint+0xa9>
+    consputc(buf[i]);
+ffffffff80100582:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100585:	48 98                	cltq
+ffffffff80100587:	0f b6 44 05 e0       	movzbl -0x20(%rbp,%rax,1),%eax
+ffffffff8010058c:	0f be c0             	movsbl %al,%eax
+ffffffff8010058f:	89 c7                	mov    %eax,%edi
+ffffffff80100591:	e8 d0 05 00 00       	call   ffffffff80100b66 <consputc>
+  while(--i >= 0)
+ffffffff80100596:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ffffffff8010059a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff8010059e:	79 e2                	jns    ffffffff80100582 <printint+0x95>
+}
+ffffffff801005a0:	90                   	nop
+ffffffff801005a1:	90                   	nop
+ffffffff801005a2:	c9                   	leave
+ffffffff801005a3:	c3                   	ret
+
+ffffffff801005a4 <cprintf>:
+//PAGEBREAK: 50
+
+// Print to the console. only understands %d, %x, %p, %s.
+void
+cprintf(char *fmt, ...)
+{
+ffffffff801005a4:	55                   	push   %rbp
+ffffffff801005a5:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801005a8:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+ffffffff801005af:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+ffffffff801005b6:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+ffffffff801005bd:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+ffffffff801005c4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+ffffffff801005cb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+ffffffff801005d2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+ffffffff801005d9:	84 c0                	test   %al,%al
+ffffffff801005db:	74 20                	je     ffffffff801005fd <cprintf+0x59>
+ffffffff801005dd:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+ffffffff801005e1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+ffffffff801005e5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+ffffffff801005e9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+ffffffff801005ed:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+ffffffff801005f1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+ffffffff801005f5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+ffffffff801005f9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int i, c, locking;
+  char *s;
+
+  va_start(ap, fmt);
+ffffffff801005fd:	c7 85 20 ff ff ff 08 	movl   $0x8,-0xe0(%rbp)
+ffffffff80100604:	00 00 00 
+ffffffff80100607:	c7 85 24 ff ff ff 30 	movl   $0x30,-0xdc(%rbp)
+ffffffff8010060e:	00 00 00 
+ffffffff80100611:	48 8d 45 10          	lea    0x10(%rbp),%rax
+ffffffff80100615:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+ffffffff8010061c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+ffffffff80100623:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+
+  locking = cons.locking;
+ffffffff8010062a:	8b 05 78 fe 00 00    	mov    0xfe78(%rip),%eax        # ffffffff801104a8 <cons+0x68>
+ffffffff80100630:	89 85 3c ff ff ff    	mov    %eax,-0xc4(%rbp)
+  if(locking)
+ffffffff80100636:	83 bd 3c ff ff ff 00 	cmpl   $0x0,-0xc4(%rbp)
+ffffffff8010063d:	74 0c                	je     ffffffff8010064b <cprintf+0xa7>
+    acquire(&cons.lock);
+ffffffff8010063f:	48 c7 c7 40 04 11 80 	mov    $0xffffffff80110440,%rdi
+ffffffff80100646:	e8 84 63 00 00       	call   ffffffff801069cf <acquire>
+
+  if (fmt == 0)
+ffffffff8010064b:	48 83 bd 18 ff ff ff 	cmpq   $0x0,-0xe8(%rbp)
+ffffffff80100652:	00 
+ffffffff80100653:	75 0c                	jne    ffffffff80100661 <cprintf+0xbd>
+    panic("null fmt");
+ffffffff80100655:	48 c7 c7 3e a5 10 80 	mov    $0xffffffff8010a53e,%rdi
+ffffffff8010065c:	e8 ce 02 00 00       	call   ffffffff8010092f <panic>
+
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+ffffffff80100661:	c7 85 4c ff ff ff 00 	movl   $0x0,-0xb4(%rbp)
+ffffffff80100668:	00 00 00 
+ffffffff8010066b:	e9 73 02 00 00       	jmp    ffffffff801008e3 <cprintf+0x33f>
+    if(c != '%'){
+ffffffff80100670:	83 bd 38 ff ff ff 25 	cmpl   $0x25,-0xc8(%rbp)
+ffffffff80100677:	74 12                	je     ffffffff8010068b <cprintf+0xe7>
+      consputc(c);
+ffffffff80100679:	8b 85 38 ff ff ff    	mov    -0xc8(%rbp),%eax
+ffffffff8010067f:	89 c7                	mov    %eax,%edi
+ffffffff80100681:	e8 e0 04 00 00       	call   ffffffff80100b66 <consputc>
+      continue;
+ffffffff80100686:	e9 51 02 00 00       	jmp    ffffffff801008dc <cprintf+0x338>
+    }
+    c = fmt[++i] & 0xff;
+ffffffff8010068b:	83 85 4c ff ff ff 01 	addl   $0x1,-0xb4(%rbp)
+ffffffff80100692:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+ffffffff80100698:	48 63 d0             	movslq %eax,%rdx
+ffffffff8010069b:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+ffffffff801006a2:	48 01 d0             	add    %rdx,%rax
+ffffffff801006a5:	0f b6 00             	movzbl (%rax),%eax
+ffffffff801006a8:	0f be c0             	movsbl %al,%eax
+ffffffff801006ab:	25 ff 00 00 00       	and    $0xff,%eax
+ffffffff801006b0:	89 85 38 ff ff ff    	mov    %eax,-0xc8(%rbp)
+    if(c == 0)
+ffffffff801006b6:	83 bd 38 ff ff ff 00 	cmpl   $0x0,-0xc8(%rbp)
+ffffffff801006bd:	0f 84 53 02 00 00    	je     ffffffff80100916 <cprintf+0x372>
+      break;
+    switch(c){
+ffffffff801006c3:	83 bd 38 ff ff ff 78 	cmpl   $0x78,-0xc8(%rbp)
+ffffffff801006ca:	0f 84 b3 00 00 00    	je     ffffffff80100783 <cprintf+0x1df>
+ffffffff801006d0:	83 bd 38 ff ff ff 78 	cmpl   $0x78,-0xc8(%rbp)
+ffffffff801006d7:	0f 8f e7 01 00 00    	jg     ffffffff801008c4 <cprintf+0x320>
+ffffffff801006dd:	83 bd 38 ff ff ff 73 	cmpl   $0x73,-0xc8(%rbp)
+ffffffff801006e4:	0f 84 41 01 00 00    	je     ffffffff8010082b <cprintf+0x287>
+ffffffff801006ea:	83 bd 38 ff ff ff 73 	cmpl   $0x73,-0xc8(%rbp)
+ffffffff801006f1:	0f 8f cd 01 00 00    	jg     ffffffff801008c4 <cprintf+0x320>
+ffffffff801006f7:	83 bd 38 ff ff ff 70 	cmpl   $0x70,-0xc8(%rbp)
+ffffffff801006fe:	0f 84 d7 00 00 00    	je     ffffffff801007db <cprintf+0x237>
+ffffffff80100704:	83 bd 38 ff ff ff 70 	cmpl   $0x70,-0xc8(%rbp)
+ffffffff8010070b:	0f 8f b3 01 00 00    	jg     ffffffff801008c4 <cprintf+0x320>
+ffffffff80100711:	83 bd 38 ff ff ff 25 	cmpl   $0x25,-0xc8(%rbp)
+ffffffff80100718:	0f 84 9a 01 00 00    	je     ffffffff801008b8 <cprintf+0x314>
+ffffffff8010071e:	83 bd 38 ff ff ff 64 	cmpl   $0x64,-0xc8(%rbp)
+ffffffff80100725:	0f 85 99 01 00 00    	jne    ffffffff801008c4 <cprintf+0x320>
+    case 'd':
+      printint(va_arg(ap, int), 10, 1);
+ffffffff8010072b:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ffffffff80100731:	83 f8 2f             	cmp    $0x2f,%eax
+ffffffff80100734:	77 23                	ja     ffffffff80100759 <cprintf+0x1b5>
+ffffffff80100736:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ffffffff8010073d:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ffffffff80100743:	89 d2                	mov    %edx,%edx
+ffffffff80100745:	48 01 d0             	add    %rdx,%rax
+ffffffff80100748:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ffffffff8010074e:	83 c2 08             	add    $0x8,%edx
+ffffffff80100751:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ffffffff80100757:	eb 12                	jmp    ffffffff8010076b <cprintf+0x1c7>
+ffffffff80100759:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ffffffff80100760:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ffffffff80100764:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ffffffff8010076b:	8b 00                	mov    (%rax),%eax
+ffffffff8010076d:	ba 01 00 00 00       	mov    $0x1,%edx
+ffffffff80100772:	be 0a 00 00 00       	mov    $0xa,%esi
+ffffffff80100777:	89 c7                	mov    %eax,%edi
+ffffffff80100779:	e8 6f fd ff ff       	call   ffffffff801004ed <printint>
+      break;
+ffffffff8010077e:	e9 59 01 00 00       	jmp    ffffffff801008dc <cprintf+0x338>
+    case 'x':
+      printint(va_arg(ap, int), 16, 0);
+ffffffff80100783:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ffffffff80100789:	83 f8 2f             	cmp    $0x2f,%eax
+ffffffff8010078c:	77 23                	ja     ffffffff801007b1 <cprintf+0x20d>
+ffffffff8010078e:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ffffffff80100795:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ffffffff8010079b:	89 d2                	mov    %edx,%edx
+ffffffff8010079d:	48 01 d0             	add    %rdx,%rax
+ffffffff801007a0:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ffffffff801007a6:	83 c2 08             	add    $0x8,%edx
+ffffffff801007a9:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ffffffff801007af:	eb 12                	jmp    ffffffff801007c3 <cprintf+0x21f>
+ffffffff801007b1:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ffffffff801007b8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ffffffff801007bc:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ffffffff801007c3:	8b 00                	mov    (%rax),%eax
+ffffffff801007c5:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff801007ca:	be 10 00 00 00       	mov    $0x10,%esi
+ffffffff801007cf:	89 c7                	mov    %eax,%edi
+ffffffff801007d1:	e8 17 fd ff ff       	call   ffffffff801004ed <printint>
+      break;
+ffffffff801007d6:	e9 01 01 00 00       	jmp    ffffffff801008dc <cprintf+0x338>
+    case 'p':
+      printptr(va_arg(ap, uintp));
+ffffffff801007db:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ffffffff801007e1:	83 f8 2f             	cmp    $0x2f,%eax
+ffffffff801007e4:	77 23                	ja     ffffffff80100809 <cprintf+0x265>
+ffffffff801007e6:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ffffffff801007ed:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ffffffff801007f3:	89 d2                	mov    %edx,%edx
+ffffffff801007f5:	48 01 d0             	add    %rdx,%rax
+ffffffff801007f8:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ffffffff801007fe:	83 c2 08             	add    $0x8,%edx
+ffffffff80100801:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ffffffff80100807:	eb 12                	jmp    ffffffff8010081b <cprintf+0x277>
+ffffffff80100809:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ffffffff80100810:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ffffffff80100814:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ffffffff8010081b:	48 8b 00             	mov    (%rax),%rax
+ffffffff8010081e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100821:	e8 84 fc ff ff       	call   ffffffff801004aa <printptr>
+      break;
+ffffffff80100826:	e9 b1 00 00 00       	jmp    ffffffff801008dc <cprintf+0x338>
+    case 's':
+      if((s = va_arg(ap, char*)) == 0)
+ffffffff8010082b:	8b 85 20 ff ff ff    	mov    -0xe0(%rbp),%eax
+ffffffff80100831:	83 f8 2f             	cmp    $0x2f,%eax
+ffffffff80100834:	77 23                	ja     ffffffff80100859 <cprintf+0x2b5>
+ffffffff80100836:	48 8b 85 30 ff ff ff 	mov    -0xd0(%rbp),%rax
+ffffffff8010083d:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ffffffff80100843:	89 d2                	mov    %edx,%edx
+ffffffff80100845:	48 01 d0             	add    %rdx,%rax
+ffffffff80100848:	8b 95 20 ff ff ff    	mov    -0xe0(%rbp),%edx
+ffffffff8010084e:	83 c2 08             	add    $0x8,%edx
+ffffffff80100851:	89 95 20 ff ff ff    	mov    %edx,-0xe0(%rbp)
+ffffffff80100857:	eb 12                	jmp    ffffffff8010086b <cprintf+0x2c7>
+ffffffff80100859:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+ffffffff80100860:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ffffffff80100864:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+ffffffff8010086b:	48 8b 00             	mov    (%rax),%rax
+ffffffff8010086e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+ffffffff80100875:	48 83 bd 40 ff ff ff 	cmpq   $0x0,-0xc0(%rbp)
+ffffffff8010087c:	00 
+ffffffff8010087d:	75 29                	jne    ffffffff801008a8 <cprintf+0x304>
+        s = "(null)";
+ffffffff8010087f:	48 c7 85 40 ff ff ff 	movq   $0xffffffff8010a547,-0xc0(%rbp)
+ffffffff80100886:	47 a5 10 80 
+      for(; *s; s++)
+ffffffff8010088a:	eb 1c                	jmp    ffffffff801008a8 <cprintf+0x304>
+        consputc(*s);
+ffffffff8010088c:	48 8b 85 40 ff ff ff 	mov    -0xc0(%rbp),%rax
+ffffffff80100893:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80100896:	0f be c0             	movsbl %al,%eax
+ffffffff80100899:	89 c7                	mov    %eax,%edi
+ffffffff8010089b:	e8 c6 02 00 00       	call   ffffffff80100b66 <consputc>
+      for(; *s; s++)
+ffffffff801008a0:	48 83 85 40 ff ff ff 	addq   $0x1,-0xc0(%rbp)
+ffffffff801008a7:	01 
+ffffffff801008a8:	48 8b 85 40 ff ff ff 	mov    -0xc0(%rbp),%rax
+ffffffff801008af:	0f b6 00             	movzbl (%rax),%eax
+ffffffff801008b2:	84 c0                	test   %al,%al
+ffffffff801008b4:	75 d6                	jne    ffffffff8010088c <cprintf+0x2e8>
+      break;
+ffffffff801008b6:	eb 24                	jmp    ffffffff801008dc <cprintf+0x338>
+    case '%':
+      consputc('%');
+ffffffff801008b8:	bf 25 00 00 00       	mov    $0x25,%edi
+ffffffff801008bd:	e8 a4 02 00 00       	call   ffffffff80100b66 <consputc>
+      break;
+ffffffff801008c2:	eb 18                	jmp    ffffffff801008dc <cprintf+0x338>
+    default:
+      // Print unknown % sequence to draw attention.
+      consputc('%');
+ffffffff801008c4:	bf 25 00 00 00       	mov    $0x25,%edi
+ffffffff801008c9:	e8 98 02 00 00       	call   ffffffff80100b66 <consputc>
+      consputc(c);
+ffffffff801008ce:	8b 85 38 ff ff ff    	mov    -0xc8(%rbp),%eax
+ffffffff801008d4:	89 c7                	mov    %eax,%edi
+ffffffff801008d6:	e8 8b 02 00 00       	call   ffffffff80100b66 <consputc>
+      break;
+ffffffff801008db:	90                   	nop
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+ffffffff801008dc:	83 85 4c ff ff ff 01 	addl   $0x1,-0xb4(%rbp)
+ffffffff801008e3:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+ffffffff801008e9:	48 63 d0             	movslq %eax,%rdx
+ffffffff801008ec:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+ffffffff801008f3:	48 01 d0             	add    %rdx,%rax
+ffffffff801008f6:	0f b6 00             	movzbl (%rax),%eax
+ffffffff801008f9:	0f be c0             	movsbl %al,%eax
+ffffffff801008fc:	25 ff 00 00 00       	and    $0xff,%eax
+ffffffff80100901:	89 85 38 ff ff ff    	mov    %eax,-0xc8(%rbp)
+ffffffff80100907:	83 bd 38 ff ff ff 00 	cmpl   $0x0,-0xc8(%rbp)
+ffffffff8010090e:	0f 85 5c fd ff ff    	jne    ffffffff80100670 <cprintf+0xcc>
+ffffffff80100914:	eb 01                	jmp    ffffffff80100917 <cprintf+0x373>
+      break;
+ffffffff80100916:	90                   	nop
+    }
+  }
+
+  if(locking)
+ffffffff80100917:	83 bd 3c ff ff ff 00 	cmpl   $0x0,-0xc4(%rbp)
+ffffffff8010091e:	74 0c                	je     ffffffff8010092c <cprintf+0x388>
+    release(&cons.lock);
+ffffffff80100920:	48 c7 c7 40 04 11 80 	mov    $0xffffffff80110440,%rdi
+ffffffff80100927:	e8 7a 61 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff8010092c:	90                   	nop
+ffffffff8010092d:	c9                   	leave
+ffffffff8010092e:	c3                   	ret
+
+ffffffff8010092f <panic>:
+
+void
+panic(char *s)
+{
+ffffffff8010092f:	55                   	push   %rbp
+ffffffff80100930:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80100933:	48 83 ec 70          	sub    $0x70,%rsp
+ffffffff80100937:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  int i;
+  uintp pcs[10];
+  
+  cli();
+ffffffff8010093b:	e8 62 fb ff ff       	call   ffffffff801004a2 <cli>
+  cons.locking = 0;
+ffffffff80100940:	c7 05 5e fb 00 00 00 	movl   $0x0,0xfb5e(%rip)        # ffffffff801104a8 <cons+0x68>
+ffffffff80100947:	00 00 00 
+  cprintf("cpu%d: panic: ", cpu->id);
+ffffffff8010094a:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80100951:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80100955:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80100958:	0f b6 c0             	movzbl %al,%eax
+ffffffff8010095b:	89 c6                	mov    %eax,%esi
+ffffffff8010095d:	48 c7 c7 4e a5 10 80 	mov    $0xffffffff8010a54e,%rdi
+ffffffff80100964:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80100969:	e8 36 fc ff ff       	call   ffffffff801005a4 <cprintf>
+  cprintf(s);
+ffffffff8010096e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+ffffffff80100972:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100975:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010097a:	e8 25 fc ff ff       	call   ffffffff801005a4 <cprintf>
+  cprintf("\n");
+ffffffff8010097f:	48 c7 c7 5d a5 10 80 	mov    $0xffffffff8010a55d,%rdi
+ffffffff80100986:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010098b:	e8 14 fc ff ff       	call   ffffffff801005a4 <cprintf>
+  getcallerpcs(&s, pcs);
+ffffffff80100990:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+ffffffff80100994:	48 8d 45 98          	lea    -0x68(%rbp),%rax
+ffffffff80100998:	48 89 d6             	mov    %rdx,%rsi
+ffffffff8010099b:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010099e:	e8 5c 61 00 00       	call   ffffffff80106aff <getcallerpcs>
+  for(i=0; i<10; i++)
+ffffffff801009a3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff801009aa:	eb 22                	jmp    ffffffff801009ce <panic+0x9f>
+    cprintf(" %p", pcs[i]);
+ffffffff801009ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801009af:	48 98                	cltq
+ffffffff801009b1:	48 8b 44 c5 a0       	mov    -0x60(%rbp,%rax,8),%rax
+ffffffff801009b6:	48 89 c6             	mov    %rax,%rsi
+ffffffff801009b9:	48 c7 c7 5f a5 10 80 	mov    $0xffffffff8010a55f,%rdi
+ffffffff801009c0:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801009c5:	e8 da fb ff ff       	call   ffffffff801005a4 <cprintf>
+  for(i=0; i<10; i++)
+ffffffff801009ca:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff801009ce:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+ffffffff801009d2:	7e d8                	jle    ffffffff801009ac <panic+0x7d>
+  panicked = 1; // freeze other CPU
+ffffffff801009d4:	c7 05 5a fa 00 00 01 	movl   $0x1,0xfa5a(%rip)        # ffffffff80110438 <panicked>
+ffffffff801009db:	00 00 00 
+  for(;;)
+ffffffff801009de:	90                   	nop
+ffffffff801009df:	eb fd                	jmp    ffffffff801009de <panic+0xaf>
+
+ffffffff801009e1 <cgaputc>:
+#define CRTPORT 0x3d4
+static ushort *crt = (ushort*)P2V(0xb8000);  // CGA memory
+
+static void
+cgaputc(int c)
+{
+ffffffff801009e1:	55                   	push   %rbp
+ffffffff801009e2:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801009e5:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801009e9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int pos;
+  
+  // Cursor position: col + 80*row.
+  outb(CRTPORT, 14);
+ffffffff801009ec:	be 0e 00 00 00       	mov    $0xe,%esi
+ffffffff801009f1:	bf d4 03 00 00       	mov    $0x3d4,%edi
+ffffffff801009f6:	e8 39 fa ff ff       	call   ffffffff80100434 <outb>
+  pos = inb(CRTPORT+1) << 8;
+ffffffff801009fb:	bf d5 03 00 00       	mov    $0x3d5,%edi
+ffffffff80100a00:	e8 11 fa ff ff       	call   ffffffff80100416 <inb>
+ffffffff80100a05:	0f b6 c0             	movzbl %al,%eax
+ffffffff80100a08:	c1 e0 08             	shl    $0x8,%eax
+ffffffff80100a0b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  outb(CRTPORT, 15);
+ffffffff80100a0e:	be 0f 00 00 00       	mov    $0xf,%esi
+ffffffff80100a13:	bf d4 03 00 00       	mov    $0x3d4,%edi
+ffffffff80100a18:	e8 17 fa ff ff       	call   ffffffff80100434 <outb>
+  pos |= inb(CRTPORT+1);
+ffffffff80100a1d:	bf d5 03 00 00       	mov    $0x3d5,%edi
+ffffffff80100a22:	e8 ef f9 ff ff       	call   ffffffff80100416 <inb>
+ffffffff80100a27:	0f b6 c0             	movzbl %al,%eax
+ffffffff80100a2a:	09 45 fc             	or     %eax,-0x4(%rbp)
+
+  if(c == '\n')
+ffffffff80100a2d:	83 7d ec 0a          	cmpl   $0xa,-0x14(%rbp)
+ffffffff80100a31:	75 37                	jne    ffffffff80100a6a <cgaputc+0x89>
+    pos += 80 - pos%80;
+ffffffff80100a33:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+ffffffff80100a36:	48 63 c1             	movslq %ecx,%rax
+ffffffff80100a39:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+ffffffff80100a40:	48 c1 e8 20          	shr    $0x20,%rax
+ffffffff80100a44:	89 c2                	mov    %eax,%edx
+ffffffff80100a46:	c1 fa 05             	sar    $0x5,%edx
+ffffffff80100a49:	89 c8                	mov    %ecx,%eax
+ffffffff80100a4b:	c1 f8 1f             	sar    $0x1f,%eax
+ffffffff80100a4e:	29 c2                	sub    %eax,%edx
+ffffffff80100a50:	89 d0                	mov    %edx,%eax
+ffffffff80100a52:	c1 e0 02             	shl    $0x2,%eax
+ffffffff80100a55:	01 d0                	add    %edx,%eax
+ffffffff80100a57:	c1 e0 04             	shl    $0x4,%eax
+ffffffff80100a5a:	29 c1                	sub    %eax,%ecx
+ffffffff80100a5c:	89 ca                	mov    %ecx,%edx
+ffffffff80100a5e:	b8 50 00 00 00       	mov    $0x50,%eax
+ffffffff80100a63:	29 d0                	sub    %edx,%eax
+ffffffff80100a65:	01 45 fc             	add    %eax,-0x4(%rbp)
+ffffffff80100a68:	eb 3d                	jmp    ffffffff80100aa7 <cgaputc+0xc6>
+  else if(c == BACKSPACE){
+ffffffff80100a6a:	81 7d ec 00 01 00 00 	cmpl   $0x100,-0x14(%rbp)
+ffffffff80100a71:	75 0c                	jne    ffffffff80100a7f <cgaputc+0x9e>
+    if(pos > 0) --pos;
+ffffffff80100a73:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80100a77:	7e 2e                	jle    ffffffff80100aa7 <cgaputc+0xc6>
+ffffffff80100a79:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+ffffffff80100a7d:	eb 28                	jmp    ffffffff80100aa7 <cgaputc+0xc6>
+  } else
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+ffffffff80100a7f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80100a82:	0f b6 c0             	movzbl %al,%eax
+ffffffff80100a85:	80 cc 07             	or     $0x7,%ah
+ffffffff80100a88:	89 c6                	mov    %eax,%esi
+ffffffff80100a8a:	48 8b 0d 87 a5 00 00 	mov    0xa587(%rip),%rcx        # ffffffff8010b018 <crt>
+ffffffff80100a91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100a94:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff80100a97:	89 55 fc             	mov    %edx,-0x4(%rbp)
+ffffffff80100a9a:	48 98                	cltq
+ffffffff80100a9c:	48 01 c0             	add    %rax,%rax
+ffffffff80100a9f:	48 01 c8             	add    %rcx,%rax
+ffffffff80100aa2:	89 f2                	mov    %esi,%edx
+ffffffff80100aa4:	66 89 10             	mov    %dx,(%rax)
+  
+  if((pos/80) >= 24){  // Scroll up.
+ffffffff80100aa7:	81 7d fc 7f 07 00 00 	cmpl   $0x77f,-0x4(%rbp)
+ffffffff80100aae:	7e 56                	jle    ffffffff80100b06 <cgaputc+0x125>
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+ffffffff80100ab0:	48 8b 05 61 a5 00 00 	mov    0xa561(%rip),%rax        # ffffffff8010b018 <crt>
+ffffffff80100ab7:	48 8d 88 a0 00 00 00 	lea    0xa0(%rax),%rcx
+ffffffff80100abe:	48 8b 05 53 a5 00 00 	mov    0xa553(%rip),%rax        # ffffffff8010b018 <crt>
+ffffffff80100ac5:	ba 60 0e 00 00       	mov    $0xe60,%edx
+ffffffff80100aca:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80100acd:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100ad0:	e8 59 63 00 00       	call   ffffffff80106e2e <memmove>
+    pos -= 80;
+ffffffff80100ad5:	83 6d fc 50          	subl   $0x50,-0x4(%rbp)
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+ffffffff80100ad9:	b8 80 07 00 00       	mov    $0x780,%eax
+ffffffff80100ade:	2b 45 fc             	sub    -0x4(%rbp),%eax
+ffffffff80100ae1:	48 98                	cltq
+ffffffff80100ae3:	8d 14 00             	lea    (%rax,%rax,1),%edx
+ffffffff80100ae6:	48 8b 05 2b a5 00 00 	mov    0xa52b(%rip),%rax        # ffffffff8010b018 <crt>
+ffffffff80100aed:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+ffffffff80100af0:	48 63 c9             	movslq %ecx,%rcx
+ffffffff80100af3:	48 01 c9             	add    %rcx,%rcx
+ffffffff80100af6:	48 01 c8             	add    %rcx,%rax
+ffffffff80100af9:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80100afe:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100b01:	e8 39 62 00 00       	call   ffffffff80106d3f <memset>
+  }
+  
+  outb(CRTPORT, 14);
+ffffffff80100b06:	be 0e 00 00 00       	mov    $0xe,%esi
+ffffffff80100b0b:	bf d4 03 00 00       	mov    $0x3d4,%edi
+ffffffff80100b10:	e8 1f f9 ff ff       	call   ffffffff80100434 <outb>
+  outb(CRTPORT+1, pos>>8);
+ffffffff80100b15:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100b18:	c1 f8 08             	sar    $0x8,%eax
+ffffffff80100b1b:	0f b6 c0             	movzbl %al,%eax
+ffffffff80100b1e:	89 c6                	mov    %eax,%esi
+ffffffff80100b20:	bf d5 03 00 00       	mov    $0x3d5,%edi
+ffffffff80100b25:	e8 0a f9 ff ff       	call   ffffffff80100434 <outb>
+  outb(CRTPORT, 15);
+ffffffff80100b2a:	be 0f 00 00 00       	mov    $0xf,%esi
+ffffffff80100b2f:	bf d4 03 00 00       	mov    $0x3d4,%edi
+ffffffff80100b34:	e8 fb f8 ff ff       	call   ffffffff80100434 <outb>
+  outb(CRTPORT+1, pos);
+ffffffff80100b39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100b3c:	0f b6 c0             	movzbl %al,%eax
+ffffffff80100b3f:	89 c6                	mov    %eax,%esi
+ffffffff80100b41:	bf d5 03 00 00       	mov    $0x3d5,%edi
+ffffffff80100b46:	e8 e9 f8 ff ff       	call   ffffffff80100434 <outb>
+  crt[pos] = ' ' | 0x0700;
+ffffffff80100b4b:	48 8b 05 c6 a4 00 00 	mov    0xa4c6(%rip),%rax        # ffffffff8010b018 <crt>
+ffffffff80100b52:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80100b55:	48 63 d2             	movslq %edx,%rdx
+ffffffff80100b58:	48 01 d2             	add    %rdx,%rdx
+ffffffff80100b5b:	48 01 d0             	add    %rdx,%rax
+ffffffff80100b5e:	66 c7 00 20 07       	movw   $0x720,(%rax)
+}
+ffffffff80100b63:	90                   	nop
+ffffffff80100b64:	c9                   	leave
+ffffffff80100b65:	c3                   	ret
+
+ffffffff80100b66 <consputc>:
+
+void
+consputc(int c)
+{
+ffffffff80100b66:	55                   	push   %rbp
+ffffffff80100b67:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80100b6a:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80100b6e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  if(panicked){
+ffffffff80100b71:	8b 05 c1 f8 00 00    	mov    0xf8c1(%rip),%eax        # ffffffff80110438 <panicked>
+ffffffff80100b77:	85 c0                	test   %eax,%eax
+ffffffff80100b79:	74 08                	je     ffffffff80100b83 <consputc+0x1d>
+    cli();
+ffffffff80100b7b:	e8 22 f9 ff ff       	call   ffffffff801004a2 <cli>
+    for(;;)
+ffffffff80100b80:	90                   	nop
+ffffffff80100b81:	eb fd                	jmp    ffffffff80100b80 <consputc+0x1a>
+      ;
+  }
+
+  if(c == BACKSPACE){
+ffffffff80100b83:	81 7d fc 00 01 00 00 	cmpl   $0x100,-0x4(%rbp)
+ffffffff80100b8a:	75 20                	jne    ffffffff80100bac <consputc+0x46>
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+ffffffff80100b8c:	bf 08 00 00 00       	mov    $0x8,%edi
+ffffffff80100b91:	e8 2f 7e 00 00       	call   ffffffff801089c5 <uartputc>
+ffffffff80100b96:	bf 20 00 00 00       	mov    $0x20,%edi
+ffffffff80100b9b:	e8 25 7e 00 00       	call   ffffffff801089c5 <uartputc>
+ffffffff80100ba0:	bf 08 00 00 00       	mov    $0x8,%edi
+ffffffff80100ba5:	e8 1b 7e 00 00       	call   ffffffff801089c5 <uartputc>
+ffffffff80100baa:	eb 0a                	jmp    ffffffff80100bb6 <consputc+0x50>
+  } else
+    uartputc(c);
+ffffffff80100bac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100baf:	89 c7                	mov    %eax,%edi
+ffffffff80100bb1:	e8 0f 7e 00 00       	call   ffffffff801089c5 <uartputc>
+  cgaputc(c);
+ffffffff80100bb6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100bb9:	89 c7                	mov    %eax,%edi
+ffffffff80100bbb:	e8 21 fe ff ff       	call   ffffffff801009e1 <cgaputc>
+}
+ffffffff80100bc0:	90                   	nop
+ffffffff80100bc1:	c9                   	leave
+ffffffff80100bc2:	c3                   	ret
+
+ffffffff80100bc3 <consoleintr>:
+
+#define C(x)  ((x)-'@')  // Control-x
+
+void
+consoleintr(int (*getc)(void))
+{
+ffffffff80100bc3:	55                   	push   %rbp
+ffffffff80100bc4:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80100bc7:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80100bcb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int c;
+
+  acquire(&input.lock);
+ffffffff80100bcf:	48 c7 c7 40 03 11 80 	mov    $0xffffffff80110340,%rdi
+ffffffff80100bd6:	e8 f4 5d 00 00       	call   ffffffff801069cf <acquire>
+  while((c = getc()) >= 0){
+ffffffff80100bdb:	e9 7b 01 00 00       	jmp    ffffffff80100d5b <consoleintr+0x198>
+    switch(c){
+ffffffff80100be0:	83 7d fc 7f          	cmpl   $0x7f,-0x4(%rbp)
+ffffffff80100be4:	0f 84 a4 00 00 00    	je     ffffffff80100c8e <consoleintr+0xcb>
+ffffffff80100bea:	83 7d fc 7f          	cmpl   $0x7f,-0x4(%rbp)
+ffffffff80100bee:	0f 8f cc 00 00 00    	jg     ffffffff80100cc0 <consoleintr+0xfd>
+ffffffff80100bf4:	83 7d fc 1a          	cmpl   $0x1a,-0x4(%rbp)
+ffffffff80100bf8:	74 2b                	je     ffffffff80100c25 <consoleintr+0x62>
+ffffffff80100bfa:	83 7d fc 1a          	cmpl   $0x1a,-0x4(%rbp)
+ffffffff80100bfe:	0f 8f bc 00 00 00    	jg     ffffffff80100cc0 <consoleintr+0xfd>
+ffffffff80100c04:	83 7d fc 15          	cmpl   $0x15,-0x4(%rbp)
+ffffffff80100c08:	74 52                	je     ffffffff80100c5c <consoleintr+0x99>
+ffffffff80100c0a:	83 7d fc 15          	cmpl   $0x15,-0x4(%rbp)
+ffffffff80100c0e:	0f 8f ac 00 00 00    	jg     ffffffff80100cc0 <consoleintr+0xfd>
+ffffffff80100c14:	83 7d fc 08          	cmpl   $0x8,-0x4(%rbp)
+ffffffff80100c18:	74 74                	je     ffffffff80100c8e <consoleintr+0xcb>
+ffffffff80100c1a:	83 7d fc 10          	cmpl   $0x10,-0x4(%rbp)
+ffffffff80100c1e:	74 19                	je     ffffffff80100c39 <consoleintr+0x76>
+ffffffff80100c20:	e9 9b 00 00 00       	jmp    ffffffff80100cc0 <consoleintr+0xfd>
+    case C('Z'): // reboot
+      lidt(0,0);
+ffffffff80100c25:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80100c2a:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff80100c2f:	e8 1f f8 ff ff       	call   ffffffff80100453 <lidt>
+      break;
+ffffffff80100c34:	e9 22 01 00 00       	jmp    ffffffff80100d5b <consoleintr+0x198>
+    case C('P'):  // Process listing.
+      procdump();
+ffffffff80100c39:	e8 e0 5b 00 00       	call   ffffffff8010681e <procdump>
+      break;
+ffffffff80100c3e:	e9 18 01 00 00       	jmp    ffffffff80100d5b <consoleintr+0x198>
+    case C('U'):  // Kill line.
+      while(input.e != input.w &&
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+        input.e--;
+ffffffff80100c43:	8b 05 e7 f7 00 00    	mov    0xf7e7(%rip),%eax        # ffffffff80110430 <input+0xf0>
+ffffffff80100c49:	83 e8 01             	sub    $0x1,%eax
+ffffffff80100c4c:	89 05 de f7 00 00    	mov    %eax,0xf7de(%rip)        # ffffffff80110430 <input+0xf0>
+        consputc(BACKSPACE);
+ffffffff80100c52:	bf 00 01 00 00       	mov    $0x100,%edi
+ffffffff80100c57:	e8 0a ff ff ff       	call   ffffffff80100b66 <consputc>
+      while(input.e != input.w &&
+ffffffff80100c5c:	8b 15 ce f7 00 00    	mov    0xf7ce(%rip),%edx        # ffffffff80110430 <input+0xf0>
+ffffffff80100c62:	8b 05 c4 f7 00 00    	mov    0xf7c4(%rip),%eax        # ffffffff8011042c <input+0xec>
+ffffffff80100c68:	39 c2                	cmp    %eax,%edx
+ffffffff80100c6a:	0f 84 e4 00 00 00    	je     ffffffff80100d54 <consoleintr+0x191>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+ffffffff80100c70:	8b 05 ba f7 00 00    	mov    0xf7ba(%rip),%eax        # ffffffff80110430 <input+0xf0>
+ffffffff80100c76:	83 e8 01             	sub    $0x1,%eax
+ffffffff80100c79:	83 e0 7f             	and    $0x7f,%eax
+ffffffff80100c7c:	89 c0                	mov    %eax,%eax
+ffffffff80100c7e:	0f b6 80 a8 03 11 80 	movzbl -0x7feefc58(%rax),%eax
+      while(input.e != input.w &&
+ffffffff80100c85:	3c 0a                	cmp    $0xa,%al
+ffffffff80100c87:	75 ba                	jne    ffffffff80100c43 <consoleintr+0x80>
+      }
+      break;
+ffffffff80100c89:	e9 c6 00 00 00       	jmp    ffffffff80100d54 <consoleintr+0x191>
+    case C('H'): case '\x7f':  // Backspace
+      if(input.e != input.w){
+ffffffff80100c8e:	8b 15 9c f7 00 00    	mov    0xf79c(%rip),%edx        # ffffffff80110430 <input+0xf0>
+ffffffff80100c94:	8b 05 92 f7 00 00    	mov    0xf792(%rip),%eax        # ffffffff8011042c <input+0xec>
+ffffffff80100c9a:	39 c2                	cmp    %eax,%edx
+ffffffff80100c9c:	0f 84 b5 00 00 00    	je     ffffffff80100d57 <consoleintr+0x194>
+        input.e--;
+ffffffff80100ca2:	8b 05 88 f7 00 00    	mov    0xf788(%rip),%eax        # ffffffff80110430 <input+0xf0>
+ffffffff80100ca8:	83 e8 01             	sub    $0x1,%eax
+ffffffff80100cab:	89 05 7f f7 00 00    	mov    %eax,0xf77f(%rip)        # ffffffff80110430 <input+0xf0>
+        consputc(BACKSPACE);
+ffffffff80100cb1:	bf 00 01 00 00       	mov    $0x100,%edi
+ffffffff80100cb6:	e8 ab fe ff ff       	call   ffffffff80100b66 <consputc>
+      }
+      break;
+ffffffff80100cbb:	e9 97 00 00 00       	jmp    ffffffff80100d57 <consoleintr+0x194>
+    default:
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+ffffffff80100cc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80100cc4:	0f 84 90 00 00 00    	je     ffffffff80100d5a <consoleintr+0x197>
+ffffffff80100cca:	8b 15 60 f7 00 00    	mov    0xf760(%rip),%edx        # ffffffff80110430 <input+0xf0>
+ffffffff80100cd0:	8b 05 52 f7 00 00    	mov    0xf752(%rip),%eax        # ffffffff80110428 <input+0xe8>
+ffffffff80100cd6:	29 c2                	sub    %eax,%edx
+ffffffff80100cd8:	83 fa 7f             	cmp    $0x7f,%edx
+ffffffff80100cdb:	77 7d                	ja     ffffffff80100d5a <consoleintr+0x197>
+        c = (c == '\r') ? '\n' : c;
+ffffffff80100cdd:	83 7d fc 0d          	cmpl   $0xd,-0x4(%rbp)
+ffffffff80100ce1:	74 05                	je     ffffffff80100ce8 <consoleintr+0x125>
+ffffffff80100ce3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100ce6:	eb 05                	jmp    ffffffff80100ced <consoleintr+0x12a>
+ffffffff80100ce8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ffffffff80100ced:	89 45 fc             	mov    %eax,-0x4(%rbp)
+        input.buf[input.e++ % INPUT_BUF] = c;
+ffffffff80100cf0:	8b 05 3a f7 00 00    	mov    0xf73a(%rip),%eax        # ffffffff80110430 <input+0xf0>
+ffffffff80100cf6:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff80100cf9:	89 15 31 f7 00 00    	mov    %edx,0xf731(%rip)        # ffffffff80110430 <input+0xf0>
+ffffffff80100cff:	83 e0 7f             	and    $0x7f,%eax
+ffffffff80100d02:	89 c1                	mov    %eax,%ecx
+ffffffff80100d04:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100d07:	89 c2                	mov    %eax,%edx
+ffffffff80100d09:	89 c8                	mov    %ecx,%eax
+ffffffff80100d0b:	88 90 a8 03 11 80    	mov    %dl,-0x7feefc58(%rax)
+        consputc(c);
+ffffffff80100d11:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100d14:	89 c7                	mov    %eax,%edi
+ffffffff80100d16:	e8 4b fe ff ff       	call   ffffffff80100b66 <consputc>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+ffffffff80100d1b:	83 7d fc 0a          	cmpl   $0xa,-0x4(%rbp)
+ffffffff80100d1f:	74 19                	je     ffffffff80100d3a <consoleintr+0x177>
+ffffffff80100d21:	83 7d fc 04          	cmpl   $0x4,-0x4(%rbp)
+ffffffff80100d25:	74 13                	je     ffffffff80100d3a <consoleintr+0x177>
+ffffffff80100d27:	8b 15 03 f7 00 00    	mov    0xf703(%rip),%edx        # ffffffff80110430 <input+0xf0>
+ffffffff80100d2d:	8b 05 f5 f6 00 00    	mov    0xf6f5(%rip),%eax        # ffffffff80110428 <input+0xe8>
+ffffffff80100d33:	83 e8 80             	sub    $0xffffff80,%eax
+ffffffff80100d36:	39 c2                	cmp    %eax,%edx
+ffffffff80100d38:	75 20                	jne    ffffffff80100d5a <consoleintr+0x197>
+          input.w = input.e;
+ffffffff80100d3a:	8b 05 f0 f6 00 00    	mov    0xf6f0(%rip),%eax        # ffffffff80110430 <input+0xf0>
+ffffffff80100d40:	89 05 e6 f6 00 00    	mov    %eax,0xf6e6(%rip)        # ffffffff8011042c <input+0xec>
+          wakeup(&input.r);
+ffffffff80100d46:	48 c7 c7 28 04 11 80 	mov    $0xffffffff80110428,%rdi
+ffffffff80100d4d:	e8 12 5a 00 00       	call   ffffffff80106764 <wakeup>
+        }
+      }
+      break;
+ffffffff80100d52:	eb 06                	jmp    ffffffff80100d5a <consoleintr+0x197>
+      break;
+ffffffff80100d54:	90                   	nop
+ffffffff80100d55:	eb 04                	jmp    ffffffff80100d5b <consoleintr+0x198>
+      break;
+ffffffff80100d57:	90                   	nop
+ffffffff80100d58:	eb 01                	jmp    ffffffff80100d5b <consoleintr+0x198>
+      break;
+ffffffff80100d5a:	90                   	nop
+  while((c = getc()) >= 0){
+ffffffff80100d5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100d5f:	ff d0                	call   *%rax
+ffffffff80100d61:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80100d64:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80100d68:	0f 89 72 fe ff ff    	jns    ffffffff80100be0 <consoleintr+0x1d>
+    }
+  }
+  release(&input.lock);
+ffffffff80100d6e:	48 c7 c7 40 03 11 80 	mov    $0xffffffff80110340,%rdi
+ffffffff80100d75:	e8 2c 5d 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff80100d7a:	90                   	nop
+ffffffff80100d7b:	c9                   	leave
+ffffffff80100d7c:	c3                   	ret
+
+ffffffff80100d7d <consoleread>:
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+ffffffff80100d7d:	55                   	push   %rbp
+ffffffff80100d7e:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80100d81:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80100d85:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80100d89:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80100d8d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  uint target;
+  int c;
+
+  iunlock(ip);
+ffffffff80100d90:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100d94:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100d97:	e8 94 1c 00 00       	call   ffffffff80102a30 <iunlock>
+  target = n;
+ffffffff80100d9c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80100d9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  acquire(&input.lock);
+ffffffff80100da2:	48 c7 c7 40 03 11 80 	mov    $0xffffffff80110340,%rdi
+ffffffff80100da9:	e8 21 5c 00 00       	call   ffffffff801069cf <acquire>
+  while(n > 0){
+ffffffff80100dae:	e9 b2 00 00 00       	jmp    ffffffff80100e65 <consoleread+0xe8>
+    while(input.r == input.w){
+      if(proc->killed){
+ffffffff80100db3:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80100dba:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80100dbe:	8b 40 40             	mov    0x40(%rax),%eax
+ffffffff80100dc1:	85 c0                	test   %eax,%eax
+ffffffff80100dc3:	74 22                	je     ffffffff80100de7 <consoleread+0x6a>
+        release(&input.lock);
+ffffffff80100dc5:	48 c7 c7 40 03 11 80 	mov    $0xffffffff80110340,%rdi
+ffffffff80100dcc:	e8 d5 5c 00 00       	call   ffffffff80106aa6 <release>
+        ilock(ip);
+ffffffff80100dd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100dd5:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100dd8:	e8 b4 1a 00 00       	call   ffffffff80102891 <ilock>
+        return -1;
+ffffffff80100ddd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80100de2:	e9 ac 00 00 00       	jmp    ffffffff80100e93 <consoleread+0x116>
+      }
+      sleep(&input.r, &input.lock);
+ffffffff80100de7:	48 c7 c6 40 03 11 80 	mov    $0xffffffff80110340,%rsi
+ffffffff80100dee:	48 c7 c7 28 04 11 80 	mov    $0xffffffff80110428,%rdi
+ffffffff80100df5:	e8 56 58 00 00       	call   ffffffff80106650 <sleep>
+    while(input.r == input.w){
+ffffffff80100dfa:	8b 15 28 f6 00 00    	mov    0xf628(%rip),%edx        # ffffffff80110428 <input+0xe8>
+ffffffff80100e00:	8b 05 26 f6 00 00    	mov    0xf626(%rip),%eax        # ffffffff8011042c <input+0xec>
+ffffffff80100e06:	39 c2                	cmp    %eax,%edx
+ffffffff80100e08:	74 a9                	je     ffffffff80100db3 <consoleread+0x36>
+    }
+    c = input.buf[input.r++ % INPUT_BUF];
+ffffffff80100e0a:	8b 05 18 f6 00 00    	mov    0xf618(%rip),%eax        # ffffffff80110428 <input+0xe8>
+ffffffff80100e10:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff80100e13:	89 15 0f f6 00 00    	mov    %edx,0xf60f(%rip)        # ffffffff80110428 <input+0xe8>
+ffffffff80100e19:	83 e0 7f             	and    $0x7f,%eax
+ffffffff80100e1c:	89 c0                	mov    %eax,%eax
+ffffffff80100e1e:	0f b6 80 a8 03 11 80 	movzbl -0x7feefc58(%rax),%eax
+ffffffff80100e25:	0f be c0             	movsbl %al,%eax
+ffffffff80100e28:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if(c == C('D')){  // EOF
+ffffffff80100e2b:	83 7d f8 04          	cmpl   $0x4,-0x8(%rbp)
+ffffffff80100e2f:	75 19                	jne    ffffffff80100e4a <consoleread+0xcd>
+      if(n < target){
+ffffffff80100e31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80100e34:	3b 45 fc             	cmp    -0x4(%rbp),%eax
+ffffffff80100e37:	73 34                	jae    ffffffff80100e6d <consoleread+0xf0>
+        // Save ^D for next time, to make sure
+        // caller gets a 0-byte result.
+        input.r--;
+ffffffff80100e39:	8b 05 e9 f5 00 00    	mov    0xf5e9(%rip),%eax        # ffffffff80110428 <input+0xe8>
+ffffffff80100e3f:	83 e8 01             	sub    $0x1,%eax
+ffffffff80100e42:	89 05 e0 f5 00 00    	mov    %eax,0xf5e0(%rip)        # ffffffff80110428 <input+0xe8>
+      }
+      break;
+ffffffff80100e48:	eb 23                	jmp    ffffffff80100e6d <consoleread+0xf0>
+    }
+    *dst++ = c;
+ffffffff80100e4a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80100e4e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ffffffff80100e52:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+ffffffff80100e56:	8b 55 f8             	mov    -0x8(%rbp),%edx
+ffffffff80100e59:	88 10                	mov    %dl,(%rax)
+    --n;
+ffffffff80100e5b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+    if(c == '\n')
+ffffffff80100e5f:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+ffffffff80100e63:	74 0b                	je     ffffffff80100e70 <consoleread+0xf3>
+  while(n > 0){
+ffffffff80100e65:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+ffffffff80100e69:	7f 8f                	jg     ffffffff80100dfa <consoleread+0x7d>
+ffffffff80100e6b:	eb 04                	jmp    ffffffff80100e71 <consoleread+0xf4>
+      break;
+ffffffff80100e6d:	90                   	nop
+ffffffff80100e6e:	eb 01                	jmp    ffffffff80100e71 <consoleread+0xf4>
+      break;
+ffffffff80100e70:	90                   	nop
+  }
+  release(&input.lock);
+ffffffff80100e71:	48 c7 c7 40 03 11 80 	mov    $0xffffffff80110340,%rdi
+ffffffff80100e78:	e8 29 5c 00 00       	call   ffffffff80106aa6 <release>
+  ilock(ip);
+ffffffff80100e7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100e81:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100e84:	e8 08 1a 00 00       	call   ffffffff80102891 <ilock>
+
+  return target - n;
+ffffffff80100e89:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80100e8c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80100e8f:	29 c2                	sub    %eax,%edx
+ffffffff80100e91:	89 d0                	mov    %edx,%eax
+}
+ffffffff80100e93:	c9                   	leave
+ffffffff80100e94:	c3                   	ret
+
+ffffffff80100e95 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+ffffffff80100e95:	55                   	push   %rbp
+ffffffff80100e96:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80100e99:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80100e9d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80100ea1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80100ea5:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  int i;
+
+  iunlock(ip);
+ffffffff80100ea8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100eac:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100eaf:	e8 7c 1b 00 00       	call   ffffffff80102a30 <iunlock>
+  acquire(&cons.lock);
+ffffffff80100eb4:	48 c7 c7 40 04 11 80 	mov    $0xffffffff80110440,%rdi
+ffffffff80100ebb:	e8 0f 5b 00 00       	call   ffffffff801069cf <acquire>
+  for(i = 0; i < n; i++)
+ffffffff80100ec0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80100ec7:	eb 21                	jmp    ffffffff80100eea <consolewrite+0x55>
+    consputc(buf[i] & 0xff);
+ffffffff80100ec9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100ecc:	48 63 d0             	movslq %eax,%rdx
+ffffffff80100ecf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80100ed3:	48 01 d0             	add    %rdx,%rax
+ffffffff80100ed6:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80100ed9:	0f be c0             	movsbl %al,%eax
+ffffffff80100edc:	0f b6 c0             	movzbl %al,%eax
+ffffffff80100edf:	89 c7                	mov    %eax,%edi
+ffffffff80100ee1:	e8 80 fc ff ff       	call   ffffffff80100b66 <consputc>
+  for(i = 0; i < n; i++)
+ffffffff80100ee6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80100eea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80100eed:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+ffffffff80100ef0:	7c d7                	jl     ffffffff80100ec9 <consolewrite+0x34>
+  release(&cons.lock);
+ffffffff80100ef2:	48 c7 c7 40 04 11 80 	mov    $0xffffffff80110440,%rdi
+ffffffff80100ef9:	e8 a8 5b 00 00       	call   ffffffff80106aa6 <release>
+  ilock(ip);
+ffffffff80100efe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80100f02:	48 89 c7             	mov    %rax,%rdi
+ffffffff80100f05:	e8 87 19 00 00       	call   ffffffff80102891 <ilock>
+
+  return n;
+ffffffff80100f0a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+}
+ffffffff80100f0d:	c9                   	leave
+ffffffff80100f0e:	c3                   	ret
+
+ffffffff80100f0f <consoleinit>:
+
+void
+consoleinit(void)
+{
+ffffffff80100f0f:	55                   	push   %rbp
+ffffffff80100f10:	48 89 e5             	mov    %rsp,%rbp
+  initlock(&cons.lock, "console");
+ffffffff80100f13:	48 c7 c6 63 a5 10 80 	mov    $0xffffffff8010a563,%rsi
+ffffffff80100f1a:	48 c7 c7 40 04 11 80 	mov    $0xffffffff80110440,%rdi
+ffffffff80100f21:	e8 74 5a 00 00       	call   ffffffff8010699a <initlock>
+  initlock(&input.lock, "input");
+ffffffff80100f26:	48 c7 c6 6b a5 10 80 	mov    $0xffffffff8010a56b,%rsi
+ffffffff80100f2d:	48 c7 c7 40 03 11 80 	mov    $0xffffffff80110340,%rdi
+ffffffff80100f34:	e8 61 5a 00 00       	call   ffffffff8010699a <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+ffffffff80100f39:	48 c7 05 b4 f5 00 00 	movq   $0xffffffff80100e95,0xf5b4(%rip)        # ffffffff801104f8 <devsw+0x18>
+ffffffff80100f40:	95 0e 10 80 
+  devsw[CONSOLE].read = consoleread;
+ffffffff80100f44:	48 c7 05 a1 f5 00 00 	movq   $0xffffffff80100d7d,0xf5a1(%rip)        # ffffffff801104f0 <devsw+0x10>
+ffffffff80100f4b:	7d 0d 10 80 
+  cons.locking = 1;
+ffffffff80100f4f:	c7 05 4f f5 00 00 01 	movl   $0x1,0xf54f(%rip)        # ffffffff801104a8 <cons+0x68>
+ffffffff80100f56:	00 00 00 
+
+  picenable(IRQ_KBD);
+ffffffff80100f59:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff80100f5e:	e8 b5 46 00 00       	call   ffffffff80105618 <picenable>
+  ioapicenable(IRQ_KBD, 0);
+ffffffff80100f63:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80100f68:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff80100f6d:	e8 1b 2c 00 00       	call   ffffffff80103b8d <ioapicenable>
+}
+ffffffff80100f72:	90                   	nop
+ffffffff80100f73:	5d                   	pop    %rbp
+ffffffff80100f74:	c3                   	ret
+
+ffffffff80100f75 <cpu_printfeatures>:
+// leaf = 7
+uint sef_flags;
+
+static void
+cpu_printfeatures(void)
+{
+ffffffff80100f75:	55                   	push   %rbp
+ffffffff80100f76:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80100f79:	48 83 ec 10          	sub    $0x10,%rsp
+  uchar vendorStr[13];
+  *(uint*)(&vendorStr[0]) = vendor[0];
+ffffffff80100f7d:	48 8d 45 f3          	lea    -0xd(%rbp),%rax
+ffffffff80100f81:	8b 15 31 f5 00 00    	mov    0xf531(%rip),%edx        # ffffffff801104b8 <vendor>
+ffffffff80100f87:	89 10                	mov    %edx,(%rax)
+  *(uint*)(&vendorStr[4]) = vendor[1];
+ffffffff80100f89:	48 8d 45 f3          	lea    -0xd(%rbp),%rax
+ffffffff80100f8d:	48 8d 50 04          	lea    0x4(%rax),%rdx
+ffffffff80100f91:	8b 05 25 f5 00 00    	mov    0xf525(%rip),%eax        # ffffffff801104bc <vendor+0x4>
+ffffffff80100f97:	89 02                	mov    %eax,(%rdx)
+  *(uint*)(&vendorStr[8]) = vendor[2];
+ffffffff80100f99:	48 8d 45 f3          	lea    -0xd(%rbp),%rax
+ffffffff80100f9d:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ffffffff80100fa1:	8b 05 19 f5 00 00    	mov    0xf519(%rip),%eax        # ffffffff801104c0 <vendor+0x8>
+ffffffff80100fa7:	89 02                	mov    %eax,(%rdx)
+  vendorStr[12] = 0;
+ffffffff80100fa9:	c6 45 ff 00          	movb   $0x0,-0x1(%rbp)
+
+  cprintf("CPU vendor: %s\n", vendorStr);
+ffffffff80100fad:	48 8d 45 f3          	lea    -0xd(%rbp),%rax
+ffffffff80100fb1:	48 89 c6             	mov    %rax,%rsi
+ffffffff80100fb4:	48 c7 c7 78 a5 10 80 	mov    $0xffffffff8010a578,%rdi
+ffffffff80100fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80100fc0:	e8 df f5 ff ff       	call   ffffffff801005a4 <cprintf>
+  cprintf("Max leaf: 0x%x\n", maxleaf);
+ffffffff80100fc5:	8b 05 e5 f4 00 00    	mov    0xf4e5(%rip),%eax        # ffffffff801104b0 <maxleaf>
+ffffffff80100fcb:	89 c6                	mov    %eax,%esi
+ffffffff80100fcd:	48 c7 c7 88 a5 10 80 	mov    $0xffffffff8010a588,%rdi
+ffffffff80100fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80100fd9:	e8 c6 f5 ff ff       	call   ffffffff801005a4 <cprintf>
+  if (maxleaf >= 1) {
+ffffffff80100fde:	8b 05 cc f4 00 00    	mov    0xf4cc(%rip),%eax        # ffffffff801104b0 <maxleaf>
+ffffffff80100fe4:	85 c0                	test   %eax,%eax
+ffffffff80100fe6:	0f 84 52 07 00 00    	je     ffffffff8010173e <cpu_printfeatures+0x7c9>
+    cprintf("Features: ");
+ffffffff80100fec:	48 c7 c7 98 a5 10 80 	mov    $0xffffffff8010a598,%rdi
+ffffffff80100ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80100ff8:	e8 a7 f5 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, FPU);
+ffffffff80100ffd:	8b 05 cd f4 00 00    	mov    0xf4cd(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101003:	83 e0 01             	and    $0x1,%eax
+ffffffff80101006:	85 c0                	test   %eax,%eax
+ffffffff80101008:	74 11                	je     ffffffff8010101b <cpu_printfeatures+0xa6>
+ffffffff8010100a:	48 c7 c7 a3 a5 10 80 	mov    $0xffffffff8010a5a3,%rdi
+ffffffff80101011:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101016:	e8 89 f5 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, VME);
+ffffffff8010101b:	8b 05 af f4 00 00    	mov    0xf4af(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101021:	83 e0 02             	and    $0x2,%eax
+ffffffff80101024:	85 c0                	test   %eax,%eax
+ffffffff80101026:	74 11                	je     ffffffff80101039 <cpu_printfeatures+0xc4>
+ffffffff80101028:	48 c7 c7 a8 a5 10 80 	mov    $0xffffffff8010a5a8,%rdi
+ffffffff8010102f:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101034:	e8 6b f5 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, DE);
+ffffffff80101039:	8b 05 91 f4 00 00    	mov    0xf491(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff8010103f:	83 e0 04             	and    $0x4,%eax
+ffffffff80101042:	85 c0                	test   %eax,%eax
+ffffffff80101044:	74 11                	je     ffffffff80101057 <cpu_printfeatures+0xe2>
+ffffffff80101046:	48 c7 c7 ad a5 10 80 	mov    $0xffffffff8010a5ad,%rdi
+ffffffff8010104d:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101052:	e8 4d f5 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, PSE);
+ffffffff80101057:	8b 05 73 f4 00 00    	mov    0xf473(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff8010105d:	83 e0 08             	and    $0x8,%eax
+ffffffff80101060:	85 c0                	test   %eax,%eax
+ffffffff80101062:	74 11                	je     ffffffff80101075 <cpu_printfeatures+0x100>
+ffffffff80101064:	48 c7 c7 b1 a5 10 80 	mov    $0xffffffff8010a5b1,%rdi
+ffffffff8010106b:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101070:	e8 2f f5 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, TSC);
+ffffffff80101075:	8b 05 55 f4 00 00    	mov    0xf455(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff8010107b:	83 e0 10             	and    $0x10,%eax
+ffffffff8010107e:	85 c0                	test   %eax,%eax
+ffffffff80101080:	74 11                	je     ffffffff80101093 <cpu_printfeatures+0x11e>
+ffffffff80101082:	48 c7 c7 b6 a5 10 80 	mov    $0xffffffff8010a5b6,%rdi
+ffffffff80101089:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010108e:	e8 11 f5 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, MSR);
+ffffffff80101093:	8b 05 37 f4 00 00    	mov    0xf437(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101099:	83 e0 20             	and    $0x20,%eax
+ffffffff8010109c:	85 c0                	test   %eax,%eax
+ffffffff8010109e:	74 11                	je     ffffffff801010b1 <cpu_printfeatures+0x13c>
+ffffffff801010a0:	48 c7 c7 bb a5 10 80 	mov    $0xffffffff8010a5bb,%rdi
+ffffffff801010a7:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801010ac:	e8 f3 f4 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, PAE);
+ffffffff801010b1:	8b 05 19 f4 00 00    	mov    0xf419(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff801010b7:	83 e0 40             	and    $0x40,%eax
+ffffffff801010ba:	85 c0                	test   %eax,%eax
+ffffffff801010bc:	74 11                	je     ffffffff801010cf <cpu_printfeatures+0x15a>
+ffffffff801010be:	48 c7 c7 c0 a5 10 80 	mov    $0xffffffff8010a5c0,%rdi
+ffffffff801010c5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801010ca:	e8 d5 f4 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, MCE);
+ffffffff801010cf:	8b 05 fb f3 00 00    	mov    0xf3fb(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff801010d5:	25 80 00 00 00       	and    $0x80,%eax
+ffffffff801010da:	85 c0                	test   %eax,%eax
+ffffffff801010dc:	74 11                	je     ffffffff801010ef <cpu_printfeatures+0x17a>
+ffffffff801010de:	48 c7 c7 c5 a5 10 80 	mov    $0xffffffff8010a5c5,%rdi
+ffffffff801010e5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801010ea:	e8 b5 f4 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, CX8);
+ffffffff801010ef:	8b 05 db f3 00 00    	mov    0xf3db(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff801010f5:	25 00 01 00 00       	and    $0x100,%eax
+ffffffff801010fa:	85 c0                	test   %eax,%eax
+ffffffff801010fc:	74 11                	je     ffffffff8010110f <cpu_printfeatures+0x19a>
+ffffffff801010fe:	48 c7 c7 ca a5 10 80 	mov    $0xffffffff8010a5ca,%rdi
+ffffffff80101105:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010110a:	e8 95 f4 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, APIC);
+ffffffff8010110f:	8b 05 bb f3 00 00    	mov    0xf3bb(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101115:	25 00 02 00 00       	and    $0x200,%eax
+ffffffff8010111a:	85 c0                	test   %eax,%eax
+ffffffff8010111c:	74 11                	je     ffffffff8010112f <cpu_printfeatures+0x1ba>
+ffffffff8010111e:	48 c7 c7 cf a5 10 80 	mov    $0xffffffff8010a5cf,%rdi
+ffffffff80101125:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010112a:	e8 75 f4 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, SEP);
+ffffffff8010112f:	8b 05 9b f3 00 00    	mov    0xf39b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101135:	25 00 08 00 00       	and    $0x800,%eax
+ffffffff8010113a:	85 c0                	test   %eax,%eax
+ffffffff8010113c:	74 11                	je     ffffffff8010114f <cpu_printfeatures+0x1da>
+ffffffff8010113e:	48 c7 c7 d5 a5 10 80 	mov    $0xffffffff8010a5d5,%rdi
+ffffffff80101145:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010114a:	e8 55 f4 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, MTRR);
+ffffffff8010114f:	8b 05 7b f3 00 00    	mov    0xf37b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101155:	25 00 10 00 00       	and    $0x1000,%eax
+ffffffff8010115a:	85 c0                	test   %eax,%eax
+ffffffff8010115c:	74 11                	je     ffffffff8010116f <cpu_printfeatures+0x1fa>
+ffffffff8010115e:	48 c7 c7 da a5 10 80 	mov    $0xffffffff8010a5da,%rdi
+ffffffff80101165:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010116a:	e8 35 f4 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, PGE);
+ffffffff8010116f:	8b 05 5b f3 00 00    	mov    0xf35b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101175:	25 00 20 00 00       	and    $0x2000,%eax
+ffffffff8010117a:	85 c0                	test   %eax,%eax
+ffffffff8010117c:	74 11                	je     ffffffff8010118f <cpu_printfeatures+0x21a>
+ffffffff8010117e:	48 c7 c7 e0 a5 10 80 	mov    $0xffffffff8010a5e0,%rdi
+ffffffff80101185:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010118a:	e8 15 f4 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, MCA);
+ffffffff8010118f:	8b 05 3b f3 00 00    	mov    0xf33b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101195:	25 00 40 00 00       	and    $0x4000,%eax
+ffffffff8010119a:	85 c0                	test   %eax,%eax
+ffffffff8010119c:	74 11                	je     ffffffff801011af <cpu_printfeatures+0x23a>
+ffffffff8010119e:	48 c7 c7 e5 a5 10 80 	mov    $0xffffffff8010a5e5,%rdi
+ffffffff801011a5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801011aa:	e8 f5 f3 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, CMOV);
+ffffffff801011af:	8b 05 1b f3 00 00    	mov    0xf31b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff801011b5:	25 00 80 00 00       	and    $0x8000,%eax
+ffffffff801011ba:	85 c0                	test   %eax,%eax
+ffffffff801011bc:	74 11                	je     ffffffff801011cf <cpu_printfeatures+0x25a>
+ffffffff801011be:	48 c7 c7 ea a5 10 80 	mov    $0xffffffff8010a5ea,%rdi
+ffffffff801011c5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801011ca:	e8 d5 f3 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, PAT);
+ffffffff801011cf:	8b 05 fb f2 00 00    	mov    0xf2fb(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff801011d5:	25 00 00 01 00       	and    $0x10000,%eax
+ffffffff801011da:	85 c0                	test   %eax,%eax
+ffffffff801011dc:	74 11                	je     ffffffff801011ef <cpu_printfeatures+0x27a>
+ffffffff801011de:	48 c7 c7 f0 a5 10 80 	mov    $0xffffffff8010a5f0,%rdi
+ffffffff801011e5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801011ea:	e8 b5 f3 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, PSE36);
+ffffffff801011ef:	8b 05 db f2 00 00    	mov    0xf2db(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff801011f5:	25 00 00 02 00       	and    $0x20000,%eax
+ffffffff801011fa:	85 c0                	test   %eax,%eax
+ffffffff801011fc:	74 11                	je     ffffffff8010120f <cpu_printfeatures+0x29a>
+ffffffff801011fe:	48 c7 c7 f5 a5 10 80 	mov    $0xffffffff8010a5f5,%rdi
+ffffffff80101205:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010120a:	e8 95 f3 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, PSN);
+ffffffff8010120f:	8b 05 bb f2 00 00    	mov    0xf2bb(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101215:	25 00 00 04 00       	and    $0x40000,%eax
+ffffffff8010121a:	85 c0                	test   %eax,%eax
+ffffffff8010121c:	74 11                	je     ffffffff8010122f <cpu_printfeatures+0x2ba>
+ffffffff8010121e:	48 c7 c7 fc a5 10 80 	mov    $0xffffffff8010a5fc,%rdi
+ffffffff80101225:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010122a:	e8 75 f3 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, CLFSH);
+ffffffff8010122f:	8b 05 9b f2 00 00    	mov    0xf29b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101235:	25 00 00 08 00       	and    $0x80000,%eax
+ffffffff8010123a:	85 c0                	test   %eax,%eax
+ffffffff8010123c:	74 11                	je     ffffffff8010124f <cpu_printfeatures+0x2da>
+ffffffff8010123e:	48 c7 c7 01 a6 10 80 	mov    $0xffffffff8010a601,%rdi
+ffffffff80101245:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010124a:	e8 55 f3 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, DS);
+ffffffff8010124f:	8b 05 7b f2 00 00    	mov    0xf27b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101255:	25 00 00 20 00       	and    $0x200000,%eax
+ffffffff8010125a:	85 c0                	test   %eax,%eax
+ffffffff8010125c:	74 11                	je     ffffffff8010126f <cpu_printfeatures+0x2fa>
+ffffffff8010125e:	48 c7 c7 08 a6 10 80 	mov    $0xffffffff8010a608,%rdi
+ffffffff80101265:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010126a:	e8 35 f3 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, ACPI);
+ffffffff8010126f:	8b 05 5b f2 00 00    	mov    0xf25b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101275:	25 00 00 40 00       	and    $0x400000,%eax
+ffffffff8010127a:	85 c0                	test   %eax,%eax
+ffffffff8010127c:	74 11                	je     ffffffff8010128f <cpu_printfeatures+0x31a>
+ffffffff8010127e:	48 c7 c7 0c a6 10 80 	mov    $0xffffffff8010a60c,%rdi
+ffffffff80101285:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010128a:	e8 15 f3 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, MMX);
+ffffffff8010128f:	8b 05 3b f2 00 00    	mov    0xf23b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101295:	25 00 00 80 00       	and    $0x800000,%eax
+ffffffff8010129a:	85 c0                	test   %eax,%eax
+ffffffff8010129c:	74 11                	je     ffffffff801012af <cpu_printfeatures+0x33a>
+ffffffff8010129e:	48 c7 c7 12 a6 10 80 	mov    $0xffffffff8010a612,%rdi
+ffffffff801012a5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801012aa:	e8 f5 f2 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, FXSR);
+ffffffff801012af:	8b 05 1b f2 00 00    	mov    0xf21b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff801012b5:	25 00 00 00 01       	and    $0x1000000,%eax
+ffffffff801012ba:	85 c0                	test   %eax,%eax
+ffffffff801012bc:	74 11                	je     ffffffff801012cf <cpu_printfeatures+0x35a>
+ffffffff801012be:	48 c7 c7 17 a6 10 80 	mov    $0xffffffff8010a617,%rdi
+ffffffff801012c5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801012ca:	e8 d5 f2 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, SSE);
+ffffffff801012cf:	8b 05 fb f1 00 00    	mov    0xf1fb(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff801012d5:	25 00 00 00 02       	and    $0x2000000,%eax
+ffffffff801012da:	85 c0                	test   %eax,%eax
+ffffffff801012dc:	74 11                	je     ffffffff801012ef <cpu_printfeatures+0x37a>
+ffffffff801012de:	48 c7 c7 1d a6 10 80 	mov    $0xffffffff8010a61d,%rdi
+ffffffff801012e5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801012ea:	e8 b5 f2 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, SSE2);
+ffffffff801012ef:	8b 05 db f1 00 00    	mov    0xf1db(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff801012f5:	25 00 00 00 04       	and    $0x4000000,%eax
+ffffffff801012fa:	85 c0                	test   %eax,%eax
+ffffffff801012fc:	74 11                	je     ffffffff8010130f <cpu_printfeatures+0x39a>
+ffffffff801012fe:	48 c7 c7 22 a6 10 80 	mov    $0xffffffff8010a622,%rdi
+ffffffff80101305:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010130a:	e8 95 f2 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, SS);
+ffffffff8010130f:	8b 05 bb f1 00 00    	mov    0xf1bb(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101315:	25 00 00 00 08       	and    $0x8000000,%eax
+ffffffff8010131a:	85 c0                	test   %eax,%eax
+ffffffff8010131c:	74 11                	je     ffffffff8010132f <cpu_printfeatures+0x3ba>
+ffffffff8010131e:	48 c7 c7 28 a6 10 80 	mov    $0xffffffff8010a628,%rdi
+ffffffff80101325:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010132a:	e8 75 f2 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, HTT);
+ffffffff8010132f:	8b 05 9b f1 00 00    	mov    0xf19b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101335:	25 00 00 00 10       	and    $0x10000000,%eax
+ffffffff8010133a:	85 c0                	test   %eax,%eax
+ffffffff8010133c:	74 11                	je     ffffffff8010134f <cpu_printfeatures+0x3da>
+ffffffff8010133e:	48 c7 c7 2c a6 10 80 	mov    $0xffffffff8010a62c,%rdi
+ffffffff80101345:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010134a:	e8 55 f2 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, TM);
+ffffffff8010134f:	8b 05 7b f1 00 00    	mov    0xf17b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101355:	25 00 00 00 20       	and    $0x20000000,%eax
+ffffffff8010135a:	85 c0                	test   %eax,%eax
+ffffffff8010135c:	74 11                	je     ffffffff8010136f <cpu_printfeatures+0x3fa>
+ffffffff8010135e:	48 c7 c7 31 a6 10 80 	mov    $0xffffffff8010a631,%rdi
+ffffffff80101365:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010136a:	e8 35 f2 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(features, PBE);
+ffffffff8010136f:	8b 05 5b f1 00 00    	mov    0xf15b(%rip),%eax        # ffffffff801104d0 <features>
+ffffffff80101375:	85 c0                	test   %eax,%eax
+ffffffff80101377:	79 11                	jns    ffffffff8010138a <cpu_printfeatures+0x415>
+ffffffff80101379:	48 c7 c7 35 a6 10 80 	mov    $0xffffffff8010a635,%rdi
+ffffffff80101380:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101385:	e8 1a f2 ff ff       	call   ffffffff801005a4 <cprintf>
+
+    cprintf("\nExt Features: ");
+ffffffff8010138a:	48 c7 c7 3a a6 10 80 	mov    $0xffffffff8010a63a,%rdi
+ffffffff80101391:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101396:	e8 09 f2 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, SSE3);
+ffffffff8010139b:	8b 05 2b f1 00 00    	mov    0xf12b(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801013a1:	83 e0 01             	and    $0x1,%eax
+ffffffff801013a4:	85 c0                	test   %eax,%eax
+ffffffff801013a6:	74 11                	je     ffffffff801013b9 <cpu_printfeatures+0x444>
+ffffffff801013a8:	48 c7 c7 4a a6 10 80 	mov    $0xffffffff8010a64a,%rdi
+ffffffff801013af:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801013b4:	e8 eb f1 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, PCLMULQDQ);
+ffffffff801013b9:	8b 05 0d f1 00 00    	mov    0xf10d(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801013bf:	83 e0 02             	and    $0x2,%eax
+ffffffff801013c2:	85 c0                	test   %eax,%eax
+ffffffff801013c4:	74 11                	je     ffffffff801013d7 <cpu_printfeatures+0x462>
+ffffffff801013c6:	48 c7 c7 50 a6 10 80 	mov    $0xffffffff8010a650,%rdi
+ffffffff801013cd:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801013d2:	e8 cd f1 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, DTES64);
+ffffffff801013d7:	8b 05 ef f0 00 00    	mov    0xf0ef(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801013dd:	83 e0 04             	and    $0x4,%eax
+ffffffff801013e0:	85 c0                	test   %eax,%eax
+ffffffff801013e2:	74 11                	je     ffffffff801013f5 <cpu_printfeatures+0x480>
+ffffffff801013e4:	48 c7 c7 5b a6 10 80 	mov    $0xffffffff8010a65b,%rdi
+ffffffff801013eb:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801013f0:	e8 af f1 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, MONITOR);
+ffffffff801013f5:	8b 05 d1 f0 00 00    	mov    0xf0d1(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801013fb:	83 e0 08             	and    $0x8,%eax
+ffffffff801013fe:	85 c0                	test   %eax,%eax
+ffffffff80101400:	74 11                	je     ffffffff80101413 <cpu_printfeatures+0x49e>
+ffffffff80101402:	48 c7 c7 63 a6 10 80 	mov    $0xffffffff8010a663,%rdi
+ffffffff80101409:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010140e:	e8 91 f1 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, DS_CPL);
+ffffffff80101413:	8b 05 b3 f0 00 00    	mov    0xf0b3(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101419:	83 e0 10             	and    $0x10,%eax
+ffffffff8010141c:	85 c0                	test   %eax,%eax
+ffffffff8010141e:	74 11                	je     ffffffff80101431 <cpu_printfeatures+0x4bc>
+ffffffff80101420:	48 c7 c7 6c a6 10 80 	mov    $0xffffffff8010a66c,%rdi
+ffffffff80101427:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010142c:	e8 73 f1 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, VMX);
+ffffffff80101431:	8b 05 95 f0 00 00    	mov    0xf095(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101437:	83 e0 20             	and    $0x20,%eax
+ffffffff8010143a:	85 c0                	test   %eax,%eax
+ffffffff8010143c:	74 11                	je     ffffffff8010144f <cpu_printfeatures+0x4da>
+ffffffff8010143e:	48 c7 c7 74 a6 10 80 	mov    $0xffffffff8010a674,%rdi
+ffffffff80101445:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010144a:	e8 55 f1 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, SMX);
+ffffffff8010144f:	8b 05 77 f0 00 00    	mov    0xf077(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101455:	83 e0 40             	and    $0x40,%eax
+ffffffff80101458:	85 c0                	test   %eax,%eax
+ffffffff8010145a:	74 11                	je     ffffffff8010146d <cpu_printfeatures+0x4f8>
+ffffffff8010145c:	48 c7 c7 79 a6 10 80 	mov    $0xffffffff8010a679,%rdi
+ffffffff80101463:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101468:	e8 37 f1 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, EIST);
+ffffffff8010146d:	8b 05 59 f0 00 00    	mov    0xf059(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101473:	25 80 00 00 00       	and    $0x80,%eax
+ffffffff80101478:	85 c0                	test   %eax,%eax
+ffffffff8010147a:	74 11                	je     ffffffff8010148d <cpu_printfeatures+0x518>
+ffffffff8010147c:	48 c7 c7 7e a6 10 80 	mov    $0xffffffff8010a67e,%rdi
+ffffffff80101483:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101488:	e8 17 f1 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, TM2);
+ffffffff8010148d:	8b 05 39 f0 00 00    	mov    0xf039(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101493:	25 00 01 00 00       	and    $0x100,%eax
+ffffffff80101498:	85 c0                	test   %eax,%eax
+ffffffff8010149a:	74 11                	je     ffffffff801014ad <cpu_printfeatures+0x538>
+ffffffff8010149c:	48 c7 c7 84 a6 10 80 	mov    $0xffffffff8010a684,%rdi
+ffffffff801014a3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801014a8:	e8 f7 f0 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, SSSE3);
+ffffffff801014ad:	8b 05 19 f0 00 00    	mov    0xf019(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801014b3:	25 00 02 00 00       	and    $0x200,%eax
+ffffffff801014b8:	85 c0                	test   %eax,%eax
+ffffffff801014ba:	74 11                	je     ffffffff801014cd <cpu_printfeatures+0x558>
+ffffffff801014bc:	48 c7 c7 89 a6 10 80 	mov    $0xffffffff8010a689,%rdi
+ffffffff801014c3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801014c8:	e8 d7 f0 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, CNXT_ID);
+ffffffff801014cd:	8b 05 f9 ef 00 00    	mov    0xeff9(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801014d3:	25 00 04 00 00       	and    $0x400,%eax
+ffffffff801014d8:	85 c0                	test   %eax,%eax
+ffffffff801014da:	74 11                	je     ffffffff801014ed <cpu_printfeatures+0x578>
+ffffffff801014dc:	48 c7 c7 90 a6 10 80 	mov    $0xffffffff8010a690,%rdi
+ffffffff801014e3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801014e8:	e8 b7 f0 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, FMA);
+ffffffff801014ed:	8b 05 d9 ef 00 00    	mov    0xefd9(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801014f3:	25 00 10 00 00       	and    $0x1000,%eax
+ffffffff801014f8:	85 c0                	test   %eax,%eax
+ffffffff801014fa:	74 11                	je     ffffffff8010150d <cpu_printfeatures+0x598>
+ffffffff801014fc:	48 c7 c7 99 a6 10 80 	mov    $0xffffffff8010a699,%rdi
+ffffffff80101503:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101508:	e8 97 f0 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, CMPXCHG16B);
+ffffffff8010150d:	8b 05 b9 ef 00 00    	mov    0xefb9(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101513:	25 00 20 00 00       	and    $0x2000,%eax
+ffffffff80101518:	85 c0                	test   %eax,%eax
+ffffffff8010151a:	74 11                	je     ffffffff8010152d <cpu_printfeatures+0x5b8>
+ffffffff8010151c:	48 c7 c7 9e a6 10 80 	mov    $0xffffffff8010a69e,%rdi
+ffffffff80101523:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101528:	e8 77 f0 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, xTPR);
+ffffffff8010152d:	8b 05 99 ef 00 00    	mov    0xef99(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101533:	25 00 40 00 00       	and    $0x4000,%eax
+ffffffff80101538:	85 c0                	test   %eax,%eax
+ffffffff8010153a:	74 11                	je     ffffffff8010154d <cpu_printfeatures+0x5d8>
+ffffffff8010153c:	48 c7 c7 aa a6 10 80 	mov    $0xffffffff8010a6aa,%rdi
+ffffffff80101543:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101548:	e8 57 f0 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, PDCM);
+ffffffff8010154d:	8b 05 79 ef 00 00    	mov    0xef79(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101553:	25 00 80 00 00       	and    $0x8000,%eax
+ffffffff80101558:	85 c0                	test   %eax,%eax
+ffffffff8010155a:	74 11                	je     ffffffff8010156d <cpu_printfeatures+0x5f8>
+ffffffff8010155c:	48 c7 c7 b0 a6 10 80 	mov    $0xffffffff8010a6b0,%rdi
+ffffffff80101563:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101568:	e8 37 f0 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, PCID);
+ffffffff8010156d:	8b 05 59 ef 00 00    	mov    0xef59(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101573:	25 00 00 02 00       	and    $0x20000,%eax
+ffffffff80101578:	85 c0                	test   %eax,%eax
+ffffffff8010157a:	74 11                	je     ffffffff8010158d <cpu_printfeatures+0x618>
+ffffffff8010157c:	48 c7 c7 b6 a6 10 80 	mov    $0xffffffff8010a6b6,%rdi
+ffffffff80101583:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101588:	e8 17 f0 ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, DCA);
+ffffffff8010158d:	8b 05 39 ef 00 00    	mov    0xef39(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101593:	25 00 00 04 00       	and    $0x40000,%eax
+ffffffff80101598:	85 c0                	test   %eax,%eax
+ffffffff8010159a:	74 11                	je     ffffffff801015ad <cpu_printfeatures+0x638>
+ffffffff8010159c:	48 c7 c7 bc a6 10 80 	mov    $0xffffffff8010a6bc,%rdi
+ffffffff801015a3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801015a8:	e8 f7 ef ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, SSE4_1);
+ffffffff801015ad:	8b 05 19 ef 00 00    	mov    0xef19(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801015b3:	25 00 00 08 00       	and    $0x80000,%eax
+ffffffff801015b8:	85 c0                	test   %eax,%eax
+ffffffff801015ba:	74 11                	je     ffffffff801015cd <cpu_printfeatures+0x658>
+ffffffff801015bc:	48 c7 c7 c1 a6 10 80 	mov    $0xffffffff8010a6c1,%rdi
+ffffffff801015c3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801015c8:	e8 d7 ef ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, SSE4_2);
+ffffffff801015cd:	8b 05 f9 ee 00 00    	mov    0xeef9(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801015d3:	25 00 00 10 00       	and    $0x100000,%eax
+ffffffff801015d8:	85 c0                	test   %eax,%eax
+ffffffff801015da:	74 11                	je     ffffffff801015ed <cpu_printfeatures+0x678>
+ffffffff801015dc:	48 c7 c7 c9 a6 10 80 	mov    $0xffffffff8010a6c9,%rdi
+ffffffff801015e3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801015e8:	e8 b7 ef ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, x2APIC);
+ffffffff801015ed:	8b 05 d9 ee 00 00    	mov    0xeed9(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801015f3:	25 00 00 20 00       	and    $0x200000,%eax
+ffffffff801015f8:	85 c0                	test   %eax,%eax
+ffffffff801015fa:	74 11                	je     ffffffff8010160d <cpu_printfeatures+0x698>
+ffffffff801015fc:	48 c7 c7 d1 a6 10 80 	mov    $0xffffffff8010a6d1,%rdi
+ffffffff80101603:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101608:	e8 97 ef ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, MOVBE);
+ffffffff8010160d:	8b 05 b9 ee 00 00    	mov    0xeeb9(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101613:	25 00 00 40 00       	and    $0x400000,%eax
+ffffffff80101618:	85 c0                	test   %eax,%eax
+ffffffff8010161a:	74 11                	je     ffffffff8010162d <cpu_printfeatures+0x6b8>
+ffffffff8010161c:	48 c7 c7 d9 a6 10 80 	mov    $0xffffffff8010a6d9,%rdi
+ffffffff80101623:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101628:	e8 77 ef ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, POPCNT);
+ffffffff8010162d:	8b 05 99 ee 00 00    	mov    0xee99(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101633:	25 00 00 80 00       	and    $0x800000,%eax
+ffffffff80101638:	85 c0                	test   %eax,%eax
+ffffffff8010163a:	74 11                	je     ffffffff8010164d <cpu_printfeatures+0x6d8>
+ffffffff8010163c:	48 c7 c7 e0 a6 10 80 	mov    $0xffffffff8010a6e0,%rdi
+ffffffff80101643:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101648:	e8 57 ef ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, TSCD);
+ffffffff8010164d:	8b 05 79 ee 00 00    	mov    0xee79(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101653:	25 00 00 00 01       	and    $0x1000000,%eax
+ffffffff80101658:	85 c0                	test   %eax,%eax
+ffffffff8010165a:	74 11                	je     ffffffff8010166d <cpu_printfeatures+0x6f8>
+ffffffff8010165c:	48 c7 c7 e8 a6 10 80 	mov    $0xffffffff8010a6e8,%rdi
+ffffffff80101663:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101668:	e8 37 ef ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, AESNI);
+ffffffff8010166d:	8b 05 59 ee 00 00    	mov    0xee59(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101673:	25 00 00 00 02       	and    $0x2000000,%eax
+ffffffff80101678:	85 c0                	test   %eax,%eax
+ffffffff8010167a:	74 11                	je     ffffffff8010168d <cpu_printfeatures+0x718>
+ffffffff8010167c:	48 c7 c7 ee a6 10 80 	mov    $0xffffffff8010a6ee,%rdi
+ffffffff80101683:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101688:	e8 17 ef ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, XSAVE);
+ffffffff8010168d:	8b 05 39 ee 00 00    	mov    0xee39(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101693:	25 00 00 00 04       	and    $0x4000000,%eax
+ffffffff80101698:	85 c0                	test   %eax,%eax
+ffffffff8010169a:	74 11                	je     ffffffff801016ad <cpu_printfeatures+0x738>
+ffffffff8010169c:	48 c7 c7 f5 a6 10 80 	mov    $0xffffffff8010a6f5,%rdi
+ffffffff801016a3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801016a8:	e8 f7 ee ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, OSXSAVE);
+ffffffff801016ad:	8b 05 19 ee 00 00    	mov    0xee19(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801016b3:	25 00 00 00 08       	and    $0x8000000,%eax
+ffffffff801016b8:	85 c0                	test   %eax,%eax
+ffffffff801016ba:	74 11                	je     ffffffff801016cd <cpu_printfeatures+0x758>
+ffffffff801016bc:	48 c7 c7 fc a6 10 80 	mov    $0xffffffff8010a6fc,%rdi
+ffffffff801016c3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801016c8:	e8 d7 ee ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, AVX);
+ffffffff801016cd:	8b 05 f9 ed 00 00    	mov    0xedf9(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801016d3:	25 00 00 00 10       	and    $0x10000000,%eax
+ffffffff801016d8:	85 c0                	test   %eax,%eax
+ffffffff801016da:	74 11                	je     ffffffff801016ed <cpu_printfeatures+0x778>
+ffffffff801016dc:	48 c7 c7 05 a7 10 80 	mov    $0xffffffff8010a705,%rdi
+ffffffff801016e3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801016e8:	e8 b7 ee ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, F16C);
+ffffffff801016ed:	8b 05 d9 ed 00 00    	mov    0xedd9(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff801016f3:	25 00 00 00 20       	and    $0x20000000,%eax
+ffffffff801016f8:	85 c0                	test   %eax,%eax
+ffffffff801016fa:	74 11                	je     ffffffff8010170d <cpu_printfeatures+0x798>
+ffffffff801016fc:	48 c7 c7 0a a7 10 80 	mov    $0xffffffff8010a70a,%rdi
+ffffffff80101703:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101708:	e8 97 ee ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_FEATURE(featuresExt, RDRAND);
+ffffffff8010170d:	8b 05 b9 ed 00 00    	mov    0xedb9(%rip),%eax        # ffffffff801104cc <featuresExt>
+ffffffff80101713:	25 00 00 00 40       	and    $0x40000000,%eax
+ffffffff80101718:	85 c0                	test   %eax,%eax
+ffffffff8010171a:	74 11                	je     ffffffff8010172d <cpu_printfeatures+0x7b8>
+ffffffff8010171c:	48 c7 c7 10 a7 10 80 	mov    $0xffffffff8010a710,%rdi
+ffffffff80101723:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101728:	e8 77 ee ff ff       	call   ffffffff801005a4 <cprintf>
+    cprintf("\n");
+ffffffff8010172d:	48 c7 c7 18 a7 10 80 	mov    $0xffffffff8010a718,%rdi
+ffffffff80101734:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101739:	e8 66 ee ff ff       	call   ffffffff801005a4 <cprintf>
+  }
+
+  if (maxleaf >= 7) {
+ffffffff8010173e:	8b 05 6c ed 00 00    	mov    0xed6c(%rip),%eax        # ffffffff801104b0 <maxleaf>
+ffffffff80101744:	83 f8 06             	cmp    $0x6,%eax
+ffffffff80101747:	0f 86 fc 00 00 00    	jbe    ffffffff80101849 <cpu_printfeatures+0x8d4>
+    cprintf("Structured Extended Features: ");
+ffffffff8010174d:	48 c7 c7 20 a7 10 80 	mov    $0xffffffff8010a720,%rdi
+ffffffff80101754:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101759:	e8 46 ee ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_SEFEATURE(sef_flags, FSGSBASE);
+ffffffff8010175e:	8b 05 70 ed 00 00    	mov    0xed70(%rip),%eax        # ffffffff801104d4 <sef_flags>
+ffffffff80101764:	83 e0 01             	and    $0x1,%eax
+ffffffff80101767:	85 c0                	test   %eax,%eax
+ffffffff80101769:	74 11                	je     ffffffff8010177c <cpu_printfeatures+0x807>
+ffffffff8010176b:	48 c7 c7 3f a7 10 80 	mov    $0xffffffff8010a73f,%rdi
+ffffffff80101772:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101777:	e8 28 ee ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_SEFEATURE(sef_flags, TAM);
+ffffffff8010177c:	8b 05 52 ed 00 00    	mov    0xed52(%rip),%eax        # ffffffff801104d4 <sef_flags>
+ffffffff80101782:	83 e0 02             	and    $0x2,%eax
+ffffffff80101785:	85 c0                	test   %eax,%eax
+ffffffff80101787:	74 11                	je     ffffffff8010179a <cpu_printfeatures+0x825>
+ffffffff80101789:	48 c7 c7 49 a7 10 80 	mov    $0xffffffff8010a749,%rdi
+ffffffff80101790:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101795:	e8 0a ee ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_SEFEATURE(sef_flags, SMEP);
+ffffffff8010179a:	8b 05 34 ed 00 00    	mov    0xed34(%rip),%eax        # ffffffff801104d4 <sef_flags>
+ffffffff801017a0:	25 80 00 00 00       	and    $0x80,%eax
+ffffffff801017a5:	85 c0                	test   %eax,%eax
+ffffffff801017a7:	74 11                	je     ffffffff801017ba <cpu_printfeatures+0x845>
+ffffffff801017a9:	48 c7 c7 4e a7 10 80 	mov    $0xffffffff8010a74e,%rdi
+ffffffff801017b0:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801017b5:	e8 ea ed ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_SEFEATURE(sef_flags, EREP);
+ffffffff801017ba:	8b 05 14 ed 00 00    	mov    0xed14(%rip),%eax        # ffffffff801104d4 <sef_flags>
+ffffffff801017c0:	25 00 02 00 00       	and    $0x200,%eax
+ffffffff801017c5:	85 c0                	test   %eax,%eax
+ffffffff801017c7:	74 11                	je     ffffffff801017da <cpu_printfeatures+0x865>
+ffffffff801017c9:	48 c7 c7 54 a7 10 80 	mov    $0xffffffff8010a754,%rdi
+ffffffff801017d0:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801017d5:	e8 ca ed ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_SEFEATURE(sef_flags, INVPCID);
+ffffffff801017da:	8b 05 f4 ec 00 00    	mov    0xecf4(%rip),%eax        # ffffffff801104d4 <sef_flags>
+ffffffff801017e0:	25 00 04 00 00       	and    $0x400,%eax
+ffffffff801017e5:	85 c0                	test   %eax,%eax
+ffffffff801017e7:	74 11                	je     ffffffff801017fa <cpu_printfeatures+0x885>
+ffffffff801017e9:	48 c7 c7 5a a7 10 80 	mov    $0xffffffff8010a75a,%rdi
+ffffffff801017f0:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801017f5:	e8 aa ed ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_SEFEATURE(sef_flags, QM);
+ffffffff801017fa:	8b 05 d4 ec 00 00    	mov    0xecd4(%rip),%eax        # ffffffff801104d4 <sef_flags>
+ffffffff80101800:	83 e0 01             	and    $0x1,%eax
+ffffffff80101803:	85 c0                	test   %eax,%eax
+ffffffff80101805:	74 11                	je     ffffffff80101818 <cpu_printfeatures+0x8a3>
+ffffffff80101807:	48 c7 c7 63 a7 10 80 	mov    $0xffffffff8010a763,%rdi
+ffffffff8010180e:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101813:	e8 8c ed ff ff       	call   ffffffff801005a4 <cprintf>
+    PRINT_SEFEATURE(sef_flags, FPUCS);
+ffffffff80101818:	8b 05 b6 ec 00 00    	mov    0xecb6(%rip),%eax        # ffffffff801104d4 <sef_flags>
+ffffffff8010181e:	25 00 20 00 00       	and    $0x2000,%eax
+ffffffff80101823:	85 c0                	test   %eax,%eax
+ffffffff80101825:	74 11                	je     ffffffff80101838 <cpu_printfeatures+0x8c3>
+ffffffff80101827:	48 c7 c7 67 a7 10 80 	mov    $0xffffffff8010a767,%rdi
+ffffffff8010182e:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101833:	e8 6c ed ff ff       	call   ffffffff801005a4 <cprintf>
+    cprintf("\n");
+ffffffff80101838:	48 c7 c7 18 a7 10 80 	mov    $0xffffffff8010a718,%rdi
+ffffffff8010183f:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101844:	e8 5b ed ff ff       	call   ffffffff801005a4 <cprintf>
+  }
+}
+ffffffff80101849:	90                   	nop
+ffffffff8010184a:	c9                   	leave
+ffffffff8010184b:	c3                   	ret
+
+ffffffff8010184c <cpuinfo>:
+
+static void
+cpuinfo(void)
+{
+ffffffff8010184c:	55                   	push   %rbp
+ffffffff8010184d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80101850:	53                   	push   %rbx
+ffffffff80101851:	48 83 ec 10          	sub    $0x10,%rsp
+  // check for CPUID support by setting and clearing ID (bit 21) in EFLAGS
+
+  // When EAX=0, the processor returns the highest value (maxleaf) recognized for processor information
+  asm("cpuid" : "=a"(maxleaf), "=b"(vendor[0]), "=c"(vendor[2]), "=d"(vendor[1]) : "a" (0) :);
+ffffffff80101855:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010185a:	0f a2                	cpuid
+ffffffff8010185c:	89 de                	mov    %ebx,%esi
+ffffffff8010185e:	89 05 4c ec 00 00    	mov    %eax,0xec4c(%rip)        # ffffffff801104b0 <maxleaf>
+ffffffff80101864:	89 35 4e ec 00 00    	mov    %esi,0xec4e(%rip)        # ffffffff801104b8 <vendor>
+ffffffff8010186a:	89 0d 50 ec 00 00    	mov    %ecx,0xec50(%rip)        # ffffffff801104c0 <vendor+0x8>
+ffffffff80101870:	89 15 46 ec 00 00    	mov    %edx,0xec46(%rip)        # ffffffff801104bc <vendor+0x4>
+
+
+  if (maxleaf >= 1) {
+ffffffff80101876:	8b 05 34 ec 00 00    	mov    0xec34(%rip),%eax        # ffffffff801104b0 <maxleaf>
+ffffffff8010187c:	85 c0                	test   %eax,%eax
+ffffffff8010187e:	74 21                	je     ffffffff801018a1 <cpuinfo+0x55>
+    // get model, family, stepping info
+    asm("cpuid" : "=a"(version), "=b"(processor), "=c"(featuresExt), "=d"(features) : "a" (1) :);
+ffffffff80101880:	b8 01 00 00 00       	mov    $0x1,%eax
+ffffffff80101885:	0f a2                	cpuid
+ffffffff80101887:	89 de                	mov    %ebx,%esi
+ffffffff80101889:	89 05 35 ec 00 00    	mov    %eax,0xec35(%rip)        # ffffffff801104c4 <version>
+ffffffff8010188f:	89 35 33 ec 00 00    	mov    %esi,0xec33(%rip)        # ffffffff801104c8 <processor>
+ffffffff80101895:	89 0d 31 ec 00 00    	mov    %ecx,0xec31(%rip)        # ffffffff801104cc <featuresExt>
+ffffffff8010189b:	89 15 2f ec 00 00    	mov    %edx,0xec2f(%rip)        # ffffffff801104d0 <features>
+
+  if (maxleaf >= 6) {
+    // thermal and power management
+  }
+
+  if (maxleaf >= 7) {
+ffffffff801018a1:	8b 05 09 ec 00 00    	mov    0xec09(%rip),%eax        # ffffffff801104b0 <maxleaf>
+ffffffff801018a7:	83 f8 06             	cmp    $0x6,%eax
+ffffffff801018aa:	76 19                	jbe    ffffffff801018c5 <cpuinfo+0x79>
+    // structured extended feature flags (ECX=0)
+    uint maxsubleaf;
+    asm("cpuid" : "=a"(maxsubleaf), "=b"(sef_flags) : "a" (7), "c" (0) :);
+ffffffff801018ac:	b8 07 00 00 00       	mov    $0x7,%eax
+ffffffff801018b1:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff801018b6:	89 d1                	mov    %edx,%ecx
+ffffffff801018b8:	0f a2                	cpuid
+ffffffff801018ba:	89 da                	mov    %ebx,%edx
+ffffffff801018bc:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ffffffff801018bf:	89 15 0f ec 00 00    	mov    %edx,0xec0f(%rip)        # ffffffff801104d4 <sef_flags>
+  }
+
+  /* ... and many more ... */
+}
+ffffffff801018c5:	90                   	nop
+ffffffff801018c6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ffffffff801018ca:	c9                   	leave
+ffffffff801018cb:	c3                   	ret
+
+ffffffff801018cc <cpuid_read>:
+
+static int cpuid_read(struct inode* i, char* buf, int count)
+{
+ffffffff801018cc:	55                   	push   %rbp
+ffffffff801018cd:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801018d0:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801018d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff801018d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+ffffffff801018dc:	89 55 ec             	mov    %edx,-0x14(%rbp)
+   cpu_printfeatures();
+ffffffff801018df:	e8 91 f6 ff ff       	call   ffffffff80100f75 <cpu_printfeatures>
+
+   return 0;
+ffffffff801018e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801018e9:	c9                   	leave
+ffffffff801018ea:	c3                   	ret
+
+ffffffff801018eb <cpuid_write>:
+
+static int cpuid_write(struct inode* i, char* buf, int count)
+{
+ffffffff801018eb:	55                   	push   %rbp
+ffffffff801018ec:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801018ef:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801018f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff801018f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+ffffffff801018fb:	89 55 ec             	mov    %edx,-0x14(%rbp)
+   cprintf("cpuid_write\n");
+ffffffff801018fe:	48 c7 c7 6e a7 10 80 	mov    $0xffffffff8010a76e,%rdi
+ffffffff80101905:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010190a:	e8 95 ec ff ff       	call   ffffffff801005a4 <cprintf>
+   return 0;
+ffffffff8010190f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80101914:	c9                   	leave
+ffffffff80101915:	c3                   	ret
+
+ffffffff80101916 <cpuidinit>:
+
+void
+cpuidinit(void)
+{
+ffffffff80101916:	55                   	push   %rbp
+ffffffff80101917:	48 89 e5             	mov    %rsp,%rbp
+  devsw[CPUID].write = cpuid_write;
+ffffffff8010191a:	48 c7 05 e3 eb 00 00 	movq   $0xffffffff801018eb,0xebe3(%rip)        # ffffffff80110508 <devsw+0x28>
+ffffffff80101921:	eb 18 10 80 
+  devsw[CPUID].read = cpuid_read;
+ffffffff80101925:	48 c7 05 d0 eb 00 00 	movq   $0xffffffff801018cc,0xebd0(%rip)        # ffffffff80110500 <devsw+0x20>
+ffffffff8010192c:	cc 18 10 80 
+
+  cpuinfo();
+ffffffff80101930:	e8 17 ff ff ff       	call   ffffffff8010184c <cpuinfo>
+}
+ffffffff80101935:	90                   	nop
+ffffffff80101936:	5d                   	pop    %rbp
+ffffffff80101937:	c3                   	ret
+
+ffffffff80101938 <exec>:
+#include "x86.h"
+#include "elf.h"
+
+int
+exec(char *path, char **argv)
+{
+ffffffff80101938:	55                   	push   %rbp
+ffffffff80101939:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010193c:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+ffffffff80101943:	48 89 bd 08 fe ff ff 	mov    %rdi,-0x1f8(%rbp)
+ffffffff8010194a:	48 89 b5 00 fe ff ff 	mov    %rsi,-0x200(%rbp)
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+
+  begin_op();
+ffffffff80101951:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101956:	e8 a6 2d 00 00       	call   ffffffff80104701 <begin_op>
+  if((ip = namei(path)) == 0){
+ffffffff8010195b:	48 8b 85 08 fe ff ff 	mov    -0x1f8(%rbp),%rax
+ffffffff80101962:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101965:	e8 4e 1c 00 00       	call   ffffffff801035b8 <namei>
+ffffffff8010196a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+ffffffff8010196e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ffffffff80101973:	75 14                	jne    ffffffff80101989 <exec+0x51>
+    end_op();
+ffffffff80101975:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010197a:	e8 04 2e 00 00       	call   ffffffff80104783 <end_op>
+    return -1;
+ffffffff8010197f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80101984:	e9 d6 04 00 00       	jmp    ffffffff80101e5f <exec+0x527>
+  }
+  ilock(ip);
+ffffffff80101989:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff8010198d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101990:	e8 fc 0e 00 00       	call   ffffffff80102891 <ilock>
+  pgdir = 0;
+ffffffff80101995:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+ffffffff8010199c:	00 
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) < sizeof(elf))
+ffffffff8010199d:	48 8d b5 50 fe ff ff 	lea    -0x1b0(%rbp),%rsi
+ffffffff801019a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff801019a8:	b9 40 00 00 00       	mov    $0x40,%ecx
+ffffffff801019ad:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff801019b2:	48 89 c7             	mov    %rax,%rdi
+ffffffff801019b5:	e8 db 14 00 00       	call   ffffffff80102e95 <readi>
+ffffffff801019ba:	83 f8 3f             	cmp    $0x3f,%eax
+ffffffff801019bd:	0f 86 48 04 00 00    	jbe    ffffffff80101e0b <exec+0x4d3>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+ffffffff801019c3:	8b 85 50 fe ff ff    	mov    -0x1b0(%rbp),%eax
+ffffffff801019c9:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+ffffffff801019ce:	0f 85 3a 04 00 00    	jne    ffffffff80101e0e <exec+0x4d6>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+ffffffff801019d4:	e8 cf 87 00 00       	call   ffffffff8010a1a8 <setupkvm>
+ffffffff801019d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+ffffffff801019dd:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+ffffffff801019e2:	0f 84 29 04 00 00    	je     ffffffff80101e11 <exec+0x4d9>
+    goto bad;
+
+  // Load program into memory.
+  sz = 0;
+ffffffff801019e8:	48 c7 45 d8 00 00 00 	movq   $0x0,-0x28(%rbp)
+ffffffff801019ef:	00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+ffffffff801019f0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+ffffffff801019f7:	48 8b 85 70 fe ff ff 	mov    -0x190(%rbp),%rax
+ffffffff801019fe:	89 45 e8             	mov    %eax,-0x18(%rbp)
+ffffffff80101a01:	e9 c8 00 00 00       	jmp    ffffffff80101ace <exec+0x196>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+ffffffff80101a06:	8b 55 e8             	mov    -0x18(%rbp),%edx
+ffffffff80101a09:	48 8d b5 10 fe ff ff 	lea    -0x1f0(%rbp),%rsi
+ffffffff80101a10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80101a14:	b9 38 00 00 00       	mov    $0x38,%ecx
+ffffffff80101a19:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101a1c:	e8 74 14 00 00       	call   ffffffff80102e95 <readi>
+ffffffff80101a21:	83 f8 38             	cmp    $0x38,%eax
+ffffffff80101a24:	0f 85 ea 03 00 00    	jne    ffffffff80101e14 <exec+0x4dc>
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+ffffffff80101a2a:	8b 85 10 fe ff ff    	mov    -0x1f0(%rbp),%eax
+ffffffff80101a30:	83 f8 01             	cmp    $0x1,%eax
+ffffffff80101a33:	0f 85 87 00 00 00    	jne    ffffffff80101ac0 <exec+0x188>
+      continue;
+    if(ph.memsz < ph.filesz)
+ffffffff80101a39:	48 8b 95 38 fe ff ff 	mov    -0x1c8(%rbp),%rdx
+ffffffff80101a40:	48 8b 85 30 fe ff ff 	mov    -0x1d0(%rbp),%rax
+ffffffff80101a47:	48 39 c2             	cmp    %rax,%rdx
+ffffffff80101a4a:	0f 82 c7 03 00 00    	jb     ffffffff80101e17 <exec+0x4df>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+ffffffff80101a50:	48 8b 85 20 fe ff ff 	mov    -0x1e0(%rbp),%rax
+ffffffff80101a57:	89 c2                	mov    %eax,%edx
+ffffffff80101a59:	48 8b 85 38 fe ff ff 	mov    -0x1c8(%rbp),%rax
+ffffffff80101a60:	01 c2                	add    %eax,%edx
+ffffffff80101a62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80101a66:	89 c1                	mov    %eax,%ecx
+ffffffff80101a68:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80101a6c:	89 ce                	mov    %ecx,%esi
+ffffffff80101a6e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101a71:	e8 b5 7d 00 00       	call   ffffffff8010982b <allocuvm>
+ffffffff80101a76:	48 98                	cltq
+ffffffff80101a78:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+ffffffff80101a7c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+ffffffff80101a81:	0f 84 93 03 00 00    	je     ffffffff80101e1a <exec+0x4e2>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+ffffffff80101a87:	48 8b 85 30 fe ff ff 	mov    -0x1d0(%rbp),%rax
+ffffffff80101a8e:	89 c7                	mov    %eax,%edi
+ffffffff80101a90:	48 8b 85 18 fe ff ff 	mov    -0x1e8(%rbp),%rax
+ffffffff80101a97:	89 c1                	mov    %eax,%ecx
+ffffffff80101a99:	48 8b 85 20 fe ff ff 	mov    -0x1e0(%rbp),%rax
+ffffffff80101aa0:	48 89 c6             	mov    %rax,%rsi
+ffffffff80101aa3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+ffffffff80101aa7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80101aab:	41 89 f8             	mov    %edi,%r8d
+ffffffff80101aae:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101ab1:	e8 7b 7c 00 00       	call   ffffffff80109731 <loaduvm>
+ffffffff80101ab6:	85 c0                	test   %eax,%eax
+ffffffff80101ab8:	0f 88 5f 03 00 00    	js     ffffffff80101e1d <exec+0x4e5>
+ffffffff80101abe:	eb 01                	jmp    ffffffff80101ac1 <exec+0x189>
+      continue;
+ffffffff80101ac0:	90                   	nop
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+ffffffff80101ac1:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+ffffffff80101ac5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+ffffffff80101ac8:	83 c0 38             	add    $0x38,%eax
+ffffffff80101acb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+ffffffff80101ace:	0f b7 85 88 fe ff ff 	movzwl -0x178(%rbp),%eax
+ffffffff80101ad5:	0f b7 c0             	movzwl %ax,%eax
+ffffffff80101ad8:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ffffffff80101adb:	0f 8c 25 ff ff ff    	jl     ffffffff80101a06 <exec+0xce>
+      goto bad;
+  }
+  iunlockput(ip);
+ffffffff80101ae1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80101ae5:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101ae8:	e8 9a 10 00 00       	call   ffffffff80102b87 <iunlockput>
+  end_op();
+ffffffff80101aed:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101af2:	e8 8c 2c 00 00       	call   ffffffff80104783 <end_op>
+  ip = 0;
+ffffffff80101af7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+ffffffff80101afe:	00 
+
+  // Allocate two pages at the next page boundary.
+  // Make the first inaccessible.  Use the second as the user stack.
+  // The first page is used as a guarded page to limit the stack's memory to one page
+  // As the first page isn't used and thus accessing it would cause an exception.
+  sz = PGROUNDUP(sz);
+ffffffff80101aff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80101b03:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+ffffffff80101b09:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff80101b0f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+ffffffff80101b13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80101b17:	8d 90 00 20 00 00    	lea    0x2000(%rax),%edx
+ffffffff80101b1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80101b21:	89 c1                	mov    %eax,%ecx
+ffffffff80101b23:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80101b27:	89 ce                	mov    %ecx,%esi
+ffffffff80101b29:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101b2c:	e8 fa 7c 00 00       	call   ffffffff8010982b <allocuvm>
+ffffffff80101b31:	48 98                	cltq
+ffffffff80101b33:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+ffffffff80101b37:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+ffffffff80101b3c:	0f 84 de 02 00 00    	je     ffffffff80101e20 <exec+0x4e8>
+    goto bad;
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+ffffffff80101b42:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80101b46:	48 2d 00 20 00 00    	sub    $0x2000,%rax
+ffffffff80101b4c:	48 89 c2             	mov    %rax,%rdx
+ffffffff80101b4f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80101b53:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80101b56:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101b59:	e8 2e 7f 00 00       	call   ffffffff80109a8c <clearpteu>
+  sp = sz;
+ffffffff80101b5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80101b62:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+  // Push argument strings, prepare rest of stack in ustack.
+  for(argc = 0; argv[argc]; argc++) {
+ffffffff80101b66:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+ffffffff80101b6d:	00 
+ffffffff80101b6e:	e9 b5 00 00 00       	jmp    ffffffff80101c28 <exec+0x2f0>
+    if(argc >= MAXARG)
+ffffffff80101b73:	48 83 7d e0 1f       	cmpq   $0x1f,-0x20(%rbp)
+ffffffff80101b78:	0f 87 a5 02 00 00    	ja     ffffffff80101e23 <exec+0x4eb>
+      goto bad;
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~(sizeof(uintp)-1);
+ffffffff80101b7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101b82:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80101b89:	00 
+ffffffff80101b8a:	48 8b 85 00 fe ff ff 	mov    -0x200(%rbp),%rax
+ffffffff80101b91:	48 01 d0             	add    %rdx,%rax
+ffffffff80101b94:	48 8b 00             	mov    (%rax),%rax
+ffffffff80101b97:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101b9a:	e8 9e 54 00 00       	call   ffffffff8010703d <strlen>
+ffffffff80101b9f:	83 c0 01             	add    $0x1,%eax
+ffffffff80101ba2:	48 98                	cltq
+ffffffff80101ba4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+ffffffff80101ba8:	48 29 c2             	sub    %rax,%rdx
+ffffffff80101bab:	48 89 d0             	mov    %rdx,%rax
+ffffffff80101bae:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+ffffffff80101bb2:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+ffffffff80101bb6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101bba:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80101bc1:	00 
+ffffffff80101bc2:	48 8b 85 00 fe ff ff 	mov    -0x200(%rbp),%rax
+ffffffff80101bc9:	48 01 d0             	add    %rdx,%rax
+ffffffff80101bcc:	48 8b 00             	mov    (%rax),%rax
+ffffffff80101bcf:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101bd2:	e8 66 54 00 00       	call   ffffffff8010703d <strlen>
+ffffffff80101bd7:	83 c0 01             	add    $0x1,%eax
+ffffffff80101bda:	89 c1                	mov    %eax,%ecx
+ffffffff80101bdc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101be0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80101be7:	00 
+ffffffff80101be8:	48 8b 85 00 fe ff ff 	mov    -0x200(%rbp),%rax
+ffffffff80101bef:	48 01 d0             	add    %rdx,%rax
+ffffffff80101bf2:	48 8b 10             	mov    (%rax),%rdx
+ffffffff80101bf5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80101bf9:	89 c6                	mov    %eax,%esi
+ffffffff80101bfb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80101bff:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101c02:	e8 8b 80 00 00       	call   ffffffff80109c92 <copyout>
+ffffffff80101c07:	85 c0                	test   %eax,%eax
+ffffffff80101c09:	0f 88 17 02 00 00    	js     ffffffff80101e26 <exec+0x4ee>
+      goto bad;
+    ustack[3+argc] = sp;
+ffffffff80101c0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101c13:	48 8d 50 03          	lea    0x3(%rax),%rdx
+ffffffff80101c17:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80101c1b:	48 89 84 d5 90 fe ff 	mov    %rax,-0x170(%rbp,%rdx,8)
+ffffffff80101c22:	ff 
+  for(argc = 0; argv[argc]; argc++) {
+ffffffff80101c23:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+ffffffff80101c28:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101c2c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80101c33:	00 
+ffffffff80101c34:	48 8b 85 00 fe ff ff 	mov    -0x200(%rbp),%rax
+ffffffff80101c3b:	48 01 d0             	add    %rdx,%rax
+ffffffff80101c3e:	48 8b 00             	mov    (%rax),%rax
+ffffffff80101c41:	48 85 c0             	test   %rax,%rax
+ffffffff80101c44:	0f 85 29 ff ff ff    	jne    ffffffff80101b73 <exec+0x23b>
+  }
+  ustack[3+argc] = 0;
+ffffffff80101c4a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101c4e:	48 83 c0 03          	add    $0x3,%rax
+ffffffff80101c52:	48 c7 84 c5 90 fe ff 	movq   $0x0,-0x170(%rbp,%rax,8)
+ffffffff80101c59:	ff 00 00 00 00 
+
+  ustack[0] = 0xffffffff;  // fake return PC
+ffffffff80101c5e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80101c63:	48 89 85 90 fe ff ff 	mov    %rax,-0x170(%rbp)
+  ustack[1] = argc;
+ffffffff80101c6a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101c6e:	48 89 85 98 fe ff ff 	mov    %rax,-0x168(%rbp)
+  ustack[2] = sp - (argc+1)*sizeof(uintp);  // argv pointer
+ffffffff80101c75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101c79:	48 83 c0 01          	add    $0x1,%rax
+ffffffff80101c7d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80101c84:	00 
+ffffffff80101c85:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80101c89:	48 29 d0             	sub    %rdx,%rax
+ffffffff80101c8c:	48 89 85 a0 fe ff ff 	mov    %rax,-0x160(%rbp)
+
+#if X64
+  proc->tf->rdi = argc;
+ffffffff80101c93:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80101c9a:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80101c9e:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80101ca2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ffffffff80101ca6:	48 89 50 30          	mov    %rdx,0x30(%rax)
+  proc->tf->rsi = sp - (argc+1)*sizeof(uintp);
+ffffffff80101caa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101cae:	48 83 c0 01          	add    $0x1,%rax
+ffffffff80101cb2:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+ffffffff80101cb9:	00 
+ffffffff80101cba:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80101cc1:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80101cc5:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80101cc9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+ffffffff80101ccd:	48 29 ca             	sub    %rcx,%rdx
+ffffffff80101cd0:	48 89 50 28          	mov    %rdx,0x28(%rax)
+#endif
+
+  sp -= (3+argc+1) * sizeof(uintp);
+ffffffff80101cd4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101cd8:	48 83 c0 04          	add    $0x4,%rax
+ffffffff80101cdc:	48 c1 e0 03          	shl    $0x3,%rax
+ffffffff80101ce0:	48 29 45 d0          	sub    %rax,-0x30(%rbp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*sizeof(uintp)) < 0)
+ffffffff80101ce4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80101ce8:	48 83 c0 04          	add    $0x4,%rax
+ffffffff80101cec:	8d 0c c5 00 00 00 00 	lea    0x0(,%rax,8),%ecx
+ffffffff80101cf3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80101cf7:	89 c6                	mov    %eax,%esi
+ffffffff80101cf9:	48 8d 95 90 fe ff ff 	lea    -0x170(%rbp),%rdx
+ffffffff80101d00:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80101d04:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101d07:	e8 86 7f 00 00       	call   ffffffff80109c92 <copyout>
+ffffffff80101d0c:	85 c0                	test   %eax,%eax
+ffffffff80101d0e:	0f 88 15 01 00 00    	js     ffffffff80101e29 <exec+0x4f1>
+    goto bad;
+
+  // Save program name for debugging.
+  for(last=s=path; *s; s++)
+ffffffff80101d14:	48 8b 85 08 fe ff ff 	mov    -0x1f8(%rbp),%rax
+ffffffff80101d1b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80101d1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101d23:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff80101d27:	eb 1c                	jmp    ffffffff80101d45 <exec+0x40d>
+    if(*s == '/')
+ffffffff80101d29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101d2d:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80101d30:	3c 2f                	cmp    $0x2f,%al
+ffffffff80101d32:	75 0c                	jne    ffffffff80101d40 <exec+0x408>
+      last = s+1;
+ffffffff80101d34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101d38:	48 83 c0 01          	add    $0x1,%rax
+ffffffff80101d3c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(last=s=path; *s; s++)
+ffffffff80101d40:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ffffffff80101d45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101d49:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80101d4c:	84 c0                	test   %al,%al
+ffffffff80101d4e:	75 d9                	jne    ffffffff80101d29 <exec+0x3f1>
+  safestrcpy(proc->name, last, sizeof(proc->name));
+ffffffff80101d50:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80101d57:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80101d5b:	48 8d 88 d0 00 00 00 	lea    0xd0(%rax),%rcx
+ffffffff80101d62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80101d66:	ba 10 00 00 00       	mov    $0x10,%edx
+ffffffff80101d6b:	48 89 c6             	mov    %rax,%rsi
+ffffffff80101d6e:	48 89 cf             	mov    %rcx,%rdi
+ffffffff80101d71:	e8 64 52 00 00       	call   ffffffff80106fda <safestrcpy>
+
+  // Commit to the user image.
+  oldpgdir = proc->pgdir;
+ffffffff80101d76:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80101d7d:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80101d81:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff80101d85:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  proc->pgdir = pgdir;
+ffffffff80101d89:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80101d90:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80101d94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+ffffffff80101d98:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  proc->sz = sz;
+ffffffff80101d9c:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80101da3:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80101da7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+ffffffff80101dab:	48 89 10             	mov    %rdx,(%rax)
+  proc->tf->eip = elf.entry;  // main
+ffffffff80101dae:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80101db5:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80101db9:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80101dbd:	48 8b 95 68 fe ff ff 	mov    -0x198(%rbp),%rdx
+ffffffff80101dc4:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  proc->tf->esp = sp;
+ffffffff80101dcb:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80101dd2:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80101dd6:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80101dda:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+ffffffff80101dde:	48 89 90 a0 00 00 00 	mov    %rdx,0xa0(%rax)
+  switchuvm(proc);
+ffffffff80101de5:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80101dec:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80101df0:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101df3:	e8 7d 86 00 00       	call   ffffffff8010a475 <switchuvm>
+  freevm(oldpgdir);
+ffffffff80101df8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff80101dfc:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101dff:	e8 de 7b 00 00       	call   ffffffff801099e2 <freevm>
+  return 0;
+ffffffff80101e04:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101e09:	eb 54                	jmp    ffffffff80101e5f <exec+0x527>
+    goto bad;
+ffffffff80101e0b:	90                   	nop
+ffffffff80101e0c:	eb 1c                	jmp    ffffffff80101e2a <exec+0x4f2>
+    goto bad;
+ffffffff80101e0e:	90                   	nop
+ffffffff80101e0f:	eb 19                	jmp    ffffffff80101e2a <exec+0x4f2>
+    goto bad;
+ffffffff80101e11:	90                   	nop
+ffffffff80101e12:	eb 16                	jmp    ffffffff80101e2a <exec+0x4f2>
+      goto bad;
+ffffffff80101e14:	90                   	nop
+ffffffff80101e15:	eb 13                	jmp    ffffffff80101e2a <exec+0x4f2>
+      goto bad;
+ffffffff80101e17:	90                   	nop
+ffffffff80101e18:	eb 10                	jmp    ffffffff80101e2a <exec+0x4f2>
+      goto bad;
+ffffffff80101e1a:	90                   	nop
+ffffffff80101e1b:	eb 0d                	jmp    ffffffff80101e2a <exec+0x4f2>
+      goto bad;
+ffffffff80101e1d:	90                   	nop
+ffffffff80101e1e:	eb 0a                	jmp    ffffffff80101e2a <exec+0x4f2>
+    goto bad;
+ffffffff80101e20:	90                   	nop
+ffffffff80101e21:	eb 07                	jmp    ffffffff80101e2a <exec+0x4f2>
+      goto bad;
+ffffffff80101e23:	90                   	nop
+ffffffff80101e24:	eb 04                	jmp    ffffffff80101e2a <exec+0x4f2>
+      goto bad;
+ffffffff80101e26:	90                   	nop
+ffffffff80101e27:	eb 01                	jmp    ffffffff80101e2a <exec+0x4f2>
+    goto bad;
+ffffffff80101e29:	90                   	nop
+
+ bad:
+  if(pgdir)
+ffffffff80101e2a:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+ffffffff80101e2f:	74 0c                	je     ffffffff80101e3d <exec+0x505>
+    freevm(pgdir);
+ffffffff80101e31:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80101e35:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101e38:	e8 a5 7b 00 00       	call   ffffffff801099e2 <freevm>
+  if(ip){
+ffffffff80101e3d:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ffffffff80101e42:	74 16                	je     ffffffff80101e5a <exec+0x522>
+    iunlockput(ip);
+ffffffff80101e44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80101e48:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101e4b:	e8 37 0d 00 00       	call   ffffffff80102b87 <iunlockput>
+    end_op();
+ffffffff80101e50:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80101e55:	e8 29 29 00 00       	call   ffffffff80104783 <end_op>
+  }
+  return -1;
+ffffffff80101e5a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff80101e5f:	c9                   	leave
+ffffffff80101e60:	c3                   	ret
+
+ffffffff80101e61 <fileinit>:
+  struct file file[NFILE];
+} ftable;
+
+void
+fileinit(void)
+{
+ffffffff80101e61:	55                   	push   %rbp
+ffffffff80101e62:	48 89 e5             	mov    %rsp,%rbp
+  initlock(&ftable.lock, "ftable");
+ffffffff80101e65:	48 c7 c6 7b a7 10 80 	mov    $0xffffffff8010a77b,%rsi
+ffffffff80101e6c:	48 c7 c7 80 05 11 80 	mov    $0xffffffff80110580,%rdi
+ffffffff80101e73:	e8 22 4b 00 00       	call   ffffffff8010699a <initlock>
+}
+ffffffff80101e78:	90                   	nop
+ffffffff80101e79:	5d                   	pop    %rbp
+ffffffff80101e7a:	c3                   	ret
+
+ffffffff80101e7b <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+ffffffff80101e7b:	55                   	push   %rbp
+ffffffff80101e7c:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80101e7f:	48 83 ec 10          	sub    $0x10,%rsp
+  struct file *f;
+
+  acquire(&ftable.lock);
+ffffffff80101e83:	48 c7 c7 80 05 11 80 	mov    $0xffffffff80110580,%rdi
+ffffffff80101e8a:	e8 40 4b 00 00       	call   ffffffff801069cf <acquire>
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+ffffffff80101e8f:	48 c7 45 f8 e8 05 11 	movq   $0xffffffff801105e8,-0x8(%rbp)
+ffffffff80101e96:	80 
+ffffffff80101e97:	eb 2d                	jmp    ffffffff80101ec6 <filealloc+0x4b>
+    if(f->ref == 0){
+ffffffff80101e99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101e9d:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80101ea0:	85 c0                	test   %eax,%eax
+ffffffff80101ea2:	75 1d                	jne    ffffffff80101ec1 <filealloc+0x46>
+      f->ref = 1;
+ffffffff80101ea4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101ea8:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%rax)
+      release(&ftable.lock);
+ffffffff80101eaf:	48 c7 c7 80 05 11 80 	mov    $0xffffffff80110580,%rdi
+ffffffff80101eb6:	e8 eb 4b 00 00       	call   ffffffff80106aa6 <release>
+      return f;
+ffffffff80101ebb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101ebf:	eb 23                	jmp    ffffffff80101ee4 <filealloc+0x69>
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+ffffffff80101ec1:	48 83 45 f8 28       	addq   $0x28,-0x8(%rbp)
+ffffffff80101ec6:	48 c7 c0 88 15 11 80 	mov    $0xffffffff80111588,%rax
+ffffffff80101ecd:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ffffffff80101ed1:	72 c6                	jb     ffffffff80101e99 <filealloc+0x1e>
+    }
+  }
+  release(&ftable.lock);
+ffffffff80101ed3:	48 c7 c7 80 05 11 80 	mov    $0xffffffff80110580,%rdi
+ffffffff80101eda:	e8 c7 4b 00 00       	call   ffffffff80106aa6 <release>
+  return 0;
+ffffffff80101edf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80101ee4:	c9                   	leave
+ffffffff80101ee5:	c3                   	ret
+
+ffffffff80101ee6 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+ffffffff80101ee6:	55                   	push   %rbp
+ffffffff80101ee7:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80101eea:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80101eee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  acquire(&ftable.lock);
+ffffffff80101ef2:	48 c7 c7 80 05 11 80 	mov    $0xffffffff80110580,%rdi
+ffffffff80101ef9:	e8 d1 4a 00 00       	call   ffffffff801069cf <acquire>
+  if(f->ref < 1)
+ffffffff80101efe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101f02:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80101f05:	85 c0                	test   %eax,%eax
+ffffffff80101f07:	7f 0c                	jg     ffffffff80101f15 <filedup+0x2f>
+    panic("filedup");
+ffffffff80101f09:	48 c7 c7 82 a7 10 80 	mov    $0xffffffff8010a782,%rdi
+ffffffff80101f10:	e8 1a ea ff ff       	call   ffffffff8010092f <panic>
+  f->ref++;
+ffffffff80101f15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101f19:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80101f1c:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff80101f1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80101f23:	89 50 04             	mov    %edx,0x4(%rax)
+  release(&ftable.lock);
+ffffffff80101f26:	48 c7 c7 80 05 11 80 	mov    $0xffffffff80110580,%rdi
+ffffffff80101f2d:	e8 74 4b 00 00       	call   ffffffff80106aa6 <release>
+  return f;
+ffffffff80101f32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80101f36:	c9                   	leave
+ffffffff80101f37:	c3                   	ret
+
+ffffffff80101f38 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+ffffffff80101f38:	55                   	push   %rbp
+ffffffff80101f39:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80101f3c:	53                   	push   %rbx
+ffffffff80101f3d:	48 83 ec 48          	sub    $0x48,%rsp
+ffffffff80101f41:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  struct file ff;
+
+  acquire(&ftable.lock);
+ffffffff80101f45:	48 c7 c7 80 05 11 80 	mov    $0xffffffff80110580,%rdi
+ffffffff80101f4c:	e8 7e 4a 00 00       	call   ffffffff801069cf <acquire>
+  if(f->ref < 1)
+ffffffff80101f51:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff80101f55:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80101f58:	85 c0                	test   %eax,%eax
+ffffffff80101f5a:	7f 0c                	jg     ffffffff80101f68 <fileclose+0x30>
+    panic("fileclose");
+ffffffff80101f5c:	48 c7 c7 8a a7 10 80 	mov    $0xffffffff8010a78a,%rdi
+ffffffff80101f63:	e8 c7 e9 ff ff       	call   ffffffff8010092f <panic>
+  if(--f->ref > 0){
+ffffffff80101f68:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff80101f6c:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80101f6f:	8d 50 ff             	lea    -0x1(%rax),%edx
+ffffffff80101f72:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff80101f76:	89 50 04             	mov    %edx,0x4(%rax)
+ffffffff80101f79:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff80101f7d:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80101f80:	85 c0                	test   %eax,%eax
+ffffffff80101f82:	7e 11                	jle    ffffffff80101f95 <fileclose+0x5d>
+    release(&ftable.lock);
+ffffffff80101f84:	48 c7 c7 80 05 11 80 	mov    $0xffffffff80110580,%rdi
+ffffffff80101f8b:	e8 16 4b 00 00       	call   ffffffff80106aa6 <release>
+ffffffff80101f90:	e9 93 00 00 00       	jmp    ffffffff80102028 <fileclose+0xf0>
+    return;
+  }
+  ff = *f;
+ffffffff80101f95:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff80101f99:	48 8b 08             	mov    (%rax),%rcx
+ffffffff80101f9c:	48 8b 58 08          	mov    0x8(%rax),%rbx
+ffffffff80101fa0:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+ffffffff80101fa4:	48 89 5d c8          	mov    %rbx,-0x38(%rbp)
+ffffffff80101fa8:	48 8b 48 10          	mov    0x10(%rax),%rcx
+ffffffff80101fac:	48 8b 58 18          	mov    0x18(%rax),%rbx
+ffffffff80101fb0:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+ffffffff80101fb4:	48 89 5d d8          	mov    %rbx,-0x28(%rbp)
+ffffffff80101fb8:	48 8b 40 20          	mov    0x20(%rax),%rax
+ffffffff80101fbc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  f->ref = 0;
+ffffffff80101fc0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff80101fc4:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  f->type = FD_NONE;
+ffffffff80101fcb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff80101fcf:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  release(&ftable.lock);
+ffffffff80101fd5:	48 c7 c7 80 05 11 80 	mov    $0xffffffff80110580,%rdi
+ffffffff80101fdc:	e8 c5 4a 00 00       	call   ffffffff80106aa6 <release>
+  
+  if(ff.type == FD_PIPE)
+ffffffff80101fe1:	8b 45 c0             	mov    -0x40(%rbp),%eax
+ffffffff80101fe4:	83 f8 01             	cmp    $0x1,%eax
+ffffffff80101fe7:	75 17                	jne    ffffffff80102000 <fileclose+0xc8>
+    pipeclose(ff.pipe, ff.writable);
+ffffffff80101fe9:	0f b6 45 c9          	movzbl -0x37(%rbp),%eax
+ffffffff80101fed:	0f be d0             	movsbl %al,%edx
+ffffffff80101ff0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80101ff4:	89 d6                	mov    %edx,%esi
+ffffffff80101ff6:	48 89 c7             	mov    %rax,%rdi
+ffffffff80101ff9:	e8 cb 38 00 00       	call   ffffffff801058c9 <pipeclose>
+ffffffff80101ffe:	eb 28                	jmp    ffffffff80102028 <fileclose+0xf0>
+  else if(ff.type == FD_INODE){
+ffffffff80102000:	8b 45 c0             	mov    -0x40(%rbp),%eax
+ffffffff80102003:	83 f8 02             	cmp    $0x2,%eax
+ffffffff80102006:	75 20                	jne    ffffffff80102028 <fileclose+0xf0>
+    begin_op();
+ffffffff80102008:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010200d:	e8 ef 26 00 00       	call   ffffffff80104701 <begin_op>
+    iput(ff.ip);
+ffffffff80102012:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102016:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102019:	e8 84 0a 00 00       	call   ffffffff80102aa2 <iput>
+    end_op();
+ffffffff8010201e:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80102023:	e8 5b 27 00 00       	call   ffffffff80104783 <end_op>
+  }
+}
+ffffffff80102028:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ffffffff8010202c:	c9                   	leave
+ffffffff8010202d:	c3                   	ret
+
+ffffffff8010202e <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+ffffffff8010202e:	55                   	push   %rbp
+ffffffff8010202f:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102032:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80102036:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff8010203a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(f->type == FD_INODE){
+ffffffff8010203e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102042:	8b 00                	mov    (%rax),%eax
+ffffffff80102044:	83 f8 02             	cmp    $0x2,%eax
+ffffffff80102047:	75 3e                	jne    ffffffff80102087 <filestat+0x59>
+    ilock(f->ip);
+ffffffff80102049:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010204d:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff80102051:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102054:	e8 38 08 00 00       	call   ffffffff80102891 <ilock>
+    stati(f->ip, st);
+ffffffff80102059:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010205d:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff80102061:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff80102065:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80102068:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010206b:	e8 9a 0d 00 00       	call   ffffffff80102e0a <stati>
+    iunlock(f->ip);
+ffffffff80102070:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102074:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff80102078:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010207b:	e8 b0 09 00 00       	call   ffffffff80102a30 <iunlock>
+    return 0;
+ffffffff80102080:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80102085:	eb 05                	jmp    ffffffff8010208c <filestat+0x5e>
+  }
+  return -1;
+ffffffff80102087:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff8010208c:	c9                   	leave
+ffffffff8010208d:	c3                   	ret
+
+ffffffff8010208e <fileread>:
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+ffffffff8010208e:	55                   	push   %rbp
+ffffffff8010208f:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102092:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80102096:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff8010209a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff8010209e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  int r;
+
+  if(f->readable == 0)
+ffffffff801020a1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801020a5:	0f b6 40 08          	movzbl 0x8(%rax),%eax
+ffffffff801020a9:	84 c0                	test   %al,%al
+ffffffff801020ab:	75 0a                	jne    ffffffff801020b7 <fileread+0x29>
+    return -1;
+ffffffff801020ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801020b2:	e9 9d 00 00 00       	jmp    ffffffff80102154 <fileread+0xc6>
+  if(f->type == FD_PIPE)
+ffffffff801020b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801020bb:	8b 00                	mov    (%rax),%eax
+ffffffff801020bd:	83 f8 01             	cmp    $0x1,%eax
+ffffffff801020c0:	75 1c                	jne    ffffffff801020de <fileread+0x50>
+    return piperead(f->pipe, addr, n);
+ffffffff801020c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801020c6:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff801020ca:	8b 55 dc             	mov    -0x24(%rbp),%edx
+ffffffff801020cd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+ffffffff801020d1:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801020d4:	48 89 c7             	mov    %rax,%rdi
+ffffffff801020d7:	e8 a8 39 00 00       	call   ffffffff80105a84 <piperead>
+ffffffff801020dc:	eb 76                	jmp    ffffffff80102154 <fileread+0xc6>
+  if(f->type == FD_INODE){
+ffffffff801020de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801020e2:	8b 00                	mov    (%rax),%eax
+ffffffff801020e4:	83 f8 02             	cmp    $0x2,%eax
+ffffffff801020e7:	75 5f                	jne    ffffffff80102148 <fileread+0xba>
+    ilock(f->ip);
+ffffffff801020e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801020ed:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff801020f1:	48 89 c7             	mov    %rax,%rdi
+ffffffff801020f4:	e8 98 07 00 00       	call   ffffffff80102891 <ilock>
+    if((r = readi(f->ip, addr, f->off, n)) > 0)
+ffffffff801020f9:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+ffffffff801020fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102100:	8b 50 20             	mov    0x20(%rax),%edx
+ffffffff80102103:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102107:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff8010210b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+ffffffff8010210f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102112:	e8 7e 0d 00 00       	call   ffffffff80102e95 <readi>
+ffffffff80102117:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff8010211a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff8010211e:	7e 13                	jle    ffffffff80102133 <fileread+0xa5>
+      f->off += r;
+ffffffff80102120:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102124:	8b 50 20             	mov    0x20(%rax),%edx
+ffffffff80102127:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010212a:	01 c2                	add    %eax,%edx
+ffffffff8010212c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102130:	89 50 20             	mov    %edx,0x20(%rax)
+    iunlock(f->ip);
+ffffffff80102133:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102137:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff8010213b:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010213e:	e8 ed 08 00 00       	call   ffffffff80102a30 <iunlock>
+    return r;
+ffffffff80102143:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80102146:	eb 0c                	jmp    ffffffff80102154 <fileread+0xc6>
+  }
+  panic("fileread");
+ffffffff80102148:	48 c7 c7 94 a7 10 80 	mov    $0xffffffff8010a794,%rdi
+ffffffff8010214f:	e8 db e7 ff ff       	call   ffffffff8010092f <panic>
+}
+ffffffff80102154:	c9                   	leave
+ffffffff80102155:	c3                   	ret
+
+ffffffff80102156 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+ffffffff80102156:	55                   	push   %rbp
+ffffffff80102157:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010215a:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff8010215e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80102162:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80102166:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  int r;
+
+  if(f->writable == 0)
+ffffffff80102169:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010216d:	0f b6 40 09          	movzbl 0x9(%rax),%eax
+ffffffff80102171:	84 c0                	test   %al,%al
+ffffffff80102173:	75 0a                	jne    ffffffff8010217f <filewrite+0x29>
+    return -1;
+ffffffff80102175:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010217a:	e9 29 01 00 00       	jmp    ffffffff801022a8 <filewrite+0x152>
+  if(f->type == FD_PIPE)
+ffffffff8010217f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102183:	8b 00                	mov    (%rax),%eax
+ffffffff80102185:	83 f8 01             	cmp    $0x1,%eax
+ffffffff80102188:	75 1f                	jne    ffffffff801021a9 <filewrite+0x53>
+    return pipewrite(f->pipe, addr, n);
+ffffffff8010218a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010218e:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff80102192:	8b 55 dc             	mov    -0x24(%rbp),%edx
+ffffffff80102195:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+ffffffff80102199:	48 89 ce             	mov    %rcx,%rsi
+ffffffff8010219c:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010219f:	e8 ce 37 00 00       	call   ffffffff80105972 <pipewrite>
+ffffffff801021a4:	e9 ff 00 00 00       	jmp    ffffffff801022a8 <filewrite+0x152>
+  if(f->type == FD_INODE){
+ffffffff801021a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801021ad:	8b 00                	mov    (%rax),%eax
+ffffffff801021af:	83 f8 02             	cmp    $0x2,%eax
+ffffffff801021b2:	0f 85 e4 00 00 00    	jne    ffffffff8010229c <filewrite+0x146>
+    // the maximum log transaction size, including
+    // i-node, indirect block, allocation blocks,
+    // and 2 blocks of slop for non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((LOGSIZE-1-1-2) / 2) * 512;
+ffffffff801021b8:	c7 45 f4 00 1a 00 00 	movl   $0x1a00,-0xc(%rbp)
+    int i = 0;
+ffffffff801021bf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    while(i < n){
+ffffffff801021c6:	e9 ae 00 00 00       	jmp    ffffffff80102279 <filewrite+0x123>
+      int n1 = n - i;
+ffffffff801021cb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff801021ce:	2b 45 fc             	sub    -0x4(%rbp),%eax
+ffffffff801021d1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      if(n1 > max)
+ffffffff801021d4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff801021d7:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+ffffffff801021da:	7e 06                	jle    ffffffff801021e2 <filewrite+0x8c>
+        n1 = max;
+ffffffff801021dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff801021df:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+      begin_op();
+ffffffff801021e2:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801021e7:	e8 15 25 00 00       	call   ffffffff80104701 <begin_op>
+      ilock(f->ip);
+ffffffff801021ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801021f0:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff801021f4:	48 89 c7             	mov    %rax,%rdi
+ffffffff801021f7:	e8 95 06 00 00       	call   ffffffff80102891 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+ffffffff801021fc:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+ffffffff801021ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102203:	8b 50 20             	mov    0x20(%rax),%edx
+ffffffff80102206:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80102209:	48 63 f0             	movslq %eax,%rsi
+ffffffff8010220c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80102210:	48 01 c6             	add    %rax,%rsi
+ffffffff80102213:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102217:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff8010221b:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010221e:	e8 f6 0d 00 00       	call   ffffffff80103019 <writei>
+ffffffff80102223:	89 45 f0             	mov    %eax,-0x10(%rbp)
+ffffffff80102226:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+ffffffff8010222a:	7e 13                	jle    ffffffff8010223f <filewrite+0xe9>
+        f->off += r;
+ffffffff8010222c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102230:	8b 50 20             	mov    0x20(%rax),%edx
+ffffffff80102233:	8b 45 f0             	mov    -0x10(%rbp),%eax
+ffffffff80102236:	01 c2                	add    %eax,%edx
+ffffffff80102238:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010223c:	89 50 20             	mov    %edx,0x20(%rax)
+      iunlock(f->ip);
+ffffffff8010223f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102243:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff80102247:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010224a:	e8 e1 07 00 00       	call   ffffffff80102a30 <iunlock>
+      end_op();
+ffffffff8010224f:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80102254:	e8 2a 25 00 00       	call   ffffffff80104783 <end_op>
+
+      if(r < 0)
+ffffffff80102259:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+ffffffff8010225d:	78 28                	js     ffffffff80102287 <filewrite+0x131>
+        break;
+      if(r != n1)
+ffffffff8010225f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+ffffffff80102262:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+ffffffff80102265:	74 0c                	je     ffffffff80102273 <filewrite+0x11d>
+        panic("short filewrite");
+ffffffff80102267:	48 c7 c7 9d a7 10 80 	mov    $0xffffffff8010a79d,%rdi
+ffffffff8010226e:	e8 bc e6 ff ff       	call   ffffffff8010092f <panic>
+      i += r;
+ffffffff80102273:	8b 45 f0             	mov    -0x10(%rbp),%eax
+ffffffff80102276:	01 45 fc             	add    %eax,-0x4(%rbp)
+    while(i < n){
+ffffffff80102279:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010227c:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+ffffffff8010227f:	0f 8c 46 ff ff ff    	jl     ffffffff801021cb <filewrite+0x75>
+ffffffff80102285:	eb 01                	jmp    ffffffff80102288 <filewrite+0x132>
+        break;
+ffffffff80102287:	90                   	nop
+    }
+    return i == n ? n : -1;
+ffffffff80102288:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010228b:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+ffffffff8010228e:	75 05                	jne    ffffffff80102295 <filewrite+0x13f>
+ffffffff80102290:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80102293:	eb 13                	jmp    ffffffff801022a8 <filewrite+0x152>
+ffffffff80102295:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010229a:	eb 0c                	jmp    ffffffff801022a8 <filewrite+0x152>
+  }
+  panic("filewrite");
+ffffffff8010229c:	48 c7 c7 ad a7 10 80 	mov    $0xffffffff8010a7ad,%rdi
+ffffffff801022a3:	e8 87 e6 ff ff       	call   ffffffff8010092f <panic>
+}
+ffffffff801022a8:	c9                   	leave
+ffffffff801022a9:	c3                   	ret
+
+ffffffff801022aa <readsb>:
+static void itrunc(struct inode*);
+
+// Read the super block.
+void
+readsb(int dev, struct superblock *sb)
+{
+ffffffff801022aa:	55                   	push   %rbp
+ffffffff801022ab:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801022ae:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801022b2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ffffffff801022b5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct buf *bp;
+  
+  bp = bread(dev, 1);
+ffffffff801022b9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff801022bc:	be 01 00 00 00       	mov    $0x1,%esi
+ffffffff801022c1:	89 c7                	mov    %eax,%edi
+ffffffff801022c3:	e8 0f e0 ff ff       	call   ffffffff801002d7 <bread>
+ffffffff801022c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memmove(sb, bp->data, sizeof(*sb));
+ffffffff801022cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801022d0:	48 8d 48 28          	lea    0x28(%rax),%rcx
+ffffffff801022d4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff801022d8:	ba 10 00 00 00       	mov    $0x10,%edx
+ffffffff801022dd:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801022e0:	48 89 c7             	mov    %rax,%rdi
+ffffffff801022e3:	e8 46 4b 00 00       	call   ffffffff80106e2e <memmove>
+  brelse(bp);
+ffffffff801022e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801022ec:	48 89 c7             	mov    %rax,%rdi
+ffffffff801022ef:	e8 68 e0 ff ff       	call   ffffffff8010035c <brelse>
+}
+ffffffff801022f4:	90                   	nop
+ffffffff801022f5:	c9                   	leave
+ffffffff801022f6:	c3                   	ret
+
+ffffffff801022f7 <bzero>:
+
+// Zero a block.
+static void
+bzero(int dev, int bno)
+{
+ffffffff801022f7:	55                   	push   %rbp
+ffffffff801022f8:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801022fb:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801022ff:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ffffffff80102302:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  struct buf *bp;
+  
+  bp = bread(dev, bno);
+ffffffff80102305:	8b 55 e8             	mov    -0x18(%rbp),%edx
+ffffffff80102308:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff8010230b:	89 d6                	mov    %edx,%esi
+ffffffff8010230d:	89 c7                	mov    %eax,%edi
+ffffffff8010230f:	e8 c3 df ff ff       	call   ffffffff801002d7 <bread>
+ffffffff80102314:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(bp->data, 0, BSIZE);
+ffffffff80102318:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010231c:	48 83 c0 28          	add    $0x28,%rax
+ffffffff80102320:	ba 00 02 00 00       	mov    $0x200,%edx
+ffffffff80102325:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010232a:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010232d:	e8 0d 4a 00 00       	call   ffffffff80106d3f <memset>
+  log_write(bp);
+ffffffff80102332:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102336:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102339:	e8 e1 25 00 00       	call   ffffffff8010491f <log_write>
+  brelse(bp);
+ffffffff8010233e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102342:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102345:	e8 12 e0 ff ff       	call   ffffffff8010035c <brelse>
+}
+ffffffff8010234a:	90                   	nop
+ffffffff8010234b:	c9                   	leave
+ffffffff8010234c:	c3                   	ret
+
+ffffffff8010234d <balloc>:
+// Blocks. 
+
+// Allocate a zeroed disk block.
+static uint
+balloc(uint dev)
+{
+ffffffff8010234d:	55                   	push   %rbp
+ffffffff8010234e:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102351:	48 83 ec 40          	sub    $0x40,%rsp
+ffffffff80102355:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  int b, bi, m;
+  struct buf *bp;
+  struct superblock sb;
+
+  bp = 0;
+ffffffff80102358:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+ffffffff8010235f:	00 
+  readsb(dev, &sb);
+ffffffff80102360:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff80102363:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+ffffffff80102367:	48 89 d6             	mov    %rdx,%rsi
+ffffffff8010236a:	89 c7                	mov    %eax,%edi
+ffffffff8010236c:	e8 39 ff ff ff       	call   ffffffff801022aa <readsb>
+  for(b = 0; b < sb.size; b += BPB){
+ffffffff80102371:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80102378:	e9 0d 01 00 00       	jmp    ffffffff8010248a <balloc+0x13d>
+    bp = bread(dev, BBLOCK(b, sb.ninodes));
+ffffffff8010237d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80102380:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+ffffffff80102386:	85 c0                	test   %eax,%eax
+ffffffff80102388:	0f 48 c2             	cmovs  %edx,%eax
+ffffffff8010238b:	c1 f8 0c             	sar    $0xc,%eax
+ffffffff8010238e:	89 c2                	mov    %eax,%edx
+ffffffff80102390:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ffffffff80102393:	c1 e8 03             	shr    $0x3,%eax
+ffffffff80102396:	01 d0                	add    %edx,%eax
+ffffffff80102398:	8d 50 03             	lea    0x3(%rax),%edx
+ffffffff8010239b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff8010239e:	89 d6                	mov    %edx,%esi
+ffffffff801023a0:	89 c7                	mov    %eax,%edi
+ffffffff801023a2:	e8 30 df ff ff       	call   ffffffff801002d7 <bread>
+ffffffff801023a7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+ffffffff801023ab:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+ffffffff801023b2:	e9 a2 00 00 00       	jmp    ffffffff80102459 <balloc+0x10c>
+      m = 1 << (bi % 8);
+ffffffff801023b7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff801023ba:	83 e0 07             	and    $0x7,%eax
+ffffffff801023bd:	ba 01 00 00 00       	mov    $0x1,%edx
+ffffffff801023c2:	89 c1                	mov    %eax,%ecx
+ffffffff801023c4:	d3 e2                	shl    %cl,%edx
+ffffffff801023c6:	89 d0                	mov    %edx,%eax
+ffffffff801023c8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+      if((bp->data[bi/8] & m) == 0){  // Is block free?
+ffffffff801023cb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff801023ce:	8d 50 07             	lea    0x7(%rax),%edx
+ffffffff801023d1:	85 c0                	test   %eax,%eax
+ffffffff801023d3:	0f 48 c2             	cmovs  %edx,%eax
+ffffffff801023d6:	c1 f8 03             	sar    $0x3,%eax
+ffffffff801023d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff801023dd:	48 98                	cltq
+ffffffff801023df:	0f b6 44 02 28       	movzbl 0x28(%rdx,%rax,1),%eax
+ffffffff801023e4:	0f b6 c0             	movzbl %al,%eax
+ffffffff801023e7:	23 45 ec             	and    -0x14(%rbp),%eax
+ffffffff801023ea:	85 c0                	test   %eax,%eax
+ffffffff801023ec:	75 67                	jne    ffffffff80102455 <balloc+0x108>
+        bp->data[bi/8] |= m;  // Mark block in use.
+ffffffff801023ee:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff801023f1:	8d 50 07             	lea    0x7(%rax),%edx
+ffffffff801023f4:	85 c0                	test   %eax,%eax
+ffffffff801023f6:	0f 48 c2             	cmovs  %edx,%eax
+ffffffff801023f9:	c1 f8 03             	sar    $0x3,%eax
+ffffffff801023fc:	89 c1                	mov    %eax,%ecx
+ffffffff801023fe:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff80102402:	48 63 c1             	movslq %ecx,%rax
+ffffffff80102405:	0f b6 44 02 28       	movzbl 0x28(%rdx,%rax,1),%eax
+ffffffff8010240a:	89 c2                	mov    %eax,%edx
+ffffffff8010240c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff8010240f:	09 d0                	or     %edx,%eax
+ffffffff80102411:	89 c6                	mov    %eax,%esi
+ffffffff80102413:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff80102417:	48 63 c1             	movslq %ecx,%rax
+ffffffff8010241a:	40 88 74 02 28       	mov    %sil,0x28(%rdx,%rax,1)
+        log_write(bp);
+ffffffff8010241f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102423:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102426:	e8 f4 24 00 00       	call   ffffffff8010491f <log_write>
+        brelse(bp);
+ffffffff8010242b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010242f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102432:	e8 25 df ff ff       	call   ffffffff8010035c <brelse>
+        bzero(dev, b + bi);
+ffffffff80102437:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010243a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff8010243d:	01 c2                	add    %eax,%edx
+ffffffff8010243f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff80102442:	89 d6                	mov    %edx,%esi
+ffffffff80102444:	89 c7                	mov    %eax,%edi
+ffffffff80102446:	e8 ac fe ff ff       	call   ffffffff801022f7 <bzero>
+        return b + bi;
+ffffffff8010244b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010244e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80102451:	01 d0                	add    %edx,%eax
+ffffffff80102453:	eb 4f                	jmp    ffffffff801024a4 <balloc+0x157>
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+ffffffff80102455:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+ffffffff80102459:	81 7d f8 ff 0f 00 00 	cmpl   $0xfff,-0x8(%rbp)
+ffffffff80102460:	7f 15                	jg     ffffffff80102477 <balloc+0x12a>
+ffffffff80102462:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80102465:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80102468:	01 d0                	add    %edx,%eax
+ffffffff8010246a:	89 c2                	mov    %eax,%edx
+ffffffff8010246c:	8b 45 d0             	mov    -0x30(%rbp),%eax
+ffffffff8010246f:	39 c2                	cmp    %eax,%edx
+ffffffff80102471:	0f 82 40 ff ff ff    	jb     ffffffff801023b7 <balloc+0x6a>
+      }
+    }
+    brelse(bp);
+ffffffff80102477:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010247b:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010247e:	e8 d9 de ff ff       	call   ffffffff8010035c <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+ffffffff80102483:	81 45 fc 00 10 00 00 	addl   $0x1000,-0x4(%rbp)
+ffffffff8010248a:	8b 45 d0             	mov    -0x30(%rbp),%eax
+ffffffff8010248d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80102490:	39 c2                	cmp    %eax,%edx
+ffffffff80102492:	0f 82 e5 fe ff ff    	jb     ffffffff8010237d <balloc+0x30>
+  }
+  panic("balloc: out of blocks");
+ffffffff80102498:	48 c7 c7 b7 a7 10 80 	mov    $0xffffffff8010a7b7,%rdi
+ffffffff8010249f:	e8 8b e4 ff ff       	call   ffffffff8010092f <panic>
+}
+ffffffff801024a4:	c9                   	leave
+ffffffff801024a5:	c3                   	ret
+
+ffffffff801024a6 <bfree>:
+
+// Free a disk block.
+static void
+bfree(int dev, uint b)
+{
+ffffffff801024a6:	55                   	push   %rbp
+ffffffff801024a7:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801024aa:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff801024ae:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ffffffff801024b1:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  struct buf *bp;
+  struct superblock sb;
+  int bi, m;
+
+  readsb(dev, &sb);
+ffffffff801024b4:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+ffffffff801024b8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff801024bb:	48 89 d6             	mov    %rdx,%rsi
+ffffffff801024be:	89 c7                	mov    %eax,%edi
+ffffffff801024c0:	e8 e5 fd ff ff       	call   ffffffff801022aa <readsb>
+  bp = bread(dev, BBLOCK(b, sb.ninodes));
+ffffffff801024c5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ffffffff801024c8:	c1 e8 0c             	shr    $0xc,%eax
+ffffffff801024cb:	89 c2                	mov    %eax,%edx
+ffffffff801024cd:	8b 45 e8             	mov    -0x18(%rbp),%eax
+ffffffff801024d0:	c1 e8 03             	shr    $0x3,%eax
+ffffffff801024d3:	01 d0                	add    %edx,%eax
+ffffffff801024d5:	8d 50 03             	lea    0x3(%rax),%edx
+ffffffff801024d8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff801024db:	89 d6                	mov    %edx,%esi
+ffffffff801024dd:	89 c7                	mov    %eax,%edi
+ffffffff801024df:	e8 f3 dd ff ff       	call   ffffffff801002d7 <bread>
+ffffffff801024e4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  bi = b % BPB;
+ffffffff801024e8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ffffffff801024eb:	25 ff 0f 00 00       	and    $0xfff,%eax
+ffffffff801024f0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  m = 1 << (bi % 8);
+ffffffff801024f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff801024f6:	83 e0 07             	and    $0x7,%eax
+ffffffff801024f9:	ba 01 00 00 00       	mov    $0x1,%edx
+ffffffff801024fe:	89 c1                	mov    %eax,%ecx
+ffffffff80102500:	d3 e2                	shl    %cl,%edx
+ffffffff80102502:	89 d0                	mov    %edx,%eax
+ffffffff80102504:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  if((bp->data[bi/8] & m) == 0)
+ffffffff80102507:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff8010250a:	8d 50 07             	lea    0x7(%rax),%edx
+ffffffff8010250d:	85 c0                	test   %eax,%eax
+ffffffff8010250f:	0f 48 c2             	cmovs  %edx,%eax
+ffffffff80102512:	c1 f8 03             	sar    $0x3,%eax
+ffffffff80102515:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80102519:	48 98                	cltq
+ffffffff8010251b:	0f b6 44 02 28       	movzbl 0x28(%rdx,%rax,1),%eax
+ffffffff80102520:	0f b6 c0             	movzbl %al,%eax
+ffffffff80102523:	23 45 f0             	and    -0x10(%rbp),%eax
+ffffffff80102526:	85 c0                	test   %eax,%eax
+ffffffff80102528:	75 0c                	jne    ffffffff80102536 <bfree+0x90>
+    panic("freeing free block");
+ffffffff8010252a:	48 c7 c7 cd a7 10 80 	mov    $0xffffffff8010a7cd,%rdi
+ffffffff80102531:	e8 f9 e3 ff ff       	call   ffffffff8010092f <panic>
+  bp->data[bi/8] &= ~m;
+ffffffff80102536:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80102539:	8d 50 07             	lea    0x7(%rax),%edx
+ffffffff8010253c:	85 c0                	test   %eax,%eax
+ffffffff8010253e:	0f 48 c2             	cmovs  %edx,%eax
+ffffffff80102541:	c1 f8 03             	sar    $0x3,%eax
+ffffffff80102544:	89 c1                	mov    %eax,%ecx
+ffffffff80102546:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff8010254a:	48 63 c1             	movslq %ecx,%rax
+ffffffff8010254d:	0f b6 44 02 28       	movzbl 0x28(%rdx,%rax,1),%eax
+ffffffff80102552:	89 c2                	mov    %eax,%edx
+ffffffff80102554:	8b 45 f0             	mov    -0x10(%rbp),%eax
+ffffffff80102557:	f7 d0                	not    %eax
+ffffffff80102559:	21 d0                	and    %edx,%eax
+ffffffff8010255b:	89 c6                	mov    %eax,%esi
+ffffffff8010255d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80102561:	48 63 c1             	movslq %ecx,%rax
+ffffffff80102564:	40 88 74 02 28       	mov    %sil,0x28(%rdx,%rax,1)
+  log_write(bp);
+ffffffff80102569:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010256d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102570:	e8 aa 23 00 00       	call   ffffffff8010491f <log_write>
+  brelse(bp);
+ffffffff80102575:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102579:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010257c:	e8 db dd ff ff       	call   ffffffff8010035c <brelse>
+}
+ffffffff80102581:	90                   	nop
+ffffffff80102582:	c9                   	leave
+ffffffff80102583:	c3                   	ret
+
+ffffffff80102584 <iinit>:
+  struct inode inode[NINODE];
+} icache;
+
+void
+iinit(void)
+{
+ffffffff80102584:	55                   	push   %rbp
+ffffffff80102585:	48 89 e5             	mov    %rsp,%rbp
+  initlock(&icache.lock, "icache");
+ffffffff80102588:	48 c7 c6 e0 a7 10 80 	mov    $0xffffffff8010a7e0,%rsi
+ffffffff8010258f:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102596:	e8 ff 43 00 00       	call   ffffffff8010699a <initlock>
+}
+ffffffff8010259b:	90                   	nop
+ffffffff8010259c:	5d                   	pop    %rbp
+ffffffff8010259d:	c3                   	ret
+
+ffffffff8010259e <ialloc>:
+//PAGEBREAK!
+// Allocate a new inode with the given type on device dev.
+// A free inode has a type of zero.
+struct inode*
+ialloc(uint dev, short type)
+{
+ffffffff8010259e:	55                   	push   %rbp
+ffffffff8010259f:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801025a2:	48 83 ec 40          	sub    $0x40,%rsp
+ffffffff801025a6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+ffffffff801025a9:	89 f0                	mov    %esi,%eax
+ffffffff801025ab:	66 89 45 c8          	mov    %ax,-0x38(%rbp)
+  int inum;
+  struct buf *bp;
+  struct dinode *dip;
+  struct superblock sb;
+
+  readsb(dev, &sb);
+ffffffff801025af:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff801025b2:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+ffffffff801025b6:	48 89 d6             	mov    %rdx,%rsi
+ffffffff801025b9:	89 c7                	mov    %eax,%edi
+ffffffff801025bb:	e8 ea fc ff ff       	call   ffffffff801022aa <readsb>
+
+  for(inum = 1; inum < sb.ninodes; inum++){
+ffffffff801025c0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+ffffffff801025c7:	e9 9d 00 00 00       	jmp    ffffffff80102669 <ialloc+0xcb>
+    bp = bread(dev, IBLOCK(inum));
+ffffffff801025cc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801025cf:	48 98                	cltq
+ffffffff801025d1:	48 c1 e8 03          	shr    $0x3,%rax
+ffffffff801025d5:	8d 50 02             	lea    0x2(%rax),%edx
+ffffffff801025d8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff801025db:	89 d6                	mov    %edx,%esi
+ffffffff801025dd:	89 c7                	mov    %eax,%edi
+ffffffff801025df:	e8 f3 dc ff ff       	call   ffffffff801002d7 <bread>
+ffffffff801025e4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    dip = (struct dinode*)bp->data + inum%IPB;
+ffffffff801025e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801025ec:	48 8d 50 28          	lea    0x28(%rax),%rdx
+ffffffff801025f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801025f3:	48 98                	cltq
+ffffffff801025f5:	83 e0 07             	and    $0x7,%eax
+ffffffff801025f8:	48 c1 e0 06          	shl    $0x6,%rax
+ffffffff801025fc:	48 01 d0             	add    %rdx,%rax
+ffffffff801025ff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    if(dip->type == 0){  // a free inode
+ffffffff80102603:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102607:	0f b7 00             	movzwl (%rax),%eax
+ffffffff8010260a:	66 85 c0             	test   %ax,%ax
+ffffffff8010260d:	75 4a                	jne    ffffffff80102659 <ialloc+0xbb>
+      memset(dip, 0, sizeof(*dip));
+ffffffff8010260f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102613:	ba 40 00 00 00       	mov    $0x40,%edx
+ffffffff80102618:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010261d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102620:	e8 1a 47 00 00       	call   ffffffff80106d3f <memset>
+      dip->type = type;
+ffffffff80102625:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102629:	0f b7 55 c8          	movzwl -0x38(%rbp),%edx
+ffffffff8010262d:	66 89 10             	mov    %dx,(%rax)
+      log_write(bp);   // mark it allocated on the disk
+ffffffff80102630:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102634:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102637:	e8 e3 22 00 00       	call   ffffffff8010491f <log_write>
+      brelse(bp);
+ffffffff8010263c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102640:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102643:	e8 14 dd ff ff       	call   ffffffff8010035c <brelse>
+      return iget(dev, inum);
+ffffffff80102648:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010264b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff8010264e:	89 d6                	mov    %edx,%esi
+ffffffff80102650:	89 c7                	mov    %eax,%edi
+ffffffff80102652:	e8 0f 01 00 00       	call   ffffffff80102766 <iget>
+ffffffff80102657:	eb 2a                	jmp    ffffffff80102683 <ialloc+0xe5>
+    }
+    brelse(bp);
+ffffffff80102659:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010265d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102660:	e8 f7 dc ff ff       	call   ffffffff8010035c <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+ffffffff80102665:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80102669:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ffffffff8010266c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010266f:	39 c2                	cmp    %eax,%edx
+ffffffff80102671:	0f 82 55 ff ff ff    	jb     ffffffff801025cc <ialloc+0x2e>
+  }
+  panic("ialloc: no inodes");
+ffffffff80102677:	48 c7 c7 e7 a7 10 80 	mov    $0xffffffff8010a7e7,%rdi
+ffffffff8010267e:	e8 ac e2 ff ff       	call   ffffffff8010092f <panic>
+}
+ffffffff80102683:	c9                   	leave
+ffffffff80102684:	c3                   	ret
+
+ffffffff80102685 <iupdate>:
+
+// Copy a modified in-memory inode to disk.
+void
+iupdate(struct inode *ip)
+{
+ffffffff80102685:	55                   	push   %rbp
+ffffffff80102686:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102689:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff8010268d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct buf *bp;
+  struct dinode *dip;
+
+  bp = bread(ip->dev, IBLOCK(ip->inum));
+ffffffff80102691:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102695:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80102698:	c1 e8 03             	shr    $0x3,%eax
+ffffffff8010269b:	8d 50 02             	lea    0x2(%rax),%edx
+ffffffff8010269e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801026a2:	8b 00                	mov    (%rax),%eax
+ffffffff801026a4:	89 d6                	mov    %edx,%esi
+ffffffff801026a6:	89 c7                	mov    %eax,%edi
+ffffffff801026a8:	e8 2a dc ff ff       	call   ffffffff801002d7 <bread>
+ffffffff801026ad:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+ffffffff801026b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801026b5:	48 8d 50 28          	lea    0x28(%rax),%rdx
+ffffffff801026b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801026bd:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff801026c0:	89 c0                	mov    %eax,%eax
+ffffffff801026c2:	83 e0 07             	and    $0x7,%eax
+ffffffff801026c5:	48 c1 e0 06          	shl    $0x6,%rax
+ffffffff801026c9:	48 01 d0             	add    %rdx,%rax
+ffffffff801026cc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  dip->type = ip->type;
+ffffffff801026d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801026d4:	0f b7 50 10          	movzwl 0x10(%rax),%edx
+ffffffff801026d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801026dc:	66 89 10             	mov    %dx,(%rax)
+  dip->major = ip->major;
+ffffffff801026df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801026e3:	0f b7 50 12          	movzwl 0x12(%rax),%edx
+ffffffff801026e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801026eb:	66 89 50 02          	mov    %dx,0x2(%rax)
+  dip->minor = ip->minor;
+ffffffff801026ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801026f3:	0f b7 50 14          	movzwl 0x14(%rax),%edx
+ffffffff801026f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801026fb:	66 89 50 04          	mov    %dx,0x4(%rax)
+  dip->nlink = ip->nlink;
+ffffffff801026ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102703:	0f b7 50 16          	movzwl 0x16(%rax),%edx
+ffffffff80102707:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010270b:	66 89 50 06          	mov    %dx,0x6(%rax)
+  dip->size = ip->size;
+ffffffff8010270f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102713:	8b 50 20             	mov    0x20(%rax),%edx
+ffffffff80102716:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010271a:	89 50 10             	mov    %edx,0x10(%rax)
+  dip->mode = ip->mode;
+ffffffff8010271d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102721:	8b 50 1c             	mov    0x1c(%rax),%edx
+ffffffff80102724:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102728:	89 50 0c             	mov    %edx,0xc(%rax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+ffffffff8010272b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010272f:	48 8d 48 24          	lea    0x24(%rax),%rcx
+ffffffff80102733:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102737:	48 83 c0 14          	add    $0x14,%rax
+ffffffff8010273b:	ba 2c 00 00 00       	mov    $0x2c,%edx
+ffffffff80102740:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80102743:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102746:	e8 e3 46 00 00       	call   ffffffff80106e2e <memmove>
+  log_write(bp);
+ffffffff8010274b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010274f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102752:	e8 c8 21 00 00       	call   ffffffff8010491f <log_write>
+  brelse(bp);
+ffffffff80102757:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010275b:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010275e:	e8 f9 db ff ff       	call   ffffffff8010035c <brelse>
+}
+ffffffff80102763:	90                   	nop
+ffffffff80102764:	c9                   	leave
+ffffffff80102765:	c3                   	ret
+
+ffffffff80102766 <iget>:
+// Find the inode with number inum on device dev
+// and return the in-memory copy. Does not lock
+// the inode and does not read it from disk.
+static struct inode*
+iget(uint dev, uint inum)
+{
+ffffffff80102766:	55                   	push   %rbp
+ffffffff80102767:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010276a:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff8010276e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ffffffff80102771:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  struct inode *ip, *empty;
+
+  acquire(&icache.lock);
+ffffffff80102774:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff8010277b:	e8 4f 42 00 00       	call   ffffffff801069cf <acquire>
+
+  // Is the inode already cached?
+  empty = 0;
+ffffffff80102780:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+ffffffff80102787:	00 
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+ffffffff80102788:	48 c7 45 f8 08 16 11 	movq   $0xffffffff80111608,-0x8(%rbp)
+ffffffff8010278f:	80 
+ffffffff80102790:	eb 64                	jmp    ffffffff801027f6 <iget+0x90>
+    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+ffffffff80102792:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102796:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff80102799:	85 c0                	test   %eax,%eax
+ffffffff8010279b:	7e 3a                	jle    ffffffff801027d7 <iget+0x71>
+ffffffff8010279d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801027a1:	8b 00                	mov    (%rax),%eax
+ffffffff801027a3:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ffffffff801027a6:	75 2f                	jne    ffffffff801027d7 <iget+0x71>
+ffffffff801027a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801027ac:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff801027af:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+ffffffff801027b2:	75 23                	jne    ffffffff801027d7 <iget+0x71>
+      ip->ref++;
+ffffffff801027b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801027b8:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff801027bb:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff801027be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801027c2:	89 50 08             	mov    %edx,0x8(%rax)
+      release(&icache.lock);
+ffffffff801027c5:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff801027cc:	e8 d5 42 00 00       	call   ffffffff80106aa6 <release>
+      return ip;
+ffffffff801027d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801027d5:	eb 7d                	jmp    ffffffff80102854 <iget+0xee>
+    }
+    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
+ffffffff801027d7:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff801027dc:	75 13                	jne    ffffffff801027f1 <iget+0x8b>
+ffffffff801027de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801027e2:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff801027e5:	85 c0                	test   %eax,%eax
+ffffffff801027e7:	75 08                	jne    ffffffff801027f1 <iget+0x8b>
+      empty = ip;
+ffffffff801027e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801027ed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+ffffffff801027f1:	48 83 45 f8 50       	addq   $0x50,-0x8(%rbp)
+ffffffff801027f6:	48 81 7d f8 a8 25 11 	cmpq   $0xffffffff801125a8,-0x8(%rbp)
+ffffffff801027fd:	80 
+ffffffff801027fe:	72 92                	jb     ffffffff80102792 <iget+0x2c>
+  }
+
+  // Recycle an inode cache entry.
+  if(empty == 0)
+ffffffff80102800:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80102805:	75 0c                	jne    ffffffff80102813 <iget+0xad>
+    panic("iget: no inodes");
+ffffffff80102807:	48 c7 c7 f9 a7 10 80 	mov    $0xffffffff8010a7f9,%rdi
+ffffffff8010280e:	e8 1c e1 ff ff       	call   ffffffff8010092f <panic>
+
+  ip = empty;
+ffffffff80102813:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102817:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  ip->dev = dev;
+ffffffff8010281b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010281f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff80102822:	89 10                	mov    %edx,(%rax)
+  ip->inum = inum;
+ffffffff80102824:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102828:	8b 55 e8             	mov    -0x18(%rbp),%edx
+ffffffff8010282b:	89 50 04             	mov    %edx,0x4(%rax)
+  ip->ref = 1;
+ffffffff8010282e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102832:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+  ip->flags = 0;
+ffffffff80102839:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010283d:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  release(&icache.lock);
+ffffffff80102844:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff8010284b:	e8 56 42 00 00       	call   ffffffff80106aa6 <release>
+
+  return ip;
+ffffffff80102850:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80102854:	c9                   	leave
+ffffffff80102855:	c3                   	ret
+
+ffffffff80102856 <idup>:
+
+// Increment reference count for ip.
+// Returns ip to enable ip = idup(ip1) idiom.
+struct inode*
+idup(struct inode *ip)
+{
+ffffffff80102856:	55                   	push   %rbp
+ffffffff80102857:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010285a:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff8010285e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  acquire(&icache.lock);
+ffffffff80102862:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102869:	e8 61 41 00 00       	call   ffffffff801069cf <acquire>
+  ip->ref++;
+ffffffff8010286e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102872:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff80102875:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff80102878:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010287c:	89 50 08             	mov    %edx,0x8(%rax)
+  release(&icache.lock);
+ffffffff8010287f:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102886:	e8 1b 42 00 00       	call   ffffffff80106aa6 <release>
+  return ip;
+ffffffff8010288b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff8010288f:	c9                   	leave
+ffffffff80102890:	c3                   	ret
+
+ffffffff80102891 <ilock>:
+
+// Lock the given inode.
+// Reads the inode from disk if necessary.
+void
+ilock(struct inode *ip)
+{
+ffffffff80102891:	55                   	push   %rbp
+ffffffff80102892:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102895:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80102899:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct buf *bp;
+  struct dinode *dip;
+
+  if(ip == 0 || ip->ref < 1)
+ffffffff8010289d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+ffffffff801028a2:	74 0b                	je     ffffffff801028af <ilock+0x1e>
+ffffffff801028a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801028a8:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff801028ab:	85 c0                	test   %eax,%eax
+ffffffff801028ad:	7f 0c                	jg     ffffffff801028bb <ilock+0x2a>
+    panic("ilock");
+ffffffff801028af:	48 c7 c7 09 a8 10 80 	mov    $0xffffffff8010a809,%rdi
+ffffffff801028b6:	e8 74 e0 ff ff       	call   ffffffff8010092f <panic>
+
+  acquire(&icache.lock);
+ffffffff801028bb:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff801028c2:	e8 08 41 00 00       	call   ffffffff801069cf <acquire>
+  while(ip->flags & I_BUSY)
+ffffffff801028c7:	eb 13                	jmp    ffffffff801028dc <ilock+0x4b>
+    sleep(ip, &icache.lock);
+ffffffff801028c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801028cd:	48 c7 c6 a0 15 11 80 	mov    $0xffffffff801115a0,%rsi
+ffffffff801028d4:	48 89 c7             	mov    %rax,%rdi
+ffffffff801028d7:	e8 74 3d 00 00       	call   ffffffff80106650 <sleep>
+  while(ip->flags & I_BUSY)
+ffffffff801028dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801028e0:	8b 40 0c             	mov    0xc(%rax),%eax
+ffffffff801028e3:	83 e0 01             	and    $0x1,%eax
+ffffffff801028e6:	85 c0                	test   %eax,%eax
+ffffffff801028e8:	75 df                	jne    ffffffff801028c9 <ilock+0x38>
+  ip->flags |= I_BUSY;
+ffffffff801028ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801028ee:	8b 40 0c             	mov    0xc(%rax),%eax
+ffffffff801028f1:	83 c8 01             	or     $0x1,%eax
+ffffffff801028f4:	89 c2                	mov    %eax,%edx
+ffffffff801028f6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801028fa:	89 50 0c             	mov    %edx,0xc(%rax)
+  release(&icache.lock);
+ffffffff801028fd:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102904:	e8 9d 41 00 00       	call   ffffffff80106aa6 <release>
+
+  if(!(ip->flags & I_VALID)){
+ffffffff80102909:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010290d:	8b 40 0c             	mov    0xc(%rax),%eax
+ffffffff80102910:	83 e0 02             	and    $0x2,%eax
+ffffffff80102913:	85 c0                	test   %eax,%eax
+ffffffff80102915:	0f 85 12 01 00 00    	jne    ffffffff80102a2d <ilock+0x19c>
+    bp = bread(ip->dev, IBLOCK(ip->inum));
+ffffffff8010291b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010291f:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80102922:	c1 e8 03             	shr    $0x3,%eax
+ffffffff80102925:	8d 50 02             	lea    0x2(%rax),%edx
+ffffffff80102928:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010292c:	8b 00                	mov    (%rax),%eax
+ffffffff8010292e:	89 d6                	mov    %edx,%esi
+ffffffff80102930:	89 c7                	mov    %eax,%edi
+ffffffff80102932:	e8 a0 d9 ff ff       	call   ffffffff801002d7 <bread>
+ffffffff80102937:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+ffffffff8010293b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010293f:	48 8d 50 28          	lea    0x28(%rax),%rdx
+ffffffff80102943:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102947:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff8010294a:	89 c0                	mov    %eax,%eax
+ffffffff8010294c:	83 e0 07             	and    $0x7,%eax
+ffffffff8010294f:	48 c1 e0 06          	shl    $0x6,%rax
+ffffffff80102953:	48 01 d0             	add    %rdx,%rax
+ffffffff80102956:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    ip->type = dip->type;
+ffffffff8010295a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010295e:	0f b7 10             	movzwl (%rax),%edx
+ffffffff80102961:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102965:	66 89 50 10          	mov    %dx,0x10(%rax)
+    ip->major = dip->major;
+ffffffff80102969:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010296d:	0f b7 50 02          	movzwl 0x2(%rax),%edx
+ffffffff80102971:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102975:	66 89 50 12          	mov    %dx,0x12(%rax)
+    ip->minor = dip->minor;
+ffffffff80102979:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010297d:	0f b7 50 04          	movzwl 0x4(%rax),%edx
+ffffffff80102981:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102985:	66 89 50 14          	mov    %dx,0x14(%rax)
+    ip->nlink = dip->nlink;
+ffffffff80102989:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010298d:	0f b7 50 06          	movzwl 0x6(%rax),%edx
+ffffffff80102991:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102995:	66 89 50 16          	mov    %dx,0x16(%rax)
+    ip->size = dip->size;
+ffffffff80102999:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010299d:	8b 50 10             	mov    0x10(%rax),%edx
+ffffffff801029a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801029a4:	89 50 20             	mov    %edx,0x20(%rax)
+    ip->ownerid = dip->ownerid;
+ffffffff801029a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801029ab:	0f b7 50 08          	movzwl 0x8(%rax),%edx
+ffffffff801029af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801029b3:	66 89 50 18          	mov    %dx,0x18(%rax)
+    ip->groupid = dip->groupid;
+ffffffff801029b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801029bb:	0f b7 50 0a          	movzwl 0xa(%rax),%edx
+ffffffff801029bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801029c3:	66 89 50 1a          	mov    %dx,0x1a(%rax)
+    ip->mode = dip->mode;
+ffffffff801029c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801029cb:	8b 50 0c             	mov    0xc(%rax),%edx
+ffffffff801029ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801029d2:	89 50 1c             	mov    %edx,0x1c(%rax)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+ffffffff801029d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801029d9:	48 8d 48 14          	lea    0x14(%rax),%rcx
+ffffffff801029dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801029e1:	48 83 c0 24          	add    $0x24,%rax
+ffffffff801029e5:	ba 2c 00 00 00       	mov    $0x2c,%edx
+ffffffff801029ea:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801029ed:	48 89 c7             	mov    %rax,%rdi
+ffffffff801029f0:	e8 39 44 00 00       	call   ffffffff80106e2e <memmove>
+    brelse(bp);
+ffffffff801029f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801029f9:	48 89 c7             	mov    %rax,%rdi
+ffffffff801029fc:	e8 5b d9 ff ff       	call   ffffffff8010035c <brelse>
+    ip->flags |= I_VALID;
+ffffffff80102a01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102a05:	8b 40 0c             	mov    0xc(%rax),%eax
+ffffffff80102a08:	83 c8 02             	or     $0x2,%eax
+ffffffff80102a0b:	89 c2                	mov    %eax,%edx
+ffffffff80102a0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102a11:	89 50 0c             	mov    %edx,0xc(%rax)
+    if(ip->type == 0)
+ffffffff80102a14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102a18:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff80102a1c:	66 85 c0             	test   %ax,%ax
+ffffffff80102a1f:	75 0c                	jne    ffffffff80102a2d <ilock+0x19c>
+      panic("ilock: no type");
+ffffffff80102a21:	48 c7 c7 0f a8 10 80 	mov    $0xffffffff8010a80f,%rdi
+ffffffff80102a28:	e8 02 df ff ff       	call   ffffffff8010092f <panic>
+  }
+}
+ffffffff80102a2d:	90                   	nop
+ffffffff80102a2e:	c9                   	leave
+ffffffff80102a2f:	c3                   	ret
+
+ffffffff80102a30 <iunlock>:
+
+// Unlock the given inode.
+void
+iunlock(struct inode *ip)
+{
+ffffffff80102a30:	55                   	push   %rbp
+ffffffff80102a31:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102a34:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80102a38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if(ip == 0 || !(ip->flags & I_BUSY) || ip->ref < 1)
+ffffffff80102a3c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80102a41:	74 19                	je     ffffffff80102a5c <iunlock+0x2c>
+ffffffff80102a43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102a47:	8b 40 0c             	mov    0xc(%rax),%eax
+ffffffff80102a4a:	83 e0 01             	and    $0x1,%eax
+ffffffff80102a4d:	85 c0                	test   %eax,%eax
+ffffffff80102a4f:	74 0b                	je     ffffffff80102a5c <iunlock+0x2c>
+ffffffff80102a51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102a55:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff80102a58:	85 c0                	test   %eax,%eax
+ffffffff80102a5a:	7f 0c                	jg     ffffffff80102a68 <iunlock+0x38>
+    panic("iunlock");
+ffffffff80102a5c:	48 c7 c7 1e a8 10 80 	mov    $0xffffffff8010a81e,%rdi
+ffffffff80102a63:	e8 c7 de ff ff       	call   ffffffff8010092f <panic>
+
+  acquire(&icache.lock);
+ffffffff80102a68:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102a6f:	e8 5b 3f 00 00       	call   ffffffff801069cf <acquire>
+  ip->flags &= ~I_BUSY;
+ffffffff80102a74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102a78:	8b 40 0c             	mov    0xc(%rax),%eax
+ffffffff80102a7b:	83 e0 fe             	and    $0xfffffffe,%eax
+ffffffff80102a7e:	89 c2                	mov    %eax,%edx
+ffffffff80102a80:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102a84:	89 50 0c             	mov    %edx,0xc(%rax)
+  wakeup(ip);
+ffffffff80102a87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102a8b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102a8e:	e8 d1 3c 00 00       	call   ffffffff80106764 <wakeup>
+  release(&icache.lock);
+ffffffff80102a93:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102a9a:	e8 07 40 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff80102a9f:	90                   	nop
+ffffffff80102aa0:	c9                   	leave
+ffffffff80102aa1:	c3                   	ret
+
+ffffffff80102aa2 <iput>:
+// to it, free the inode (and its content) on disk.
+// All calls to iput() must be inside a transaction in
+// case it has to free the inode.
+void
+iput(struct inode *ip)
+{
+ffffffff80102aa2:	55                   	push   %rbp
+ffffffff80102aa3:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102aa6:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80102aaa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  acquire(&icache.lock);
+ffffffff80102aae:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102ab5:	e8 15 3f 00 00       	call   ffffffff801069cf <acquire>
+  if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
+ffffffff80102aba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102abe:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff80102ac1:	83 f8 01             	cmp    $0x1,%eax
+ffffffff80102ac4:	0f 85 9d 00 00 00    	jne    ffffffff80102b67 <iput+0xc5>
+ffffffff80102aca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102ace:	8b 40 0c             	mov    0xc(%rax),%eax
+ffffffff80102ad1:	83 e0 02             	and    $0x2,%eax
+ffffffff80102ad4:	85 c0                	test   %eax,%eax
+ffffffff80102ad6:	0f 84 8b 00 00 00    	je     ffffffff80102b67 <iput+0xc5>
+ffffffff80102adc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102ae0:	0f b7 40 16          	movzwl 0x16(%rax),%eax
+ffffffff80102ae4:	66 85 c0             	test   %ax,%ax
+ffffffff80102ae7:	75 7e                	jne    ffffffff80102b67 <iput+0xc5>
+    // inode has no links and no other references: truncate and free.
+    if(ip->flags & I_BUSY)
+ffffffff80102ae9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102aed:	8b 40 0c             	mov    0xc(%rax),%eax
+ffffffff80102af0:	83 e0 01             	and    $0x1,%eax
+ffffffff80102af3:	85 c0                	test   %eax,%eax
+ffffffff80102af5:	74 0c                	je     ffffffff80102b03 <iput+0x61>
+      panic("iput busy");
+ffffffff80102af7:	48 c7 c7 26 a8 10 80 	mov    $0xffffffff8010a826,%rdi
+ffffffff80102afe:	e8 2c de ff ff       	call   ffffffff8010092f <panic>
+    ip->flags |= I_BUSY;
+ffffffff80102b03:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b07:	8b 40 0c             	mov    0xc(%rax),%eax
+ffffffff80102b0a:	83 c8 01             	or     $0x1,%eax
+ffffffff80102b0d:	89 c2                	mov    %eax,%edx
+ffffffff80102b0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b13:	89 50 0c             	mov    %edx,0xc(%rax)
+    release(&icache.lock);
+ffffffff80102b16:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102b1d:	e8 84 3f 00 00       	call   ffffffff80106aa6 <release>
+    itrunc(ip);
+ffffffff80102b22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b26:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102b29:	e8 a0 01 00 00       	call   ffffffff80102cce <itrunc>
+    ip->type = 0;
+ffffffff80102b2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b32:	66 c7 40 10 00 00    	movw   $0x0,0x10(%rax)
+    iupdate(ip);
+ffffffff80102b38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b3c:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102b3f:	e8 41 fb ff ff       	call   ffffffff80102685 <iupdate>
+    acquire(&icache.lock);
+ffffffff80102b44:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102b4b:	e8 7f 3e 00 00       	call   ffffffff801069cf <acquire>
+    ip->flags = 0;
+ffffffff80102b50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b54:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+    wakeup(ip);
+ffffffff80102b5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b5f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102b62:	e8 fd 3b 00 00       	call   ffffffff80106764 <wakeup>
+  }
+  ip->ref--;
+ffffffff80102b67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b6b:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff80102b6e:	8d 50 ff             	lea    -0x1(%rax),%edx
+ffffffff80102b71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b75:	89 50 08             	mov    %edx,0x8(%rax)
+  release(&icache.lock);
+ffffffff80102b78:	48 c7 c7 a0 15 11 80 	mov    $0xffffffff801115a0,%rdi
+ffffffff80102b7f:	e8 22 3f 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff80102b84:	90                   	nop
+ffffffff80102b85:	c9                   	leave
+ffffffff80102b86:	c3                   	ret
+
+ffffffff80102b87 <iunlockput>:
+
+// Common idiom: unlock, then put.
+void
+iunlockput(struct inode *ip)
+{
+ffffffff80102b87:	55                   	push   %rbp
+ffffffff80102b88:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102b8b:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80102b8f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  iunlock(ip);
+ffffffff80102b93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102b97:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102b9a:	e8 91 fe ff ff       	call   ffffffff80102a30 <iunlock>
+  iput(ip);
+ffffffff80102b9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102ba3:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102ba6:	e8 f7 fe ff ff       	call   ffffffff80102aa2 <iput>
+}
+ffffffff80102bab:	90                   	nop
+ffffffff80102bac:	c9                   	leave
+ffffffff80102bad:	c3                   	ret
+
+ffffffff80102bae <bmap>:
+
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one.
+static uint
+bmap(struct inode *ip, uint bn)
+{
+ffffffff80102bae:	55                   	push   %rbp
+ffffffff80102baf:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102bb2:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80102bb6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+ffffffff80102bba:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  uint addr, *a;
+  struct buf *bp;
+
+  if(bn < NDIRECT){
+ffffffff80102bbd:	83 7d d4 09          	cmpl   $0x9,-0x2c(%rbp)
+ffffffff80102bc1:	77 42                	ja     ffffffff80102c05 <bmap+0x57>
+    if((addr = ip->addrs[bn]) == 0)
+ffffffff80102bc3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102bc7:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+ffffffff80102bca:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff80102bce:	8b 44 90 04          	mov    0x4(%rax,%rdx,4),%eax
+ffffffff80102bd2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80102bd5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80102bd9:	75 22                	jne    ffffffff80102bfd <bmap+0x4f>
+      ip->addrs[bn] = addr = balloc(ip->dev);
+ffffffff80102bdb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102bdf:	8b 00                	mov    (%rax),%eax
+ffffffff80102be1:	89 c7                	mov    %eax,%edi
+ffffffff80102be3:	e8 65 f7 ff ff       	call   ffffffff8010234d <balloc>
+ffffffff80102be8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80102beb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102bef:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+ffffffff80102bf2:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+ffffffff80102bf6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80102bf9:	89 54 88 04          	mov    %edx,0x4(%rax,%rcx,4)
+    return addr;
+ffffffff80102bfd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80102c00:	e9 c7 00 00 00       	jmp    ffffffff80102ccc <bmap+0x11e>
+  }
+  bn -= NDIRECT;
+ffffffff80102c05:	83 6d d4 0a          	subl   $0xa,-0x2c(%rbp)
+
+  if(bn < NINDIRECT){
+ffffffff80102c09:	83 7d d4 7f          	cmpl   $0x7f,-0x2c(%rbp)
+ffffffff80102c0d:	0f 87 ad 00 00 00    	ja     ffffffff80102cc0 <bmap+0x112>
+    // Load indirect block, allocating if necessary.
+    if((addr = ip->addrs[NDIRECT]) == 0)
+ffffffff80102c13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102c17:	8b 40 4c             	mov    0x4c(%rax),%eax
+ffffffff80102c1a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80102c1d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80102c21:	75 1a                	jne    ffffffff80102c3d <bmap+0x8f>
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+ffffffff80102c23:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102c27:	8b 00                	mov    (%rax),%eax
+ffffffff80102c29:	89 c7                	mov    %eax,%edi
+ffffffff80102c2b:	e8 1d f7 ff ff       	call   ffffffff8010234d <balloc>
+ffffffff80102c30:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80102c33:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102c37:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80102c3a:	89 50 4c             	mov    %edx,0x4c(%rax)
+    bp = bread(ip->dev, addr);
+ffffffff80102c3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102c41:	8b 00                	mov    (%rax),%eax
+ffffffff80102c43:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80102c46:	89 d6                	mov    %edx,%esi
+ffffffff80102c48:	89 c7                	mov    %eax,%edi
+ffffffff80102c4a:	e8 88 d6 ff ff       	call   ffffffff801002d7 <bread>
+ffffffff80102c4f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    a = (uint*)bp->data;
+ffffffff80102c53:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102c57:	48 83 c0 28          	add    $0x28,%rax
+ffffffff80102c5b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    if((addr = a[bn]) == 0){
+ffffffff80102c5f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+ffffffff80102c62:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+ffffffff80102c69:	00 
+ffffffff80102c6a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102c6e:	48 01 d0             	add    %rdx,%rax
+ffffffff80102c71:	8b 00                	mov    (%rax),%eax
+ffffffff80102c73:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80102c76:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80102c7a:	75 33                	jne    ffffffff80102caf <bmap+0x101>
+      a[bn] = addr = balloc(ip->dev);
+ffffffff80102c7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102c80:	8b 00                	mov    (%rax),%eax
+ffffffff80102c82:	89 c7                	mov    %eax,%edi
+ffffffff80102c84:	e8 c4 f6 ff ff       	call   ffffffff8010234d <balloc>
+ffffffff80102c89:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80102c8c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+ffffffff80102c8f:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+ffffffff80102c96:	00 
+ffffffff80102c97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102c9b:	48 01 c2             	add    %rax,%rdx
+ffffffff80102c9e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80102ca1:	89 02                	mov    %eax,(%rdx)
+      log_write(bp);
+ffffffff80102ca3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102ca7:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102caa:	e8 70 1c 00 00       	call   ffffffff8010491f <log_write>
+    }
+    brelse(bp);
+ffffffff80102caf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102cb3:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102cb6:	e8 a1 d6 ff ff       	call   ffffffff8010035c <brelse>
+    return addr;
+ffffffff80102cbb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80102cbe:	eb 0c                	jmp    ffffffff80102ccc <bmap+0x11e>
+  }
+
+  panic("bmap: out of range");
+ffffffff80102cc0:	48 c7 c7 30 a8 10 80 	mov    $0xffffffff8010a830,%rdi
+ffffffff80102cc7:	e8 63 dc ff ff       	call   ffffffff8010092f <panic>
+}
+ffffffff80102ccc:	c9                   	leave
+ffffffff80102ccd:	c3                   	ret
+
+ffffffff80102cce <itrunc>:
+// to it (no directory entries referring to it)
+// and has no in-memory reference to it (is
+// not an open file or current directory).
+static void
+itrunc(struct inode *ip)
+{
+ffffffff80102cce:	55                   	push   %rbp
+ffffffff80102ccf:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102cd2:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80102cd6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  int i, j;
+  struct buf *bp;
+  uint *a;
+
+  for(i = 0; i < NDIRECT; i++){
+ffffffff80102cda:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80102ce1:	eb 51                	jmp    ffffffff80102d34 <itrunc+0x66>
+    if(ip->addrs[i]){
+ffffffff80102ce3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102ce7:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80102cea:	48 63 d2             	movslq %edx,%rdx
+ffffffff80102ced:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff80102cf1:	8b 44 90 04          	mov    0x4(%rax,%rdx,4),%eax
+ffffffff80102cf5:	85 c0                	test   %eax,%eax
+ffffffff80102cf7:	74 37                	je     ffffffff80102d30 <itrunc+0x62>
+      bfree(ip->dev, ip->addrs[i]);
+ffffffff80102cf9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102cfd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80102d00:	48 63 d2             	movslq %edx,%rdx
+ffffffff80102d03:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff80102d07:	8b 44 90 04          	mov    0x4(%rax,%rdx,4),%eax
+ffffffff80102d0b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+ffffffff80102d0f:	8b 12                	mov    (%rdx),%edx
+ffffffff80102d11:	89 c6                	mov    %eax,%esi
+ffffffff80102d13:	89 d7                	mov    %edx,%edi
+ffffffff80102d15:	e8 8c f7 ff ff       	call   ffffffff801024a6 <bfree>
+      ip->addrs[i] = 0;
+ffffffff80102d1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102d1e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80102d21:	48 63 d2             	movslq %edx,%rdx
+ffffffff80102d24:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff80102d28:	c7 44 90 04 00 00 00 	movl   $0x0,0x4(%rax,%rdx,4)
+ffffffff80102d2f:	00 
+  for(i = 0; i < NDIRECT; i++){
+ffffffff80102d30:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80102d34:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+ffffffff80102d38:	7e a9                	jle    ffffffff80102ce3 <itrunc+0x15>
+    }
+  }
+  
+  if(ip->addrs[NDIRECT]){
+ffffffff80102d3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102d3e:	8b 40 4c             	mov    0x4c(%rax),%eax
+ffffffff80102d41:	85 c0                	test   %eax,%eax
+ffffffff80102d43:	0f 84 a7 00 00 00    	je     ffffffff80102df0 <itrunc+0x122>
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+ffffffff80102d49:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102d4d:	8b 50 4c             	mov    0x4c(%rax),%edx
+ffffffff80102d50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102d54:	8b 00                	mov    (%rax),%eax
+ffffffff80102d56:	89 d6                	mov    %edx,%esi
+ffffffff80102d58:	89 c7                	mov    %eax,%edi
+ffffffff80102d5a:	e8 78 d5 ff ff       	call   ffffffff801002d7 <bread>
+ffffffff80102d5f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    a = (uint*)bp->data;
+ffffffff80102d63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102d67:	48 83 c0 28          	add    $0x28,%rax
+ffffffff80102d6b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for(j = 0; j < NINDIRECT; j++){
+ffffffff80102d6f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+ffffffff80102d76:	eb 43                	jmp    ffffffff80102dbb <itrunc+0xed>
+      if(a[j])
+ffffffff80102d78:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80102d7b:	48 98                	cltq
+ffffffff80102d7d:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+ffffffff80102d84:	00 
+ffffffff80102d85:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102d89:	48 01 d0             	add    %rdx,%rax
+ffffffff80102d8c:	8b 00                	mov    (%rax),%eax
+ffffffff80102d8e:	85 c0                	test   %eax,%eax
+ffffffff80102d90:	74 25                	je     ffffffff80102db7 <itrunc+0xe9>
+        bfree(ip->dev, a[j]);
+ffffffff80102d92:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80102d95:	48 98                	cltq
+ffffffff80102d97:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+ffffffff80102d9e:	00 
+ffffffff80102d9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80102da3:	48 01 d0             	add    %rdx,%rax
+ffffffff80102da6:	8b 00                	mov    (%rax),%eax
+ffffffff80102da8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+ffffffff80102dac:	8b 12                	mov    (%rdx),%edx
+ffffffff80102dae:	89 c6                	mov    %eax,%esi
+ffffffff80102db0:	89 d7                	mov    %edx,%edi
+ffffffff80102db2:	e8 ef f6 ff ff       	call   ffffffff801024a6 <bfree>
+    for(j = 0; j < NINDIRECT; j++){
+ffffffff80102db7:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+ffffffff80102dbb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80102dbe:	83 f8 7f             	cmp    $0x7f,%eax
+ffffffff80102dc1:	76 b5                	jbe    ffffffff80102d78 <itrunc+0xaa>
+    }
+    brelse(bp);
+ffffffff80102dc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102dc7:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102dca:	e8 8d d5 ff ff       	call   ffffffff8010035c <brelse>
+    bfree(ip->dev, ip->addrs[NDIRECT]);
+ffffffff80102dcf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102dd3:	8b 40 4c             	mov    0x4c(%rax),%eax
+ffffffff80102dd6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+ffffffff80102dda:	8b 12                	mov    (%rdx),%edx
+ffffffff80102ddc:	89 c6                	mov    %eax,%esi
+ffffffff80102dde:	89 d7                	mov    %edx,%edi
+ffffffff80102de0:	e8 c1 f6 ff ff       	call   ffffffff801024a6 <bfree>
+    ip->addrs[NDIRECT] = 0;
+ffffffff80102de5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102de9:	c7 40 4c 00 00 00 00 	movl   $0x0,0x4c(%rax)
+  }
+
+  ip->size = 0;
+ffffffff80102df0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102df4:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%rax)
+  iupdate(ip);
+ffffffff80102dfb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102dff:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102e02:	e8 7e f8 ff ff       	call   ffffffff80102685 <iupdate>
+}
+ffffffff80102e07:	90                   	nop
+ffffffff80102e08:	c9                   	leave
+ffffffff80102e09:	c3                   	ret
+
+ffffffff80102e0a <stati>:
+
+// Copy stat information from inode.
+void
+stati(struct inode *ip, struct stat *st)
+{
+ffffffff80102e0a:	55                   	push   %rbp
+ffffffff80102e0b:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102e0e:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80102e12:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80102e16:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  st->dev = ip->dev;
+ffffffff80102e1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102e1e:	8b 00                	mov    (%rax),%eax
+ffffffff80102e20:	89 c2                	mov    %eax,%edx
+ffffffff80102e22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102e26:	89 50 04             	mov    %edx,0x4(%rax)
+  st->ino = ip->inum;
+ffffffff80102e29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102e2d:	8b 50 04             	mov    0x4(%rax),%edx
+ffffffff80102e30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102e34:	89 50 08             	mov    %edx,0x8(%rax)
+  st->type = ip->type;
+ffffffff80102e37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102e3b:	0f b7 50 10          	movzwl 0x10(%rax),%edx
+ffffffff80102e3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102e43:	66 89 10             	mov    %dx,(%rax)
+  st->nlink = ip->nlink;
+ffffffff80102e46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102e4a:	0f b7 50 16          	movzwl 0x16(%rax),%edx
+ffffffff80102e4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102e52:	66 89 50 0c          	mov    %dx,0xc(%rax)
+  st->size = ip->size;
+ffffffff80102e56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102e5a:	8b 50 20             	mov    0x20(%rax),%edx
+ffffffff80102e5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102e61:	89 50 18             	mov    %edx,0x18(%rax)
+  st->ownerid = ip->ownerid;
+ffffffff80102e64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102e68:	0f b7 50 18          	movzwl 0x18(%rax),%edx
+ffffffff80102e6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102e70:	66 89 50 0e          	mov    %dx,0xe(%rax)
+  st->groupid = ip->groupid;
+ffffffff80102e74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102e78:	0f b7 50 1a          	movzwl 0x1a(%rax),%edx
+ffffffff80102e7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102e80:	66 89 50 10          	mov    %dx,0x10(%rax)
+  st->mode = ip->mode;
+ffffffff80102e84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80102e88:	8b 50 1c             	mov    0x1c(%rax),%edx
+ffffffff80102e8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102e8f:	89 50 14             	mov    %edx,0x14(%rax)
+}
+ffffffff80102e92:	90                   	nop
+ffffffff80102e93:	c9                   	leave
+ffffffff80102e94:	c3                   	ret
+
+ffffffff80102e95 <readi>:
+
+//PAGEBREAK!
+// Read data from inode.
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+{
+ffffffff80102e95:	55                   	push   %rbp
+ffffffff80102e96:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80102e99:	48 83 ec 40          	sub    $0x40,%rsp
+ffffffff80102e9d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+ffffffff80102ea1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ffffffff80102ea5:	89 55 cc             	mov    %edx,-0x34(%rbp)
+ffffffff80102ea8:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+ffffffff80102eab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102eaf:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff80102eb3:	66 83 f8 03          	cmp    $0x3,%ax
+ffffffff80102eb7:	75 73                	jne    ffffffff80102f2c <readi+0x97>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+ffffffff80102eb9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102ebd:	0f b7 40 12          	movzwl 0x12(%rax),%eax
+ffffffff80102ec1:	66 85 c0             	test   %ax,%ax
+ffffffff80102ec4:	78 2b                	js     ffffffff80102ef1 <readi+0x5c>
+ffffffff80102ec6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102eca:	0f b7 40 12          	movzwl 0x12(%rax),%eax
+ffffffff80102ece:	66 83 f8 09          	cmp    $0x9,%ax
+ffffffff80102ed2:	7f 1d                	jg     ffffffff80102ef1 <readi+0x5c>
+ffffffff80102ed4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102ed8:	0f b7 40 12          	movzwl 0x12(%rax),%eax
+ffffffff80102edc:	98                   	cwtl
+ffffffff80102edd:	48 98                	cltq
+ffffffff80102edf:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80102ee3:	48 05 e0 04 11 80    	add    $0xffffffff801104e0,%rax
+ffffffff80102ee9:	48 8b 00             	mov    (%rax),%rax
+ffffffff80102eec:	48 85 c0             	test   %rax,%rax
+ffffffff80102eef:	75 0a                	jne    ffffffff80102efb <readi+0x66>
+      return -1;
+ffffffff80102ef1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80102ef6:	e9 1c 01 00 00       	jmp    ffffffff80103017 <readi+0x182>
+    return devsw[ip->major].read(ip, dst, n);
+ffffffff80102efb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102eff:	0f b7 40 12          	movzwl 0x12(%rax),%eax
+ffffffff80102f03:	98                   	cwtl
+ffffffff80102f04:	48 98                	cltq
+ffffffff80102f06:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80102f0a:	48 05 e0 04 11 80    	add    $0xffffffff801104e0,%rax
+ffffffff80102f10:	4c 8b 00             	mov    (%rax),%r8
+ffffffff80102f13:	8b 55 c8             	mov    -0x38(%rbp),%edx
+ffffffff80102f16:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+ffffffff80102f1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102f1e:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80102f21:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102f24:	41 ff d0             	call   *%r8
+ffffffff80102f27:	e9 eb 00 00 00       	jmp    ffffffff80103017 <readi+0x182>
+  }
+
+  if(off > ip->size || off + n < off)
+ffffffff80102f2c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102f30:	8b 40 20             	mov    0x20(%rax),%eax
+ffffffff80102f33:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+ffffffff80102f36:	72 0d                	jb     ffffffff80102f45 <readi+0xb0>
+ffffffff80102f38:	8b 55 cc             	mov    -0x34(%rbp),%edx
+ffffffff80102f3b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ffffffff80102f3e:	01 d0                	add    %edx,%eax
+ffffffff80102f40:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+ffffffff80102f43:	73 0a                	jae    ffffffff80102f4f <readi+0xba>
+    return -1;
+ffffffff80102f45:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80102f4a:	e9 c8 00 00 00       	jmp    ffffffff80103017 <readi+0x182>
+  if(off + n > ip->size)
+ffffffff80102f4f:	8b 55 cc             	mov    -0x34(%rbp),%edx
+ffffffff80102f52:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ffffffff80102f55:	01 c2                	add    %eax,%edx
+ffffffff80102f57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102f5b:	8b 40 20             	mov    0x20(%rax),%eax
+ffffffff80102f5e:	39 d0                	cmp    %edx,%eax
+ffffffff80102f60:	73 0d                	jae    ffffffff80102f6f <readi+0xda>
+    n = ip->size - off;
+ffffffff80102f62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102f66:	8b 40 20             	mov    0x20(%rax),%eax
+ffffffff80102f69:	2b 45 cc             	sub    -0x34(%rbp),%eax
+ffffffff80102f6c:	89 45 c8             	mov    %eax,-0x38(%rbp)
+
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+ffffffff80102f6f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80102f76:	e9 8d 00 00 00       	jmp    ffffffff80103008 <readi+0x173>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+ffffffff80102f7b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff80102f7e:	c1 e8 09             	shr    $0x9,%eax
+ffffffff80102f81:	89 c2                	mov    %eax,%edx
+ffffffff80102f83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102f87:	89 d6                	mov    %edx,%esi
+ffffffff80102f89:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102f8c:	e8 1d fc ff ff       	call   ffffffff80102bae <bmap>
+ffffffff80102f91:	89 c2                	mov    %eax,%edx
+ffffffff80102f93:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80102f97:	8b 00                	mov    (%rax),%eax
+ffffffff80102f99:	89 d6                	mov    %edx,%esi
+ffffffff80102f9b:	89 c7                	mov    %eax,%edi
+ffffffff80102f9d:	e8 35 d3 ff ff       	call   ffffffff801002d7 <bread>
+ffffffff80102fa2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    m = min(n - tot, BSIZE - off%BSIZE);
+ffffffff80102fa6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff80102fa9:	25 ff 01 00 00       	and    $0x1ff,%eax
+ffffffff80102fae:	ba 00 02 00 00       	mov    $0x200,%edx
+ffffffff80102fb3:	29 c2                	sub    %eax,%edx
+ffffffff80102fb5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ffffffff80102fb8:	2b 45 fc             	sub    -0x4(%rbp),%eax
+ffffffff80102fbb:	39 c2                	cmp    %eax,%edx
+ffffffff80102fbd:	0f 46 c2             	cmovbe %edx,%eax
+ffffffff80102fc0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    memmove(dst, bp->data + off%BSIZE, m);
+ffffffff80102fc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102fc7:	48 8d 50 28          	lea    0x28(%rax),%rdx
+ffffffff80102fcb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff80102fce:	25 ff 01 00 00       	and    $0x1ff,%eax
+ffffffff80102fd3:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+ffffffff80102fd7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff80102fda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80102fde:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80102fe1:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102fe4:	e8 45 3e 00 00       	call   ffffffff80106e2e <memmove>
+    brelse(bp);
+ffffffff80102fe9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80102fed:	48 89 c7             	mov    %rax,%rdi
+ffffffff80102ff0:	e8 67 d3 ff ff       	call   ffffffff8010035c <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+ffffffff80102ff5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80102ff8:	01 45 fc             	add    %eax,-0x4(%rbp)
+ffffffff80102ffb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80102ffe:	01 45 cc             	add    %eax,-0x34(%rbp)
+ffffffff80103001:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80103004:	48 01 45 d0          	add    %rax,-0x30(%rbp)
+ffffffff80103008:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010300b:	3b 45 c8             	cmp    -0x38(%rbp),%eax
+ffffffff8010300e:	0f 82 67 ff ff ff    	jb     ffffffff80102f7b <readi+0xe6>
+  }
+  return n;
+ffffffff80103014:	8b 45 c8             	mov    -0x38(%rbp),%eax
+}
+ffffffff80103017:	c9                   	leave
+ffffffff80103018:	c3                   	ret
+
+ffffffff80103019 <writei>:
+
+// PAGEBREAK!
+// Write data to inode.
+int
+writei(struct inode *ip, char *src, uint off, uint n)
+{
+ffffffff80103019:	55                   	push   %rbp
+ffffffff8010301a:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010301d:	48 83 ec 40          	sub    $0x40,%rsp
+ffffffff80103021:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+ffffffff80103025:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ffffffff80103029:	89 55 cc             	mov    %edx,-0x34(%rbp)
+ffffffff8010302c:	89 4d c8             	mov    %ecx,-0x38(%rbp)
+  uint tot, m;
+  struct buf *bp;
+
+  if(ip->type == T_DEV){
+ffffffff8010302f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103033:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff80103037:	66 83 f8 03          	cmp    $0x3,%ax
+ffffffff8010303b:	75 73                	jne    ffffffff801030b0 <writei+0x97>
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+ffffffff8010303d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103041:	0f b7 40 12          	movzwl 0x12(%rax),%eax
+ffffffff80103045:	66 85 c0             	test   %ax,%ax
+ffffffff80103048:	78 2b                	js     ffffffff80103075 <writei+0x5c>
+ffffffff8010304a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff8010304e:	0f b7 40 12          	movzwl 0x12(%rax),%eax
+ffffffff80103052:	66 83 f8 09          	cmp    $0x9,%ax
+ffffffff80103056:	7f 1d                	jg     ffffffff80103075 <writei+0x5c>
+ffffffff80103058:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff8010305c:	0f b7 40 12          	movzwl 0x12(%rax),%eax
+ffffffff80103060:	98                   	cwtl
+ffffffff80103061:	48 98                	cltq
+ffffffff80103063:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80103067:	48 05 e8 04 11 80    	add    $0xffffffff801104e8,%rax
+ffffffff8010306d:	48 8b 00             	mov    (%rax),%rax
+ffffffff80103070:	48 85 c0             	test   %rax,%rax
+ffffffff80103073:	75 0a                	jne    ffffffff8010307f <writei+0x66>
+      return -1;
+ffffffff80103075:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010307a:	e9 49 01 00 00       	jmp    ffffffff801031c8 <writei+0x1af>
+    return devsw[ip->major].write(ip, src, n);
+ffffffff8010307f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103083:	0f b7 40 12          	movzwl 0x12(%rax),%eax
+ffffffff80103087:	98                   	cwtl
+ffffffff80103088:	48 98                	cltq
+ffffffff8010308a:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff8010308e:	48 05 e8 04 11 80    	add    $0xffffffff801104e8,%rax
+ffffffff80103094:	4c 8b 00             	mov    (%rax),%r8
+ffffffff80103097:	8b 55 c8             	mov    -0x38(%rbp),%edx
+ffffffff8010309a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+ffffffff8010309e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801030a2:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801030a5:	48 89 c7             	mov    %rax,%rdi
+ffffffff801030a8:	41 ff d0             	call   *%r8
+ffffffff801030ab:	e9 18 01 00 00       	jmp    ffffffff801031c8 <writei+0x1af>
+  }
+
+  if(off > ip->size || off + n < off)
+ffffffff801030b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801030b4:	8b 40 20             	mov    0x20(%rax),%eax
+ffffffff801030b7:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+ffffffff801030ba:	72 0d                	jb     ffffffff801030c9 <writei+0xb0>
+ffffffff801030bc:	8b 55 cc             	mov    -0x34(%rbp),%edx
+ffffffff801030bf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ffffffff801030c2:	01 d0                	add    %edx,%eax
+ffffffff801030c4:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+ffffffff801030c7:	73 0a                	jae    ffffffff801030d3 <writei+0xba>
+    return -1;
+ffffffff801030c9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801030ce:	e9 f5 00 00 00       	jmp    ffffffff801031c8 <writei+0x1af>
+  if(off + n > MAXFILE*BSIZE)
+ffffffff801030d3:	8b 55 cc             	mov    -0x34(%rbp),%edx
+ffffffff801030d6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ffffffff801030d9:	01 d0                	add    %edx,%eax
+ffffffff801030db:	3d 00 14 01 00       	cmp    $0x11400,%eax
+ffffffff801030e0:	76 0a                	jbe    ffffffff801030ec <writei+0xd3>
+    return -1;
+ffffffff801030e2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801030e7:	e9 dc 00 00 00       	jmp    ffffffff801031c8 <writei+0x1af>
+
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+ffffffff801030ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff801030f3:	e9 99 00 00 00       	jmp    ffffffff80103191 <writei+0x178>
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+ffffffff801030f8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff801030fb:	c1 e8 09             	shr    $0x9,%eax
+ffffffff801030fe:	89 c2                	mov    %eax,%edx
+ffffffff80103100:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103104:	89 d6                	mov    %edx,%esi
+ffffffff80103106:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103109:	e8 a0 fa ff ff       	call   ffffffff80102bae <bmap>
+ffffffff8010310e:	89 c2                	mov    %eax,%edx
+ffffffff80103110:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103114:	8b 00                	mov    (%rax),%eax
+ffffffff80103116:	89 d6                	mov    %edx,%esi
+ffffffff80103118:	89 c7                	mov    %eax,%edi
+ffffffff8010311a:	e8 b8 d1 ff ff       	call   ffffffff801002d7 <bread>
+ffffffff8010311f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    m = min(n - tot, BSIZE - off%BSIZE);
+ffffffff80103123:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff80103126:	25 ff 01 00 00       	and    $0x1ff,%eax
+ffffffff8010312b:	ba 00 02 00 00       	mov    $0x200,%edx
+ffffffff80103130:	29 c2                	sub    %eax,%edx
+ffffffff80103132:	8b 45 c8             	mov    -0x38(%rbp),%eax
+ffffffff80103135:	2b 45 fc             	sub    -0x4(%rbp),%eax
+ffffffff80103138:	39 c2                	cmp    %eax,%edx
+ffffffff8010313a:	0f 46 c2             	cmovbe %edx,%eax
+ffffffff8010313d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    memmove(bp->data + off%BSIZE, src, m);
+ffffffff80103140:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80103144:	48 8d 50 28          	lea    0x28(%rax),%rdx
+ffffffff80103148:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff8010314b:	25 ff 01 00 00       	and    $0x1ff,%eax
+ffffffff80103150:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+ffffffff80103154:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff80103157:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff8010315b:	48 89 c6             	mov    %rax,%rsi
+ffffffff8010315e:	48 89 cf             	mov    %rcx,%rdi
+ffffffff80103161:	e8 c8 3c 00 00       	call   ffffffff80106e2e <memmove>
+    log_write(bp);
+ffffffff80103166:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010316a:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010316d:	e8 ad 17 00 00       	call   ffffffff8010491f <log_write>
+    brelse(bp);
+ffffffff80103172:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80103176:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103179:	e8 de d1 ff ff       	call   ffffffff8010035c <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+ffffffff8010317e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80103181:	01 45 fc             	add    %eax,-0x4(%rbp)
+ffffffff80103184:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80103187:	01 45 cc             	add    %eax,-0x34(%rbp)
+ffffffff8010318a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff8010318d:	48 01 45 d0          	add    %rax,-0x30(%rbp)
+ffffffff80103191:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103194:	3b 45 c8             	cmp    -0x38(%rbp),%eax
+ffffffff80103197:	0f 82 5b ff ff ff    	jb     ffffffff801030f8 <writei+0xdf>
+  }
+
+  if(n > 0 && off > ip->size){
+ffffffff8010319d:	83 7d c8 00          	cmpl   $0x0,-0x38(%rbp)
+ffffffff801031a1:	74 22                	je     ffffffff801031c5 <writei+0x1ac>
+ffffffff801031a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801031a7:	8b 40 20             	mov    0x20(%rax),%eax
+ffffffff801031aa:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+ffffffff801031ad:	73 16                	jae    ffffffff801031c5 <writei+0x1ac>
+    ip->size = off;
+ffffffff801031af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801031b3:	8b 55 cc             	mov    -0x34(%rbp),%edx
+ffffffff801031b6:	89 50 20             	mov    %edx,0x20(%rax)
+    iupdate(ip);
+ffffffff801031b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801031bd:	48 89 c7             	mov    %rax,%rdi
+ffffffff801031c0:	e8 c0 f4 ff ff       	call   ffffffff80102685 <iupdate>
+  }
+  return n;
+ffffffff801031c5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+}
+ffffffff801031c8:	c9                   	leave
+ffffffff801031c9:	c3                   	ret
+
+ffffffff801031ca <namecmp>:
+//PAGEBREAK!
+// Directories
+
+int
+namecmp(const char *s, const char *t)
+{
+ffffffff801031ca:	55                   	push   %rbp
+ffffffff801031cb:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801031ce:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff801031d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff801031d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return strncmp(s, t, DIRSIZ);
+ffffffff801031da:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+ffffffff801031de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801031e2:	ba 0e 00 00 00       	mov    $0xe,%edx
+ffffffff801031e7:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801031ea:	48 89 c7             	mov    %rax,%rdi
+ffffffff801031ed:	e8 0a 3d 00 00       	call   ffffffff80106efc <strncmp>
+}
+ffffffff801031f2:	c9                   	leave
+ffffffff801031f3:	c3                   	ret
+
+ffffffff801031f4 <dirlookup>:
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+ffffffff801031f4:	55                   	push   %rbp
+ffffffff801031f5:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801031f8:	48 83 ec 40          	sub    $0x40,%rsp
+ffffffff801031fc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+ffffffff80103200:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ffffffff80103204:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint off, inum;
+  struct dirent de;
+
+  if(dp->type != T_DIR)
+ffffffff80103208:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff8010320c:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff80103210:	66 83 f8 01          	cmp    $0x1,%ax
+ffffffff80103214:	74 0c                	je     ffffffff80103222 <dirlookup+0x2e>
+    panic("dirlookup not DIR");
+ffffffff80103216:	48 c7 c7 43 a8 10 80 	mov    $0xffffffff8010a843,%rdi
+ffffffff8010321d:	e8 0d d7 ff ff       	call   ffffffff8010092f <panic>
+
+  for(off = 0; off < dp->size; off += sizeof(de)){
+ffffffff80103222:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80103229:	e9 80 00 00 00       	jmp    ffffffff801032ae <dirlookup+0xba>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+ffffffff8010322e:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80103231:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+ffffffff80103235:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103239:	b9 10 00 00 00       	mov    $0x10,%ecx
+ffffffff8010323e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103241:	e8 4f fc ff ff       	call   ffffffff80102e95 <readi>
+ffffffff80103246:	83 f8 10             	cmp    $0x10,%eax
+ffffffff80103249:	74 0c                	je     ffffffff80103257 <dirlookup+0x63>
+      panic("dirlink read");
+ffffffff8010324b:	48 c7 c7 55 a8 10 80 	mov    $0xffffffff8010a855,%rdi
+ffffffff80103252:	e8 d8 d6 ff ff       	call   ffffffff8010092f <panic>
+    if(de.inum == 0)
+ffffffff80103257:	0f b7 45 e0          	movzwl -0x20(%rbp),%eax
+ffffffff8010325b:	66 85 c0             	test   %ax,%ax
+ffffffff8010325e:	74 49                	je     ffffffff801032a9 <dirlookup+0xb5>
+      continue;
+    if(namecmp(name, de.name) == 0){
+ffffffff80103260:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+ffffffff80103264:	48 8d 50 02          	lea    0x2(%rax),%rdx
+ffffffff80103268:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff8010326c:	48 89 d6             	mov    %rdx,%rsi
+ffffffff8010326f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103272:	e8 53 ff ff ff       	call   ffffffff801031ca <namecmp>
+ffffffff80103277:	85 c0                	test   %eax,%eax
+ffffffff80103279:	75 2f                	jne    ffffffff801032aa <dirlookup+0xb6>
+      // entry matches path element
+      if(poff)
+ffffffff8010327b:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+ffffffff80103280:	74 09                	je     ffffffff8010328b <dirlookup+0x97>
+        *poff = off;
+ffffffff80103282:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80103286:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80103289:	89 10                	mov    %edx,(%rax)
+      inum = de.inum;
+ffffffff8010328b:	0f b7 45 e0          	movzwl -0x20(%rbp),%eax
+ffffffff8010328f:	0f b7 c0             	movzwl %ax,%eax
+ffffffff80103292:	89 45 f8             	mov    %eax,-0x8(%rbp)
+      return iget(dp->dev, inum);
+ffffffff80103295:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103299:	8b 00                	mov    (%rax),%eax
+ffffffff8010329b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+ffffffff8010329e:	89 d6                	mov    %edx,%esi
+ffffffff801032a0:	89 c7                	mov    %eax,%edi
+ffffffff801032a2:	e8 bf f4 ff ff       	call   ffffffff80102766 <iget>
+ffffffff801032a7:	eb 1a                	jmp    ffffffff801032c3 <dirlookup+0xcf>
+      continue;
+ffffffff801032a9:	90                   	nop
+  for(off = 0; off < dp->size; off += sizeof(de)){
+ffffffff801032aa:	83 45 fc 10          	addl   $0x10,-0x4(%rbp)
+ffffffff801032ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801032b2:	8b 40 20             	mov    0x20(%rax),%eax
+ffffffff801032b5:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+ffffffff801032b8:	0f 82 70 ff ff ff    	jb     ffffffff8010322e <dirlookup+0x3a>
+    }
+  }
+
+  return 0;
+ffffffff801032be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801032c3:	c9                   	leave
+ffffffff801032c4:	c3                   	ret
+
+ffffffff801032c5 <dirlink>:
+
+// Write a new directory entry (name, inum) into the directory dp.
+int
+dirlink(struct inode *dp, char *name, uint inum)
+{
+ffffffff801032c5:	55                   	push   %rbp
+ffffffff801032c6:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801032c9:	48 83 ec 40          	sub    $0x40,%rsp
+ffffffff801032cd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+ffffffff801032d1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ffffffff801032d5:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int off;
+  struct dirent de;
+  struct inode *ip;
+
+  // Check that name is not present.
+  if((ip = dirlookup(dp, name, 0)) != 0){
+ffffffff801032d8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+ffffffff801032dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801032e0:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff801032e5:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801032e8:	48 89 c7             	mov    %rax,%rdi
+ffffffff801032eb:	e8 04 ff ff ff       	call   ffffffff801031f4 <dirlookup>
+ffffffff801032f0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff801032f4:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff801032f9:	74 16                	je     ffffffff80103311 <dirlink+0x4c>
+    iput(ip);
+ffffffff801032fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801032ff:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103302:	e8 9b f7 ff ff       	call   ffffffff80102aa2 <iput>
+    return -1;
+ffffffff80103307:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010330c:	e9 a6 00 00 00       	jmp    ffffffff801033b7 <dirlink+0xf2>
+  }
+
+  // Look for an empty dirent.
+  for(off = 0; off < dp->size; off += sizeof(de)){
+ffffffff80103311:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80103318:	eb 3b                	jmp    ffffffff80103355 <dirlink+0x90>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+ffffffff8010331a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010331d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+ffffffff80103321:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103325:	b9 10 00 00 00       	mov    $0x10,%ecx
+ffffffff8010332a:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010332d:	e8 63 fb ff ff       	call   ffffffff80102e95 <readi>
+ffffffff80103332:	83 f8 10             	cmp    $0x10,%eax
+ffffffff80103335:	74 0c                	je     ffffffff80103343 <dirlink+0x7e>
+      panic("dirlink read");
+ffffffff80103337:	48 c7 c7 55 a8 10 80 	mov    $0xffffffff8010a855,%rdi
+ffffffff8010333e:	e8 ec d5 ff ff       	call   ffffffff8010092f <panic>
+    if(de.inum == 0)
+ffffffff80103343:	0f b7 45 e0          	movzwl -0x20(%rbp),%eax
+ffffffff80103347:	66 85 c0             	test   %ax,%ax
+ffffffff8010334a:	74 19                	je     ffffffff80103365 <dirlink+0xa0>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+ffffffff8010334c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010334f:	83 c0 10             	add    $0x10,%eax
+ffffffff80103352:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80103355:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103359:	8b 40 20             	mov    0x20(%rax),%eax
+ffffffff8010335c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010335f:	39 c2                	cmp    %eax,%edx
+ffffffff80103361:	72 b7                	jb     ffffffff8010331a <dirlink+0x55>
+ffffffff80103363:	eb 01                	jmp    ffffffff80103366 <dirlink+0xa1>
+      break;
+ffffffff80103365:	90                   	nop
+  }
+
+  strncpy(de.name, name, DIRSIZ);
+ffffffff80103366:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff8010336a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+ffffffff8010336e:	48 8d 4a 02          	lea    0x2(%rdx),%rcx
+ffffffff80103372:	ba 0e 00 00 00       	mov    $0xe,%edx
+ffffffff80103377:	48 89 c6             	mov    %rax,%rsi
+ffffffff8010337a:	48 89 cf             	mov    %rcx,%rdi
+ffffffff8010337d:	e8 e7 3b 00 00       	call   ffffffff80106f69 <strncpy>
+  de.inum = inum;
+ffffffff80103382:	8b 45 cc             	mov    -0x34(%rbp),%eax
+ffffffff80103385:	66 89 45 e0          	mov    %ax,-0x20(%rbp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+ffffffff80103389:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010338c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+ffffffff80103390:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80103394:	b9 10 00 00 00       	mov    $0x10,%ecx
+ffffffff80103399:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010339c:	e8 78 fc ff ff       	call   ffffffff80103019 <writei>
+ffffffff801033a1:	83 f8 10             	cmp    $0x10,%eax
+ffffffff801033a4:	74 0c                	je     ffffffff801033b2 <dirlink+0xed>
+    panic("dirlink");
+ffffffff801033a6:	48 c7 c7 62 a8 10 80 	mov    $0xffffffff8010a862,%rdi
+ffffffff801033ad:	e8 7d d5 ff ff       	call   ffffffff8010092f <panic>
+  
+  return 0;
+ffffffff801033b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801033b7:	c9                   	leave
+ffffffff801033b8:	c3                   	ret
+
+ffffffff801033b9 <skipelem>:
+//   skipelem("a", name) = "", setting name = "a"
+//   skipelem("", name) = skipelem("////", name) = 0
+//
+static char*
+skipelem(char *path, char *name)
+{
+ffffffff801033b9:	55                   	push   %rbp
+ffffffff801033ba:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801033bd:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801033c1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff801033c5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *s;
+  int len;
+
+  while(*path == '/')
+ffffffff801033c9:	eb 05                	jmp    ffffffff801033d0 <skipelem+0x17>
+    path++;
+ffffffff801033cb:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  while(*path == '/')
+ffffffff801033d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801033d4:	0f b6 00             	movzbl (%rax),%eax
+ffffffff801033d7:	3c 2f                	cmp    $0x2f,%al
+ffffffff801033d9:	74 f0                	je     ffffffff801033cb <skipelem+0x12>
+  if(*path == 0)
+ffffffff801033db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801033df:	0f b6 00             	movzbl (%rax),%eax
+ffffffff801033e2:	84 c0                	test   %al,%al
+ffffffff801033e4:	75 0a                	jne    ffffffff801033f0 <skipelem+0x37>
+    return 0;
+ffffffff801033e6:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801033eb:	e9 8c 00 00 00       	jmp    ffffffff8010347c <skipelem+0xc3>
+  s = path;
+ffffffff801033f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801033f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(*path != '/' && *path != 0)
+ffffffff801033f8:	eb 05                	jmp    ffffffff801033ff <skipelem+0x46>
+    path++;
+ffffffff801033fa:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  while(*path != '/' && *path != 0)
+ffffffff801033ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103403:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80103406:	3c 2f                	cmp    $0x2f,%al
+ffffffff80103408:	74 0b                	je     ffffffff80103415 <skipelem+0x5c>
+ffffffff8010340a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010340e:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80103411:	84 c0                	test   %al,%al
+ffffffff80103413:	75 e5                	jne    ffffffff801033fa <skipelem+0x41>
+  len = path - s;
+ffffffff80103415:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103419:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+ffffffff8010341d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if(len >= DIRSIZ)
+ffffffff80103420:	83 7d f4 0d          	cmpl   $0xd,-0xc(%rbp)
+ffffffff80103424:	7e 1a                	jle    ffffffff80103440 <skipelem+0x87>
+    memmove(name, s, DIRSIZ);
+ffffffff80103426:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ffffffff8010342a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010342e:	ba 0e 00 00 00       	mov    $0xe,%edx
+ffffffff80103433:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80103436:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103439:	e8 f0 39 00 00       	call   ffffffff80106e2e <memmove>
+ffffffff8010343e:	eb 2d                	jmp    ffffffff8010346d <skipelem+0xb4>
+  else {
+    memmove(name, s, len);
+ffffffff80103440:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff80103443:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ffffffff80103447:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010344b:	48 89 ce             	mov    %rcx,%rsi
+ffffffff8010344e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103451:	e8 d8 39 00 00       	call   ffffffff80106e2e <memmove>
+    name[len] = 0;
+ffffffff80103456:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80103459:	48 63 d0             	movslq %eax,%rdx
+ffffffff8010345c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80103460:	48 01 d0             	add    %rdx,%rax
+ffffffff80103463:	c6 00 00             	movb   $0x0,(%rax)
+  }
+  while(*path == '/')
+ffffffff80103466:	eb 05                	jmp    ffffffff8010346d <skipelem+0xb4>
+    path++;
+ffffffff80103468:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  while(*path == '/')
+ffffffff8010346d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103471:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80103474:	3c 2f                	cmp    $0x2f,%al
+ffffffff80103476:	74 f0                	je     ffffffff80103468 <skipelem+0xaf>
+  return path;
+ffffffff80103478:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ffffffff8010347c:	c9                   	leave
+ffffffff8010347d:	c3                   	ret
+
+ffffffff8010347e <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+ffffffff8010347e:	55                   	push   %rbp
+ffffffff8010347f:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103482:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80103486:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff8010348a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+ffffffff8010348d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  struct inode *ip, *next;
+
+  if(*path == '/')
+ffffffff80103491:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103495:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80103498:	3c 2f                	cmp    $0x2f,%al
+ffffffff8010349a:	75 18                	jne    ffffffff801034b4 <namex+0x36>
+    ip = iget(ROOTDEV, ROOTINO);
+ffffffff8010349c:	be 01 00 00 00       	mov    $0x1,%esi
+ffffffff801034a1:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff801034a6:	e8 bb f2 ff ff       	call   ffffffff80102766 <iget>
+ffffffff801034ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff801034af:	e9 c3 00 00 00       	jmp    ffffffff80103577 <namex+0xf9>
+  else
+    ip = idup(proc->cwd);
+ffffffff801034b4:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801034bb:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801034bf:	48 8b 80 c8 00 00 00 	mov    0xc8(%rax),%rax
+ffffffff801034c6:	48 89 c7             	mov    %rax,%rdi
+ffffffff801034c9:	e8 88 f3 ff ff       	call   ffffffff80102856 <idup>
+ffffffff801034ce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  while((path = skipelem(path, name)) != 0){
+ffffffff801034d2:	e9 a0 00 00 00       	jmp    ffffffff80103577 <namex+0xf9>
+    ilock(ip);
+ffffffff801034d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801034db:	48 89 c7             	mov    %rax,%rdi
+ffffffff801034de:	e8 ae f3 ff ff       	call   ffffffff80102891 <ilock>
+    if(ip->type != T_DIR){
+ffffffff801034e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801034e7:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff801034eb:	66 83 f8 01          	cmp    $0x1,%ax
+ffffffff801034ef:	74 16                	je     ffffffff80103507 <namex+0x89>
+      iunlockput(ip);
+ffffffff801034f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801034f5:	48 89 c7             	mov    %rax,%rdi
+ffffffff801034f8:	e8 8a f6 ff ff       	call   ffffffff80102b87 <iunlockput>
+      return 0;
+ffffffff801034fd:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80103502:	e9 af 00 00 00       	jmp    ffffffff801035b6 <namex+0x138>
+    }
+    if(nameiparent && *path == '\0'){
+ffffffff80103507:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+ffffffff8010350b:	74 20                	je     ffffffff8010352d <namex+0xaf>
+ffffffff8010350d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103511:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80103514:	84 c0                	test   %al,%al
+ffffffff80103516:	75 15                	jne    ffffffff8010352d <namex+0xaf>
+      // Stop one level early.
+      iunlock(ip);
+ffffffff80103518:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010351c:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010351f:	e8 0c f5 ff ff       	call   ffffffff80102a30 <iunlock>
+      return ip;
+ffffffff80103524:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103528:	e9 89 00 00 00       	jmp    ffffffff801035b6 <namex+0x138>
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+ffffffff8010352d:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+ffffffff80103531:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103535:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff8010353a:	48 89 ce             	mov    %rcx,%rsi
+ffffffff8010353d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103540:	e8 af fc ff ff       	call   ffffffff801031f4 <dirlookup>
+ffffffff80103545:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff80103549:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff8010354e:	75 13                	jne    ffffffff80103563 <namex+0xe5>
+      iunlockput(ip);
+ffffffff80103550:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103554:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103557:	e8 2b f6 ff ff       	call   ffffffff80102b87 <iunlockput>
+      return 0;
+ffffffff8010355c:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80103561:	eb 53                	jmp    ffffffff801035b6 <namex+0x138>
+    }
+    iunlockput(ip);
+ffffffff80103563:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103567:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010356a:	e8 18 f6 ff ff       	call   ffffffff80102b87 <iunlockput>
+    ip = next;
+ffffffff8010356f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80103573:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while((path = skipelem(path, name)) != 0){
+ffffffff80103577:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+ffffffff8010357b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010357f:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80103582:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103585:	e8 2f fe ff ff       	call   ffffffff801033b9 <skipelem>
+ffffffff8010358a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+ffffffff8010358e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+ffffffff80103593:	0f 85 3e ff ff ff    	jne    ffffffff801034d7 <namex+0x59>
+  }
+  if(nameiparent){
+ffffffff80103599:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+ffffffff8010359d:	74 13                	je     ffffffff801035b2 <namex+0x134>
+    iput(ip);
+ffffffff8010359f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801035a3:	48 89 c7             	mov    %rax,%rdi
+ffffffff801035a6:	e8 f7 f4 ff ff       	call   ffffffff80102aa2 <iput>
+    return 0;
+ffffffff801035ab:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801035b0:	eb 04                	jmp    ffffffff801035b6 <namex+0x138>
+  }
+  return ip;
+ffffffff801035b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff801035b6:	c9                   	leave
+ffffffff801035b7:	c3                   	ret
+
+ffffffff801035b8 <namei>:
+
+struct inode*
+namei(char *path)
+{
+ffffffff801035b8:	55                   	push   %rbp
+ffffffff801035b9:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801035bc:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801035c0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+ffffffff801035c4:	48 8d 55 f2          	lea    -0xe(%rbp),%rdx
+ffffffff801035c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801035cc:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801035d1:	48 89 c7             	mov    %rax,%rdi
+ffffffff801035d4:	e8 a5 fe ff ff       	call   ffffffff8010347e <namex>
+}
+ffffffff801035d9:	c9                   	leave
+ffffffff801035da:	c3                   	ret
+
+ffffffff801035db <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+ffffffff801035db:	55                   	push   %rbp
+ffffffff801035dc:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801035df:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff801035e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff801035e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return namex(path, 1, name);
+ffffffff801035eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff801035ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801035f3:	be 01 00 00 00       	mov    $0x1,%esi
+ffffffff801035f8:	48 89 c7             	mov    %rax,%rdi
+ffffffff801035fb:	e8 7e fe ff ff       	call   ffffffff8010347e <namex>
+}
+ffffffff80103600:	c9                   	leave
+ffffffff80103601:	c3                   	ret
+
+ffffffff80103602 <inb>:
+{
+ffffffff80103602:	55                   	push   %rbp
+ffffffff80103603:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103606:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff8010360a:	89 f8                	mov    %edi,%eax
+ffffffff8010360c:	66 89 45 ec          	mov    %ax,-0x14(%rbp)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+ffffffff80103610:	0f b7 45 ec          	movzwl -0x14(%rbp),%eax
+ffffffff80103614:	89 c2                	mov    %eax,%edx
+ffffffff80103616:	ec                   	in     (%dx),%al
+ffffffff80103617:	88 45 ff             	mov    %al,-0x1(%rbp)
+  return data;
+ffffffff8010361a:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+}
+ffffffff8010361e:	c9                   	leave
+ffffffff8010361f:	c3                   	ret
+
+ffffffff80103620 <insl>:
+{
+ffffffff80103620:	55                   	push   %rbp
+ffffffff80103621:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103624:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80103628:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ffffffff8010362b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+ffffffff8010362f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  asm volatile("cld; rep insl" :
+ffffffff80103632:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80103635:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+ffffffff80103639:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff8010363c:	48 89 ce             	mov    %rcx,%rsi
+ffffffff8010363f:	48 89 f7             	mov    %rsi,%rdi
+ffffffff80103642:	89 c1                	mov    %eax,%ecx
+ffffffff80103644:	fc                   	cld
+ffffffff80103645:	f3 6d                	rep insl (%dx),%es:(%rdi)
+ffffffff80103647:	89 c8                	mov    %ecx,%eax
+ffffffff80103649:	48 89 fe             	mov    %rdi,%rsi
+ffffffff8010364c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+ffffffff80103650:	89 45 f8             	mov    %eax,-0x8(%rbp)
+}
+ffffffff80103653:	90                   	nop
+ffffffff80103654:	c9                   	leave
+ffffffff80103655:	c3                   	ret
+
+ffffffff80103656 <outb>:
+{
+ffffffff80103656:	55                   	push   %rbp
+ffffffff80103657:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010365a:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff8010365e:	89 fa                	mov    %edi,%edx
+ffffffff80103660:	89 f0                	mov    %esi,%eax
+ffffffff80103662:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+ffffffff80103666:	88 45 f8             	mov    %al,-0x8(%rbp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+ffffffff80103669:	0f b6 45 f8          	movzbl -0x8(%rbp),%eax
+ffffffff8010366d:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+ffffffff80103671:	ee                   	out    %al,(%dx)
+}
+ffffffff80103672:	90                   	nop
+ffffffff80103673:	c9                   	leave
+ffffffff80103674:	c3                   	ret
+
+ffffffff80103675 <outsl>:
+{
+ffffffff80103675:	55                   	push   %rbp
+ffffffff80103676:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103679:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff8010367d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ffffffff80103680:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+ffffffff80103684:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  asm volatile("cld; rep outsl" :
+ffffffff80103687:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010368a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+ffffffff8010368e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80103691:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80103694:	89 c1                	mov    %eax,%ecx
+ffffffff80103696:	fc                   	cld
+ffffffff80103697:	f3 6f                	rep outsl %ds:(%rsi),(%dx)
+ffffffff80103699:	89 c8                	mov    %ecx,%eax
+ffffffff8010369b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+ffffffff8010369f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+}
+ffffffff801036a2:	90                   	nop
+ffffffff801036a3:	c9                   	leave
+ffffffff801036a4:	c3                   	ret
+
+ffffffff801036a5 <idewait>:
+static void idestart(struct buf*);
+
+// Wait for IDE disk to become ready.
+static int
+idewait(int checkerr)
+{
+ffffffff801036a5:	55                   	push   %rbp
+ffffffff801036a6:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801036a9:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff801036ad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY) 
+ffffffff801036b0:	90                   	nop
+ffffffff801036b1:	bf f7 01 00 00       	mov    $0x1f7,%edi
+ffffffff801036b6:	e8 47 ff ff ff       	call   ffffffff80103602 <inb>
+ffffffff801036bb:	0f b6 c0             	movzbl %al,%eax
+ffffffff801036be:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff801036c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801036c4:	25 c0 00 00 00       	and    $0xc0,%eax
+ffffffff801036c9:	83 f8 40             	cmp    $0x40,%eax
+ffffffff801036cc:	75 e3                	jne    ffffffff801036b1 <idewait+0xc>
+    ;
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+ffffffff801036ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+ffffffff801036d2:	74 11                	je     ffffffff801036e5 <idewait+0x40>
+ffffffff801036d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801036d7:	83 e0 21             	and    $0x21,%eax
+ffffffff801036da:	85 c0                	test   %eax,%eax
+ffffffff801036dc:	74 07                	je     ffffffff801036e5 <idewait+0x40>
+    return -1;
+ffffffff801036de:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801036e3:	eb 05                	jmp    ffffffff801036ea <idewait+0x45>
+  return 0;
+ffffffff801036e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801036ea:	c9                   	leave
+ffffffff801036eb:	c3                   	ret
+
+ffffffff801036ec <ideinit>:
+
+void
+ideinit(void)
+{
+ffffffff801036ec:	55                   	push   %rbp
+ffffffff801036ed:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801036f0:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  
+  initlock(&idelock, "ide");
+ffffffff801036f4:	48 c7 c6 6a a8 10 80 	mov    $0xffffffff8010a86a,%rsi
+ffffffff801036fb:	48 c7 c7 c0 25 11 80 	mov    $0xffffffff801125c0,%rdi
+ffffffff80103702:	e8 93 32 00 00       	call   ffffffff8010699a <initlock>
+  picenable(IRQ_IDE);
+ffffffff80103707:	bf 0e 00 00 00       	mov    $0xe,%edi
+ffffffff8010370c:	e8 07 1f 00 00       	call   ffffffff80105618 <picenable>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+ffffffff80103711:	8b 05 4d f8 00 00    	mov    0xf84d(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff80103717:	83 e8 01             	sub    $0x1,%eax
+ffffffff8010371a:	89 c6                	mov    %eax,%esi
+ffffffff8010371c:	bf 0e 00 00 00       	mov    $0xe,%edi
+ffffffff80103721:	e8 67 04 00 00       	call   ffffffff80103b8d <ioapicenable>
+  idewait(0);
+ffffffff80103726:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff8010372b:	e8 75 ff ff ff       	call   ffffffff801036a5 <idewait>
+  
+  // Check if disk 1 is present
+  outb(0x1f6, 0xe0 | (1<<4));
+ffffffff80103730:	be f0 00 00 00       	mov    $0xf0,%esi
+ffffffff80103735:	bf f6 01 00 00       	mov    $0x1f6,%edi
+ffffffff8010373a:	e8 17 ff ff ff       	call   ffffffff80103656 <outb>
+  for(i=0; i<1000; i++){
+ffffffff8010373f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80103746:	eb 1e                	jmp    ffffffff80103766 <ideinit+0x7a>
+    if(inb(0x1f7) != 0){
+ffffffff80103748:	bf f7 01 00 00       	mov    $0x1f7,%edi
+ffffffff8010374d:	e8 b0 fe ff ff       	call   ffffffff80103602 <inb>
+ffffffff80103752:	84 c0                	test   %al,%al
+ffffffff80103754:	74 0c                	je     ffffffff80103762 <ideinit+0x76>
+      havedisk1 = 1;
+ffffffff80103756:	c7 05 d0 ee 00 00 01 	movl   $0x1,0xeed0(%rip)        # ffffffff80112630 <havedisk1>
+ffffffff8010375d:	00 00 00 
+      break;
+ffffffff80103760:	eb 0d                	jmp    ffffffff8010376f <ideinit+0x83>
+  for(i=0; i<1000; i++){
+ffffffff80103762:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80103766:	81 7d fc e7 03 00 00 	cmpl   $0x3e7,-0x4(%rbp)
+ffffffff8010376d:	7e d9                	jle    ffffffff80103748 <ideinit+0x5c>
+    }
+  }
+  
+  // Switch back to disk 0.
+  outb(0x1f6, 0xe0 | (0<<4));
+ffffffff8010376f:	be e0 00 00 00       	mov    $0xe0,%esi
+ffffffff80103774:	bf f6 01 00 00       	mov    $0x1f6,%edi
+ffffffff80103779:	e8 d8 fe ff ff       	call   ffffffff80103656 <outb>
+}
+ffffffff8010377e:	90                   	nop
+ffffffff8010377f:	c9                   	leave
+ffffffff80103780:	c3                   	ret
+
+ffffffff80103781 <idestart>:
+
+// Start the request for b.  Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+ffffffff80103781:	55                   	push   %rbp
+ffffffff80103782:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103785:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80103789:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if(b == 0)
+ffffffff8010378d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+ffffffff80103792:	75 0c                	jne    ffffffff801037a0 <idestart+0x1f>
+    panic("idestart");
+ffffffff80103794:	48 c7 c7 6e a8 10 80 	mov    $0xffffffff8010a86e,%rdi
+ffffffff8010379b:	e8 8f d1 ff ff       	call   ffffffff8010092f <panic>
+  if(b->blockno >= FSSIZE)
+ffffffff801037a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801037a4:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff801037a7:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+ffffffff801037ac:	76 0c                	jbe    ffffffff801037ba <idestart+0x39>
+    panic("incorrect blockno");
+ffffffff801037ae:	48 c7 c7 77 a8 10 80 	mov    $0xffffffff8010a877,%rdi
+ffffffff801037b5:	e8 75 d1 ff ff       	call   ffffffff8010092f <panic>
+  int sector_per_block =  BSIZE/SECTOR_SIZE;
+ffffffff801037ba:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int sector = b->blockno * sector_per_block;
+ffffffff801037c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801037c5:	8b 50 08             	mov    0x8(%rax),%edx
+ffffffff801037c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801037cb:	0f af c2             	imul   %edx,%eax
+ffffffff801037ce:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (sector_per_block > 7) panic("idestart");
+ffffffff801037d1:	83 7d fc 07          	cmpl   $0x7,-0x4(%rbp)
+ffffffff801037d5:	7e 0c                	jle    ffffffff801037e3 <idestart+0x62>
+ffffffff801037d7:	48 c7 c7 6e a8 10 80 	mov    $0xffffffff8010a86e,%rdi
+ffffffff801037de:	e8 4c d1 ff ff       	call   ffffffff8010092f <panic>
+  
+  idewait(0);
+ffffffff801037e3:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff801037e8:	e8 b8 fe ff ff       	call   ffffffff801036a5 <idewait>
+  outb(0x3f6, 0);  // generate interrupt
+ffffffff801037ed:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801037f2:	bf f6 03 00 00       	mov    $0x3f6,%edi
+ffffffff801037f7:	e8 5a fe ff ff       	call   ffffffff80103656 <outb>
+  outb(0x1f2, sector_per_block);  // number of sectors
+ffffffff801037fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801037ff:	0f b6 c0             	movzbl %al,%eax
+ffffffff80103802:	89 c6                	mov    %eax,%esi
+ffffffff80103804:	bf f2 01 00 00       	mov    $0x1f2,%edi
+ffffffff80103809:	e8 48 fe ff ff       	call   ffffffff80103656 <outb>
+  outb(0x1f3, sector & 0xff);
+ffffffff8010380e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80103811:	0f b6 c0             	movzbl %al,%eax
+ffffffff80103814:	89 c6                	mov    %eax,%esi
+ffffffff80103816:	bf f3 01 00 00       	mov    $0x1f3,%edi
+ffffffff8010381b:	e8 36 fe ff ff       	call   ffffffff80103656 <outb>
+  outb(0x1f4, (sector >> 8) & 0xff);
+ffffffff80103820:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80103823:	c1 f8 08             	sar    $0x8,%eax
+ffffffff80103826:	0f b6 c0             	movzbl %al,%eax
+ffffffff80103829:	89 c6                	mov    %eax,%esi
+ffffffff8010382b:	bf f4 01 00 00       	mov    $0x1f4,%edi
+ffffffff80103830:	e8 21 fe ff ff       	call   ffffffff80103656 <outb>
+  outb(0x1f5, (sector >> 16) & 0xff);
+ffffffff80103835:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80103838:	c1 f8 10             	sar    $0x10,%eax
+ffffffff8010383b:	0f b6 c0             	movzbl %al,%eax
+ffffffff8010383e:	89 c6                	mov    %eax,%esi
+ffffffff80103840:	bf f5 01 00 00       	mov    $0x1f5,%edi
+ffffffff80103845:	e8 0c fe ff ff       	call   ffffffff80103656 <outb>
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+ffffffff8010384a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010384e:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80103851:	c1 e0 04             	shl    $0x4,%eax
+ffffffff80103854:	83 e0 10             	and    $0x10,%eax
+ffffffff80103857:	89 c2                	mov    %eax,%edx
+ffffffff80103859:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff8010385c:	c1 f8 18             	sar    $0x18,%eax
+ffffffff8010385f:	83 e0 0f             	and    $0xf,%eax
+ffffffff80103862:	09 d0                	or     %edx,%eax
+ffffffff80103864:	83 c8 e0             	or     $0xffffffe0,%eax
+ffffffff80103867:	0f b6 c0             	movzbl %al,%eax
+ffffffff8010386a:	89 c6                	mov    %eax,%esi
+ffffffff8010386c:	bf f6 01 00 00       	mov    $0x1f6,%edi
+ffffffff80103871:	e8 e0 fd ff ff       	call   ffffffff80103656 <outb>
+  if(b->flags & B_DIRTY){
+ffffffff80103876:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010387a:	8b 00                	mov    (%rax),%eax
+ffffffff8010387c:	83 e0 04             	and    $0x4,%eax
+ffffffff8010387f:	85 c0                	test   %eax,%eax
+ffffffff80103881:	74 2b                	je     ffffffff801038ae <idestart+0x12d>
+    outb(0x1f7, IDE_CMD_WRITE);
+ffffffff80103883:	be 30 00 00 00       	mov    $0x30,%esi
+ffffffff80103888:	bf f7 01 00 00       	mov    $0x1f7,%edi
+ffffffff8010388d:	e8 c4 fd ff ff       	call   ffffffff80103656 <outb>
+    outsl(0x1f0, b->data, BSIZE/4);
+ffffffff80103892:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103896:	48 83 c0 28          	add    $0x28,%rax
+ffffffff8010389a:	ba 80 00 00 00       	mov    $0x80,%edx
+ffffffff8010389f:	48 89 c6             	mov    %rax,%rsi
+ffffffff801038a2:	bf f0 01 00 00       	mov    $0x1f0,%edi
+ffffffff801038a7:	e8 c9 fd ff ff       	call   ffffffff80103675 <outsl>
+  } else {
+    outb(0x1f7, IDE_CMD_READ);
+  }
+}
+ffffffff801038ac:	eb 0f                	jmp    ffffffff801038bd <idestart+0x13c>
+    outb(0x1f7, IDE_CMD_READ);
+ffffffff801038ae:	be 20 00 00 00       	mov    $0x20,%esi
+ffffffff801038b3:	bf f7 01 00 00       	mov    $0x1f7,%edi
+ffffffff801038b8:	e8 99 fd ff ff       	call   ffffffff80103656 <outb>
+}
+ffffffff801038bd:	90                   	nop
+ffffffff801038be:	c9                   	leave
+ffffffff801038bf:	c3                   	ret
+
+ffffffff801038c0 <ideintr>:
+
+// Interrupt handler.
+void
+ideintr(void)
+{
+ffffffff801038c0:	55                   	push   %rbp
+ffffffff801038c1:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801038c4:	48 83 ec 10          	sub    $0x10,%rsp
+  struct buf *b;
+
+  // First queued buffer is the active request.
+  acquire(&idelock);
+ffffffff801038c8:	48 c7 c7 c0 25 11 80 	mov    $0xffffffff801125c0,%rdi
+ffffffff801038cf:	e8 fb 30 00 00       	call   ffffffff801069cf <acquire>
+  if((b = idequeue) == 0){
+ffffffff801038d4:	48 8b 05 4d ed 00 00 	mov    0xed4d(%rip),%rax        # ffffffff80112628 <idequeue>
+ffffffff801038db:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff801038df:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff801038e4:	75 11                	jne    ffffffff801038f7 <ideintr+0x37>
+    release(&idelock);
+ffffffff801038e6:	48 c7 c7 c0 25 11 80 	mov    $0xffffffff801125c0,%rdi
+ffffffff801038ed:	e8 b4 31 00 00       	call   ffffffff80106aa6 <release>
+    // cprintf("spurious IDE interrupt\n");
+    return;
+ffffffff801038f2:	e9 99 00 00 00       	jmp    ffffffff80103990 <ideintr+0xd0>
+  }
+  idequeue = b->qnext;
+ffffffff801038f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801038fb:	48 8b 40 20          	mov    0x20(%rax),%rax
+ffffffff801038ff:	48 89 05 22 ed 00 00 	mov    %rax,0xed22(%rip)        # ffffffff80112628 <idequeue>
+
+  // Read data if needed.
+  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+ffffffff80103906:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010390a:	8b 00                	mov    (%rax),%eax
+ffffffff8010390c:	83 e0 04             	and    $0x4,%eax
+ffffffff8010390f:	85 c0                	test   %eax,%eax
+ffffffff80103911:	75 28                	jne    ffffffff8010393b <ideintr+0x7b>
+ffffffff80103913:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff80103918:	e8 88 fd ff ff       	call   ffffffff801036a5 <idewait>
+ffffffff8010391d:	85 c0                	test   %eax,%eax
+ffffffff8010391f:	78 1a                	js     ffffffff8010393b <ideintr+0x7b>
+    insl(0x1f0, b->data, BSIZE/4);
+ffffffff80103921:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103925:	48 83 c0 28          	add    $0x28,%rax
+ffffffff80103929:	ba 80 00 00 00       	mov    $0x80,%edx
+ffffffff8010392e:	48 89 c6             	mov    %rax,%rsi
+ffffffff80103931:	bf f0 01 00 00       	mov    $0x1f0,%edi
+ffffffff80103936:	e8 e5 fc ff ff       	call   ffffffff80103620 <insl>
+  
+  // Wake process waiting for this buf.
+  b->flags |= B_VALID;
+ffffffff8010393b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010393f:	8b 00                	mov    (%rax),%eax
+ffffffff80103941:	83 c8 02             	or     $0x2,%eax
+ffffffff80103944:	89 c2                	mov    %eax,%edx
+ffffffff80103946:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010394a:	89 10                	mov    %edx,(%rax)
+  b->flags &= ~B_DIRTY;
+ffffffff8010394c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103950:	8b 00                	mov    (%rax),%eax
+ffffffff80103952:	83 e0 fb             	and    $0xfffffffb,%eax
+ffffffff80103955:	89 c2                	mov    %eax,%edx
+ffffffff80103957:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010395b:	89 10                	mov    %edx,(%rax)
+  wakeup(b);
+ffffffff8010395d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103961:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103964:	e8 fb 2d 00 00       	call   ffffffff80106764 <wakeup>
+  
+  // Start disk on next buf in queue.
+  if(idequeue != 0)
+ffffffff80103969:	48 8b 05 b8 ec 00 00 	mov    0xecb8(%rip),%rax        # ffffffff80112628 <idequeue>
+ffffffff80103970:	48 85 c0             	test   %rax,%rax
+ffffffff80103973:	74 0f                	je     ffffffff80103984 <ideintr+0xc4>
+    idestart(idequeue);
+ffffffff80103975:	48 8b 05 ac ec 00 00 	mov    0xecac(%rip),%rax        # ffffffff80112628 <idequeue>
+ffffffff8010397c:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010397f:	e8 fd fd ff ff       	call   ffffffff80103781 <idestart>
+
+  release(&idelock);
+ffffffff80103984:	48 c7 c7 c0 25 11 80 	mov    $0xffffffff801125c0,%rdi
+ffffffff8010398b:	e8 16 31 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff80103990:	c9                   	leave
+ffffffff80103991:	c3                   	ret
+
+ffffffff80103992 <iderw>:
+// Sync buf with disk. 
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+ffffffff80103992:	55                   	push   %rbp
+ffffffff80103993:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103996:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff8010399a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct buf **pp;
+
+  if(!(b->flags & B_BUSY))
+ffffffff8010399e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801039a2:	8b 00                	mov    (%rax),%eax
+ffffffff801039a4:	83 e0 01             	and    $0x1,%eax
+ffffffff801039a7:	85 c0                	test   %eax,%eax
+ffffffff801039a9:	75 0c                	jne    ffffffff801039b7 <iderw+0x25>
+    panic("iderw: buf not busy");
+ffffffff801039ab:	48 c7 c7 89 a8 10 80 	mov    $0xffffffff8010a889,%rdi
+ffffffff801039b2:	e8 78 cf ff ff       	call   ffffffff8010092f <panic>
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+ffffffff801039b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801039bb:	8b 00                	mov    (%rax),%eax
+ffffffff801039bd:	83 e0 06             	and    $0x6,%eax
+ffffffff801039c0:	83 f8 02             	cmp    $0x2,%eax
+ffffffff801039c3:	75 0c                	jne    ffffffff801039d1 <iderw+0x3f>
+    panic("iderw: nothing to do");
+ffffffff801039c5:	48 c7 c7 9d a8 10 80 	mov    $0xffffffff8010a89d,%rdi
+ffffffff801039cc:	e8 5e cf ff ff       	call   ffffffff8010092f <panic>
+  if(b->dev != 0 && !havedisk1)
+ffffffff801039d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801039d5:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff801039d8:	85 c0                	test   %eax,%eax
+ffffffff801039da:	74 16                	je     ffffffff801039f2 <iderw+0x60>
+ffffffff801039dc:	8b 05 4e ec 00 00    	mov    0xec4e(%rip),%eax        # ffffffff80112630 <havedisk1>
+ffffffff801039e2:	85 c0                	test   %eax,%eax
+ffffffff801039e4:	75 0c                	jne    ffffffff801039f2 <iderw+0x60>
+    panic("iderw: ide disk 1 not present");
+ffffffff801039e6:	48 c7 c7 b2 a8 10 80 	mov    $0xffffffff8010a8b2,%rdi
+ffffffff801039ed:	e8 3d cf ff ff       	call   ffffffff8010092f <panic>
+
+  acquire(&idelock);  //DOC:acquire-lock
+ffffffff801039f2:	48 c7 c7 c0 25 11 80 	mov    $0xffffffff801125c0,%rdi
+ffffffff801039f9:	e8 d1 2f 00 00       	call   ffffffff801069cf <acquire>
+
+  // Append b to idequeue.
+  b->qnext = 0;
+ffffffff801039fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103a02:	48 c7 40 20 00 00 00 	movq   $0x0,0x20(%rax)
+ffffffff80103a09:	00 
+  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+ffffffff80103a0a:	48 c7 45 f8 28 26 11 	movq   $0xffffffff80112628,-0x8(%rbp)
+ffffffff80103a11:	80 
+ffffffff80103a12:	eb 0f                	jmp    ffffffff80103a23 <iderw+0x91>
+ffffffff80103a14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103a18:	48 8b 00             	mov    (%rax),%rax
+ffffffff80103a1b:	48 83 c0 20          	add    $0x20,%rax
+ffffffff80103a1f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80103a23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103a27:	48 8b 00             	mov    (%rax),%rax
+ffffffff80103a2a:	48 85 c0             	test   %rax,%rax
+ffffffff80103a2d:	75 e5                	jne    ffffffff80103a14 <iderw+0x82>
+    ;
+  *pp = b;
+ffffffff80103a2f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103a33:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff80103a37:	48 89 10             	mov    %rdx,(%rax)
+  
+  // Start disk if necessary.
+  if(idequeue == b)
+ffffffff80103a3a:	48 8b 05 e7 eb 00 00 	mov    0xebe7(%rip),%rax        # ffffffff80112628 <idequeue>
+ffffffff80103a41:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+ffffffff80103a45:	75 21                	jne    ffffffff80103a68 <iderw+0xd6>
+    idestart(b);
+ffffffff80103a47:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103a4b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103a4e:	e8 2e fd ff ff       	call   ffffffff80103781 <idestart>
+  
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+ffffffff80103a53:	eb 13                	jmp    ffffffff80103a68 <iderw+0xd6>
+    sleep(b, &idelock);
+ffffffff80103a55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103a59:	48 c7 c6 c0 25 11 80 	mov    $0xffffffff801125c0,%rsi
+ffffffff80103a60:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103a63:	e8 e8 2b 00 00       	call   ffffffff80106650 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+ffffffff80103a68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103a6c:	8b 00                	mov    (%rax),%eax
+ffffffff80103a6e:	83 e0 06             	and    $0x6,%eax
+ffffffff80103a71:	83 f8 02             	cmp    $0x2,%eax
+ffffffff80103a74:	75 df                	jne    ffffffff80103a55 <iderw+0xc3>
+  }
+
+  release(&idelock);
+ffffffff80103a76:	48 c7 c7 c0 25 11 80 	mov    $0xffffffff801125c0,%rdi
+ffffffff80103a7d:	e8 24 30 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff80103a82:	90                   	nop
+ffffffff80103a83:	c9                   	leave
+ffffffff80103a84:	c3                   	ret
+
+ffffffff80103a85 <ioapicread>:
+  uint data;
+};
+
+static uint
+ioapicread(int reg)
+{
+ffffffff80103a85:	55                   	push   %rbp
+ffffffff80103a86:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103a89:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80103a8d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  ioapic->reg = reg;
+ffffffff80103a90:	48 8b 05 a1 eb 00 00 	mov    0xeba1(%rip),%rax        # ffffffff80112638 <ioapic>
+ffffffff80103a97:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80103a9a:	89 10                	mov    %edx,(%rax)
+  return ioapic->data;
+ffffffff80103a9c:	48 8b 05 95 eb 00 00 	mov    0xeb95(%rip),%rax        # ffffffff80112638 <ioapic>
+ffffffff80103aa3:	8b 40 10             	mov    0x10(%rax),%eax
+}
+ffffffff80103aa6:	c9                   	leave
+ffffffff80103aa7:	c3                   	ret
+
+ffffffff80103aa8 <ioapicwrite>:
+
+static void
+ioapicwrite(int reg, uint data)
+{
+ffffffff80103aa8:	55                   	push   %rbp
+ffffffff80103aa9:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103aac:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80103ab0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ffffffff80103ab3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  ioapic->reg = reg;
+ffffffff80103ab6:	48 8b 05 7b eb 00 00 	mov    0xeb7b(%rip),%rax        # ffffffff80112638 <ioapic>
+ffffffff80103abd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80103ac0:	89 10                	mov    %edx,(%rax)
+  ioapic->data = data;
+ffffffff80103ac2:	48 8b 05 6f eb 00 00 	mov    0xeb6f(%rip),%rax        # ffffffff80112638 <ioapic>
+ffffffff80103ac9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+ffffffff80103acc:	89 50 10             	mov    %edx,0x10(%rax)
+}
+ffffffff80103acf:	90                   	nop
+ffffffff80103ad0:	c9                   	leave
+ffffffff80103ad1:	c3                   	ret
+
+ffffffff80103ad2 <ioapicinit>:
+
+void
+ioapicinit(void)
+{
+ffffffff80103ad2:	55                   	push   %rbp
+ffffffff80103ad3:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103ad6:	48 83 ec 10          	sub    $0x10,%rsp
+  int i, id, maxintr;
+
+  if(!ismp)
+ffffffff80103ada:	8b 05 80 f4 00 00    	mov    0xf480(%rip),%eax        # ffffffff80112f60 <ismp>
+ffffffff80103ae0:	85 c0                	test   %eax,%eax
+ffffffff80103ae2:	0f 84 a2 00 00 00    	je     ffffffff80103b8a <ioapicinit+0xb8>
+    return;
+
+  ioapic = (volatile struct ioapic*) IO2V(IOAPIC);
+ffffffff80103ae8:	48 b8 00 00 c0 40 ff 	movabs $0xffffffff40c00000,%rax
+ffffffff80103aef:	ff ff ff 
+ffffffff80103af2:	48 89 05 3f eb 00 00 	mov    %rax,0xeb3f(%rip)        # ffffffff80112638 <ioapic>
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+ffffffff80103af9:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff80103afe:	e8 82 ff ff ff       	call   ffffffff80103a85 <ioapicread>
+ffffffff80103b03:	c1 e8 10             	shr    $0x10,%eax
+ffffffff80103b06:	25 ff 00 00 00       	and    $0xff,%eax
+ffffffff80103b0b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  id = ioapicread(REG_ID) >> 24;
+ffffffff80103b0e:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff80103b13:	e8 6d ff ff ff       	call   ffffffff80103a85 <ioapicread>
+ffffffff80103b18:	c1 e8 18             	shr    $0x18,%eax
+ffffffff80103b1b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if(id != ioapicid)
+ffffffff80103b1e:	0f b6 05 43 f4 00 00 	movzbl 0xf443(%rip),%eax        # ffffffff80112f68 <ioapicid>
+ffffffff80103b25:	0f b6 c0             	movzbl %al,%eax
+ffffffff80103b28:	39 45 f4             	cmp    %eax,-0xc(%rbp)
+ffffffff80103b2b:	74 11                	je     ffffffff80103b3e <ioapicinit+0x6c>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+ffffffff80103b2d:	48 c7 c7 d0 a8 10 80 	mov    $0xffffffff8010a8d0,%rdi
+ffffffff80103b34:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80103b39:	e8 66 ca ff ff       	call   ffffffff801005a4 <cprintf>
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+ffffffff80103b3e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80103b45:	eb 39                	jmp    ffffffff80103b80 <ioapicinit+0xae>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+ffffffff80103b47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103b4a:	83 c0 20             	add    $0x20,%eax
+ffffffff80103b4d:	0d 00 00 01 00       	or     $0x10000,%eax
+ffffffff80103b52:	89 c2                	mov    %eax,%edx
+ffffffff80103b54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103b57:	83 c0 08             	add    $0x8,%eax
+ffffffff80103b5a:	01 c0                	add    %eax,%eax
+ffffffff80103b5c:	89 d6                	mov    %edx,%esi
+ffffffff80103b5e:	89 c7                	mov    %eax,%edi
+ffffffff80103b60:	e8 43 ff ff ff       	call   ffffffff80103aa8 <ioapicwrite>
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+ffffffff80103b65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103b68:	83 c0 08             	add    $0x8,%eax
+ffffffff80103b6b:	01 c0                	add    %eax,%eax
+ffffffff80103b6d:	83 c0 01             	add    $0x1,%eax
+ffffffff80103b70:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80103b75:	89 c7                	mov    %eax,%edi
+ffffffff80103b77:	e8 2c ff ff ff       	call   ffffffff80103aa8 <ioapicwrite>
+  for(i = 0; i <= maxintr; i++){
+ffffffff80103b7c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80103b80:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103b83:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+ffffffff80103b86:	7e bf                	jle    ffffffff80103b47 <ioapicinit+0x75>
+ffffffff80103b88:	eb 01                	jmp    ffffffff80103b8b <ioapicinit+0xb9>
+    return;
+ffffffff80103b8a:	90                   	nop
+  }
+}
+ffffffff80103b8b:	c9                   	leave
+ffffffff80103b8c:	c3                   	ret
+
+ffffffff80103b8d <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+ffffffff80103b8d:	55                   	push   %rbp
+ffffffff80103b8e:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103b91:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80103b95:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ffffffff80103b98:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  if(!ismp)
+ffffffff80103b9b:	8b 05 bf f3 00 00    	mov    0xf3bf(%rip),%eax        # ffffffff80112f60 <ismp>
+ffffffff80103ba1:	85 c0                	test   %eax,%eax
+ffffffff80103ba3:	74 37                	je     ffffffff80103bdc <ioapicenable+0x4f>
+    return;
+
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+ffffffff80103ba5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103ba8:	83 c0 20             	add    $0x20,%eax
+ffffffff80103bab:	89 c2                	mov    %eax,%edx
+ffffffff80103bad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103bb0:	83 c0 08             	add    $0x8,%eax
+ffffffff80103bb3:	01 c0                	add    %eax,%eax
+ffffffff80103bb5:	89 d6                	mov    %edx,%esi
+ffffffff80103bb7:	89 c7                	mov    %eax,%edi
+ffffffff80103bb9:	e8 ea fe ff ff       	call   ffffffff80103aa8 <ioapicwrite>
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+ffffffff80103bbe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80103bc1:	c1 e0 18             	shl    $0x18,%eax
+ffffffff80103bc4:	89 c2                	mov    %eax,%edx
+ffffffff80103bc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103bc9:	83 c0 08             	add    $0x8,%eax
+ffffffff80103bcc:	01 c0                	add    %eax,%eax
+ffffffff80103bce:	83 c0 01             	add    $0x1,%eax
+ffffffff80103bd1:	89 d6                	mov    %edx,%esi
+ffffffff80103bd3:	89 c7                	mov    %eax,%edi
+ffffffff80103bd5:	e8 ce fe ff ff       	call   ffffffff80103aa8 <ioapicwrite>
+ffffffff80103bda:	eb 01                	jmp    ffffffff80103bdd <ioapicenable+0x50>
+    return;
+ffffffff80103bdc:	90                   	nop
+}
+ffffffff80103bdd:	c9                   	leave
+ffffffff80103bde:	c3                   	ret
+
+ffffffff80103bdf <v2p>:
+#endif
+#define KERNLINK (KERNBASE+EXTMEM)  // Address where kernel is linked
+
+#ifndef __ASSEMBLER__
+
+static inline uintp v2p(void *a) { return ((uintp) (a)) - ((uintp)KERNBASE); }
+ffffffff80103bdf:	55                   	push   %rbp
+ffffffff80103be0:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103be3:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80103be7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80103beb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103bef:	ba 00 00 00 80       	mov    $0x80000000,%edx
+ffffffff80103bf4:	48 01 d0             	add    %rdx,%rax
+ffffffff80103bf7:	c9                   	leave
+ffffffff80103bf8:	c3                   	ret
+
+ffffffff80103bf9 <kinit1>:
+// the pages mapped by entrypgdir on free list.
+// 2. main() calls kinit2() with the rest of the physical pages
+// after installing a full page table that maps them on all cores.
+void
+kinit1(void *vstart, void *vend)
+{
+ffffffff80103bf9:	55                   	push   %rbp
+ffffffff80103bfa:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103bfd:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80103c01:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80103c05:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  initlock(&kmem.lock, "kmem");
+ffffffff80103c09:	48 c7 c6 02 a9 10 80 	mov    $0xffffffff8010a902,%rsi
+ffffffff80103c10:	48 c7 c7 40 26 11 80 	mov    $0xffffffff80112640,%rdi
+ffffffff80103c17:	e8 7e 2d 00 00       	call   ffffffff8010699a <initlock>
+  kmem.use_lock = 0;
+ffffffff80103c1c:	c7 05 82 ea 00 00 00 	movl   $0x0,0xea82(%rip)        # ffffffff801126a8 <kmem+0x68>
+ffffffff80103c23:	00 00 00 
+  freerange(vstart, vend);
+ffffffff80103c26:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff80103c2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103c2e:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80103c31:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103c34:	e8 33 00 00 00       	call   ffffffff80103c6c <freerange>
+}
+ffffffff80103c39:	90                   	nop
+ffffffff80103c3a:	c9                   	leave
+ffffffff80103c3b:	c3                   	ret
+
+ffffffff80103c3c <kinit2>:
+
+void
+kinit2(void *vstart, void *vend)
+{
+ffffffff80103c3c:	55                   	push   %rbp
+ffffffff80103c3d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103c40:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80103c44:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80103c48:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  freerange(vstart, vend);
+ffffffff80103c4c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff80103c50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103c54:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80103c57:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103c5a:	e8 0d 00 00 00       	call   ffffffff80103c6c <freerange>
+  kmem.use_lock = 1;
+ffffffff80103c5f:	c7 05 3f ea 00 00 01 	movl   $0x1,0xea3f(%rip)        # ffffffff801126a8 <kmem+0x68>
+ffffffff80103c66:	00 00 00 
+}
+ffffffff80103c69:	90                   	nop
+ffffffff80103c6a:	c9                   	leave
+ffffffff80103c6b:	c3                   	ret
+
+ffffffff80103c6c <freerange>:
+
+void
+freerange(void *vstart, void *vend)
+{
+ffffffff80103c6c:	55                   	push   %rbp
+ffffffff80103c6d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103c70:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80103c74:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80103c78:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *p;
+  p = (char*)PGROUNDUP((uintp)vstart);
+ffffffff80103c7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103c80:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+ffffffff80103c86:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff80103c8c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+ffffffff80103c90:	eb 14                	jmp    ffffffff80103ca6 <freerange+0x3a>
+    kfree(p);
+ffffffff80103c92:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103c96:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103c99:	e8 1c 00 00 00       	call   ffffffff80103cba <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+ffffffff80103c9e:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+ffffffff80103ca5:	00 
+ffffffff80103ca6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103caa:	48 05 00 10 00 00    	add    $0x1000,%rax
+ffffffff80103cb0:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+ffffffff80103cb4:	73 dc                	jae    ffffffff80103c92 <freerange+0x26>
+}
+ffffffff80103cb6:	90                   	nop
+ffffffff80103cb7:	90                   	nop
+ffffffff80103cb8:	c9                   	leave
+ffffffff80103cb9:	c3                   	ret
+
+ffffffff80103cba <kfree>:
+// which normally should have been returned by a
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+void
+kfree(char *v)
+{
+ffffffff80103cba:	55                   	push   %rbp
+ffffffff80103cbb:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103cbe:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80103cc2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct run *r;
+
+  if((uintp)v % PGSIZE || v < end || v2p(v) >= PHYSTOP)
+ffffffff80103cc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103cca:	25 ff 0f 00 00       	and    $0xfff,%eax
+ffffffff80103ccf:	48 85 c0             	test   %rax,%rax
+ffffffff80103cd2:	75 1e                	jne    ffffffff80103cf2 <kfree+0x38>
+ffffffff80103cd4:	48 81 7d e8 00 80 11 	cmpq   $0xffffffff80118000,-0x18(%rbp)
+ffffffff80103cdb:	80 
+ffffffff80103cdc:	72 14                	jb     ffffffff80103cf2 <kfree+0x38>
+ffffffff80103cde:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103ce2:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103ce5:	e8 f5 fe ff ff       	call   ffffffff80103bdf <v2p>
+ffffffff80103cea:	48 3d ff ff ff 0d    	cmp    $0xdffffff,%rax
+ffffffff80103cf0:	76 0c                	jbe    ffffffff80103cfe <kfree+0x44>
+    panic("kfree");
+ffffffff80103cf2:	48 c7 c7 07 a9 10 80 	mov    $0xffffffff8010a907,%rdi
+ffffffff80103cf9:	e8 31 cc ff ff       	call   ffffffff8010092f <panic>
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE);
+ffffffff80103cfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103d02:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff80103d07:	be 01 00 00 00       	mov    $0x1,%esi
+ffffffff80103d0c:	48 89 c7             	mov    %rax,%rdi
+ffffffff80103d0f:	e8 2b 30 00 00       	call   ffffffff80106d3f <memset>
+
+  if(kmem.use_lock)
+ffffffff80103d14:	8b 05 8e e9 00 00    	mov    0xe98e(%rip),%eax        # ffffffff801126a8 <kmem+0x68>
+ffffffff80103d1a:	85 c0                	test   %eax,%eax
+ffffffff80103d1c:	74 0c                	je     ffffffff80103d2a <kfree+0x70>
+    acquire(&kmem.lock);
+ffffffff80103d1e:	48 c7 c7 40 26 11 80 	mov    $0xffffffff80112640,%rdi
+ffffffff80103d25:	e8 a5 2c 00 00       	call   ffffffff801069cf <acquire>
+  r = (struct run*)v;
+ffffffff80103d2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80103d2e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  r->next = kmem.freelist;
+ffffffff80103d32:	48 8b 15 77 e9 00 00 	mov    0xe977(%rip),%rdx        # ffffffff801126b0 <kmem+0x70>
+ffffffff80103d39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103d3d:	48 89 10             	mov    %rdx,(%rax)
+  kmem.freelist = r;
+ffffffff80103d40:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103d44:	48 89 05 65 e9 00 00 	mov    %rax,0xe965(%rip)        # ffffffff801126b0 <kmem+0x70>
+  if(kmem.use_lock)
+ffffffff80103d4b:	8b 05 57 e9 00 00    	mov    0xe957(%rip),%eax        # ffffffff801126a8 <kmem+0x68>
+ffffffff80103d51:	85 c0                	test   %eax,%eax
+ffffffff80103d53:	74 0c                	je     ffffffff80103d61 <kfree+0xa7>
+    release(&kmem.lock);
+ffffffff80103d55:	48 c7 c7 40 26 11 80 	mov    $0xffffffff80112640,%rdi
+ffffffff80103d5c:	e8 45 2d 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff80103d61:	90                   	nop
+ffffffff80103d62:	c9                   	leave
+ffffffff80103d63:	c3                   	ret
+
+ffffffff80103d64 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+ffffffff80103d64:	55                   	push   %rbp
+ffffffff80103d65:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103d68:	48 83 ec 10          	sub    $0x10,%rsp
+  struct run *r;
+
+  if(kmem.use_lock)
+ffffffff80103d6c:	8b 05 36 e9 00 00    	mov    0xe936(%rip),%eax        # ffffffff801126a8 <kmem+0x68>
+ffffffff80103d72:	85 c0                	test   %eax,%eax
+ffffffff80103d74:	74 0c                	je     ffffffff80103d82 <kalloc+0x1e>
+    acquire(&kmem.lock);
+ffffffff80103d76:	48 c7 c7 40 26 11 80 	mov    $0xffffffff80112640,%rdi
+ffffffff80103d7d:	e8 4d 2c 00 00       	call   ffffffff801069cf <acquire>
+  r = kmem.freelist;
+ffffffff80103d82:	48 8b 05 27 e9 00 00 	mov    0xe927(%rip),%rax        # ffffffff801126b0 <kmem+0x70>
+ffffffff80103d89:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(r)
+ffffffff80103d8d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80103d92:	74 0e                	je     ffffffff80103da2 <kalloc+0x3e>
+    kmem.freelist = r->next;
+ffffffff80103d94:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80103d98:	48 8b 00             	mov    (%rax),%rax
+ffffffff80103d9b:	48 89 05 0e e9 00 00 	mov    %rax,0xe90e(%rip)        # ffffffff801126b0 <kmem+0x70>
+  if(kmem.use_lock)
+ffffffff80103da2:	8b 05 00 e9 00 00    	mov    0xe900(%rip),%eax        # ffffffff801126a8 <kmem+0x68>
+ffffffff80103da8:	85 c0                	test   %eax,%eax
+ffffffff80103daa:	74 0c                	je     ffffffff80103db8 <kalloc+0x54>
+    release(&kmem.lock);
+ffffffff80103dac:	48 c7 c7 40 26 11 80 	mov    $0xffffffff80112640,%rdi
+ffffffff80103db3:	e8 ee 2c 00 00       	call   ffffffff80106aa6 <release>
+  return (char*)r;
+ffffffff80103db8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80103dbc:	c9                   	leave
+ffffffff80103dbd:	c3                   	ret
+
+ffffffff80103dbe <inb>:
+{
+ffffffff80103dbe:	55                   	push   %rbp
+ffffffff80103dbf:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103dc2:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff80103dc6:	89 f8                	mov    %edi,%eax
+ffffffff80103dc8:	66 89 45 ec          	mov    %ax,-0x14(%rbp)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+ffffffff80103dcc:	0f b7 45 ec          	movzwl -0x14(%rbp),%eax
+ffffffff80103dd0:	89 c2                	mov    %eax,%edx
+ffffffff80103dd2:	ec                   	in     (%dx),%al
+ffffffff80103dd3:	88 45 ff             	mov    %al,-0x1(%rbp)
+  return data;
+ffffffff80103dd6:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+}
+ffffffff80103dda:	c9                   	leave
+ffffffff80103ddb:	c3                   	ret
+
+ffffffff80103ddc <kbdgetc>:
+#include "defs.h"
+#include "kbd.h"
+
+int
+kbdgetc(void)
+{
+ffffffff80103ddc:	55                   	push   %rbp
+ffffffff80103ddd:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103de0:	48 83 ec 10          	sub    $0x10,%rsp
+  static uchar *charcode[4] = {
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+ffffffff80103de4:	bf 64 00 00 00       	mov    $0x64,%edi
+ffffffff80103de9:	e8 d0 ff ff ff       	call   ffffffff80103dbe <inb>
+ffffffff80103dee:	0f b6 c0             	movzbl %al,%eax
+ffffffff80103df1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if((st & KBS_DIB) == 0)
+ffffffff80103df4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80103df7:	83 e0 01             	and    $0x1,%eax
+ffffffff80103dfa:	85 c0                	test   %eax,%eax
+ffffffff80103dfc:	75 0a                	jne    ffffffff80103e08 <kbdgetc+0x2c>
+    return -1;
+ffffffff80103dfe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80103e03:	e9 32 01 00 00       	jmp    ffffffff80103f3a <kbdgetc+0x15e>
+  data = inb(KBDATAP);
+ffffffff80103e08:	bf 60 00 00 00       	mov    $0x60,%edi
+ffffffff80103e0d:	e8 ac ff ff ff       	call   ffffffff80103dbe <inb>
+ffffffff80103e12:	0f b6 c0             	movzbl %al,%eax
+ffffffff80103e15:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  if(data == 0xE0){
+ffffffff80103e18:	81 7d fc e0 00 00 00 	cmpl   $0xe0,-0x4(%rbp)
+ffffffff80103e1f:	75 19                	jne    ffffffff80103e3a <kbdgetc+0x5e>
+    shift |= E0ESC;
+ffffffff80103e21:	8b 05 91 e8 00 00    	mov    0xe891(%rip),%eax        # ffffffff801126b8 <shift.1>
+ffffffff80103e27:	83 c8 40             	or     $0x40,%eax
+ffffffff80103e2a:	89 05 88 e8 00 00    	mov    %eax,0xe888(%rip)        # ffffffff801126b8 <shift.1>
+    return 0;
+ffffffff80103e30:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80103e35:	e9 00 01 00 00       	jmp    ffffffff80103f3a <kbdgetc+0x15e>
+  } else if(data & 0x80){
+ffffffff80103e3a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103e3d:	25 80 00 00 00       	and    $0x80,%eax
+ffffffff80103e42:	85 c0                	test   %eax,%eax
+ffffffff80103e44:	74 47                	je     ffffffff80103e8d <kbdgetc+0xb1>
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+ffffffff80103e46:	8b 05 6c e8 00 00    	mov    0xe86c(%rip),%eax        # ffffffff801126b8 <shift.1>
+ffffffff80103e4c:	83 e0 40             	and    $0x40,%eax
+ffffffff80103e4f:	85 c0                	test   %eax,%eax
+ffffffff80103e51:	75 08                	jne    ffffffff80103e5b <kbdgetc+0x7f>
+ffffffff80103e53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103e56:	83 e0 7f             	and    $0x7f,%eax
+ffffffff80103e59:	eb 03                	jmp    ffffffff80103e5e <kbdgetc+0x82>
+ffffffff80103e5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103e5e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    shift &= ~(shiftcode[data] | E0ESC);
+ffffffff80103e61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103e64:	0f b6 80 20 b0 10 80 	movzbl -0x7fef4fe0(%rax),%eax
+ffffffff80103e6b:	83 c8 40             	or     $0x40,%eax
+ffffffff80103e6e:	0f b6 c0             	movzbl %al,%eax
+ffffffff80103e71:	f7 d0                	not    %eax
+ffffffff80103e73:	89 c2                	mov    %eax,%edx
+ffffffff80103e75:	8b 05 3d e8 00 00    	mov    0xe83d(%rip),%eax        # ffffffff801126b8 <shift.1>
+ffffffff80103e7b:	21 d0                	and    %edx,%eax
+ffffffff80103e7d:	89 05 35 e8 00 00    	mov    %eax,0xe835(%rip)        # ffffffff801126b8 <shift.1>
+    return 0;
+ffffffff80103e83:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80103e88:	e9 ad 00 00 00       	jmp    ffffffff80103f3a <kbdgetc+0x15e>
+  } else if(shift & E0ESC){
+ffffffff80103e8d:	8b 05 25 e8 00 00    	mov    0xe825(%rip),%eax        # ffffffff801126b8 <shift.1>
+ffffffff80103e93:	83 e0 40             	and    $0x40,%eax
+ffffffff80103e96:	85 c0                	test   %eax,%eax
+ffffffff80103e98:	74 16                	je     ffffffff80103eb0 <kbdgetc+0xd4>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+ffffffff80103e9a:	81 4d fc 80 00 00 00 	orl    $0x80,-0x4(%rbp)
+    shift &= ~E0ESC;
+ffffffff80103ea1:	8b 05 11 e8 00 00    	mov    0xe811(%rip),%eax        # ffffffff801126b8 <shift.1>
+ffffffff80103ea7:	83 e0 bf             	and    $0xffffffbf,%eax
+ffffffff80103eaa:	89 05 08 e8 00 00    	mov    %eax,0xe808(%rip)        # ffffffff801126b8 <shift.1>
+  }
+
+  shift |= shiftcode[data];
+ffffffff80103eb0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103eb3:	0f b6 80 20 b0 10 80 	movzbl -0x7fef4fe0(%rax),%eax
+ffffffff80103eba:	0f b6 d0             	movzbl %al,%edx
+ffffffff80103ebd:	8b 05 f5 e7 00 00    	mov    0xe7f5(%rip),%eax        # ffffffff801126b8 <shift.1>
+ffffffff80103ec3:	09 d0                	or     %edx,%eax
+ffffffff80103ec5:	89 05 ed e7 00 00    	mov    %eax,0xe7ed(%rip)        # ffffffff801126b8 <shift.1>
+  shift ^= togglecode[data];
+ffffffff80103ecb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103ece:	0f b6 80 20 b1 10 80 	movzbl -0x7fef4ee0(%rax),%eax
+ffffffff80103ed5:	0f b6 d0             	movzbl %al,%edx
+ffffffff80103ed8:	8b 05 da e7 00 00    	mov    0xe7da(%rip),%eax        # ffffffff801126b8 <shift.1>
+ffffffff80103ede:	31 d0                	xor    %edx,%eax
+ffffffff80103ee0:	89 05 d2 e7 00 00    	mov    %eax,0xe7d2(%rip)        # ffffffff801126b8 <shift.1>
+  c = charcode[shift & (CTL | SHIFT)][data];
+ffffffff80103ee6:	8b 05 cc e7 00 00    	mov    0xe7cc(%rip),%eax        # ffffffff801126b8 <shift.1>
+ffffffff80103eec:	83 e0 03             	and    $0x3,%eax
+ffffffff80103eef:	89 c0                	mov    %eax,%eax
+ffffffff80103ef1:	48 8b 14 c5 20 b5 10 	mov    -0x7fef4ae0(,%rax,8),%rdx
+ffffffff80103ef8:	80 
+ffffffff80103ef9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80103efc:	48 01 d0             	add    %rdx,%rax
+ffffffff80103eff:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80103f02:	0f b6 c0             	movzbl %al,%eax
+ffffffff80103f05:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if(shift & CAPSLOCK){
+ffffffff80103f08:	8b 05 aa e7 00 00    	mov    0xe7aa(%rip),%eax        # ffffffff801126b8 <shift.1>
+ffffffff80103f0e:	83 e0 08             	and    $0x8,%eax
+ffffffff80103f11:	85 c0                	test   %eax,%eax
+ffffffff80103f13:	74 22                	je     ffffffff80103f37 <kbdgetc+0x15b>
+    if('a' <= c && c <= 'z')
+ffffffff80103f15:	83 7d f8 60          	cmpl   $0x60,-0x8(%rbp)
+ffffffff80103f19:	76 0c                	jbe    ffffffff80103f27 <kbdgetc+0x14b>
+ffffffff80103f1b:	83 7d f8 7a          	cmpl   $0x7a,-0x8(%rbp)
+ffffffff80103f1f:	77 06                	ja     ffffffff80103f27 <kbdgetc+0x14b>
+      c += 'A' - 'a';
+ffffffff80103f21:	83 6d f8 20          	subl   $0x20,-0x8(%rbp)
+ffffffff80103f25:	eb 10                	jmp    ffffffff80103f37 <kbdgetc+0x15b>
+    else if('A' <= c && c <= 'Z')
+ffffffff80103f27:	83 7d f8 40          	cmpl   $0x40,-0x8(%rbp)
+ffffffff80103f2b:	76 0a                	jbe    ffffffff80103f37 <kbdgetc+0x15b>
+ffffffff80103f2d:	83 7d f8 5a          	cmpl   $0x5a,-0x8(%rbp)
+ffffffff80103f31:	77 04                	ja     ffffffff80103f37 <kbdgetc+0x15b>
+      c += 'a' - 'A';
+ffffffff80103f33:	83 45 f8 20          	addl   $0x20,-0x8(%rbp)
+  }
+  return c;
+ffffffff80103f37:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ffffffff80103f3a:	c9                   	leave
+ffffffff80103f3b:	c3                   	ret
+
+ffffffff80103f3c <kbdintr>:
+
+void
+kbdintr(void)
+{
+ffffffff80103f3c:	55                   	push   %rbp
+ffffffff80103f3d:	48 89 e5             	mov    %rsp,%rbp
+  consoleintr(kbdgetc);
+ffffffff80103f40:	48 c7 c7 dc 3d 10 80 	mov    $0xffffffff80103ddc,%rdi
+ffffffff80103f47:	e8 77 cc ff ff       	call   ffffffff80100bc3 <consoleintr>
+}
+ffffffff80103f4c:	90                   	nop
+ffffffff80103f4d:	5d                   	pop    %rbp
+ffffffff80103f4e:	c3                   	ret
+
+ffffffff80103f4f <inb>:
+{
+ffffffff80103f4f:	55                   	push   %rbp
+ffffffff80103f50:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103f53:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff80103f57:	89 f8                	mov    %edi,%eax
+ffffffff80103f59:	66 89 45 ec          	mov    %ax,-0x14(%rbp)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+ffffffff80103f5d:	0f b7 45 ec          	movzwl -0x14(%rbp),%eax
+ffffffff80103f61:	89 c2                	mov    %eax,%edx
+ffffffff80103f63:	ec                   	in     (%dx),%al
+ffffffff80103f64:	88 45 ff             	mov    %al,-0x1(%rbp)
+  return data;
+ffffffff80103f67:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+}
+ffffffff80103f6b:	c9                   	leave
+ffffffff80103f6c:	c3                   	ret
+
+ffffffff80103f6d <outb>:
+{
+ffffffff80103f6d:	55                   	push   %rbp
+ffffffff80103f6e:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103f71:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80103f75:	89 fa                	mov    %edi,%edx
+ffffffff80103f77:	89 f0                	mov    %esi,%eax
+ffffffff80103f79:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+ffffffff80103f7d:	88 45 f8             	mov    %al,-0x8(%rbp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+ffffffff80103f80:	0f b6 45 f8          	movzbl -0x8(%rbp),%eax
+ffffffff80103f84:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+ffffffff80103f88:	ee                   	out    %al,(%dx)
+}
+ffffffff80103f89:	90                   	nop
+ffffffff80103f8a:	c9                   	leave
+ffffffff80103f8b:	c3                   	ret
+
+ffffffff80103f8c <readeflags>:
+{
+ffffffff80103f8c:	55                   	push   %rbp
+ffffffff80103f8d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103f90:	48 83 ec 10          	sub    $0x10,%rsp
+  asm volatile("pushf; pop %0" : "=r" (eflags));
+ffffffff80103f94:	9c                   	pushf
+ffffffff80103f95:	58                   	pop    %rax
+ffffffff80103f96:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  return eflags;
+ffffffff80103f9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80103f9e:	c9                   	leave
+ffffffff80103f9f:	c3                   	ret
+
+ffffffff80103fa0 <lapicw>:
+
+volatile uint *lapic;  // Initialized in mp.c
+
+static void
+lapicw(int index, int value)
+{
+ffffffff80103fa0:	55                   	push   %rbp
+ffffffff80103fa1:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80103fa4:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80103fa8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ffffffff80103fab:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  lapic[index] = value;
+ffffffff80103fae:	48 8b 05 0b e7 00 00 	mov    0xe70b(%rip),%rax        # ffffffff801126c0 <lapic>
+ffffffff80103fb5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80103fb8:	48 63 d2             	movslq %edx,%rdx
+ffffffff80103fbb:	48 c1 e2 02          	shl    $0x2,%rdx
+ffffffff80103fbf:	48 01 c2             	add    %rax,%rdx
+ffffffff80103fc2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff80103fc5:	89 02                	mov    %eax,(%rdx)
+  lapic[ID];  // wait for write to finish, by reading
+ffffffff80103fc7:	48 8b 05 f2 e6 00 00 	mov    0xe6f2(%rip),%rax        # ffffffff801126c0 <lapic>
+ffffffff80103fce:	48 83 c0 20          	add    $0x20,%rax
+ffffffff80103fd2:	8b 00                	mov    (%rax),%eax
+}
+ffffffff80103fd4:	90                   	nop
+ffffffff80103fd5:	c9                   	leave
+ffffffff80103fd6:	c3                   	ret
+
+ffffffff80103fd7 <lapicinit>:
+//PAGEBREAK!
+
+void
+lapicinit(void)
+{
+ffffffff80103fd7:	55                   	push   %rbp
+ffffffff80103fd8:	48 89 e5             	mov    %rsp,%rbp
+  if(!lapic) 
+ffffffff80103fdb:	48 8b 05 de e6 00 00 	mov    0xe6de(%rip),%rax        # ffffffff801126c0 <lapic>
+ffffffff80103fe2:	48 85 c0             	test   %rax,%rax
+ffffffff80103fe5:	0f 84 06 01 00 00    	je     ffffffff801040f1 <lapicinit+0x11a>
+    return;
+
+  // Enable local APIC; set spurious interrupt vector.
+  lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
+ffffffff80103feb:	be 3f 01 00 00       	mov    $0x13f,%esi
+ffffffff80103ff0:	bf 3c 00 00 00       	mov    $0x3c,%edi
+ffffffff80103ff5:	e8 a6 ff ff ff       	call   ffffffff80103fa0 <lapicw>
+
+  // The timer repeatedly counts down at bus frequency
+  // from lapic[TICR] and then issues an interrupt.  
+  // If xv6 cared more about precise timekeeping,
+  // TICR would be calibrated using an external time source.
+  lapicw(TDCR, X1);
+ffffffff80103ffa:	be 0b 00 00 00       	mov    $0xb,%esi
+ffffffff80103fff:	bf f8 00 00 00       	mov    $0xf8,%edi
+ffffffff80104004:	e8 97 ff ff ff       	call   ffffffff80103fa0 <lapicw>
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+ffffffff80104009:	be 20 00 02 00       	mov    $0x20020,%esi
+ffffffff8010400e:	bf c8 00 00 00       	mov    $0xc8,%edi
+ffffffff80104013:	e8 88 ff ff ff       	call   ffffffff80103fa0 <lapicw>
+  lapicw(TICR, 10000000); 
+ffffffff80104018:	be 80 96 98 00       	mov    $0x989680,%esi
+ffffffff8010401d:	bf e0 00 00 00       	mov    $0xe0,%edi
+ffffffff80104022:	e8 79 ff ff ff       	call   ffffffff80103fa0 <lapicw>
+
+  // Disable logical interrupt lines.
+  lapicw(LINT0, MASKED);
+ffffffff80104027:	be 00 00 01 00       	mov    $0x10000,%esi
+ffffffff8010402c:	bf d4 00 00 00       	mov    $0xd4,%edi
+ffffffff80104031:	e8 6a ff ff ff       	call   ffffffff80103fa0 <lapicw>
+  lapicw(LINT1, MASKED);
+ffffffff80104036:	be 00 00 01 00       	mov    $0x10000,%esi
+ffffffff8010403b:	bf d8 00 00 00       	mov    $0xd8,%edi
+ffffffff80104040:	e8 5b ff ff ff       	call   ffffffff80103fa0 <lapicw>
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+ffffffff80104045:	48 8b 05 74 e6 00 00 	mov    0xe674(%rip),%rax        # ffffffff801126c0 <lapic>
+ffffffff8010404c:	48 83 c0 30          	add    $0x30,%rax
+ffffffff80104050:	8b 00                	mov    (%rax),%eax
+ffffffff80104052:	c1 e8 10             	shr    $0x10,%eax
+ffffffff80104055:	25 fc 00 00 00       	and    $0xfc,%eax
+ffffffff8010405a:	85 c0                	test   %eax,%eax
+ffffffff8010405c:	74 0f                	je     ffffffff8010406d <lapicinit+0x96>
+    lapicw(PCINT, MASKED);
+ffffffff8010405e:	be 00 00 01 00       	mov    $0x10000,%esi
+ffffffff80104063:	bf d0 00 00 00       	mov    $0xd0,%edi
+ffffffff80104068:	e8 33 ff ff ff       	call   ffffffff80103fa0 <lapicw>
+
+  // Map error interrupt to IRQ_ERROR.
+  lapicw(ERROR, T_IRQ0 + IRQ_ERROR);
+ffffffff8010406d:	be 33 00 00 00       	mov    $0x33,%esi
+ffffffff80104072:	bf dc 00 00 00       	mov    $0xdc,%edi
+ffffffff80104077:	e8 24 ff ff ff       	call   ffffffff80103fa0 <lapicw>
+
+  // Clear error status register (requires back-to-back writes).
+  lapicw(ESR, 0);
+ffffffff8010407c:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80104081:	bf a0 00 00 00       	mov    $0xa0,%edi
+ffffffff80104086:	e8 15 ff ff ff       	call   ffffffff80103fa0 <lapicw>
+  lapicw(ESR, 0);
+ffffffff8010408b:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80104090:	bf a0 00 00 00       	mov    $0xa0,%edi
+ffffffff80104095:	e8 06 ff ff ff       	call   ffffffff80103fa0 <lapicw>
+
+  // Ack any outstanding interrupts.
+  lapicw(EOI, 0);
+ffffffff8010409a:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010409f:	bf 2c 00 00 00       	mov    $0x2c,%edi
+ffffffff801040a4:	e8 f7 fe ff ff       	call   ffffffff80103fa0 <lapicw>
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+ffffffff801040a9:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801040ae:	bf c4 00 00 00       	mov    $0xc4,%edi
+ffffffff801040b3:	e8 e8 fe ff ff       	call   ffffffff80103fa0 <lapicw>
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+ffffffff801040b8:	be 00 85 08 00       	mov    $0x88500,%esi
+ffffffff801040bd:	bf c0 00 00 00       	mov    $0xc0,%edi
+ffffffff801040c2:	e8 d9 fe ff ff       	call   ffffffff80103fa0 <lapicw>
+  while(lapic[ICRLO] & DELIVS)
+ffffffff801040c7:	90                   	nop
+ffffffff801040c8:	48 8b 05 f1 e5 00 00 	mov    0xe5f1(%rip),%rax        # ffffffff801126c0 <lapic>
+ffffffff801040cf:	48 05 00 03 00 00    	add    $0x300,%rax
+ffffffff801040d5:	8b 00                	mov    (%rax),%eax
+ffffffff801040d7:	25 00 10 00 00       	and    $0x1000,%eax
+ffffffff801040dc:	85 c0                	test   %eax,%eax
+ffffffff801040de:	75 e8                	jne    ffffffff801040c8 <lapicinit+0xf1>
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+ffffffff801040e0:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801040e5:	bf 20 00 00 00       	mov    $0x20,%edi
+ffffffff801040ea:	e8 b1 fe ff ff       	call   ffffffff80103fa0 <lapicw>
+ffffffff801040ef:	eb 01                	jmp    ffffffff801040f2 <lapicinit+0x11b>
+    return;
+ffffffff801040f1:	90                   	nop
+}
+ffffffff801040f2:	5d                   	pop    %rbp
+ffffffff801040f3:	c3                   	ret
+
+ffffffff801040f4 <cpunum>:
+// This is only used during secondary processor startup.
+// cpu->id is the fast way to get the cpu number, once the
+// processor is fully started.
+int
+cpunum(void)
+{
+ffffffff801040f4:	55                   	push   %rbp
+ffffffff801040f5:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801040f8:	48 83 ec 10          	sub    $0x10,%rsp
+  // Cannot call cpu when interrupts are enabled:
+  // result not guaranteed to last long enough to be used!
+  // Would prefer to panic but even printing is chancy here:
+  // almost everything, including cprintf and panic, calls cpu,
+  // often indirectly through acquire and release.
+  if(readeflags()&FL_IF){
+ffffffff801040fc:	e8 8b fe ff ff       	call   ffffffff80103f8c <readeflags>
+ffffffff80104101:	25 00 02 00 00       	and    $0x200,%eax
+ffffffff80104106:	48 85 c0             	test   %rax,%rax
+ffffffff80104109:	74 2b                	je     ffffffff80104136 <cpunum+0x42>
+    static int n;
+    if(n++ == 0)
+ffffffff8010410b:	8b 05 b7 e5 00 00    	mov    0xe5b7(%rip),%eax        # ffffffff801126c8 <n.0>
+ffffffff80104111:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff80104114:	89 15 ae e5 00 00    	mov    %edx,0xe5ae(%rip)        # ffffffff801126c8 <n.0>
+ffffffff8010411a:	85 c0                	test   %eax,%eax
+ffffffff8010411c:	75 18                	jne    ffffffff80104136 <cpunum+0x42>
+      cprintf("cpu called from %x with interrupts enabled\n",
+ffffffff8010411e:	48 8b 45 08          	mov    0x8(%rbp),%rax
+ffffffff80104122:	48 89 c6             	mov    %rax,%rsi
+ffffffff80104125:	48 c7 c7 10 a9 10 80 	mov    $0xffffffff8010a910,%rdi
+ffffffff8010412c:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80104131:	e8 6e c4 ff ff       	call   ffffffff801005a4 <cprintf>
+        __builtin_return_address(0));
+  }
+
+  if(!lapic)
+ffffffff80104136:	48 8b 05 83 e5 00 00 	mov    0xe583(%rip),%rax        # ffffffff801126c0 <lapic>
+ffffffff8010413d:	48 85 c0             	test   %rax,%rax
+ffffffff80104140:	75 07                	jne    ffffffff80104149 <cpunum+0x55>
+    return 0;
+ffffffff80104142:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80104147:	eb 5a                	jmp    ffffffff801041a3 <cpunum+0xaf>
+
+  id = lapic[ID]>>24;
+ffffffff80104149:	48 8b 05 70 e5 00 00 	mov    0xe570(%rip),%rax        # ffffffff801126c0 <lapic>
+ffffffff80104150:	48 83 c0 20          	add    $0x20,%rax
+ffffffff80104154:	8b 00                	mov    (%rax),%eax
+ffffffff80104156:	c1 e8 18             	shr    $0x18,%eax
+ffffffff80104159:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  for (n = 0; n < ncpu; n++)
+ffffffff8010415c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80104163:	eb 2e                	jmp    ffffffff80104193 <cpunum+0x9f>
+    if (id == cpus[n].apicid)
+ffffffff80104165:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80104168:	48 63 d0             	movslq %eax,%rdx
+ffffffff8010416b:	48 89 d0             	mov    %rdx,%rax
+ffffffff8010416e:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80104172:	48 29 d0             	sub    %rdx,%rax
+ffffffff80104175:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80104179:	48 05 e1 27 11 80    	add    $0xffffffff801127e1,%rax
+ffffffff8010417f:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80104182:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104185:	39 45 f8             	cmp    %eax,-0x8(%rbp)
+ffffffff80104188:	75 05                	jne    ffffffff8010418f <cpunum+0x9b>
+      return n;
+ffffffff8010418a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010418d:	eb 14                	jmp    ffffffff801041a3 <cpunum+0xaf>
+  for (n = 0; n < ncpu; n++)
+ffffffff8010418f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80104193:	8b 05 cb ed 00 00    	mov    0xedcb(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff80104199:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+ffffffff8010419c:	7c c7                	jl     ffffffff80104165 <cpunum+0x71>
+
+  return 0;
+ffffffff8010419e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801041a3:	c9                   	leave
+ffffffff801041a4:	c3                   	ret
+
+ffffffff801041a5 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+ffffffff801041a5:	55                   	push   %rbp
+ffffffff801041a6:	48 89 e5             	mov    %rsp,%rbp
+  if(lapic)
+ffffffff801041a9:	48 8b 05 10 e5 00 00 	mov    0xe510(%rip),%rax        # ffffffff801126c0 <lapic>
+ffffffff801041b0:	48 85 c0             	test   %rax,%rax
+ffffffff801041b3:	74 0f                	je     ffffffff801041c4 <lapiceoi+0x1f>
+    lapicw(EOI, 0);
+ffffffff801041b5:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801041ba:	bf 2c 00 00 00       	mov    $0x2c,%edi
+ffffffff801041bf:	e8 dc fd ff ff       	call   ffffffff80103fa0 <lapicw>
+}
+ffffffff801041c4:	90                   	nop
+ffffffff801041c5:	5d                   	pop    %rbp
+ffffffff801041c6:	c3                   	ret
+
+ffffffff801041c7 <microdelay>:
+
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+ffffffff801041c7:	55                   	push   %rbp
+ffffffff801041c8:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801041cb:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff801041cf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+}
+ffffffff801041d2:	90                   	nop
+ffffffff801041d3:	c9                   	leave
+ffffffff801041d4:	c3                   	ret
+
+ffffffff801041d5 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+ffffffff801041d5:	55                   	push   %rbp
+ffffffff801041d6:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801041d9:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff801041dd:	89 f8                	mov    %edi,%eax
+ffffffff801041df:	89 75 e8             	mov    %esi,-0x18(%rbp)
+ffffffff801041e2:	88 45 ec             	mov    %al,-0x14(%rbp)
+  ushort *wrv;
+  
+  // "The BSP must initialize CMOS shutdown code to 0AH
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+ffffffff801041e5:	be 0f 00 00 00       	mov    $0xf,%esi
+ffffffff801041ea:	bf 70 00 00 00       	mov    $0x70,%edi
+ffffffff801041ef:	e8 79 fd ff ff       	call   ffffffff80103f6d <outb>
+  outb(CMOS_PORT+1, 0x0A);
+ffffffff801041f4:	be 0a 00 00 00       	mov    $0xa,%esi
+ffffffff801041f9:	bf 71 00 00 00       	mov    $0x71,%edi
+ffffffff801041fe:	e8 6a fd ff ff       	call   ffffffff80103f6d <outb>
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+ffffffff80104203:	48 c7 45 f0 67 04 00 	movq   $0xffffffff80000467,-0x10(%rbp)
+ffffffff8010420a:	80 
+  wrv[0] = 0;
+ffffffff8010420b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010420f:	66 c7 00 00 00       	movw   $0x0,(%rax)
+  wrv[1] = addr >> 4;
+ffffffff80104214:	8b 45 e8             	mov    -0x18(%rbp),%eax
+ffffffff80104217:	c1 e8 04             	shr    $0x4,%eax
+ffffffff8010421a:	89 c2                	mov    %eax,%edx
+ffffffff8010421c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104220:	48 83 c0 02          	add    $0x2,%rax
+ffffffff80104224:	66 89 10             	mov    %dx,(%rax)
+
+  // "Universal startup algorithm."
+  // Send INIT (level-triggered) interrupt to reset other CPU.
+  lapicw(ICRHI, apicid<<24);
+ffffffff80104227:	0f b6 45 ec          	movzbl -0x14(%rbp),%eax
+ffffffff8010422b:	c1 e0 18             	shl    $0x18,%eax
+ffffffff8010422e:	89 c6                	mov    %eax,%esi
+ffffffff80104230:	bf c4 00 00 00       	mov    $0xc4,%edi
+ffffffff80104235:	e8 66 fd ff ff       	call   ffffffff80103fa0 <lapicw>
+  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+ffffffff8010423a:	be 00 c5 00 00       	mov    $0xc500,%esi
+ffffffff8010423f:	bf c0 00 00 00       	mov    $0xc0,%edi
+ffffffff80104244:	e8 57 fd ff ff       	call   ffffffff80103fa0 <lapicw>
+  microdelay(200);
+ffffffff80104249:	bf c8 00 00 00       	mov    $0xc8,%edi
+ffffffff8010424e:	e8 74 ff ff ff       	call   ffffffff801041c7 <microdelay>
+  lapicw(ICRLO, INIT | LEVEL);
+ffffffff80104253:	be 00 85 00 00       	mov    $0x8500,%esi
+ffffffff80104258:	bf c0 00 00 00       	mov    $0xc0,%edi
+ffffffff8010425d:	e8 3e fd ff ff       	call   ffffffff80103fa0 <lapicw>
+  microdelay(10000);
+ffffffff80104262:	bf 10 27 00 00       	mov    $0x2710,%edi
+ffffffff80104267:	e8 5b ff ff ff       	call   ffffffff801041c7 <microdelay>
+  
+  // Send startup IPI (twice!) to enter code.
+  // Regular hardware is supposed to only accept a STARTUP
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  for(i = 0; i < 2; i++){
+ffffffff8010426c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80104273:	eb 36                	jmp    ffffffff801042ab <lapicstartap+0xd6>
+    lapicw(ICRHI, apicid<<24);
+ffffffff80104275:	0f b6 45 ec          	movzbl -0x14(%rbp),%eax
+ffffffff80104279:	c1 e0 18             	shl    $0x18,%eax
+ffffffff8010427c:	89 c6                	mov    %eax,%esi
+ffffffff8010427e:	bf c4 00 00 00       	mov    $0xc4,%edi
+ffffffff80104283:	e8 18 fd ff ff       	call   ffffffff80103fa0 <lapicw>
+    lapicw(ICRLO, STARTUP | (addr>>12));
+ffffffff80104288:	8b 45 e8             	mov    -0x18(%rbp),%eax
+ffffffff8010428b:	c1 e8 0c             	shr    $0xc,%eax
+ffffffff8010428e:	80 cc 06             	or     $0x6,%ah
+ffffffff80104291:	89 c6                	mov    %eax,%esi
+ffffffff80104293:	bf c0 00 00 00       	mov    $0xc0,%edi
+ffffffff80104298:	e8 03 fd ff ff       	call   ffffffff80103fa0 <lapicw>
+    microdelay(200);
+ffffffff8010429d:	bf c8 00 00 00       	mov    $0xc8,%edi
+ffffffff801042a2:	e8 20 ff ff ff       	call   ffffffff801041c7 <microdelay>
+  for(i = 0; i < 2; i++){
+ffffffff801042a7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff801042ab:	83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+ffffffff801042af:	7e c4                	jle    ffffffff80104275 <lapicstartap+0xa0>
+  }
+}
+ffffffff801042b1:	90                   	nop
+ffffffff801042b2:	90                   	nop
+ffffffff801042b3:	c9                   	leave
+ffffffff801042b4:	c3                   	ret
+
+ffffffff801042b5 <cmos_read>:
+#define DAY     0x07
+#define MONTH   0x08
+#define YEAR    0x09
+
+static uint cmos_read(uint reg)
+{
+ffffffff801042b5:	55                   	push   %rbp
+ffffffff801042b6:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801042b9:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff801042bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  outb(CMOS_PORT,  reg);
+ffffffff801042c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801042c3:	0f b6 c0             	movzbl %al,%eax
+ffffffff801042c6:	89 c6                	mov    %eax,%esi
+ffffffff801042c8:	bf 70 00 00 00       	mov    $0x70,%edi
+ffffffff801042cd:	e8 9b fc ff ff       	call   ffffffff80103f6d <outb>
+  microdelay(200);
+ffffffff801042d2:	bf c8 00 00 00       	mov    $0xc8,%edi
+ffffffff801042d7:	e8 eb fe ff ff       	call   ffffffff801041c7 <microdelay>
+
+  return inb(CMOS_RETURN);
+ffffffff801042dc:	bf 71 00 00 00       	mov    $0x71,%edi
+ffffffff801042e1:	e8 69 fc ff ff       	call   ffffffff80103f4f <inb>
+ffffffff801042e6:	0f b6 c0             	movzbl %al,%eax
+}
+ffffffff801042e9:	c9                   	leave
+ffffffff801042ea:	c3                   	ret
+
+ffffffff801042eb <fill_rtcdate>:
+
+static void fill_rtcdate(struct rtcdate *r)
+{
+ffffffff801042eb:	55                   	push   %rbp
+ffffffff801042ec:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801042ef:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff801042f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  r->second = cmos_read(SECS);
+ffffffff801042f7:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff801042fc:	e8 b4 ff ff ff       	call   ffffffff801042b5 <cmos_read>
+ffffffff80104301:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80104305:	89 02                	mov    %eax,(%rdx)
+  r->minute = cmos_read(MINS);
+ffffffff80104307:	bf 02 00 00 00       	mov    $0x2,%edi
+ffffffff8010430c:	e8 a4 ff ff ff       	call   ffffffff801042b5 <cmos_read>
+ffffffff80104311:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80104315:	89 42 04             	mov    %eax,0x4(%rdx)
+  r->hour   = cmos_read(HOURS);
+ffffffff80104318:	bf 04 00 00 00       	mov    $0x4,%edi
+ffffffff8010431d:	e8 93 ff ff ff       	call   ffffffff801042b5 <cmos_read>
+ffffffff80104322:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80104326:	89 42 08             	mov    %eax,0x8(%rdx)
+  r->day    = cmos_read(DAY);
+ffffffff80104329:	bf 07 00 00 00       	mov    $0x7,%edi
+ffffffff8010432e:	e8 82 ff ff ff       	call   ffffffff801042b5 <cmos_read>
+ffffffff80104333:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80104337:	89 42 0c             	mov    %eax,0xc(%rdx)
+  r->month  = cmos_read(MONTH);
+ffffffff8010433a:	bf 08 00 00 00       	mov    $0x8,%edi
+ffffffff8010433f:	e8 71 ff ff ff       	call   ffffffff801042b5 <cmos_read>
+ffffffff80104344:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80104348:	89 42 10             	mov    %eax,0x10(%rdx)
+  r->year   = cmos_read(YEAR);
+ffffffff8010434b:	bf 09 00 00 00       	mov    $0x9,%edi
+ffffffff80104350:	e8 60 ff ff ff       	call   ffffffff801042b5 <cmos_read>
+ffffffff80104355:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80104359:	89 42 14             	mov    %eax,0x14(%rdx)
+}
+ffffffff8010435c:	90                   	nop
+ffffffff8010435d:	c9                   	leave
+ffffffff8010435e:	c3                   	ret
+
+ffffffff8010435f <cmostime>:
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void cmostime(struct rtcdate *r)
+{
+ffffffff8010435f:	55                   	push   %rbp
+ffffffff80104360:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104363:	48 83 ec 50          	sub    $0x50,%rsp
+ffffffff80104367:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+ffffffff8010436b:	bf 0b 00 00 00       	mov    $0xb,%edi
+ffffffff80104370:	e8 40 ff ff ff       	call   ffffffff801042b5 <cmos_read>
+ffffffff80104375:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+  bcd = (sb & (1 << 2)) == 0;
+ffffffff80104378:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010437b:	83 e0 04             	and    $0x4,%eax
+ffffffff8010437e:	85 c0                	test   %eax,%eax
+ffffffff80104380:	0f 94 c0             	sete   %al
+ffffffff80104383:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104386:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  // make sure CMOS doesn't modify time while we read it
+  for (;;) {
+    fill_rtcdate(&t1);
+ffffffff80104389:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+ffffffff8010438d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104390:	e8 56 ff ff ff       	call   ffffffff801042eb <fill_rtcdate>
+    if (cmos_read(CMOS_STATA) & CMOS_UIP)
+ffffffff80104395:	bf 0a 00 00 00       	mov    $0xa,%edi
+ffffffff8010439a:	e8 16 ff ff ff       	call   ffffffff801042b5 <cmos_read>
+ffffffff8010439f:	25 80 00 00 00       	and    $0x80,%eax
+ffffffff801043a4:	85 c0                	test   %eax,%eax
+ffffffff801043a6:	75 2a                	jne    ffffffff801043d2 <cmostime+0x73>
+        continue;
+    fill_rtcdate(&t2);
+ffffffff801043a8:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+ffffffff801043ac:	48 89 c7             	mov    %rax,%rdi
+ffffffff801043af:	e8 37 ff ff ff       	call   ffffffff801042eb <fill_rtcdate>
+    if (memcmp(&t1, &t2, sizeof(t1)) == 0)
+ffffffff801043b4:	48 8d 4d c0          	lea    -0x40(%rbp),%rcx
+ffffffff801043b8:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+ffffffff801043bc:	ba 18 00 00 00       	mov    $0x18,%edx
+ffffffff801043c1:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801043c4:	48 89 c7             	mov    %rax,%rdi
+ffffffff801043c7:	e8 f3 29 00 00       	call   ffffffff80106dbf <memcmp>
+ffffffff801043cc:	85 c0                	test   %eax,%eax
+ffffffff801043ce:	74 05                	je     ffffffff801043d5 <cmostime+0x76>
+ffffffff801043d0:	eb b7                	jmp    ffffffff80104389 <cmostime+0x2a>
+        continue;
+ffffffff801043d2:	90                   	nop
+    fill_rtcdate(&t1);
+ffffffff801043d3:	eb b4                	jmp    ffffffff80104389 <cmostime+0x2a>
+      break;
+ffffffff801043d5:	90                   	nop
+  }
+
+  // convert
+  if (bcd) {
+ffffffff801043d6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ffffffff801043da:	0f 84 b4 00 00 00    	je     ffffffff80104494 <cmostime+0x135>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+ffffffff801043e0:	8b 45 e0             	mov    -0x20(%rbp),%eax
+ffffffff801043e3:	c1 e8 04             	shr    $0x4,%eax
+ffffffff801043e6:	89 c2                	mov    %eax,%edx
+ffffffff801043e8:	89 d0                	mov    %edx,%eax
+ffffffff801043ea:	c1 e0 02             	shl    $0x2,%eax
+ffffffff801043ed:	01 d0                	add    %edx,%eax
+ffffffff801043ef:	01 c0                	add    %eax,%eax
+ffffffff801043f1:	89 c2                	mov    %eax,%edx
+ffffffff801043f3:	8b 45 e0             	mov    -0x20(%rbp),%eax
+ffffffff801043f6:	83 e0 0f             	and    $0xf,%eax
+ffffffff801043f9:	01 d0                	add    %edx,%eax
+ffffffff801043fb:	89 45 e0             	mov    %eax,-0x20(%rbp)
+    CONV(minute);
+ffffffff801043fe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80104401:	c1 e8 04             	shr    $0x4,%eax
+ffffffff80104404:	89 c2                	mov    %eax,%edx
+ffffffff80104406:	89 d0                	mov    %edx,%eax
+ffffffff80104408:	c1 e0 02             	shl    $0x2,%eax
+ffffffff8010440b:	01 d0                	add    %edx,%eax
+ffffffff8010440d:	01 c0                	add    %eax,%eax
+ffffffff8010440f:	89 c2                	mov    %eax,%edx
+ffffffff80104411:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80104414:	83 e0 0f             	and    $0xf,%eax
+ffffffff80104417:	01 d0                	add    %edx,%eax
+ffffffff80104419:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    CONV(hour  );
+ffffffff8010441c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+ffffffff8010441f:	c1 e8 04             	shr    $0x4,%eax
+ffffffff80104422:	89 c2                	mov    %eax,%edx
+ffffffff80104424:	89 d0                	mov    %edx,%eax
+ffffffff80104426:	c1 e0 02             	shl    $0x2,%eax
+ffffffff80104429:	01 d0                	add    %edx,%eax
+ffffffff8010442b:	01 c0                	add    %eax,%eax
+ffffffff8010442d:	89 c2                	mov    %eax,%edx
+ffffffff8010442f:	8b 45 e8             	mov    -0x18(%rbp),%eax
+ffffffff80104432:	83 e0 0f             	and    $0xf,%eax
+ffffffff80104435:	01 d0                	add    %edx,%eax
+ffffffff80104437:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    CONV(day   );
+ffffffff8010443a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff8010443d:	c1 e8 04             	shr    $0x4,%eax
+ffffffff80104440:	89 c2                	mov    %eax,%edx
+ffffffff80104442:	89 d0                	mov    %edx,%eax
+ffffffff80104444:	c1 e0 02             	shl    $0x2,%eax
+ffffffff80104447:	01 d0                	add    %edx,%eax
+ffffffff80104449:	01 c0                	add    %eax,%eax
+ffffffff8010444b:	89 c2                	mov    %eax,%edx
+ffffffff8010444d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80104450:	83 e0 0f             	and    $0xf,%eax
+ffffffff80104453:	01 d0                	add    %edx,%eax
+ffffffff80104455:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    CONV(month );
+ffffffff80104458:	8b 45 f0             	mov    -0x10(%rbp),%eax
+ffffffff8010445b:	c1 e8 04             	shr    $0x4,%eax
+ffffffff8010445e:	89 c2                	mov    %eax,%edx
+ffffffff80104460:	89 d0                	mov    %edx,%eax
+ffffffff80104462:	c1 e0 02             	shl    $0x2,%eax
+ffffffff80104465:	01 d0                	add    %edx,%eax
+ffffffff80104467:	01 c0                	add    %eax,%eax
+ffffffff80104469:	89 c2                	mov    %eax,%edx
+ffffffff8010446b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+ffffffff8010446e:	83 e0 0f             	and    $0xf,%eax
+ffffffff80104471:	01 d0                	add    %edx,%eax
+ffffffff80104473:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    CONV(year  );
+ffffffff80104476:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80104479:	c1 e8 04             	shr    $0x4,%eax
+ffffffff8010447c:	89 c2                	mov    %eax,%edx
+ffffffff8010447e:	89 d0                	mov    %edx,%eax
+ffffffff80104480:	c1 e0 02             	shl    $0x2,%eax
+ffffffff80104483:	01 d0                	add    %edx,%eax
+ffffffff80104485:	01 c0                	add    %eax,%eax
+ffffffff80104487:	89 c2                	mov    %eax,%edx
+ffffffff80104489:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff8010448c:	83 e0 0f             	and    $0xf,%eax
+ffffffff8010448f:	01 d0                	add    %edx,%eax
+ffffffff80104491:	89 45 f4             	mov    %eax,-0xc(%rbp)
+#undef     CONV
+  }
+
+  *r = t1;
+ffffffff80104494:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+ffffffff80104498:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010449c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff801044a0:	48 89 01             	mov    %rax,(%rcx)
+ffffffff801044a3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+ffffffff801044a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801044ab:	48 89 41 10          	mov    %rax,0x10(%rcx)
+  r->year += 2000;
+ffffffff801044af:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff801044b3:	8b 40 14             	mov    0x14(%rax),%eax
+ffffffff801044b6:	8d 90 d0 07 00 00    	lea    0x7d0(%rax),%edx
+ffffffff801044bc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff801044c0:	89 50 14             	mov    %edx,0x14(%rax)
+}
+ffffffff801044c3:	90                   	nop
+ffffffff801044c4:	c9                   	leave
+ffffffff801044c5:	c3                   	ret
+
+ffffffff801044c6 <initlog>:
+static void recover_from_log(void);
+static void commit();
+
+void
+initlog(void)
+{
+ffffffff801044c6:	55                   	push   %rbp
+ffffffff801044c7:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801044ca:	48 83 ec 10          	sub    $0x10,%rsp
+  if (sizeof(struct logheader) >= BSIZE)
+    panic("initlog: too big logheader");
+
+  struct superblock sb;
+  initlock(&log.lock, "log");
+ffffffff801044ce:	48 c7 c6 3c a9 10 80 	mov    $0xffffffff8010a93c,%rsi
+ffffffff801044d5:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff801044dc:	e8 b9 24 00 00       	call   ffffffff8010699a <initlock>
+  readsb(ROOTDEV, &sb);
+ffffffff801044e1:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+ffffffff801044e5:	48 89 c6             	mov    %rax,%rsi
+ffffffff801044e8:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff801044ed:	e8 b8 dd ff ff       	call   ffffffff801022aa <readsb>
+  log.start = sb.size - sb.nlog;
+ffffffff801044f2:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ffffffff801044f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801044f8:	29 c2                	sub    %eax,%edx
+ffffffff801044fa:	89 d0                	mov    %edx,%eax
+ffffffff801044fc:	89 05 46 e2 00 00    	mov    %eax,0xe246(%rip)        # ffffffff80112748 <log+0x68>
+  log.size = sb.nlog;
+ffffffff80104502:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80104505:	89 05 41 e2 00 00    	mov    %eax,0xe241(%rip)        # ffffffff8011274c <log+0x6c>
+  log.dev = ROOTDEV;
+ffffffff8010450b:	c7 05 43 e2 00 00 01 	movl   $0x1,0xe243(%rip)        # ffffffff80112758 <log+0x78>
+ffffffff80104512:	00 00 00 
+  recover_from_log();
+ffffffff80104515:	e8 c7 01 00 00       	call   ffffffff801046e1 <recover_from_log>
+}
+ffffffff8010451a:	90                   	nop
+ffffffff8010451b:	c9                   	leave
+ffffffff8010451c:	c3                   	ret
+
+ffffffff8010451d <install_trans>:
+
+// Copy committed blocks from log to their home location
+static void 
+install_trans(void)
+{
+ffffffff8010451d:	55                   	push   %rbp
+ffffffff8010451e:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104521:	48 83 ec 20          	sub    $0x20,%rsp
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+ffffffff80104525:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff8010452c:	e9 90 00 00 00       	jmp    ffffffff801045c1 <install_trans+0xa4>
+    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+ffffffff80104531:	8b 15 11 e2 00 00    	mov    0xe211(%rip),%edx        # ffffffff80112748 <log+0x68>
+ffffffff80104537:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010453a:	01 d0                	add    %edx,%eax
+ffffffff8010453c:	83 c0 01             	add    $0x1,%eax
+ffffffff8010453f:	89 c2                	mov    %eax,%edx
+ffffffff80104541:	8b 05 11 e2 00 00    	mov    0xe211(%rip),%eax        # ffffffff80112758 <log+0x78>
+ffffffff80104547:	89 d6                	mov    %edx,%esi
+ffffffff80104549:	89 c7                	mov    %eax,%edi
+ffffffff8010454b:	e8 87 bd ff ff       	call   ffffffff801002d7 <bread>
+ffffffff80104550:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
+ffffffff80104554:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80104557:	48 98                	cltq
+ffffffff80104559:	48 83 c0 1c          	add    $0x1c,%rax
+ffffffff8010455d:	8b 04 85 f0 26 11 80 	mov    -0x7feed910(,%rax,4),%eax
+ffffffff80104564:	89 c2                	mov    %eax,%edx
+ffffffff80104566:	8b 05 ec e1 00 00    	mov    0xe1ec(%rip),%eax        # ffffffff80112758 <log+0x78>
+ffffffff8010456c:	89 d6                	mov    %edx,%esi
+ffffffff8010456e:	89 c7                	mov    %eax,%edi
+ffffffff80104570:	e8 62 bd ff ff       	call   ffffffff801002d7 <bread>
+ffffffff80104575:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+ffffffff80104579:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010457d:	48 8d 48 28          	lea    0x28(%rax),%rcx
+ffffffff80104581:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80104585:	48 83 c0 28          	add    $0x28,%rax
+ffffffff80104589:	ba 00 02 00 00       	mov    $0x200,%edx
+ffffffff8010458e:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80104591:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104594:	e8 95 28 00 00       	call   ffffffff80106e2e <memmove>
+    bwrite(dbuf);  // write dst to disk
+ffffffff80104599:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010459d:	48 89 c7             	mov    %rax,%rdi
+ffffffff801045a0:	e8 72 bd ff ff       	call   ffffffff80100317 <bwrite>
+    brelse(lbuf); 
+ffffffff801045a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801045a9:	48 89 c7             	mov    %rax,%rdi
+ffffffff801045ac:	e8 ab bd ff ff       	call   ffffffff8010035c <brelse>
+    brelse(dbuf);
+ffffffff801045b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801045b5:	48 89 c7             	mov    %rax,%rdi
+ffffffff801045b8:	e8 9f bd ff ff       	call   ffffffff8010035c <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+ffffffff801045bd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff801045c1:	8b 05 95 e1 00 00    	mov    0xe195(%rip),%eax        # ffffffff8011275c <log+0x7c>
+ffffffff801045c7:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+ffffffff801045ca:	0f 8c 61 ff ff ff    	jl     ffffffff80104531 <install_trans+0x14>
+  }
+}
+ffffffff801045d0:	90                   	nop
+ffffffff801045d1:	90                   	nop
+ffffffff801045d2:	c9                   	leave
+ffffffff801045d3:	c3                   	ret
+
+ffffffff801045d4 <read_head>:
+
+// Read the log header from disk into the in-memory log header
+static void
+read_head(void)
+{
+ffffffff801045d4:	55                   	push   %rbp
+ffffffff801045d5:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801045d8:	48 83 ec 20          	sub    $0x20,%rsp
+  struct buf *buf = bread(log.dev, log.start);
+ffffffff801045dc:	8b 05 66 e1 00 00    	mov    0xe166(%rip),%eax        # ffffffff80112748 <log+0x68>
+ffffffff801045e2:	89 c2                	mov    %eax,%edx
+ffffffff801045e4:	8b 05 6e e1 00 00    	mov    0xe16e(%rip),%eax        # ffffffff80112758 <log+0x78>
+ffffffff801045ea:	89 d6                	mov    %edx,%esi
+ffffffff801045ec:	89 c7                	mov    %eax,%edi
+ffffffff801045ee:	e8 e4 bc ff ff       	call   ffffffff801002d7 <bread>
+ffffffff801045f3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  struct logheader *lh = (struct logheader *) (buf->data);
+ffffffff801045f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801045fb:	48 83 c0 28          	add    $0x28,%rax
+ffffffff801045ff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  int i;
+  log.lh.n = lh->n;
+ffffffff80104603:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80104607:	8b 00                	mov    (%rax),%eax
+ffffffff80104609:	89 05 4d e1 00 00    	mov    %eax,0xe14d(%rip)        # ffffffff8011275c <log+0x7c>
+  for (i = 0; i < log.lh.n; i++) {
+ffffffff8010460f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80104616:	eb 23                	jmp    ffffffff8010463b <read_head+0x67>
+    log.lh.block[i] = lh->block[i];
+ffffffff80104618:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010461c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010461f:	48 63 d2             	movslq %edx,%rdx
+ffffffff80104622:	8b 44 90 04          	mov    0x4(%rax,%rdx,4),%eax
+ffffffff80104626:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80104629:	48 63 d2             	movslq %edx,%rdx
+ffffffff8010462c:	48 83 c2 1c          	add    $0x1c,%rdx
+ffffffff80104630:	89 04 95 f0 26 11 80 	mov    %eax,-0x7feed910(,%rdx,4)
+  for (i = 0; i < log.lh.n; i++) {
+ffffffff80104637:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff8010463b:	8b 05 1b e1 00 00    	mov    0xe11b(%rip),%eax        # ffffffff8011275c <log+0x7c>
+ffffffff80104641:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+ffffffff80104644:	7c d2                	jl     ffffffff80104618 <read_head+0x44>
+  }
+  brelse(buf);
+ffffffff80104646:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010464a:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010464d:	e8 0a bd ff ff       	call   ffffffff8010035c <brelse>
+}
+ffffffff80104652:	90                   	nop
+ffffffff80104653:	c9                   	leave
+ffffffff80104654:	c3                   	ret
+
+ffffffff80104655 <write_head>:
+// Write in-memory log header to disk.
+// This is the true point at which the
+// current transaction commits.
+static void
+write_head(void)
+{
+ffffffff80104655:	55                   	push   %rbp
+ffffffff80104656:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104659:	48 83 ec 20          	sub    $0x20,%rsp
+  struct buf *buf = bread(log.dev, log.start);
+ffffffff8010465d:	8b 05 e5 e0 00 00    	mov    0xe0e5(%rip),%eax        # ffffffff80112748 <log+0x68>
+ffffffff80104663:	89 c2                	mov    %eax,%edx
+ffffffff80104665:	8b 05 ed e0 00 00    	mov    0xe0ed(%rip),%eax        # ffffffff80112758 <log+0x78>
+ffffffff8010466b:	89 d6                	mov    %edx,%esi
+ffffffff8010466d:	89 c7                	mov    %eax,%edi
+ffffffff8010466f:	e8 63 bc ff ff       	call   ffffffff801002d7 <bread>
+ffffffff80104674:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  struct logheader *hb = (struct logheader *) (buf->data);
+ffffffff80104678:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010467c:	48 83 c0 28          	add    $0x28,%rax
+ffffffff80104680:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  int i;
+  hb->n = log.lh.n;
+ffffffff80104684:	8b 15 d2 e0 00 00    	mov    0xe0d2(%rip),%edx        # ffffffff8011275c <log+0x7c>
+ffffffff8010468a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010468e:	89 10                	mov    %edx,(%rax)
+  for (i = 0; i < log.lh.n; i++) {
+ffffffff80104690:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80104697:	eb 22                	jmp    ffffffff801046bb <write_head+0x66>
+    hb->block[i] = log.lh.block[i];
+ffffffff80104699:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010469c:	48 98                	cltq
+ffffffff8010469e:	48 83 c0 1c          	add    $0x1c,%rax
+ffffffff801046a2:	8b 0c 85 f0 26 11 80 	mov    -0x7feed910(,%rax,4),%ecx
+ffffffff801046a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801046ad:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff801046b0:	48 63 d2             	movslq %edx,%rdx
+ffffffff801046b3:	89 4c 90 04          	mov    %ecx,0x4(%rax,%rdx,4)
+  for (i = 0; i < log.lh.n; i++) {
+ffffffff801046b7:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff801046bb:	8b 05 9b e0 00 00    	mov    0xe09b(%rip),%eax        # ffffffff8011275c <log+0x7c>
+ffffffff801046c1:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+ffffffff801046c4:	7c d3                	jl     ffffffff80104699 <write_head+0x44>
+  }
+  bwrite(buf);
+ffffffff801046c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801046ca:	48 89 c7             	mov    %rax,%rdi
+ffffffff801046cd:	e8 45 bc ff ff       	call   ffffffff80100317 <bwrite>
+  brelse(buf);
+ffffffff801046d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801046d6:	48 89 c7             	mov    %rax,%rdi
+ffffffff801046d9:	e8 7e bc ff ff       	call   ffffffff8010035c <brelse>
+}
+ffffffff801046de:	90                   	nop
+ffffffff801046df:	c9                   	leave
+ffffffff801046e0:	c3                   	ret
+
+ffffffff801046e1 <recover_from_log>:
+
+static void
+recover_from_log(void)
+{
+ffffffff801046e1:	55                   	push   %rbp
+ffffffff801046e2:	48 89 e5             	mov    %rsp,%rbp
+  read_head();      
+ffffffff801046e5:	e8 ea fe ff ff       	call   ffffffff801045d4 <read_head>
+  install_trans(); // if committed, copy from log to disk
+ffffffff801046ea:	e8 2e fe ff ff       	call   ffffffff8010451d <install_trans>
+  log.lh.n = 0;
+ffffffff801046ef:	c7 05 63 e0 00 00 00 	movl   $0x0,0xe063(%rip)        # ffffffff8011275c <log+0x7c>
+ffffffff801046f6:	00 00 00 
+  write_head(); // clear the log
+ffffffff801046f9:	e8 57 ff ff ff       	call   ffffffff80104655 <write_head>
+}
+ffffffff801046fe:	90                   	nop
+ffffffff801046ff:	5d                   	pop    %rbp
+ffffffff80104700:	c3                   	ret
+
+ffffffff80104701 <begin_op>:
+
+// called at the start of each FS system call.
+void
+begin_op(void)
+{
+ffffffff80104701:	55                   	push   %rbp
+ffffffff80104702:	48 89 e5             	mov    %rsp,%rbp
+  acquire(&log.lock);
+ffffffff80104705:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff8010470c:	e8 be 22 00 00       	call   ffffffff801069cf <acquire>
+  while(1){
+    if(log.committing){
+ffffffff80104711:	8b 05 3d e0 00 00    	mov    0xe03d(%rip),%eax        # ffffffff80112754 <log+0x74>
+ffffffff80104717:	85 c0                	test   %eax,%eax
+ffffffff80104719:	74 15                	je     ffffffff80104730 <begin_op+0x2f>
+      sleep(&log, &log.lock);
+ffffffff8010471b:	48 c7 c6 e0 26 11 80 	mov    $0xffffffff801126e0,%rsi
+ffffffff80104722:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff80104729:	e8 22 1f 00 00       	call   ffffffff80106650 <sleep>
+ffffffff8010472e:	eb e1                	jmp    ffffffff80104711 <begin_op+0x10>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+ffffffff80104730:	8b 0d 26 e0 00 00    	mov    0xe026(%rip),%ecx        # ffffffff8011275c <log+0x7c>
+ffffffff80104736:	8b 05 14 e0 00 00    	mov    0xe014(%rip),%eax        # ffffffff80112750 <log+0x70>
+ffffffff8010473c:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff8010473f:	89 d0                	mov    %edx,%eax
+ffffffff80104741:	c1 e0 02             	shl    $0x2,%eax
+ffffffff80104744:	01 d0                	add    %edx,%eax
+ffffffff80104746:	01 c0                	add    %eax,%eax
+ffffffff80104748:	01 c8                	add    %ecx,%eax
+ffffffff8010474a:	83 f8 1e             	cmp    $0x1e,%eax
+ffffffff8010474d:	7e 15                	jle    ffffffff80104764 <begin_op+0x63>
+      // this op might exhaust log space; wait for commit.
+      sleep(&log, &log.lock);
+ffffffff8010474f:	48 c7 c6 e0 26 11 80 	mov    $0xffffffff801126e0,%rsi
+ffffffff80104756:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff8010475d:	e8 ee 1e 00 00       	call   ffffffff80106650 <sleep>
+ffffffff80104762:	eb ad                	jmp    ffffffff80104711 <begin_op+0x10>
+    } else {
+      log.outstanding += 1;
+ffffffff80104764:	8b 05 e6 df 00 00    	mov    0xdfe6(%rip),%eax        # ffffffff80112750 <log+0x70>
+ffffffff8010476a:	83 c0 01             	add    $0x1,%eax
+ffffffff8010476d:	89 05 dd df 00 00    	mov    %eax,0xdfdd(%rip)        # ffffffff80112750 <log+0x70>
+      release(&log.lock);
+ffffffff80104773:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff8010477a:	e8 27 23 00 00       	call   ffffffff80106aa6 <release>
+      break;
+ffffffff8010477f:	90                   	nop
+    }
+  }
+}
+ffffffff80104780:	90                   	nop
+ffffffff80104781:	5d                   	pop    %rbp
+ffffffff80104782:	c3                   	ret
+
+ffffffff80104783 <end_op>:
+
+// called at the end of each FS system call.
+// commits if this was the last outstanding operation.
+void
+end_op(void)
+{
+ffffffff80104783:	55                   	push   %rbp
+ffffffff80104784:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104787:	48 83 ec 10          	sub    $0x10,%rsp
+  int do_commit = 0;
+ffffffff8010478b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  acquire(&log.lock);
+ffffffff80104792:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff80104799:	e8 31 22 00 00       	call   ffffffff801069cf <acquire>
+  log.outstanding -= 1;
+ffffffff8010479e:	8b 05 ac df 00 00    	mov    0xdfac(%rip),%eax        # ffffffff80112750 <log+0x70>
+ffffffff801047a4:	83 e8 01             	sub    $0x1,%eax
+ffffffff801047a7:	89 05 a3 df 00 00    	mov    %eax,0xdfa3(%rip)        # ffffffff80112750 <log+0x70>
+  if(log.committing)
+ffffffff801047ad:	8b 05 a1 df 00 00    	mov    0xdfa1(%rip),%eax        # ffffffff80112754 <log+0x74>
+ffffffff801047b3:	85 c0                	test   %eax,%eax
+ffffffff801047b5:	74 0c                	je     ffffffff801047c3 <end_op+0x40>
+    panic("log.committing");
+ffffffff801047b7:	48 c7 c7 40 a9 10 80 	mov    $0xffffffff8010a940,%rdi
+ffffffff801047be:	e8 6c c1 ff ff       	call   ffffffff8010092f <panic>
+  if(log.outstanding == 0){
+ffffffff801047c3:	8b 05 87 df 00 00    	mov    0xdf87(%rip),%eax        # ffffffff80112750 <log+0x70>
+ffffffff801047c9:	85 c0                	test   %eax,%eax
+ffffffff801047cb:	75 13                	jne    ffffffff801047e0 <end_op+0x5d>
+    do_commit = 1;
+ffffffff801047cd:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+    log.committing = 1;
+ffffffff801047d4:	c7 05 76 df 00 00 01 	movl   $0x1,0xdf76(%rip)        # ffffffff80112754 <log+0x74>
+ffffffff801047db:	00 00 00 
+ffffffff801047de:	eb 0c                	jmp    ffffffff801047ec <end_op+0x69>
+  } else {
+    // begin_op() may be waiting for log space.
+    wakeup(&log);
+ffffffff801047e0:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff801047e7:	e8 78 1f 00 00       	call   ffffffff80106764 <wakeup>
+  }
+  release(&log.lock);
+ffffffff801047ec:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff801047f3:	e8 ae 22 00 00       	call   ffffffff80106aa6 <release>
+
+  if(do_commit){
+ffffffff801047f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff801047fc:	74 38                	je     ffffffff80104836 <end_op+0xb3>
+    // call commit w/o holding locks, since not allowed
+    // to sleep with locks.
+    commit();
+ffffffff801047fe:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80104803:	e8 e8 00 00 00       	call   ffffffff801048f0 <commit>
+    acquire(&log.lock);
+ffffffff80104808:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff8010480f:	e8 bb 21 00 00       	call   ffffffff801069cf <acquire>
+    log.committing = 0;
+ffffffff80104814:	c7 05 36 df 00 00 00 	movl   $0x0,0xdf36(%rip)        # ffffffff80112754 <log+0x74>
+ffffffff8010481b:	00 00 00 
+    wakeup(&log);
+ffffffff8010481e:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff80104825:	e8 3a 1f 00 00       	call   ffffffff80106764 <wakeup>
+    release(&log.lock);
+ffffffff8010482a:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff80104831:	e8 70 22 00 00       	call   ffffffff80106aa6 <release>
+  }
+}
+ffffffff80104836:	90                   	nop
+ffffffff80104837:	c9                   	leave
+ffffffff80104838:	c3                   	ret
+
+ffffffff80104839 <write_log>:
+
+// Copy modified blocks from cache to log.
+static void 
+write_log(void)
+{
+ffffffff80104839:	55                   	push   %rbp
+ffffffff8010483a:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010483d:	48 83 ec 20          	sub    $0x20,%rsp
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+ffffffff80104841:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80104848:	e9 90 00 00 00       	jmp    ffffffff801048dd <write_log+0xa4>
+    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+ffffffff8010484d:	8b 15 f5 de 00 00    	mov    0xdef5(%rip),%edx        # ffffffff80112748 <log+0x68>
+ffffffff80104853:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80104856:	01 d0                	add    %edx,%eax
+ffffffff80104858:	83 c0 01             	add    $0x1,%eax
+ffffffff8010485b:	89 c2                	mov    %eax,%edx
+ffffffff8010485d:	8b 05 f5 de 00 00    	mov    0xdef5(%rip),%eax        # ffffffff80112758 <log+0x78>
+ffffffff80104863:	89 d6                	mov    %edx,%esi
+ffffffff80104865:	89 c7                	mov    %eax,%edi
+ffffffff80104867:	e8 6b ba ff ff       	call   ffffffff801002d7 <bread>
+ffffffff8010486c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+ffffffff80104870:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80104873:	48 98                	cltq
+ffffffff80104875:	48 83 c0 1c          	add    $0x1c,%rax
+ffffffff80104879:	8b 04 85 f0 26 11 80 	mov    -0x7feed910(,%rax,4),%eax
+ffffffff80104880:	89 c2                	mov    %eax,%edx
+ffffffff80104882:	8b 05 d0 de 00 00    	mov    0xded0(%rip),%eax        # ffffffff80112758 <log+0x78>
+ffffffff80104888:	89 d6                	mov    %edx,%esi
+ffffffff8010488a:	89 c7                	mov    %eax,%edi
+ffffffff8010488c:	e8 46 ba ff ff       	call   ffffffff801002d7 <bread>
+ffffffff80104891:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    memmove(to->data, from->data, BSIZE);
+ffffffff80104895:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80104899:	48 8d 48 28          	lea    0x28(%rax),%rcx
+ffffffff8010489d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801048a1:	48 83 c0 28          	add    $0x28,%rax
+ffffffff801048a5:	ba 00 02 00 00       	mov    $0x200,%edx
+ffffffff801048aa:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801048ad:	48 89 c7             	mov    %rax,%rdi
+ffffffff801048b0:	e8 79 25 00 00       	call   ffffffff80106e2e <memmove>
+    bwrite(to);  // write the log
+ffffffff801048b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801048b9:	48 89 c7             	mov    %rax,%rdi
+ffffffff801048bc:	e8 56 ba ff ff       	call   ffffffff80100317 <bwrite>
+    brelse(from); 
+ffffffff801048c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801048c5:	48 89 c7             	mov    %rax,%rdi
+ffffffff801048c8:	e8 8f ba ff ff       	call   ffffffff8010035c <brelse>
+    brelse(to);
+ffffffff801048cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801048d1:	48 89 c7             	mov    %rax,%rdi
+ffffffff801048d4:	e8 83 ba ff ff       	call   ffffffff8010035c <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+ffffffff801048d9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff801048dd:	8b 05 79 de 00 00    	mov    0xde79(%rip),%eax        # ffffffff8011275c <log+0x7c>
+ffffffff801048e3:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+ffffffff801048e6:	0f 8c 61 ff ff ff    	jl     ffffffff8010484d <write_log+0x14>
+  }
+}
+ffffffff801048ec:	90                   	nop
+ffffffff801048ed:	90                   	nop
+ffffffff801048ee:	c9                   	leave
+ffffffff801048ef:	c3                   	ret
+
+ffffffff801048f0 <commit>:
+
+static void
+commit()
+{
+ffffffff801048f0:	55                   	push   %rbp
+ffffffff801048f1:	48 89 e5             	mov    %rsp,%rbp
+  if (log.lh.n > 0) {
+ffffffff801048f4:	8b 05 62 de 00 00    	mov    0xde62(%rip),%eax        # ffffffff8011275c <log+0x7c>
+ffffffff801048fa:	85 c0                	test   %eax,%eax
+ffffffff801048fc:	7e 1e                	jle    ffffffff8010491c <commit+0x2c>
+    write_log();     // Write modified blocks from cache to log
+ffffffff801048fe:	e8 36 ff ff ff       	call   ffffffff80104839 <write_log>
+    write_head();    // Write header to disk -- the real commit
+ffffffff80104903:	e8 4d fd ff ff       	call   ffffffff80104655 <write_head>
+    install_trans(); // Now install writes to home locations
+ffffffff80104908:	e8 10 fc ff ff       	call   ffffffff8010451d <install_trans>
+    log.lh.n = 0; 
+ffffffff8010490d:	c7 05 45 de 00 00 00 	movl   $0x0,0xde45(%rip)        # ffffffff8011275c <log+0x7c>
+ffffffff80104914:	00 00 00 
+    write_head();    // Erase the transaction from the log
+ffffffff80104917:	e8 39 fd ff ff       	call   ffffffff80104655 <write_head>
+  }
+}
+ffffffff8010491c:	90                   	nop
+ffffffff8010491d:	5d                   	pop    %rbp
+ffffffff8010491e:	c3                   	ret
+
+ffffffff8010491f <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+ffffffff8010491f:	55                   	push   %rbp
+ffffffff80104920:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104923:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80104927:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+ffffffff8010492b:	8b 05 2b de 00 00    	mov    0xde2b(%rip),%eax        # ffffffff8011275c <log+0x7c>
+ffffffff80104931:	83 f8 1d             	cmp    $0x1d,%eax
+ffffffff80104934:	7f 13                	jg     ffffffff80104949 <log_write+0x2a>
+ffffffff80104936:	8b 15 20 de 00 00    	mov    0xde20(%rip),%edx        # ffffffff8011275c <log+0x7c>
+ffffffff8010493c:	8b 05 0a de 00 00    	mov    0xde0a(%rip),%eax        # ffffffff8011274c <log+0x6c>
+ffffffff80104942:	83 e8 01             	sub    $0x1,%eax
+ffffffff80104945:	39 c2                	cmp    %eax,%edx
+ffffffff80104947:	7c 0c                	jl     ffffffff80104955 <log_write+0x36>
+    panic("too big a transaction");
+ffffffff80104949:	48 c7 c7 4f a9 10 80 	mov    $0xffffffff8010a94f,%rdi
+ffffffff80104950:	e8 da bf ff ff       	call   ffffffff8010092f <panic>
+  if (log.outstanding < 1)
+ffffffff80104955:	8b 05 f5 dd 00 00    	mov    0xddf5(%rip),%eax        # ffffffff80112750 <log+0x70>
+ffffffff8010495b:	85 c0                	test   %eax,%eax
+ffffffff8010495d:	7f 0c                	jg     ffffffff8010496b <log_write+0x4c>
+    panic("log_write outside of trans");
+ffffffff8010495f:	48 c7 c7 65 a9 10 80 	mov    $0xffffffff8010a965,%rdi
+ffffffff80104966:	e8 c4 bf ff ff       	call   ffffffff8010092f <panic>
+
+  acquire(&log.lock);
+ffffffff8010496b:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff80104972:	e8 58 20 00 00       	call   ffffffff801069cf <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+ffffffff80104977:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff8010497e:	eb 21                	jmp    ffffffff801049a1 <log_write+0x82>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+ffffffff80104980:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80104983:	48 98                	cltq
+ffffffff80104985:	48 83 c0 1c          	add    $0x1c,%rax
+ffffffff80104989:	8b 04 85 f0 26 11 80 	mov    -0x7feed910(,%rax,4),%eax
+ffffffff80104990:	89 c2                	mov    %eax,%edx
+ffffffff80104992:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80104996:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff80104999:	39 c2                	cmp    %eax,%edx
+ffffffff8010499b:	74 11                	je     ffffffff801049ae <log_write+0x8f>
+  for (i = 0; i < log.lh.n; i++) {
+ffffffff8010499d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff801049a1:	8b 05 b5 dd 00 00    	mov    0xddb5(%rip),%eax        # ffffffff8011275c <log+0x7c>
+ffffffff801049a7:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+ffffffff801049aa:	7c d4                	jl     ffffffff80104980 <log_write+0x61>
+ffffffff801049ac:	eb 01                	jmp    ffffffff801049af <log_write+0x90>
+      break;
+ffffffff801049ae:	90                   	nop
+  }
+  log.lh.block[i] = b->blockno;
+ffffffff801049af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801049b3:	8b 40 08             	mov    0x8(%rax),%eax
+ffffffff801049b6:	89 c2                	mov    %eax,%edx
+ffffffff801049b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801049bb:	48 98                	cltq
+ffffffff801049bd:	48 83 c0 1c          	add    $0x1c,%rax
+ffffffff801049c1:	89 14 85 f0 26 11 80 	mov    %edx,-0x7feed910(,%rax,4)
+  if (i == log.lh.n)
+ffffffff801049c8:	8b 05 8e dd 00 00    	mov    0xdd8e(%rip),%eax        # ffffffff8011275c <log+0x7c>
+ffffffff801049ce:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+ffffffff801049d1:	75 0f                	jne    ffffffff801049e2 <log_write+0xc3>
+    log.lh.n++;
+ffffffff801049d3:	8b 05 83 dd 00 00    	mov    0xdd83(%rip),%eax        # ffffffff8011275c <log+0x7c>
+ffffffff801049d9:	83 c0 01             	add    $0x1,%eax
+ffffffff801049dc:	89 05 7a dd 00 00    	mov    %eax,0xdd7a(%rip)        # ffffffff8011275c <log+0x7c>
+  b->flags |= B_DIRTY; // prevent eviction
+ffffffff801049e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801049e6:	8b 00                	mov    (%rax),%eax
+ffffffff801049e8:	83 c8 04             	or     $0x4,%eax
+ffffffff801049eb:	89 c2                	mov    %eax,%edx
+ffffffff801049ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801049f1:	89 10                	mov    %edx,(%rax)
+  release(&log.lock);
+ffffffff801049f3:	48 c7 c7 e0 26 11 80 	mov    $0xffffffff801126e0,%rdi
+ffffffff801049fa:	e8 a7 20 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff801049ff:	90                   	nop
+ffffffff80104a00:	c9                   	leave
+ffffffff80104a01:	c3                   	ret
+
+ffffffff80104a02 <v2p>:
+ffffffff80104a02:	55                   	push   %rbp
+ffffffff80104a03:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104a06:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80104a0a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80104a0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104a12:	ba 00 00 00 80       	mov    $0x80000000,%edx
+ffffffff80104a17:	48 01 d0             	add    %rdx,%rax
+ffffffff80104a1a:	c9                   	leave
+ffffffff80104a1b:	c3                   	ret
+
+ffffffff80104a1c <p2v>:
+static inline void *p2v(uintp a) { return (void *) ((a) + ((uintp)KERNBASE)); }
+ffffffff80104a1c:	55                   	push   %rbp
+ffffffff80104a1d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104a20:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80104a24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80104a28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104a2c:	48 05 00 00 00 80    	add    $0xffffffff80000000,%rax
+ffffffff80104a32:	c9                   	leave
+ffffffff80104a33:	c3                   	ret
+
+ffffffff80104a34 <xchg>:
+  asm volatile("hlt");
+}
+
+static inline uint
+xchg(volatile uint *addr, uintp newval)
+{
+ffffffff80104a34:	55                   	push   %rbp
+ffffffff80104a35:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104a38:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80104a3c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80104a40:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uint result;
+  
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+               "+m" (*addr), "=a" (result) :
+               "1" ((uint)newval) :
+ffffffff80104a44:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  asm volatile("lock; xchgl %0, %1" :
+ffffffff80104a48:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff80104a4c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+ffffffff80104a50:	f0 87 02             	lock xchg %eax,(%rdx)
+ffffffff80104a53:	89 45 fc             	mov    %eax,-0x4(%rbp)
+               "cc");
+  return result;
+ffffffff80104a56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ffffffff80104a59:	c9                   	leave
+ffffffff80104a5a:	c3                   	ret
+
+ffffffff80104a5b <main>:
+// Bootstrap processor starts running C code here.
+// Allocate a real stack and switch to it, first
+// doing some setup required for memory allocator to work.
+int
+main(void)
+{
+ffffffff80104a5b:	55                   	push   %rbp
+ffffffff80104a5c:	48 89 e5             	mov    %rsp,%rbp
+  uartearlyinit();
+ffffffff80104a5f:	e8 68 3e 00 00       	call   ffffffff801088cc <uartearlyinit>
+  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+ffffffff80104a64:	48 c7 c6 00 00 40 80 	mov    $0xffffffff80400000,%rsi
+ffffffff80104a6b:	48 c7 c7 00 80 11 80 	mov    $0xffffffff80118000,%rdi
+ffffffff80104a72:	e8 82 f1 ff ff       	call   ffffffff80103bf9 <kinit1>
+  kvmalloc();      // kernel page table
+ffffffff80104a77:	e8 16 58 00 00       	call   ffffffff8010a292 <kvmalloc>
+  if (acpiinit()) // try to use acpi for machine info
+ffffffff80104a7c:	e8 43 0a 00 00       	call   ffffffff801054c4 <acpiinit>
+ffffffff80104a81:	85 c0                	test   %eax,%eax
+ffffffff80104a83:	74 05                	je     ffffffff80104a8a <main+0x2f>
+    mpinit();      // otherwise use bios MP tables
+ffffffff80104a85:	e8 cc 04 00 00       	call   ffffffff80104f56 <mpinit>
+  lapicinit();
+ffffffff80104a8a:	e8 48 f5 ff ff       	call   ffffffff80103fd7 <lapicinit>
+  seginit();       // set up segments
+ffffffff80104a8f:	e8 f0 54 00 00       	call   ffffffff80109f84 <seginit>
+  cprintf("\ncpu%d: starting xv6\n\n", cpu->id);
+ffffffff80104a94:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80104a9b:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80104a9f:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80104aa2:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104aa5:	89 c6                	mov    %eax,%esi
+ffffffff80104aa7:	48 c7 c7 80 a9 10 80 	mov    $0xffffffff8010a980,%rdi
+ffffffff80104aae:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80104ab3:	e8 ec ba ff ff       	call   ffffffff801005a4 <cprintf>
+  picinit();       // interrupt controller
+ffffffff80104ab8:	e8 8e 0b 00 00       	call   ffffffff8010564b <picinit>
+  ioapicinit();    // another interrupt controller
+ffffffff80104abd:	e8 10 f0 ff ff       	call   ffffffff80103ad2 <ioapicinit>
+  consoleinit();   // I/O devices & their interrupts
+ffffffff80104ac2:	e8 48 c4 ff ff       	call   ffffffff80100f0f <consoleinit>
+  uartinit();      // serial port
+ffffffff80104ac7:	e8 b9 3e 00 00       	call   ffffffff80108985 <uartinit>
+  pinit();         // process table
+ffffffff80104acc:	e8 eb 10 00 00       	call   ffffffff80105bbc <pinit>
+  tvinit();        // trap vectors
+ffffffff80104ad1:	e8 70 53 00 00       	call   ffffffff80109e46 <tvinit>
+  binit();         // buffer cache
+ffffffff80104ad6:	e8 50 b6 ff ff       	call   ffffffff8010012b <binit>
+  fileinit();      // file table
+ffffffff80104adb:	e8 81 d3 ff ff       	call   ffffffff80101e61 <fileinit>
+  iinit();         // inode cache
+ffffffff80104ae0:	e8 9f da ff ff       	call   ffffffff80102584 <iinit>
+  ideinit();       // disk
+ffffffff80104ae5:	e8 02 ec ff ff       	call   ffffffff801036ec <ideinit>
+  if(!ismp)
+ffffffff80104aea:	8b 05 70 e4 00 00    	mov    0xe470(%rip),%eax        # ffffffff80112f60 <ismp>
+ffffffff80104af0:	85 c0                	test   %eax,%eax
+ffffffff80104af2:	75 05                	jne    ffffffff80104af9 <main+0x9e>
+    timerinit();   // uniprocessor timer
+ffffffff80104af4:	e8 12 3a 00 00       	call   ffffffff8010850b <timerinit>
+  startothers();   // start other processors
+ffffffff80104af9:	e8 8a 00 00 00       	call   ffffffff80104b88 <startothers>
+  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+ffffffff80104afe:	48 c7 c6 00 00 00 8e 	mov    $0xffffffff8e000000,%rsi
+ffffffff80104b05:	48 c7 c7 00 00 40 80 	mov    $0xffffffff80400000,%rdi
+ffffffff80104b0c:	e8 2b f1 ff ff       	call   ffffffff80103c3c <kinit2>
+  userinit();      // first user process
+ffffffff80104b11:	e8 e8 11 00 00       	call   ffffffff80105cfe <userinit>
+  cpuidinit();
+ffffffff80104b16:	e8 fb cd ff ff       	call   ffffffff80101916 <cpuidinit>
+  // Finish setting up this processor in mpmain.
+  mpmain();
+ffffffff80104b1b:	e8 18 00 00 00       	call   ffffffff80104b38 <mpmain>
+
+ffffffff80104b20 <mpenter>:
+}
+
+// Other CPUs jump here from entryother.S.
+void
+mpenter(void)
+{
+ffffffff80104b20:	55                   	push   %rbp
+ffffffff80104b21:	48 89 e5             	mov    %rsp,%rbp
+  switchkvm(); 
+ffffffff80104b24:	e8 2e 59 00 00       	call   ffffffff8010a457 <switchkvm>
+  seginit();
+ffffffff80104b29:	e8 56 54 00 00       	call   ffffffff80109f84 <seginit>
+  lapicinit();
+ffffffff80104b2e:	e8 a4 f4 ff ff       	call   ffffffff80103fd7 <lapicinit>
+  mpmain();
+ffffffff80104b33:	e8 00 00 00 00       	call   ffffffff80104b38 <mpmain>
+
+ffffffff80104b38 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+ffffffff80104b38:	55                   	push   %rbp
+ffffffff80104b39:	48 89 e5             	mov    %rsp,%rbp
+  cprintf("cpu%d: starting\n", cpu->id);
+ffffffff80104b3c:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80104b43:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80104b47:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80104b4a:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104b4d:	89 c6                	mov    %eax,%esi
+ffffffff80104b4f:	48 c7 c7 97 a9 10 80 	mov    $0xffffffff8010a997,%rdi
+ffffffff80104b56:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80104b5b:	e8 44 ba ff ff       	call   ffffffff801005a4 <cprintf>
+  idtinit();       // load idt register
+ffffffff80104b60:	e8 e8 52 00 00       	call   ffffffff80109e4d <idtinit>
+  xchg(&cpu->started, 1); // tell startothers() we're up
+ffffffff80104b65:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80104b6c:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80104b70:	48 05 d8 00 00 00    	add    $0xd8,%rax
+ffffffff80104b76:	be 01 00 00 00       	mov    $0x1,%esi
+ffffffff80104b7b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104b7e:	e8 b1 fe ff ff       	call   ffffffff80104a34 <xchg>
+  scheduler();     // start running processes
+ffffffff80104b83:	e8 bf 18 00 00       	call   ffffffff80106447 <scheduler>
+
+ffffffff80104b88 <startothers>:
+#endif /* X64 */
+
+// Start the non-boot (AP) processors.
+static void
+startothers(void)
+{
+ffffffff80104b88:	55                   	push   %rbp
+ffffffff80104b89:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104b8c:	48 83 ec 20          	sub    $0x20,%rsp
+  char *stack;
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = p2v(0x7000);
+ffffffff80104b90:	bf 00 70 00 00       	mov    $0x7000,%edi
+ffffffff80104b95:	e8 82 fe ff ff       	call   ffffffff80104a1c <p2v>
+ffffffff80104b9a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  memmove(code, _binary_out_entryother_start, (uintp)_binary_out_entryother_size);
+ffffffff80104b9e:	48 c7 c0 72 00 00 00 	mov    $0x72,%rax
+ffffffff80104ba5:	89 c2                	mov    %eax,%edx
+ffffffff80104ba7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104bab:	48 c7 c6 b4 be 10 80 	mov    $0xffffffff8010beb4,%rsi
+ffffffff80104bb2:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104bb5:	e8 74 22 00 00       	call   ffffffff80106e2e <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+ffffffff80104bba:	48 c7 45 f8 e0 27 11 	movq   $0xffffffff801127e0,-0x8(%rbp)
+ffffffff80104bc1:	80 
+ffffffff80104bc2:	e9 a1 00 00 00       	jmp    ffffffff80104c68 <startothers+0xe0>
+    if(c == cpus+cpunum())  // We've started already.
+ffffffff80104bc7:	e8 28 f5 ff ff       	call   ffffffff801040f4 <cpunum>
+ffffffff80104bcc:	48 63 d0             	movslq %eax,%rdx
+ffffffff80104bcf:	48 89 d0             	mov    %rdx,%rax
+ffffffff80104bd2:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80104bd6:	48 29 d0             	sub    %rdx,%rax
+ffffffff80104bd9:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80104bdd:	48 05 e0 27 11 80    	add    $0xffffffff801127e0,%rax
+ffffffff80104be3:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ffffffff80104be7:	74 76                	je     ffffffff80104c5f <startothers+0xd7>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what 
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+ffffffff80104be9:	e8 76 f1 ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff80104bee:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+#if X64
+    *(uint32*)(code-4) = 0x8000; // just enough stack to get us to entry64mp
+ffffffff80104bf2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104bf6:	48 83 e8 04          	sub    $0x4,%rax
+ffffffff80104bfa:	c7 00 00 80 00 00    	movl   $0x8000,(%rax)
+    *(uint32*)(code-8) = v2p(entry32mp);
+ffffffff80104c00:	48 c7 c7 74 00 10 80 	mov    $0xffffffff80100074,%rdi
+ffffffff80104c07:	e8 f6 fd ff ff       	call   ffffffff80104a02 <v2p>
+ffffffff80104c0c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff80104c10:	48 83 ea 08          	sub    $0x8,%rdx
+ffffffff80104c14:	89 02                	mov    %eax,(%rdx)
+    *(uint64*)(code-16) = (uint64) (stack + KSTACKSIZE);
+ffffffff80104c16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80104c1a:	48 8d 90 00 10 00 00 	lea    0x1000(%rax),%rdx
+ffffffff80104c21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104c25:	48 83 e8 10          	sub    $0x10,%rax
+ffffffff80104c29:	48 89 10             	mov    %rdx,(%rax)
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void**)(code-8) = mpenter;
+    *(int**)(code-12) = (void *) v2p(entrypgdir);
+#endif
+
+    lapicstartap(c->apicid, v2p(code));
+ffffffff80104c2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104c30:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104c33:	e8 ca fd ff ff       	call   ffffffff80104a02 <v2p>
+ffffffff80104c38:	89 c2                	mov    %eax,%edx
+ffffffff80104c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104c3e:	0f b6 40 01          	movzbl 0x1(%rax),%eax
+ffffffff80104c42:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104c45:	89 d6                	mov    %edx,%esi
+ffffffff80104c47:	89 c7                	mov    %eax,%edi
+ffffffff80104c49:	e8 87 f5 ff ff       	call   ffffffff801041d5 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+ffffffff80104c4e:	90                   	nop
+ffffffff80104c4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104c53:	8b 80 d8 00 00 00    	mov    0xd8(%rax),%eax
+ffffffff80104c59:	85 c0                	test   %eax,%eax
+ffffffff80104c5b:	74 f2                	je     ffffffff80104c4f <startothers+0xc7>
+ffffffff80104c5d:	eb 01                	jmp    ffffffff80104c60 <startothers+0xd8>
+      continue;
+ffffffff80104c5f:	90                   	nop
+  for(c = cpus; c < cpus+ncpu; c++){
+ffffffff80104c60:	48 81 45 f8 f0 00 00 	addq   $0xf0,-0x8(%rbp)
+ffffffff80104c67:	00 
+ffffffff80104c68:	8b 05 f6 e2 00 00    	mov    0xe2f6(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff80104c6e:	48 63 d0             	movslq %eax,%rdx
+ffffffff80104c71:	48 89 d0             	mov    %rdx,%rax
+ffffffff80104c74:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80104c78:	48 29 d0             	sub    %rdx,%rax
+ffffffff80104c7b:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80104c7f:	48 05 e0 27 11 80    	add    $0xffffffff801127e0,%rax
+ffffffff80104c85:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ffffffff80104c89:	0f 82 38 ff ff ff    	jb     ffffffff80104bc7 <startothers+0x3f>
+      ;
+  }
+}
+ffffffff80104c8f:	90                   	nop
+ffffffff80104c90:	90                   	nop
+ffffffff80104c91:	c9                   	leave
+ffffffff80104c92:	c3                   	ret
+
+ffffffff80104c93 <p2v>:
+ffffffff80104c93:	55                   	push   %rbp
+ffffffff80104c94:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104c97:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80104c9b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80104c9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104ca3:	48 05 00 00 00 80    	add    $0xffffffff80000000,%rax
+ffffffff80104ca9:	c9                   	leave
+ffffffff80104caa:	c3                   	ret
+
+ffffffff80104cab <inb>:
+{
+ffffffff80104cab:	55                   	push   %rbp
+ffffffff80104cac:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104caf:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff80104cb3:	89 f8                	mov    %edi,%eax
+ffffffff80104cb5:	66 89 45 ec          	mov    %ax,-0x14(%rbp)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+ffffffff80104cb9:	0f b7 45 ec          	movzwl -0x14(%rbp),%eax
+ffffffff80104cbd:	89 c2                	mov    %eax,%edx
+ffffffff80104cbf:	ec                   	in     (%dx),%al
+ffffffff80104cc0:	88 45 ff             	mov    %al,-0x1(%rbp)
+  return data;
+ffffffff80104cc3:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+}
+ffffffff80104cc7:	c9                   	leave
+ffffffff80104cc8:	c3                   	ret
+
+ffffffff80104cc9 <outb>:
+{
+ffffffff80104cc9:	55                   	push   %rbp
+ffffffff80104cca:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104ccd:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80104cd1:	89 fa                	mov    %edi,%edx
+ffffffff80104cd3:	89 f0                	mov    %esi,%eax
+ffffffff80104cd5:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+ffffffff80104cd9:	88 45 f8             	mov    %al,-0x8(%rbp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+ffffffff80104cdc:	0f b6 45 f8          	movzbl -0x8(%rbp),%eax
+ffffffff80104ce0:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+ffffffff80104ce4:	ee                   	out    %al,(%dx)
+}
+ffffffff80104ce5:	90                   	nop
+ffffffff80104ce6:	c9                   	leave
+ffffffff80104ce7:	c3                   	ret
+
+ffffffff80104ce8 <mpbcpu>:
+int ncpu;
+uchar ioapicid;
+
+int
+mpbcpu(void)
+{
+ffffffff80104ce8:	55                   	push   %rbp
+ffffffff80104ce9:	48 89 e5             	mov    %rsp,%rbp
+  return bcpu-cpus;
+ffffffff80104cec:	48 8b 05 7d e2 00 00 	mov    0xe27d(%rip),%rax        # ffffffff80112f70 <bcpu>
+ffffffff80104cf3:	48 2d e0 27 11 80    	sub    $0xffffffff801127e0,%rax
+ffffffff80104cf9:	48 c1 f8 04          	sar    $0x4,%rax
+ffffffff80104cfd:	48 89 c2             	mov    %rax,%rdx
+ffffffff80104d00:	48 b8 ef ee ee ee ee 	movabs $0xeeeeeeeeeeeeeeef,%rax
+ffffffff80104d07:	ee ee ee 
+ffffffff80104d0a:	48 0f af c2          	imul   %rdx,%rax
+}
+ffffffff80104d0e:	5d                   	pop    %rbp
+ffffffff80104d0f:	c3                   	ret
+
+ffffffff80104d10 <sum>:
+
+static uchar
+sum(uchar *addr, int len)
+{
+ffffffff80104d10:	55                   	push   %rbp
+ffffffff80104d11:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104d14:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80104d18:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80104d1c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  int i, sum;
+  
+  sum = 0;
+ffffffff80104d1f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  for(i=0; i<len; i++)
+ffffffff80104d26:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80104d2d:	eb 1a                	jmp    ffffffff80104d49 <sum+0x39>
+    sum += addr[i];
+ffffffff80104d2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80104d32:	48 63 d0             	movslq %eax,%rdx
+ffffffff80104d35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80104d39:	48 01 d0             	add    %rdx,%rax
+ffffffff80104d3c:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80104d3f:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104d42:	01 45 f8             	add    %eax,-0x8(%rbp)
+  for(i=0; i<len; i++)
+ffffffff80104d45:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80104d49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80104d4c:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+ffffffff80104d4f:	7c de                	jl     ffffffff80104d2f <sum+0x1f>
+  return sum;
+ffffffff80104d51:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+ffffffff80104d54:	c9                   	leave
+ffffffff80104d55:	c3                   	ret
+
+ffffffff80104d56 <mpsearch1>:
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+ffffffff80104d56:	55                   	push   %rbp
+ffffffff80104d57:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104d5a:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80104d5e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+ffffffff80104d61:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  uchar *e, *p, *addr;
+
+  addr = p2v(a);
+ffffffff80104d64:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80104d67:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104d6a:	e8 24 ff ff ff       	call   ffffffff80104c93 <p2v>
+ffffffff80104d6f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e = addr+len;
+ffffffff80104d73:	8b 45 d8             	mov    -0x28(%rbp),%eax
+ffffffff80104d76:	48 63 d0             	movslq %eax,%rdx
+ffffffff80104d79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104d7d:	48 01 d0             	add    %rdx,%rax
+ffffffff80104d80:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for(p = addr; p < e; p += sizeof(struct mp))
+ffffffff80104d84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104d88:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80104d8c:	eb 3c                	jmp    ffffffff80104dca <mpsearch1+0x74>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+ffffffff80104d8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104d92:	ba 04 00 00 00       	mov    $0x4,%edx
+ffffffff80104d97:	48 c7 c6 a8 a9 10 80 	mov    $0xffffffff8010a9a8,%rsi
+ffffffff80104d9e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104da1:	e8 19 20 00 00       	call   ffffffff80106dbf <memcmp>
+ffffffff80104da6:	85 c0                	test   %eax,%eax
+ffffffff80104da8:	75 1b                	jne    ffffffff80104dc5 <mpsearch1+0x6f>
+ffffffff80104daa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104dae:	be 10 00 00 00       	mov    $0x10,%esi
+ffffffff80104db3:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104db6:	e8 55 ff ff ff       	call   ffffffff80104d10 <sum>
+ffffffff80104dbb:	84 c0                	test   %al,%al
+ffffffff80104dbd:	75 06                	jne    ffffffff80104dc5 <mpsearch1+0x6f>
+      return (struct mp*)p;
+ffffffff80104dbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104dc3:	eb 14                	jmp    ffffffff80104dd9 <mpsearch1+0x83>
+  for(p = addr; p < e; p += sizeof(struct mp))
+ffffffff80104dc5:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+ffffffff80104dca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104dce:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+ffffffff80104dd2:	72 ba                	jb     ffffffff80104d8e <mpsearch1+0x38>
+  return 0;
+ffffffff80104dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80104dd9:	c9                   	leave
+ffffffff80104dda:	c3                   	ret
+
+ffffffff80104ddb <mpsearch>:
+// 1) in the first KB of the EBDA;
+// 2) in the last KB of system base memory;
+// 3) in the BIOS ROM address space between 0F0000h and 0FFFFFh.
+static struct mp*
+mpsearch(void)
+{
+ffffffff80104ddb:	55                   	push   %rbp
+ffffffff80104ddc:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104ddf:	48 83 ec 20          	sub    $0x20,%rsp
+  uchar *bda;
+  uint p;
+  struct mp *mp;
+
+  bda = (uchar *) P2V(0x400);
+ffffffff80104de3:	48 c7 45 f8 00 04 00 	movq   $0xffffffff80000400,-0x8(%rbp)
+ffffffff80104dea:	80 
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+ffffffff80104deb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104def:	48 83 c0 0f          	add    $0xf,%rax
+ffffffff80104df3:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80104df6:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104df9:	c1 e0 08             	shl    $0x8,%eax
+ffffffff80104dfc:	89 c2                	mov    %eax,%edx
+ffffffff80104dfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104e02:	48 83 c0 0e          	add    $0xe,%rax
+ffffffff80104e06:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80104e09:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104e0c:	09 d0                	or     %edx,%eax
+ffffffff80104e0e:	c1 e0 04             	shl    $0x4,%eax
+ffffffff80104e11:	89 45 f4             	mov    %eax,-0xc(%rbp)
+ffffffff80104e14:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ffffffff80104e18:	74 20                	je     ffffffff80104e3a <mpsearch+0x5f>
+    if((mp = mpsearch1(p, 1024)))
+ffffffff80104e1a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80104e1d:	be 00 04 00 00       	mov    $0x400,%esi
+ffffffff80104e22:	89 c7                	mov    %eax,%edi
+ffffffff80104e24:	e8 2d ff ff ff       	call   ffffffff80104d56 <mpsearch1>
+ffffffff80104e29:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+ffffffff80104e2d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+ffffffff80104e32:	74 54                	je     ffffffff80104e88 <mpsearch+0xad>
+      return mp;
+ffffffff80104e34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80104e38:	eb 5d                	jmp    ffffffff80104e97 <mpsearch+0xbc>
+  } else {
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+ffffffff80104e3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104e3e:	48 83 c0 14          	add    $0x14,%rax
+ffffffff80104e42:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80104e45:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104e48:	c1 e0 08             	shl    $0x8,%eax
+ffffffff80104e4b:	89 c2                	mov    %eax,%edx
+ffffffff80104e4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104e51:	48 83 c0 13          	add    $0x13,%rax
+ffffffff80104e55:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80104e58:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104e5b:	09 d0                	or     %edx,%eax
+ffffffff80104e5d:	c1 e0 0a             	shl    $0xa,%eax
+ffffffff80104e60:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if((mp = mpsearch1(p-1024, 1024)))
+ffffffff80104e63:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80104e66:	2d 00 04 00 00       	sub    $0x400,%eax
+ffffffff80104e6b:	be 00 04 00 00       	mov    $0x400,%esi
+ffffffff80104e70:	89 c7                	mov    %eax,%edi
+ffffffff80104e72:	e8 df fe ff ff       	call   ffffffff80104d56 <mpsearch1>
+ffffffff80104e77:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+ffffffff80104e7b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+ffffffff80104e80:	74 06                	je     ffffffff80104e88 <mpsearch+0xad>
+      return mp;
+ffffffff80104e82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80104e86:	eb 0f                	jmp    ffffffff80104e97 <mpsearch+0xbc>
+  }
+  return mpsearch1(0xF0000, 0x10000);
+ffffffff80104e88:	be 00 00 01 00       	mov    $0x10000,%esi
+ffffffff80104e8d:	bf 00 00 0f 00       	mov    $0xf0000,%edi
+ffffffff80104e92:	e8 bf fe ff ff       	call   ffffffff80104d56 <mpsearch1>
+}
+ffffffff80104e97:	c9                   	leave
+ffffffff80104e98:	c3                   	ret
+
+ffffffff80104e99 <mpconfig>:
+// Check for correct signature, calculate the checksum and,
+// if correct, check the version.
+// To do: check extended table checksum.
+static struct mpconf*
+mpconfig(struct mp **pmp)
+{
+ffffffff80104e99:	55                   	push   %rbp
+ffffffff80104e9a:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104e9d:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80104ea1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct mpconf *conf;
+  struct mp *mp;
+
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+ffffffff80104ea5:	e8 31 ff ff ff       	call   ffffffff80104ddb <mpsearch>
+ffffffff80104eaa:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80104eae:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80104eb3:	74 0b                	je     ffffffff80104ec0 <mpconfig+0x27>
+ffffffff80104eb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104eb9:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80104ebc:	85 c0                	test   %eax,%eax
+ffffffff80104ebe:	75 0a                	jne    ffffffff80104eca <mpconfig+0x31>
+    return 0;
+ffffffff80104ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80104ec5:	e9 8a 00 00 00       	jmp    ffffffff80104f54 <mpconfig+0xbb>
+  conf = (struct mpconf*) p2v((uintp) mp->physaddr);
+ffffffff80104eca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104ece:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff80104ed1:	89 c0                	mov    %eax,%eax
+ffffffff80104ed3:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104ed6:	e8 b8 fd ff ff       	call   ffffffff80104c93 <p2v>
+ffffffff80104edb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+ffffffff80104edf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104ee3:	ba 04 00 00 00       	mov    $0x4,%edx
+ffffffff80104ee8:	48 c7 c6 ad a9 10 80 	mov    $0xffffffff8010a9ad,%rsi
+ffffffff80104eef:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104ef2:	e8 c8 1e 00 00       	call   ffffffff80106dbf <memcmp>
+ffffffff80104ef7:	85 c0                	test   %eax,%eax
+ffffffff80104ef9:	74 07                	je     ffffffff80104f02 <mpconfig+0x69>
+    return 0;
+ffffffff80104efb:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80104f00:	eb 52                	jmp    ffffffff80104f54 <mpconfig+0xbb>
+  if(conf->version != 1 && conf->version != 4)
+ffffffff80104f02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104f06:	0f b6 40 06          	movzbl 0x6(%rax),%eax
+ffffffff80104f0a:	3c 01                	cmp    $0x1,%al
+ffffffff80104f0c:	74 13                	je     ffffffff80104f21 <mpconfig+0x88>
+ffffffff80104f0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104f12:	0f b6 40 06          	movzbl 0x6(%rax),%eax
+ffffffff80104f16:	3c 04                	cmp    $0x4,%al
+ffffffff80104f18:	74 07                	je     ffffffff80104f21 <mpconfig+0x88>
+    return 0;
+ffffffff80104f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80104f1f:	eb 33                	jmp    ffffffff80104f54 <mpconfig+0xbb>
+  if(sum((uchar*)conf, conf->length) != 0)
+ffffffff80104f21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104f25:	0f b7 40 04          	movzwl 0x4(%rax),%eax
+ffffffff80104f29:	0f b7 d0             	movzwl %ax,%edx
+ffffffff80104f2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104f30:	89 d6                	mov    %edx,%esi
+ffffffff80104f32:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104f35:	e8 d6 fd ff ff       	call   ffffffff80104d10 <sum>
+ffffffff80104f3a:	84 c0                	test   %al,%al
+ffffffff80104f3c:	74 07                	je     ffffffff80104f45 <mpconfig+0xac>
+    return 0;
+ffffffff80104f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80104f43:	eb 0f                	jmp    ffffffff80104f54 <mpconfig+0xbb>
+  *pmp = mp;
+ffffffff80104f45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80104f49:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80104f4d:	48 89 10             	mov    %rdx,(%rax)
+  return conf;
+ffffffff80104f50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+ffffffff80104f54:	c9                   	leave
+ffffffff80104f55:	c3                   	ret
+
+ffffffff80104f56 <mpinit>:
+
+void
+mpinit(void)
+{
+ffffffff80104f56:	55                   	push   %rbp
+ffffffff80104f57:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80104f5a:	48 83 ec 30          	sub    $0x30,%rsp
+  struct mp *mp;
+  struct mpconf *conf;
+  struct mpproc *proc;
+  struct mpioapic *ioapic;
+
+  bcpu = &cpus[0];
+ffffffff80104f5e:	48 c7 05 07 e0 00 00 	movq   $0xffffffff801127e0,0xe007(%rip)        # ffffffff80112f70 <bcpu>
+ffffffff80104f65:	e0 27 11 80 
+  if((conf = mpconfig(&mp)) == 0)
+ffffffff80104f69:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ffffffff80104f6d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80104f70:	e8 24 ff ff ff       	call   ffffffff80104e99 <mpconfig>
+ffffffff80104f75:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff80104f79:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80104f7e:	0f 84 0e 02 00 00    	je     ffffffff80105192 <mpinit+0x23c>
+    return;
+  ismp = 1;
+ffffffff80104f84:	c7 05 d2 df 00 00 01 	movl   $0x1,0xdfd2(%rip)        # ffffffff80112f60 <ismp>
+ffffffff80104f8b:	00 00 00 
+  lapic = IO2V((uintp)conf->lapicaddr);
+ffffffff80104f8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104f92:	8b 40 24             	mov    0x24(%rax),%eax
+ffffffff80104f95:	89 c2                	mov    %eax,%edx
+ffffffff80104f97:	48 b8 00 00 00 42 fe 	movabs $0xfffffffe42000000,%rax
+ffffffff80104f9e:	ff ff ff 
+ffffffff80104fa1:	48 01 d0             	add    %rdx,%rax
+ffffffff80104fa4:	48 89 05 15 d7 00 00 	mov    %rax,0xd715(%rip)        # ffffffff801126c0 <lapic>
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+ffffffff80104fab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104faf:	48 83 c0 2c          	add    $0x2c,%rax
+ffffffff80104fb3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80104fb7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104fbb:	0f b7 40 04          	movzwl 0x4(%rax),%eax
+ffffffff80104fbf:	0f b7 d0             	movzwl %ax,%edx
+ffffffff80104fc2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80104fc6:	48 01 d0             	add    %rdx,%rax
+ffffffff80104fc9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+ffffffff80104fcd:	e9 51 01 00 00       	jmp    ffffffff80105123 <mpinit+0x1cd>
+    switch(*p){
+ffffffff80104fd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80104fd6:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80104fd9:	0f b6 c0             	movzbl %al,%eax
+ffffffff80104fdc:	83 f8 04             	cmp    $0x4,%eax
+ffffffff80104fdf:	0f 8f 17 01 00 00    	jg     ffffffff801050fc <mpinit+0x1a6>
+ffffffff80104fe5:	83 f8 03             	cmp    $0x3,%eax
+ffffffff80104fe8:	0f 8d 07 01 00 00    	jge    ffffffff801050f5 <mpinit+0x19f>
+ffffffff80104fee:	83 f8 02             	cmp    $0x2,%eax
+ffffffff80104ff1:	0f 84 e1 00 00 00    	je     ffffffff801050d8 <mpinit+0x182>
+ffffffff80104ff7:	83 f8 02             	cmp    $0x2,%eax
+ffffffff80104ffa:	0f 8f fc 00 00 00    	jg     ffffffff801050fc <mpinit+0x1a6>
+ffffffff80105000:	85 c0                	test   %eax,%eax
+ffffffff80105002:	74 0e                	je     ffffffff80105012 <mpinit+0xbc>
+ffffffff80105004:	83 f8 01             	cmp    $0x1,%eax
+ffffffff80105007:	0f 84 e8 00 00 00    	je     ffffffff801050f5 <mpinit+0x19f>
+ffffffff8010500d:	e9 ea 00 00 00       	jmp    ffffffff801050fc <mpinit+0x1a6>
+    case MPPROC:
+      proc = (struct mpproc*)p;
+ffffffff80105012:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105016:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      cprintf("mpinit ncpu=%d apicid=%d\n", ncpu, proc->apicid);
+ffffffff8010501a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff8010501e:	0f b6 40 01          	movzbl 0x1(%rax),%eax
+ffffffff80105022:	0f b6 d0             	movzbl %al,%edx
+ffffffff80105025:	8b 05 39 df 00 00    	mov    0xdf39(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff8010502b:	89 c6                	mov    %eax,%esi
+ffffffff8010502d:	48 c7 c7 b2 a9 10 80 	mov    $0xffffffff8010a9b2,%rdi
+ffffffff80105034:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80105039:	e8 66 b5 ff ff       	call   ffffffff801005a4 <cprintf>
+      if(proc->flags & MPBOOT)
+ffffffff8010503e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80105042:	0f b6 40 03          	movzbl 0x3(%rax),%eax
+ffffffff80105046:	0f b6 c0             	movzbl %al,%eax
+ffffffff80105049:	83 e0 02             	and    $0x2,%eax
+ffffffff8010504c:	85 c0                	test   %eax,%eax
+ffffffff8010504e:	74 24                	je     ffffffff80105074 <mpinit+0x11e>
+        bcpu = &cpus[ncpu];
+ffffffff80105050:	8b 05 0e df 00 00    	mov    0xdf0e(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff80105056:	48 63 d0             	movslq %eax,%rdx
+ffffffff80105059:	48 89 d0             	mov    %rdx,%rax
+ffffffff8010505c:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80105060:	48 29 d0             	sub    %rdx,%rax
+ffffffff80105063:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80105067:	48 05 e0 27 11 80    	add    $0xffffffff801127e0,%rax
+ffffffff8010506d:	48 89 05 fc de 00 00 	mov    %rax,0xdefc(%rip)        # ffffffff80112f70 <bcpu>
+      cpus[ncpu].id = ncpu;
+ffffffff80105074:	8b 15 ea de 00 00    	mov    0xdeea(%rip),%edx        # ffffffff80112f64 <ncpu>
+ffffffff8010507a:	8b 05 e4 de 00 00    	mov    0xdee4(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff80105080:	89 d1                	mov    %edx,%ecx
+ffffffff80105082:	48 63 d0             	movslq %eax,%rdx
+ffffffff80105085:	48 89 d0             	mov    %rdx,%rax
+ffffffff80105088:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff8010508c:	48 29 d0             	sub    %rdx,%rax
+ffffffff8010508f:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff80105093:	48 05 e0 27 11 80    	add    $0xffffffff801127e0,%rax
+ffffffff80105099:	88 08                	mov    %cl,(%rax)
+      cpus[ncpu].apicid = proc->apicid;
+ffffffff8010509b:	8b 15 c3 de 00 00    	mov    0xdec3(%rip),%edx        # ffffffff80112f64 <ncpu>
+ffffffff801050a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801050a5:	0f b6 48 01          	movzbl 0x1(%rax),%ecx
+ffffffff801050a9:	48 63 d2             	movslq %edx,%rdx
+ffffffff801050ac:	48 89 d0             	mov    %rdx,%rax
+ffffffff801050af:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff801050b3:	48 29 d0             	sub    %rdx,%rax
+ffffffff801050b6:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff801050ba:	48 05 e1 27 11 80    	add    $0xffffffff801127e1,%rax
+ffffffff801050c0:	88 08                	mov    %cl,(%rax)
+      ncpu++;
+ffffffff801050c2:	8b 05 9c de 00 00    	mov    0xde9c(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff801050c8:	83 c0 01             	add    $0x1,%eax
+ffffffff801050cb:	89 05 93 de 00 00    	mov    %eax,0xde93(%rip)        # ffffffff80112f64 <ncpu>
+      p += sizeof(struct mpproc);
+ffffffff801050d1:	48 83 45 f8 14       	addq   $0x14,-0x8(%rbp)
+      continue;
+ffffffff801050d6:	eb 4b                	jmp    ffffffff80105123 <mpinit+0x1cd>
+    case MPIOAPIC:
+      ioapic = (struct mpioapic*)p;
+ffffffff801050d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801050dc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      ioapicid = ioapic->apicno;
+ffffffff801050e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff801050e4:	0f b6 40 01          	movzbl 0x1(%rax),%eax
+ffffffff801050e8:	88 05 7a de 00 00    	mov    %al,0xde7a(%rip)        # ffffffff80112f68 <ioapicid>
+      p += sizeof(struct mpioapic);
+ffffffff801050ee:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+      continue;
+ffffffff801050f3:	eb 2e                	jmp    ffffffff80105123 <mpinit+0x1cd>
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+ffffffff801050f5:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+      continue;
+ffffffff801050fa:	eb 27                	jmp    ffffffff80105123 <mpinit+0x1cd>
+    default:
+      cprintf("mpinit: unknown config type %x\n", *p);
+ffffffff801050fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105100:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80105103:	0f b6 c0             	movzbl %al,%eax
+ffffffff80105106:	89 c6                	mov    %eax,%esi
+ffffffff80105108:	48 c7 c7 d0 a9 10 80 	mov    $0xffffffff8010a9d0,%rdi
+ffffffff8010510f:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80105114:	e8 8b b4 ff ff       	call   ffffffff801005a4 <cprintf>
+      ismp = 0;
+ffffffff80105119:	c7 05 3d de 00 00 00 	movl   $0x0,0xde3d(%rip)        # ffffffff80112f60 <ismp>
+ffffffff80105120:	00 00 00 
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+ffffffff80105123:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105127:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+ffffffff8010512b:	0f 82 a1 fe ff ff    	jb     ffffffff80104fd2 <mpinit+0x7c>
+    }
+  }
+  if(!ismp){
+ffffffff80105131:	8b 05 29 de 00 00    	mov    0xde29(%rip),%eax        # ffffffff80112f60 <ismp>
+ffffffff80105137:	85 c0                	test   %eax,%eax
+ffffffff80105139:	75 1e                	jne    ffffffff80105159 <mpinit+0x203>
+    // Didn't like what we found; fall back to no MP.
+    ncpu = 1;
+ffffffff8010513b:	c7 05 1f de 00 00 01 	movl   $0x1,0xde1f(%rip)        # ffffffff80112f64 <ncpu>
+ffffffff80105142:	00 00 00 
+    lapic = 0;
+ffffffff80105145:	48 c7 05 70 d5 00 00 	movq   $0x0,0xd570(%rip)        # ffffffff801126c0 <lapic>
+ffffffff8010514c:	00 00 00 00 
+    ioapicid = 0;
+ffffffff80105150:	c6 05 11 de 00 00 00 	movb   $0x0,0xde11(%rip)        # ffffffff80112f68 <ioapicid>
+    return;
+ffffffff80105157:	eb 3a                	jmp    ffffffff80105193 <mpinit+0x23d>
+  }
+
+  if(mp->imcrp){
+ffffffff80105159:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff8010515d:	0f b6 40 0c          	movzbl 0xc(%rax),%eax
+ffffffff80105161:	84 c0                	test   %al,%al
+ffffffff80105163:	74 2e                	je     ffffffff80105193 <mpinit+0x23d>
+    // it would run on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+ffffffff80105165:	be 70 00 00 00       	mov    $0x70,%esi
+ffffffff8010516a:	bf 22 00 00 00       	mov    $0x22,%edi
+ffffffff8010516f:	e8 55 fb ff ff       	call   ffffffff80104cc9 <outb>
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+ffffffff80105174:	bf 23 00 00 00       	mov    $0x23,%edi
+ffffffff80105179:	e8 2d fb ff ff       	call   ffffffff80104cab <inb>
+ffffffff8010517e:	83 c8 01             	or     $0x1,%eax
+ffffffff80105181:	0f b6 c0             	movzbl %al,%eax
+ffffffff80105184:	89 c6                	mov    %eax,%esi
+ffffffff80105186:	bf 23 00 00 00       	mov    $0x23,%edi
+ffffffff8010518b:	e8 39 fb ff ff       	call   ffffffff80104cc9 <outb>
+ffffffff80105190:	eb 01                	jmp    ffffffff80105193 <mpinit+0x23d>
+    return;
+ffffffff80105192:	90                   	nop
+  }
+}
+ffffffff80105193:	c9                   	leave
+ffffffff80105194:	c3                   	ret
+
+ffffffff80105195 <p2v>:
+ffffffff80105195:	55                   	push   %rbp
+ffffffff80105196:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105199:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff8010519d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff801051a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801051a5:	48 05 00 00 00 80    	add    $0xffffffff80000000,%rax
+ffffffff801051ab:	c9                   	leave
+ffffffff801051ac:	c3                   	ret
+
+ffffffff801051ad <scan_rdsp>:
+extern struct cpu cpus[NCPU];
+extern int ismp;
+extern int ncpu;
+extern uchar ioapicid;
+
+static struct acpi_rdsp *scan_rdsp(uint base, uint len) {
+ffffffff801051ad:	55                   	push   %rbp
+ffffffff801051ae:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801051b1:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801051b5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ffffffff801051b8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  uchar *p;
+  for (p = p2v(base); len >= sizeof(struct acpi_rdsp); len -= 4, p += 4) {
+ffffffff801051bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff801051be:	48 89 c7             	mov    %rax,%rdi
+ffffffff801051c1:	e8 cf ff ff ff       	call   ffffffff80105195 <p2v>
+ffffffff801051c6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff801051ca:	eb 62                	jmp    ffffffff8010522e <scan_rdsp+0x81>
+    if (memcmp(p, SIG_RDSP, 8) == 0) {
+ffffffff801051cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801051d0:	ba 08 00 00 00       	mov    $0x8,%edx
+ffffffff801051d5:	48 c7 c6 f0 a9 10 80 	mov    $0xffffffff8010a9f0,%rsi
+ffffffff801051dc:	48 89 c7             	mov    %rax,%rdi
+ffffffff801051df:	e8 db 1b 00 00       	call   ffffffff80106dbf <memcmp>
+ffffffff801051e4:	85 c0                	test   %eax,%eax
+ffffffff801051e6:	75 3d                	jne    ffffffff80105225 <scan_rdsp+0x78>
+      uint sum, n;
+      for (sum = 0, n = 0; n < 20; n++)
+ffffffff801051e8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+ffffffff801051ef:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+ffffffff801051f6:	eb 17                	jmp    ffffffff8010520f <scan_rdsp+0x62>
+        sum += p[n];
+ffffffff801051f8:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ffffffff801051fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801051ff:	48 01 d0             	add    %rdx,%rax
+ffffffff80105202:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80105205:	0f b6 c0             	movzbl %al,%eax
+ffffffff80105208:	01 45 f4             	add    %eax,-0xc(%rbp)
+      for (sum = 0, n = 0; n < 20; n++)
+ffffffff8010520b:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+ffffffff8010520f:	83 7d f0 13          	cmpl   $0x13,-0x10(%rbp)
+ffffffff80105213:	76 e3                	jbe    ffffffff801051f8 <scan_rdsp+0x4b>
+      if ((sum & 0xff) == 0)
+ffffffff80105215:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80105218:	0f b6 c0             	movzbl %al,%eax
+ffffffff8010521b:	85 c0                	test   %eax,%eax
+ffffffff8010521d:	75 06                	jne    ffffffff80105225 <scan_rdsp+0x78>
+        return (struct acpi_rdsp *) p;
+ffffffff8010521f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105223:	eb 14                	jmp    ffffffff80105239 <scan_rdsp+0x8c>
+  for (p = p2v(base); len >= sizeof(struct acpi_rdsp); len -= 4, p += 4) {
+ffffffff80105225:	83 6d e8 04          	subl   $0x4,-0x18(%rbp)
+ffffffff80105229:	48 83 45 f8 04       	addq   $0x4,-0x8(%rbp)
+ffffffff8010522e:	83 7d e8 23          	cmpl   $0x23,-0x18(%rbp)
+ffffffff80105232:	77 98                	ja     ffffffff801051cc <scan_rdsp+0x1f>
+    }
+  }
+  return (struct acpi_rdsp *) 0;  
+ffffffff80105234:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80105239:	c9                   	leave
+ffffffff8010523a:	c3                   	ret
+
+ffffffff8010523b <find_rdsp>:
+
+static struct acpi_rdsp *find_rdsp(void) {
+ffffffff8010523b:	55                   	push   %rbp
+ffffffff8010523c:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010523f:	48 83 ec 10          	sub    $0x10,%rsp
+  struct acpi_rdsp *rdsp;
+  uintp pa;
+  pa = *((ushort*) P2V(0x40E)) << 4; // EBDA
+ffffffff80105243:	48 c7 c0 0e 04 00 80 	mov    $0xffffffff8000040e,%rax
+ffffffff8010524a:	0f b7 00             	movzwl (%rax),%eax
+ffffffff8010524d:	0f b7 c0             	movzwl %ax,%eax
+ffffffff80105250:	c1 e0 04             	shl    $0x4,%eax
+ffffffff80105253:	48 98                	cltq
+ffffffff80105255:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (pa && (rdsp = scan_rdsp(pa, 1024)))
+ffffffff80105259:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff8010525e:	74 21                	je     ffffffff80105281 <find_rdsp+0x46>
+ffffffff80105260:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105264:	be 00 04 00 00       	mov    $0x400,%esi
+ffffffff80105269:	89 c7                	mov    %eax,%edi
+ffffffff8010526b:	e8 3d ff ff ff       	call   ffffffff801051ad <scan_rdsp>
+ffffffff80105270:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff80105274:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80105279:	74 06                	je     ffffffff80105281 <find_rdsp+0x46>
+    return rdsp;
+ffffffff8010527b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010527f:	eb 0f                	jmp    ffffffff80105290 <find_rdsp+0x55>
+  return scan_rdsp(0xE0000, 0x20000);
+ffffffff80105281:	be 00 00 02 00       	mov    $0x20000,%esi
+ffffffff80105286:	bf 00 00 0e 00       	mov    $0xe0000,%edi
+ffffffff8010528b:	e8 1d ff ff ff       	call   ffffffff801051ad <scan_rdsp>
+} 
+ffffffff80105290:	c9                   	leave
+ffffffff80105291:	c3                   	ret
+
+ffffffff80105292 <acpi_config_smp>:
+
+static int acpi_config_smp(struct acpi_madt *madt) {
+ffffffff80105292:	55                   	push   %rbp
+ffffffff80105293:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105296:	48 83 ec 50          	sub    $0x50,%rsp
+ffffffff8010529a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  uint32 lapic_addr;
+  uint nioapic = 0;
+ffffffff8010529e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  uchar *p, *e;
+
+  if (!madt)
+ffffffff801052a5:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+ffffffff801052aa:	75 0a                	jne    ffffffff801052b6 <acpi_config_smp+0x24>
+    return -1;
+ffffffff801052ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801052b1:	e9 0c 02 00 00       	jmp    ffffffff801054c2 <acpi_config_smp+0x230>
+  if (madt->header.length < sizeof(struct acpi_madt))
+ffffffff801052b6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff801052ba:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff801052bd:	83 f8 2b             	cmp    $0x2b,%eax
+ffffffff801052c0:	77 0a                	ja     ffffffff801052cc <acpi_config_smp+0x3a>
+    return -1;
+ffffffff801052c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801052c7:	e9 f6 01 00 00       	jmp    ffffffff801054c2 <acpi_config_smp+0x230>
+
+  lapic_addr = madt->lapic_addr_phys;
+ffffffff801052cc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff801052d0:	8b 40 24             	mov    0x24(%rax),%eax
+ffffffff801052d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+
+  p = madt->table;
+ffffffff801052d6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff801052da:	48 83 c0 2c          	add    $0x2c,%rax
+ffffffff801052de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  e = p + madt->header.length - sizeof(struct acpi_madt);
+ffffffff801052e2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff801052e6:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff801052e9:	89 c0                	mov    %eax,%eax
+ffffffff801052eb:	48 8d 50 d4          	lea    -0x2c(%rax),%rdx
+ffffffff801052ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801052f3:	48 01 d0             	add    %rdx,%rax
+ffffffff801052f6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  while (p < e) {
+ffffffff801052fa:	e9 78 01 00 00       	jmp    ffffffff80105477 <acpi_config_smp+0x1e5>
+    uint len;
+    if ((e - p) < 2)
+ffffffff801052ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105303:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+ffffffff80105307:	48 83 f8 01          	cmp    $0x1,%rax
+ffffffff8010530b:	0f 8e 76 01 00 00    	jle    ffffffff80105487 <acpi_config_smp+0x1f5>
+      break;
+    len = p[1];
+ffffffff80105311:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80105315:	48 83 c0 01          	add    $0x1,%rax
+ffffffff80105319:	0f b6 00             	movzbl (%rax),%eax
+ffffffff8010531c:	0f b6 c0             	movzbl %al,%eax
+ffffffff8010531f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if ((e - p) < len)
+ffffffff80105322:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105326:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+ffffffff8010532a:	48 89 c2             	mov    %rax,%rdx
+ffffffff8010532d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80105330:	48 39 c2             	cmp    %rax,%rdx
+ffffffff80105333:	0f 8c 51 01 00 00    	jl     ffffffff8010548a <acpi_config_smp+0x1f8>
+      break;
+    switch (p[0]) {
+ffffffff80105339:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010533d:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80105340:	0f b6 c0             	movzbl %al,%eax
+ffffffff80105343:	85 c0                	test   %eax,%eax
+ffffffff80105345:	74 0e                	je     ffffffff80105355 <acpi_config_smp+0xc3>
+ffffffff80105347:	83 f8 01             	cmp    $0x1,%eax
+ffffffff8010534a:	0f 84 ac 00 00 00    	je     ffffffff801053fc <acpi_config_smp+0x16a>
+ffffffff80105350:	e9 1b 01 00 00       	jmp    ffffffff80105470 <acpi_config_smp+0x1de>
+    case TYPE_LAPIC: {
+      struct madt_lapic *lapic = (void*) p;
+ffffffff80105355:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80105359:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      if (len < sizeof(*lapic))
+ffffffff8010535d:	83 7d dc 07          	cmpl   $0x7,-0x24(%rbp)
+ffffffff80105361:	0f 86 02 01 00 00    	jbe    ffffffff80105469 <acpi_config_smp+0x1d7>
+        break;
+      if (!(lapic->flags & APIC_LAPIC_ENABLED))
+ffffffff80105367:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff8010536b:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff8010536e:	83 e0 01             	and    $0x1,%eax
+ffffffff80105371:	85 c0                	test   %eax,%eax
+ffffffff80105373:	0f 84 f3 00 00 00    	je     ffffffff8010546c <acpi_config_smp+0x1da>
+        break;
+      cprintf("acpi: cpu#%d apicid %d\n", ncpu, lapic->apic_id);
+ffffffff80105379:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff8010537d:	0f b6 40 03          	movzbl 0x3(%rax),%eax
+ffffffff80105381:	0f b6 d0             	movzbl %al,%edx
+ffffffff80105384:	8b 05 da db 00 00    	mov    0xdbda(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff8010538a:	89 c6                	mov    %eax,%esi
+ffffffff8010538c:	48 c7 c7 f9 a9 10 80 	mov    $0xffffffff8010a9f9,%rdi
+ffffffff80105393:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80105398:	e8 07 b2 ff ff       	call   ffffffff801005a4 <cprintf>
+      cpus[ncpu].id = ncpu;
+ffffffff8010539d:	8b 15 c1 db 00 00    	mov    0xdbc1(%rip),%edx        # ffffffff80112f64 <ncpu>
+ffffffff801053a3:	8b 05 bb db 00 00    	mov    0xdbbb(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff801053a9:	89 d1                	mov    %edx,%ecx
+ffffffff801053ab:	48 63 d0             	movslq %eax,%rdx
+ffffffff801053ae:	48 89 d0             	mov    %rdx,%rax
+ffffffff801053b1:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff801053b5:	48 29 d0             	sub    %rdx,%rax
+ffffffff801053b8:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff801053bc:	48 05 e0 27 11 80    	add    $0xffffffff801127e0,%rax
+ffffffff801053c2:	88 08                	mov    %cl,(%rax)
+      cpus[ncpu].apicid = lapic->apic_id;
+ffffffff801053c4:	8b 15 9a db 00 00    	mov    0xdb9a(%rip),%edx        # ffffffff80112f64 <ncpu>
+ffffffff801053ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff801053ce:	0f b6 48 03          	movzbl 0x3(%rax),%ecx
+ffffffff801053d2:	48 63 d2             	movslq %edx,%rdx
+ffffffff801053d5:	48 89 d0             	mov    %rdx,%rax
+ffffffff801053d8:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff801053dc:	48 29 d0             	sub    %rdx,%rax
+ffffffff801053df:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff801053e3:	48 05 e1 27 11 80    	add    $0xffffffff801127e1,%rax
+ffffffff801053e9:	88 08                	mov    %cl,(%rax)
+      ncpu++;
+ffffffff801053eb:	8b 05 73 db 00 00    	mov    0xdb73(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff801053f1:	83 c0 01             	add    $0x1,%eax
+ffffffff801053f4:	89 05 6a db 00 00    	mov    %eax,0xdb6a(%rip)        # ffffffff80112f64 <ncpu>
+      break;
+ffffffff801053fa:	eb 74                	jmp    ffffffff80105470 <acpi_config_smp+0x1de>
+    }
+    case TYPE_IOAPIC: {
+      struct madt_ioapic *ioapic = (void*) p;
+ffffffff801053fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80105400:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+      if (len < sizeof(*ioapic))
+ffffffff80105404:	83 7d dc 0b          	cmpl   $0xb,-0x24(%rbp)
+ffffffff80105408:	76 65                	jbe    ffffffff8010546f <acpi_config_smp+0x1dd>
+        break;
+      cprintf("acpi: ioapic#%d @%x id=%d base=%d\n",
+ffffffff8010540a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff8010540e:	8b 70 08             	mov    0x8(%rax),%esi
+        nioapic, ioapic->addr, ioapic->id, ioapic->interrupt_base);
+ffffffff80105411:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80105415:	0f b6 40 02          	movzbl 0x2(%rax),%eax
+      cprintf("acpi: ioapic#%d @%x id=%d base=%d\n",
+ffffffff80105419:	0f b6 c8             	movzbl %al,%ecx
+ffffffff8010541c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80105420:	8b 50 04             	mov    0x4(%rax),%edx
+ffffffff80105423:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80105426:	41 89 f0             	mov    %esi,%r8d
+ffffffff80105429:	89 c6                	mov    %eax,%esi
+ffffffff8010542b:	48 c7 c7 18 aa 10 80 	mov    $0xffffffff8010aa18,%rdi
+ffffffff80105432:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80105437:	e8 68 b1 ff ff       	call   ffffffff801005a4 <cprintf>
+      if (nioapic) {
+ffffffff8010543c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80105440:	74 13                	je     ffffffff80105455 <acpi_config_smp+0x1c3>
+        cprintf("warning: multiple ioapics are not supported");
+ffffffff80105442:	48 c7 c7 40 aa 10 80 	mov    $0xffffffff8010aa40,%rdi
+ffffffff80105449:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010544e:	e8 51 b1 ff ff       	call   ffffffff801005a4 <cprintf>
+ffffffff80105453:	eb 0e                	jmp    ffffffff80105463 <acpi_config_smp+0x1d1>
+      } else {
+        ioapicid = ioapic->id;
+ffffffff80105455:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80105459:	0f b6 40 02          	movzbl 0x2(%rax),%eax
+ffffffff8010545d:	88 05 05 db 00 00    	mov    %al,0xdb05(%rip)        # ffffffff80112f68 <ioapicid>
+      }
+      nioapic++;
+ffffffff80105463:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+      break;
+ffffffff80105467:	eb 07                	jmp    ffffffff80105470 <acpi_config_smp+0x1de>
+        break;
+ffffffff80105469:	90                   	nop
+ffffffff8010546a:	eb 04                	jmp    ffffffff80105470 <acpi_config_smp+0x1de>
+        break;
+ffffffff8010546c:	90                   	nop
+ffffffff8010546d:	eb 01                	jmp    ffffffff80105470 <acpi_config_smp+0x1de>
+        break;
+ffffffff8010546f:	90                   	nop
+    }
+    }
+    p += len;
+ffffffff80105470:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80105473:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  while (p < e) {
+ffffffff80105477:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010547b:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+ffffffff8010547f:	0f 82 7a fe ff ff    	jb     ffffffff801052ff <acpi_config_smp+0x6d>
+ffffffff80105485:	eb 04                	jmp    ffffffff8010548b <acpi_config_smp+0x1f9>
+      break;
+ffffffff80105487:	90                   	nop
+ffffffff80105488:	eb 01                	jmp    ffffffff8010548b <acpi_config_smp+0x1f9>
+      break;
+ffffffff8010548a:	90                   	nop
+  }
+
+  if (ncpu) {
+ffffffff8010548b:	8b 05 d3 da 00 00    	mov    0xdad3(%rip),%eax        # ffffffff80112f64 <ncpu>
+ffffffff80105491:	85 c0                	test   %eax,%eax
+ffffffff80105493:	74 28                	je     ffffffff801054bd <acpi_config_smp+0x22b>
+    ismp = 1;
+ffffffff80105495:	c7 05 c1 da 00 00 01 	movl   $0x1,0xdac1(%rip)        # ffffffff80112f60 <ismp>
+ffffffff8010549c:	00 00 00 
+    lapic = IO2V(((uintp)lapic_addr));
+ffffffff8010549f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff801054a2:	48 ba 00 00 00 42 fe 	movabs $0xfffffffe42000000,%rdx
+ffffffff801054a9:	ff ff ff 
+ffffffff801054ac:	48 01 d0             	add    %rdx,%rax
+ffffffff801054af:	48 89 05 0a d2 00 00 	mov    %rax,0xd20a(%rip)        # ffffffff801126c0 <lapic>
+    return 0;
+ffffffff801054b6:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801054bb:	eb 05                	jmp    ffffffff801054c2 <acpi_config_smp+0x230>
+  }
+
+  return -1;
+ffffffff801054bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff801054c2:	c9                   	leave
+ffffffff801054c3:	c3                   	ret
+
+ffffffff801054c4 <acpiinit>:
+#define PHYSLIMIT 0x80000000
+#else
+#define PHYSLIMIT 0x0E000000
+#endif
+
+int acpiinit(void) {
+ffffffff801054c4:	55                   	push   %rbp
+ffffffff801054c5:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801054c8:	48 83 ec 30          	sub    $0x30,%rsp
+  unsigned n, count;
+  struct acpi_rdsp *rdsp;
+  struct acpi_rsdt *rsdt;
+  struct acpi_madt *madt = 0;
+ffffffff801054cc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+ffffffff801054d3:	00 
+
+  rdsp = find_rdsp();
+ffffffff801054d4:	e8 62 fd ff ff       	call   ffffffff8010523b <find_rdsp>
+ffffffff801054d9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (rdsp->rsdt_addr_phys > PHYSLIMIT)
+ffffffff801054dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801054e1:	8b 40 10             	mov    0x10(%rax),%eax
+ffffffff801054e4:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+ffffffff801054e9:	0f 87 a3 00 00 00    	ja     ffffffff80105592 <acpiinit+0xce>
+    goto notmapped;
+  rsdt = p2v(rdsp->rsdt_addr_phys);
+ffffffff801054ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801054f3:	8b 40 10             	mov    0x10(%rax),%eax
+ffffffff801054f6:	89 c0                	mov    %eax,%eax
+ffffffff801054f8:	48 89 c7             	mov    %rax,%rdi
+ffffffff801054fb:	e8 95 fc ff ff       	call   ffffffff80105195 <p2v>
+ffffffff80105500:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  count = (rsdt->header.length - sizeof(*rsdt)) / 4;
+ffffffff80105504:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105508:	8b 40 04             	mov    0x4(%rax),%eax
+ffffffff8010550b:	89 c0                	mov    %eax,%eax
+ffffffff8010550d:	48 83 e8 24          	sub    $0x24,%rax
+ffffffff80105511:	48 c1 e8 02          	shr    $0x2,%rax
+ffffffff80105515:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  for (n = 0; n < count; n++) {
+ffffffff80105518:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff8010551f:	eb 5b                	jmp    ffffffff8010557c <acpiinit+0xb8>
+    struct acpi_desc_header *hdr = p2v(rsdt->entry[n]);
+ffffffff80105521:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105525:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80105528:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff8010552c:	8b 44 90 04          	mov    0x4(%rax,%rdx,4),%eax
+ffffffff80105530:	89 c0                	mov    %eax,%eax
+ffffffff80105532:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105535:	e8 5b fc ff ff       	call   ffffffff80105195 <p2v>
+ffffffff8010553a:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    if (rsdt->entry[n] > PHYSLIMIT)
+ffffffff8010553e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105542:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80105545:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff80105549:	8b 44 90 04          	mov    0x4(%rax,%rdx,4),%eax
+ffffffff8010554d:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+ffffffff80105552:	77 41                	ja     ffffffff80105595 <acpiinit+0xd1>
+    memmove(creator, hdr->creator_id, 4); creator[4] = 0;
+    cprintf("acpi: %s %s %s %x %s %x\n",
+      sig, id, tableid, hdr->oem_revision,
+      creator, hdr->creator_revision);
+#endif
+    if (!memcmp(hdr->signature, SIG_MADT, 4))
+ffffffff80105554:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80105558:	ba 04 00 00 00       	mov    $0x4,%edx
+ffffffff8010555d:	48 c7 c6 6c aa 10 80 	mov    $0xffffffff8010aa6c,%rsi
+ffffffff80105564:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105567:	e8 53 18 00 00       	call   ffffffff80106dbf <memcmp>
+ffffffff8010556c:	85 c0                	test   %eax,%eax
+ffffffff8010556e:	75 08                	jne    ffffffff80105578 <acpiinit+0xb4>
+      madt = (void*) hdr;
+ffffffff80105570:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80105574:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (n = 0; n < count; n++) {
+ffffffff80105578:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff8010557c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010557f:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+ffffffff80105582:	72 9d                	jb     ffffffff80105521 <acpiinit+0x5d>
+  }
+
+  return acpi_config_smp(madt);
+ffffffff80105584:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80105588:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010558b:	e8 02 fd ff ff       	call   ffffffff80105292 <acpi_config_smp>
+ffffffff80105590:	eb 1f                	jmp    ffffffff801055b1 <acpiinit+0xed>
+    goto notmapped;
+ffffffff80105592:	90                   	nop
+ffffffff80105593:	eb 01                	jmp    ffffffff80105596 <acpiinit+0xd2>
+      goto notmapped;
+ffffffff80105595:	90                   	nop
+
+notmapped:
+  cprintf("acpi: tables above 0x%x not mapped.\n", PHYSLIMIT);
+ffffffff80105596:	be 00 00 00 80       	mov    $0x80000000,%esi
+ffffffff8010559b:	48 c7 c7 78 aa 10 80 	mov    $0xffffffff8010aa78,%rdi
+ffffffff801055a2:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801055a7:	e8 f8 af ff ff       	call   ffffffff801005a4 <cprintf>
+  return -1;
+ffffffff801055ac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff801055b1:	c9                   	leave
+ffffffff801055b2:	c3                   	ret
+
+ffffffff801055b3 <outb>:
+{
+ffffffff801055b3:	55                   	push   %rbp
+ffffffff801055b4:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801055b7:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff801055bb:	89 fa                	mov    %edi,%edx
+ffffffff801055bd:	89 f0                	mov    %esi,%eax
+ffffffff801055bf:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+ffffffff801055c3:	88 45 f8             	mov    %al,-0x8(%rbp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+ffffffff801055c6:	0f b6 45 f8          	movzbl -0x8(%rbp),%eax
+ffffffff801055ca:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+ffffffff801055ce:	ee                   	out    %al,(%dx)
+}
+ffffffff801055cf:	90                   	nop
+ffffffff801055d0:	c9                   	leave
+ffffffff801055d1:	c3                   	ret
+
+ffffffff801055d2 <picsetmask>:
+// Initial IRQ mask has interrupt 2 enabled (for slave 8259A).
+static ushort irqmask = 0xFFFF & ~(1<<IRQ_SLAVE);
+
+static void
+picsetmask(ushort mask)
+{
+ffffffff801055d2:	55                   	push   %rbp
+ffffffff801055d3:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801055d6:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff801055da:	89 f8                	mov    %edi,%eax
+ffffffff801055dc:	66 89 45 fc          	mov    %ax,-0x4(%rbp)
+  irqmask = mask;
+ffffffff801055e0:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+ffffffff801055e4:	66 89 05 55 5f 00 00 	mov    %ax,0x5f55(%rip)        # ffffffff8010b540 <irqmask>
+  outb(IO_PIC1+1, mask);
+ffffffff801055eb:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+ffffffff801055ef:	0f b6 c0             	movzbl %al,%eax
+ffffffff801055f2:	89 c6                	mov    %eax,%esi
+ffffffff801055f4:	bf 21 00 00 00       	mov    $0x21,%edi
+ffffffff801055f9:	e8 b5 ff ff ff       	call   ffffffff801055b3 <outb>
+  outb(IO_PIC2+1, mask >> 8);
+ffffffff801055fe:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+ffffffff80105602:	66 c1 e8 08          	shr    $0x8,%ax
+ffffffff80105606:	0f b6 c0             	movzbl %al,%eax
+ffffffff80105609:	89 c6                	mov    %eax,%esi
+ffffffff8010560b:	bf a1 00 00 00       	mov    $0xa1,%edi
+ffffffff80105610:	e8 9e ff ff ff       	call   ffffffff801055b3 <outb>
+}
+ffffffff80105615:	90                   	nop
+ffffffff80105616:	c9                   	leave
+ffffffff80105617:	c3                   	ret
+
+ffffffff80105618 <picenable>:
+
+void
+picenable(int irq)
+{
+ffffffff80105618:	55                   	push   %rbp
+ffffffff80105619:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010561c:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80105620:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  picsetmask(irqmask & ~(1<<irq));
+ffffffff80105623:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80105626:	ba 01 00 00 00       	mov    $0x1,%edx
+ffffffff8010562b:	89 c1                	mov    %eax,%ecx
+ffffffff8010562d:	d3 e2                	shl    %cl,%edx
+ffffffff8010562f:	89 d0                	mov    %edx,%eax
+ffffffff80105631:	f7 d0                	not    %eax
+ffffffff80105633:	89 c2                	mov    %eax,%edx
+ffffffff80105635:	0f b7 05 04 5f 00 00 	movzwl 0x5f04(%rip),%eax        # ffffffff8010b540 <irqmask>
+ffffffff8010563c:	21 d0                	and    %edx,%eax
+ffffffff8010563e:	0f b7 c0             	movzwl %ax,%eax
+ffffffff80105641:	89 c7                	mov    %eax,%edi
+ffffffff80105643:	e8 8a ff ff ff       	call   ffffffff801055d2 <picsetmask>
+}
+ffffffff80105648:	90                   	nop
+ffffffff80105649:	c9                   	leave
+ffffffff8010564a:	c3                   	ret
+
+ffffffff8010564b <picinit>:
+
+// Initialize the 8259A interrupt controllers.
+void
+picinit(void)
+{
+ffffffff8010564b:	55                   	push   %rbp
+ffffffff8010564c:	48 89 e5             	mov    %rsp,%rbp
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+ffffffff8010564f:	be ff 00 00 00       	mov    $0xff,%esi
+ffffffff80105654:	bf 21 00 00 00       	mov    $0x21,%edi
+ffffffff80105659:	e8 55 ff ff ff       	call   ffffffff801055b3 <outb>
+  outb(IO_PIC2+1, 0xFF);
+ffffffff8010565e:	be ff 00 00 00       	mov    $0xff,%esi
+ffffffff80105663:	bf a1 00 00 00       	mov    $0xa1,%edi
+ffffffff80105668:	e8 46 ff ff ff       	call   ffffffff801055b3 <outb>
+
+  // ICW1:  0001g0hi
+  //    g:  0 = edge triggering, 1 = level triggering
+  //    h:  0 = cascaded PICs, 1 = master only
+  //    i:  0 = no ICW4, 1 = ICW4 required
+  outb(IO_PIC1, 0x11);
+ffffffff8010566d:	be 11 00 00 00       	mov    $0x11,%esi
+ffffffff80105672:	bf 20 00 00 00       	mov    $0x20,%edi
+ffffffff80105677:	e8 37 ff ff ff       	call   ffffffff801055b3 <outb>
+
+  // ICW2:  Vector offset
+  outb(IO_PIC1+1, T_IRQ0);
+ffffffff8010567c:	be 20 00 00 00       	mov    $0x20,%esi
+ffffffff80105681:	bf 21 00 00 00       	mov    $0x21,%edi
+ffffffff80105686:	e8 28 ff ff ff       	call   ffffffff801055b3 <outb>
+
+  // ICW3:  (master PIC) bit mask of IR lines connected to slaves
+  //        (slave PIC) 3-bit # of slave's connection to master
+  outb(IO_PIC1+1, 1<<IRQ_SLAVE);
+ffffffff8010568b:	be 04 00 00 00       	mov    $0x4,%esi
+ffffffff80105690:	bf 21 00 00 00       	mov    $0x21,%edi
+ffffffff80105695:	e8 19 ff ff ff       	call   ffffffff801055b3 <outb>
+  //    m:  0 = slave PIC, 1 = master PIC
+  //      (ignored when b is 0, as the master/slave role
+  //      can be hardwired).
+  //    a:  1 = Automatic EOI mode
+  //    p:  0 = MCS-80/85 mode, 1 = intel x86 mode
+  outb(IO_PIC1+1, 0x3);
+ffffffff8010569a:	be 03 00 00 00       	mov    $0x3,%esi
+ffffffff8010569f:	bf 21 00 00 00       	mov    $0x21,%edi
+ffffffff801056a4:	e8 0a ff ff ff       	call   ffffffff801055b3 <outb>
+
+  // Set up slave (8259A-2)
+  outb(IO_PIC2, 0x11);                  // ICW1
+ffffffff801056a9:	be 11 00 00 00       	mov    $0x11,%esi
+ffffffff801056ae:	bf a0 00 00 00       	mov    $0xa0,%edi
+ffffffff801056b3:	e8 fb fe ff ff       	call   ffffffff801055b3 <outb>
+  outb(IO_PIC2+1, T_IRQ0 + 8);      // ICW2
+ffffffff801056b8:	be 28 00 00 00       	mov    $0x28,%esi
+ffffffff801056bd:	bf a1 00 00 00       	mov    $0xa1,%edi
+ffffffff801056c2:	e8 ec fe ff ff       	call   ffffffff801055b3 <outb>
+  outb(IO_PIC2+1, IRQ_SLAVE);           // ICW3
+ffffffff801056c7:	be 02 00 00 00       	mov    $0x2,%esi
+ffffffff801056cc:	bf a1 00 00 00       	mov    $0xa1,%edi
+ffffffff801056d1:	e8 dd fe ff ff       	call   ffffffff801055b3 <outb>
+  // NB Automatic EOI mode doesn't tend to work on the slave.
+  // Linux source code says it's "to be investigated".
+  outb(IO_PIC2+1, 0x3);                 // ICW4
+ffffffff801056d6:	be 03 00 00 00       	mov    $0x3,%esi
+ffffffff801056db:	bf a1 00 00 00       	mov    $0xa1,%edi
+ffffffff801056e0:	e8 ce fe ff ff       	call   ffffffff801055b3 <outb>
+
+  // OCW3:  0ef01prs
+  //   ef:  0x = NOP, 10 = clear specific mask, 11 = set specific mask
+  //    p:  0 = no polling, 1 = polling mode
+  //   rs:  0x = NOP, 10 = read IRR, 11 = read ISR
+  outb(IO_PIC1, 0x68);             // clear specific mask
+ffffffff801056e5:	be 68 00 00 00       	mov    $0x68,%esi
+ffffffff801056ea:	bf 20 00 00 00       	mov    $0x20,%edi
+ffffffff801056ef:	e8 bf fe ff ff       	call   ffffffff801055b3 <outb>
+  outb(IO_PIC1, 0x0a);             // read IRR by default
+ffffffff801056f4:	be 0a 00 00 00       	mov    $0xa,%esi
+ffffffff801056f9:	bf 20 00 00 00       	mov    $0x20,%edi
+ffffffff801056fe:	e8 b0 fe ff ff       	call   ffffffff801055b3 <outb>
+
+  outb(IO_PIC2, 0x68);             // OCW3
+ffffffff80105703:	be 68 00 00 00       	mov    $0x68,%esi
+ffffffff80105708:	bf a0 00 00 00       	mov    $0xa0,%edi
+ffffffff8010570d:	e8 a1 fe ff ff       	call   ffffffff801055b3 <outb>
+  outb(IO_PIC2, 0x0a);             // OCW3
+ffffffff80105712:	be 0a 00 00 00       	mov    $0xa,%esi
+ffffffff80105717:	bf a0 00 00 00       	mov    $0xa0,%edi
+ffffffff8010571c:	e8 92 fe ff ff       	call   ffffffff801055b3 <outb>
+
+  if(irqmask != 0xFFFF)
+ffffffff80105721:	0f b7 05 18 5e 00 00 	movzwl 0x5e18(%rip),%eax        # ffffffff8010b540 <irqmask>
+ffffffff80105728:	66 83 f8 ff          	cmp    $0xffff,%ax
+ffffffff8010572c:	74 11                	je     ffffffff8010573f <picinit+0xf4>
+    picsetmask(irqmask);
+ffffffff8010572e:	0f b7 05 0b 5e 00 00 	movzwl 0x5e0b(%rip),%eax        # ffffffff8010b540 <irqmask>
+ffffffff80105735:	0f b7 c0             	movzwl %ax,%eax
+ffffffff80105738:	89 c7                	mov    %eax,%edi
+ffffffff8010573a:	e8 93 fe ff ff       	call   ffffffff801055d2 <picsetmask>
+}
+ffffffff8010573f:	90                   	nop
+ffffffff80105740:	5d                   	pop    %rbp
+ffffffff80105741:	c3                   	ret
+
+ffffffff80105742 <pipealloc>:
+  int writeopen;  // write fd is still open
+};
+
+int
+pipealloc(struct file **f0, struct file **f1)
+{
+ffffffff80105742:	55                   	push   %rbp
+ffffffff80105743:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105746:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff8010574a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff8010574e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct pipe *p;
+
+  p = 0;
+ffffffff80105752:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+ffffffff80105759:	00 
+  *f0 = *f1 = 0;
+ffffffff8010575a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010575e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+ffffffff80105765:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105769:	48 8b 10             	mov    (%rax),%rdx
+ffffffff8010576c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105770:	48 89 10             	mov    %rdx,(%rax)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+ffffffff80105773:	e8 03 c7 ff ff       	call   ffffffff80101e7b <filealloc>
+ffffffff80105778:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff8010577c:	48 89 02             	mov    %rax,(%rdx)
+ffffffff8010577f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105783:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105786:	48 85 c0             	test   %rax,%rax
+ffffffff80105789:	0f 84 e6 00 00 00    	je     ffffffff80105875 <pipealloc+0x133>
+ffffffff8010578f:	e8 e7 c6 ff ff       	call   ffffffff80101e7b <filealloc>
+ffffffff80105794:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ffffffff80105798:	48 89 02             	mov    %rax,(%rdx)
+ffffffff8010579b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010579f:	48 8b 00             	mov    (%rax),%rax
+ffffffff801057a2:	48 85 c0             	test   %rax,%rax
+ffffffff801057a5:	0f 84 ca 00 00 00    	je     ffffffff80105875 <pipealloc+0x133>
+    goto bad;
+  if((p = (struct pipe*)kalloc()) == 0)
+ffffffff801057ab:	e8 b4 e5 ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff801057b0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff801057b4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff801057b9:	0f 84 b9 00 00 00    	je     ffffffff80105878 <pipealloc+0x136>
+    goto bad;
+  p->readopen = 1;
+ffffffff801057bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801057c3:	c7 80 70 02 00 00 01 	movl   $0x1,0x270(%rax)
+ffffffff801057ca:	00 00 00 
+  p->writeopen = 1;
+ffffffff801057cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801057d1:	c7 80 74 02 00 00 01 	movl   $0x1,0x274(%rax)
+ffffffff801057d8:	00 00 00 
+  p->nwrite = 0;
+ffffffff801057db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801057df:	c7 80 6c 02 00 00 00 	movl   $0x0,0x26c(%rax)
+ffffffff801057e6:	00 00 00 
+  p->nread = 0;
+ffffffff801057e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801057ed:	c7 80 68 02 00 00 00 	movl   $0x0,0x268(%rax)
+ffffffff801057f4:	00 00 00 
+  initlock(&p->lock, "pipe");
+ffffffff801057f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801057fb:	48 c7 c6 9d aa 10 80 	mov    $0xffffffff8010aa9d,%rsi
+ffffffff80105802:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105805:	e8 90 11 00 00       	call   ffffffff8010699a <initlock>
+  (*f0)->type = FD_PIPE;
+ffffffff8010580a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010580e:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105811:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  (*f0)->readable = 1;
+ffffffff80105817:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010581b:	48 8b 00             	mov    (%rax),%rax
+ffffffff8010581e:	c6 40 08 01          	movb   $0x1,0x8(%rax)
+  (*f0)->writable = 0;
+ffffffff80105822:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105826:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105829:	c6 40 09 00          	movb   $0x0,0x9(%rax)
+  (*f0)->pipe = p;
+ffffffff8010582d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105831:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105834:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80105838:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  (*f1)->type = FD_PIPE;
+ffffffff8010583c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105840:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105843:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  (*f1)->readable = 0;
+ffffffff80105849:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010584d:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105850:	c6 40 08 00          	movb   $0x0,0x8(%rax)
+  (*f1)->writable = 1;
+ffffffff80105854:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105858:	48 8b 00             	mov    (%rax),%rax
+ffffffff8010585b:	c6 40 09 01          	movb   $0x1,0x9(%rax)
+  (*f1)->pipe = p;
+ffffffff8010585f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105863:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105866:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff8010586a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  return 0;
+ffffffff8010586e:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80105873:	eb 52                	jmp    ffffffff801058c7 <pipealloc+0x185>
+    goto bad;
+ffffffff80105875:	90                   	nop
+ffffffff80105876:	eb 01                	jmp    ffffffff80105879 <pipealloc+0x137>
+    goto bad;
+ffffffff80105878:	90                   	nop
+
+//PAGEBREAK: 20
+ bad:
+  if(p)
+ffffffff80105879:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff8010587e:	74 0c                	je     ffffffff8010588c <pipealloc+0x14a>
+    kfree((char*)p);
+ffffffff80105880:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105884:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105887:	e8 2e e4 ff ff       	call   ffffffff80103cba <kfree>
+  if(*f0)
+ffffffff8010588c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105890:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105893:	48 85 c0             	test   %rax,%rax
+ffffffff80105896:	74 0f                	je     ffffffff801058a7 <pipealloc+0x165>
+    fileclose(*f0);
+ffffffff80105898:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010589c:	48 8b 00             	mov    (%rax),%rax
+ffffffff8010589f:	48 89 c7             	mov    %rax,%rdi
+ffffffff801058a2:	e8 91 c6 ff ff       	call   ffffffff80101f38 <fileclose>
+  if(*f1)
+ffffffff801058a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff801058ab:	48 8b 00             	mov    (%rax),%rax
+ffffffff801058ae:	48 85 c0             	test   %rax,%rax
+ffffffff801058b1:	74 0f                	je     ffffffff801058c2 <pipealloc+0x180>
+    fileclose(*f1);
+ffffffff801058b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff801058b7:	48 8b 00             	mov    (%rax),%rax
+ffffffff801058ba:	48 89 c7             	mov    %rax,%rdi
+ffffffff801058bd:	e8 76 c6 ff ff       	call   ffffffff80101f38 <fileclose>
+  return -1;
+ffffffff801058c2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff801058c7:	c9                   	leave
+ffffffff801058c8:	c3                   	ret
+
+ffffffff801058c9 <pipeclose>:
+
+void
+pipeclose(struct pipe *p, int writable)
+{
+ffffffff801058c9:	55                   	push   %rbp
+ffffffff801058ca:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801058cd:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff801058d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff801058d5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  acquire(&p->lock);
+ffffffff801058d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801058dc:	48 89 c7             	mov    %rax,%rdi
+ffffffff801058df:	e8 eb 10 00 00       	call   ffffffff801069cf <acquire>
+  if(writable){
+ffffffff801058e4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ffffffff801058e8:	74 22                	je     ffffffff8010590c <pipeclose+0x43>
+    p->writeopen = 0;
+ffffffff801058ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801058ee:	c7 80 74 02 00 00 00 	movl   $0x0,0x274(%rax)
+ffffffff801058f5:	00 00 00 
+    wakeup(&p->nread);
+ffffffff801058f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801058fc:	48 05 68 02 00 00    	add    $0x268,%rax
+ffffffff80105902:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105905:	e8 5a 0e 00 00       	call   ffffffff80106764 <wakeup>
+ffffffff8010590a:	eb 20                	jmp    ffffffff8010592c <pipeclose+0x63>
+  } else {
+    p->readopen = 0;
+ffffffff8010590c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105910:	c7 80 70 02 00 00 00 	movl   $0x0,0x270(%rax)
+ffffffff80105917:	00 00 00 
+    wakeup(&p->nwrite);
+ffffffff8010591a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010591e:	48 05 6c 02 00 00    	add    $0x26c,%rax
+ffffffff80105924:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105927:	e8 38 0e 00 00       	call   ffffffff80106764 <wakeup>
+  }
+  if(p->readopen == 0 && p->writeopen == 0){
+ffffffff8010592c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105930:	8b 80 70 02 00 00    	mov    0x270(%rax),%eax
+ffffffff80105936:	85 c0                	test   %eax,%eax
+ffffffff80105938:	75 28                	jne    ffffffff80105962 <pipeclose+0x99>
+ffffffff8010593a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010593e:	8b 80 74 02 00 00    	mov    0x274(%rax),%eax
+ffffffff80105944:	85 c0                	test   %eax,%eax
+ffffffff80105946:	75 1a                	jne    ffffffff80105962 <pipeclose+0x99>
+    release(&p->lock);
+ffffffff80105948:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010594c:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010594f:	e8 52 11 00 00       	call   ffffffff80106aa6 <release>
+    kfree((char*)p);
+ffffffff80105954:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105958:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010595b:	e8 5a e3 ff ff       	call   ffffffff80103cba <kfree>
+ffffffff80105960:	eb 0d                	jmp    ffffffff8010596f <pipeclose+0xa6>
+  } else
+    release(&p->lock);
+ffffffff80105962:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105966:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105969:	e8 38 11 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff8010596e:	90                   	nop
+ffffffff8010596f:	90                   	nop
+ffffffff80105970:	c9                   	leave
+ffffffff80105971:	c3                   	ret
+
+ffffffff80105972 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+ffffffff80105972:	55                   	push   %rbp
+ffffffff80105973:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105976:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff8010597a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff8010597e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80105982:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  int i;
+
+  acquire(&p->lock);
+ffffffff80105985:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105989:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010598c:	e8 3e 10 00 00       	call   ffffffff801069cf <acquire>
+  for(i = 0; i < n; i++){
+ffffffff80105991:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80105998:	e9 bc 00 00 00       	jmp    ffffffff80105a59 <pipewrite+0xe7>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+      if(p->readopen == 0 || proc->killed){
+ffffffff8010599d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801059a1:	8b 80 70 02 00 00    	mov    0x270(%rax),%eax
+ffffffff801059a7:	85 c0                	test   %eax,%eax
+ffffffff801059a9:	74 12                	je     ffffffff801059bd <pipewrite+0x4b>
+ffffffff801059ab:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801059b2:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801059b6:	8b 40 40             	mov    0x40(%rax),%eax
+ffffffff801059b9:	85 c0                	test   %eax,%eax
+ffffffff801059bb:	74 16                	je     ffffffff801059d3 <pipewrite+0x61>
+        release(&p->lock);
+ffffffff801059bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801059c1:	48 89 c7             	mov    %rax,%rdi
+ffffffff801059c4:	e8 dd 10 00 00       	call   ffffffff80106aa6 <release>
+        return -1;
+ffffffff801059c9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801059ce:	e9 af 00 00 00       	jmp    ffffffff80105a82 <pipewrite+0x110>
+      }
+      wakeup(&p->nread);
+ffffffff801059d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801059d7:	48 05 68 02 00 00    	add    $0x268,%rax
+ffffffff801059dd:	48 89 c7             	mov    %rax,%rdi
+ffffffff801059e0:	e8 7f 0d 00 00       	call   ffffffff80106764 <wakeup>
+      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+ffffffff801059e5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801059e9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff801059ed:	48 81 c2 6c 02 00 00 	add    $0x26c,%rdx
+ffffffff801059f4:	48 89 c6             	mov    %rax,%rsi
+ffffffff801059f7:	48 89 d7             	mov    %rdx,%rdi
+ffffffff801059fa:	e8 51 0c 00 00       	call   ffffffff80106650 <sleep>
+    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+ffffffff801059ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105a03:	8b 90 6c 02 00 00    	mov    0x26c(%rax),%edx
+ffffffff80105a09:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105a0d:	8b 80 68 02 00 00    	mov    0x268(%rax),%eax
+ffffffff80105a13:	05 00 02 00 00       	add    $0x200,%eax
+ffffffff80105a18:	39 c2                	cmp    %eax,%edx
+ffffffff80105a1a:	74 81                	je     ffffffff8010599d <pipewrite+0x2b>
+    }
+    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+ffffffff80105a1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80105a1f:	48 63 d0             	movslq %eax,%rdx
+ffffffff80105a22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105a26:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+ffffffff80105a2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105a2e:	8b 80 6c 02 00 00    	mov    0x26c(%rax),%eax
+ffffffff80105a34:	8d 48 01             	lea    0x1(%rax),%ecx
+ffffffff80105a37:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff80105a3b:	89 8a 6c 02 00 00    	mov    %ecx,0x26c(%rdx)
+ffffffff80105a41:	25 ff 01 00 00       	and    $0x1ff,%eax
+ffffffff80105a46:	89 c1                	mov    %eax,%ecx
+ffffffff80105a48:	0f b6 16             	movzbl (%rsi),%edx
+ffffffff80105a4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105a4f:	89 c9                	mov    %ecx,%ecx
+ffffffff80105a51:	88 54 08 68          	mov    %dl,0x68(%rax,%rcx,1)
+  for(i = 0; i < n; i++){
+ffffffff80105a55:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80105a59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80105a5c:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+ffffffff80105a5f:	7c 9e                	jl     ffffffff801059ff <pipewrite+0x8d>
+  }
+  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+ffffffff80105a61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105a65:	48 05 68 02 00 00    	add    $0x268,%rax
+ffffffff80105a6b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105a6e:	e8 f1 0c 00 00       	call   ffffffff80106764 <wakeup>
+  release(&p->lock);
+ffffffff80105a73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105a77:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105a7a:	e8 27 10 00 00       	call   ffffffff80106aa6 <release>
+  return n;
+ffffffff80105a7f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+}
+ffffffff80105a82:	c9                   	leave
+ffffffff80105a83:	c3                   	ret
+
+ffffffff80105a84 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+ffffffff80105a84:	55                   	push   %rbp
+ffffffff80105a85:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105a88:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80105a8c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80105a90:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80105a94:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  int i;
+
+  acquire(&p->lock);
+ffffffff80105a97:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105a9b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105a9e:	e8 2c 0f 00 00       	call   ffffffff801069cf <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+ffffffff80105aa3:	eb 42                	jmp    ffffffff80105ae7 <piperead+0x63>
+    if(proc->killed){
+ffffffff80105aa5:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105aac:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105ab0:	8b 40 40             	mov    0x40(%rax),%eax
+ffffffff80105ab3:	85 c0                	test   %eax,%eax
+ffffffff80105ab5:	74 16                	je     ffffffff80105acd <piperead+0x49>
+      release(&p->lock);
+ffffffff80105ab7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105abb:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105abe:	e8 e3 0f 00 00       	call   ffffffff80106aa6 <release>
+      return -1;
+ffffffff80105ac3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80105ac8:	e9 c9 00 00 00       	jmp    ffffffff80105b96 <piperead+0x112>
+    }
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+ffffffff80105acd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105ad1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff80105ad5:	48 81 c2 68 02 00 00 	add    $0x268,%rdx
+ffffffff80105adc:	48 89 c6             	mov    %rax,%rsi
+ffffffff80105adf:	48 89 d7             	mov    %rdx,%rdi
+ffffffff80105ae2:	e8 69 0b 00 00       	call   ffffffff80106650 <sleep>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+ffffffff80105ae7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105aeb:	8b 90 68 02 00 00    	mov    0x268(%rax),%edx
+ffffffff80105af1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105af5:	8b 80 6c 02 00 00    	mov    0x26c(%rax),%eax
+ffffffff80105afb:	39 c2                	cmp    %eax,%edx
+ffffffff80105afd:	75 0e                	jne    ffffffff80105b0d <piperead+0x89>
+ffffffff80105aff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105b03:	8b 80 74 02 00 00    	mov    0x274(%rax),%eax
+ffffffff80105b09:	85 c0                	test   %eax,%eax
+ffffffff80105b0b:	75 98                	jne    ffffffff80105aa5 <piperead+0x21>
+  }
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+ffffffff80105b0d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80105b14:	eb 54                	jmp    ffffffff80105b6a <piperead+0xe6>
+    if(p->nread == p->nwrite)
+ffffffff80105b16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105b1a:	8b 90 68 02 00 00    	mov    0x268(%rax),%edx
+ffffffff80105b20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105b24:	8b 80 6c 02 00 00    	mov    0x26c(%rax),%eax
+ffffffff80105b2a:	39 c2                	cmp    %eax,%edx
+ffffffff80105b2c:	74 46                	je     ffffffff80105b74 <piperead+0xf0>
+      break;
+    addr[i] = p->data[p->nread++ % PIPESIZE];
+ffffffff80105b2e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105b32:	8b 80 68 02 00 00    	mov    0x268(%rax),%eax
+ffffffff80105b38:	8d 48 01             	lea    0x1(%rax),%ecx
+ffffffff80105b3b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff80105b3f:	89 8a 68 02 00 00    	mov    %ecx,0x268(%rdx)
+ffffffff80105b45:	25 ff 01 00 00       	and    $0x1ff,%eax
+ffffffff80105b4a:	89 c1                	mov    %eax,%ecx
+ffffffff80105b4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80105b4f:	48 63 d0             	movslq %eax,%rdx
+ffffffff80105b52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105b56:	48 01 c2             	add    %rax,%rdx
+ffffffff80105b59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105b5d:	89 c9                	mov    %ecx,%ecx
+ffffffff80105b5f:	0f b6 44 08 68       	movzbl 0x68(%rax,%rcx,1),%eax
+ffffffff80105b64:	88 02                	mov    %al,(%rdx)
+  for(i = 0; i < n; i++){  //DOC: piperead-copy
+ffffffff80105b66:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80105b6a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80105b6d:	3b 45 dc             	cmp    -0x24(%rbp),%eax
+ffffffff80105b70:	7c a4                	jl     ffffffff80105b16 <piperead+0x92>
+ffffffff80105b72:	eb 01                	jmp    ffffffff80105b75 <piperead+0xf1>
+      break;
+ffffffff80105b74:	90                   	nop
+  }
+  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+ffffffff80105b75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105b79:	48 05 6c 02 00 00    	add    $0x26c,%rax
+ffffffff80105b7f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105b82:	e8 dd 0b 00 00       	call   ffffffff80106764 <wakeup>
+  release(&p->lock);
+ffffffff80105b87:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80105b8b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105b8e:	e8 13 0f 00 00       	call   ffffffff80106aa6 <release>
+  return i;
+ffffffff80105b93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ffffffff80105b96:	c9                   	leave
+ffffffff80105b97:	c3                   	ret
+
+ffffffff80105b98 <readeflags>:
+{
+ffffffff80105b98:	55                   	push   %rbp
+ffffffff80105b99:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105b9c:	48 83 ec 10          	sub    $0x10,%rsp
+  asm volatile("pushf; pop %0" : "=r" (eflags));
+ffffffff80105ba0:	9c                   	pushf
+ffffffff80105ba1:	58                   	pop    %rax
+ffffffff80105ba2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  return eflags;
+ffffffff80105ba6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80105baa:	c9                   	leave
+ffffffff80105bab:	c3                   	ret
+
+ffffffff80105bac <sti>:
+{
+ffffffff80105bac:	55                   	push   %rbp
+ffffffff80105bad:	48 89 e5             	mov    %rsp,%rbp
+  asm volatile("sti");
+ffffffff80105bb0:	fb                   	sti
+}
+ffffffff80105bb1:	90                   	nop
+ffffffff80105bb2:	5d                   	pop    %rbp
+ffffffff80105bb3:	c3                   	ret
+
+ffffffff80105bb4 <hlt>:
+{
+ffffffff80105bb4:	55                   	push   %rbp
+ffffffff80105bb5:	48 89 e5             	mov    %rsp,%rbp
+  asm volatile("hlt");
+ffffffff80105bb8:	f4                   	hlt
+}
+ffffffff80105bb9:	90                   	nop
+ffffffff80105bba:	5d                   	pop    %rbp
+ffffffff80105bbb:	c3                   	ret
+
+ffffffff80105bbc <pinit>:
+
+static void wakeup1(void *chan);
+
+void
+pinit(void)
+{
+ffffffff80105bbc:	55                   	push   %rbp
+ffffffff80105bbd:	48 89 e5             	mov    %rsp,%rbp
+  initlock(&ptable.lock, "ptable");
+ffffffff80105bc0:	48 c7 c6 a2 aa 10 80 	mov    $0xffffffff8010aaa2,%rsi
+ffffffff80105bc7:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80105bce:	e8 c7 0d 00 00       	call   ffffffff8010699a <initlock>
+}
+ffffffff80105bd3:	90                   	nop
+ffffffff80105bd4:	5d                   	pop    %rbp
+ffffffff80105bd5:	c3                   	ret
+
+ffffffff80105bd6 <allocproc>:
+// If found, change state to EMBRYO and initialize
+// state required to run in the kernel.
+// Otherwise return 0.
+static struct proc*
+allocproc(void)
+{
+ffffffff80105bd6:	55                   	push   %rbp
+ffffffff80105bd7:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105bda:	48 83 ec 10          	sub    $0x10,%rsp
+  struct proc *p;
+  char *sp;
+
+  acquire(&ptable.lock);
+ffffffff80105bde:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80105be5:	e8 e5 0d 00 00       	call   ffffffff801069cf <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+ffffffff80105bea:	48 c7 45 f8 e8 2f 11 	movq   $0xffffffff80112fe8,-0x8(%rbp)
+ffffffff80105bf1:	80 
+ffffffff80105bf2:	eb 13                	jmp    ffffffff80105c07 <allocproc+0x31>
+    if(p->state == UNUSED)
+ffffffff80105bf4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105bf8:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff80105bfb:	85 c0                	test   %eax,%eax
+ffffffff80105bfd:	74 28                	je     ffffffff80105c27 <allocproc+0x51>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+ffffffff80105bff:	48 81 45 f8 e0 00 00 	addq   $0xe0,-0x8(%rbp)
+ffffffff80105c06:	00 
+ffffffff80105c07:	48 81 7d f8 e8 67 11 	cmpq   $0xffffffff801167e8,-0x8(%rbp)
+ffffffff80105c0e:	80 
+ffffffff80105c0f:	72 e3                	jb     ffffffff80105bf4 <allocproc+0x1e>
+      goto found;
+  release(&ptable.lock);
+ffffffff80105c11:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80105c18:	e8 89 0e 00 00       	call   ffffffff80106aa6 <release>
+  return 0;
+ffffffff80105c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80105c22:	e9 d5 00 00 00       	jmp    ffffffff80105cfc <allocproc+0x126>
+      goto found;
+ffffffff80105c27:	90                   	nop
+
+found:
+  p->state = EMBRYO;
+ffffffff80105c28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105c2c:	c7 40 18 01 00 00 00 	movl   $0x1,0x18(%rax)
+  p->pid = nextpid++;
+ffffffff80105c33:	8b 05 27 59 00 00    	mov    0x5927(%rip),%eax        # ffffffff8010b560 <nextpid>
+ffffffff80105c39:	8d 50 01             	lea    0x1(%rax),%edx
+ffffffff80105c3c:	89 15 1e 59 00 00    	mov    %edx,0x591e(%rip)        # ffffffff8010b560 <nextpid>
+ffffffff80105c42:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80105c46:	89 42 1c             	mov    %eax,0x1c(%rdx)
+  release(&ptable.lock);
+ffffffff80105c49:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80105c50:	e8 51 0e 00 00       	call   ffffffff80106aa6 <release>
+
+  // Allocate kernel stack.
+  if((p->kstack = kalloc()) == 0){
+ffffffff80105c55:	e8 0a e1 ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff80105c5a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80105c5e:	48 89 42 10          	mov    %rax,0x10(%rdx)
+ffffffff80105c62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105c66:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff80105c6a:	48 85 c0             	test   %rax,%rax
+ffffffff80105c6d:	75 12                	jne    ffffffff80105c81 <allocproc+0xab>
+    p->state = UNUSED;
+ffffffff80105c6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105c73:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%rax)
+    return 0;
+ffffffff80105c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80105c7f:	eb 7b                	jmp    ffffffff80105cfc <allocproc+0x126>
+  }
+  sp = p->kstack + KSTACKSIZE;
+ffffffff80105c81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105c85:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff80105c89:	48 05 00 10 00 00    	add    $0x1000,%rax
+ffffffff80105c8f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  
+  // Leave room for trap frame.
+  sp -= sizeof *p->tf;
+ffffffff80105c93:	48 81 6d f0 b0 00 00 	subq   $0xb0,-0x10(%rbp)
+ffffffff80105c9a:	00 
+  p->tf = (struct trapframe*)sp;
+ffffffff80105c9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105c9f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff80105ca3:	48 89 50 28          	mov    %rdx,0x28(%rax)
+  
+  // Set up new context to start executing at forkret,
+  // which returns to trapret.
+  sp -= sizeof(uintp);
+ffffffff80105ca7:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+  *(uintp*)sp = (uintp)trapret;
+ffffffff80105cac:	48 c7 c2 68 85 10 80 	mov    $0xffffffff80108568,%rdx
+ffffffff80105cb3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80105cb7:	48 89 10             	mov    %rdx,(%rax)
+
+  sp -= sizeof *p->context;
+ffffffff80105cba:	48 83 6d f0 40       	subq   $0x40,-0x10(%rbp)
+  p->context = (struct context*)sp;
+ffffffff80105cbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105cc3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff80105cc7:	48 89 50 30          	mov    %rdx,0x30(%rax)
+  memset(p->context, 0, sizeof *p->context);
+ffffffff80105ccb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105ccf:	48 8b 40 30          	mov    0x30(%rax),%rax
+ffffffff80105cd3:	ba 40 00 00 00       	mov    $0x40,%edx
+ffffffff80105cd8:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80105cdd:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105ce0:	e8 5a 10 00 00       	call   ffffffff80106d3f <memset>
+  p->context->eip = (uintp)forkret;
+ffffffff80105ce5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105ce9:	48 8b 40 30          	mov    0x30(%rax),%rax
+ffffffff80105ced:	48 c7 c2 24 66 10 80 	mov    $0xffffffff80106624,%rdx
+ffffffff80105cf4:	48 89 50 38          	mov    %rdx,0x38(%rax)
+
+  return p;
+ffffffff80105cf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80105cfc:	c9                   	leave
+ffffffff80105cfd:	c3                   	ret
+
+ffffffff80105cfe <userinit>:
+
+//PAGEBREAK: 32
+// Set up first user process.
+void
+userinit(void)
+{
+ffffffff80105cfe:	55                   	push   %rbp
+ffffffff80105cff:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105d02:	48 83 ec 10          	sub    $0x10,%rsp
+  struct proc *p;
+  extern char _binary_out_initcode_start[], _binary_out_initcode_size[];
+  
+  p = allocproc();
+ffffffff80105d06:	e8 cb fe ff ff       	call   ffffffff80105bd6 <allocproc>
+ffffffff80105d0b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  initproc = p;
+ffffffff80105d0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105d13:	48 89 05 ce 0a 01 00 	mov    %rax,0x10ace(%rip)        # ffffffff801167e8 <initproc>
+  if((p->pgdir = setupkvm()) == 0)
+ffffffff80105d1a:	e8 89 44 00 00       	call   ffffffff8010a1a8 <setupkvm>
+ffffffff80105d1f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80105d23:	48 89 42 08          	mov    %rax,0x8(%rdx)
+ffffffff80105d27:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105d2b:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff80105d2f:	48 85 c0             	test   %rax,%rax
+ffffffff80105d32:	75 0c                	jne    ffffffff80105d40 <userinit+0x42>
+    panic("userinit: out of memory?");
+ffffffff80105d34:	48 c7 c7 a9 aa 10 80 	mov    $0xffffffff8010aaa9,%rdi
+ffffffff80105d3b:	e8 ef ab ff ff       	call   ffffffff8010092f <panic>
+  inituvm(p->pgdir, _binary_out_initcode_start, (uintp)_binary_out_initcode_size);
+ffffffff80105d40:	48 c7 c0 3c 00 00 00 	mov    $0x3c,%rax
+ffffffff80105d47:	89 c2                	mov    %eax,%edx
+ffffffff80105d49:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105d4d:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff80105d51:	48 c7 c6 78 be 10 80 	mov    $0xffffffff8010be78,%rsi
+ffffffff80105d58:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105d5b:	e8 43 39 00 00       	call   ffffffff801096a3 <inituvm>
+  p->sz = PGSIZE;
+ffffffff80105d60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105d64:	48 c7 00 00 10 00 00 	movq   $0x1000,(%rax)
+  memset(p->tf, 0, sizeof(*p->tf));
+ffffffff80105d6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105d6f:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80105d73:	ba b0 00 00 00       	mov    $0xb0,%edx
+ffffffff80105d78:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80105d7d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105d80:	e8 ba 0f 00 00       	call   ffffffff80106d3f <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+ffffffff80105d85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105d89:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80105d8d:	48 c7 80 90 00 00 00 	movq   $0x23,0x90(%rax)
+ffffffff80105d94:	23 00 00 00 
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+ffffffff80105d98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105d9c:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80105da0:	48 c7 80 a8 00 00 00 	movq   $0x2b,0xa8(%rax)
+ffffffff80105da7:	2b 00 00 00 
+#ifndef X64
+  p->tf->es = p->tf->ds;
+  p->tf->ss = p->tf->ds;
+#endif
+  p->tf->eflags = FL_IF;
+ffffffff80105dab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105daf:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80105db3:	48 c7 80 98 00 00 00 	movq   $0x200,0x98(%rax)
+ffffffff80105dba:	00 02 00 00 
+  p->tf->esp = PGSIZE;
+ffffffff80105dbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105dc2:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80105dc6:	48 c7 80 a0 00 00 00 	movq   $0x1000,0xa0(%rax)
+ffffffff80105dcd:	00 10 00 00 
+  p->tf->eip = 0;  // beginning of initcode.S
+ffffffff80105dd1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105dd5:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80105dd9:	48 c7 80 88 00 00 00 	movq   $0x0,0x88(%rax)
+ffffffff80105de0:	00 00 00 00 
+
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+ffffffff80105de4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105de8:	48 05 d0 00 00 00    	add    $0xd0,%rax
+ffffffff80105dee:	ba 10 00 00 00       	mov    $0x10,%edx
+ffffffff80105df3:	48 c7 c6 c2 aa 10 80 	mov    $0xffffffff8010aac2,%rsi
+ffffffff80105dfa:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105dfd:	e8 d8 11 00 00       	call   ffffffff80106fda <safestrcpy>
+  p->cwd = namei("/");
+ffffffff80105e02:	48 c7 c7 cb aa 10 80 	mov    $0xffffffff8010aacb,%rdi
+ffffffff80105e09:	e8 aa d7 ff ff       	call   ffffffff801035b8 <namei>
+ffffffff80105e0e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80105e12:	48 89 82 c8 00 00 00 	mov    %rax,0xc8(%rdx)
+
+  p->state = RUNNABLE;
+ffffffff80105e19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80105e1d:	c7 40 18 03 00 00 00 	movl   $0x3,0x18(%rax)
+}
+ffffffff80105e24:	90                   	nop
+ffffffff80105e25:	c9                   	leave
+ffffffff80105e26:	c3                   	ret
+
+ffffffff80105e27 <growproc>:
+
+// Grow current process's memory by n bytes.
+// Return 0 on success, -1 on failure.
+int
+growproc(int n)
+{
+ffffffff80105e27:	55                   	push   %rbp
+ffffffff80105e28:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105e2b:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80105e2f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uint sz;
+  
+  sz = proc->sz;
+ffffffff80105e32:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105e39:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105e3d:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105e40:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(n > 0){
+ffffffff80105e43:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+ffffffff80105e47:	7e 34                	jle    ffffffff80105e7d <growproc+0x56>
+    if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
+ffffffff80105e49:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff80105e4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80105e4f:	01 c2                	add    %eax,%edx
+ffffffff80105e51:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105e58:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105e5c:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff80105e60:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+ffffffff80105e63:	89 ce                	mov    %ecx,%esi
+ffffffff80105e65:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105e68:	e8 be 39 00 00       	call   ffffffff8010982b <allocuvm>
+ffffffff80105e6d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80105e70:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80105e74:	75 44                	jne    ffffffff80105eba <growproc+0x93>
+      return -1;
+ffffffff80105e76:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80105e7b:	eb 66                	jmp    ffffffff80105ee3 <growproc+0xbc>
+  } else if(n < 0){
+ffffffff80105e7d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+ffffffff80105e81:	79 37                	jns    ffffffff80105eba <growproc+0x93>
+    if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
+ffffffff80105e83:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff80105e86:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80105e89:	01 d0                	add    %edx,%eax
+ffffffff80105e8b:	89 c2                	mov    %eax,%edx
+ffffffff80105e8d:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+ffffffff80105e90:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105e97:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105e9b:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff80105e9f:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80105ea2:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105ea5:	e8 55 3a 00 00       	call   ffffffff801098ff <deallocuvm>
+ffffffff80105eaa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80105ead:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80105eb1:	75 07                	jne    ffffffff80105eba <growproc+0x93>
+      return -1;
+ffffffff80105eb3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80105eb8:	eb 29                	jmp    ffffffff80105ee3 <growproc+0xbc>
+  }
+  proc->sz = sz;
+ffffffff80105eba:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105ec1:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105ec5:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80105ec8:	48 89 10             	mov    %rdx,(%rax)
+  switchuvm(proc);
+ffffffff80105ecb:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105ed2:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105ed6:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105ed9:	e8 97 45 00 00       	call   ffffffff8010a475 <switchuvm>
+  return 0;
+ffffffff80105ede:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80105ee3:	c9                   	leave
+ffffffff80105ee4:	c3                   	ret
+
+ffffffff80105ee5 <fork>:
+// Create a new process copying p as the parent.
+// Sets up stack to return as if from system call.
+// Caller must set state of returned proc to RUNNABLE.
+int
+fork(void)
+{
+ffffffff80105ee5:	55                   	push   %rbp
+ffffffff80105ee6:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80105ee9:	53                   	push   %rbx
+ffffffff80105eea:	48 83 ec 28          	sub    $0x28,%rsp
+  int i, pid;
+  struct proc *np;
+
+  // Allocate process.
+  if((np = allocproc()) == 0)
+ffffffff80105eee:	e8 e3 fc ff ff       	call   ffffffff80105bd6 <allocproc>
+ffffffff80105ef3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ffffffff80105ef7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+ffffffff80105efc:	75 0a                	jne    ffffffff80105f08 <fork+0x23>
+    return -1;
+ffffffff80105efe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80105f03:	e9 77 02 00 00       	jmp    ffffffff8010617f <fork+0x29a>
+
+  // Copy process state from p.
+  if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0){
+ffffffff80105f08:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105f0f:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105f13:	48 8b 00             	mov    (%rax),%rax
+ffffffff80105f16:	89 c2                	mov    %eax,%edx
+ffffffff80105f18:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105f1f:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105f23:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff80105f27:	89 d6                	mov    %edx,%esi
+ffffffff80105f29:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105f2c:	e8 b2 3b 00 00       	call   ffffffff80109ae3 <copyuvm>
+ffffffff80105f31:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ffffffff80105f35:	48 89 42 08          	mov    %rax,0x8(%rdx)
+ffffffff80105f39:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105f3d:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff80105f41:	48 85 c0             	test   %rax,%rax
+ffffffff80105f44:	75 31                	jne    ffffffff80105f77 <fork+0x92>
+    kfree(np->kstack);
+ffffffff80105f46:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105f4a:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff80105f4e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80105f51:	e8 64 dd ff ff       	call   ffffffff80103cba <kfree>
+    np->kstack = 0;
+ffffffff80105f56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105f5a:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+ffffffff80105f61:	00 
+    np->state = UNUSED;
+ffffffff80105f62:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105f66:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%rax)
+    return -1;
+ffffffff80105f6d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80105f72:	e9 08 02 00 00       	jmp    ffffffff8010617f <fork+0x29a>
+  }
+  np->sz = proc->sz;
+ffffffff80105f77:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105f7e:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105f82:	48 8b 10             	mov    (%rax),%rdx
+ffffffff80105f85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105f89:	48 89 10             	mov    %rdx,(%rax)
+  np->parent = proc;
+ffffffff80105f8c:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105f93:	64 48 8b 10          	mov    %fs:(%rax),%rdx
+ffffffff80105f97:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105f9b:	48 89 50 20          	mov    %rdx,0x20(%rax)
+  *np->tf = *proc->tf;
+ffffffff80105f9f:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80105fa6:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80105faa:	48 8b 50 28          	mov    0x28(%rax),%rdx
+ffffffff80105fae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80105fb2:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80105fb6:	48 8b 0a             	mov    (%rdx),%rcx
+ffffffff80105fb9:	48 8b 5a 08          	mov    0x8(%rdx),%rbx
+ffffffff80105fbd:	48 89 08             	mov    %rcx,(%rax)
+ffffffff80105fc0:	48 89 58 08          	mov    %rbx,0x8(%rax)
+ffffffff80105fc4:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+ffffffff80105fc8:	48 8b 5a 18          	mov    0x18(%rdx),%rbx
+ffffffff80105fcc:	48 89 48 10          	mov    %rcx,0x10(%rax)
+ffffffff80105fd0:	48 89 58 18          	mov    %rbx,0x18(%rax)
+ffffffff80105fd4:	48 8b 4a 20          	mov    0x20(%rdx),%rcx
+ffffffff80105fd8:	48 8b 5a 28          	mov    0x28(%rdx),%rbx
+ffffffff80105fdc:	48 89 48 20          	mov    %rcx,0x20(%rax)
+ffffffff80105fe0:	48 89 58 28          	mov    %rbx,0x28(%rax)
+ffffffff80105fe4:	48 8b 4a 30          	mov    0x30(%rdx),%rcx
+ffffffff80105fe8:	48 8b 5a 38          	mov    0x38(%rdx),%rbx
+ffffffff80105fec:	48 89 48 30          	mov    %rcx,0x30(%rax)
+ffffffff80105ff0:	48 89 58 38          	mov    %rbx,0x38(%rax)
+ffffffff80105ff4:	48 8b 4a 40          	mov    0x40(%rdx),%rcx
+ffffffff80105ff8:	48 8b 5a 48          	mov    0x48(%rdx),%rbx
+ffffffff80105ffc:	48 89 48 40          	mov    %rcx,0x40(%rax)
+ffffffff80106000:	48 89 58 48          	mov    %rbx,0x48(%rax)
+ffffffff80106004:	48 8b 4a 50          	mov    0x50(%rdx),%rcx
+ffffffff80106008:	48 8b 5a 58          	mov    0x58(%rdx),%rbx
+ffffffff8010600c:	48 89 48 50          	mov    %rcx,0x50(%rax)
+ffffffff80106010:	48 89 58 58          	mov    %rbx,0x58(%rax)
+ffffffff80106014:	48 8b 4a 60          	mov    0x60(%rdx),%rcx
+ffffffff80106018:	48 8b 5a 68          	mov    0x68(%rdx),%rbx
+ffffffff8010601c:	48 89 48 60          	mov    %rcx,0x60(%rax)
+ffffffff80106020:	48 89 58 68          	mov    %rbx,0x68(%rax)
+ffffffff80106024:	48 8b 4a 70          	mov    0x70(%rdx),%rcx
+ffffffff80106028:	48 8b 5a 78          	mov    0x78(%rdx),%rbx
+ffffffff8010602c:	48 89 48 70          	mov    %rcx,0x70(%rax)
+ffffffff80106030:	48 89 58 78          	mov    %rbx,0x78(%rax)
+ffffffff80106034:	48 8b 8a 80 00 00 00 	mov    0x80(%rdx),%rcx
+ffffffff8010603b:	48 8b 9a 88 00 00 00 	mov    0x88(%rdx),%rbx
+ffffffff80106042:	48 89 88 80 00 00 00 	mov    %rcx,0x80(%rax)
+ffffffff80106049:	48 89 98 88 00 00 00 	mov    %rbx,0x88(%rax)
+ffffffff80106050:	48 8b 8a 90 00 00 00 	mov    0x90(%rdx),%rcx
+ffffffff80106057:	48 8b 9a 98 00 00 00 	mov    0x98(%rdx),%rbx
+ffffffff8010605e:	48 89 88 90 00 00 00 	mov    %rcx,0x90(%rax)
+ffffffff80106065:	48 89 98 98 00 00 00 	mov    %rbx,0x98(%rax)
+ffffffff8010606c:	48 8b 8a a0 00 00 00 	mov    0xa0(%rdx),%rcx
+ffffffff80106073:	48 8b 9a a8 00 00 00 	mov    0xa8(%rdx),%rbx
+ffffffff8010607a:	48 89 88 a0 00 00 00 	mov    %rcx,0xa0(%rax)
+ffffffff80106081:	48 89 98 a8 00 00 00 	mov    %rbx,0xa8(%rax)
+
+  // Clear %eax so that fork returns 0 in the child.
+  np->tf->eax = 0;
+ffffffff80106088:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010608c:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80106090:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+
+  for(i = 0; i < NOFILE; i++)
+ffffffff80106097:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+ffffffff8010609e:	eb 58                	jmp    ffffffff801060f8 <fork+0x213>
+    if(proc->ofile[i])
+ffffffff801060a0:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801060a7:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801060ab:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff801060ae:	48 63 d2             	movslq %edx,%rdx
+ffffffff801060b1:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff801060b5:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+ffffffff801060ba:	48 85 c0             	test   %rax,%rax
+ffffffff801060bd:	74 35                	je     ffffffff801060f4 <fork+0x20f>
+      np->ofile[i] = filedup(proc->ofile[i]);
+ffffffff801060bf:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801060c6:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801060ca:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff801060cd:	48 63 d2             	movslq %edx,%rdx
+ffffffff801060d0:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff801060d4:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+ffffffff801060d9:	48 89 c7             	mov    %rax,%rdi
+ffffffff801060dc:	e8 05 be ff ff       	call   ffffffff80101ee6 <filedup>
+ffffffff801060e1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ffffffff801060e5:	8b 4d ec             	mov    -0x14(%rbp),%ecx
+ffffffff801060e8:	48 63 c9             	movslq %ecx,%rcx
+ffffffff801060eb:	48 83 c1 08          	add    $0x8,%rcx
+ffffffff801060ef:	48 89 44 ca 08       	mov    %rax,0x8(%rdx,%rcx,8)
+  for(i = 0; i < NOFILE; i++)
+ffffffff801060f4:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+ffffffff801060f8:	83 7d ec 0f          	cmpl   $0xf,-0x14(%rbp)
+ffffffff801060fc:	7e a2                	jle    ffffffff801060a0 <fork+0x1bb>
+  np->cwd = idup(proc->cwd);
+ffffffff801060fe:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106105:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106109:	48 8b 80 c8 00 00 00 	mov    0xc8(%rax),%rax
+ffffffff80106110:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106113:	e8 3e c7 ff ff       	call   ffffffff80102856 <idup>
+ffffffff80106118:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ffffffff8010611c:	48 89 82 c8 00 00 00 	mov    %rax,0xc8(%rdx)
+
+  safestrcpy(np->name, proc->name, sizeof(proc->name));
+ffffffff80106123:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff8010612a:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010612e:	48 8d 88 d0 00 00 00 	lea    0xd0(%rax),%rcx
+ffffffff80106135:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80106139:	48 05 d0 00 00 00    	add    $0xd0,%rax
+ffffffff8010613f:	ba 10 00 00 00       	mov    $0x10,%edx
+ffffffff80106144:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80106147:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010614a:	e8 8b 0e 00 00       	call   ffffffff80106fda <safestrcpy>
+ 
+  pid = np->pid;
+ffffffff8010614f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80106153:	8b 40 1c             	mov    0x1c(%rax),%eax
+ffffffff80106156:	89 45 dc             	mov    %eax,-0x24(%rbp)
+
+  // lock to force the compiler to emit the np->state write last.
+  acquire(&ptable.lock);
+ffffffff80106159:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80106160:	e8 6a 08 00 00       	call   ffffffff801069cf <acquire>
+  np->state = RUNNABLE;
+ffffffff80106165:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80106169:	c7 40 18 03 00 00 00 	movl   $0x3,0x18(%rax)
+  release(&ptable.lock);
+ffffffff80106170:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80106177:	e8 2a 09 00 00       	call   ffffffff80106aa6 <release>
+  
+  return pid;
+ffffffff8010617c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+}
+ffffffff8010617f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ffffffff80106183:	c9                   	leave
+ffffffff80106184:	c3                   	ret
+
+ffffffff80106185 <exit>:
+// Exit the current process.  Does not return.
+// An exited process remains in the zombie state
+// until its parent calls wait() to find out it exited.
+void
+exit(void)
+{
+ffffffff80106185:	55                   	push   %rbp
+ffffffff80106186:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106189:	48 83 ec 10          	sub    $0x10,%rsp
+  struct proc *p;
+  int fd;
+
+  if(proc == initproc)
+ffffffff8010618d:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106194:	64 48 8b 10          	mov    %fs:(%rax),%rdx
+ffffffff80106198:	48 8b 05 49 06 01 00 	mov    0x10649(%rip),%rax        # ffffffff801167e8 <initproc>
+ffffffff8010619f:	48 39 c2             	cmp    %rax,%rdx
+ffffffff801061a2:	75 0c                	jne    ffffffff801061b0 <exit+0x2b>
+    panic("init exiting");
+ffffffff801061a4:	48 c7 c7 cd aa 10 80 	mov    $0xffffffff8010aacd,%rdi
+ffffffff801061ab:	e8 7f a7 ff ff       	call   ffffffff8010092f <panic>
+
+  // Close all open files.
+  for(fd = 0; fd < NOFILE; fd++){
+ffffffff801061b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+ffffffff801061b7:	eb 63                	jmp    ffffffff8010621c <exit+0x97>
+    if(proc->ofile[fd]){
+ffffffff801061b9:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801061c0:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801061c4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff801061c7:	48 63 d2             	movslq %edx,%rdx
+ffffffff801061ca:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff801061ce:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+ffffffff801061d3:	48 85 c0             	test   %rax,%rax
+ffffffff801061d6:	74 40                	je     ffffffff80106218 <exit+0x93>
+      fileclose(proc->ofile[fd]);
+ffffffff801061d8:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801061df:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801061e3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff801061e6:	48 63 d2             	movslq %edx,%rdx
+ffffffff801061e9:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff801061ed:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+ffffffff801061f2:	48 89 c7             	mov    %rax,%rdi
+ffffffff801061f5:	e8 3e bd ff ff       	call   ffffffff80101f38 <fileclose>
+      proc->ofile[fd] = 0;
+ffffffff801061fa:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106201:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106205:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff80106208:	48 63 d2             	movslq %edx,%rdx
+ffffffff8010620b:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff8010620f:	48 c7 44 d0 08 00 00 	movq   $0x0,0x8(%rax,%rdx,8)
+ffffffff80106216:	00 00 
+  for(fd = 0; fd < NOFILE; fd++){
+ffffffff80106218:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+ffffffff8010621c:	83 7d f4 0f          	cmpl   $0xf,-0xc(%rbp)
+ffffffff80106220:	7e 97                	jle    ffffffff801061b9 <exit+0x34>
+    }
+  }
+
+  begin_op();
+ffffffff80106222:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80106227:	e8 d5 e4 ff ff       	call   ffffffff80104701 <begin_op>
+  iput(proc->cwd);
+ffffffff8010622c:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106233:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106237:	48 8b 80 c8 00 00 00 	mov    0xc8(%rax),%rax
+ffffffff8010623e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106241:	e8 5c c8 ff ff       	call   ffffffff80102aa2 <iput>
+  end_op();
+ffffffff80106246:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010624b:	e8 33 e5 ff ff       	call   ffffffff80104783 <end_op>
+  proc->cwd = 0;
+ffffffff80106250:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106257:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010625b:	48 c7 80 c8 00 00 00 	movq   $0x0,0xc8(%rax)
+ffffffff80106262:	00 00 00 00 
+
+  acquire(&ptable.lock);
+ffffffff80106266:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff8010626d:	e8 5d 07 00 00       	call   ffffffff801069cf <acquire>
+
+  // Parent might be sleeping in wait().
+  wakeup1(proc->parent);
+ffffffff80106272:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106279:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010627d:	48 8b 40 20          	mov    0x20(%rax),%rax
+ffffffff80106281:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106284:	e8 8a 04 00 00       	call   ffffffff80106713 <wakeup1>
+
+  // Pass abandoned children to init.
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff80106289:	48 c7 45 f8 e8 2f 11 	movq   $0xffffffff80112fe8,-0x8(%rbp)
+ffffffff80106290:	80 
+ffffffff80106291:	eb 4a                	jmp    ffffffff801062dd <exit+0x158>
+    if(p->parent == proc){
+ffffffff80106293:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106297:	48 8b 50 20          	mov    0x20(%rax),%rdx
+ffffffff8010629b:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801062a2:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801062a6:	48 39 c2             	cmp    %rax,%rdx
+ffffffff801062a9:	75 2a                	jne    ffffffff801062d5 <exit+0x150>
+      p->parent = initproc;
+ffffffff801062ab:	48 8b 15 36 05 01 00 	mov    0x10536(%rip),%rdx        # ffffffff801167e8 <initproc>
+ffffffff801062b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801062b6:	48 89 50 20          	mov    %rdx,0x20(%rax)
+      if(p->state == ZOMBIE)
+ffffffff801062ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801062be:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff801062c1:	83 f8 05             	cmp    $0x5,%eax
+ffffffff801062c4:	75 0f                	jne    ffffffff801062d5 <exit+0x150>
+        wakeup1(initproc);
+ffffffff801062c6:	48 8b 05 1b 05 01 00 	mov    0x1051b(%rip),%rax        # ffffffff801167e8 <initproc>
+ffffffff801062cd:	48 89 c7             	mov    %rax,%rdi
+ffffffff801062d0:	e8 3e 04 00 00       	call   ffffffff80106713 <wakeup1>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff801062d5:	48 81 45 f8 e0 00 00 	addq   $0xe0,-0x8(%rbp)
+ffffffff801062dc:	00 
+ffffffff801062dd:	48 81 7d f8 e8 67 11 	cmpq   $0xffffffff801167e8,-0x8(%rbp)
+ffffffff801062e4:	80 
+ffffffff801062e5:	72 ac                	jb     ffffffff80106293 <exit+0x10e>
+    }
+  }
+
+  // Jump into the scheduler, never to return.
+  proc->state = ZOMBIE;
+ffffffff801062e7:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801062ee:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801062f2:	c7 40 18 05 00 00 00 	movl   $0x5,0x18(%rax)
+  sched();
+ffffffff801062f9:	e8 1c 02 00 00       	call   ffffffff8010651a <sched>
+  panic("zombie exit");
+ffffffff801062fe:	48 c7 c7 da aa 10 80 	mov    $0xffffffff8010aada,%rdi
+ffffffff80106305:	e8 25 a6 ff ff       	call   ffffffff8010092f <panic>
+
+ffffffff8010630a <wait>:
+
+// Wait for a child process to exit and return its pid.
+// Return -1 if this process has no children.
+int
+wait(void)
+{
+ffffffff8010630a:	55                   	push   %rbp
+ffffffff8010630b:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010630e:	48 83 ec 10          	sub    $0x10,%rsp
+  struct proc *p;
+  int havekids, pid;
+
+  acquire(&ptable.lock);
+ffffffff80106312:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80106319:	e8 b1 06 00 00       	call   ffffffff801069cf <acquire>
+  for(;;){
+    // Scan through table looking for zombie children.
+    havekids = 0;
+ffffffff8010631e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff80106325:	48 c7 45 f8 e8 2f 11 	movq   $0xffffffff80112fe8,-0x8(%rbp)
+ffffffff8010632c:	80 
+ffffffff8010632d:	e9 bb 00 00 00       	jmp    ffffffff801063ed <wait+0xe3>
+      if(p->parent != proc)
+ffffffff80106332:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106336:	48 8b 50 20          	mov    0x20(%rax),%rdx
+ffffffff8010633a:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106341:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106345:	48 39 c2             	cmp    %rax,%rdx
+ffffffff80106348:	0f 85 96 00 00 00    	jne    ffffffff801063e4 <wait+0xda>
+        continue;
+      havekids = 1;
+ffffffff8010634e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%rbp)
+      if(p->state == ZOMBIE){
+ffffffff80106355:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106359:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff8010635c:	83 f8 05             	cmp    $0x5,%eax
+ffffffff8010635f:	0f 85 80 00 00 00    	jne    ffffffff801063e5 <wait+0xdb>
+        // Found one.
+        pid = p->pid;
+ffffffff80106365:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106369:	8b 40 1c             	mov    0x1c(%rax),%eax
+ffffffff8010636c:	89 45 f0             	mov    %eax,-0x10(%rbp)
+        kfree(p->kstack);
+ffffffff8010636f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106373:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff80106377:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010637a:	e8 3b d9 ff ff       	call   ffffffff80103cba <kfree>
+        p->kstack = 0;
+ffffffff8010637f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106383:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+ffffffff8010638a:	00 
+        freevm(p->pgdir);
+ffffffff8010638b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010638f:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff80106393:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106396:	e8 47 36 00 00       	call   ffffffff801099e2 <freevm>
+        p->state = UNUSED;
+ffffffff8010639b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010639f:	c7 40 18 00 00 00 00 	movl   $0x0,0x18(%rax)
+        p->pid = 0;
+ffffffff801063a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801063aa:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+        p->parent = 0;
+ffffffff801063b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801063b5:	48 c7 40 20 00 00 00 	movq   $0x0,0x20(%rax)
+ffffffff801063bc:	00 
+        p->name[0] = 0;
+ffffffff801063bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801063c1:	c6 80 d0 00 00 00 00 	movb   $0x0,0xd0(%rax)
+        p->killed = 0;
+ffffffff801063c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801063cc:	c7 40 40 00 00 00 00 	movl   $0x0,0x40(%rax)
+        release(&ptable.lock);
+ffffffff801063d3:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff801063da:	e8 c7 06 00 00       	call   ffffffff80106aa6 <release>
+        return pid;
+ffffffff801063df:	8b 45 f0             	mov    -0x10(%rbp),%eax
+ffffffff801063e2:	eb 61                	jmp    ffffffff80106445 <wait+0x13b>
+        continue;
+ffffffff801063e4:	90                   	nop
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff801063e5:	48 81 45 f8 e0 00 00 	addq   $0xe0,-0x8(%rbp)
+ffffffff801063ec:	00 
+ffffffff801063ed:	48 81 7d f8 e8 67 11 	cmpq   $0xffffffff801167e8,-0x8(%rbp)
+ffffffff801063f4:	80 
+ffffffff801063f5:	0f 82 37 ff ff ff    	jb     ffffffff80106332 <wait+0x28>
+      }
+    }
+
+    // No point waiting if we don't have any children.
+    if(!havekids || proc->killed){
+ffffffff801063fb:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+ffffffff801063ff:	74 12                	je     ffffffff80106413 <wait+0x109>
+ffffffff80106401:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106408:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010640c:	8b 40 40             	mov    0x40(%rax),%eax
+ffffffff8010640f:	85 c0                	test   %eax,%eax
+ffffffff80106411:	74 13                	je     ffffffff80106426 <wait+0x11c>
+      release(&ptable.lock);
+ffffffff80106413:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff8010641a:	e8 87 06 00 00       	call   ffffffff80106aa6 <release>
+      return -1;
+ffffffff8010641f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80106424:	eb 1f                	jmp    ffffffff80106445 <wait+0x13b>
+    }
+
+    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    sleep(proc, &ptable.lock);  //DOC: wait-sleep
+ffffffff80106426:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff8010642d:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106431:	48 c7 c6 80 2f 11 80 	mov    $0xffffffff80112f80,%rsi
+ffffffff80106438:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010643b:	e8 10 02 00 00       	call   ffffffff80106650 <sleep>
+    havekids = 0;
+ffffffff80106440:	e9 d9 fe ff ff       	jmp    ffffffff8010631e <wait+0x14>
+  }
+}
+ffffffff80106445:	c9                   	leave
+ffffffff80106446:	c3                   	ret
+
+ffffffff80106447 <scheduler>:
+//  - swtch to start running that process
+//  - eventually that process transfers control
+//      via swtch back to the scheduler.
+void
+scheduler(void)
+{
+ffffffff80106447:	55                   	push   %rbp
+ffffffff80106448:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010644b:	48 83 ec 10          	sub    $0x10,%rsp
+  struct proc *p = 0;
+ffffffff8010644f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+ffffffff80106456:	00 
+
+  for(;;){
+    // Enable interrupts on this processor.
+    sti();
+ffffffff80106457:	e8 50 f7 ff ff       	call   ffffffff80105bac <sti>
+
+    // no runnable processes? (did we hit the end of the table last time?)
+    // if so, wait for irq before trying again.
+    if (p == &ptable.proc[NPROC])
+ffffffff8010645c:	48 81 7d f8 e8 67 11 	cmpq   $0xffffffff801167e8,-0x8(%rbp)
+ffffffff80106463:	80 
+ffffffff80106464:	75 05                	jne    ffffffff8010646b <scheduler+0x24>
+      hlt();
+ffffffff80106466:	e8 49 f7 ff ff       	call   ffffffff80105bb4 <hlt>
+
+    // Loop over process table looking for process to run.
+    acquire(&ptable.lock);
+ffffffff8010646b:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80106472:	e8 58 05 00 00       	call   ffffffff801069cf <acquire>
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff80106477:	48 c7 45 f8 e8 2f 11 	movq   $0xffffffff80112fe8,-0x8(%rbp)
+ffffffff8010647e:	80 
+ffffffff8010647f:	eb 7a                	jmp    ffffffff801064fb <scheduler+0xb4>
+      if(p->state != RUNNABLE)
+ffffffff80106481:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106485:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff80106488:	83 f8 03             	cmp    $0x3,%eax
+ffffffff8010648b:	75 65                	jne    ffffffff801064f2 <scheduler+0xab>
+        continue;
+
+      // Switch to chosen process.  It is the process's job
+      // to release ptable.lock and then reacquire it
+      // before jumping back to us.
+      proc = p;
+ffffffff8010648d:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106494:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80106498:	64 48 89 10          	mov    %rdx,%fs:(%rax)
+      switchuvm(p);
+ffffffff8010649c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801064a0:	48 89 c7             	mov    %rax,%rdi
+ffffffff801064a3:	e8 cd 3f 00 00       	call   ffffffff8010a475 <switchuvm>
+      p->state = RUNNING;
+ffffffff801064a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801064ac:	c7 40 18 04 00 00 00 	movl   $0x4,0x18(%rax)
+      swtch(&cpu->scheduler, proc->context);
+ffffffff801064b3:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801064ba:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801064be:	48 8b 40 30          	mov    0x30(%rax),%rax
+ffffffff801064c2:	48 c7 c2 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rdx
+ffffffff801064c9:	64 48 8b 12          	mov    %fs:(%rdx),%rdx
+ffffffff801064cd:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff801064d1:	48 89 c6             	mov    %rax,%rsi
+ffffffff801064d4:	48 89 d7             	mov    %rdx,%rdi
+ffffffff801064d7:	e8 93 0b 00 00       	call   ffffffff8010706f <swtch>
+      switchkvm();
+ffffffff801064dc:	e8 76 3f 00 00       	call   ffffffff8010a457 <switchkvm>
+
+      // Process is done running for now.
+      // It should have changed its p->state before coming back.
+      proc = 0;
+ffffffff801064e1:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801064e8:	64 48 c7 00 00 00 00 	movq   $0x0,%fs:(%rax)
+ffffffff801064ef:	00 
+ffffffff801064f0:	eb 01                	jmp    ffffffff801064f3 <scheduler+0xac>
+        continue;
+ffffffff801064f2:	90                   	nop
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff801064f3:	48 81 45 f8 e0 00 00 	addq   $0xe0,-0x8(%rbp)
+ffffffff801064fa:	00 
+ffffffff801064fb:	48 81 7d f8 e8 67 11 	cmpq   $0xffffffff801167e8,-0x8(%rbp)
+ffffffff80106502:	80 
+ffffffff80106503:	0f 82 78 ff ff ff    	jb     ffffffff80106481 <scheduler+0x3a>
+    }
+    release(&ptable.lock);
+ffffffff80106509:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80106510:	e8 91 05 00 00       	call   ffffffff80106aa6 <release>
+    sti();
+ffffffff80106515:	e9 3d ff ff ff       	jmp    ffffffff80106457 <scheduler+0x10>
+
+ffffffff8010651a <sched>:
+
+// Enter scheduler.  Must hold only ptable.lock
+// and have changed proc->state.
+void
+sched(void)
+{
+ffffffff8010651a:	55                   	push   %rbp
+ffffffff8010651b:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010651e:	48 83 ec 10          	sub    $0x10,%rsp
+  int intena;
+
+  if(!holding(&ptable.lock))
+ffffffff80106522:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80106529:	e8 98 06 00 00       	call   ffffffff80106bc6 <holding>
+ffffffff8010652e:	85 c0                	test   %eax,%eax
+ffffffff80106530:	75 0c                	jne    ffffffff8010653e <sched+0x24>
+    panic("sched ptable.lock");
+ffffffff80106532:	48 c7 c7 e6 aa 10 80 	mov    $0xffffffff8010aae6,%rdi
+ffffffff80106539:	e8 f1 a3 ff ff       	call   ffffffff8010092f <panic>
+  if(cpu->ncli != 1)
+ffffffff8010653e:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80106545:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106549:	8b 80 dc 00 00 00    	mov    0xdc(%rax),%eax
+ffffffff8010654f:	83 f8 01             	cmp    $0x1,%eax
+ffffffff80106552:	74 0c                	je     ffffffff80106560 <sched+0x46>
+    panic("sched locks");
+ffffffff80106554:	48 c7 c7 f8 aa 10 80 	mov    $0xffffffff8010aaf8,%rdi
+ffffffff8010655b:	e8 cf a3 ff ff       	call   ffffffff8010092f <panic>
+  if(proc->state == RUNNING)
+ffffffff80106560:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106567:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010656b:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff8010656e:	83 f8 04             	cmp    $0x4,%eax
+ffffffff80106571:	75 0c                	jne    ffffffff8010657f <sched+0x65>
+    panic("sched running");
+ffffffff80106573:	48 c7 c7 04 ab 10 80 	mov    $0xffffffff8010ab04,%rdi
+ffffffff8010657a:	e8 b0 a3 ff ff       	call   ffffffff8010092f <panic>
+  if(readeflags()&FL_IF)
+ffffffff8010657f:	e8 14 f6 ff ff       	call   ffffffff80105b98 <readeflags>
+ffffffff80106584:	25 00 02 00 00       	and    $0x200,%eax
+ffffffff80106589:	48 85 c0             	test   %rax,%rax
+ffffffff8010658c:	74 0c                	je     ffffffff8010659a <sched+0x80>
+    panic("sched interruptible");
+ffffffff8010658e:	48 c7 c7 12 ab 10 80 	mov    $0xffffffff8010ab12,%rdi
+ffffffff80106595:	e8 95 a3 ff ff       	call   ffffffff8010092f <panic>
+  intena = cpu->intena;
+ffffffff8010659a:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff801065a1:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801065a5:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+ffffffff801065ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  swtch(&proc->context, cpu->scheduler);
+ffffffff801065ae:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff801065b5:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801065b9:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff801065bd:	48 c7 c2 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rdx
+ffffffff801065c4:	64 48 8b 12          	mov    %fs:(%rdx),%rdx
+ffffffff801065c8:	48 83 c2 30          	add    $0x30,%rdx
+ffffffff801065cc:	48 89 c6             	mov    %rax,%rsi
+ffffffff801065cf:	48 89 d7             	mov    %rdx,%rdi
+ffffffff801065d2:	e8 98 0a 00 00       	call   ffffffff8010706f <swtch>
+  cpu->intena = intena;
+ffffffff801065d7:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff801065de:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801065e2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff801065e5:	89 90 e0 00 00 00    	mov    %edx,0xe0(%rax)
+}
+ffffffff801065eb:	90                   	nop
+ffffffff801065ec:	c9                   	leave
+ffffffff801065ed:	c3                   	ret
+
+ffffffff801065ee <yield>:
+
+// Give up the CPU for one scheduling round.
+void
+yield(void)
+{
+ffffffff801065ee:	55                   	push   %rbp
+ffffffff801065ef:	48 89 e5             	mov    %rsp,%rbp
+  acquire(&ptable.lock);  //DOC: yieldlock
+ffffffff801065f2:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff801065f9:	e8 d1 03 00 00       	call   ffffffff801069cf <acquire>
+  proc->state = RUNNABLE;
+ffffffff801065fe:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106605:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106609:	c7 40 18 03 00 00 00 	movl   $0x3,0x18(%rax)
+  sched();
+ffffffff80106610:	e8 05 ff ff ff       	call   ffffffff8010651a <sched>
+  release(&ptable.lock);
+ffffffff80106615:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff8010661c:	e8 85 04 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff80106621:	90                   	nop
+ffffffff80106622:	5d                   	pop    %rbp
+ffffffff80106623:	c3                   	ret
+
+ffffffff80106624 <forkret>:
+
+// A fork child's very first scheduling by scheduler()
+// will swtch here.  "Return" to user space.
+void
+forkret(void)
+{
+ffffffff80106624:	55                   	push   %rbp
+ffffffff80106625:	48 89 e5             	mov    %rsp,%rbp
+  static int first = 1;
+  // Still holding ptable.lock from scheduler.
+  release(&ptable.lock);
+ffffffff80106628:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff8010662f:	e8 72 04 00 00       	call   ffffffff80106aa6 <release>
+
+  if (first) {
+ffffffff80106634:	8b 05 2a 4f 00 00    	mov    0x4f2a(%rip),%eax        # ffffffff8010b564 <first.1>
+ffffffff8010663a:	85 c0                	test   %eax,%eax
+ffffffff8010663c:	74 0f                	je     ffffffff8010664d <forkret+0x29>
+    // Some initialization functions must be run in the context
+    // of a regular process (e.g., they call sleep), and thus cannot 
+    // be run from main().
+    first = 0;
+ffffffff8010663e:	c7 05 1c 4f 00 00 00 	movl   $0x0,0x4f1c(%rip)        # ffffffff8010b564 <first.1>
+ffffffff80106645:	00 00 00 
+    initlog();
+ffffffff80106648:	e8 79 de ff ff       	call   ffffffff801044c6 <initlog>
+  }
+  
+  // Return to "caller", actually trapret (see allocproc).
+}
+ffffffff8010664d:	90                   	nop
+ffffffff8010664e:	5d                   	pop    %rbp
+ffffffff8010664f:	c3                   	ret
+
+ffffffff80106650 <sleep>:
+
+// Atomically release lock and sleep on chan.
+// Reacquires lock when awakened.
+void
+sleep(void *chan, struct spinlock *lk)
+{
+ffffffff80106650:	55                   	push   %rbp
+ffffffff80106651:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106654:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80106658:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff8010665c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(proc == 0)
+ffffffff80106660:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80106667:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010666b:	48 85 c0             	test   %rax,%rax
+ffffffff8010666e:	75 0c                	jne    ffffffff8010667c <sleep+0x2c>
+    panic("sleep");
+ffffffff80106670:	48 c7 c7 26 ab 10 80 	mov    $0xffffffff8010ab26,%rdi
+ffffffff80106677:	e8 b3 a2 ff ff       	call   ffffffff8010092f <panic>
+
+  if(lk == 0)
+ffffffff8010667c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80106681:	75 0c                	jne    ffffffff8010668f <sleep+0x3f>
+    panic("sleep without lk");
+ffffffff80106683:	48 c7 c7 2c ab 10 80 	mov    $0xffffffff8010ab2c,%rdi
+ffffffff8010668a:	e8 a0 a2 ff ff       	call   ffffffff8010092f <panic>
+  // change p->state and then call sched.
+  // Once we hold ptable.lock, we can be
+  // guaranteed that we won't miss any wakeup
+  // (wakeup runs with ptable.lock locked),
+  // so it's okay to release lk.
+  if(lk != &ptable.lock){  //DOC: sleeplock0
+ffffffff8010668f:	48 81 7d f0 80 2f 11 	cmpq   $0xffffffff80112f80,-0x10(%rbp)
+ffffffff80106696:	80 
+ffffffff80106697:	74 18                	je     ffffffff801066b1 <sleep+0x61>
+    acquire(&ptable.lock);  //DOC: sleeplock1
+ffffffff80106699:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff801066a0:	e8 2a 03 00 00       	call   ffffffff801069cf <acquire>
+    release(lk);
+ffffffff801066a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801066a9:	48 89 c7             	mov    %rax,%rdi
+ffffffff801066ac:	e8 f5 03 00 00       	call   ffffffff80106aa6 <release>
+  }
+
+  // Go to sleep.
+  proc->chan = chan;
+ffffffff801066b1:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801066b8:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801066bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff801066c0:	48 89 50 38          	mov    %rdx,0x38(%rax)
+  proc->state = SLEEPING;
+ffffffff801066c4:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801066cb:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801066cf:	c7 40 18 02 00 00 00 	movl   $0x2,0x18(%rax)
+  sched();
+ffffffff801066d6:	e8 3f fe ff ff       	call   ffffffff8010651a <sched>
+
+  // Tidy up.
+  proc->chan = 0;
+ffffffff801066db:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801066e2:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801066e6:	48 c7 40 38 00 00 00 	movq   $0x0,0x38(%rax)
+ffffffff801066ed:	00 
+
+  // Reacquire original lock.
+  if(lk != &ptable.lock){  //DOC: sleeplock2
+ffffffff801066ee:	48 81 7d f0 80 2f 11 	cmpq   $0xffffffff80112f80,-0x10(%rbp)
+ffffffff801066f5:	80 
+ffffffff801066f6:	74 18                	je     ffffffff80106710 <sleep+0xc0>
+    release(&ptable.lock);
+ffffffff801066f8:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff801066ff:	e8 a2 03 00 00       	call   ffffffff80106aa6 <release>
+    acquire(lk);
+ffffffff80106704:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106708:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010670b:	e8 bf 02 00 00       	call   ffffffff801069cf <acquire>
+  }
+}
+ffffffff80106710:	90                   	nop
+ffffffff80106711:	c9                   	leave
+ffffffff80106712:	c3                   	ret
+
+ffffffff80106713 <wakeup1>:
+//PAGEBREAK!
+// Wake up all processes sleeping on chan.
+// The ptable lock must be held.
+static void
+wakeup1(void *chan)
+{
+ffffffff80106713:	55                   	push   %rbp
+ffffffff80106714:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106717:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff8010671b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+ffffffff8010671f:	48 c7 45 f8 e8 2f 11 	movq   $0xffffffff80112fe8,-0x8(%rbp)
+ffffffff80106726:	80 
+ffffffff80106727:	eb 2d                	jmp    ffffffff80106756 <wakeup1+0x43>
+    if(p->state == SLEEPING && p->chan == chan)
+ffffffff80106729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010672d:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff80106730:	83 f8 02             	cmp    $0x2,%eax
+ffffffff80106733:	75 19                	jne    ffffffff8010674e <wakeup1+0x3b>
+ffffffff80106735:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106739:	48 8b 40 38          	mov    0x38(%rax),%rax
+ffffffff8010673d:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+ffffffff80106741:	75 0b                	jne    ffffffff8010674e <wakeup1+0x3b>
+      p->state = RUNNABLE;
+ffffffff80106743:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106747:	c7 40 18 03 00 00 00 	movl   $0x3,0x18(%rax)
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+ffffffff8010674e:	48 81 45 f8 e0 00 00 	addq   $0xe0,-0x8(%rbp)
+ffffffff80106755:	00 
+ffffffff80106756:	48 81 7d f8 e8 67 11 	cmpq   $0xffffffff801167e8,-0x8(%rbp)
+ffffffff8010675d:	80 
+ffffffff8010675e:	72 c9                	jb     ffffffff80106729 <wakeup1+0x16>
+}
+ffffffff80106760:	90                   	nop
+ffffffff80106761:	90                   	nop
+ffffffff80106762:	c9                   	leave
+ffffffff80106763:	c3                   	ret
+
+ffffffff80106764 <wakeup>:
+
+// Wake up all processes sleeping on chan.
+void
+wakeup(void *chan)
+{
+ffffffff80106764:	55                   	push   %rbp
+ffffffff80106765:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106768:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff8010676c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  acquire(&ptable.lock);
+ffffffff80106770:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80106777:	e8 53 02 00 00       	call   ffffffff801069cf <acquire>
+  wakeup1(chan);
+ffffffff8010677c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106780:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106783:	e8 8b ff ff ff       	call   ffffffff80106713 <wakeup1>
+  release(&ptable.lock);
+ffffffff80106788:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff8010678f:	e8 12 03 00 00       	call   ffffffff80106aa6 <release>
+}
+ffffffff80106794:	90                   	nop
+ffffffff80106795:	c9                   	leave
+ffffffff80106796:	c3                   	ret
+
+ffffffff80106797 <kill>:
+// Kill the process with the given pid.
+// Process won't exit until it returns
+// to user space (see trap in trap.c).
+int
+kill(int pid)
+{
+ffffffff80106797:	55                   	push   %rbp
+ffffffff80106798:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010679b:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff8010679f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct proc *p;
+
+  acquire(&ptable.lock);
+ffffffff801067a2:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff801067a9:	e8 21 02 00 00       	call   ffffffff801069cf <acquire>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff801067ae:	48 c7 45 f8 e8 2f 11 	movq   $0xffffffff80112fe8,-0x8(%rbp)
+ffffffff801067b5:	80 
+ffffffff801067b6:	eb 49                	jmp    ffffffff80106801 <kill+0x6a>
+    if(p->pid == pid){
+ffffffff801067b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801067bc:	8b 40 1c             	mov    0x1c(%rax),%eax
+ffffffff801067bf:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+ffffffff801067c2:	75 35                	jne    ffffffff801067f9 <kill+0x62>
+      p->killed = 1;
+ffffffff801067c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801067c8:	c7 40 40 01 00 00 00 	movl   $0x1,0x40(%rax)
+      // Wake process from sleep if necessary.
+      if(p->state == SLEEPING)
+ffffffff801067cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801067d3:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff801067d6:	83 f8 02             	cmp    $0x2,%eax
+ffffffff801067d9:	75 0b                	jne    ffffffff801067e6 <kill+0x4f>
+        p->state = RUNNABLE;
+ffffffff801067db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801067df:	c7 40 18 03 00 00 00 	movl   $0x3,0x18(%rax)
+      release(&ptable.lock);
+ffffffff801067e6:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff801067ed:	e8 b4 02 00 00       	call   ffffffff80106aa6 <release>
+      return 0;
+ffffffff801067f2:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801067f7:	eb 23                	jmp    ffffffff8010681c <kill+0x85>
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff801067f9:	48 81 45 f8 e0 00 00 	addq   $0xe0,-0x8(%rbp)
+ffffffff80106800:	00 
+ffffffff80106801:	48 81 7d f8 e8 67 11 	cmpq   $0xffffffff801167e8,-0x8(%rbp)
+ffffffff80106808:	80 
+ffffffff80106809:	72 ad                	jb     ffffffff801067b8 <kill+0x21>
+    }
+  }
+  release(&ptable.lock);
+ffffffff8010680b:	48 c7 c7 80 2f 11 80 	mov    $0xffffffff80112f80,%rdi
+ffffffff80106812:	e8 8f 02 00 00       	call   ffffffff80106aa6 <release>
+  return -1;
+ffffffff80106817:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff8010681c:	c9                   	leave
+ffffffff8010681d:	c3                   	ret
+
+ffffffff8010681e <procdump>:
+// Print a process listing to console.  For debugging.
+// Runs when user types ^P on console.
+// No lock to avoid wedging a stuck machine further.
+void
+procdump(void)
+{
+ffffffff8010681e:	55                   	push   %rbp
+ffffffff8010681f:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106822:	48 83 ec 70          	sub    $0x70,%rsp
+  int i;
+  struct proc *p;
+  char *state;
+  uintp pc[10];
+  
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff80106826:	48 c7 45 f0 e8 2f 11 	movq   $0xffffffff80112fe8,-0x10(%rbp)
+ffffffff8010682d:	80 
+ffffffff8010682e:	e9 0a 01 00 00       	jmp    ffffffff8010693d <procdump+0x11f>
+    if(p->state == UNUSED)
+ffffffff80106833:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106837:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff8010683a:	85 c0                	test   %eax,%eax
+ffffffff8010683c:	0f 84 f2 00 00 00    	je     ffffffff80106934 <procdump+0x116>
+      continue;
+    if(p->state && p->state < NELEM(states) && states[p->state])
+ffffffff80106842:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106846:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff80106849:	85 c0                	test   %eax,%eax
+ffffffff8010684b:	74 39                	je     ffffffff80106886 <procdump+0x68>
+ffffffff8010684d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106851:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff80106854:	83 f8 05             	cmp    $0x5,%eax
+ffffffff80106857:	77 2d                	ja     ffffffff80106886 <procdump+0x68>
+ffffffff80106859:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010685d:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff80106860:	89 c0                	mov    %eax,%eax
+ffffffff80106862:	48 8b 04 c5 80 b5 10 	mov    -0x7fef4a80(,%rax,8),%rax
+ffffffff80106869:	80 
+ffffffff8010686a:	48 85 c0             	test   %rax,%rax
+ffffffff8010686d:	74 17                	je     ffffffff80106886 <procdump+0x68>
+      state = states[p->state];
+ffffffff8010686f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106873:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff80106876:	89 c0                	mov    %eax,%eax
+ffffffff80106878:	48 8b 04 c5 80 b5 10 	mov    -0x7fef4a80(,%rax,8),%rax
+ffffffff8010687f:	80 
+ffffffff80106880:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+ffffffff80106884:	eb 08                	jmp    ffffffff8010688e <procdump+0x70>
+    else
+      state = "???";
+ffffffff80106886:	48 c7 45 e8 3d ab 10 	movq   $0xffffffff8010ab3d,-0x18(%rbp)
+ffffffff8010688d:	80 
+    cprintf("%d %s %s", p->pid, state, p->name);
+ffffffff8010688e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106892:	48 8d 88 d0 00 00 00 	lea    0xd0(%rax),%rcx
+ffffffff80106899:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010689d:	8b 40 1c             	mov    0x1c(%rax),%eax
+ffffffff801068a0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff801068a4:	89 c6                	mov    %eax,%esi
+ffffffff801068a6:	48 c7 c7 41 ab 10 80 	mov    $0xffffffff8010ab41,%rdi
+ffffffff801068ad:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801068b2:	e8 ed 9c ff ff       	call   ffffffff801005a4 <cprintf>
+    if(p->state == SLEEPING){
+ffffffff801068b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801068bb:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff801068be:	83 f8 02             	cmp    $0x2,%eax
+ffffffff801068c1:	75 5e                	jne    ffffffff80106921 <procdump+0x103>
+      getstackpcs((uintp*)p->context->ebp, pc);
+ffffffff801068c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801068c7:	48 8b 40 30          	mov    0x30(%rax),%rax
+ffffffff801068cb:	48 8b 40 30          	mov    0x30(%rax),%rax
+ffffffff801068cf:	48 89 c2             	mov    %rax,%rdx
+ffffffff801068d2:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+ffffffff801068d6:	48 89 c6             	mov    %rax,%rsi
+ffffffff801068d9:	48 89 d7             	mov    %rdx,%rdi
+ffffffff801068dc:	e8 4b 02 00 00       	call   ffffffff80106b2c <getstackpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+ffffffff801068e1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff801068e8:	eb 22                	jmp    ffffffff8010690c <procdump+0xee>
+        cprintf(" %p", pc[i]);
+ffffffff801068ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801068ed:	48 98                	cltq
+ffffffff801068ef:	48 8b 44 c5 90       	mov    -0x70(%rbp,%rax,8),%rax
+ffffffff801068f4:	48 89 c6             	mov    %rax,%rsi
+ffffffff801068f7:	48 c7 c7 4a ab 10 80 	mov    $0xffffffff8010ab4a,%rdi
+ffffffff801068fe:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80106903:	e8 9c 9c ff ff       	call   ffffffff801005a4 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+ffffffff80106908:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff8010690c:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+ffffffff80106910:	7f 0f                	jg     ffffffff80106921 <procdump+0x103>
+ffffffff80106912:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80106915:	48 98                	cltq
+ffffffff80106917:	48 8b 44 c5 90       	mov    -0x70(%rbp,%rax,8),%rax
+ffffffff8010691c:	48 85 c0             	test   %rax,%rax
+ffffffff8010691f:	75 c9                	jne    ffffffff801068ea <procdump+0xcc>
+    }
+    cprintf("\n");
+ffffffff80106921:	48 c7 c7 4e ab 10 80 	mov    $0xffffffff8010ab4e,%rdi
+ffffffff80106928:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010692d:	e8 72 9c ff ff       	call   ffffffff801005a4 <cprintf>
+ffffffff80106932:	eb 01                	jmp    ffffffff80106935 <procdump+0x117>
+      continue;
+ffffffff80106934:	90                   	nop
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+ffffffff80106935:	48 81 45 f0 e0 00 00 	addq   $0xe0,-0x10(%rbp)
+ffffffff8010693c:	00 
+ffffffff8010693d:	48 81 7d f0 e8 67 11 	cmpq   $0xffffffff801167e8,-0x10(%rbp)
+ffffffff80106944:	80 
+ffffffff80106945:	0f 82 e8 fe ff ff    	jb     ffffffff80106833 <procdump+0x15>
+  }
+}
+ffffffff8010694b:	90                   	nop
+ffffffff8010694c:	90                   	nop
+ffffffff8010694d:	c9                   	leave
+ffffffff8010694e:	c3                   	ret
+
+ffffffff8010694f <readeflags>:
+{
+ffffffff8010694f:	55                   	push   %rbp
+ffffffff80106950:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106953:	48 83 ec 10          	sub    $0x10,%rsp
+  asm volatile("pushf; pop %0" : "=r" (eflags));
+ffffffff80106957:	9c                   	pushf
+ffffffff80106958:	58                   	pop    %rax
+ffffffff80106959:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  return eflags;
+ffffffff8010695d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80106961:	c9                   	leave
+ffffffff80106962:	c3                   	ret
+
+ffffffff80106963 <cli>:
+{
+ffffffff80106963:	55                   	push   %rbp
+ffffffff80106964:	48 89 e5             	mov    %rsp,%rbp
+  asm volatile("cli");
+ffffffff80106967:	fa                   	cli
+}
+ffffffff80106968:	90                   	nop
+ffffffff80106969:	5d                   	pop    %rbp
+ffffffff8010696a:	c3                   	ret
+
+ffffffff8010696b <sti>:
+{
+ffffffff8010696b:	55                   	push   %rbp
+ffffffff8010696c:	48 89 e5             	mov    %rsp,%rbp
+  asm volatile("sti");
+ffffffff8010696f:	fb                   	sti
+}
+ffffffff80106970:	90                   	nop
+ffffffff80106971:	5d                   	pop    %rbp
+ffffffff80106972:	c3                   	ret
+
+ffffffff80106973 <xchg>:
+{
+ffffffff80106973:	55                   	push   %rbp
+ffffffff80106974:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106977:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff8010697b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff8010697f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+               "1" ((uint)newval) :
+ffffffff80106983:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  asm volatile("lock; xchgl %0, %1" :
+ffffffff80106987:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff8010698b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+ffffffff8010698f:	f0 87 02             	lock xchg %eax,(%rdx)
+ffffffff80106992:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  return result;
+ffffffff80106995:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ffffffff80106998:	c9                   	leave
+ffffffff80106999:	c3                   	ret
+
+ffffffff8010699a <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+ffffffff8010699a:	55                   	push   %rbp
+ffffffff8010699b:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010699e:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff801069a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff801069a6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  lk->name = name;
+ffffffff801069aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801069ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff801069b2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  lk->locked = 0;
+ffffffff801069b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801069ba:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  lk->cpu = 0;
+ffffffff801069c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801069c4:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+ffffffff801069cb:	00 
+}
+ffffffff801069cc:	90                   	nop
+ffffffff801069cd:	c9                   	leave
+ffffffff801069ce:	c3                   	ret
+
+ffffffff801069cf <acquire>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+acquire(struct spinlock *lk)
+{
+ffffffff801069cf:	55                   	push   %rbp
+ffffffff801069d0:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801069d3:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801069d7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pushcli(); // disable interrupts to avoid deadlock.
+ffffffff801069db:	e8 22 02 00 00       	call   ffffffff80106c02 <pushcli>
+  if(holding(lk)) {
+ffffffff801069e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801069e4:	48 89 c7             	mov    %rax,%rdi
+ffffffff801069e7:	e8 da 01 00 00       	call   ffffffff80106bc6 <holding>
+ffffffff801069ec:	85 c0                	test   %eax,%eax
+ffffffff801069ee:	74 73                	je     ffffffff80106a63 <acquire+0x94>
+    int i;
+    cprintf("lock '%s':\n", lk->name);
+ffffffff801069f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801069f4:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff801069f8:	48 89 c6             	mov    %rax,%rsi
+ffffffff801069fb:	48 c7 c7 7a ab 10 80 	mov    $0xffffffff8010ab7a,%rdi
+ffffffff80106a02:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80106a07:	e8 98 9b ff ff       	call   ffffffff801005a4 <cprintf>
+    for (i = 0; i < 10; i++)
+ffffffff80106a0c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80106a13:	eb 2b                	jmp    ffffffff80106a40 <acquire+0x71>
+      cprintf(" %p", lk->pcs[i]);
+ffffffff80106a15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106a19:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80106a1c:	48 63 d2             	movslq %edx,%rdx
+ffffffff80106a1f:	48 83 c2 02          	add    $0x2,%rdx
+ffffffff80106a23:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+ffffffff80106a28:	48 89 c6             	mov    %rax,%rsi
+ffffffff80106a2b:	48 c7 c7 86 ab 10 80 	mov    $0xffffffff8010ab86,%rdi
+ffffffff80106a32:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80106a37:	e8 68 9b ff ff       	call   ffffffff801005a4 <cprintf>
+    for (i = 0; i < 10; i++)
+ffffffff80106a3c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80106a40:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+ffffffff80106a44:	7e cf                	jle    ffffffff80106a15 <acquire+0x46>
+    cprintf("\n");
+ffffffff80106a46:	48 c7 c7 8a ab 10 80 	mov    $0xffffffff8010ab8a,%rdi
+ffffffff80106a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80106a52:	e8 4d 9b ff ff       	call   ffffffff801005a4 <cprintf>
+    panic("acquire");
+ffffffff80106a57:	48 c7 c7 8c ab 10 80 	mov    $0xffffffff8010ab8c,%rdi
+ffffffff80106a5e:	e8 cc 9e ff ff       	call   ffffffff8010092f <panic>
+  }
+
+  // The xchg is atomic.
+  // It also serializes, so that reads after acquire are not
+  // reordered before it. 
+  while(xchg(&lk->locked, 1) != 0)
+ffffffff80106a63:	90                   	nop
+ffffffff80106a64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106a68:	be 01 00 00 00       	mov    $0x1,%esi
+ffffffff80106a6d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106a70:	e8 fe fe ff ff       	call   ffffffff80106973 <xchg>
+ffffffff80106a75:	85 c0                	test   %eax,%eax
+ffffffff80106a77:	75 eb                	jne    ffffffff80106a64 <acquire+0x95>
+    ;
+
+  // Record info about lock acquisition for debugging.
+  lk->cpu = cpu;
+ffffffff80106a79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106a7d:	48 c7 c2 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rdx
+ffffffff80106a84:	64 48 8b 12          	mov    %fs:(%rdx),%rdx
+ffffffff80106a88:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  getcallerpcs(&lk, lk->pcs);
+ffffffff80106a8c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106a90:	48 8d 50 18          	lea    0x18(%rax),%rdx
+ffffffff80106a94:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+ffffffff80106a98:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80106a9b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106a9e:	e8 5c 00 00 00       	call   ffffffff80106aff <getcallerpcs>
+}
+ffffffff80106aa3:	90                   	nop
+ffffffff80106aa4:	c9                   	leave
+ffffffff80106aa5:	c3                   	ret
+
+ffffffff80106aa6 <release>:
+
+// Release the lock.
+void
+release(struct spinlock *lk)
+{
+ffffffff80106aa6:	55                   	push   %rbp
+ffffffff80106aa7:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106aaa:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80106aae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if(!holding(lk))
+ffffffff80106ab2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106ab6:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106ab9:	e8 08 01 00 00       	call   ffffffff80106bc6 <holding>
+ffffffff80106abe:	85 c0                	test   %eax,%eax
+ffffffff80106ac0:	75 0c                	jne    ffffffff80106ace <release+0x28>
+    panic("release");
+ffffffff80106ac2:	48 c7 c7 94 ab 10 80 	mov    $0xffffffff8010ab94,%rdi
+ffffffff80106ac9:	e8 61 9e ff ff       	call   ffffffff8010092f <panic>
+
+  lk->pcs[0] = 0;
+ffffffff80106ace:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106ad2:	48 c7 40 18 00 00 00 	movq   $0x0,0x18(%rax)
+ffffffff80106ad9:	00 
+  lk->cpu = 0;
+ffffffff80106ada:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106ade:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+ffffffff80106ae5:	00 
+  // But the 2007 Intel 64 Architecture Memory Ordering White
+  // Paper says that Intel 64 and IA-32 will not move a load
+  // after a store. So lock->locked = 0 would work here.
+  // The xchg being asm volatile ensures gcc emits it after
+  // the above assignments (and after the critical section).
+  xchg(&lk->locked, 0);
+ffffffff80106ae6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106aea:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80106aef:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106af2:	e8 7c fe ff ff       	call   ffffffff80106973 <xchg>
+
+  popcli();
+ffffffff80106af7:	e8 56 01 00 00       	call   ffffffff80106c52 <popcli>
+}
+ffffffff80106afc:	90                   	nop
+ffffffff80106afd:	c9                   	leave
+ffffffff80106afe:	c3                   	ret
+
+ffffffff80106aff <getcallerpcs>:
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uintp pcs[])
+{
+ffffffff80106aff:	55                   	push   %rbp
+ffffffff80106b00:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106b03:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80106b07:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80106b0b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uintp *ebp;
+#if X64
+  asm volatile("mov %%rbp, %0" : "=r" (ebp));  
+ffffffff80106b0f:	48 89 e8             	mov    %rbp,%rax
+ffffffff80106b12:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#else
+  ebp = (uintp*)v - 2;
+#endif
+  getstackpcs(ebp, pcs);
+ffffffff80106b16:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ffffffff80106b1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106b1e:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80106b21:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106b24:	e8 03 00 00 00       	call   ffffffff80106b2c <getstackpcs>
+}
+ffffffff80106b29:	90                   	nop
+ffffffff80106b2a:	c9                   	leave
+ffffffff80106b2b:	c3                   	ret
+
+ffffffff80106b2c <getstackpcs>:
+
+void
+getstackpcs(uintp *ebp, uintp pcs[])
+{
+ffffffff80106b2c:	55                   	push   %rbp
+ffffffff80106b2d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106b30:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80106b34:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80106b38:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  
+  for(i = 0; i < 10; i++){
+ffffffff80106b3c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80106b43:	eb 50                	jmp    ffffffff80106b95 <getstackpcs+0x69>
+    if(ebp == 0 || ebp < (uintp*)KERNBASE || ebp == (uintp*)0xffffffff)
+ffffffff80106b45:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+ffffffff80106b4a:	74 70                	je     ffffffff80106bbc <getstackpcs+0x90>
+ffffffff80106b4c:	48 b8 ff ff ff 7f ff 	movabs $0xffffffff7fffffff,%rax
+ffffffff80106b53:	ff ff ff 
+ffffffff80106b56:	48 3b 45 e8          	cmp    -0x18(%rbp),%rax
+ffffffff80106b5a:	73 60                	jae    ffffffff80106bbc <getstackpcs+0x90>
+ffffffff80106b5c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80106b61:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+ffffffff80106b65:	74 55                	je     ffffffff80106bbc <getstackpcs+0x90>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+ffffffff80106b67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80106b6a:	48 98                	cltq
+ffffffff80106b6c:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80106b73:	00 
+ffffffff80106b74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80106b78:	48 01 c2             	add    %rax,%rdx
+ffffffff80106b7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106b7f:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff80106b83:	48 89 02             	mov    %rax,(%rdx)
+    ebp = (uintp*)ebp[0]; // saved %ebp
+ffffffff80106b86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106b8a:	48 8b 00             	mov    (%rax),%rax
+ffffffff80106b8d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for(i = 0; i < 10; i++){
+ffffffff80106b91:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80106b95:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+ffffffff80106b99:	7e aa                	jle    ffffffff80106b45 <getstackpcs+0x19>
+  }
+  for(; i < 10; i++)
+ffffffff80106b9b:	eb 1f                	jmp    ffffffff80106bbc <getstackpcs+0x90>
+    pcs[i] = 0;
+ffffffff80106b9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80106ba0:	48 98                	cltq
+ffffffff80106ba2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80106ba9:	00 
+ffffffff80106baa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80106bae:	48 01 d0             	add    %rdx,%rax
+ffffffff80106bb1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  for(; i < 10; i++)
+ffffffff80106bb8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80106bbc:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+ffffffff80106bc0:	7e db                	jle    ffffffff80106b9d <getstackpcs+0x71>
+}
+ffffffff80106bc2:	90                   	nop
+ffffffff80106bc3:	90                   	nop
+ffffffff80106bc4:	c9                   	leave
+ffffffff80106bc5:	c3                   	ret
+
+ffffffff80106bc6 <holding>:
+
+// Check whether this cpu is holding the lock.
+int
+holding(struct spinlock *lock)
+{
+ffffffff80106bc6:	55                   	push   %rbp
+ffffffff80106bc7:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106bca:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80106bce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return lock->locked && lock->cpu == cpu;
+ffffffff80106bd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106bd6:	8b 00                	mov    (%rax),%eax
+ffffffff80106bd8:	85 c0                	test   %eax,%eax
+ffffffff80106bda:	74 1f                	je     ffffffff80106bfb <holding+0x35>
+ffffffff80106bdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106be0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+ffffffff80106be4:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80106beb:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106bef:	48 39 c2             	cmp    %rax,%rdx
+ffffffff80106bf2:	75 07                	jne    ffffffff80106bfb <holding+0x35>
+ffffffff80106bf4:	b8 01 00 00 00       	mov    $0x1,%eax
+ffffffff80106bf9:	eb 05                	jmp    ffffffff80106c00 <holding+0x3a>
+ffffffff80106bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80106c00:	c9                   	leave
+ffffffff80106c01:	c3                   	ret
+
+ffffffff80106c02 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+ffffffff80106c02:	55                   	push   %rbp
+ffffffff80106c03:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106c06:	48 83 ec 10          	sub    $0x10,%rsp
+  int eflags;
+  
+  eflags = readeflags();
+ffffffff80106c0a:	e8 40 fd ff ff       	call   ffffffff8010694f <readeflags>
+ffffffff80106c0f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  cli();
+ffffffff80106c12:	e8 4c fd ff ff       	call   ffffffff80106963 <cli>
+  if(cpu->ncli++ == 0)
+ffffffff80106c17:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80106c1e:	64 48 8b 10          	mov    %fs:(%rax),%rdx
+ffffffff80106c22:	8b 82 dc 00 00 00    	mov    0xdc(%rdx),%eax
+ffffffff80106c28:	8d 48 01             	lea    0x1(%rax),%ecx
+ffffffff80106c2b:	89 8a dc 00 00 00    	mov    %ecx,0xdc(%rdx)
+ffffffff80106c31:	85 c0                	test   %eax,%eax
+ffffffff80106c33:	75 1a                	jne    ffffffff80106c4f <pushcli+0x4d>
+    cpu->intena = eflags & FL_IF;
+ffffffff80106c35:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80106c3c:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106c40:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80106c43:	81 e2 00 02 00 00    	and    $0x200,%edx
+ffffffff80106c49:	89 90 e0 00 00 00    	mov    %edx,0xe0(%rax)
+}
+ffffffff80106c4f:	90                   	nop
+ffffffff80106c50:	c9                   	leave
+ffffffff80106c51:	c3                   	ret
+
+ffffffff80106c52 <popcli>:
+
+void
+popcli(void)
+{
+ffffffff80106c52:	55                   	push   %rbp
+ffffffff80106c53:	48 89 e5             	mov    %rsp,%rbp
+  if(readeflags()&FL_IF)
+ffffffff80106c56:	e8 f4 fc ff ff       	call   ffffffff8010694f <readeflags>
+ffffffff80106c5b:	25 00 02 00 00       	and    $0x200,%eax
+ffffffff80106c60:	48 85 c0             	test   %rax,%rax
+ffffffff80106c63:	74 0c                	je     ffffffff80106c71 <popcli+0x1f>
+    panic("popcli - interruptible");
+ffffffff80106c65:	48 c7 c7 9c ab 10 80 	mov    $0xffffffff8010ab9c,%rdi
+ffffffff80106c6c:	e8 be 9c ff ff       	call   ffffffff8010092f <panic>
+  if(--cpu->ncli < 0)
+ffffffff80106c71:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80106c78:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106c7c:	8b 90 dc 00 00 00    	mov    0xdc(%rax),%edx
+ffffffff80106c82:	83 ea 01             	sub    $0x1,%edx
+ffffffff80106c85:	89 90 dc 00 00 00    	mov    %edx,0xdc(%rax)
+ffffffff80106c8b:	8b 80 dc 00 00 00    	mov    0xdc(%rax),%eax
+ffffffff80106c91:	85 c0                	test   %eax,%eax
+ffffffff80106c93:	79 0c                	jns    ffffffff80106ca1 <popcli+0x4f>
+    panic("popcli");
+ffffffff80106c95:	48 c7 c7 b3 ab 10 80 	mov    $0xffffffff8010abb3,%rdi
+ffffffff80106c9c:	e8 8e 9c ff ff       	call   ffffffff8010092f <panic>
+  if(cpu->ncli == 0 && cpu->intena)
+ffffffff80106ca1:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80106ca8:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106cac:	8b 80 dc 00 00 00    	mov    0xdc(%rax),%eax
+ffffffff80106cb2:	85 c0                	test   %eax,%eax
+ffffffff80106cb4:	75 1a                	jne    ffffffff80106cd0 <popcli+0x7e>
+ffffffff80106cb6:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80106cbd:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80106cc1:	8b 80 e0 00 00 00    	mov    0xe0(%rax),%eax
+ffffffff80106cc7:	85 c0                	test   %eax,%eax
+ffffffff80106cc9:	74 05                	je     ffffffff80106cd0 <popcli+0x7e>
+    sti();
+ffffffff80106ccb:	e8 9b fc ff ff       	call   ffffffff8010696b <sti>
+}
+ffffffff80106cd0:	90                   	nop
+ffffffff80106cd1:	5d                   	pop    %rbp
+ffffffff80106cd2:	c3                   	ret
+
+ffffffff80106cd3 <stosb>:
+{
+ffffffff80106cd3:	55                   	push   %rbp
+ffffffff80106cd4:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106cd7:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80106cdb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80106cdf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ffffffff80106ce2:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosb" :
+ffffffff80106ce5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ffffffff80106ce9:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ffffffff80106cec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80106cef:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80106cf2:	48 89 f7             	mov    %rsi,%rdi
+ffffffff80106cf5:	89 d1                	mov    %edx,%ecx
+ffffffff80106cf7:	fc                   	cld
+ffffffff80106cf8:	f3 aa                	rep stos %al,%es:(%rdi)
+ffffffff80106cfa:	89 ca                	mov    %ecx,%edx
+ffffffff80106cfc:	48 89 fe             	mov    %rdi,%rsi
+ffffffff80106cff:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ffffffff80106d03:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+ffffffff80106d06:	90                   	nop
+ffffffff80106d07:	c9                   	leave
+ffffffff80106d08:	c3                   	ret
+
+ffffffff80106d09 <stosl>:
+{
+ffffffff80106d09:	55                   	push   %rbp
+ffffffff80106d0a:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106d0d:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80106d11:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80106d15:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ffffffff80106d18:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  asm volatile("cld; rep stosl" :
+ffffffff80106d1b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ffffffff80106d1f:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ffffffff80106d22:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80106d25:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80106d28:	48 89 f7             	mov    %rsi,%rdi
+ffffffff80106d2b:	89 d1                	mov    %edx,%ecx
+ffffffff80106d2d:	fc                   	cld
+ffffffff80106d2e:	f3 ab                	rep stos %eax,%es:(%rdi)
+ffffffff80106d30:	89 ca                	mov    %ecx,%edx
+ffffffff80106d32:	48 89 fe             	mov    %rdi,%rsi
+ffffffff80106d35:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+ffffffff80106d39:	89 55 f0             	mov    %edx,-0x10(%rbp)
+}
+ffffffff80106d3c:	90                   	nop
+ffffffff80106d3d:	c9                   	leave
+ffffffff80106d3e:	c3                   	ret
+
+ffffffff80106d3f <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+ffffffff80106d3f:	55                   	push   %rbp
+ffffffff80106d40:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106d43:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80106d47:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80106d4b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ffffffff80106d4e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  if ((uintp)dst%4 == 0 && n%4 == 0){
+ffffffff80106d51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106d55:	83 e0 03             	and    $0x3,%eax
+ffffffff80106d58:	48 85 c0             	test   %rax,%rax
+ffffffff80106d5b:	75 48                	jne    ffffffff80106da5 <memset+0x66>
+ffffffff80106d5d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+ffffffff80106d60:	83 e0 03             	and    $0x3,%eax
+ffffffff80106d63:	85 c0                	test   %eax,%eax
+ffffffff80106d65:	75 3e                	jne    ffffffff80106da5 <memset+0x66>
+    c &= 0xFF;
+ffffffff80106d67:	81 65 f4 ff 00 00 00 	andl   $0xff,-0xc(%rbp)
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+ffffffff80106d6e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+ffffffff80106d71:	c1 e8 02             	shr    $0x2,%eax
+ffffffff80106d74:	89 c6                	mov    %eax,%esi
+ffffffff80106d76:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80106d79:	c1 e0 18             	shl    $0x18,%eax
+ffffffff80106d7c:	89 c2                	mov    %eax,%edx
+ffffffff80106d7e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80106d81:	c1 e0 10             	shl    $0x10,%eax
+ffffffff80106d84:	09 c2                	or     %eax,%edx
+ffffffff80106d86:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80106d89:	c1 e0 08             	shl    $0x8,%eax
+ffffffff80106d8c:	09 d0                	or     %edx,%eax
+ffffffff80106d8e:	0b 45 f4             	or     -0xc(%rbp),%eax
+ffffffff80106d91:	89 c1                	mov    %eax,%ecx
+ffffffff80106d93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106d97:	89 f2                	mov    %esi,%edx
+ffffffff80106d99:	89 ce                	mov    %ecx,%esi
+ffffffff80106d9b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106d9e:	e8 66 ff ff ff       	call   ffffffff80106d09 <stosl>
+ffffffff80106da3:	eb 14                	jmp    ffffffff80106db9 <memset+0x7a>
+  } else
+    stosb(dst, c, n);
+ffffffff80106da5:	8b 55 f0             	mov    -0x10(%rbp),%edx
+ffffffff80106da8:	8b 4d f4             	mov    -0xc(%rbp),%ecx
+ffffffff80106dab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106daf:	89 ce                	mov    %ecx,%esi
+ffffffff80106db1:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106db4:	e8 1a ff ff ff       	call   ffffffff80106cd3 <stosb>
+  return dst;
+ffffffff80106db9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80106dbd:	c9                   	leave
+ffffffff80106dbe:	c3                   	ret
+
+ffffffff80106dbf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ffffffff80106dbf:	55                   	push   %rbp
+ffffffff80106dc0:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106dc3:	48 83 ec 28          	sub    $0x28,%rsp
+ffffffff80106dc7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80106dcb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80106dcf:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  const uchar *s1, *s2;
+  
+  s1 = v1;
+ffffffff80106dd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106dd6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  s2 = v2;
+ffffffff80106dda:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80106dde:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while(n-- > 0){
+ffffffff80106de2:	eb 34                	jmp    ffffffff80106e18 <memcmp+0x59>
+    if(*s1 != *s2)
+ffffffff80106de4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106de8:	0f b6 10             	movzbl (%rax),%edx
+ffffffff80106deb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106def:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80106df2:	38 c2                	cmp    %al,%dl
+ffffffff80106df4:	74 18                	je     ffffffff80106e0e <memcmp+0x4f>
+      return *s1 - *s2;
+ffffffff80106df6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106dfa:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80106dfd:	0f b6 d0             	movzbl %al,%edx
+ffffffff80106e00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106e04:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80106e07:	0f b6 c0             	movzbl %al,%eax
+ffffffff80106e0a:	29 c2                	sub    %eax,%edx
+ffffffff80106e0c:	eb 1c                	jmp    ffffffff80106e2a <memcmp+0x6b>
+    s1++, s2++;
+ffffffff80106e0e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ffffffff80106e13:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(n-- > 0){
+ffffffff80106e18:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80106e1b:	8d 50 ff             	lea    -0x1(%rax),%edx
+ffffffff80106e1e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ffffffff80106e21:	85 c0                	test   %eax,%eax
+ffffffff80106e23:	75 bf                	jne    ffffffff80106de4 <memcmp+0x25>
+  }
+
+  return 0;
+ffffffff80106e25:	ba 00 00 00 00       	mov    $0x0,%edx
+}
+ffffffff80106e2a:	89 d0                	mov    %edx,%eax
+ffffffff80106e2c:	c9                   	leave
+ffffffff80106e2d:	c3                   	ret
+
+ffffffff80106e2e <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+ffffffff80106e2e:	55                   	push   %rbp
+ffffffff80106e2f:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106e32:	48 83 ec 28          	sub    $0x28,%rsp
+ffffffff80106e36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80106e3a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80106e3e:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  const char *s;
+  char *d;
+
+  s = src;
+ffffffff80106e41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80106e45:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+ffffffff80106e49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106e4d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(s < d && s + n > d){
+ffffffff80106e51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106e55:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+ffffffff80106e59:	73 63                	jae    ffffffff80106ebe <memmove+0x90>
+ffffffff80106e5b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+ffffffff80106e5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106e62:	48 01 d0             	add    %rdx,%rax
+ffffffff80106e65:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+ffffffff80106e69:	73 53                	jae    ffffffff80106ebe <memmove+0x90>
+    s += n;
+ffffffff80106e6b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80106e6e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+ffffffff80106e72:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80106e75:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    while(n-- > 0)
+ffffffff80106e79:	eb 17                	jmp    ffffffff80106e92 <memmove+0x64>
+      *--d = *--s;
+ffffffff80106e7b:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+ffffffff80106e80:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+ffffffff80106e85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106e89:	0f b6 10             	movzbl (%rax),%edx
+ffffffff80106e8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106e90:	88 10                	mov    %dl,(%rax)
+    while(n-- > 0)
+ffffffff80106e92:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80106e95:	8d 50 ff             	lea    -0x1(%rax),%edx
+ffffffff80106e98:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ffffffff80106e9b:	85 c0                	test   %eax,%eax
+ffffffff80106e9d:	75 dc                	jne    ffffffff80106e7b <memmove+0x4d>
+  if(s < d && s + n > d){
+ffffffff80106e9f:	eb 2a                	jmp    ffffffff80106ecb <memmove+0x9d>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+ffffffff80106ea1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80106ea5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ffffffff80106ea9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80106ead:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106eb1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ffffffff80106eb5:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+ffffffff80106eb9:	0f b6 12             	movzbl (%rdx),%edx
+ffffffff80106ebc:	88 10                	mov    %dl,(%rax)
+    while(n-- > 0)
+ffffffff80106ebe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80106ec1:	8d 50 ff             	lea    -0x1(%rax),%edx
+ffffffff80106ec4:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ffffffff80106ec7:	85 c0                	test   %eax,%eax
+ffffffff80106ec9:	75 d6                	jne    ffffffff80106ea1 <memmove+0x73>
+
+  return dst;
+ffffffff80106ecb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+ffffffff80106ecf:	c9                   	leave
+ffffffff80106ed0:	c3                   	ret
+
+ffffffff80106ed1 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+ffffffff80106ed1:	55                   	push   %rbp
+ffffffff80106ed2:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106ed5:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff80106ed9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80106edd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+ffffffff80106ee1:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return memmove(dst, src, n);
+ffffffff80106ee4:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff80106ee7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+ffffffff80106eeb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106eef:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80106ef2:	48 89 c7             	mov    %rax,%rdi
+ffffffff80106ef5:	e8 34 ff ff ff       	call   ffffffff80106e2e <memmove>
+}
+ffffffff80106efa:	c9                   	leave
+ffffffff80106efb:	c3                   	ret
+
+ffffffff80106efc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+ffffffff80106efc:	55                   	push   %rbp
+ffffffff80106efd:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106f00:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff80106f04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80106f08:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+ffffffff80106f0c:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  while(n > 0 && *p && *p == *q)
+ffffffff80106f0f:	eb 0e                	jmp    ffffffff80106f1f <strncmp+0x23>
+    n--, p++, q++;
+ffffffff80106f11:	83 6d ec 01          	subl   $0x1,-0x14(%rbp)
+ffffffff80106f15:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ffffffff80106f1a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while(n > 0 && *p && *p == *q)
+ffffffff80106f1f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+ffffffff80106f23:	74 1d                	je     ffffffff80106f42 <strncmp+0x46>
+ffffffff80106f25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106f29:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80106f2c:	84 c0                	test   %al,%al
+ffffffff80106f2e:	74 12                	je     ffffffff80106f42 <strncmp+0x46>
+ffffffff80106f30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106f34:	0f b6 10             	movzbl (%rax),%edx
+ffffffff80106f37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106f3b:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80106f3e:	38 c2                	cmp    %al,%dl
+ffffffff80106f40:	74 cf                	je     ffffffff80106f11 <strncmp+0x15>
+  if(n == 0)
+ffffffff80106f42:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+ffffffff80106f46:	75 07                	jne    ffffffff80106f4f <strncmp+0x53>
+    return 0;
+ffffffff80106f48:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff80106f4d:	eb 16                	jmp    ffffffff80106f65 <strncmp+0x69>
+  return (uchar)*p - (uchar)*q;
+ffffffff80106f4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106f53:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80106f56:	0f b6 d0             	movzbl %al,%edx
+ffffffff80106f59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80106f5d:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80106f60:	0f b6 c0             	movzbl %al,%eax
+ffffffff80106f63:	29 c2                	sub    %eax,%edx
+}
+ffffffff80106f65:	89 d0                	mov    %edx,%eax
+ffffffff80106f67:	c9                   	leave
+ffffffff80106f68:	c3                   	ret
+
+ffffffff80106f69 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+ffffffff80106f69:	55                   	push   %rbp
+ffffffff80106f6a:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106f6d:	48 83 ec 28          	sub    $0x28,%rsp
+ffffffff80106f71:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80106f75:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80106f79:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *os;
+  
+  os = s;
+ffffffff80106f7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106f80:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(n-- > 0 && (*s++ = *t++) != 0)
+ffffffff80106f84:	90                   	nop
+ffffffff80106f85:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80106f88:	8d 50 ff             	lea    -0x1(%rax),%edx
+ffffffff80106f8b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ffffffff80106f8e:	85 c0                	test   %eax,%eax
+ffffffff80106f90:	7e 35                	jle    ffffffff80106fc7 <strncpy+0x5e>
+ffffffff80106f92:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ffffffff80106f96:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ffffffff80106f9a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ffffffff80106f9e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106fa2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ffffffff80106fa6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ffffffff80106faa:	0f b6 12             	movzbl (%rdx),%edx
+ffffffff80106fad:	88 10                	mov    %dl,(%rax)
+ffffffff80106faf:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80106fb2:	84 c0                	test   %al,%al
+ffffffff80106fb4:	75 cf                	jne    ffffffff80106f85 <strncpy+0x1c>
+    ;
+  while(n-- > 0)
+ffffffff80106fb6:	eb 0f                	jmp    ffffffff80106fc7 <strncpy+0x5e>
+    *s++ = 0;
+ffffffff80106fb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106fbc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+ffffffff80106fc0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+ffffffff80106fc4:	c6 00 00             	movb   $0x0,(%rax)
+  while(n-- > 0)
+ffffffff80106fc7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80106fca:	8d 50 ff             	lea    -0x1(%rax),%edx
+ffffffff80106fcd:	89 55 dc             	mov    %edx,-0x24(%rbp)
+ffffffff80106fd0:	85 c0                	test   %eax,%eax
+ffffffff80106fd2:	7f e4                	jg     ffffffff80106fb8 <strncpy+0x4f>
+  return os;
+ffffffff80106fd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80106fd8:	c9                   	leave
+ffffffff80106fd9:	c3                   	ret
+
+ffffffff80106fda <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+ffffffff80106fda:	55                   	push   %rbp
+ffffffff80106fdb:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80106fde:	48 83 ec 28          	sub    $0x28,%rsp
+ffffffff80106fe2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80106fe6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80106fea:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *os;
+  
+  os = s;
+ffffffff80106fed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80106ff1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(n <= 0)
+ffffffff80106ff5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+ffffffff80106ff9:	7f 06                	jg     ffffffff80107001 <safestrcpy+0x27>
+    return os;
+ffffffff80106ffb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80106fff:	eb 3a                	jmp    ffffffff8010703b <safestrcpy+0x61>
+  while(--n > 0 && (*s++ = *t++) != 0)
+ffffffff80107001:	90                   	nop
+ffffffff80107002:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+ffffffff80107006:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+ffffffff8010700a:	7e 24                	jle    ffffffff80107030 <safestrcpy+0x56>
+ffffffff8010700c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ffffffff80107010:	48 8d 42 01          	lea    0x1(%rdx),%rax
+ffffffff80107014:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ffffffff80107018:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010701c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+ffffffff80107020:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+ffffffff80107024:	0f b6 12             	movzbl (%rdx),%edx
+ffffffff80107027:	88 10                	mov    %dl,(%rax)
+ffffffff80107029:	0f b6 00             	movzbl (%rax),%eax
+ffffffff8010702c:	84 c0                	test   %al,%al
+ffffffff8010702e:	75 d2                	jne    ffffffff80107002 <safestrcpy+0x28>
+    ;
+  *s = 0;
+ffffffff80107030:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80107034:	c6 00 00             	movb   $0x0,(%rax)
+  return os;
+ffffffff80107037:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff8010703b:	c9                   	leave
+ffffffff8010703c:	c3                   	ret
+
+ffffffff8010703d <strlen>:
+
+int
+strlen(const char *s)
+{
+ffffffff8010703d:	55                   	push   %rbp
+ffffffff8010703e:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107041:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff80107045:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int n;
+
+  for(n = 0; s[n]; n++)
+ffffffff80107049:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80107050:	eb 04                	jmp    ffffffff80107056 <strlen+0x19>
+ffffffff80107052:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80107056:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80107059:	48 63 d0             	movslq %eax,%rdx
+ffffffff8010705c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80107060:	48 01 d0             	add    %rdx,%rax
+ffffffff80107063:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80107066:	84 c0                	test   %al,%al
+ffffffff80107068:	75 e8                	jne    ffffffff80107052 <strlen+0x15>
+    ;
+  return n;
+ffffffff8010706a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ffffffff8010706d:	c9                   	leave
+ffffffff8010706e:	c3                   	ret
+
+ffffffff8010706f <swtch>:
+# and then load register context from new.
+
+.globl swtch
+swtch:
+  # Save old callee-save registers
+  push %rbp
+ffffffff8010706f:	55                   	push   %rbp
+  push %rbx
+ffffffff80107070:	53                   	push   %rbx
+  push %r11
+ffffffff80107071:	41 53                	push   %r11
+  push %r12
+ffffffff80107073:	41 54                	push   %r12
+  push %r13
+ffffffff80107075:	41 55                	push   %r13
+  push %r14
+ffffffff80107077:	41 56                	push   %r14
+  push %r15
+ffffffff80107079:	41 57                	push   %r15
+
+  # Switch stacks
+  mov %rsp, (%rdi)
+ffffffff8010707b:	48 89 27             	mov    %rsp,(%rdi)
+  mov %rsi, %rsp
+ffffffff8010707e:	48 89 f4             	mov    %rsi,%rsp
+
+  # Load new callee-save registers
+  pop %r15
+ffffffff80107081:	41 5f                	pop    %r15
+  pop %r14
+ffffffff80107083:	41 5e                	pop    %r14
+  pop %r13
+ffffffff80107085:	41 5d                	pop    %r13
+  pop %r12
+ffffffff80107087:	41 5c                	pop    %r12
+  pop %r11
+ffffffff80107089:	41 5b                	pop    %r11
+  pop %rbx
+ffffffff8010708b:	5b                   	pop    %rbx
+  pop %rbp
+ffffffff8010708c:	5d                   	pop    %rbp
+
+  ret #??
+ffffffff8010708d:	c3                   	ret
+
+ffffffff8010708e <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uintp addr, int *ip)
+{
+ffffffff8010708e:	55                   	push   %rbp
+ffffffff8010708f:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107092:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80107096:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff8010709a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(addr >= proc->sz || addr+sizeof(int) > proc->sz)
+ffffffff8010709e:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801070a5:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801070a9:	48 8b 00             	mov    (%rax),%rax
+ffffffff801070ac:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ffffffff801070b0:	73 1b                	jae    ffffffff801070cd <fetchint+0x3f>
+ffffffff801070b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801070b6:	48 8d 50 04          	lea    0x4(%rax),%rdx
+ffffffff801070ba:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801070c1:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801070c5:	48 8b 00             	mov    (%rax),%rax
+ffffffff801070c8:	48 39 d0             	cmp    %rdx,%rax
+ffffffff801070cb:	73 07                	jae    ffffffff801070d4 <fetchint+0x46>
+    return -1;
+ffffffff801070cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801070d2:	eb 11                	jmp    ffffffff801070e5 <fetchint+0x57>
+  *ip = *(int*)(addr);
+ffffffff801070d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801070d8:	8b 10                	mov    (%rax),%edx
+ffffffff801070da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801070de:	89 10                	mov    %edx,(%rax)
+  return 0;
+ffffffff801070e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801070e5:	c9                   	leave
+ffffffff801070e6:	c3                   	ret
+
+ffffffff801070e7 <fetchuintp>:
+
+int
+fetchuintp(uintp addr, uintp *ip)
+{
+ffffffff801070e7:	55                   	push   %rbp
+ffffffff801070e8:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801070eb:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff801070ef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff801070f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if(addr >= proc->sz || addr+sizeof(uintp) > proc->sz)
+ffffffff801070f7:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801070fe:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80107102:	48 8b 00             	mov    (%rax),%rax
+ffffffff80107105:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ffffffff80107109:	73 1b                	jae    ffffffff80107126 <fetchuintp+0x3f>
+ffffffff8010710b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010710f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ffffffff80107113:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff8010711a:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010711e:	48 8b 00             	mov    (%rax),%rax
+ffffffff80107121:	48 39 d0             	cmp    %rdx,%rax
+ffffffff80107124:	73 07                	jae    ffffffff8010712d <fetchuintp+0x46>
+    return -1;
+ffffffff80107126:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010712b:	eb 13                	jmp    ffffffff80107140 <fetchuintp+0x59>
+  *ip = *(uintp*)(addr);
+ffffffff8010712d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107131:	48 8b 10             	mov    (%rax),%rdx
+ffffffff80107134:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107138:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+ffffffff8010713b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80107140:	c9                   	leave
+ffffffff80107141:	c3                   	ret
+
+ffffffff80107142 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uintp addr, char **pp)
+{
+ffffffff80107142:	55                   	push   %rbp
+ffffffff80107143:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107146:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff8010714a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff8010714e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  char *s, *ep;
+
+  if(addr >= proc->sz)
+ffffffff80107152:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107159:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010715d:	48 8b 00             	mov    (%rax),%rax
+ffffffff80107160:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+ffffffff80107164:	72 07                	jb     ffffffff8010716d <fetchstr+0x2b>
+    return -1;
+ffffffff80107166:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010716b:	eb 5b                	jmp    ffffffff801071c8 <fetchstr+0x86>
+  *pp = (char*)addr;
+ffffffff8010716d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff80107171:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80107175:	48 89 10             	mov    %rdx,(%rax)
+  ep = (char*)proc->sz;
+ffffffff80107178:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff8010717f:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80107183:	48 8b 00             	mov    (%rax),%rax
+ffffffff80107186:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(s = *pp; s < ep; s++)
+ffffffff8010718a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010718e:	48 8b 00             	mov    (%rax),%rax
+ffffffff80107191:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80107195:	eb 22                	jmp    ffffffff801071b9 <fetchstr+0x77>
+    if(*s == 0)
+ffffffff80107197:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010719b:	0f b6 00             	movzbl (%rax),%eax
+ffffffff8010719e:	84 c0                	test   %al,%al
+ffffffff801071a0:	75 12                	jne    ffffffff801071b4 <fetchstr+0x72>
+      return s - *pp;
+ffffffff801071a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff801071a6:	48 8b 00             	mov    (%rax),%rax
+ffffffff801071a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff801071ad:	48 29 c2             	sub    %rax,%rdx
+ffffffff801071b0:	89 d0                	mov    %edx,%eax
+ffffffff801071b2:	eb 14                	jmp    ffffffff801071c8 <fetchstr+0x86>
+  for(s = *pp; s < ep; s++)
+ffffffff801071b4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ffffffff801071b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801071bd:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+ffffffff801071c1:	72 d4                	jb     ffffffff80107197 <fetchstr+0x55>
+  return -1;
+ffffffff801071c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff801071c8:	c9                   	leave
+ffffffff801071c9:	c3                   	ret
+
+ffffffff801071ca <fetcharg>:
+
+#if X64
+// arguments passed in registers on x64
+static uintp
+fetcharg(int n)
+{
+ffffffff801071ca:	55                   	push   %rbp
+ffffffff801071cb:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801071ce:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff801071d2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  switch (n) {
+ffffffff801071d5:	83 7d fc 05          	cmpl   $0x5,-0x4(%rbp)
+ffffffff801071d9:	0f 87 8b 00 00 00    	ja     ffffffff8010726a <fetcharg+0xa0>
+ffffffff801071df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801071e2:	48 8b 04 c5 c0 ab 10 	mov    -0x7fef5440(,%rax,8),%rax
+ffffffff801071e9:	80 
+ffffffff801071ea:	ff e0                	jmp    *%rax
+  case 0: return proc->tf->rdi;
+ffffffff801071ec:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801071f3:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801071f7:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff801071fb:	48 8b 40 30          	mov    0x30(%rax),%rax
+ffffffff801071ff:	eb 6e                	jmp    ffffffff8010726f <fetcharg+0xa5>
+  case 1: return proc->tf->rsi;
+ffffffff80107201:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107208:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010720c:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80107210:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80107214:	eb 59                	jmp    ffffffff8010726f <fetcharg+0xa5>
+  case 2: return proc->tf->rdx;
+ffffffff80107216:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff8010721d:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80107221:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80107225:	48 8b 40 18          	mov    0x18(%rax),%rax
+ffffffff80107229:	eb 44                	jmp    ffffffff8010726f <fetcharg+0xa5>
+  case 3: return proc->tf->rcx;
+ffffffff8010722b:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107232:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80107236:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff8010723a:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff8010723e:	eb 2f                	jmp    ffffffff8010726f <fetcharg+0xa5>
+  case 4: return proc->tf->r8;
+ffffffff80107240:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107247:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010724b:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff8010724f:	48 8b 40 38          	mov    0x38(%rax),%rax
+ffffffff80107253:	eb 1a                	jmp    ffffffff8010726f <fetcharg+0xa5>
+  case 5: return proc->tf->r9;
+ffffffff80107255:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff8010725c:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80107260:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80107264:	48 8b 40 40          	mov    0x40(%rax),%rax
+ffffffff80107268:	eb 05                	jmp    ffffffff8010726f <fetcharg+0xa5>
+  }
+  /* FIXME: should not reach here */
+  return 0;
+ffffffff8010726a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff8010726f:	c9                   	leave
+ffffffff80107270:	c3                   	ret
+
+ffffffff80107271 <argint>:
+
+int
+argint(int n, int *ip)
+{
+ffffffff80107271:	55                   	push   %rbp
+ffffffff80107272:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107275:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff80107279:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ffffffff8010727c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  *ip = fetcharg(n);
+ffffffff80107280:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80107283:	89 c7                	mov    %eax,%edi
+ffffffff80107285:	e8 40 ff ff ff       	call   ffffffff801071ca <fetcharg>
+ffffffff8010728a:	89 c2                	mov    %eax,%edx
+ffffffff8010728c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107290:	89 10                	mov    %edx,(%rax)
+  return 0;
+ffffffff80107292:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80107297:	c9                   	leave
+ffffffff80107298:	c3                   	ret
+
+ffffffff80107299 <arguintp>:
+
+int
+arguintp(int n, uintp *ip)
+{
+ffffffff80107299:	55                   	push   %rbp
+ffffffff8010729a:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010729d:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff801072a1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+ffffffff801072a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  *ip = fetcharg(n);
+ffffffff801072a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801072ab:	89 c7                	mov    %eax,%edi
+ffffffff801072ad:	e8 18 ff ff ff       	call   ffffffff801071ca <fetcharg>
+ffffffff801072b2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff801072b6:	48 89 02             	mov    %rax,(%rdx)
+  return 0;
+ffffffff801072b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801072be:	c9                   	leave
+ffffffff801072bf:	c3                   	ret
+
+ffffffff801072c0 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size n bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+ffffffff801072c0:	55                   	push   %rbp
+ffffffff801072c1:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801072c4:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801072c8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ffffffff801072cb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff801072cf:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  uintp i;
+
+  if(arguintp(n, &i) < 0)
+ffffffff801072d2:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+ffffffff801072d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff801072d9:	48 89 d6             	mov    %rdx,%rsi
+ffffffff801072dc:	89 c7                	mov    %eax,%edi
+ffffffff801072de:	e8 b6 ff ff ff       	call   ffffffff80107299 <arguintp>
+ffffffff801072e3:	85 c0                	test   %eax,%eax
+ffffffff801072e5:	79 07                	jns    ffffffff801072ee <argptr+0x2e>
+    return -1;
+ffffffff801072e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801072ec:	eb 51                	jmp    ffffffff8010733f <argptr+0x7f>
+  if(i >= proc->sz || i+size > proc->sz)
+ffffffff801072ee:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801072f5:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801072f9:	48 8b 00             	mov    (%rax),%rax
+ffffffff801072fc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80107300:	48 39 c2             	cmp    %rax,%rdx
+ffffffff80107303:	73 20                	jae    ffffffff80107325 <argptr+0x65>
+ffffffff80107305:	8b 45 e8             	mov    -0x18(%rbp),%eax
+ffffffff80107308:	48 63 d0             	movslq %eax,%rdx
+ffffffff8010730b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010730f:	48 01 c2             	add    %rax,%rdx
+ffffffff80107312:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107319:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010731d:	48 8b 00             	mov    (%rax),%rax
+ffffffff80107320:	48 39 d0             	cmp    %rdx,%rax
+ffffffff80107323:	73 07                	jae    ffffffff8010732c <argptr+0x6c>
+    return -1;
+ffffffff80107325:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010732a:	eb 13                	jmp    ffffffff8010733f <argptr+0x7f>
+  *pp = (char*)i;
+ffffffff8010732c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107330:	48 89 c2             	mov    %rax,%rdx
+ffffffff80107333:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80107337:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+ffffffff8010733a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff8010733f:	c9                   	leave
+ffffffff80107340:	c3                   	ret
+
+ffffffff80107341 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+ffffffff80107341:	55                   	push   %rbp
+ffffffff80107342:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107345:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80107349:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ffffffff8010734c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  uintp addr;
+  if(arguintp(n, &addr) < 0)
+ffffffff80107350:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+ffffffff80107354:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80107357:	48 89 d6             	mov    %rdx,%rsi
+ffffffff8010735a:	89 c7                	mov    %eax,%edi
+ffffffff8010735c:	e8 38 ff ff ff       	call   ffffffff80107299 <arguintp>
+ffffffff80107361:	85 c0                	test   %eax,%eax
+ffffffff80107363:	79 07                	jns    ffffffff8010736c <argstr+0x2b>
+    return -1;
+ffffffff80107365:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010736a:	eb 13                	jmp    ffffffff8010737f <argstr+0x3e>
+  return fetchstr(addr, pp);
+ffffffff8010736c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107370:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+ffffffff80107374:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80107377:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010737a:	e8 c3 fd ff ff       	call   ffffffff80107142 <fetchstr>
+}
+ffffffff8010737f:	c9                   	leave
+ffffffff80107380:	c3                   	ret
+
+ffffffff80107381 <syscall>:
+[SYS_chmod]   = sys_chmod,
+};
+
+void
+syscall(void)
+{
+ffffffff80107381:	55                   	push   %rbp
+ffffffff80107382:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107385:	48 83 ec 10          	sub    $0x10,%rsp
+  int num;
+
+  num = proc->tf->eax;
+ffffffff80107389:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107390:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80107394:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80107398:	48 8b 00             	mov    (%rax),%rax
+ffffffff8010739b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+ffffffff8010739e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff801073a2:	7e 42                	jle    ffffffff801073e6 <syscall+0x65>
+ffffffff801073a4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801073a7:	83 f8 16             	cmp    $0x16,%eax
+ffffffff801073aa:	77 3a                	ja     ffffffff801073e6 <syscall+0x65>
+ffffffff801073ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801073af:	48 98                	cltq
+ffffffff801073b1:	48 8b 04 c5 c0 b5 10 	mov    -0x7fef4a40(,%rax,8),%rax
+ffffffff801073b8:	80 
+ffffffff801073b9:	48 85 c0             	test   %rax,%rax
+ffffffff801073bc:	74 28                	je     ffffffff801073e6 <syscall+0x65>
+    proc->tf->eax = syscalls[num]();
+ffffffff801073be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801073c1:	48 98                	cltq
+ffffffff801073c3:	48 8b 04 c5 c0 b5 10 	mov    -0x7fef4a40(,%rax,8),%rax
+ffffffff801073ca:	80 
+ffffffff801073cb:	ff d0                	call   *%rax
+ffffffff801073cd:	89 c2                	mov    %eax,%edx
+ffffffff801073cf:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801073d6:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801073da:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff801073de:	48 63 d2             	movslq %edx,%rdx
+ffffffff801073e1:	48 89 10             	mov    %rdx,(%rax)
+ffffffff801073e4:	eb 52                	jmp    ffffffff80107438 <syscall+0xb7>
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            proc->pid, proc->name, num);
+ffffffff801073e6:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801073ed:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801073f1:	48 8d b0 d0 00 00 00 	lea    0xd0(%rax),%rsi
+ffffffff801073f8:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801073ff:	64 48 8b 00          	mov    %fs:(%rax),%rax
+    cprintf("%d %s: unknown sys call %d\n",
+ffffffff80107403:	8b 40 1c             	mov    0x1c(%rax),%eax
+ffffffff80107406:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80107409:	89 d1                	mov    %edx,%ecx
+ffffffff8010740b:	48 89 f2             	mov    %rsi,%rdx
+ffffffff8010740e:	89 c6                	mov    %eax,%esi
+ffffffff80107410:	48 c7 c7 f0 ab 10 80 	mov    $0xffffffff8010abf0,%rdi
+ffffffff80107417:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010741c:	e8 83 91 ff ff       	call   ffffffff801005a4 <cprintf>
+    proc->tf->eax = -1;
+ffffffff80107421:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107428:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010742c:	48 8b 40 28          	mov    0x28(%rax),%rax
+ffffffff80107430:	48 c7 00 ff ff ff ff 	movq   $0xffffffffffffffff,(%rax)
+  }
+}
+ffffffff80107437:	90                   	nop
+ffffffff80107438:	90                   	nop
+ffffffff80107439:	c9                   	leave
+ffffffff8010743a:	c3                   	ret
+
+ffffffff8010743b <argfd>:
+
+// Fetch the nth word-sized system call argument as a file descriptor
+// and return both the descriptor and the corresponding struct file.
+static int
+argfd(int n, int *pfd, struct file **pf)
+{
+ffffffff8010743b:	55                   	push   %rbp
+ffffffff8010743c:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010743f:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80107443:	89 7d ec             	mov    %edi,-0x14(%rbp)
+ffffffff80107446:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff8010744a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int fd;
+  struct file *f;
+
+  if(argint(n, &fd) < 0)
+ffffffff8010744e:	48 8d 55 f4          	lea    -0xc(%rbp),%rdx
+ffffffff80107452:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80107455:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80107458:	89 c7                	mov    %eax,%edi
+ffffffff8010745a:	e8 12 fe ff ff       	call   ffffffff80107271 <argint>
+ffffffff8010745f:	85 c0                	test   %eax,%eax
+ffffffff80107461:	79 07                	jns    ffffffff8010746a <argfd+0x2f>
+    return -1;
+ffffffff80107463:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107468:	eb 62                	jmp    ffffffff801074cc <argfd+0x91>
+  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+ffffffff8010746a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff8010746d:	85 c0                	test   %eax,%eax
+ffffffff8010746f:	78 2d                	js     ffffffff8010749e <argfd+0x63>
+ffffffff80107471:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80107474:	83 f8 0f             	cmp    $0xf,%eax
+ffffffff80107477:	7f 25                	jg     ffffffff8010749e <argfd+0x63>
+ffffffff80107479:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107480:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80107484:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff80107487:	48 63 d2             	movslq %edx,%rdx
+ffffffff8010748a:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff8010748e:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+ffffffff80107493:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80107497:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff8010749c:	75 07                	jne    ffffffff801074a5 <argfd+0x6a>
+    return -1;
+ffffffff8010749e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801074a3:	eb 27                	jmp    ffffffff801074cc <argfd+0x91>
+  if(pfd)
+ffffffff801074a5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+ffffffff801074aa:	74 09                	je     ffffffff801074b5 <argfd+0x7a>
+    *pfd = fd;
+ffffffff801074ac:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff801074af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff801074b3:	89 10                	mov    %edx,(%rax)
+  if(pf)
+ffffffff801074b5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+ffffffff801074ba:	74 0b                	je     ffffffff801074c7 <argfd+0x8c>
+    *pf = f;
+ffffffff801074bc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801074c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff801074c4:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+ffffffff801074c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801074cc:	c9                   	leave
+ffffffff801074cd:	c3                   	ret
+
+ffffffff801074ce <fdalloc>:
+
+// Allocate a file descriptor for the given file.
+// Takes over file reference from caller on success.
+static int
+fdalloc(struct file *f)
+{
+ffffffff801074ce:	55                   	push   %rbp
+ffffffff801074cf:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801074d2:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff801074d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int fd;
+
+  for(fd = 0; fd < NOFILE; fd++){
+ffffffff801074da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff801074e1:	eb 46                	jmp    ffffffff80107529 <fdalloc+0x5b>
+    if(proc->ofile[fd] == 0){
+ffffffff801074e3:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801074ea:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801074ee:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff801074f1:	48 63 d2             	movslq %edx,%rdx
+ffffffff801074f4:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff801074f8:	48 8b 44 d0 08       	mov    0x8(%rax,%rdx,8),%rax
+ffffffff801074fd:	48 85 c0             	test   %rax,%rax
+ffffffff80107500:	75 23                	jne    ffffffff80107525 <fdalloc+0x57>
+      proc->ofile[fd] = f;
+ffffffff80107502:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107509:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010750d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80107510:	48 63 d2             	movslq %edx,%rdx
+ffffffff80107513:	48 8d 4a 08          	lea    0x8(%rdx),%rcx
+ffffffff80107517:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff8010751b:	48 89 54 c8 08       	mov    %rdx,0x8(%rax,%rcx,8)
+      return fd;
+ffffffff80107520:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80107523:	eb 0f                	jmp    ffffffff80107534 <fdalloc+0x66>
+  for(fd = 0; fd < NOFILE; fd++){
+ffffffff80107525:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80107529:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+ffffffff8010752d:	7e b4                	jle    ffffffff801074e3 <fdalloc+0x15>
+    }
+  }
+  return -1;
+ffffffff8010752f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff80107534:	c9                   	leave
+ffffffff80107535:	c3                   	ret
+
+ffffffff80107536 <sys_dup>:
+
+int
+sys_dup(void)
+{
+ffffffff80107536:	55                   	push   %rbp
+ffffffff80107537:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010753a:	48 83 ec 10          	sub    $0x10,%rsp
+  struct file *f;
+  int fd;
+  
+  if(argfd(0, 0, &f) < 0)
+ffffffff8010753e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+ffffffff80107542:	48 89 c2             	mov    %rax,%rdx
+ffffffff80107545:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010754a:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff8010754f:	e8 e7 fe ff ff       	call   ffffffff8010743b <argfd>
+ffffffff80107554:	85 c0                	test   %eax,%eax
+ffffffff80107556:	79 07                	jns    ffffffff8010755f <sys_dup+0x29>
+    return -1;
+ffffffff80107558:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010755d:	eb 2b                	jmp    ffffffff8010758a <sys_dup+0x54>
+  if((fd=fdalloc(f)) < 0)
+ffffffff8010755f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107563:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107566:	e8 63 ff ff ff       	call   ffffffff801074ce <fdalloc>
+ffffffff8010756b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff8010756e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80107572:	79 07                	jns    ffffffff8010757b <sys_dup+0x45>
+    return -1;
+ffffffff80107574:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107579:	eb 0f                	jmp    ffffffff8010758a <sys_dup+0x54>
+  filedup(f);
+ffffffff8010757b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010757f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107582:	e8 5f a9 ff ff       	call   ffffffff80101ee6 <filedup>
+  return fd;
+ffffffff80107587:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ffffffff8010758a:	c9                   	leave
+ffffffff8010758b:	c3                   	ret
+
+ffffffff8010758c <sys_read>:
+
+int
+sys_read(void)
+{
+ffffffff8010758c:	55                   	push   %rbp
+ffffffff8010758d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107590:	48 83 ec 20          	sub    $0x20,%rsp
+  struct file *f;
+  int n;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+ffffffff80107594:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+ffffffff80107598:	48 89 c2             	mov    %rax,%rdx
+ffffffff8010759b:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801075a0:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff801075a5:	e8 91 fe ff ff       	call   ffffffff8010743b <argfd>
+ffffffff801075aa:	85 c0                	test   %eax,%eax
+ffffffff801075ac:	78 2d                	js     ffffffff801075db <sys_read+0x4f>
+ffffffff801075ae:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+ffffffff801075b2:	48 89 c6             	mov    %rax,%rsi
+ffffffff801075b5:	bf 02 00 00 00       	mov    $0x2,%edi
+ffffffff801075ba:	e8 b2 fc ff ff       	call   ffffffff80107271 <argint>
+ffffffff801075bf:	85 c0                	test   %eax,%eax
+ffffffff801075c1:	78 18                	js     ffffffff801075db <sys_read+0x4f>
+ffffffff801075c3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff801075c6:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+ffffffff801075ca:	48 89 c6             	mov    %rax,%rsi
+ffffffff801075cd:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff801075d2:	e8 e9 fc ff ff       	call   ffffffff801072c0 <argptr>
+ffffffff801075d7:	85 c0                	test   %eax,%eax
+ffffffff801075d9:	79 07                	jns    ffffffff801075e2 <sys_read+0x56>
+    return -1;
+ffffffff801075db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801075e0:	eb 16                	jmp    ffffffff801075f8 <sys_read+0x6c>
+  return fileread(f, p, n);
+ffffffff801075e2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff801075e5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+ffffffff801075e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801075ed:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801075f0:	48 89 c7             	mov    %rax,%rdi
+ffffffff801075f3:	e8 96 aa ff ff       	call   ffffffff8010208e <fileread>
+}
+ffffffff801075f8:	c9                   	leave
+ffffffff801075f9:	c3                   	ret
+
+ffffffff801075fa <sys_write>:
+
+int
+sys_write(void)
+{
+ffffffff801075fa:	55                   	push   %rbp
+ffffffff801075fb:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801075fe:	48 83 ec 20          	sub    $0x20,%rsp
+  struct file *f;
+  int n;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+ffffffff80107602:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+ffffffff80107606:	48 89 c2             	mov    %rax,%rdx
+ffffffff80107609:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010760e:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff80107613:	e8 23 fe ff ff       	call   ffffffff8010743b <argfd>
+ffffffff80107618:	85 c0                	test   %eax,%eax
+ffffffff8010761a:	78 2d                	js     ffffffff80107649 <sys_write+0x4f>
+ffffffff8010761c:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+ffffffff80107620:	48 89 c6             	mov    %rax,%rsi
+ffffffff80107623:	bf 02 00 00 00       	mov    $0x2,%edi
+ffffffff80107628:	e8 44 fc ff ff       	call   ffffffff80107271 <argint>
+ffffffff8010762d:	85 c0                	test   %eax,%eax
+ffffffff8010762f:	78 18                	js     ffffffff80107649 <sys_write+0x4f>
+ffffffff80107631:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff80107634:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+ffffffff80107638:	48 89 c6             	mov    %rax,%rsi
+ffffffff8010763b:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff80107640:	e8 7b fc ff ff       	call   ffffffff801072c0 <argptr>
+ffffffff80107645:	85 c0                	test   %eax,%eax
+ffffffff80107647:	79 07                	jns    ffffffff80107650 <sys_write+0x56>
+    return -1;
+ffffffff80107649:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010764e:	eb 16                	jmp    ffffffff80107666 <sys_write+0x6c>
+  return filewrite(f, p, n);
+ffffffff80107650:	8b 55 f4             	mov    -0xc(%rbp),%edx
+ffffffff80107653:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+ffffffff80107657:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010765b:	48 89 ce             	mov    %rcx,%rsi
+ffffffff8010765e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107661:	e8 f0 aa ff ff       	call   ffffffff80102156 <filewrite>
+}
+ffffffff80107666:	c9                   	leave
+ffffffff80107667:	c3                   	ret
+
+ffffffff80107668 <sys_close>:
+
+int
+sys_close(void)
+{
+ffffffff80107668:	55                   	push   %rbp
+ffffffff80107669:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010766c:	48 83 ec 10          	sub    $0x10,%rsp
+  int fd;
+  struct file *f;
+  
+  if(argfd(0, &fd, &f) < 0)
+ffffffff80107670:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+ffffffff80107674:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+ffffffff80107678:	48 89 c6             	mov    %rax,%rsi
+ffffffff8010767b:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff80107680:	e8 b6 fd ff ff       	call   ffffffff8010743b <argfd>
+ffffffff80107685:	85 c0                	test   %eax,%eax
+ffffffff80107687:	79 07                	jns    ffffffff80107690 <sys_close+0x28>
+    return -1;
+ffffffff80107689:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010768e:	eb 2f                	jmp    ffffffff801076bf <sys_close+0x57>
+  proc->ofile[fd] = 0;
+ffffffff80107690:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80107697:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010769b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010769e:	48 63 d2             	movslq %edx,%rdx
+ffffffff801076a1:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff801076a5:	48 c7 44 d0 08 00 00 	movq   $0x0,0x8(%rax,%rdx,8)
+ffffffff801076ac:	00 00 
+  fileclose(f);
+ffffffff801076ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801076b2:	48 89 c7             	mov    %rax,%rdi
+ffffffff801076b5:	e8 7e a8 ff ff       	call   ffffffff80101f38 <fileclose>
+  return 0;
+ffffffff801076ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801076bf:	c9                   	leave
+ffffffff801076c0:	c3                   	ret
+
+ffffffff801076c1 <sys_fstat>:
+
+int
+sys_fstat(void)
+{
+ffffffff801076c1:	55                   	push   %rbp
+ffffffff801076c2:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801076c5:	48 83 ec 10          	sub    $0x10,%rsp
+  struct file *f;
+  struct stat *st;
+  
+  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+ffffffff801076c9:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+ffffffff801076cd:	48 89 c2             	mov    %rax,%rdx
+ffffffff801076d0:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801076d5:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff801076da:	e8 5c fd ff ff       	call   ffffffff8010743b <argfd>
+ffffffff801076df:	85 c0                	test   %eax,%eax
+ffffffff801076e1:	78 1a                	js     ffffffff801076fd <sys_fstat+0x3c>
+ffffffff801076e3:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+ffffffff801076e7:	ba 1c 00 00 00       	mov    $0x1c,%edx
+ffffffff801076ec:	48 89 c6             	mov    %rax,%rsi
+ffffffff801076ef:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff801076f4:	e8 c7 fb ff ff       	call   ffffffff801072c0 <argptr>
+ffffffff801076f9:	85 c0                	test   %eax,%eax
+ffffffff801076fb:	79 07                	jns    ffffffff80107704 <sys_fstat+0x43>
+    return -1;
+ffffffff801076fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107702:	eb 13                	jmp    ffffffff80107717 <sys_fstat+0x56>
+  return filestat(f, st);
+ffffffff80107704:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff80107708:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010770c:	48 89 d6             	mov    %rdx,%rsi
+ffffffff8010770f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107712:	e8 17 a9 ff ff       	call   ffffffff8010202e <filestat>
+}
+ffffffff80107717:	c9                   	leave
+ffffffff80107718:	c3                   	ret
+
+ffffffff80107719 <sys_link>:
+
+// Create the path new as a link to the same inode as old.
+int
+sys_link(void)
+{
+ffffffff80107719:	55                   	push   %rbp
+ffffffff8010771a:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010771d:	48 83 ec 30          	sub    $0x30,%rsp
+  char name[DIRSIZ], *new, *old;
+  struct inode *dp, *ip;
+
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+ffffffff80107721:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+ffffffff80107725:	48 89 c6             	mov    %rax,%rsi
+ffffffff80107728:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff8010772d:	e8 0f fc ff ff       	call   ffffffff80107341 <argstr>
+ffffffff80107732:	85 c0                	test   %eax,%eax
+ffffffff80107734:	78 15                	js     ffffffff8010774b <sys_link+0x32>
+ffffffff80107736:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+ffffffff8010773a:	48 89 c6             	mov    %rax,%rsi
+ffffffff8010773d:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff80107742:	e8 fa fb ff ff       	call   ffffffff80107341 <argstr>
+ffffffff80107747:	85 c0                	test   %eax,%eax
+ffffffff80107749:	79 0a                	jns    ffffffff80107755 <sys_link+0x3c>
+    return -1;
+ffffffff8010774b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107750:	e9 74 01 00 00       	jmp    ffffffff801078c9 <sys_link+0x1b0>
+
+  begin_op();
+ffffffff80107755:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010775a:	e8 a2 cf ff ff       	call   ffffffff80104701 <begin_op>
+  if((ip = namei(old)) == 0){
+ffffffff8010775f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80107763:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107766:	e8 4d be ff ff       	call   ffffffff801035b8 <namei>
+ffffffff8010776b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff8010776f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80107774:	75 14                	jne    ffffffff8010778a <sys_link+0x71>
+    end_op();
+ffffffff80107776:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010777b:	e8 03 d0 ff ff       	call   ffffffff80104783 <end_op>
+    return -1;
+ffffffff80107780:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107785:	e9 3f 01 00 00       	jmp    ffffffff801078c9 <sys_link+0x1b0>
+  }
+
+  ilock(ip);
+ffffffff8010778a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010778e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107791:	e8 fb b0 ff ff       	call   ffffffff80102891 <ilock>
+  if(ip->type == T_DIR){
+ffffffff80107796:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010779a:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff8010779e:	66 83 f8 01          	cmp    $0x1,%ax
+ffffffff801077a2:	75 20                	jne    ffffffff801077c4 <sys_link+0xab>
+    iunlockput(ip);
+ffffffff801077a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801077a8:	48 89 c7             	mov    %rax,%rdi
+ffffffff801077ab:	e8 d7 b3 ff ff       	call   ffffffff80102b87 <iunlockput>
+    end_op();
+ffffffff801077b0:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801077b5:	e8 c9 cf ff ff       	call   ffffffff80104783 <end_op>
+    return -1;
+ffffffff801077ba:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801077bf:	e9 05 01 00 00       	jmp    ffffffff801078c9 <sys_link+0x1b0>
+  }
+
+  ip->nlink++;
+ffffffff801077c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801077c8:	0f b7 40 16          	movzwl 0x16(%rax),%eax
+ffffffff801077cc:	83 c0 01             	add    $0x1,%eax
+ffffffff801077cf:	89 c2                	mov    %eax,%edx
+ffffffff801077d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801077d5:	66 89 50 16          	mov    %dx,0x16(%rax)
+  iupdate(ip);
+ffffffff801077d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801077dd:	48 89 c7             	mov    %rax,%rdi
+ffffffff801077e0:	e8 a0 ae ff ff       	call   ffffffff80102685 <iupdate>
+  iunlock(ip);
+ffffffff801077e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801077e9:	48 89 c7             	mov    %rax,%rdi
+ffffffff801077ec:	e8 3f b2 ff ff       	call   ffffffff80102a30 <iunlock>
+
+  if((dp = nameiparent(new, name)) == 0)
+ffffffff801077f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801077f5:	48 8d 55 e2          	lea    -0x1e(%rbp),%rdx
+ffffffff801077f9:	48 89 d6             	mov    %rdx,%rsi
+ffffffff801077fc:	48 89 c7             	mov    %rax,%rdi
+ffffffff801077ff:	e8 d7 bd ff ff       	call   ffffffff801035db <nameiparent>
+ffffffff80107804:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff80107808:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff8010780d:	74 71                	je     ffffffff80107880 <sys_link+0x167>
+    goto bad;
+  ilock(dp);
+ffffffff8010780f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107813:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107816:	e8 76 b0 ff ff       	call   ffffffff80102891 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+ffffffff8010781b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010781f:	8b 10                	mov    (%rax),%edx
+ffffffff80107821:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107825:	8b 00                	mov    (%rax),%eax
+ffffffff80107827:	39 c2                	cmp    %eax,%edx
+ffffffff80107829:	75 1e                	jne    ffffffff80107849 <sys_link+0x130>
+ffffffff8010782b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010782f:	8b 50 04             	mov    0x4(%rax),%edx
+ffffffff80107832:	48 8d 4d e2          	lea    -0x1e(%rbp),%rcx
+ffffffff80107836:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010783a:	48 89 ce             	mov    %rcx,%rsi
+ffffffff8010783d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107840:	e8 80 ba ff ff       	call   ffffffff801032c5 <dirlink>
+ffffffff80107845:	85 c0                	test   %eax,%eax
+ffffffff80107847:	79 0e                	jns    ffffffff80107857 <sys_link+0x13e>
+    iunlockput(dp);
+ffffffff80107849:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010784d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107850:	e8 32 b3 ff ff       	call   ffffffff80102b87 <iunlockput>
+    goto bad;
+ffffffff80107855:	eb 2a                	jmp    ffffffff80107881 <sys_link+0x168>
+  }
+  iunlockput(dp);
+ffffffff80107857:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010785b:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010785e:	e8 24 b3 ff ff       	call   ffffffff80102b87 <iunlockput>
+  iput(ip);
+ffffffff80107863:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107867:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010786a:	e8 33 b2 ff ff       	call   ffffffff80102aa2 <iput>
+
+  end_op();
+ffffffff8010786f:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107874:	e8 0a cf ff ff       	call   ffffffff80104783 <end_op>
+
+  return 0;
+ffffffff80107879:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010787e:	eb 49                	jmp    ffffffff801078c9 <sys_link+0x1b0>
+    goto bad;
+ffffffff80107880:	90                   	nop
+
+bad:
+  ilock(ip);
+ffffffff80107881:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107885:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107888:	e8 04 b0 ff ff       	call   ffffffff80102891 <ilock>
+  ip->nlink--;
+ffffffff8010788d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107891:	0f b7 40 16          	movzwl 0x16(%rax),%eax
+ffffffff80107895:	83 e8 01             	sub    $0x1,%eax
+ffffffff80107898:	89 c2                	mov    %eax,%edx
+ffffffff8010789a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010789e:	66 89 50 16          	mov    %dx,0x16(%rax)
+  iupdate(ip);
+ffffffff801078a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801078a6:	48 89 c7             	mov    %rax,%rdi
+ffffffff801078a9:	e8 d7 ad ff ff       	call   ffffffff80102685 <iupdate>
+  iunlockput(ip);
+ffffffff801078ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801078b2:	48 89 c7             	mov    %rax,%rdi
+ffffffff801078b5:	e8 cd b2 ff ff       	call   ffffffff80102b87 <iunlockput>
+  end_op();
+ffffffff801078ba:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801078bf:	e8 bf ce ff ff       	call   ffffffff80104783 <end_op>
+  return -1;
+ffffffff801078c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff801078c9:	c9                   	leave
+ffffffff801078ca:	c3                   	ret
+
+ffffffff801078cb <isdirempty>:
+
+// Is the directory dp empty except for "." and ".." ?
+static int
+isdirempty(struct inode *dp)
+{
+ffffffff801078cb:	55                   	push   %rbp
+ffffffff801078cc:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801078cf:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff801078d3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  int off;
+  struct dirent de;
+
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+ffffffff801078d7:	c7 45 fc 20 00 00 00 	movl   $0x20,-0x4(%rbp)
+ffffffff801078de:	eb 42                	jmp    ffffffff80107922 <isdirempty+0x57>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+ffffffff801078e0:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff801078e3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+ffffffff801078e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff801078eb:	b9 10 00 00 00       	mov    $0x10,%ecx
+ffffffff801078f0:	48 89 c7             	mov    %rax,%rdi
+ffffffff801078f3:	e8 9d b5 ff ff       	call   ffffffff80102e95 <readi>
+ffffffff801078f8:	83 f8 10             	cmp    $0x10,%eax
+ffffffff801078fb:	74 0c                	je     ffffffff80107909 <isdirempty+0x3e>
+      panic("isdirempty: readi");
+ffffffff801078fd:	48 c7 c7 0c ac 10 80 	mov    $0xffffffff8010ac0c,%rdi
+ffffffff80107904:	e8 26 90 ff ff       	call   ffffffff8010092f <panic>
+    if(de.inum != 0)
+ffffffff80107909:	0f b7 45 e0          	movzwl -0x20(%rbp),%eax
+ffffffff8010790d:	66 85 c0             	test   %ax,%ax
+ffffffff80107910:	74 07                	je     ffffffff80107919 <isdirempty+0x4e>
+      return 0;
+ffffffff80107912:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107917:	eb 1c                	jmp    ffffffff80107935 <isdirempty+0x6a>
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+ffffffff80107919:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010791c:	83 c0 10             	add    $0x10,%eax
+ffffffff8010791f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80107922:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80107926:	8b 40 20             	mov    0x20(%rax),%eax
+ffffffff80107929:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010792c:	39 c2                	cmp    %eax,%edx
+ffffffff8010792e:	72 b0                	jb     ffffffff801078e0 <isdirempty+0x15>
+  }
+  return 1;
+ffffffff80107930:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ffffffff80107935:	c9                   	leave
+ffffffff80107936:	c3                   	ret
+
+ffffffff80107937 <sys_unlink>:
+
+//PAGEBREAK!
+int
+sys_unlink(void)
+{
+ffffffff80107937:	55                   	push   %rbp
+ffffffff80107938:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010793b:	48 83 ec 40          	sub    $0x40,%rsp
+  struct inode *ip, *dp;
+  struct dirent de;
+  char name[DIRSIZ], *path;
+  uint off;
+
+  if(argstr(0, &path) < 0)
+ffffffff8010793f:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+ffffffff80107943:	48 89 c6             	mov    %rax,%rsi
+ffffffff80107946:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff8010794b:	e8 f1 f9 ff ff       	call   ffffffff80107341 <argstr>
+ffffffff80107950:	85 c0                	test   %eax,%eax
+ffffffff80107952:	79 0a                	jns    ffffffff8010795e <sys_unlink+0x27>
+    return -1;
+ffffffff80107954:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107959:	e9 cf 01 00 00       	jmp    ffffffff80107b2d <sys_unlink+0x1f6>
+
+  begin_op();
+ffffffff8010795e:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107963:	e8 99 cd ff ff       	call   ffffffff80104701 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+ffffffff80107968:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff8010796c:	48 8d 55 d2          	lea    -0x2e(%rbp),%rdx
+ffffffff80107970:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80107973:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107976:	e8 60 bc ff ff       	call   ffffffff801035db <nameiparent>
+ffffffff8010797b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff8010797f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80107984:	75 14                	jne    ffffffff8010799a <sys_unlink+0x63>
+    end_op();
+ffffffff80107986:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010798b:	e8 f3 cd ff ff       	call   ffffffff80104783 <end_op>
+    return -1;
+ffffffff80107990:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107995:	e9 93 01 00 00       	jmp    ffffffff80107b2d <sys_unlink+0x1f6>
+  }
+
+  ilock(dp);
+ffffffff8010799a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010799e:	48 89 c7             	mov    %rax,%rdi
+ffffffff801079a1:	e8 eb ae ff ff       	call   ffffffff80102891 <ilock>
+
+  // Cannot unlink "." or "..".
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+ffffffff801079a6:	48 8d 45 d2          	lea    -0x2e(%rbp),%rax
+ffffffff801079aa:	48 c7 c6 1e ac 10 80 	mov    $0xffffffff8010ac1e,%rsi
+ffffffff801079b1:	48 89 c7             	mov    %rax,%rdi
+ffffffff801079b4:	e8 11 b8 ff ff       	call   ffffffff801031ca <namecmp>
+ffffffff801079b9:	85 c0                	test   %eax,%eax
+ffffffff801079bb:	0f 84 4d 01 00 00    	je     ffffffff80107b0e <sys_unlink+0x1d7>
+ffffffff801079c1:	48 8d 45 d2          	lea    -0x2e(%rbp),%rax
+ffffffff801079c5:	48 c7 c6 20 ac 10 80 	mov    $0xffffffff8010ac20,%rsi
+ffffffff801079cc:	48 89 c7             	mov    %rax,%rdi
+ffffffff801079cf:	e8 f6 b7 ff ff       	call   ffffffff801031ca <namecmp>
+ffffffff801079d4:	85 c0                	test   %eax,%eax
+ffffffff801079d6:	0f 84 32 01 00 00    	je     ffffffff80107b0e <sys_unlink+0x1d7>
+    goto bad;
+
+  if((ip = dirlookup(dp, name, &off)) == 0)
+ffffffff801079dc:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+ffffffff801079e0:	48 8d 4d d2          	lea    -0x2e(%rbp),%rcx
+ffffffff801079e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801079e8:	48 89 ce             	mov    %rcx,%rsi
+ffffffff801079eb:	48 89 c7             	mov    %rax,%rdi
+ffffffff801079ee:	e8 01 b8 ff ff       	call   ffffffff801031f4 <dirlookup>
+ffffffff801079f3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff801079f7:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff801079fc:	0f 84 0f 01 00 00    	je     ffffffff80107b11 <sys_unlink+0x1da>
+    goto bad;
+  ilock(ip);
+ffffffff80107a02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107a06:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107a09:	e8 83 ae ff ff       	call   ffffffff80102891 <ilock>
+
+  if(ip->nlink < 1)
+ffffffff80107a0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107a12:	0f b7 40 16          	movzwl 0x16(%rax),%eax
+ffffffff80107a16:	66 85 c0             	test   %ax,%ax
+ffffffff80107a19:	7f 0c                	jg     ffffffff80107a27 <sys_unlink+0xf0>
+    panic("unlink: nlink < 1");
+ffffffff80107a1b:	48 c7 c7 23 ac 10 80 	mov    $0xffffffff8010ac23,%rdi
+ffffffff80107a22:	e8 08 8f ff ff       	call   ffffffff8010092f <panic>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+ffffffff80107a27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107a2b:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff80107a2f:	66 83 f8 01          	cmp    $0x1,%ax
+ffffffff80107a33:	75 21                	jne    ffffffff80107a56 <sys_unlink+0x11f>
+ffffffff80107a35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107a39:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107a3c:	e8 8a fe ff ff       	call   ffffffff801078cb <isdirempty>
+ffffffff80107a41:	85 c0                	test   %eax,%eax
+ffffffff80107a43:	75 11                	jne    ffffffff80107a56 <sys_unlink+0x11f>
+    iunlockput(ip);
+ffffffff80107a45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107a49:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107a4c:	e8 36 b1 ff ff       	call   ffffffff80102b87 <iunlockput>
+    goto bad;
+ffffffff80107a51:	e9 bc 00 00 00       	jmp    ffffffff80107b12 <sys_unlink+0x1db>
+  }
+
+  memset(&de, 0, sizeof(de));
+ffffffff80107a56:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+ffffffff80107a5a:	ba 10 00 00 00       	mov    $0x10,%edx
+ffffffff80107a5f:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80107a64:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107a67:	e8 d3 f2 ff ff       	call   ffffffff80106d3f <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+ffffffff80107a6c:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+ffffffff80107a6f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+ffffffff80107a73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107a77:	b9 10 00 00 00       	mov    $0x10,%ecx
+ffffffff80107a7c:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107a7f:	e8 95 b5 ff ff       	call   ffffffff80103019 <writei>
+ffffffff80107a84:	83 f8 10             	cmp    $0x10,%eax
+ffffffff80107a87:	74 0c                	je     ffffffff80107a95 <sys_unlink+0x15e>
+    panic("unlink: writei");
+ffffffff80107a89:	48 c7 c7 35 ac 10 80 	mov    $0xffffffff8010ac35,%rdi
+ffffffff80107a90:	e8 9a 8e ff ff       	call   ffffffff8010092f <panic>
+  if(ip->type == T_DIR){
+ffffffff80107a95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107a99:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff80107a9d:	66 83 f8 01          	cmp    $0x1,%ax
+ffffffff80107aa1:	75 21                	jne    ffffffff80107ac4 <sys_unlink+0x18d>
+    dp->nlink--;
+ffffffff80107aa3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107aa7:	0f b7 40 16          	movzwl 0x16(%rax),%eax
+ffffffff80107aab:	83 e8 01             	sub    $0x1,%eax
+ffffffff80107aae:	89 c2                	mov    %eax,%edx
+ffffffff80107ab0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107ab4:	66 89 50 16          	mov    %dx,0x16(%rax)
+    iupdate(dp);
+ffffffff80107ab8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107abc:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107abf:	e8 c1 ab ff ff       	call   ffffffff80102685 <iupdate>
+  }
+  iunlockput(dp);
+ffffffff80107ac4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107ac8:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107acb:	e8 b7 b0 ff ff       	call   ffffffff80102b87 <iunlockput>
+
+  ip->nlink--;
+ffffffff80107ad0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107ad4:	0f b7 40 16          	movzwl 0x16(%rax),%eax
+ffffffff80107ad8:	83 e8 01             	sub    $0x1,%eax
+ffffffff80107adb:	89 c2                	mov    %eax,%edx
+ffffffff80107add:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107ae1:	66 89 50 16          	mov    %dx,0x16(%rax)
+  iupdate(ip);
+ffffffff80107ae5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107ae9:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107aec:	e8 94 ab ff ff       	call   ffffffff80102685 <iupdate>
+  iunlockput(ip);
+ffffffff80107af1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107af5:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107af8:	e8 8a b0 ff ff       	call   ffffffff80102b87 <iunlockput>
+
+  end_op();
+ffffffff80107afd:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107b02:	e8 7c cc ff ff       	call   ffffffff80104783 <end_op>
+
+  return 0;
+ffffffff80107b07:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107b0c:	eb 1f                	jmp    ffffffff80107b2d <sys_unlink+0x1f6>
+    goto bad;
+ffffffff80107b0e:	90                   	nop
+ffffffff80107b0f:	eb 01                	jmp    ffffffff80107b12 <sys_unlink+0x1db>
+    goto bad;
+ffffffff80107b11:	90                   	nop
+
+bad:
+  iunlockput(dp);
+ffffffff80107b12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107b16:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107b19:	e8 69 b0 ff ff       	call   ffffffff80102b87 <iunlockput>
+  end_op();
+ffffffff80107b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107b23:	e8 5b cc ff ff       	call   ffffffff80104783 <end_op>
+  return -1;
+ffffffff80107b28:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ffffffff80107b2d:	c9                   	leave
+ffffffff80107b2e:	c3                   	ret
+
+ffffffff80107b2f <create>:
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+ffffffff80107b2f:	55                   	push   %rbp
+ffffffff80107b30:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107b33:	48 83 ec 50          	sub    $0x50,%rsp
+ffffffff80107b37:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+ffffffff80107b3b:	89 c8                	mov    %ecx,%eax
+ffffffff80107b3d:	89 f1                	mov    %esi,%ecx
+ffffffff80107b3f:	66 89 4d c4          	mov    %cx,-0x3c(%rbp)
+ffffffff80107b43:	66 89 55 c0          	mov    %dx,-0x40(%rbp)
+ffffffff80107b47:	66 89 45 bc          	mov    %ax,-0x44(%rbp)
+  uint off;
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+ffffffff80107b4b:	48 8d 55 de          	lea    -0x22(%rbp),%rdx
+ffffffff80107b4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80107b53:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80107b56:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107b59:	e8 7d ba ff ff       	call   ffffffff801035db <nameiparent>
+ffffffff80107b5e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80107b62:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80107b67:	75 0a                	jne    ffffffff80107b73 <create+0x44>
+    return 0;
+ffffffff80107b69:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107b6e:	e9 88 01 00 00       	jmp    ffffffff80107cfb <create+0x1cc>
+  ilock(dp);
+ffffffff80107b73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107b77:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107b7a:	e8 12 ad ff ff       	call   ffffffff80102891 <ilock>
+
+  if((ip = dirlookup(dp, name, &off)) != 0){
+ffffffff80107b7f:	48 8d 55 ec          	lea    -0x14(%rbp),%rdx
+ffffffff80107b83:	48 8d 4d de          	lea    -0x22(%rbp),%rcx
+ffffffff80107b87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107b8b:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80107b8e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107b91:	e8 5e b6 ff ff       	call   ffffffff801031f4 <dirlookup>
+ffffffff80107b96:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff80107b9a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80107b9f:	74 4c                	je     ffffffff80107bed <create+0xbe>
+    iunlockput(dp);
+ffffffff80107ba1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107ba5:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107ba8:	e8 da af ff ff       	call   ffffffff80102b87 <iunlockput>
+    ilock(ip);
+ffffffff80107bad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107bb1:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107bb4:	e8 d8 ac ff ff       	call   ffffffff80102891 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+ffffffff80107bb9:	66 83 7d c4 02       	cmpw   $0x2,-0x3c(%rbp)
+ffffffff80107bbe:	75 17                	jne    ffffffff80107bd7 <create+0xa8>
+ffffffff80107bc0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107bc4:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff80107bc8:	66 83 f8 02          	cmp    $0x2,%ax
+ffffffff80107bcc:	75 09                	jne    ffffffff80107bd7 <create+0xa8>
+      return ip;
+ffffffff80107bce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107bd2:	e9 24 01 00 00       	jmp    ffffffff80107cfb <create+0x1cc>
+    iunlockput(ip);
+ffffffff80107bd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107bdb:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107bde:	e8 a4 af ff ff       	call   ffffffff80102b87 <iunlockput>
+    return 0;
+ffffffff80107be3:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107be8:	e9 0e 01 00 00       	jmp    ffffffff80107cfb <create+0x1cc>
+  }
+
+  if((ip = ialloc(dp->dev, type)) == 0)
+ffffffff80107bed:	0f bf 55 c4          	movswl -0x3c(%rbp),%edx
+ffffffff80107bf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107bf5:	8b 00                	mov    (%rax),%eax
+ffffffff80107bf7:	89 d6                	mov    %edx,%esi
+ffffffff80107bf9:	89 c7                	mov    %eax,%edi
+ffffffff80107bfb:	e8 9e a9 ff ff       	call   ffffffff8010259e <ialloc>
+ffffffff80107c00:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff80107c04:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80107c09:	75 0c                	jne    ffffffff80107c17 <create+0xe8>
+    panic("create: ialloc");
+ffffffff80107c0b:	48 c7 c7 44 ac 10 80 	mov    $0xffffffff8010ac44,%rdi
+ffffffff80107c12:	e8 18 8d ff ff       	call   ffffffff8010092f <panic>
+
+  ilock(ip);
+ffffffff80107c17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107c1b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107c1e:	e8 6e ac ff ff       	call   ffffffff80102891 <ilock>
+  ip->major = major;
+ffffffff80107c23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107c27:	0f b7 55 c0          	movzwl -0x40(%rbp),%edx
+ffffffff80107c2b:	66 89 50 12          	mov    %dx,0x12(%rax)
+  ip->minor = minor;
+ffffffff80107c2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107c33:	0f b7 55 bc          	movzwl -0x44(%rbp),%edx
+ffffffff80107c37:	66 89 50 14          	mov    %dx,0x14(%rax)
+  ip->nlink = 1;
+ffffffff80107c3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107c3f:	66 c7 40 16 01 00    	movw   $0x1,0x16(%rax)
+  iupdate(ip);
+ffffffff80107c45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107c49:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107c4c:	e8 34 aa ff ff       	call   ffffffff80102685 <iupdate>
+
+  if(type == T_DIR){  // Create . and .. entries.
+ffffffff80107c51:	66 83 7d c4 01       	cmpw   $0x1,-0x3c(%rbp)
+ffffffff80107c56:	75 69                	jne    ffffffff80107cc1 <create+0x192>
+    dp->nlink++;  // for ".."
+ffffffff80107c58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107c5c:	0f b7 40 16          	movzwl 0x16(%rax),%eax
+ffffffff80107c60:	83 c0 01             	add    $0x1,%eax
+ffffffff80107c63:	89 c2                	mov    %eax,%edx
+ffffffff80107c65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107c69:	66 89 50 16          	mov    %dx,0x16(%rax)
+    iupdate(dp);
+ffffffff80107c6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107c71:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107c74:	e8 0c aa ff ff       	call   ffffffff80102685 <iupdate>
+    // No ip->nlink++ for ".": avoid cyclic ref count.
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+ffffffff80107c79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107c7d:	8b 50 04             	mov    0x4(%rax),%edx
+ffffffff80107c80:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107c84:	48 c7 c6 1e ac 10 80 	mov    $0xffffffff8010ac1e,%rsi
+ffffffff80107c8b:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107c8e:	e8 32 b6 ff ff       	call   ffffffff801032c5 <dirlink>
+ffffffff80107c93:	85 c0                	test   %eax,%eax
+ffffffff80107c95:	78 1e                	js     ffffffff80107cb5 <create+0x186>
+ffffffff80107c97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107c9b:	8b 50 04             	mov    0x4(%rax),%edx
+ffffffff80107c9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107ca2:	48 c7 c6 20 ac 10 80 	mov    $0xffffffff8010ac20,%rsi
+ffffffff80107ca9:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107cac:	e8 14 b6 ff ff       	call   ffffffff801032c5 <dirlink>
+ffffffff80107cb1:	85 c0                	test   %eax,%eax
+ffffffff80107cb3:	79 0c                	jns    ffffffff80107cc1 <create+0x192>
+      panic("create dots");
+ffffffff80107cb5:	48 c7 c7 53 ac 10 80 	mov    $0xffffffff8010ac53,%rdi
+ffffffff80107cbc:	e8 6e 8c ff ff       	call   ffffffff8010092f <panic>
+  }
+
+  if(dirlink(dp, name, ip->inum) < 0)
+ffffffff80107cc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107cc5:	8b 50 04             	mov    0x4(%rax),%edx
+ffffffff80107cc8:	48 8d 4d de          	lea    -0x22(%rbp),%rcx
+ffffffff80107ccc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107cd0:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80107cd3:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107cd6:	e8 ea b5 ff ff       	call   ffffffff801032c5 <dirlink>
+ffffffff80107cdb:	85 c0                	test   %eax,%eax
+ffffffff80107cdd:	79 0c                	jns    ffffffff80107ceb <create+0x1bc>
+    panic("create: dirlink");
+ffffffff80107cdf:	48 c7 c7 5f ac 10 80 	mov    $0xffffffff8010ac5f,%rdi
+ffffffff80107ce6:	e8 44 8c ff ff       	call   ffffffff8010092f <panic>
+
+  iunlockput(dp);
+ffffffff80107ceb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107cef:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107cf2:	e8 90 ae ff ff       	call   ffffffff80102b87 <iunlockput>
+
+  return ip;
+ffffffff80107cf7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+ffffffff80107cfb:	c9                   	leave
+ffffffff80107cfc:	c3                   	ret
+
+ffffffff80107cfd <sys_open>:
+
+int
+sys_open(void)
+{
+ffffffff80107cfd:	55                   	push   %rbp
+ffffffff80107cfe:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107d01:	48 83 ec 30          	sub    $0x30,%rsp
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+ffffffff80107d05:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+ffffffff80107d09:	48 89 c6             	mov    %rax,%rsi
+ffffffff80107d0c:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff80107d11:	e8 2b f6 ff ff       	call   ffffffff80107341 <argstr>
+ffffffff80107d16:	85 c0                	test   %eax,%eax
+ffffffff80107d18:	78 15                	js     ffffffff80107d2f <sys_open+0x32>
+ffffffff80107d1a:	48 8d 45 dc          	lea    -0x24(%rbp),%rax
+ffffffff80107d1e:	48 89 c6             	mov    %rax,%rsi
+ffffffff80107d21:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff80107d26:	e8 46 f5 ff ff       	call   ffffffff80107271 <argint>
+ffffffff80107d2b:	85 c0                	test   %eax,%eax
+ffffffff80107d2d:	79 0a                	jns    ffffffff80107d39 <sys_open+0x3c>
+    return -1;
+ffffffff80107d2f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107d34:	e9 8c 01 00 00       	jmp    ffffffff80107ec5 <sys_open+0x1c8>
+
+  begin_op();
+ffffffff80107d39:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107d3e:	e8 be c9 ff ff       	call   ffffffff80104701 <begin_op>
+
+  if(omode & O_CREATE){
+ffffffff80107d43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80107d46:	25 00 02 00 00       	and    $0x200,%eax
+ffffffff80107d4b:	85 c0                	test   %eax,%eax
+ffffffff80107d4d:	74 3e                	je     ffffffff80107d8d <sys_open+0x90>
+    ip = create(path, T_FILE, 0, 0);
+ffffffff80107d4f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80107d53:	b9 00 00 00 00       	mov    $0x0,%ecx
+ffffffff80107d58:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff80107d5d:	be 02 00 00 00       	mov    $0x2,%esi
+ffffffff80107d62:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107d65:	e8 c5 fd ff ff       	call   ffffffff80107b2f <create>
+ffffffff80107d6a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if(ip == 0){
+ffffffff80107d6e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80107d73:	0f 85 80 00 00 00    	jne    ffffffff80107df9 <sys_open+0xfc>
+      end_op();
+ffffffff80107d79:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107d7e:	e8 00 ca ff ff       	call   ffffffff80104783 <end_op>
+      return -1;
+ffffffff80107d83:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107d88:	e9 38 01 00 00       	jmp    ffffffff80107ec5 <sys_open+0x1c8>
+    }
+  } else {
+    if((ip = namei(path)) == 0){
+ffffffff80107d8d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80107d91:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107d94:	e8 1f b8 ff ff       	call   ffffffff801035b8 <namei>
+ffffffff80107d99:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80107d9d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80107da2:	75 14                	jne    ffffffff80107db8 <sys_open+0xbb>
+      end_op();
+ffffffff80107da4:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107da9:	e8 d5 c9 ff ff       	call   ffffffff80104783 <end_op>
+      return -1;
+ffffffff80107dae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107db3:	e9 0d 01 00 00       	jmp    ffffffff80107ec5 <sys_open+0x1c8>
+    }
+    ilock(ip);
+ffffffff80107db8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107dbc:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107dbf:	e8 cd aa ff ff       	call   ffffffff80102891 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+ffffffff80107dc4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107dc8:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff80107dcc:	66 83 f8 01          	cmp    $0x1,%ax
+ffffffff80107dd0:	75 27                	jne    ffffffff80107df9 <sys_open+0xfc>
+ffffffff80107dd2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80107dd5:	85 c0                	test   %eax,%eax
+ffffffff80107dd7:	74 20                	je     ffffffff80107df9 <sys_open+0xfc>
+      iunlockput(ip);
+ffffffff80107dd9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107ddd:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107de0:	e8 a2 ad ff ff       	call   ffffffff80102b87 <iunlockput>
+      end_op();
+ffffffff80107de5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107dea:	e8 94 c9 ff ff       	call   ffffffff80104783 <end_op>
+      return -1;
+ffffffff80107def:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107df4:	e9 cc 00 00 00       	jmp    ffffffff80107ec5 <sys_open+0x1c8>
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+ffffffff80107df9:	e8 7d a0 ff ff       	call   ffffffff80101e7b <filealloc>
+ffffffff80107dfe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+ffffffff80107e02:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80107e07:	74 15                	je     ffffffff80107e1e <sys_open+0x121>
+ffffffff80107e09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107e0d:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107e10:	e8 b9 f6 ff ff       	call   ffffffff801074ce <fdalloc>
+ffffffff80107e15:	89 45 ec             	mov    %eax,-0x14(%rbp)
+ffffffff80107e18:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+ffffffff80107e1c:	79 30                	jns    ffffffff80107e4e <sys_open+0x151>
+    if(f)
+ffffffff80107e1e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80107e23:	74 0c                	je     ffffffff80107e31 <sys_open+0x134>
+      fileclose(f);
+ffffffff80107e25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107e29:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107e2c:	e8 07 a1 ff ff       	call   ffffffff80101f38 <fileclose>
+    iunlockput(ip);
+ffffffff80107e31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107e35:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107e38:	e8 4a ad ff ff       	call   ffffffff80102b87 <iunlockput>
+    end_op();
+ffffffff80107e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107e42:	e8 3c c9 ff ff       	call   ffffffff80104783 <end_op>
+    return -1;
+ffffffff80107e47:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107e4c:	eb 77                	jmp    ffffffff80107ec5 <sys_open+0x1c8>
+  }
+  iunlock(ip);
+ffffffff80107e4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107e52:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107e55:	e8 d6 ab ff ff       	call   ffffffff80102a30 <iunlock>
+  end_op();
+ffffffff80107e5a:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107e5f:	e8 1f c9 ff ff       	call   ffffffff80104783 <end_op>
+
+  f->type = FD_INODE;
+ffffffff80107e64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107e68:	c7 00 02 00 00 00    	movl   $0x2,(%rax)
+  f->ip = ip;
+ffffffff80107e6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107e72:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff80107e76:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  f->off = 0;
+ffffffff80107e7a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107e7e:	c7 40 20 00 00 00 00 	movl   $0x0,0x20(%rax)
+  f->readable = !(omode & O_WRONLY);
+ffffffff80107e85:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80107e88:	83 e0 01             	and    $0x1,%eax
+ffffffff80107e8b:	85 c0                	test   %eax,%eax
+ffffffff80107e8d:	0f 94 c0             	sete   %al
+ffffffff80107e90:	89 c2                	mov    %eax,%edx
+ffffffff80107e92:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107e96:	88 50 08             	mov    %dl,0x8(%rax)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+ffffffff80107e99:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80107e9c:	83 e0 01             	and    $0x1,%eax
+ffffffff80107e9f:	85 c0                	test   %eax,%eax
+ffffffff80107ea1:	75 0a                	jne    ffffffff80107ead <sys_open+0x1b0>
+ffffffff80107ea3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff80107ea6:	83 e0 02             	and    $0x2,%eax
+ffffffff80107ea9:	85 c0                	test   %eax,%eax
+ffffffff80107eab:	74 07                	je     ffffffff80107eb4 <sys_open+0x1b7>
+ffffffff80107ead:	b8 01 00 00 00       	mov    $0x1,%eax
+ffffffff80107eb2:	eb 05                	jmp    ffffffff80107eb9 <sys_open+0x1bc>
+ffffffff80107eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107eb9:	89 c2                	mov    %eax,%edx
+ffffffff80107ebb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107ebf:	88 50 09             	mov    %dl,0x9(%rax)
+  return fd;
+ffffffff80107ec2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+ffffffff80107ec5:	c9                   	leave
+ffffffff80107ec6:	c3                   	ret
+
+ffffffff80107ec7 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+ffffffff80107ec7:	55                   	push   %rbp
+ffffffff80107ec8:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107ecb:	48 83 ec 10          	sub    $0x10,%rsp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+ffffffff80107ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107ed4:	e8 28 c8 ff ff       	call   ffffffff80104701 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+ffffffff80107ed9:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+ffffffff80107edd:	48 89 c6             	mov    %rax,%rsi
+ffffffff80107ee0:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff80107ee5:	e8 57 f4 ff ff       	call   ffffffff80107341 <argstr>
+ffffffff80107eea:	85 c0                	test   %eax,%eax
+ffffffff80107eec:	78 26                	js     ffffffff80107f14 <sys_mkdir+0x4d>
+ffffffff80107eee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107ef2:	b9 00 00 00 00       	mov    $0x0,%ecx
+ffffffff80107ef7:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff80107efc:	be 01 00 00 00       	mov    $0x1,%esi
+ffffffff80107f01:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107f04:	e8 26 fc ff ff       	call   ffffffff80107b2f <create>
+ffffffff80107f09:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80107f0d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80107f12:	75 11                	jne    ffffffff80107f25 <sys_mkdir+0x5e>
+    end_op();
+ffffffff80107f14:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107f19:	e8 65 c8 ff ff       	call   ffffffff80104783 <end_op>
+    return -1;
+ffffffff80107f1e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107f23:	eb 1b                	jmp    ffffffff80107f40 <sys_mkdir+0x79>
+  }
+  iunlockput(ip);
+ffffffff80107f25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80107f29:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107f2c:	e8 56 ac ff ff       	call   ffffffff80102b87 <iunlockput>
+  end_op();
+ffffffff80107f31:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107f36:	e8 48 c8 ff ff       	call   ffffffff80104783 <end_op>
+  return 0;
+ffffffff80107f3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80107f40:	c9                   	leave
+ffffffff80107f41:	c3                   	ret
+
+ffffffff80107f42 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+ffffffff80107f42:	55                   	push   %rbp
+ffffffff80107f43:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107f46:	48 83 ec 20          	sub    $0x20,%rsp
+  struct inode *ip;
+  char *path;
+  int len;
+  int major, minor;
+  
+  begin_op();
+ffffffff80107f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107f4f:	e8 ad c7 ff ff       	call   ffffffff80104701 <begin_op>
+  if((len=argstr(0, &path)) < 0 ||
+ffffffff80107f54:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+ffffffff80107f58:	48 89 c6             	mov    %rax,%rsi
+ffffffff80107f5b:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff80107f60:	e8 dc f3 ff ff       	call   ffffffff80107341 <argstr>
+ffffffff80107f65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80107f68:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80107f6c:	78 52                	js     ffffffff80107fc0 <sys_mknod+0x7e>
+     argint(1, &major) < 0 ||
+ffffffff80107f6e:	48 8d 45 e4          	lea    -0x1c(%rbp),%rax
+ffffffff80107f72:	48 89 c6             	mov    %rax,%rsi
+ffffffff80107f75:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff80107f7a:	e8 f2 f2 ff ff       	call   ffffffff80107271 <argint>
+  if((len=argstr(0, &path)) < 0 ||
+ffffffff80107f7f:	85 c0                	test   %eax,%eax
+ffffffff80107f81:	78 3d                	js     ffffffff80107fc0 <sys_mknod+0x7e>
+     argint(2, &minor) < 0 ||
+ffffffff80107f83:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+ffffffff80107f87:	48 89 c6             	mov    %rax,%rsi
+ffffffff80107f8a:	bf 02 00 00 00       	mov    $0x2,%edi
+ffffffff80107f8f:	e8 dd f2 ff ff       	call   ffffffff80107271 <argint>
+     argint(1, &major) < 0 ||
+ffffffff80107f94:	85 c0                	test   %eax,%eax
+ffffffff80107f96:	78 28                	js     ffffffff80107fc0 <sys_mknod+0x7e>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+ffffffff80107f98:	8b 45 e0             	mov    -0x20(%rbp),%eax
+ffffffff80107f9b:	0f bf c8             	movswl %ax,%ecx
+ffffffff80107f9e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80107fa1:	0f bf d0             	movswl %ax,%edx
+ffffffff80107fa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80107fa8:	be 03 00 00 00       	mov    $0x3,%esi
+ffffffff80107fad:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107fb0:	e8 7a fb ff ff       	call   ffffffff80107b2f <create>
+ffffffff80107fb5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+     argint(2, &minor) < 0 ||
+ffffffff80107fb9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80107fbe:	75 11                	jne    ffffffff80107fd1 <sys_mknod+0x8f>
+    end_op();
+ffffffff80107fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107fc5:	e8 b9 c7 ff ff       	call   ffffffff80104783 <end_op>
+    return -1;
+ffffffff80107fca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80107fcf:	eb 1b                	jmp    ffffffff80107fec <sys_mknod+0xaa>
+  }
+  iunlockput(ip);
+ffffffff80107fd1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80107fd5:	48 89 c7             	mov    %rax,%rdi
+ffffffff80107fd8:	e8 aa ab ff ff       	call   ffffffff80102b87 <iunlockput>
+  end_op();
+ffffffff80107fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107fe2:	e8 9c c7 ff ff       	call   ffffffff80104783 <end_op>
+  return 0;
+ffffffff80107fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80107fec:	c9                   	leave
+ffffffff80107fed:	c3                   	ret
+
+ffffffff80107fee <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+ffffffff80107fee:	55                   	push   %rbp
+ffffffff80107fef:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80107ff2:	48 83 ec 10          	sub    $0x10,%rsp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+ffffffff80107ff6:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80107ffb:	e8 01 c7 ff ff       	call   ffffffff80104701 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+ffffffff80108000:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+ffffffff80108004:	48 89 c6             	mov    %rax,%rsi
+ffffffff80108007:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff8010800c:	e8 30 f3 ff ff       	call   ffffffff80107341 <argstr>
+ffffffff80108011:	85 c0                	test   %eax,%eax
+ffffffff80108013:	78 17                	js     ffffffff8010802c <sys_chdir+0x3e>
+ffffffff80108015:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80108019:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010801c:	e8 97 b5 ff ff       	call   ffffffff801035b8 <namei>
+ffffffff80108021:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80108025:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff8010802a:	75 14                	jne    ffffffff80108040 <sys_chdir+0x52>
+    end_op();
+ffffffff8010802c:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80108031:	e8 4d c7 ff ff       	call   ffffffff80104783 <end_op>
+    return -1;
+ffffffff80108036:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010803b:	e9 82 00 00 00       	jmp    ffffffff801080c2 <sys_chdir+0xd4>
+  }
+  ilock(ip);
+ffffffff80108040:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108044:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108047:	e8 45 a8 ff ff       	call   ffffffff80102891 <ilock>
+  if(ip->type != T_DIR){
+ffffffff8010804c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108050:	0f b7 40 10          	movzwl 0x10(%rax),%eax
+ffffffff80108054:	66 83 f8 01          	cmp    $0x1,%ax
+ffffffff80108058:	74 1d                	je     ffffffff80108077 <sys_chdir+0x89>
+    iunlockput(ip);
+ffffffff8010805a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010805e:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108061:	e8 21 ab ff ff       	call   ffffffff80102b87 <iunlockput>
+    end_op();
+ffffffff80108066:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010806b:	e8 13 c7 ff ff       	call   ffffffff80104783 <end_op>
+    return -1;
+ffffffff80108070:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80108075:	eb 4b                	jmp    ffffffff801080c2 <sys_chdir+0xd4>
+  }
+  iunlock(ip);
+ffffffff80108077:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010807b:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010807e:	e8 ad a9 ff ff       	call   ffffffff80102a30 <iunlock>
+  iput(proc->cwd);
+ffffffff80108083:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff8010808a:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010808e:	48 8b 80 c8 00 00 00 	mov    0xc8(%rax),%rax
+ffffffff80108095:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108098:	e8 05 aa ff ff       	call   ffffffff80102aa2 <iput>
+  end_op();
+ffffffff8010809d:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801080a2:	e8 dc c6 ff ff       	call   ffffffff80104783 <end_op>
+  proc->cwd = ip;
+ffffffff801080a7:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801080ae:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801080b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff801080b6:	48 89 90 c8 00 00 00 	mov    %rdx,0xc8(%rax)
+  return 0;
+ffffffff801080bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801080c2:	c9                   	leave
+ffffffff801080c3:	c3                   	ret
+
+ffffffff801080c4 <sys_exec>:
+
+int
+sys_exec(void)
+{
+ffffffff801080c4:	55                   	push   %rbp
+ffffffff801080c5:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801080c8:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  char *path, *argv[MAXARG];
+  int i;
+  uintp uargv, uarg;
+
+  if(argstr(0, &path) < 0 || arguintp(1, &uargv) < 0){
+ffffffff801080cf:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+ffffffff801080d3:	48 89 c6             	mov    %rax,%rsi
+ffffffff801080d6:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff801080db:	e8 61 f2 ff ff       	call   ffffffff80107341 <argstr>
+ffffffff801080e0:	85 c0                	test   %eax,%eax
+ffffffff801080e2:	78 18                	js     ffffffff801080fc <sys_exec+0x38>
+ffffffff801080e4:	48 8d 85 e8 fe ff ff 	lea    -0x118(%rbp),%rax
+ffffffff801080eb:	48 89 c6             	mov    %rax,%rsi
+ffffffff801080ee:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff801080f3:	e8 a1 f1 ff ff       	call   ffffffff80107299 <arguintp>
+ffffffff801080f8:	85 c0                	test   %eax,%eax
+ffffffff801080fa:	79 0a                	jns    ffffffff80108106 <sys_exec+0x42>
+    return -1;
+ffffffff801080fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80108101:	e9 d6 00 00 00       	jmp    ffffffff801081dc <sys_exec+0x118>
+  }
+  memset(argv, 0, sizeof(argv));
+ffffffff80108106:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+ffffffff8010810d:	ba 00 01 00 00       	mov    $0x100,%edx
+ffffffff80108112:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80108117:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010811a:	e8 20 ec ff ff       	call   ffffffff80106d3f <memset>
+  for(i=0;; i++){
+ffffffff8010811f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    if(i >= NELEM(argv))
+ffffffff80108126:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80108129:	83 f8 1f             	cmp    $0x1f,%eax
+ffffffff8010812c:	76 0a                	jbe    ffffffff80108138 <sys_exec+0x74>
+      return -1;
+ffffffff8010812e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80108133:	e9 a4 00 00 00       	jmp    ffffffff801081dc <sys_exec+0x118>
+    if(fetchuintp(uargv+sizeof(uintp)*i, &uarg) < 0)
+ffffffff80108138:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010813b:	48 98                	cltq
+ffffffff8010813d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80108144:	00 
+ffffffff80108145:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+ffffffff8010814c:	48 01 c2             	add    %rax,%rdx
+ffffffff8010814f:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+ffffffff80108156:	48 89 c6             	mov    %rax,%rsi
+ffffffff80108159:	48 89 d7             	mov    %rdx,%rdi
+ffffffff8010815c:	e8 86 ef ff ff       	call   ffffffff801070e7 <fetchuintp>
+ffffffff80108161:	85 c0                	test   %eax,%eax
+ffffffff80108163:	79 07                	jns    ffffffff8010816c <sys_exec+0xa8>
+      return -1;
+ffffffff80108165:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010816a:	eb 70                	jmp    ffffffff801081dc <sys_exec+0x118>
+    if(uarg == 0){
+ffffffff8010816c:	48 8b 85 e0 fe ff ff 	mov    -0x120(%rbp),%rax
+ffffffff80108173:	48 85 c0             	test   %rax,%rax
+ffffffff80108176:	75 2a                	jne    ffffffff801081a2 <sys_exec+0xde>
+      argv[i] = 0;
+ffffffff80108178:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010817b:	48 98                	cltq
+ffffffff8010817d:	48 c7 84 c5 f0 fe ff 	movq   $0x0,-0x110(%rbp,%rax,8)
+ffffffff80108184:	ff 00 00 00 00 
+      break;
+ffffffff80108189:	90                   	nop
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+      return -1;
+  }
+  return exec(path, argv);
+ffffffff8010818a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010818e:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+ffffffff80108195:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80108198:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010819b:	e8 98 97 ff ff       	call   ffffffff80101938 <exec>
+ffffffff801081a0:	eb 3a                	jmp    ffffffff801081dc <sys_exec+0x118>
+    if(fetchstr(uarg, &argv[i]) < 0)
+ffffffff801081a2:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+ffffffff801081a9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff801081ac:	48 63 d2             	movslq %edx,%rdx
+ffffffff801081af:	48 c1 e2 03          	shl    $0x3,%rdx
+ffffffff801081b3:	48 01 c2             	add    %rax,%rdx
+ffffffff801081b6:	48 8b 85 e0 fe ff ff 	mov    -0x120(%rbp),%rax
+ffffffff801081bd:	48 89 d6             	mov    %rdx,%rsi
+ffffffff801081c0:	48 89 c7             	mov    %rax,%rdi
+ffffffff801081c3:	e8 7a ef ff ff       	call   ffffffff80107142 <fetchstr>
+ffffffff801081c8:	85 c0                	test   %eax,%eax
+ffffffff801081ca:	79 07                	jns    ffffffff801081d3 <sys_exec+0x10f>
+      return -1;
+ffffffff801081cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801081d1:	eb 09                	jmp    ffffffff801081dc <sys_exec+0x118>
+  for(i=0;; i++){
+ffffffff801081d3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    if(i >= NELEM(argv))
+ffffffff801081d7:	e9 4a ff ff ff       	jmp    ffffffff80108126 <sys_exec+0x62>
+}
+ffffffff801081dc:	c9                   	leave
+ffffffff801081dd:	c3                   	ret
+
+ffffffff801081de <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+ffffffff801081de:	55                   	push   %rbp
+ffffffff801081df:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801081e2:	48 83 ec 20          	sub    $0x20,%rsp
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+ffffffff801081e6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+ffffffff801081ea:	ba 08 00 00 00       	mov    $0x8,%edx
+ffffffff801081ef:	48 89 c6             	mov    %rax,%rsi
+ffffffff801081f2:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff801081f7:	e8 c4 f0 ff ff       	call   ffffffff801072c0 <argptr>
+ffffffff801081fc:	85 c0                	test   %eax,%eax
+ffffffff801081fe:	79 0a                	jns    ffffffff8010820a <sys_pipe+0x2c>
+    return -1;
+ffffffff80108200:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80108205:	e9 b0 00 00 00       	jmp    ffffffff801082ba <sys_pipe+0xdc>
+  if(pipealloc(&rf, &wf) < 0)
+ffffffff8010820a:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+ffffffff8010820e:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+ffffffff80108212:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80108215:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108218:	e8 25 d5 ff ff       	call   ffffffff80105742 <pipealloc>
+ffffffff8010821d:	85 c0                	test   %eax,%eax
+ffffffff8010821f:	79 0a                	jns    ffffffff8010822b <sys_pipe+0x4d>
+    return -1;
+ffffffff80108221:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80108226:	e9 8f 00 00 00       	jmp    ffffffff801082ba <sys_pipe+0xdc>
+  fd0 = -1;
+ffffffff8010822b:	c7 45 fc ff ff ff ff 	movl   $0xffffffff,-0x4(%rbp)
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+ffffffff80108232:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80108236:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108239:	e8 90 f2 ff ff       	call   ffffffff801074ce <fdalloc>
+ffffffff8010823e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+ffffffff80108241:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80108245:	78 15                	js     ffffffff8010825c <sys_pipe+0x7e>
+ffffffff80108247:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010824b:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010824e:	e8 7b f2 ff ff       	call   ffffffff801074ce <fdalloc>
+ffffffff80108253:	89 45 f8             	mov    %eax,-0x8(%rbp)
+ffffffff80108256:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+ffffffff8010825a:	79 43                	jns    ffffffff8010829f <sys_pipe+0xc1>
+    if(fd0 >= 0)
+ffffffff8010825c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+ffffffff80108260:	78 1e                	js     ffffffff80108280 <sys_pipe+0xa2>
+      proc->ofile[fd0] = 0;
+ffffffff80108262:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80108269:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010826d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff80108270:	48 63 d2             	movslq %edx,%rdx
+ffffffff80108273:	48 83 c2 08          	add    $0x8,%rdx
+ffffffff80108277:	48 c7 44 d0 08 00 00 	movq   $0x0,0x8(%rax,%rdx,8)
+ffffffff8010827e:	00 00 
+    fileclose(rf);
+ffffffff80108280:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80108284:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108287:	e8 ac 9c ff ff       	call   ffffffff80101f38 <fileclose>
+    fileclose(wf);
+ffffffff8010828c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80108290:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108293:	e8 a0 9c ff ff       	call   ffffffff80101f38 <fileclose>
+    return -1;
+ffffffff80108298:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010829d:	eb 1b                	jmp    ffffffff801082ba <sys_pipe+0xdc>
+  }
+  fd[0] = fd0;
+ffffffff8010829f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801082a3:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff801082a6:	89 10                	mov    %edx,(%rax)
+  fd[1] = fd1;
+ffffffff801082a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801082ac:	48 8d 50 04          	lea    0x4(%rax),%rdx
+ffffffff801082b0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+ffffffff801082b3:	89 02                	mov    %eax,(%rdx)
+  return 0;
+ffffffff801082b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801082ba:	c9                   	leave
+ffffffff801082bb:	c3                   	ret
+
+ffffffff801082bc <sys_chmod>:
+
+int
+sys_chmod(void)
+{
+ffffffff801082bc:	55                   	push   %rbp
+ffffffff801082bd:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801082c0:	48 83 ec 20          	sub    $0x20,%rsp
+    char *path;
+    int mode;
+    struct inode *ip;
+    if(argstr(0, &path) < 0 || argint(1, &mode) < 0)
+ffffffff801082c4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+ffffffff801082c8:	48 89 c6             	mov    %rax,%rsi
+ffffffff801082cb:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff801082d0:	e8 6c f0 ff ff       	call   ffffffff80107341 <argstr>
+ffffffff801082d5:	85 c0                	test   %eax,%eax
+ffffffff801082d7:	78 15                	js     ffffffff801082ee <sys_chmod+0x32>
+ffffffff801082d9:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+ffffffff801082dd:	48 89 c6             	mov    %rax,%rsi
+ffffffff801082e0:	bf 01 00 00 00       	mov    $0x1,%edi
+ffffffff801082e5:	e8 87 ef ff ff       	call   ffffffff80107271 <argint>
+ffffffff801082ea:	85 c0                	test   %eax,%eax
+ffffffff801082ec:	79 07                	jns    ffffffff801082f5 <sys_chmod+0x39>
+        return -1;
+ffffffff801082ee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801082f3:	eb 71                	jmp    ffffffff80108366 <sys_chmod+0xaa>
+    begin_op();
+ffffffff801082f5:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801082fa:	e8 02 c4 ff ff       	call   ffffffff80104701 <begin_op>
+    if((ip = namei(path)) == 0) {
+ffffffff801082ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80108303:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108306:	e8 ad b2 ff ff       	call   ffffffff801035b8 <namei>
+ffffffff8010830b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff8010830f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80108314:	75 11                	jne    ffffffff80108327 <sys_chmod+0x6b>
+        end_op();
+ffffffff80108316:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010831b:	e8 63 c4 ff ff       	call   ffffffff80104783 <end_op>
+        return -1;
+ffffffff80108320:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80108325:	eb 3f                	jmp    ffffffff80108366 <sys_chmod+0xaa>
+    }
+    ilock(ip);
+ffffffff80108327:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010832b:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010832e:	e8 5e a5 ff ff       	call   ffffffff80102891 <ilock>
+    ip->mode = mode;
+ffffffff80108333:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80108336:	89 c2                	mov    %eax,%edx
+ffffffff80108338:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010833c:	89 50 1c             	mov    %edx,0x1c(%rax)
+    iupdate(ip); // Copy to disk
+ffffffff8010833f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108343:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108346:	e8 3a a3 ff ff       	call   ffffffff80102685 <iupdate>
+    iunlockput(ip);
+ffffffff8010834b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010834f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80108352:	e8 30 a8 ff ff       	call   ffffffff80102b87 <iunlockput>
+    end_op();
+ffffffff80108357:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff8010835c:	e8 22 c4 ff ff       	call   ffffffff80104783 <end_op>
+    return 0;
+ffffffff80108361:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80108366:	c9                   	leave
+ffffffff80108367:	c3                   	ret
+
+ffffffff80108368 <sys_fork>:
+#include "mmu.h"
+#include "proc.h"
+
+int
+sys_fork(void)
+{
+ffffffff80108368:	55                   	push   %rbp
+ffffffff80108369:	48 89 e5             	mov    %rsp,%rbp
+  return fork();
+ffffffff8010836c:	e8 74 db ff ff       	call   ffffffff80105ee5 <fork>
+}
+ffffffff80108371:	5d                   	pop    %rbp
+ffffffff80108372:	c3                   	ret
+
+ffffffff80108373 <sys_exit>:
+
+int
+sys_exit(void)
+{
+ffffffff80108373:	55                   	push   %rbp
+ffffffff80108374:	48 89 e5             	mov    %rsp,%rbp
+  exit();
+ffffffff80108377:	e8 09 de ff ff       	call   ffffffff80106185 <exit>
+  return 0;  // not reached
+ffffffff8010837c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80108381:	5d                   	pop    %rbp
+ffffffff80108382:	c3                   	ret
+
+ffffffff80108383 <sys_wait>:
+
+int
+sys_wait(void)
+{
+ffffffff80108383:	55                   	push   %rbp
+ffffffff80108384:	48 89 e5             	mov    %rsp,%rbp
+  return wait();
+ffffffff80108387:	e8 7e df ff ff       	call   ffffffff8010630a <wait>
+}
+ffffffff8010838c:	5d                   	pop    %rbp
+ffffffff8010838d:	c3                   	ret
+
+ffffffff8010838e <sys_kill>:
+
+int
+sys_kill(void)
+{
+ffffffff8010838e:	55                   	push   %rbp
+ffffffff8010838f:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80108392:	48 83 ec 10          	sub    $0x10,%rsp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+ffffffff80108396:	48 8d 45 fc          	lea    -0x4(%rbp),%rax
+ffffffff8010839a:	48 89 c6             	mov    %rax,%rsi
+ffffffff8010839d:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff801083a2:	e8 ca ee ff ff       	call   ffffffff80107271 <argint>
+ffffffff801083a7:	85 c0                	test   %eax,%eax
+ffffffff801083a9:	79 07                	jns    ffffffff801083b2 <sys_kill+0x24>
+    return -1;
+ffffffff801083ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff801083b0:	eb 0a                	jmp    ffffffff801083bc <sys_kill+0x2e>
+  return kill(pid);
+ffffffff801083b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff801083b5:	89 c7                	mov    %eax,%edi
+ffffffff801083b7:	e8 db e3 ff ff       	call   ffffffff80106797 <kill>
+}
+ffffffff801083bc:	c9                   	leave
+ffffffff801083bd:	c3                   	ret
+
+ffffffff801083be <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+ffffffff801083be:	55                   	push   %rbp
+ffffffff801083bf:	48 89 e5             	mov    %rsp,%rbp
+  return proc->pid;
+ffffffff801083c2:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801083c9:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801083cd:	8b 40 1c             	mov    0x1c(%rax),%eax
+}
+ffffffff801083d0:	5d                   	pop    %rbp
+ffffffff801083d1:	c3                   	ret
+
+ffffffff801083d2 <sys_sbrk>:
+
+uintp
+sys_sbrk(void)
+{
+ffffffff801083d2:	55                   	push   %rbp
+ffffffff801083d3:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801083d6:	48 83 ec 10          	sub    $0x10,%rsp
+  uintp addr;
+  uintp n;
+
+  if(arguintp(0, &n) < 0)
+ffffffff801083da:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+ffffffff801083de:	48 89 c6             	mov    %rax,%rsi
+ffffffff801083e1:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff801083e6:	e8 ae ee ff ff       	call   ffffffff80107299 <arguintp>
+ffffffff801083eb:	85 c0                	test   %eax,%eax
+ffffffff801083ed:	79 09                	jns    ffffffff801083f8 <sys_sbrk+0x26>
+    return -1;
+ffffffff801083ef:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+ffffffff801083f6:	eb 2e                	jmp    ffffffff80108426 <sys_sbrk+0x54>
+  addr = proc->sz;
+ffffffff801083f8:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801083ff:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80108403:	48 8b 00             	mov    (%rax),%rax
+ffffffff80108406:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(growproc(n) < 0)
+ffffffff8010840a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010840e:	89 c7                	mov    %eax,%edi
+ffffffff80108410:	e8 12 da ff ff       	call   ffffffff80105e27 <growproc>
+ffffffff80108415:	85 c0                	test   %eax,%eax
+ffffffff80108417:	79 09                	jns    ffffffff80108422 <sys_sbrk+0x50>
+    return -1;
+ffffffff80108419:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+ffffffff80108420:	eb 04                	jmp    ffffffff80108426 <sys_sbrk+0x54>
+  return addr;
+ffffffff80108422:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80108426:	c9                   	leave
+ffffffff80108427:	c3                   	ret
+
+ffffffff80108428 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+ffffffff80108428:	55                   	push   %rbp
+ffffffff80108429:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010842c:	48 83 ec 10          	sub    $0x10,%rsp
+  int n;
+  uint ticks0;
+  
+  if(argint(0, &n) < 0)
+ffffffff80108430:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+ffffffff80108434:	48 89 c6             	mov    %rax,%rsi
+ffffffff80108437:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff8010843c:	e8 30 ee ff ff       	call   ffffffff80107271 <argint>
+ffffffff80108441:	85 c0                	test   %eax,%eax
+ffffffff80108443:	79 07                	jns    ffffffff8010844c <sys_sleep+0x24>
+    return -1;
+ffffffff80108445:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010844a:	eb 70                	jmp    ffffffff801084bc <sys_sleep+0x94>
+  acquire(&tickslock);
+ffffffff8010844c:	48 c7 c7 00 70 11 80 	mov    $0xffffffff80117000,%rdi
+ffffffff80108453:	e8 77 e5 ff ff       	call   ffffffff801069cf <acquire>
+  ticks0 = ticks;
+ffffffff80108458:	8b 05 0a ec 00 00    	mov    0xec0a(%rip),%eax        # ffffffff80117068 <ticks>
+ffffffff8010845e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while(ticks - ticks0 < n){
+ffffffff80108461:	eb 38                	jmp    ffffffff8010849b <sys_sleep+0x73>
+    if(proc->killed){
+ffffffff80108463:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff8010846a:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010846e:	8b 40 40             	mov    0x40(%rax),%eax
+ffffffff80108471:	85 c0                	test   %eax,%eax
+ffffffff80108473:	74 13                	je     ffffffff80108488 <sys_sleep+0x60>
+      release(&tickslock);
+ffffffff80108475:	48 c7 c7 00 70 11 80 	mov    $0xffffffff80117000,%rdi
+ffffffff8010847c:	e8 25 e6 ff ff       	call   ffffffff80106aa6 <release>
+      return -1;
+ffffffff80108481:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80108486:	eb 34                	jmp    ffffffff801084bc <sys_sleep+0x94>
+    }
+    sleep(&ticks, &tickslock);
+ffffffff80108488:	48 c7 c6 00 70 11 80 	mov    $0xffffffff80117000,%rsi
+ffffffff8010848f:	48 c7 c7 68 70 11 80 	mov    $0xffffffff80117068,%rdi
+ffffffff80108496:	e8 b5 e1 ff ff       	call   ffffffff80106650 <sleep>
+  while(ticks - ticks0 < n){
+ffffffff8010849b:	8b 05 c7 eb 00 00    	mov    0xebc7(%rip),%eax        # ffffffff80117068 <ticks>
+ffffffff801084a1:	2b 45 fc             	sub    -0x4(%rbp),%eax
+ffffffff801084a4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+ffffffff801084a7:	39 d0                	cmp    %edx,%eax
+ffffffff801084a9:	72 b8                	jb     ffffffff80108463 <sys_sleep+0x3b>
+  }
+  release(&tickslock);
+ffffffff801084ab:	48 c7 c7 00 70 11 80 	mov    $0xffffffff80117000,%rdi
+ffffffff801084b2:	e8 ef e5 ff ff       	call   ffffffff80106aa6 <release>
+  return 0;
+ffffffff801084b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801084bc:	c9                   	leave
+ffffffff801084bd:	c3                   	ret
+
+ffffffff801084be <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+ffffffff801084be:	55                   	push   %rbp
+ffffffff801084bf:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801084c2:	48 83 ec 10          	sub    $0x10,%rsp
+  uint xticks;
+  
+  acquire(&tickslock);
+ffffffff801084c6:	48 c7 c7 00 70 11 80 	mov    $0xffffffff80117000,%rdi
+ffffffff801084cd:	e8 fd e4 ff ff       	call   ffffffff801069cf <acquire>
+  xticks = ticks;
+ffffffff801084d2:	8b 05 90 eb 00 00    	mov    0xeb90(%rip),%eax        # ffffffff80117068 <ticks>
+ffffffff801084d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  release(&tickslock);
+ffffffff801084db:	48 c7 c7 00 70 11 80 	mov    $0xffffffff80117000,%rdi
+ffffffff801084e2:	e8 bf e5 ff ff       	call   ffffffff80106aa6 <release>
+  return xticks;
+ffffffff801084e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+ffffffff801084ea:	c9                   	leave
+ffffffff801084eb:	c3                   	ret
+
+ffffffff801084ec <outb>:
+{
+ffffffff801084ec:	55                   	push   %rbp
+ffffffff801084ed:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801084f0:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff801084f4:	89 fa                	mov    %edi,%edx
+ffffffff801084f6:	89 f0                	mov    %esi,%eax
+ffffffff801084f8:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+ffffffff801084fc:	88 45 f8             	mov    %al,-0x8(%rbp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+ffffffff801084ff:	0f b6 45 f8          	movzbl -0x8(%rbp),%eax
+ffffffff80108503:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+ffffffff80108507:	ee                   	out    %al,(%dx)
+}
+ffffffff80108508:	90                   	nop
+ffffffff80108509:	c9                   	leave
+ffffffff8010850a:	c3                   	ret
+
+ffffffff8010850b <timerinit>:
+#define TIMER_RATEGEN   0x04    // mode 2, rate generator
+#define TIMER_16BIT     0x30    // r/w counter 16 bits, LSB first
+
+void
+timerinit(void)
+{
+ffffffff8010850b:	55                   	push   %rbp
+ffffffff8010850c:	48 89 e5             	mov    %rsp,%rbp
+  // Interrupt 100 times/sec.
+  outb(TIMER_MODE, TIMER_SEL0 | TIMER_RATEGEN | TIMER_16BIT);
+ffffffff8010850f:	be 34 00 00 00       	mov    $0x34,%esi
+ffffffff80108514:	bf 43 00 00 00       	mov    $0x43,%edi
+ffffffff80108519:	e8 ce ff ff ff       	call   ffffffff801084ec <outb>
+  outb(IO_TIMER1, TIMER_DIV(100) % 256);
+ffffffff8010851e:	be 9c 00 00 00       	mov    $0x9c,%esi
+ffffffff80108523:	bf 40 00 00 00       	mov    $0x40,%edi
+ffffffff80108528:	e8 bf ff ff ff       	call   ffffffff801084ec <outb>
+  outb(IO_TIMER1, TIMER_DIV(100) / 256);
+ffffffff8010852d:	be 2e 00 00 00       	mov    $0x2e,%esi
+ffffffff80108532:	bf 40 00 00 00       	mov    $0x40,%edi
+ffffffff80108537:	e8 b0 ff ff ff       	call   ffffffff801084ec <outb>
+  picenable(IRQ_TIMER);
+ffffffff8010853c:	bf 00 00 00 00       	mov    $0x0,%edi
+ffffffff80108541:	e8 d2 d0 ff ff       	call   ffffffff80105618 <picenable>
+}
+ffffffff80108546:	90                   	nop
+ffffffff80108547:	5d                   	pop    %rbp
+ffffffff80108548:	c3                   	ret
+
+ffffffff80108549 <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  push %r15
+ffffffff80108549:	41 57                	push   %r15
+  push %r14
+ffffffff8010854b:	41 56                	push   %r14
+  push %r13
+ffffffff8010854d:	41 55                	push   %r13
+  push %r12
+ffffffff8010854f:	41 54                	push   %r12
+  push %r11
+ffffffff80108551:	41 53                	push   %r11
+  push %r10
+ffffffff80108553:	41 52                	push   %r10
+  push %r9
+ffffffff80108555:	41 51                	push   %r9
+  push %r8
+ffffffff80108557:	41 50                	push   %r8
+  push %rdi
+ffffffff80108559:	57                   	push   %rdi
+  push %rsi
+ffffffff8010855a:	56                   	push   %rsi
+  push %rbp
+ffffffff8010855b:	55                   	push   %rbp
+  push %rdx
+ffffffff8010855c:	52                   	push   %rdx
+  push %rcx
+ffffffff8010855d:	51                   	push   %rcx
+  push %rbx
+ffffffff8010855e:	53                   	push   %rbx
+  push %rax
+ffffffff8010855f:	50                   	push   %rax
+
+  mov  %rsp, %rdi  # frame in arg1
+ffffffff80108560:	48 89 e7             	mov    %rsp,%rdi
+  call trap
+ffffffff80108563:	e8 32 00 00 00       	call   ffffffff8010859a <trap>
+
+ffffffff80108568 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  pop %rax
+ffffffff80108568:	58                   	pop    %rax
+  pop %rbx
+ffffffff80108569:	5b                   	pop    %rbx
+  pop %rcx
+ffffffff8010856a:	59                   	pop    %rcx
+  pop %rdx
+ffffffff8010856b:	5a                   	pop    %rdx
+  pop %rbp
+ffffffff8010856c:	5d                   	pop    %rbp
+  pop %rsi
+ffffffff8010856d:	5e                   	pop    %rsi
+  pop %rdi
+ffffffff8010856e:	5f                   	pop    %rdi
+  pop %r8
+ffffffff8010856f:	41 58                	pop    %r8
+  pop %r9
+ffffffff80108571:	41 59                	pop    %r9
+  pop %r10
+ffffffff80108573:	41 5a                	pop    %r10
+  pop %r11
+ffffffff80108575:	41 5b                	pop    %r11
+  pop %r12
+ffffffff80108577:	41 5c                	pop    %r12
+  pop %r13
+ffffffff80108579:	41 5d                	pop    %r13
+  pop %r14
+ffffffff8010857b:	41 5e                	pop    %r14
+  pop %r15
+ffffffff8010857d:	41 5f                	pop    %r15
+
+  # discard trapnum and errorcode
+  add $16, %rsp
+ffffffff8010857f:	48 83 c4 10          	add    $0x10,%rsp
+  iretq
+ffffffff80108583:	48 cf                	iretq
+
+ffffffff80108585 <rcr2>:
+
+static inline uintp
+rcr2(void)
+{
+ffffffff80108585:	55                   	push   %rbp
+ffffffff80108586:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80108589:	48 83 ec 10          	sub    $0x10,%rsp
+  uintp val;
+  asm volatile("mov %%cr2,%0" : "=r" (val));
+ffffffff8010858d:	0f 20 d0             	mov    %cr2,%rax
+ffffffff80108590:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  return val;
+ffffffff80108594:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+ffffffff80108598:	c9                   	leave
+ffffffff80108599:	c3                   	ret
+
+ffffffff8010859a <trap>:
+#endif
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+ffffffff8010859a:	55                   	push   %rbp
+ffffffff8010859b:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010859e:	48 83 ec 10          	sub    $0x10,%rsp
+ffffffff801085a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if(tf->trapno == T_SYSCALL){
+ffffffff801085a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801085aa:	48 8b 40 78          	mov    0x78(%rax),%rax
+ffffffff801085ae:	48 83 f8 40          	cmp    $0x40,%rax
+ffffffff801085b2:	75 4f                	jne    ffffffff80108603 <trap+0x69>
+    if(proc->killed)
+ffffffff801085b4:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801085bb:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801085bf:	8b 40 40             	mov    0x40(%rax),%eax
+ffffffff801085c2:	85 c0                	test   %eax,%eax
+ffffffff801085c4:	74 05                	je     ffffffff801085cb <trap+0x31>
+      exit();
+ffffffff801085c6:	e8 ba db ff ff       	call   ffffffff80106185 <exit>
+    proc->tf = tf;
+ffffffff801085cb:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801085d2:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801085d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff801085da:	48 89 50 28          	mov    %rdx,0x28(%rax)
+    syscall();
+ffffffff801085de:	e8 9e ed ff ff       	call   ffffffff80107381 <syscall>
+    if(proc->killed)
+ffffffff801085e3:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801085ea:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801085ee:	8b 40 40             	mov    0x40(%rax),%eax
+ffffffff801085f1:	85 c0                	test   %eax,%eax
+ffffffff801085f3:	0f 84 93 02 00 00    	je     ffffffff8010888c <trap+0x2f2>
+      exit();
+ffffffff801085f9:	e8 87 db ff ff       	call   ffffffff80106185 <exit>
+    return;
+ffffffff801085fe:	e9 89 02 00 00       	jmp    ffffffff8010888c <trap+0x2f2>
+  }
+
+  switch(tf->trapno){
+ffffffff80108603:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108607:	48 8b 40 78          	mov    0x78(%rax),%rax
+ffffffff8010860b:	48 83 e8 20          	sub    $0x20,%rax
+ffffffff8010860f:	48 83 f8 1f          	cmp    $0x1f,%rax
+ffffffff80108613:	0f 87 ca 00 00 00    	ja     ffffffff801086e3 <trap+0x149>
+ffffffff80108619:	48 8b 04 c5 18 ad 10 	mov    -0x7fef52e8(,%rax,8),%rax
+ffffffff80108620:	80 
+ffffffff80108621:	ff e0                	jmp    *%rax
+  case T_IRQ0 + IRQ_TIMER:
+    if(cpu->id == 0){
+ffffffff80108623:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff8010862a:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010862e:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80108631:	84 c0                	test   %al,%al
+ffffffff80108633:	75 33                	jne    ffffffff80108668 <trap+0xce>
+      acquire(&tickslock);
+ffffffff80108635:	48 c7 c7 00 70 11 80 	mov    $0xffffffff80117000,%rdi
+ffffffff8010863c:	e8 8e e3 ff ff       	call   ffffffff801069cf <acquire>
+      ticks++;
+ffffffff80108641:	8b 05 21 ea 00 00    	mov    0xea21(%rip),%eax        # ffffffff80117068 <ticks>
+ffffffff80108647:	83 c0 01             	add    $0x1,%eax
+ffffffff8010864a:	89 05 18 ea 00 00    	mov    %eax,0xea18(%rip)        # ffffffff80117068 <ticks>
+      wakeup(&ticks);
+ffffffff80108650:	48 c7 c7 68 70 11 80 	mov    $0xffffffff80117068,%rdi
+ffffffff80108657:	e8 08 e1 ff ff       	call   ffffffff80106764 <wakeup>
+      release(&tickslock);
+ffffffff8010865c:	48 c7 c7 00 70 11 80 	mov    $0xffffffff80117000,%rdi
+ffffffff80108663:	e8 3e e4 ff ff       	call   ffffffff80106aa6 <release>
+    }
+    lapiceoi();
+ffffffff80108668:	e8 38 bb ff ff       	call   ffffffff801041a5 <lapiceoi>
+    break;
+ffffffff8010866d:	e9 6c 01 00 00       	jmp    ffffffff801087de <trap+0x244>
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+ffffffff80108672:	e8 49 b2 ff ff       	call   ffffffff801038c0 <ideintr>
+    lapiceoi();
+ffffffff80108677:	e8 29 bb ff ff       	call   ffffffff801041a5 <lapiceoi>
+    break;
+ffffffff8010867c:	e9 5d 01 00 00       	jmp    ffffffff801087de <trap+0x244>
+  case T_IRQ0 + IRQ_KBD:
+    kbdintr();
+ffffffff80108681:	e8 b6 b8 ff ff       	call   ffffffff80103f3c <kbdintr>
+    lapiceoi();
+ffffffff80108686:	e8 1a bb ff ff       	call   ffffffff801041a5 <lapiceoi>
+    break;
+ffffffff8010868b:	e9 4e 01 00 00       	jmp    ffffffff801087de <trap+0x244>
+  case T_IRQ0 + IRQ_COM1:
+    uartintr();
+ffffffff80108690:	e8 cc 03 00 00       	call   ffffffff80108a61 <uartintr>
+    lapiceoi();
+ffffffff80108695:	e8 0b bb ff ff       	call   ffffffff801041a5 <lapiceoi>
+    break;
+ffffffff8010869a:	e9 3f 01 00 00       	jmp    ffffffff801087de <trap+0x244>
+  case T_IRQ0 + 7:
+  case T_IRQ0 + IRQ_SPURIOUS:
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+ffffffff8010869f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801086a3:	48 8b 88 88 00 00 00 	mov    0x88(%rax),%rcx
+ffffffff801086aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801086ae:	48 8b 90 90 00 00 00 	mov    0x90(%rax),%rdx
+            cpu->id, tf->cs, tf->eip);
+ffffffff801086b5:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff801086bc:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801086c0:	0f b6 00             	movzbl (%rax),%eax
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+ffffffff801086c3:	0f b6 c0             	movzbl %al,%eax
+ffffffff801086c6:	89 c6                	mov    %eax,%esi
+ffffffff801086c8:	48 c7 c7 70 ac 10 80 	mov    $0xffffffff8010ac70,%rdi
+ffffffff801086cf:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801086d4:	e8 cb 7e ff ff       	call   ffffffff801005a4 <cprintf>
+    lapiceoi();
+ffffffff801086d9:	e8 c7 ba ff ff       	call   ffffffff801041a5 <lapiceoi>
+    break;
+ffffffff801086de:	e9 fb 00 00 00       	jmp    ffffffff801087de <trap+0x244>
+   
+  //PAGEBREAK: 13
+  default:
+    if(proc == 0 || (tf->cs&3) == 0){
+ffffffff801086e3:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801086ea:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801086ee:	48 85 c0             	test   %rax,%rax
+ffffffff801086f1:	74 13                	je     ffffffff80108706 <trap+0x16c>
+ffffffff801086f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801086f7:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+ffffffff801086fe:	83 e0 03             	and    $0x3,%eax
+ffffffff80108701:	48 85 c0             	test   %rax,%rax
+ffffffff80108704:	75 4f                	jne    ffffffff80108755 <trap+0x1bb>
+      // In kernel, it must be our mistake.
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+ffffffff80108706:	e8 7a fe ff ff       	call   ffffffff80108585 <rcr2>
+ffffffff8010870b:	48 89 c6             	mov    %rax,%rsi
+ffffffff8010870e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108712:	48 8b 88 88 00 00 00 	mov    0x88(%rax),%rcx
+              tf->trapno, cpu->id, tf->eip, rcr2());
+ffffffff80108719:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff80108720:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80108724:	0f b6 00             	movzbl (%rax),%eax
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+ffffffff80108727:	0f b6 d0             	movzbl %al,%edx
+ffffffff8010872a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010872e:	48 8b 40 78          	mov    0x78(%rax),%rax
+ffffffff80108732:	49 89 f0             	mov    %rsi,%r8
+ffffffff80108735:	48 89 c6             	mov    %rax,%rsi
+ffffffff80108738:	48 c7 c7 98 ac 10 80 	mov    $0xffffffff8010ac98,%rdi
+ffffffff8010873f:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80108744:	e8 5b 7e ff ff       	call   ffffffff801005a4 <cprintf>
+      panic("trap");
+ffffffff80108749:	48 c7 c7 ca ac 10 80 	mov    $0xffffffff8010acca,%rdi
+ffffffff80108750:	e8 da 81 ff ff       	call   ffffffff8010092f <panic>
+    }
+    // In user space, assume process misbehaved.
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+ffffffff80108755:	e8 2b fe ff ff       	call   ffffffff80108585 <rcr2>
+ffffffff8010875a:	48 89 c1             	mov    %rax,%rcx
+ffffffff8010875d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108761:	48 8b b8 88 00 00 00 	mov    0x88(%rax),%rdi
+            "eip 0x%x addr 0x%x--kill proc\n",
+            proc->pid, proc->name, tf->trapno, tf->err, cpu->id, tf->eip, 
+ffffffff80108768:	48 c7 c0 f0 ff ff ff 	mov    $0xfffffffffffffff0,%rax
+ffffffff8010876f:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80108773:	0f b6 00             	movzbl (%rax),%eax
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+ffffffff80108776:	44 0f b6 c8          	movzbl %al,%r9d
+ffffffff8010877a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010877e:	4c 8b 80 80 00 00 00 	mov    0x80(%rax),%r8
+ffffffff80108785:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108789:	48 8b 50 78          	mov    0x78(%rax),%rdx
+            proc->pid, proc->name, tf->trapno, tf->err, cpu->id, tf->eip, 
+ffffffff8010878d:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80108794:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80108798:	48 8d b0 d0 00 00 00 	lea    0xd0(%rax),%rsi
+ffffffff8010879f:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801087a6:	64 48 8b 00          	mov    %fs:(%rax),%rax
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+ffffffff801087aa:	8b 40 1c             	mov    0x1c(%rax),%eax
+ffffffff801087ad:	51                   	push   %rcx
+ffffffff801087ae:	57                   	push   %rdi
+ffffffff801087af:	48 89 d1             	mov    %rdx,%rcx
+ffffffff801087b2:	48 89 f2             	mov    %rsi,%rdx
+ffffffff801087b5:	89 c6                	mov    %eax,%esi
+ffffffff801087b7:	48 c7 c7 d0 ac 10 80 	mov    $0xffffffff8010acd0,%rdi
+ffffffff801087be:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801087c3:	e8 dc 7d ff ff       	call   ffffffff801005a4 <cprintf>
+ffffffff801087c8:	48 83 c4 10          	add    $0x10,%rsp
+            rcr2());
+    proc->killed = 1;
+ffffffff801087cc:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801087d3:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801087d7:	c7 40 40 01 00 00 00 	movl   $0x1,0x40(%rax)
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running 
+  // until it gets to the regular system call return.)
+  if(proc && proc->killed && (tf->cs&3) == DPL_USER)
+ffffffff801087de:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801087e5:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801087e9:	48 85 c0             	test   %rax,%rax
+ffffffff801087ec:	74 2b                	je     ffffffff80108819 <trap+0x27f>
+ffffffff801087ee:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff801087f5:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff801087f9:	8b 40 40             	mov    0x40(%rax),%eax
+ffffffff801087fc:	85 c0                	test   %eax,%eax
+ffffffff801087fe:	74 19                	je     ffffffff80108819 <trap+0x27f>
+ffffffff80108800:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108804:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+ffffffff8010880b:	83 e0 03             	and    $0x3,%eax
+ffffffff8010880e:	48 83 f8 03          	cmp    $0x3,%rax
+ffffffff80108812:	75 05                	jne    ffffffff80108819 <trap+0x27f>
+    exit();
+ffffffff80108814:	e8 6c d9 ff ff       	call   ffffffff80106185 <exit>
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+ffffffff80108819:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80108820:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80108824:	48 85 c0             	test   %rax,%rax
+ffffffff80108827:	74 26                	je     ffffffff8010884f <trap+0x2b5>
+ffffffff80108829:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80108830:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff80108834:	8b 40 18             	mov    0x18(%rax),%eax
+ffffffff80108837:	83 f8 04             	cmp    $0x4,%eax
+ffffffff8010883a:	75 13                	jne    ffffffff8010884f <trap+0x2b5>
+ffffffff8010883c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108840:	48 8b 40 78          	mov    0x78(%rax),%rax
+ffffffff80108844:	48 83 f8 20          	cmp    $0x20,%rax
+ffffffff80108848:	75 05                	jne    ffffffff8010884f <trap+0x2b5>
+    yield();
+ffffffff8010884a:	e8 9f dd ff ff       	call   ffffffff801065ee <yield>
+
+  // Check if the process has been killed since we yielded
+  if(proc && proc->killed && (tf->cs&3) == DPL_USER)
+ffffffff8010884f:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80108856:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010885a:	48 85 c0             	test   %rax,%rax
+ffffffff8010885d:	74 2e                	je     ffffffff8010888d <trap+0x2f3>
+ffffffff8010885f:	48 c7 c0 f8 ff ff ff 	mov    $0xfffffffffffffff8,%rax
+ffffffff80108866:	64 48 8b 00          	mov    %fs:(%rax),%rax
+ffffffff8010886a:	8b 40 40             	mov    0x40(%rax),%eax
+ffffffff8010886d:	85 c0                	test   %eax,%eax
+ffffffff8010886f:	74 1c                	je     ffffffff8010888d <trap+0x2f3>
+ffffffff80108871:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108875:	48 8b 80 90 00 00 00 	mov    0x90(%rax),%rax
+ffffffff8010887c:	83 e0 03             	and    $0x3,%eax
+ffffffff8010887f:	48 83 f8 03          	cmp    $0x3,%rax
+ffffffff80108883:	75 08                	jne    ffffffff8010888d <trap+0x2f3>
+    exit();
+ffffffff80108885:	e8 fb d8 ff ff       	call   ffffffff80106185 <exit>
+ffffffff8010888a:	eb 01                	jmp    ffffffff8010888d <trap+0x2f3>
+    return;
+ffffffff8010888c:	90                   	nop
+}
+ffffffff8010888d:	c9                   	leave
+ffffffff8010888e:	c3                   	ret
+
+ffffffff8010888f <inb>:
+{
+ffffffff8010888f:	55                   	push   %rbp
+ffffffff80108890:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80108893:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff80108897:	89 f8                	mov    %edi,%eax
+ffffffff80108899:	66 89 45 ec          	mov    %ax,-0x14(%rbp)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+ffffffff8010889d:	0f b7 45 ec          	movzwl -0x14(%rbp),%eax
+ffffffff801088a1:	89 c2                	mov    %eax,%edx
+ffffffff801088a3:	ec                   	in     (%dx),%al
+ffffffff801088a4:	88 45 ff             	mov    %al,-0x1(%rbp)
+  return data;
+ffffffff801088a7:	0f b6 45 ff          	movzbl -0x1(%rbp),%eax
+}
+ffffffff801088ab:	c9                   	leave
+ffffffff801088ac:	c3                   	ret
+
+ffffffff801088ad <outb>:
+{
+ffffffff801088ad:	55                   	push   %rbp
+ffffffff801088ae:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801088b1:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff801088b5:	89 fa                	mov    %edi,%edx
+ffffffff801088b7:	89 f0                	mov    %esi,%eax
+ffffffff801088b9:	66 89 55 fc          	mov    %dx,-0x4(%rbp)
+ffffffff801088bd:	88 45 f8             	mov    %al,-0x8(%rbp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+ffffffff801088c0:	0f b6 45 f8          	movzbl -0x8(%rbp),%eax
+ffffffff801088c4:	0f b7 55 fc          	movzwl -0x4(%rbp),%edx
+ffffffff801088c8:	ee                   	out    %al,(%dx)
+}
+ffffffff801088c9:	90                   	nop
+ffffffff801088ca:	c9                   	leave
+ffffffff801088cb:	c3                   	ret
+
+ffffffff801088cc <uartearlyinit>:
+
+static int uart;    // is there a uart?
+
+void
+uartearlyinit(void)
+{
+ffffffff801088cc:	55                   	push   %rbp
+ffffffff801088cd:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801088d0:	48 83 ec 10          	sub    $0x10,%rsp
+  char *p;
+
+  // Turn off the FIFO
+  outb(COM1+2, 0);
+ffffffff801088d4:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801088d9:	bf fa 03 00 00       	mov    $0x3fa,%edi
+ffffffff801088de:	e8 ca ff ff ff       	call   ffffffff801088ad <outb>
+  
+  // 9600 baud, 8 data bits, 1 stop bit, parity off.
+  outb(COM1+3, 0x80);    // Unlock divisor
+ffffffff801088e3:	be 80 00 00 00       	mov    $0x80,%esi
+ffffffff801088e8:	bf fb 03 00 00       	mov    $0x3fb,%edi
+ffffffff801088ed:	e8 bb ff ff ff       	call   ffffffff801088ad <outb>
+  outb(COM1+0, 115200/9600);
+ffffffff801088f2:	be 0c 00 00 00       	mov    $0xc,%esi
+ffffffff801088f7:	bf f8 03 00 00       	mov    $0x3f8,%edi
+ffffffff801088fc:	e8 ac ff ff ff       	call   ffffffff801088ad <outb>
+  outb(COM1+1, 0);
+ffffffff80108901:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80108906:	bf f9 03 00 00       	mov    $0x3f9,%edi
+ffffffff8010890b:	e8 9d ff ff ff       	call   ffffffff801088ad <outb>
+  outb(COM1+3, 0x03);    // Lock divisor, 8 data bits.
+ffffffff80108910:	be 03 00 00 00       	mov    $0x3,%esi
+ffffffff80108915:	bf fb 03 00 00       	mov    $0x3fb,%edi
+ffffffff8010891a:	e8 8e ff ff ff       	call   ffffffff801088ad <outb>
+  outb(COM1+4, 0);
+ffffffff8010891f:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80108924:	bf fc 03 00 00       	mov    $0x3fc,%edi
+ffffffff80108929:	e8 7f ff ff ff       	call   ffffffff801088ad <outb>
+  outb(COM1+1, 0x01);    // Enable receive interrupts.
+ffffffff8010892e:	be 01 00 00 00       	mov    $0x1,%esi
+ffffffff80108933:	bf f9 03 00 00       	mov    $0x3f9,%edi
+ffffffff80108938:	e8 70 ff ff ff       	call   ffffffff801088ad <outb>
+
+  // If status is 0xFF, no serial port.
+  if(inb(COM1+5) == 0xFF)
+ffffffff8010893d:	bf fd 03 00 00       	mov    $0x3fd,%edi
+ffffffff80108942:	e8 48 ff ff ff       	call   ffffffff8010888f <inb>
+ffffffff80108947:	3c ff                	cmp    $0xff,%al
+ffffffff80108949:	74 37                	je     ffffffff80108982 <uartearlyinit+0xb6>
+    return;
+  uart = 1;
+ffffffff8010894b:	c7 05 17 e7 00 00 01 	movl   $0x1,0xe717(%rip)        # ffffffff8011706c <uart>
+ffffffff80108952:	00 00 00 
+
+  // Announce that we're here.
+  for(p="xv6...\n"; *p; p++)
+ffffffff80108955:	48 c7 45 f8 18 ae 10 	movq   $0xffffffff8010ae18,-0x8(%rbp)
+ffffffff8010895c:	80 
+ffffffff8010895d:	eb 16                	jmp    ffffffff80108975 <uartearlyinit+0xa9>
+    uartputc(*p);
+ffffffff8010895f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108963:	0f b6 00             	movzbl (%rax),%eax
+ffffffff80108966:	0f be c0             	movsbl %al,%eax
+ffffffff80108969:	89 c7                	mov    %eax,%edi
+ffffffff8010896b:	e8 55 00 00 00       	call   ffffffff801089c5 <uartputc>
+  for(p="xv6...\n"; *p; p++)
+ffffffff80108970:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+ffffffff80108975:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80108979:	0f b6 00             	movzbl (%rax),%eax
+ffffffff8010897c:	84 c0                	test   %al,%al
+ffffffff8010897e:	75 df                	jne    ffffffff8010895f <uartearlyinit+0x93>
+ffffffff80108980:	eb 01                	jmp    ffffffff80108983 <uartearlyinit+0xb7>
+    return;
+ffffffff80108982:	90                   	nop
+}
+ffffffff80108983:	c9                   	leave
+ffffffff80108984:	c3                   	ret
+
+ffffffff80108985 <uartinit>:
+
+void
+uartinit(void)
+{
+ffffffff80108985:	55                   	push   %rbp
+ffffffff80108986:	48 89 e5             	mov    %rsp,%rbp
+  if (!uart)
+ffffffff80108989:	8b 05 dd e6 00 00    	mov    0xe6dd(%rip),%eax        # ffffffff8011706c <uart>
+ffffffff8010898f:	85 c0                	test   %eax,%eax
+ffffffff80108991:	74 2f                	je     ffffffff801089c2 <uartinit+0x3d>
+    return;
+
+  // Acknowledge pre-existing interrupt conditions;
+  // enable interrupts.
+  inb(COM1+2);
+ffffffff80108993:	bf fa 03 00 00       	mov    $0x3fa,%edi
+ffffffff80108998:	e8 f2 fe ff ff       	call   ffffffff8010888f <inb>
+  inb(COM1+0);
+ffffffff8010899d:	bf f8 03 00 00       	mov    $0x3f8,%edi
+ffffffff801089a2:	e8 e8 fe ff ff       	call   ffffffff8010888f <inb>
+  picenable(IRQ_COM1);
+ffffffff801089a7:	bf 04 00 00 00       	mov    $0x4,%edi
+ffffffff801089ac:	e8 67 cc ff ff       	call   ffffffff80105618 <picenable>
+  ioapicenable(IRQ_COM1, 0);
+ffffffff801089b1:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801089b6:	bf 04 00 00 00       	mov    $0x4,%edi
+ffffffff801089bb:	e8 cd b1 ff ff       	call   ffffffff80103b8d <ioapicenable>
+ffffffff801089c0:	eb 01                	jmp    ffffffff801089c3 <uartinit+0x3e>
+    return;
+ffffffff801089c2:	90                   	nop
+}
+ffffffff801089c3:	5d                   	pop    %rbp
+ffffffff801089c4:	c3                   	ret
+
+ffffffff801089c5 <uartputc>:
+
+void
+uartputc(int c)
+{
+ffffffff801089c5:	55                   	push   %rbp
+ffffffff801089c6:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801089c9:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801089cd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+
+  if(!uart)
+ffffffff801089d0:	8b 05 96 e6 00 00    	mov    0xe696(%rip),%eax        # ffffffff8011706c <uart>
+ffffffff801089d6:	85 c0                	test   %eax,%eax
+ffffffff801089d8:	74 45                	je     ffffffff80108a1f <uartputc+0x5a>
+    return;
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+ffffffff801089da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff801089e1:	eb 0e                	jmp    ffffffff801089f1 <uartputc+0x2c>
+    microdelay(10);
+ffffffff801089e3:	bf 0a 00 00 00       	mov    $0xa,%edi
+ffffffff801089e8:	e8 da b7 ff ff       	call   ffffffff801041c7 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+ffffffff801089ed:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff801089f1:	83 7d fc 7f          	cmpl   $0x7f,-0x4(%rbp)
+ffffffff801089f5:	7f 14                	jg     ffffffff80108a0b <uartputc+0x46>
+ffffffff801089f7:	bf fd 03 00 00       	mov    $0x3fd,%edi
+ffffffff801089fc:	e8 8e fe ff ff       	call   ffffffff8010888f <inb>
+ffffffff80108a01:	0f b6 c0             	movzbl %al,%eax
+ffffffff80108a04:	83 e0 20             	and    $0x20,%eax
+ffffffff80108a07:	85 c0                	test   %eax,%eax
+ffffffff80108a09:	74 d8                	je     ffffffff801089e3 <uartputc+0x1e>
+  outb(COM1+0, c);
+ffffffff80108a0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80108a0e:	0f b6 c0             	movzbl %al,%eax
+ffffffff80108a11:	89 c6                	mov    %eax,%esi
+ffffffff80108a13:	bf f8 03 00 00       	mov    $0x3f8,%edi
+ffffffff80108a18:	e8 90 fe ff ff       	call   ffffffff801088ad <outb>
+ffffffff80108a1d:	eb 01                	jmp    ffffffff80108a20 <uartputc+0x5b>
+    return;
+ffffffff80108a1f:	90                   	nop
+}
+ffffffff80108a20:	c9                   	leave
+ffffffff80108a21:	c3                   	ret
+
+ffffffff80108a22 <uartgetc>:
+
+static int
+uartgetc(void)
+{
+ffffffff80108a22:	55                   	push   %rbp
+ffffffff80108a23:	48 89 e5             	mov    %rsp,%rbp
+  if(!uart)
+ffffffff80108a26:	8b 05 40 e6 00 00    	mov    0xe640(%rip),%eax        # ffffffff8011706c <uart>
+ffffffff80108a2c:	85 c0                	test   %eax,%eax
+ffffffff80108a2e:	75 07                	jne    ffffffff80108a37 <uartgetc+0x15>
+    return -1;
+ffffffff80108a30:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80108a35:	eb 28                	jmp    ffffffff80108a5f <uartgetc+0x3d>
+  if(!(inb(COM1+5) & 0x01))
+ffffffff80108a37:	bf fd 03 00 00       	mov    $0x3fd,%edi
+ffffffff80108a3c:	e8 4e fe ff ff       	call   ffffffff8010888f <inb>
+ffffffff80108a41:	0f b6 c0             	movzbl %al,%eax
+ffffffff80108a44:	83 e0 01             	and    $0x1,%eax
+ffffffff80108a47:	85 c0                	test   %eax,%eax
+ffffffff80108a49:	75 07                	jne    ffffffff80108a52 <uartgetc+0x30>
+    return -1;
+ffffffff80108a4b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80108a50:	eb 0d                	jmp    ffffffff80108a5f <uartgetc+0x3d>
+  return inb(COM1+0);
+ffffffff80108a52:	bf f8 03 00 00       	mov    $0x3f8,%edi
+ffffffff80108a57:	e8 33 fe ff ff       	call   ffffffff8010888f <inb>
+ffffffff80108a5c:	0f b6 c0             	movzbl %al,%eax
+}
+ffffffff80108a5f:	5d                   	pop    %rbp
+ffffffff80108a60:	c3                   	ret
+
+ffffffff80108a61 <uartintr>:
+
+void
+uartintr(void)
+{
+ffffffff80108a61:	55                   	push   %rbp
+ffffffff80108a62:	48 89 e5             	mov    %rsp,%rbp
+  consoleintr(uartgetc);
+ffffffff80108a65:	48 c7 c7 22 8a 10 80 	mov    $0xffffffff80108a22,%rdi
+ffffffff80108a6c:	e8 52 81 ff ff       	call   ffffffff80100bc3 <consoleintr>
+}
+ffffffff80108a71:	90                   	nop
+ffffffff80108a72:	5d                   	pop    %rbp
+ffffffff80108a73:	c3                   	ret
+
+ffffffff80108a74 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  push $0
+ffffffff80108a74:	6a 00                	push   $0x0
+  push $0
+ffffffff80108a76:	6a 00                	push   $0x0
+  jmp alltraps
+ffffffff80108a78:	e9 cc fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108a7d <vector1>:
+.globl vector1
+vector1:
+  push $0
+ffffffff80108a7d:	6a 00                	push   $0x0
+  push $1
+ffffffff80108a7f:	6a 01                	push   $0x1
+  jmp alltraps
+ffffffff80108a81:	e9 c3 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108a86 <vector2>:
+.globl vector2
+vector2:
+  push $0
+ffffffff80108a86:	6a 00                	push   $0x0
+  push $2
+ffffffff80108a88:	6a 02                	push   $0x2
+  jmp alltraps
+ffffffff80108a8a:	e9 ba fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108a8f <vector3>:
+.globl vector3
+vector3:
+  push $0
+ffffffff80108a8f:	6a 00                	push   $0x0
+  push $3
+ffffffff80108a91:	6a 03                	push   $0x3
+  jmp alltraps
+ffffffff80108a93:	e9 b1 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108a98 <vector4>:
+.globl vector4
+vector4:
+  push $0
+ffffffff80108a98:	6a 00                	push   $0x0
+  push $4
+ffffffff80108a9a:	6a 04                	push   $0x4
+  jmp alltraps
+ffffffff80108a9c:	e9 a8 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108aa1 <vector5>:
+.globl vector5
+vector5:
+  push $0
+ffffffff80108aa1:	6a 00                	push   $0x0
+  push $5
+ffffffff80108aa3:	6a 05                	push   $0x5
+  jmp alltraps
+ffffffff80108aa5:	e9 9f fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108aaa <vector6>:
+.globl vector6
+vector6:
+  push $0
+ffffffff80108aaa:	6a 00                	push   $0x0
+  push $6
+ffffffff80108aac:	6a 06                	push   $0x6
+  jmp alltraps
+ffffffff80108aae:	e9 96 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ab3 <vector7>:
+.globl vector7
+vector7:
+  push $0
+ffffffff80108ab3:	6a 00                	push   $0x0
+  push $7
+ffffffff80108ab5:	6a 07                	push   $0x7
+  jmp alltraps
+ffffffff80108ab7:	e9 8d fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108abc <vector8>:
+.globl vector8
+vector8:
+  push $8
+ffffffff80108abc:	6a 08                	push   $0x8
+  jmp alltraps
+ffffffff80108abe:	e9 86 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ac3 <vector9>:
+.globl vector9
+vector9:
+  push $0
+ffffffff80108ac3:	6a 00                	push   $0x0
+  push $9
+ffffffff80108ac5:	6a 09                	push   $0x9
+  jmp alltraps
+ffffffff80108ac7:	e9 7d fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108acc <vector10>:
+.globl vector10
+vector10:
+  push $10
+ffffffff80108acc:	6a 0a                	push   $0xa
+  jmp alltraps
+ffffffff80108ace:	e9 76 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ad3 <vector11>:
+.globl vector11
+vector11:
+  push $11
+ffffffff80108ad3:	6a 0b                	push   $0xb
+  jmp alltraps
+ffffffff80108ad5:	e9 6f fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ada <vector12>:
+.globl vector12
+vector12:
+  push $12
+ffffffff80108ada:	6a 0c                	push   $0xc
+  jmp alltraps
+ffffffff80108adc:	e9 68 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ae1 <vector13>:
+.globl vector13
+vector13:
+  push $13
+ffffffff80108ae1:	6a 0d                	push   $0xd
+  jmp alltraps
+ffffffff80108ae3:	e9 61 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ae8 <vector14>:
+.globl vector14
+vector14:
+  push $14
+ffffffff80108ae8:	6a 0e                	push   $0xe
+  jmp alltraps
+ffffffff80108aea:	e9 5a fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108aef <vector15>:
+.globl vector15
+vector15:
+  push $0
+ffffffff80108aef:	6a 00                	push   $0x0
+  push $15
+ffffffff80108af1:	6a 0f                	push   $0xf
+  jmp alltraps
+ffffffff80108af3:	e9 51 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108af8 <vector16>:
+.globl vector16
+vector16:
+  push $0
+ffffffff80108af8:	6a 00                	push   $0x0
+  push $16
+ffffffff80108afa:	6a 10                	push   $0x10
+  jmp alltraps
+ffffffff80108afc:	e9 48 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b01 <vector17>:
+.globl vector17
+vector17:
+  push $17
+ffffffff80108b01:	6a 11                	push   $0x11
+  jmp alltraps
+ffffffff80108b03:	e9 41 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b08 <vector18>:
+.globl vector18
+vector18:
+  push $0
+ffffffff80108b08:	6a 00                	push   $0x0
+  push $18
+ffffffff80108b0a:	6a 12                	push   $0x12
+  jmp alltraps
+ffffffff80108b0c:	e9 38 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b11 <vector19>:
+.globl vector19
+vector19:
+  push $0
+ffffffff80108b11:	6a 00                	push   $0x0
+  push $19
+ffffffff80108b13:	6a 13                	push   $0x13
+  jmp alltraps
+ffffffff80108b15:	e9 2f fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b1a <vector20>:
+.globl vector20
+vector20:
+  push $0
+ffffffff80108b1a:	6a 00                	push   $0x0
+  push $20
+ffffffff80108b1c:	6a 14                	push   $0x14
+  jmp alltraps
+ffffffff80108b1e:	e9 26 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b23 <vector21>:
+.globl vector21
+vector21:
+  push $0
+ffffffff80108b23:	6a 00                	push   $0x0
+  push $21
+ffffffff80108b25:	6a 15                	push   $0x15
+  jmp alltraps
+ffffffff80108b27:	e9 1d fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b2c <vector22>:
+.globl vector22
+vector22:
+  push $0
+ffffffff80108b2c:	6a 00                	push   $0x0
+  push $22
+ffffffff80108b2e:	6a 16                	push   $0x16
+  jmp alltraps
+ffffffff80108b30:	e9 14 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b35 <vector23>:
+.globl vector23
+vector23:
+  push $0
+ffffffff80108b35:	6a 00                	push   $0x0
+  push $23
+ffffffff80108b37:	6a 17                	push   $0x17
+  jmp alltraps
+ffffffff80108b39:	e9 0b fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b3e <vector24>:
+.globl vector24
+vector24:
+  push $0
+ffffffff80108b3e:	6a 00                	push   $0x0
+  push $24
+ffffffff80108b40:	6a 18                	push   $0x18
+  jmp alltraps
+ffffffff80108b42:	e9 02 fa ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b47 <vector25>:
+.globl vector25
+vector25:
+  push $0
+ffffffff80108b47:	6a 00                	push   $0x0
+  push $25
+ffffffff80108b49:	6a 19                	push   $0x19
+  jmp alltraps
+ffffffff80108b4b:	e9 f9 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b50 <vector26>:
+.globl vector26
+vector26:
+  push $0
+ffffffff80108b50:	6a 00                	push   $0x0
+  push $26
+ffffffff80108b52:	6a 1a                	push   $0x1a
+  jmp alltraps
+ffffffff80108b54:	e9 f0 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b59 <vector27>:
+.globl vector27
+vector27:
+  push $0
+ffffffff80108b59:	6a 00                	push   $0x0
+  push $27
+ffffffff80108b5b:	6a 1b                	push   $0x1b
+  jmp alltraps
+ffffffff80108b5d:	e9 e7 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b62 <vector28>:
+.globl vector28
+vector28:
+  push $0
+ffffffff80108b62:	6a 00                	push   $0x0
+  push $28
+ffffffff80108b64:	6a 1c                	push   $0x1c
+  jmp alltraps
+ffffffff80108b66:	e9 de f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b6b <vector29>:
+.globl vector29
+vector29:
+  push $0
+ffffffff80108b6b:	6a 00                	push   $0x0
+  push $29
+ffffffff80108b6d:	6a 1d                	push   $0x1d
+  jmp alltraps
+ffffffff80108b6f:	e9 d5 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b74 <vector30>:
+.globl vector30
+vector30:
+  push $0
+ffffffff80108b74:	6a 00                	push   $0x0
+  push $30
+ffffffff80108b76:	6a 1e                	push   $0x1e
+  jmp alltraps
+ffffffff80108b78:	e9 cc f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b7d <vector31>:
+.globl vector31
+vector31:
+  push $0
+ffffffff80108b7d:	6a 00                	push   $0x0
+  push $31
+ffffffff80108b7f:	6a 1f                	push   $0x1f
+  jmp alltraps
+ffffffff80108b81:	e9 c3 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b86 <vector32>:
+.globl vector32
+vector32:
+  push $0
+ffffffff80108b86:	6a 00                	push   $0x0
+  push $32
+ffffffff80108b88:	6a 20                	push   $0x20
+  jmp alltraps
+ffffffff80108b8a:	e9 ba f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b8f <vector33>:
+.globl vector33
+vector33:
+  push $0
+ffffffff80108b8f:	6a 00                	push   $0x0
+  push $33
+ffffffff80108b91:	6a 21                	push   $0x21
+  jmp alltraps
+ffffffff80108b93:	e9 b1 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108b98 <vector34>:
+.globl vector34
+vector34:
+  push $0
+ffffffff80108b98:	6a 00                	push   $0x0
+  push $34
+ffffffff80108b9a:	6a 22                	push   $0x22
+  jmp alltraps
+ffffffff80108b9c:	e9 a8 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ba1 <vector35>:
+.globl vector35
+vector35:
+  push $0
+ffffffff80108ba1:	6a 00                	push   $0x0
+  push $35
+ffffffff80108ba3:	6a 23                	push   $0x23
+  jmp alltraps
+ffffffff80108ba5:	e9 9f f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108baa <vector36>:
+.globl vector36
+vector36:
+  push $0
+ffffffff80108baa:	6a 00                	push   $0x0
+  push $36
+ffffffff80108bac:	6a 24                	push   $0x24
+  jmp alltraps
+ffffffff80108bae:	e9 96 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108bb3 <vector37>:
+.globl vector37
+vector37:
+  push $0
+ffffffff80108bb3:	6a 00                	push   $0x0
+  push $37
+ffffffff80108bb5:	6a 25                	push   $0x25
+  jmp alltraps
+ffffffff80108bb7:	e9 8d f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108bbc <vector38>:
+.globl vector38
+vector38:
+  push $0
+ffffffff80108bbc:	6a 00                	push   $0x0
+  push $38
+ffffffff80108bbe:	6a 26                	push   $0x26
+  jmp alltraps
+ffffffff80108bc0:	e9 84 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108bc5 <vector39>:
+.globl vector39
+vector39:
+  push $0
+ffffffff80108bc5:	6a 00                	push   $0x0
+  push $39
+ffffffff80108bc7:	6a 27                	push   $0x27
+  jmp alltraps
+ffffffff80108bc9:	e9 7b f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108bce <vector40>:
+.globl vector40
+vector40:
+  push $0
+ffffffff80108bce:	6a 00                	push   $0x0
+  push $40
+ffffffff80108bd0:	6a 28                	push   $0x28
+  jmp alltraps
+ffffffff80108bd2:	e9 72 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108bd7 <vector41>:
+.globl vector41
+vector41:
+  push $0
+ffffffff80108bd7:	6a 00                	push   $0x0
+  push $41
+ffffffff80108bd9:	6a 29                	push   $0x29
+  jmp alltraps
+ffffffff80108bdb:	e9 69 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108be0 <vector42>:
+.globl vector42
+vector42:
+  push $0
+ffffffff80108be0:	6a 00                	push   $0x0
+  push $42
+ffffffff80108be2:	6a 2a                	push   $0x2a
+  jmp alltraps
+ffffffff80108be4:	e9 60 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108be9 <vector43>:
+.globl vector43
+vector43:
+  push $0
+ffffffff80108be9:	6a 00                	push   $0x0
+  push $43
+ffffffff80108beb:	6a 2b                	push   $0x2b
+  jmp alltraps
+ffffffff80108bed:	e9 57 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108bf2 <vector44>:
+.globl vector44
+vector44:
+  push $0
+ffffffff80108bf2:	6a 00                	push   $0x0
+  push $44
+ffffffff80108bf4:	6a 2c                	push   $0x2c
+  jmp alltraps
+ffffffff80108bf6:	e9 4e f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108bfb <vector45>:
+.globl vector45
+vector45:
+  push $0
+ffffffff80108bfb:	6a 00                	push   $0x0
+  push $45
+ffffffff80108bfd:	6a 2d                	push   $0x2d
+  jmp alltraps
+ffffffff80108bff:	e9 45 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c04 <vector46>:
+.globl vector46
+vector46:
+  push $0
+ffffffff80108c04:	6a 00                	push   $0x0
+  push $46
+ffffffff80108c06:	6a 2e                	push   $0x2e
+  jmp alltraps
+ffffffff80108c08:	e9 3c f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c0d <vector47>:
+.globl vector47
+vector47:
+  push $0
+ffffffff80108c0d:	6a 00                	push   $0x0
+  push $47
+ffffffff80108c0f:	6a 2f                	push   $0x2f
+  jmp alltraps
+ffffffff80108c11:	e9 33 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c16 <vector48>:
+.globl vector48
+vector48:
+  push $0
+ffffffff80108c16:	6a 00                	push   $0x0
+  push $48
+ffffffff80108c18:	6a 30                	push   $0x30
+  jmp alltraps
+ffffffff80108c1a:	e9 2a f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c1f <vector49>:
+.globl vector49
+vector49:
+  push $0
+ffffffff80108c1f:	6a 00                	push   $0x0
+  push $49
+ffffffff80108c21:	6a 31                	push   $0x31
+  jmp alltraps
+ffffffff80108c23:	e9 21 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c28 <vector50>:
+.globl vector50
+vector50:
+  push $0
+ffffffff80108c28:	6a 00                	push   $0x0
+  push $50
+ffffffff80108c2a:	6a 32                	push   $0x32
+  jmp alltraps
+ffffffff80108c2c:	e9 18 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c31 <vector51>:
+.globl vector51
+vector51:
+  push $0
+ffffffff80108c31:	6a 00                	push   $0x0
+  push $51
+ffffffff80108c33:	6a 33                	push   $0x33
+  jmp alltraps
+ffffffff80108c35:	e9 0f f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c3a <vector52>:
+.globl vector52
+vector52:
+  push $0
+ffffffff80108c3a:	6a 00                	push   $0x0
+  push $52
+ffffffff80108c3c:	6a 34                	push   $0x34
+  jmp alltraps
+ffffffff80108c3e:	e9 06 f9 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c43 <vector53>:
+.globl vector53
+vector53:
+  push $0
+ffffffff80108c43:	6a 00                	push   $0x0
+  push $53
+ffffffff80108c45:	6a 35                	push   $0x35
+  jmp alltraps
+ffffffff80108c47:	e9 fd f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c4c <vector54>:
+.globl vector54
+vector54:
+  push $0
+ffffffff80108c4c:	6a 00                	push   $0x0
+  push $54
+ffffffff80108c4e:	6a 36                	push   $0x36
+  jmp alltraps
+ffffffff80108c50:	e9 f4 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c55 <vector55>:
+.globl vector55
+vector55:
+  push $0
+ffffffff80108c55:	6a 00                	push   $0x0
+  push $55
+ffffffff80108c57:	6a 37                	push   $0x37
+  jmp alltraps
+ffffffff80108c59:	e9 eb f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c5e <vector56>:
+.globl vector56
+vector56:
+  push $0
+ffffffff80108c5e:	6a 00                	push   $0x0
+  push $56
+ffffffff80108c60:	6a 38                	push   $0x38
+  jmp alltraps
+ffffffff80108c62:	e9 e2 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c67 <vector57>:
+.globl vector57
+vector57:
+  push $0
+ffffffff80108c67:	6a 00                	push   $0x0
+  push $57
+ffffffff80108c69:	6a 39                	push   $0x39
+  jmp alltraps
+ffffffff80108c6b:	e9 d9 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c70 <vector58>:
+.globl vector58
+vector58:
+  push $0
+ffffffff80108c70:	6a 00                	push   $0x0
+  push $58
+ffffffff80108c72:	6a 3a                	push   $0x3a
+  jmp alltraps
+ffffffff80108c74:	e9 d0 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c79 <vector59>:
+.globl vector59
+vector59:
+  push $0
+ffffffff80108c79:	6a 00                	push   $0x0
+  push $59
+ffffffff80108c7b:	6a 3b                	push   $0x3b
+  jmp alltraps
+ffffffff80108c7d:	e9 c7 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c82 <vector60>:
+.globl vector60
+vector60:
+  push $0
+ffffffff80108c82:	6a 00                	push   $0x0
+  push $60
+ffffffff80108c84:	6a 3c                	push   $0x3c
+  jmp alltraps
+ffffffff80108c86:	e9 be f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c8b <vector61>:
+.globl vector61
+vector61:
+  push $0
+ffffffff80108c8b:	6a 00                	push   $0x0
+  push $61
+ffffffff80108c8d:	6a 3d                	push   $0x3d
+  jmp alltraps
+ffffffff80108c8f:	e9 b5 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c94 <vector62>:
+.globl vector62
+vector62:
+  push $0
+ffffffff80108c94:	6a 00                	push   $0x0
+  push $62
+ffffffff80108c96:	6a 3e                	push   $0x3e
+  jmp alltraps
+ffffffff80108c98:	e9 ac f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108c9d <vector63>:
+.globl vector63
+vector63:
+  push $0
+ffffffff80108c9d:	6a 00                	push   $0x0
+  push $63
+ffffffff80108c9f:	6a 3f                	push   $0x3f
+  jmp alltraps
+ffffffff80108ca1:	e9 a3 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ca6 <vector64>:
+.globl vector64
+vector64:
+  push $0
+ffffffff80108ca6:	6a 00                	push   $0x0
+  push $64
+ffffffff80108ca8:	6a 40                	push   $0x40
+  jmp alltraps
+ffffffff80108caa:	e9 9a f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108caf <vector65>:
+.globl vector65
+vector65:
+  push $0
+ffffffff80108caf:	6a 00                	push   $0x0
+  push $65
+ffffffff80108cb1:	6a 41                	push   $0x41
+  jmp alltraps
+ffffffff80108cb3:	e9 91 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108cb8 <vector66>:
+.globl vector66
+vector66:
+  push $0
+ffffffff80108cb8:	6a 00                	push   $0x0
+  push $66
+ffffffff80108cba:	6a 42                	push   $0x42
+  jmp alltraps
+ffffffff80108cbc:	e9 88 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108cc1 <vector67>:
+.globl vector67
+vector67:
+  push $0
+ffffffff80108cc1:	6a 00                	push   $0x0
+  push $67
+ffffffff80108cc3:	6a 43                	push   $0x43
+  jmp alltraps
+ffffffff80108cc5:	e9 7f f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108cca <vector68>:
+.globl vector68
+vector68:
+  push $0
+ffffffff80108cca:	6a 00                	push   $0x0
+  push $68
+ffffffff80108ccc:	6a 44                	push   $0x44
+  jmp alltraps
+ffffffff80108cce:	e9 76 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108cd3 <vector69>:
+.globl vector69
+vector69:
+  push $0
+ffffffff80108cd3:	6a 00                	push   $0x0
+  push $69
+ffffffff80108cd5:	6a 45                	push   $0x45
+  jmp alltraps
+ffffffff80108cd7:	e9 6d f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108cdc <vector70>:
+.globl vector70
+vector70:
+  push $0
+ffffffff80108cdc:	6a 00                	push   $0x0
+  push $70
+ffffffff80108cde:	6a 46                	push   $0x46
+  jmp alltraps
+ffffffff80108ce0:	e9 64 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ce5 <vector71>:
+.globl vector71
+vector71:
+  push $0
+ffffffff80108ce5:	6a 00                	push   $0x0
+  push $71
+ffffffff80108ce7:	6a 47                	push   $0x47
+  jmp alltraps
+ffffffff80108ce9:	e9 5b f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108cee <vector72>:
+.globl vector72
+vector72:
+  push $0
+ffffffff80108cee:	6a 00                	push   $0x0
+  push $72
+ffffffff80108cf0:	6a 48                	push   $0x48
+  jmp alltraps
+ffffffff80108cf2:	e9 52 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108cf7 <vector73>:
+.globl vector73
+vector73:
+  push $0
+ffffffff80108cf7:	6a 00                	push   $0x0
+  push $73
+ffffffff80108cf9:	6a 49                	push   $0x49
+  jmp alltraps
+ffffffff80108cfb:	e9 49 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d00 <vector74>:
+.globl vector74
+vector74:
+  push $0
+ffffffff80108d00:	6a 00                	push   $0x0
+  push $74
+ffffffff80108d02:	6a 4a                	push   $0x4a
+  jmp alltraps
+ffffffff80108d04:	e9 40 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d09 <vector75>:
+.globl vector75
+vector75:
+  push $0
+ffffffff80108d09:	6a 00                	push   $0x0
+  push $75
+ffffffff80108d0b:	6a 4b                	push   $0x4b
+  jmp alltraps
+ffffffff80108d0d:	e9 37 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d12 <vector76>:
+.globl vector76
+vector76:
+  push $0
+ffffffff80108d12:	6a 00                	push   $0x0
+  push $76
+ffffffff80108d14:	6a 4c                	push   $0x4c
+  jmp alltraps
+ffffffff80108d16:	e9 2e f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d1b <vector77>:
+.globl vector77
+vector77:
+  push $0
+ffffffff80108d1b:	6a 00                	push   $0x0
+  push $77
+ffffffff80108d1d:	6a 4d                	push   $0x4d
+  jmp alltraps
+ffffffff80108d1f:	e9 25 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d24 <vector78>:
+.globl vector78
+vector78:
+  push $0
+ffffffff80108d24:	6a 00                	push   $0x0
+  push $78
+ffffffff80108d26:	6a 4e                	push   $0x4e
+  jmp alltraps
+ffffffff80108d28:	e9 1c f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d2d <vector79>:
+.globl vector79
+vector79:
+  push $0
+ffffffff80108d2d:	6a 00                	push   $0x0
+  push $79
+ffffffff80108d2f:	6a 4f                	push   $0x4f
+  jmp alltraps
+ffffffff80108d31:	e9 13 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d36 <vector80>:
+.globl vector80
+vector80:
+  push $0
+ffffffff80108d36:	6a 00                	push   $0x0
+  push $80
+ffffffff80108d38:	6a 50                	push   $0x50
+  jmp alltraps
+ffffffff80108d3a:	e9 0a f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d3f <vector81>:
+.globl vector81
+vector81:
+  push $0
+ffffffff80108d3f:	6a 00                	push   $0x0
+  push $81
+ffffffff80108d41:	6a 51                	push   $0x51
+  jmp alltraps
+ffffffff80108d43:	e9 01 f8 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d48 <vector82>:
+.globl vector82
+vector82:
+  push $0
+ffffffff80108d48:	6a 00                	push   $0x0
+  push $82
+ffffffff80108d4a:	6a 52                	push   $0x52
+  jmp alltraps
+ffffffff80108d4c:	e9 f8 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d51 <vector83>:
+.globl vector83
+vector83:
+  push $0
+ffffffff80108d51:	6a 00                	push   $0x0
+  push $83
+ffffffff80108d53:	6a 53                	push   $0x53
+  jmp alltraps
+ffffffff80108d55:	e9 ef f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d5a <vector84>:
+.globl vector84
+vector84:
+  push $0
+ffffffff80108d5a:	6a 00                	push   $0x0
+  push $84
+ffffffff80108d5c:	6a 54                	push   $0x54
+  jmp alltraps
+ffffffff80108d5e:	e9 e6 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d63 <vector85>:
+.globl vector85
+vector85:
+  push $0
+ffffffff80108d63:	6a 00                	push   $0x0
+  push $85
+ffffffff80108d65:	6a 55                	push   $0x55
+  jmp alltraps
+ffffffff80108d67:	e9 dd f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d6c <vector86>:
+.globl vector86
+vector86:
+  push $0
+ffffffff80108d6c:	6a 00                	push   $0x0
+  push $86
+ffffffff80108d6e:	6a 56                	push   $0x56
+  jmp alltraps
+ffffffff80108d70:	e9 d4 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d75 <vector87>:
+.globl vector87
+vector87:
+  push $0
+ffffffff80108d75:	6a 00                	push   $0x0
+  push $87
+ffffffff80108d77:	6a 57                	push   $0x57
+  jmp alltraps
+ffffffff80108d79:	e9 cb f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d7e <vector88>:
+.globl vector88
+vector88:
+  push $0
+ffffffff80108d7e:	6a 00                	push   $0x0
+  push $88
+ffffffff80108d80:	6a 58                	push   $0x58
+  jmp alltraps
+ffffffff80108d82:	e9 c2 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d87 <vector89>:
+.globl vector89
+vector89:
+  push $0
+ffffffff80108d87:	6a 00                	push   $0x0
+  push $89
+ffffffff80108d89:	6a 59                	push   $0x59
+  jmp alltraps
+ffffffff80108d8b:	e9 b9 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d90 <vector90>:
+.globl vector90
+vector90:
+  push $0
+ffffffff80108d90:	6a 00                	push   $0x0
+  push $90
+ffffffff80108d92:	6a 5a                	push   $0x5a
+  jmp alltraps
+ffffffff80108d94:	e9 b0 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108d99 <vector91>:
+.globl vector91
+vector91:
+  push $0
+ffffffff80108d99:	6a 00                	push   $0x0
+  push $91
+ffffffff80108d9b:	6a 5b                	push   $0x5b
+  jmp alltraps
+ffffffff80108d9d:	e9 a7 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108da2 <vector92>:
+.globl vector92
+vector92:
+  push $0
+ffffffff80108da2:	6a 00                	push   $0x0
+  push $92
+ffffffff80108da4:	6a 5c                	push   $0x5c
+  jmp alltraps
+ffffffff80108da6:	e9 9e f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108dab <vector93>:
+.globl vector93
+vector93:
+  push $0
+ffffffff80108dab:	6a 00                	push   $0x0
+  push $93
+ffffffff80108dad:	6a 5d                	push   $0x5d
+  jmp alltraps
+ffffffff80108daf:	e9 95 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108db4 <vector94>:
+.globl vector94
+vector94:
+  push $0
+ffffffff80108db4:	6a 00                	push   $0x0
+  push $94
+ffffffff80108db6:	6a 5e                	push   $0x5e
+  jmp alltraps
+ffffffff80108db8:	e9 8c f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108dbd <vector95>:
+.globl vector95
+vector95:
+  push $0
+ffffffff80108dbd:	6a 00                	push   $0x0
+  push $95
+ffffffff80108dbf:	6a 5f                	push   $0x5f
+  jmp alltraps
+ffffffff80108dc1:	e9 83 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108dc6 <vector96>:
+.globl vector96
+vector96:
+  push $0
+ffffffff80108dc6:	6a 00                	push   $0x0
+  push $96
+ffffffff80108dc8:	6a 60                	push   $0x60
+  jmp alltraps
+ffffffff80108dca:	e9 7a f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108dcf <vector97>:
+.globl vector97
+vector97:
+  push $0
+ffffffff80108dcf:	6a 00                	push   $0x0
+  push $97
+ffffffff80108dd1:	6a 61                	push   $0x61
+  jmp alltraps
+ffffffff80108dd3:	e9 71 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108dd8 <vector98>:
+.globl vector98
+vector98:
+  push $0
+ffffffff80108dd8:	6a 00                	push   $0x0
+  push $98
+ffffffff80108dda:	6a 62                	push   $0x62
+  jmp alltraps
+ffffffff80108ddc:	e9 68 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108de1 <vector99>:
+.globl vector99
+vector99:
+  push $0
+ffffffff80108de1:	6a 00                	push   $0x0
+  push $99
+ffffffff80108de3:	6a 63                	push   $0x63
+  jmp alltraps
+ffffffff80108de5:	e9 5f f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108dea <vector100>:
+.globl vector100
+vector100:
+  push $0
+ffffffff80108dea:	6a 00                	push   $0x0
+  push $100
+ffffffff80108dec:	6a 64                	push   $0x64
+  jmp alltraps
+ffffffff80108dee:	e9 56 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108df3 <vector101>:
+.globl vector101
+vector101:
+  push $0
+ffffffff80108df3:	6a 00                	push   $0x0
+  push $101
+ffffffff80108df5:	6a 65                	push   $0x65
+  jmp alltraps
+ffffffff80108df7:	e9 4d f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108dfc <vector102>:
+.globl vector102
+vector102:
+  push $0
+ffffffff80108dfc:	6a 00                	push   $0x0
+  push $102
+ffffffff80108dfe:	6a 66                	push   $0x66
+  jmp alltraps
+ffffffff80108e00:	e9 44 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e05 <vector103>:
+.globl vector103
+vector103:
+  push $0
+ffffffff80108e05:	6a 00                	push   $0x0
+  push $103
+ffffffff80108e07:	6a 67                	push   $0x67
+  jmp alltraps
+ffffffff80108e09:	e9 3b f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e0e <vector104>:
+.globl vector104
+vector104:
+  push $0
+ffffffff80108e0e:	6a 00                	push   $0x0
+  push $104
+ffffffff80108e10:	6a 68                	push   $0x68
+  jmp alltraps
+ffffffff80108e12:	e9 32 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e17 <vector105>:
+.globl vector105
+vector105:
+  push $0
+ffffffff80108e17:	6a 00                	push   $0x0
+  push $105
+ffffffff80108e19:	6a 69                	push   $0x69
+  jmp alltraps
+ffffffff80108e1b:	e9 29 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e20 <vector106>:
+.globl vector106
+vector106:
+  push $0
+ffffffff80108e20:	6a 00                	push   $0x0
+  push $106
+ffffffff80108e22:	6a 6a                	push   $0x6a
+  jmp alltraps
+ffffffff80108e24:	e9 20 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e29 <vector107>:
+.globl vector107
+vector107:
+  push $0
+ffffffff80108e29:	6a 00                	push   $0x0
+  push $107
+ffffffff80108e2b:	6a 6b                	push   $0x6b
+  jmp alltraps
+ffffffff80108e2d:	e9 17 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e32 <vector108>:
+.globl vector108
+vector108:
+  push $0
+ffffffff80108e32:	6a 00                	push   $0x0
+  push $108
+ffffffff80108e34:	6a 6c                	push   $0x6c
+  jmp alltraps
+ffffffff80108e36:	e9 0e f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e3b <vector109>:
+.globl vector109
+vector109:
+  push $0
+ffffffff80108e3b:	6a 00                	push   $0x0
+  push $109
+ffffffff80108e3d:	6a 6d                	push   $0x6d
+  jmp alltraps
+ffffffff80108e3f:	e9 05 f7 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e44 <vector110>:
+.globl vector110
+vector110:
+  push $0
+ffffffff80108e44:	6a 00                	push   $0x0
+  push $110
+ffffffff80108e46:	6a 6e                	push   $0x6e
+  jmp alltraps
+ffffffff80108e48:	e9 fc f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e4d <vector111>:
+.globl vector111
+vector111:
+  push $0
+ffffffff80108e4d:	6a 00                	push   $0x0
+  push $111
+ffffffff80108e4f:	6a 6f                	push   $0x6f
+  jmp alltraps
+ffffffff80108e51:	e9 f3 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e56 <vector112>:
+.globl vector112
+vector112:
+  push $0
+ffffffff80108e56:	6a 00                	push   $0x0
+  push $112
+ffffffff80108e58:	6a 70                	push   $0x70
+  jmp alltraps
+ffffffff80108e5a:	e9 ea f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e5f <vector113>:
+.globl vector113
+vector113:
+  push $0
+ffffffff80108e5f:	6a 00                	push   $0x0
+  push $113
+ffffffff80108e61:	6a 71                	push   $0x71
+  jmp alltraps
+ffffffff80108e63:	e9 e1 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e68 <vector114>:
+.globl vector114
+vector114:
+  push $0
+ffffffff80108e68:	6a 00                	push   $0x0
+  push $114
+ffffffff80108e6a:	6a 72                	push   $0x72
+  jmp alltraps
+ffffffff80108e6c:	e9 d8 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e71 <vector115>:
+.globl vector115
+vector115:
+  push $0
+ffffffff80108e71:	6a 00                	push   $0x0
+  push $115
+ffffffff80108e73:	6a 73                	push   $0x73
+  jmp alltraps
+ffffffff80108e75:	e9 cf f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e7a <vector116>:
+.globl vector116
+vector116:
+  push $0
+ffffffff80108e7a:	6a 00                	push   $0x0
+  push $116
+ffffffff80108e7c:	6a 74                	push   $0x74
+  jmp alltraps
+ffffffff80108e7e:	e9 c6 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e83 <vector117>:
+.globl vector117
+vector117:
+  push $0
+ffffffff80108e83:	6a 00                	push   $0x0
+  push $117
+ffffffff80108e85:	6a 75                	push   $0x75
+  jmp alltraps
+ffffffff80108e87:	e9 bd f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e8c <vector118>:
+.globl vector118
+vector118:
+  push $0
+ffffffff80108e8c:	6a 00                	push   $0x0
+  push $118
+ffffffff80108e8e:	6a 76                	push   $0x76
+  jmp alltraps
+ffffffff80108e90:	e9 b4 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e95 <vector119>:
+.globl vector119
+vector119:
+  push $0
+ffffffff80108e95:	6a 00                	push   $0x0
+  push $119
+ffffffff80108e97:	6a 77                	push   $0x77
+  jmp alltraps
+ffffffff80108e99:	e9 ab f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108e9e <vector120>:
+.globl vector120
+vector120:
+  push $0
+ffffffff80108e9e:	6a 00                	push   $0x0
+  push $120
+ffffffff80108ea0:	6a 78                	push   $0x78
+  jmp alltraps
+ffffffff80108ea2:	e9 a2 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ea7 <vector121>:
+.globl vector121
+vector121:
+  push $0
+ffffffff80108ea7:	6a 00                	push   $0x0
+  push $121
+ffffffff80108ea9:	6a 79                	push   $0x79
+  jmp alltraps
+ffffffff80108eab:	e9 99 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108eb0 <vector122>:
+.globl vector122
+vector122:
+  push $0
+ffffffff80108eb0:	6a 00                	push   $0x0
+  push $122
+ffffffff80108eb2:	6a 7a                	push   $0x7a
+  jmp alltraps
+ffffffff80108eb4:	e9 90 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108eb9 <vector123>:
+.globl vector123
+vector123:
+  push $0
+ffffffff80108eb9:	6a 00                	push   $0x0
+  push $123
+ffffffff80108ebb:	6a 7b                	push   $0x7b
+  jmp alltraps
+ffffffff80108ebd:	e9 87 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ec2 <vector124>:
+.globl vector124
+vector124:
+  push $0
+ffffffff80108ec2:	6a 00                	push   $0x0
+  push $124
+ffffffff80108ec4:	6a 7c                	push   $0x7c
+  jmp alltraps
+ffffffff80108ec6:	e9 7e f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ecb <vector125>:
+.globl vector125
+vector125:
+  push $0
+ffffffff80108ecb:	6a 00                	push   $0x0
+  push $125
+ffffffff80108ecd:	6a 7d                	push   $0x7d
+  jmp alltraps
+ffffffff80108ecf:	e9 75 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ed4 <vector126>:
+.globl vector126
+vector126:
+  push $0
+ffffffff80108ed4:	6a 00                	push   $0x0
+  push $126
+ffffffff80108ed6:	6a 7e                	push   $0x7e
+  jmp alltraps
+ffffffff80108ed8:	e9 6c f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108edd <vector127>:
+.globl vector127
+vector127:
+  push $0
+ffffffff80108edd:	6a 00                	push   $0x0
+  push $127
+ffffffff80108edf:	6a 7f                	push   $0x7f
+  jmp alltraps
+ffffffff80108ee1:	e9 63 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ee6 <vector128>:
+.globl vector128
+vector128:
+  push $0
+ffffffff80108ee6:	6a 00                	push   $0x0
+  push $128
+ffffffff80108ee8:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+ffffffff80108eed:	e9 57 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ef2 <vector129>:
+.globl vector129
+vector129:
+  push $0
+ffffffff80108ef2:	6a 00                	push   $0x0
+  push $129
+ffffffff80108ef4:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+ffffffff80108ef9:	e9 4b f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108efe <vector130>:
+.globl vector130
+vector130:
+  push $0
+ffffffff80108efe:	6a 00                	push   $0x0
+  push $130
+ffffffff80108f00:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+ffffffff80108f05:	e9 3f f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f0a <vector131>:
+.globl vector131
+vector131:
+  push $0
+ffffffff80108f0a:	6a 00                	push   $0x0
+  push $131
+ffffffff80108f0c:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+ffffffff80108f11:	e9 33 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f16 <vector132>:
+.globl vector132
+vector132:
+  push $0
+ffffffff80108f16:	6a 00                	push   $0x0
+  push $132
+ffffffff80108f18:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+ffffffff80108f1d:	e9 27 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f22 <vector133>:
+.globl vector133
+vector133:
+  push $0
+ffffffff80108f22:	6a 00                	push   $0x0
+  push $133
+ffffffff80108f24:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+ffffffff80108f29:	e9 1b f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f2e <vector134>:
+.globl vector134
+vector134:
+  push $0
+ffffffff80108f2e:	6a 00                	push   $0x0
+  push $134
+ffffffff80108f30:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+ffffffff80108f35:	e9 0f f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f3a <vector135>:
+.globl vector135
+vector135:
+  push $0
+ffffffff80108f3a:	6a 00                	push   $0x0
+  push $135
+ffffffff80108f3c:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+ffffffff80108f41:	e9 03 f6 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f46 <vector136>:
+.globl vector136
+vector136:
+  push $0
+ffffffff80108f46:	6a 00                	push   $0x0
+  push $136
+ffffffff80108f48:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+ffffffff80108f4d:	e9 f7 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f52 <vector137>:
+.globl vector137
+vector137:
+  push $0
+ffffffff80108f52:	6a 00                	push   $0x0
+  push $137
+ffffffff80108f54:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+ffffffff80108f59:	e9 eb f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f5e <vector138>:
+.globl vector138
+vector138:
+  push $0
+ffffffff80108f5e:	6a 00                	push   $0x0
+  push $138
+ffffffff80108f60:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+ffffffff80108f65:	e9 df f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f6a <vector139>:
+.globl vector139
+vector139:
+  push $0
+ffffffff80108f6a:	6a 00                	push   $0x0
+  push $139
+ffffffff80108f6c:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+ffffffff80108f71:	e9 d3 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f76 <vector140>:
+.globl vector140
+vector140:
+  push $0
+ffffffff80108f76:	6a 00                	push   $0x0
+  push $140
+ffffffff80108f78:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+ffffffff80108f7d:	e9 c7 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f82 <vector141>:
+.globl vector141
+vector141:
+  push $0
+ffffffff80108f82:	6a 00                	push   $0x0
+  push $141
+ffffffff80108f84:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+ffffffff80108f89:	e9 bb f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f8e <vector142>:
+.globl vector142
+vector142:
+  push $0
+ffffffff80108f8e:	6a 00                	push   $0x0
+  push $142
+ffffffff80108f90:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+ffffffff80108f95:	e9 af f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108f9a <vector143>:
+.globl vector143
+vector143:
+  push $0
+ffffffff80108f9a:	6a 00                	push   $0x0
+  push $143
+ffffffff80108f9c:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+ffffffff80108fa1:	e9 a3 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108fa6 <vector144>:
+.globl vector144
+vector144:
+  push $0
+ffffffff80108fa6:	6a 00                	push   $0x0
+  push $144
+ffffffff80108fa8:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+ffffffff80108fad:	e9 97 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108fb2 <vector145>:
+.globl vector145
+vector145:
+  push $0
+ffffffff80108fb2:	6a 00                	push   $0x0
+  push $145
+ffffffff80108fb4:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+ffffffff80108fb9:	e9 8b f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108fbe <vector146>:
+.globl vector146
+vector146:
+  push $0
+ffffffff80108fbe:	6a 00                	push   $0x0
+  push $146
+ffffffff80108fc0:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+ffffffff80108fc5:	e9 7f f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108fca <vector147>:
+.globl vector147
+vector147:
+  push $0
+ffffffff80108fca:	6a 00                	push   $0x0
+  push $147
+ffffffff80108fcc:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+ffffffff80108fd1:	e9 73 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108fd6 <vector148>:
+.globl vector148
+vector148:
+  push $0
+ffffffff80108fd6:	6a 00                	push   $0x0
+  push $148
+ffffffff80108fd8:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+ffffffff80108fdd:	e9 67 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108fe2 <vector149>:
+.globl vector149
+vector149:
+  push $0
+ffffffff80108fe2:	6a 00                	push   $0x0
+  push $149
+ffffffff80108fe4:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+ffffffff80108fe9:	e9 5b f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108fee <vector150>:
+.globl vector150
+vector150:
+  push $0
+ffffffff80108fee:	6a 00                	push   $0x0
+  push $150
+ffffffff80108ff0:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+ffffffff80108ff5:	e9 4f f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80108ffa <vector151>:
+.globl vector151
+vector151:
+  push $0
+ffffffff80108ffa:	6a 00                	push   $0x0
+  push $151
+ffffffff80108ffc:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+ffffffff80109001:	e9 43 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109006 <vector152>:
+.globl vector152
+vector152:
+  push $0
+ffffffff80109006:	6a 00                	push   $0x0
+  push $152
+ffffffff80109008:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+ffffffff8010900d:	e9 37 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109012 <vector153>:
+.globl vector153
+vector153:
+  push $0
+ffffffff80109012:	6a 00                	push   $0x0
+  push $153
+ffffffff80109014:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+ffffffff80109019:	e9 2b f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010901e <vector154>:
+.globl vector154
+vector154:
+  push $0
+ffffffff8010901e:	6a 00                	push   $0x0
+  push $154
+ffffffff80109020:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+ffffffff80109025:	e9 1f f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010902a <vector155>:
+.globl vector155
+vector155:
+  push $0
+ffffffff8010902a:	6a 00                	push   $0x0
+  push $155
+ffffffff8010902c:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+ffffffff80109031:	e9 13 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109036 <vector156>:
+.globl vector156
+vector156:
+  push $0
+ffffffff80109036:	6a 00                	push   $0x0
+  push $156
+ffffffff80109038:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+ffffffff8010903d:	e9 07 f5 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109042 <vector157>:
+.globl vector157
+vector157:
+  push $0
+ffffffff80109042:	6a 00                	push   $0x0
+  push $157
+ffffffff80109044:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+ffffffff80109049:	e9 fb f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010904e <vector158>:
+.globl vector158
+vector158:
+  push $0
+ffffffff8010904e:	6a 00                	push   $0x0
+  push $158
+ffffffff80109050:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+ffffffff80109055:	e9 ef f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010905a <vector159>:
+.globl vector159
+vector159:
+  push $0
+ffffffff8010905a:	6a 00                	push   $0x0
+  push $159
+ffffffff8010905c:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+ffffffff80109061:	e9 e3 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109066 <vector160>:
+.globl vector160
+vector160:
+  push $0
+ffffffff80109066:	6a 00                	push   $0x0
+  push $160
+ffffffff80109068:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+ffffffff8010906d:	e9 d7 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109072 <vector161>:
+.globl vector161
+vector161:
+  push $0
+ffffffff80109072:	6a 00                	push   $0x0
+  push $161
+ffffffff80109074:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+ffffffff80109079:	e9 cb f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010907e <vector162>:
+.globl vector162
+vector162:
+  push $0
+ffffffff8010907e:	6a 00                	push   $0x0
+  push $162
+ffffffff80109080:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+ffffffff80109085:	e9 bf f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010908a <vector163>:
+.globl vector163
+vector163:
+  push $0
+ffffffff8010908a:	6a 00                	push   $0x0
+  push $163
+ffffffff8010908c:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+ffffffff80109091:	e9 b3 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109096 <vector164>:
+.globl vector164
+vector164:
+  push $0
+ffffffff80109096:	6a 00                	push   $0x0
+  push $164
+ffffffff80109098:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+ffffffff8010909d:	e9 a7 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801090a2 <vector165>:
+.globl vector165
+vector165:
+  push $0
+ffffffff801090a2:	6a 00                	push   $0x0
+  push $165
+ffffffff801090a4:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+ffffffff801090a9:	e9 9b f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801090ae <vector166>:
+.globl vector166
+vector166:
+  push $0
+ffffffff801090ae:	6a 00                	push   $0x0
+  push $166
+ffffffff801090b0:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+ffffffff801090b5:	e9 8f f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801090ba <vector167>:
+.globl vector167
+vector167:
+  push $0
+ffffffff801090ba:	6a 00                	push   $0x0
+  push $167
+ffffffff801090bc:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+ffffffff801090c1:	e9 83 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801090c6 <vector168>:
+.globl vector168
+vector168:
+  push $0
+ffffffff801090c6:	6a 00                	push   $0x0
+  push $168
+ffffffff801090c8:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+ffffffff801090cd:	e9 77 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801090d2 <vector169>:
+.globl vector169
+vector169:
+  push $0
+ffffffff801090d2:	6a 00                	push   $0x0
+  push $169
+ffffffff801090d4:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+ffffffff801090d9:	e9 6b f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801090de <vector170>:
+.globl vector170
+vector170:
+  push $0
+ffffffff801090de:	6a 00                	push   $0x0
+  push $170
+ffffffff801090e0:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+ffffffff801090e5:	e9 5f f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801090ea <vector171>:
+.globl vector171
+vector171:
+  push $0
+ffffffff801090ea:	6a 00                	push   $0x0
+  push $171
+ffffffff801090ec:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+ffffffff801090f1:	e9 53 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801090f6 <vector172>:
+.globl vector172
+vector172:
+  push $0
+ffffffff801090f6:	6a 00                	push   $0x0
+  push $172
+ffffffff801090f8:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+ffffffff801090fd:	e9 47 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109102 <vector173>:
+.globl vector173
+vector173:
+  push $0
+ffffffff80109102:	6a 00                	push   $0x0
+  push $173
+ffffffff80109104:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+ffffffff80109109:	e9 3b f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010910e <vector174>:
+.globl vector174
+vector174:
+  push $0
+ffffffff8010910e:	6a 00                	push   $0x0
+  push $174
+ffffffff80109110:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+ffffffff80109115:	e9 2f f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010911a <vector175>:
+.globl vector175
+vector175:
+  push $0
+ffffffff8010911a:	6a 00                	push   $0x0
+  push $175
+ffffffff8010911c:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+ffffffff80109121:	e9 23 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109126 <vector176>:
+.globl vector176
+vector176:
+  push $0
+ffffffff80109126:	6a 00                	push   $0x0
+  push $176
+ffffffff80109128:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+ffffffff8010912d:	e9 17 f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109132 <vector177>:
+.globl vector177
+vector177:
+  push $0
+ffffffff80109132:	6a 00                	push   $0x0
+  push $177
+ffffffff80109134:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+ffffffff80109139:	e9 0b f4 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010913e <vector178>:
+.globl vector178
+vector178:
+  push $0
+ffffffff8010913e:	6a 00                	push   $0x0
+  push $178
+ffffffff80109140:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+ffffffff80109145:	e9 ff f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010914a <vector179>:
+.globl vector179
+vector179:
+  push $0
+ffffffff8010914a:	6a 00                	push   $0x0
+  push $179
+ffffffff8010914c:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+ffffffff80109151:	e9 f3 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109156 <vector180>:
+.globl vector180
+vector180:
+  push $0
+ffffffff80109156:	6a 00                	push   $0x0
+  push $180
+ffffffff80109158:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+ffffffff8010915d:	e9 e7 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109162 <vector181>:
+.globl vector181
+vector181:
+  push $0
+ffffffff80109162:	6a 00                	push   $0x0
+  push $181
+ffffffff80109164:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+ffffffff80109169:	e9 db f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010916e <vector182>:
+.globl vector182
+vector182:
+  push $0
+ffffffff8010916e:	6a 00                	push   $0x0
+  push $182
+ffffffff80109170:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+ffffffff80109175:	e9 cf f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010917a <vector183>:
+.globl vector183
+vector183:
+  push $0
+ffffffff8010917a:	6a 00                	push   $0x0
+  push $183
+ffffffff8010917c:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+ffffffff80109181:	e9 c3 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109186 <vector184>:
+.globl vector184
+vector184:
+  push $0
+ffffffff80109186:	6a 00                	push   $0x0
+  push $184
+ffffffff80109188:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+ffffffff8010918d:	e9 b7 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109192 <vector185>:
+.globl vector185
+vector185:
+  push $0
+ffffffff80109192:	6a 00                	push   $0x0
+  push $185
+ffffffff80109194:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+ffffffff80109199:	e9 ab f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010919e <vector186>:
+.globl vector186
+vector186:
+  push $0
+ffffffff8010919e:	6a 00                	push   $0x0
+  push $186
+ffffffff801091a0:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+ffffffff801091a5:	e9 9f f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801091aa <vector187>:
+.globl vector187
+vector187:
+  push $0
+ffffffff801091aa:	6a 00                	push   $0x0
+  push $187
+ffffffff801091ac:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+ffffffff801091b1:	e9 93 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801091b6 <vector188>:
+.globl vector188
+vector188:
+  push $0
+ffffffff801091b6:	6a 00                	push   $0x0
+  push $188
+ffffffff801091b8:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+ffffffff801091bd:	e9 87 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801091c2 <vector189>:
+.globl vector189
+vector189:
+  push $0
+ffffffff801091c2:	6a 00                	push   $0x0
+  push $189
+ffffffff801091c4:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+ffffffff801091c9:	e9 7b f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801091ce <vector190>:
+.globl vector190
+vector190:
+  push $0
+ffffffff801091ce:	6a 00                	push   $0x0
+  push $190
+ffffffff801091d0:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+ffffffff801091d5:	e9 6f f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801091da <vector191>:
+.globl vector191
+vector191:
+  push $0
+ffffffff801091da:	6a 00                	push   $0x0
+  push $191
+ffffffff801091dc:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+ffffffff801091e1:	e9 63 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801091e6 <vector192>:
+.globl vector192
+vector192:
+  push $0
+ffffffff801091e6:	6a 00                	push   $0x0
+  push $192
+ffffffff801091e8:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+ffffffff801091ed:	e9 57 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801091f2 <vector193>:
+.globl vector193
+vector193:
+  push $0
+ffffffff801091f2:	6a 00                	push   $0x0
+  push $193
+ffffffff801091f4:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+ffffffff801091f9:	e9 4b f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801091fe <vector194>:
+.globl vector194
+vector194:
+  push $0
+ffffffff801091fe:	6a 00                	push   $0x0
+  push $194
+ffffffff80109200:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+ffffffff80109205:	e9 3f f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010920a <vector195>:
+.globl vector195
+vector195:
+  push $0
+ffffffff8010920a:	6a 00                	push   $0x0
+  push $195
+ffffffff8010920c:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+ffffffff80109211:	e9 33 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109216 <vector196>:
+.globl vector196
+vector196:
+  push $0
+ffffffff80109216:	6a 00                	push   $0x0
+  push $196
+ffffffff80109218:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+ffffffff8010921d:	e9 27 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109222 <vector197>:
+.globl vector197
+vector197:
+  push $0
+ffffffff80109222:	6a 00                	push   $0x0
+  push $197
+ffffffff80109224:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+ffffffff80109229:	e9 1b f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010922e <vector198>:
+.globl vector198
+vector198:
+  push $0
+ffffffff8010922e:	6a 00                	push   $0x0
+  push $198
+ffffffff80109230:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+ffffffff80109235:	e9 0f f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010923a <vector199>:
+.globl vector199
+vector199:
+  push $0
+ffffffff8010923a:	6a 00                	push   $0x0
+  push $199
+ffffffff8010923c:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+ffffffff80109241:	e9 03 f3 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109246 <vector200>:
+.globl vector200
+vector200:
+  push $0
+ffffffff80109246:	6a 00                	push   $0x0
+  push $200
+ffffffff80109248:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+ffffffff8010924d:	e9 f7 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109252 <vector201>:
+.globl vector201
+vector201:
+  push $0
+ffffffff80109252:	6a 00                	push   $0x0
+  push $201
+ffffffff80109254:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+ffffffff80109259:	e9 eb f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010925e <vector202>:
+.globl vector202
+vector202:
+  push $0
+ffffffff8010925e:	6a 00                	push   $0x0
+  push $202
+ffffffff80109260:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+ffffffff80109265:	e9 df f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010926a <vector203>:
+.globl vector203
+vector203:
+  push $0
+ffffffff8010926a:	6a 00                	push   $0x0
+  push $203
+ffffffff8010926c:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+ffffffff80109271:	e9 d3 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109276 <vector204>:
+.globl vector204
+vector204:
+  push $0
+ffffffff80109276:	6a 00                	push   $0x0
+  push $204
+ffffffff80109278:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+ffffffff8010927d:	e9 c7 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109282 <vector205>:
+.globl vector205
+vector205:
+  push $0
+ffffffff80109282:	6a 00                	push   $0x0
+  push $205
+ffffffff80109284:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+ffffffff80109289:	e9 bb f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010928e <vector206>:
+.globl vector206
+vector206:
+  push $0
+ffffffff8010928e:	6a 00                	push   $0x0
+  push $206
+ffffffff80109290:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+ffffffff80109295:	e9 af f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010929a <vector207>:
+.globl vector207
+vector207:
+  push $0
+ffffffff8010929a:	6a 00                	push   $0x0
+  push $207
+ffffffff8010929c:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+ffffffff801092a1:	e9 a3 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801092a6 <vector208>:
+.globl vector208
+vector208:
+  push $0
+ffffffff801092a6:	6a 00                	push   $0x0
+  push $208
+ffffffff801092a8:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+ffffffff801092ad:	e9 97 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801092b2 <vector209>:
+.globl vector209
+vector209:
+  push $0
+ffffffff801092b2:	6a 00                	push   $0x0
+  push $209
+ffffffff801092b4:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+ffffffff801092b9:	e9 8b f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801092be <vector210>:
+.globl vector210
+vector210:
+  push $0
+ffffffff801092be:	6a 00                	push   $0x0
+  push $210
+ffffffff801092c0:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+ffffffff801092c5:	e9 7f f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801092ca <vector211>:
+.globl vector211
+vector211:
+  push $0
+ffffffff801092ca:	6a 00                	push   $0x0
+  push $211
+ffffffff801092cc:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+ffffffff801092d1:	e9 73 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801092d6 <vector212>:
+.globl vector212
+vector212:
+  push $0
+ffffffff801092d6:	6a 00                	push   $0x0
+  push $212
+ffffffff801092d8:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+ffffffff801092dd:	e9 67 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801092e2 <vector213>:
+.globl vector213
+vector213:
+  push $0
+ffffffff801092e2:	6a 00                	push   $0x0
+  push $213
+ffffffff801092e4:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+ffffffff801092e9:	e9 5b f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801092ee <vector214>:
+.globl vector214
+vector214:
+  push $0
+ffffffff801092ee:	6a 00                	push   $0x0
+  push $214
+ffffffff801092f0:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+ffffffff801092f5:	e9 4f f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801092fa <vector215>:
+.globl vector215
+vector215:
+  push $0
+ffffffff801092fa:	6a 00                	push   $0x0
+  push $215
+ffffffff801092fc:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+ffffffff80109301:	e9 43 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109306 <vector216>:
+.globl vector216
+vector216:
+  push $0
+ffffffff80109306:	6a 00                	push   $0x0
+  push $216
+ffffffff80109308:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+ffffffff8010930d:	e9 37 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109312 <vector217>:
+.globl vector217
+vector217:
+  push $0
+ffffffff80109312:	6a 00                	push   $0x0
+  push $217
+ffffffff80109314:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+ffffffff80109319:	e9 2b f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010931e <vector218>:
+.globl vector218
+vector218:
+  push $0
+ffffffff8010931e:	6a 00                	push   $0x0
+  push $218
+ffffffff80109320:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+ffffffff80109325:	e9 1f f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010932a <vector219>:
+.globl vector219
+vector219:
+  push $0
+ffffffff8010932a:	6a 00                	push   $0x0
+  push $219
+ffffffff8010932c:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+ffffffff80109331:	e9 13 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109336 <vector220>:
+.globl vector220
+vector220:
+  push $0
+ffffffff80109336:	6a 00                	push   $0x0
+  push $220
+ffffffff80109338:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+ffffffff8010933d:	e9 07 f2 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109342 <vector221>:
+.globl vector221
+vector221:
+  push $0
+ffffffff80109342:	6a 00                	push   $0x0
+  push $221
+ffffffff80109344:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+ffffffff80109349:	e9 fb f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010934e <vector222>:
+.globl vector222
+vector222:
+  push $0
+ffffffff8010934e:	6a 00                	push   $0x0
+  push $222
+ffffffff80109350:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+ffffffff80109355:	e9 ef f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010935a <vector223>:
+.globl vector223
+vector223:
+  push $0
+ffffffff8010935a:	6a 00                	push   $0x0
+  push $223
+ffffffff8010935c:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+ffffffff80109361:	e9 e3 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109366 <vector224>:
+.globl vector224
+vector224:
+  push $0
+ffffffff80109366:	6a 00                	push   $0x0
+  push $224
+ffffffff80109368:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+ffffffff8010936d:	e9 d7 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109372 <vector225>:
+.globl vector225
+vector225:
+  push $0
+ffffffff80109372:	6a 00                	push   $0x0
+  push $225
+ffffffff80109374:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+ffffffff80109379:	e9 cb f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010937e <vector226>:
+.globl vector226
+vector226:
+  push $0
+ffffffff8010937e:	6a 00                	push   $0x0
+  push $226
+ffffffff80109380:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+ffffffff80109385:	e9 bf f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010938a <vector227>:
+.globl vector227
+vector227:
+  push $0
+ffffffff8010938a:	6a 00                	push   $0x0
+  push $227
+ffffffff8010938c:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+ffffffff80109391:	e9 b3 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109396 <vector228>:
+.globl vector228
+vector228:
+  push $0
+ffffffff80109396:	6a 00                	push   $0x0
+  push $228
+ffffffff80109398:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+ffffffff8010939d:	e9 a7 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801093a2 <vector229>:
+.globl vector229
+vector229:
+  push $0
+ffffffff801093a2:	6a 00                	push   $0x0
+  push $229
+ffffffff801093a4:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+ffffffff801093a9:	e9 9b f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801093ae <vector230>:
+.globl vector230
+vector230:
+  push $0
+ffffffff801093ae:	6a 00                	push   $0x0
+  push $230
+ffffffff801093b0:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+ffffffff801093b5:	e9 8f f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801093ba <vector231>:
+.globl vector231
+vector231:
+  push $0
+ffffffff801093ba:	6a 00                	push   $0x0
+  push $231
+ffffffff801093bc:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+ffffffff801093c1:	e9 83 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801093c6 <vector232>:
+.globl vector232
+vector232:
+  push $0
+ffffffff801093c6:	6a 00                	push   $0x0
+  push $232
+ffffffff801093c8:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+ffffffff801093cd:	e9 77 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801093d2 <vector233>:
+.globl vector233
+vector233:
+  push $0
+ffffffff801093d2:	6a 00                	push   $0x0
+  push $233
+ffffffff801093d4:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+ffffffff801093d9:	e9 6b f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801093de <vector234>:
+.globl vector234
+vector234:
+  push $0
+ffffffff801093de:	6a 00                	push   $0x0
+  push $234
+ffffffff801093e0:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+ffffffff801093e5:	e9 5f f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801093ea <vector235>:
+.globl vector235
+vector235:
+  push $0
+ffffffff801093ea:	6a 00                	push   $0x0
+  push $235
+ffffffff801093ec:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+ffffffff801093f1:	e9 53 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801093f6 <vector236>:
+.globl vector236
+vector236:
+  push $0
+ffffffff801093f6:	6a 00                	push   $0x0
+  push $236
+ffffffff801093f8:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+ffffffff801093fd:	e9 47 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109402 <vector237>:
+.globl vector237
+vector237:
+  push $0
+ffffffff80109402:	6a 00                	push   $0x0
+  push $237
+ffffffff80109404:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+ffffffff80109409:	e9 3b f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010940e <vector238>:
+.globl vector238
+vector238:
+  push $0
+ffffffff8010940e:	6a 00                	push   $0x0
+  push $238
+ffffffff80109410:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+ffffffff80109415:	e9 2f f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010941a <vector239>:
+.globl vector239
+vector239:
+  push $0
+ffffffff8010941a:	6a 00                	push   $0x0
+  push $239
+ffffffff8010941c:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+ffffffff80109421:	e9 23 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109426 <vector240>:
+.globl vector240
+vector240:
+  push $0
+ffffffff80109426:	6a 00                	push   $0x0
+  push $240
+ffffffff80109428:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+ffffffff8010942d:	e9 17 f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109432 <vector241>:
+.globl vector241
+vector241:
+  push $0
+ffffffff80109432:	6a 00                	push   $0x0
+  push $241
+ffffffff80109434:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+ffffffff80109439:	e9 0b f1 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010943e <vector242>:
+.globl vector242
+vector242:
+  push $0
+ffffffff8010943e:	6a 00                	push   $0x0
+  push $242
+ffffffff80109440:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+ffffffff80109445:	e9 ff f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010944a <vector243>:
+.globl vector243
+vector243:
+  push $0
+ffffffff8010944a:	6a 00                	push   $0x0
+  push $243
+ffffffff8010944c:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+ffffffff80109451:	e9 f3 f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109456 <vector244>:
+.globl vector244
+vector244:
+  push $0
+ffffffff80109456:	6a 00                	push   $0x0
+  push $244
+ffffffff80109458:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+ffffffff8010945d:	e9 e7 f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109462 <vector245>:
+.globl vector245
+vector245:
+  push $0
+ffffffff80109462:	6a 00                	push   $0x0
+  push $245
+ffffffff80109464:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+ffffffff80109469:	e9 db f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010946e <vector246>:
+.globl vector246
+vector246:
+  push $0
+ffffffff8010946e:	6a 00                	push   $0x0
+  push $246
+ffffffff80109470:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+ffffffff80109475:	e9 cf f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010947a <vector247>:
+.globl vector247
+vector247:
+  push $0
+ffffffff8010947a:	6a 00                	push   $0x0
+  push $247
+ffffffff8010947c:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+ffffffff80109481:	e9 c3 f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109486 <vector248>:
+.globl vector248
+vector248:
+  push $0
+ffffffff80109486:	6a 00                	push   $0x0
+  push $248
+ffffffff80109488:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+ffffffff8010948d:	e9 b7 f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff80109492 <vector249>:
+.globl vector249
+vector249:
+  push $0
+ffffffff80109492:	6a 00                	push   $0x0
+  push $249
+ffffffff80109494:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+ffffffff80109499:	e9 ab f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff8010949e <vector250>:
+.globl vector250
+vector250:
+  push $0
+ffffffff8010949e:	6a 00                	push   $0x0
+  push $250
+ffffffff801094a0:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+ffffffff801094a5:	e9 9f f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801094aa <vector251>:
+.globl vector251
+vector251:
+  push $0
+ffffffff801094aa:	6a 00                	push   $0x0
+  push $251
+ffffffff801094ac:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+ffffffff801094b1:	e9 93 f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801094b6 <vector252>:
+.globl vector252
+vector252:
+  push $0
+ffffffff801094b6:	6a 00                	push   $0x0
+  push $252
+ffffffff801094b8:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+ffffffff801094bd:	e9 87 f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801094c2 <vector253>:
+.globl vector253
+vector253:
+  push $0
+ffffffff801094c2:	6a 00                	push   $0x0
+  push $253
+ffffffff801094c4:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+ffffffff801094c9:	e9 7b f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801094ce <vector254>:
+.globl vector254
+vector254:
+  push $0
+ffffffff801094ce:	6a 00                	push   $0x0
+  push $254
+ffffffff801094d0:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+ffffffff801094d5:	e9 6f f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801094da <vector255>:
+.globl vector255
+vector255:
+  push $0
+ffffffff801094da:	6a 00                	push   $0x0
+  push $255
+ffffffff801094dc:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+ffffffff801094e1:	e9 63 f0 ff ff       	jmp    ffffffff80108549 <alltraps>
+
+ffffffff801094e6 <v2p>:
+static inline uintp v2p(void *a) { return ((uintp) (a)) - ((uintp)KERNBASE); }
+ffffffff801094e6:	55                   	push   %rbp
+ffffffff801094e7:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801094ea:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff801094ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff801094f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801094f6:	ba 00 00 00 80       	mov    $0x80000000,%edx
+ffffffff801094fb:	48 01 d0             	add    %rdx,%rax
+ffffffff801094fe:	c9                   	leave
+ffffffff801094ff:	c3                   	ret
+
+ffffffff80109500 <p2v>:
+static inline void *p2v(uintp a) { return (void *) ((a) + ((uintp)KERNBASE)); }
+ffffffff80109500:	55                   	push   %rbp
+ffffffff80109501:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109504:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80109508:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff8010950c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109510:	48 05 00 00 00 80    	add    $0xffffffff80000000,%rax
+ffffffff80109516:	c9                   	leave
+ffffffff80109517:	c3                   	ret
+
+ffffffff80109518 <walkpgdir>:
+// Return the address of the PTE in page table pgdir
+// that corresponds to virtual address va.  If alloc!=0,
+// create any required page table pages.
+static pte_t *
+walkpgdir(pde_t *pgdir, const void *va, int alloc)
+{
+ffffffff80109518:	55                   	push   %rbp
+ffffffff80109519:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010951c:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80109520:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80109524:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff80109528:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  pde_t *pde;
+  pte_t *pgtab;
+
+  pde = &pgdir[PDX(va)];
+ffffffff8010952b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010952f:	48 c1 e8 15          	shr    $0x15,%rax
+ffffffff80109533:	25 ff 01 00 00       	and    $0x1ff,%eax
+ffffffff80109538:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff8010953f:	00 
+ffffffff80109540:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109544:	48 01 d0             	add    %rdx,%rax
+ffffffff80109547:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if(*pde & PTE_P){
+ffffffff8010954b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010954f:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109552:	83 e0 01             	and    $0x1,%eax
+ffffffff80109555:	48 85 c0             	test   %rax,%rax
+ffffffff80109558:	74 1b                	je     ffffffff80109575 <walkpgdir+0x5d>
+    pgtab = (pte_t*)p2v(PTE_ADDR(*pde));
+ffffffff8010955a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010955e:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109561:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff80109567:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010956a:	e8 91 ff ff ff       	call   ffffffff80109500 <p2v>
+ffffffff8010956f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80109573:	eb 4d                	jmp    ffffffff801095c2 <walkpgdir+0xaa>
+  } else {
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+ffffffff80109575:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+ffffffff80109579:	74 10                	je     ffffffff8010958b <walkpgdir+0x73>
+ffffffff8010957b:	e8 e4 a7 ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff80109580:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+ffffffff80109584:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80109589:	75 07                	jne    ffffffff80109592 <walkpgdir+0x7a>
+      return 0;
+ffffffff8010958b:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80109590:	eb 4c                	jmp    ffffffff801095de <walkpgdir+0xc6>
+    // Make sure all those PTE_P bits are zero.
+    memset(pgtab, 0, PGSIZE);
+ffffffff80109592:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109596:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff8010959b:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801095a0:	48 89 c7             	mov    %rax,%rdi
+ffffffff801095a3:	e8 97 d7 ff ff       	call   ffffffff80106d3f <memset>
+    // The permissions here are overly generous, but they can
+    // be further restricted by the permissions in the page table 
+    // entries, if necessary.
+    *pde = v2p(pgtab) | PTE_P | PTE_W | PTE_U;
+ffffffff801095a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801095ac:	48 89 c7             	mov    %rax,%rdi
+ffffffff801095af:	e8 32 ff ff ff       	call   ffffffff801094e6 <v2p>
+ffffffff801095b4:	48 83 c8 07          	or     $0x7,%rax
+ffffffff801095b8:	48 89 c2             	mov    %rax,%rdx
+ffffffff801095bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801095bf:	48 89 10             	mov    %rdx,(%rax)
+  }
+  return &pgtab[PTX(va)];
+ffffffff801095c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff801095c6:	48 c1 e8 0c          	shr    $0xc,%rax
+ffffffff801095ca:	25 ff 01 00 00       	and    $0x1ff,%eax
+ffffffff801095cf:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff801095d6:	00 
+ffffffff801095d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801095db:	48 01 d0             	add    %rdx,%rax
+}
+ffffffff801095de:	c9                   	leave
+ffffffff801095df:	c3                   	ret
+
+ffffffff801095e0 <mappages>:
+// Create PTEs for virtual addresses starting at va that refer to
+// physical addresses starting at pa. va and size might not
+// be page-aligned.
+static int
+mappages(pde_t *pgdir, void *va, uintp size, uintp pa, int perm)
+{
+ffffffff801095e0:	55                   	push   %rbp
+ffffffff801095e1:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801095e4:	48 83 ec 50          	sub    $0x50,%rsp
+ffffffff801095e8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+ffffffff801095ec:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ffffffff801095f0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+ffffffff801095f4:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+ffffffff801095f8:	44 89 45 bc          	mov    %r8d,-0x44(%rbp)
+  char *a, *last;
+  pte_t *pte;
+  
+  a = (char*)PGROUNDDOWN((uintp)va);
+ffffffff801095fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80109600:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff80109606:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  last = (char*)PGROUNDDOWN(((uintp)va) + size - 1);
+ffffffff8010960a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+ffffffff8010960e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80109612:	48 01 d0             	add    %rdx,%rax
+ffffffff80109615:	48 83 e8 01          	sub    $0x1,%rax
+ffffffff80109619:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff8010961f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for(;;){
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+ffffffff80109623:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ffffffff80109627:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff8010962b:	ba 01 00 00 00       	mov    $0x1,%edx
+ffffffff80109630:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80109633:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109636:	e8 dd fe ff ff       	call   ffffffff80109518 <walkpgdir>
+ffffffff8010963b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+ffffffff8010963f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+ffffffff80109644:	75 07                	jne    ffffffff8010964d <mappages+0x6d>
+      return -1;
+ffffffff80109646:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010964b:	eb 54                	jmp    ffffffff801096a1 <mappages+0xc1>
+    if(*pte & PTE_P)
+ffffffff8010964d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109651:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109654:	83 e0 01             	and    $0x1,%eax
+ffffffff80109657:	48 85 c0             	test   %rax,%rax
+ffffffff8010965a:	74 0c                	je     ffffffff80109668 <mappages+0x88>
+      panic("remap");
+ffffffff8010965c:	48 c7 c7 20 ae 10 80 	mov    $0xffffffff8010ae20,%rdi
+ffffffff80109663:	e8 c7 72 ff ff       	call   ffffffff8010092f <panic>
+    *pte = pa | perm | PTE_P;
+ffffffff80109668:	8b 45 bc             	mov    -0x44(%rbp),%eax
+ffffffff8010966b:	48 98                	cltq
+ffffffff8010966d:	48 0b 45 c0          	or     -0x40(%rbp),%rax
+ffffffff80109671:	48 83 c8 01          	or     $0x1,%rax
+ffffffff80109675:	48 89 c2             	mov    %rax,%rdx
+ffffffff80109678:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010967c:	48 89 10             	mov    %rdx,(%rax)
+    if(a == last)
+ffffffff8010967f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109683:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+ffffffff80109687:	74 12                	je     ffffffff8010969b <mappages+0xbb>
+      break;
+    a += PGSIZE;
+ffffffff80109689:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+ffffffff80109690:	00 
+    pa += PGSIZE;
+ffffffff80109691:	48 81 45 c0 00 10 00 	addq   $0x1000,-0x40(%rbp)
+ffffffff80109698:	00 
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+ffffffff80109699:	eb 88                	jmp    ffffffff80109623 <mappages+0x43>
+      break;
+ffffffff8010969b:	90                   	nop
+  }
+  return 0;
+ffffffff8010969c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff801096a1:	c9                   	leave
+ffffffff801096a2:	c3                   	ret
+
+ffffffff801096a3 <inituvm>:
+
+// Load the initcode into address 0 of pgdir.
+// sz must be less than a page.
+void
+inituvm(pde_t *pgdir, char *init, uint sz)
+{
+ffffffff801096a3:	55                   	push   %rbp
+ffffffff801096a4:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801096a7:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff801096ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff801096af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+ffffffff801096b3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  char *mem;
+  
+  if(sz >= PGSIZE)
+ffffffff801096b6:	81 7d dc ff 0f 00 00 	cmpl   $0xfff,-0x24(%rbp)
+ffffffff801096bd:	76 0c                	jbe    ffffffff801096cb <inituvm+0x28>
+    panic("inituvm: more than a page");
+ffffffff801096bf:	48 c7 c7 26 ae 10 80 	mov    $0xffffffff8010ae26,%rdi
+ffffffff801096c6:	e8 64 72 ff ff       	call   ffffffff8010092f <panic>
+  mem = kalloc();
+ffffffff801096cb:	e8 94 a6 ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff801096d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  memset(mem, 0, PGSIZE);
+ffffffff801096d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801096d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff801096dd:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801096e2:	48 89 c7             	mov    %rax,%rdi
+ffffffff801096e5:	e8 55 d6 ff ff       	call   ffffffff80106d3f <memset>
+  mappages(pgdir, 0, PGSIZE, v2p(mem), PTE_W|PTE_U);
+ffffffff801096ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801096ee:	48 89 c7             	mov    %rax,%rdi
+ffffffff801096f1:	e8 f0 fd ff ff       	call   ffffffff801094e6 <v2p>
+ffffffff801096f6:	48 89 c2             	mov    %rax,%rdx
+ffffffff801096f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801096fd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+ffffffff80109703:	48 89 d1             	mov    %rdx,%rcx
+ffffffff80109706:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff8010970b:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80109710:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109713:	e8 c8 fe ff ff       	call   ffffffff801095e0 <mappages>
+  memmove(mem, init, sz);
+ffffffff80109718:	8b 55 dc             	mov    -0x24(%rbp),%edx
+ffffffff8010971b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+ffffffff8010971f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109723:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80109726:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109729:	e8 00 d7 ff ff       	call   ffffffff80106e2e <memmove>
+}
+ffffffff8010972e:	90                   	nop
+ffffffff8010972f:	c9                   	leave
+ffffffff80109730:	c3                   	ret
+
+ffffffff80109731 <loaduvm>:
+
+// Load a program segment into pgdir.  addr must be page-aligned
+// and the pages from addr to addr+sz must already be mapped.
+int
+loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
+{
+ffffffff80109731:	55                   	push   %rbp
+ffffffff80109732:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109735:	53                   	push   %rbx
+ffffffff80109736:	48 83 ec 48          	sub    $0x48,%rsp
+ffffffff8010973a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+ffffffff8010973e:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+ffffffff80109742:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+ffffffff80109746:	89 4d b4             	mov    %ecx,-0x4c(%rbp)
+ffffffff80109749:	44 89 45 b0          	mov    %r8d,-0x50(%rbp)
+  uint i, pa, n;
+  pte_t *pte;
+
+  if((uintp) addr % PGSIZE != 0)
+ffffffff8010974d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80109751:	25 ff 0f 00 00       	and    $0xfff,%eax
+ffffffff80109756:	48 85 c0             	test   %rax,%rax
+ffffffff80109759:	74 0c                	je     ffffffff80109767 <loaduvm+0x36>
+    panic("loaduvm: addr must be page aligned");
+ffffffff8010975b:	48 c7 c7 40 ae 10 80 	mov    $0xffffffff8010ae40,%rdi
+ffffffff80109762:	e8 c8 71 ff ff       	call   ffffffff8010092f <panic>
+  for(i = 0; i < sz; i += PGSIZE){
+ffffffff80109767:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+ffffffff8010976e:	e9 a1 00 00 00       	jmp    ffffffff80109814 <loaduvm+0xe3>
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+ffffffff80109773:	8b 55 ec             	mov    -0x14(%rbp),%edx
+ffffffff80109776:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff8010977a:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+ffffffff8010977e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80109782:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff80109787:	48 89 ce             	mov    %rcx,%rsi
+ffffffff8010978a:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010978d:	e8 86 fd ff ff       	call   ffffffff80109518 <walkpgdir>
+ffffffff80109792:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ffffffff80109796:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+ffffffff8010979b:	75 0c                	jne    ffffffff801097a9 <loaduvm+0x78>
+      panic("loaduvm: address should exist");
+ffffffff8010979d:	48 c7 c7 63 ae 10 80 	mov    $0xffffffff8010ae63,%rdi
+ffffffff801097a4:	e8 86 71 ff ff       	call   ffffffff8010092f <panic>
+    pa = PTE_ADDR(*pte);
+ffffffff801097a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff801097ad:	48 8b 00             	mov    (%rax),%rax
+ffffffff801097b0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ffffffff801097b5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if(sz - i < PGSIZE)
+ffffffff801097b8:	8b 45 b0             	mov    -0x50(%rbp),%eax
+ffffffff801097bb:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ffffffff801097be:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+ffffffff801097c3:	77 0b                	ja     ffffffff801097d0 <loaduvm+0x9f>
+      n = sz - i;
+ffffffff801097c5:	8b 45 b0             	mov    -0x50(%rbp),%eax
+ffffffff801097c8:	2b 45 ec             	sub    -0x14(%rbp),%eax
+ffffffff801097cb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+ffffffff801097ce:	eb 07                	jmp    ffffffff801097d7 <loaduvm+0xa6>
+    else
+      n = PGSIZE;
+ffffffff801097d0:	c7 45 e8 00 10 00 00 	movl   $0x1000,-0x18(%rbp)
+    if(readi(ip, p2v(pa), offset+i, n) != n)
+ffffffff801097d7:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+ffffffff801097da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff801097dd:	8d 1c 02             	lea    (%rdx,%rax,1),%ebx
+ffffffff801097e0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+ffffffff801097e3:	48 89 c7             	mov    %rax,%rdi
+ffffffff801097e6:	e8 15 fd ff ff       	call   ffffffff80109500 <p2v>
+ffffffff801097eb:	48 89 c6             	mov    %rax,%rsi
+ffffffff801097ee:	8b 55 e8             	mov    -0x18(%rbp),%edx
+ffffffff801097f1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff801097f5:	89 d1                	mov    %edx,%ecx
+ffffffff801097f7:	89 da                	mov    %ebx,%edx
+ffffffff801097f9:	48 89 c7             	mov    %rax,%rdi
+ffffffff801097fc:	e8 94 96 ff ff       	call   ffffffff80102e95 <readi>
+ffffffff80109801:	39 45 e8             	cmp    %eax,-0x18(%rbp)
+ffffffff80109804:	74 07                	je     ffffffff8010980d <loaduvm+0xdc>
+      return -1;
+ffffffff80109806:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff8010980b:	eb 18                	jmp    ffffffff80109825 <loaduvm+0xf4>
+  for(i = 0; i < sz; i += PGSIZE){
+ffffffff8010980d:	81 45 ec 00 10 00 00 	addl   $0x1000,-0x14(%rbp)
+ffffffff80109814:	8b 45 ec             	mov    -0x14(%rbp),%eax
+ffffffff80109817:	3b 45 b0             	cmp    -0x50(%rbp),%eax
+ffffffff8010981a:	0f 82 53 ff ff ff    	jb     ffffffff80109773 <loaduvm+0x42>
+  }
+  return 0;
+ffffffff80109820:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80109825:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ffffffff80109829:	c9                   	leave
+ffffffff8010982a:	c3                   	ret
+
+ffffffff8010982b <allocuvm>:
+
+// Allocate page tables and physical memory to grow process from oldsz to
+// newsz, which need not be page aligned.  Returns new size or 0 on error.
+int
+allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+ffffffff8010982b:	55                   	push   %rbp
+ffffffff8010982c:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010982f:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80109833:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80109837:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+ffffffff8010983a:	89 55 e0             	mov    %edx,-0x20(%rbp)
+
+#if !defined(X64)
+  if(newsz >= KERNBASE)
+    return 0;
+#endif
+  if(newsz < oldsz)
+ffffffff8010983d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+ffffffff80109840:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+ffffffff80109843:	73 08                	jae    ffffffff8010984d <allocuvm+0x22>
+    return oldsz;
+ffffffff80109845:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80109848:	e9 b0 00 00 00       	jmp    ffffffff801098fd <allocuvm+0xd2>
+
+  a = PGROUNDUP(oldsz);
+ffffffff8010984d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80109850:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+ffffffff80109856:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff8010985c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  for(; a < newsz; a += PGSIZE){
+ffffffff80109860:	e9 88 00 00 00       	jmp    ffffffff801098ed <allocuvm+0xc2>
+    mem = kalloc();
+ffffffff80109865:	e8 fa a4 ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010986a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(mem == 0){
+ffffffff8010986e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80109873:	75 2d                	jne    ffffffff801098a2 <allocuvm+0x77>
+      cprintf("allocuvm out of memory\n");
+ffffffff80109875:	48 c7 c7 81 ae 10 80 	mov    $0xffffffff8010ae81,%rdi
+ffffffff8010987c:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80109881:	e8 1e 6d ff ff       	call   ffffffff801005a4 <cprintf>
+      deallocuvm(pgdir, newsz, oldsz);
+ffffffff80109886:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+ffffffff80109889:	8b 4d e0             	mov    -0x20(%rbp),%ecx
+ffffffff8010988c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109890:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80109893:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109896:	e8 64 00 00 00       	call   ffffffff801098ff <deallocuvm>
+      return 0;
+ffffffff8010989b:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff801098a0:	eb 5b                	jmp    ffffffff801098fd <allocuvm+0xd2>
+    }
+    memset(mem, 0, PGSIZE);
+ffffffff801098a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801098a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff801098ab:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff801098b0:	48 89 c7             	mov    %rax,%rdi
+ffffffff801098b3:	e8 87 d4 ff ff       	call   ffffffff80106d3f <memset>
+    mappages(pgdir, (char*)a, PGSIZE, v2p(mem), PTE_W|PTE_U);
+ffffffff801098b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801098bc:	48 89 c7             	mov    %rax,%rdi
+ffffffff801098bf:	e8 22 fc ff ff       	call   ffffffff801094e6 <v2p>
+ffffffff801098c4:	48 89 c2             	mov    %rax,%rdx
+ffffffff801098c7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+ffffffff801098cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801098cf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+ffffffff801098d5:	48 89 d1             	mov    %rdx,%rcx
+ffffffff801098d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff801098dd:	48 89 c7             	mov    %rax,%rdi
+ffffffff801098e0:	e8 fb fc ff ff       	call   ffffffff801095e0 <mappages>
+  for(; a < newsz; a += PGSIZE){
+ffffffff801098e5:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+ffffffff801098ec:	00 
+ffffffff801098ed:	8b 45 e0             	mov    -0x20(%rbp),%eax
+ffffffff801098f0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+ffffffff801098f4:	0f 82 6b ff ff ff    	jb     ffffffff80109865 <allocuvm+0x3a>
+  }
+  return newsz;
+ffffffff801098fa:	8b 45 e0             	mov    -0x20(%rbp),%eax
+}
+ffffffff801098fd:	c9                   	leave
+ffffffff801098fe:	c3                   	ret
+
+ffffffff801098ff <deallocuvm>:
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uintp oldsz, uintp newsz)
+{
+ffffffff801098ff:	55                   	push   %rbp
+ffffffff80109900:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109903:	48 83 ec 40          	sub    $0x40,%rsp
+ffffffff80109907:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+ffffffff8010990b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+ffffffff8010990f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  pte_t *pte;
+  uintp a, pa;
+
+  if(newsz >= oldsz)
+ffffffff80109913:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80109917:	48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+ffffffff8010991b:	72 09                	jb     ffffffff80109926 <deallocuvm+0x27>
+    return oldsz;
+ffffffff8010991d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80109921:	e9 ba 00 00 00       	jmp    ffffffff801099e0 <deallocuvm+0xe1>
+
+  a = PGROUNDUP(newsz);
+ffffffff80109926:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff8010992a:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+ffffffff80109930:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff80109936:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  for(; a  < oldsz; a += PGSIZE){
+ffffffff8010993a:	e9 8f 00 00 00       	jmp    ffffffff801099ce <deallocuvm+0xcf>
+    pte = walkpgdir(pgdir, (char*)a, 0);
+ffffffff8010993f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+ffffffff80109943:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80109947:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff8010994c:	48 89 ce             	mov    %rcx,%rsi
+ffffffff8010994f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109952:	e8 c1 fb ff ff       	call   ffffffff80109518 <walkpgdir>
+ffffffff80109957:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(!pte)
+ffffffff8010995b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+ffffffff80109960:	75 0a                	jne    ffffffff8010996c <deallocuvm+0x6d>
+      a += (NPTENTRIES - 1) * PGSIZE;
+ffffffff80109962:	48 81 45 f8 00 f0 1f 	addq   $0x1ff000,-0x8(%rbp)
+ffffffff80109969:	00 
+ffffffff8010996a:	eb 5a                	jmp    ffffffff801099c6 <deallocuvm+0xc7>
+    else if((*pte & PTE_P) != 0){
+ffffffff8010996c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80109970:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109973:	83 e0 01             	and    $0x1,%eax
+ffffffff80109976:	48 85 c0             	test   %rax,%rax
+ffffffff80109979:	74 4b                	je     ffffffff801099c6 <deallocuvm+0xc7>
+      pa = PTE_ADDR(*pte);
+ffffffff8010997b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010997f:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109982:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff80109988:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      if(pa == 0)
+ffffffff8010998c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+ffffffff80109991:	75 0c                	jne    ffffffff8010999f <deallocuvm+0xa0>
+        panic("kfree");
+ffffffff80109993:	48 c7 c7 99 ae 10 80 	mov    $0xffffffff8010ae99,%rdi
+ffffffff8010999a:	e8 90 6f ff ff       	call   ffffffff8010092f <panic>
+      char *v = p2v(pa);
+ffffffff8010999f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff801099a3:	48 89 c7             	mov    %rax,%rdi
+ffffffff801099a6:	e8 55 fb ff ff       	call   ffffffff80109500 <p2v>
+ffffffff801099ab:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      kfree(v);
+ffffffff801099af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff801099b3:	48 89 c7             	mov    %rax,%rdi
+ffffffff801099b6:	e8 ff a2 ff ff       	call   ffffffff80103cba <kfree>
+      *pte = 0;
+ffffffff801099bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff801099bf:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  for(; a  < oldsz; a += PGSIZE){
+ffffffff801099c6:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+ffffffff801099cd:	00 
+ffffffff801099ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff801099d2:	48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+ffffffff801099d6:	0f 82 63 ff ff ff    	jb     ffffffff8010993f <deallocuvm+0x40>
+    }
+  }
+  return newsz;
+ffffffff801099dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+ffffffff801099e0:	c9                   	leave
+ffffffff801099e1:	c3                   	ret
+
+ffffffff801099e2 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+ffffffff801099e2:	55                   	push   %rbp
+ffffffff801099e3:	48 89 e5             	mov    %rsp,%rbp
+ffffffff801099e6:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff801099ea:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  uint i;
+  if(pgdir == 0)
+ffffffff801099ee:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+ffffffff801099f3:	75 0c                	jne    ffffffff80109a01 <freevm+0x1f>
+    panic("freevm: no pgdir");
+ffffffff801099f5:	48 c7 c7 9f ae 10 80 	mov    $0xffffffff8010ae9f,%rdi
+ffffffff801099fc:	e8 2e 6f ff ff       	call   ffffffff8010092f <panic>
+  deallocuvm(pgdir, 0x3fa00000, 0);
+ffffffff80109a01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109a05:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff80109a0a:	be 00 00 a0 3f       	mov    $0x3fa00000,%esi
+ffffffff80109a0f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109a12:	e8 e8 fe ff ff       	call   ffffffff801098ff <deallocuvm>
+  for(i = 0; i < NPDENTRIES-2; i++){
+ffffffff80109a17:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80109a1e:	eb 54                	jmp    ffffffff80109a74 <freevm+0x92>
+    if(pgdir[i] & PTE_P){
+ffffffff80109a20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80109a23:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80109a2a:	00 
+ffffffff80109a2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109a2f:	48 01 d0             	add    %rdx,%rax
+ffffffff80109a32:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109a35:	83 e0 01             	and    $0x1,%eax
+ffffffff80109a38:	48 85 c0             	test   %rax,%rax
+ffffffff80109a3b:	74 33                	je     ffffffff80109a70 <freevm+0x8e>
+      char * v = p2v(PTE_ADDR(pgdir[i]));
+ffffffff80109a3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80109a40:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+ffffffff80109a47:	00 
+ffffffff80109a48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109a4c:	48 01 d0             	add    %rdx,%rax
+ffffffff80109a4f:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109a52:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff80109a58:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109a5b:	e8 a0 fa ff ff       	call   ffffffff80109500 <p2v>
+ffffffff80109a60:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      kfree(v);
+ffffffff80109a64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80109a68:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109a6b:	e8 4a a2 ff ff       	call   ffffffff80103cba <kfree>
+  for(i = 0; i < NPDENTRIES-2; i++){
+ffffffff80109a70:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80109a74:	81 7d fc fd 01 00 00 	cmpl   $0x1fd,-0x4(%rbp)
+ffffffff80109a7b:	76 a3                	jbe    ffffffff80109a20 <freevm+0x3e>
+    }
+  }
+  kfree((char*)pgdir);
+ffffffff80109a7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109a81:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109a84:	e8 31 a2 ff ff       	call   ffffffff80103cba <kfree>
+}
+ffffffff80109a89:	90                   	nop
+ffffffff80109a8a:	c9                   	leave
+ffffffff80109a8b:	c3                   	ret
+
+ffffffff80109a8c <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+ffffffff80109a8c:	55                   	push   %rbp
+ffffffff80109a8d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109a90:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80109a94:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80109a98:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+ffffffff80109a9c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+ffffffff80109aa0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109aa4:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff80109aa9:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80109aac:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109aaf:	e8 64 fa ff ff       	call   ffffffff80109518 <walkpgdir>
+ffffffff80109ab4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if(pte == 0)
+ffffffff80109ab8:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+ffffffff80109abd:	75 0c                	jne    ffffffff80109acb <clearpteu+0x3f>
+    panic("clearpteu");
+ffffffff80109abf:	48 c7 c7 b0 ae 10 80 	mov    $0xffffffff8010aeb0,%rdi
+ffffffff80109ac6:	e8 64 6e ff ff       	call   ffffffff8010092f <panic>
+  *pte &= ~PTE_U;
+ffffffff80109acb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109acf:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109ad2:	48 83 e0 fb          	and    $0xfffffffffffffffb,%rax
+ffffffff80109ad6:	48 89 c2             	mov    %rax,%rdx
+ffffffff80109ad9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109add:	48 89 10             	mov    %rdx,(%rax)
+}
+ffffffff80109ae0:	90                   	nop
+ffffffff80109ae1:	c9                   	leave
+ffffffff80109ae2:	c3                   	ret
+
+ffffffff80109ae3 <copyuvm>:
+
+// Given a parent process's page table, create a copy
+// of it for a child.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+ffffffff80109ae3:	55                   	push   %rbp
+ffffffff80109ae4:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109ae7:	53                   	push   %rbx
+ffffffff80109ae8:	48 83 ec 48          	sub    $0x48,%rsp
+ffffffff80109aec:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+ffffffff80109af0:	89 75 b4             	mov    %esi,-0x4c(%rbp)
+  pde_t *d;
+  pte_t *pte;
+  uintp pa, i, flags;
+  char *mem;
+
+  if((d = setupkvm()) == 0)
+ffffffff80109af3:	e8 b0 06 00 00       	call   ffffffff8010a1a8 <setupkvm>
+ffffffff80109af8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+ffffffff80109afc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+ffffffff80109b01:	75 0a                	jne    ffffffff80109b0d <copyuvm+0x2a>
+    return 0;
+ffffffff80109b03:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80109b08:	e9 0f 01 00 00       	jmp    ffffffff80109c1c <copyuvm+0x139>
+  for(i = 0; i < sz; i += PGSIZE){
+ffffffff80109b0d:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+ffffffff80109b14:	00 
+ffffffff80109b15:	e9 da 00 00 00       	jmp    ffffffff80109bf4 <copyuvm+0x111>
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+ffffffff80109b1a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+ffffffff80109b1e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+ffffffff80109b22:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff80109b27:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80109b2a:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109b2d:	e8 e6 f9 ff ff       	call   ffffffff80109518 <walkpgdir>
+ffffffff80109b32:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+ffffffff80109b36:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+ffffffff80109b3b:	75 0c                	jne    ffffffff80109b49 <copyuvm+0x66>
+      panic("copyuvm: pte should exist");
+ffffffff80109b3d:	48 c7 c7 ba ae 10 80 	mov    $0xffffffff8010aeba,%rdi
+ffffffff80109b44:	e8 e6 6d ff ff       	call   ffffffff8010092f <panic>
+    if(!(*pte & PTE_P))
+ffffffff80109b49:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80109b4d:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109b50:	83 e0 01             	and    $0x1,%eax
+ffffffff80109b53:	48 85 c0             	test   %rax,%rax
+ffffffff80109b56:	75 0c                	jne    ffffffff80109b64 <copyuvm+0x81>
+      panic("copyuvm: page not present");
+ffffffff80109b58:	48 c7 c7 d4 ae 10 80 	mov    $0xffffffff8010aed4,%rdi
+ffffffff80109b5f:	e8 cb 6d ff ff       	call   ffffffff8010092f <panic>
+    pa = PTE_ADDR(*pte);
+ffffffff80109b64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80109b68:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109b6b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff80109b71:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    flags = PTE_FLAGS(*pte);
+ffffffff80109b75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80109b79:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109b7c:	25 ff 0f 00 00       	and    $0xfff,%eax
+ffffffff80109b81:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if((mem = kalloc()) == 0)
+ffffffff80109b85:	e8 da a1 ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff80109b8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+ffffffff80109b8e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+ffffffff80109b93:	74 72                	je     ffffffff80109c07 <copyuvm+0x124>
+      goto bad;
+    memmove(mem, (char*)p2v(pa), PGSIZE);
+ffffffff80109b95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff80109b99:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109b9c:	e8 5f f9 ff ff       	call   ffffffff80109500 <p2v>
+ffffffff80109ba1:	48 89 c1             	mov    %rax,%rcx
+ffffffff80109ba4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80109ba8:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff80109bad:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80109bb0:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109bb3:	e8 76 d2 ff ff       	call   ffffffff80106e2e <memmove>
+    if(mappages(d, (void*)i, PGSIZE, v2p(mem), flags) < 0)
+ffffffff80109bb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80109bbc:	89 c3                	mov    %eax,%ebx
+ffffffff80109bbe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ffffffff80109bc2:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109bc5:	e8 1c f9 ff ff       	call   ffffffff801094e6 <v2p>
+ffffffff80109bca:	48 89 c2             	mov    %rax,%rdx
+ffffffff80109bcd:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+ffffffff80109bd1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80109bd5:	41 89 d8             	mov    %ebx,%r8d
+ffffffff80109bd8:	48 89 d1             	mov    %rdx,%rcx
+ffffffff80109bdb:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff80109be0:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109be3:	e8 f8 f9 ff ff       	call   ffffffff801095e0 <mappages>
+ffffffff80109be8:	85 c0                	test   %eax,%eax
+ffffffff80109bea:	78 1e                	js     ffffffff80109c0a <copyuvm+0x127>
+  for(i = 0; i < sz; i += PGSIZE){
+ffffffff80109bec:	48 81 45 e8 00 10 00 	addq   $0x1000,-0x18(%rbp)
+ffffffff80109bf3:	00 
+ffffffff80109bf4:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+ffffffff80109bf7:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+ffffffff80109bfb:	0f 82 19 ff ff ff    	jb     ffffffff80109b1a <copyuvm+0x37>
+      goto bad;
+  }
+  return d;
+ffffffff80109c01:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80109c05:	eb 15                	jmp    ffffffff80109c1c <copyuvm+0x139>
+      goto bad;
+ffffffff80109c07:	90                   	nop
+ffffffff80109c08:	eb 01                	jmp    ffffffff80109c0b <copyuvm+0x128>
+      goto bad;
+ffffffff80109c0a:	90                   	nop
+
+bad:
+  freevm(d);
+ffffffff80109c0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80109c0f:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109c12:	e8 cb fd ff ff       	call   ffffffff801099e2 <freevm>
+  return 0;
+ffffffff80109c17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80109c1c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+ffffffff80109c20:	c9                   	leave
+ffffffff80109c21:	c3                   	ret
+
+ffffffff80109c22 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+ffffffff80109c22:	55                   	push   %rbp
+ffffffff80109c23:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109c26:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80109c2a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80109c2e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+ffffffff80109c32:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+ffffffff80109c36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109c3a:	ba 00 00 00 00       	mov    $0x0,%edx
+ffffffff80109c3f:	48 89 ce             	mov    %rcx,%rsi
+ffffffff80109c42:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109c45:	e8 ce f8 ff ff       	call   ffffffff80109518 <walkpgdir>
+ffffffff80109c4a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if((*pte & PTE_P) == 0)
+ffffffff80109c4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109c52:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109c55:	83 e0 01             	and    $0x1,%eax
+ffffffff80109c58:	48 85 c0             	test   %rax,%rax
+ffffffff80109c5b:	75 07                	jne    ffffffff80109c64 <uva2ka+0x42>
+    return 0;
+ffffffff80109c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80109c62:	eb 2c                	jmp    ffffffff80109c90 <uva2ka+0x6e>
+  if((*pte & PTE_U) == 0)
+ffffffff80109c64:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109c68:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109c6b:	83 e0 04             	and    $0x4,%eax
+ffffffff80109c6e:	48 85 c0             	test   %rax,%rax
+ffffffff80109c71:	75 07                	jne    ffffffff80109c7a <uva2ka+0x58>
+    return 0;
+ffffffff80109c73:	b8 00 00 00 00       	mov    $0x0,%eax
+ffffffff80109c78:	eb 16                	jmp    ffffffff80109c90 <uva2ka+0x6e>
+  return (char*)p2v(PTE_ADDR(*pte));
+ffffffff80109c7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109c7e:	48 8b 00             	mov    (%rax),%rax
+ffffffff80109c81:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff80109c87:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109c8a:	e8 71 f8 ff ff       	call   ffffffff80109500 <p2v>
+ffffffff80109c8f:	90                   	nop
+}
+ffffffff80109c90:	c9                   	leave
+ffffffff80109c91:	c3                   	ret
+
+ffffffff80109c92 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+ffffffff80109c92:	55                   	push   %rbp
+ffffffff80109c93:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109c96:	48 83 ec 40          	sub    $0x40,%rsp
+ffffffff80109c9a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+ffffffff80109c9e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+ffffffff80109ca1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+ffffffff80109ca5:	89 4d d0             	mov    %ecx,-0x30(%rbp)
+  char *buf, *pa0;
+  uintp n, va0;
+
+  buf = (char*)p;
+ffffffff80109ca8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff80109cac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while(len > 0){
+ffffffff80109cb0:	e9 9a 00 00 00       	jmp    ffffffff80109d4f <copyout+0xbd>
+    va0 = (uint)PGROUNDDOWN(va);
+ffffffff80109cb5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+ffffffff80109cb8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ffffffff80109cbd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    pa0 = uva2ka(pgdir, (char*)va0);
+ffffffff80109cc1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff80109cc5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80109cc9:	48 89 d6             	mov    %rdx,%rsi
+ffffffff80109ccc:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109ccf:	e8 4e ff ff ff       	call   ffffffff80109c22 <uva2ka>
+ffffffff80109cd4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    if(pa0 == 0)
+ffffffff80109cd8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+ffffffff80109cdd:	75 07                	jne    ffffffff80109ce6 <copyout+0x54>
+      return -1;
+ffffffff80109cdf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ffffffff80109ce4:	eb 78                	jmp    ffffffff80109d5e <copyout+0xcc>
+    n = PGSIZE - (va - va0);
+ffffffff80109ce6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+ffffffff80109ce9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff80109ced:	48 29 c2             	sub    %rax,%rdx
+ffffffff80109cf0:	48 8d 82 00 10 00 00 	lea    0x1000(%rdx),%rax
+ffffffff80109cf7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if(n > len)
+ffffffff80109cfb:	8b 45 d0             	mov    -0x30(%rbp),%eax
+ffffffff80109cfe:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+ffffffff80109d02:	73 07                	jae    ffffffff80109d0b <copyout+0x79>
+      n = len;
+ffffffff80109d04:	8b 45 d0             	mov    -0x30(%rbp),%eax
+ffffffff80109d07:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    memmove(pa0 + (va - va0), buf, n);
+ffffffff80109d0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80109d0f:	89 c6                	mov    %eax,%esi
+ffffffff80109d11:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+ffffffff80109d14:	48 2b 45 e8          	sub    -0x18(%rbp),%rax
+ffffffff80109d18:	48 89 c2             	mov    %rax,%rdx
+ffffffff80109d1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff80109d1f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+ffffffff80109d23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109d27:	89 f2                	mov    %esi,%edx
+ffffffff80109d29:	48 89 c6             	mov    %rax,%rsi
+ffffffff80109d2c:	48 89 cf             	mov    %rcx,%rdi
+ffffffff80109d2f:	e8 fa d0 ff ff       	call   ffffffff80106e2e <memmove>
+    len -= n;
+ffffffff80109d34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80109d38:	29 45 d0             	sub    %eax,-0x30(%rbp)
+    buf += n;
+ffffffff80109d3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80109d3f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    va = va0 + PGSIZE;
+ffffffff80109d43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109d47:	05 00 10 00 00       	add    $0x1000,%eax
+ffffffff80109d4c:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  while(len > 0){
+ffffffff80109d4f:	83 7d d0 00          	cmpl   $0x0,-0x30(%rbp)
+ffffffff80109d53:	0f 85 5c ff ff ff    	jne    ffffffff80109cb5 <copyout+0x23>
+  }
+  return 0;
+ffffffff80109d59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ffffffff80109d5e:	c9                   	leave
+ffffffff80109d5f:	c3                   	ret
+
+ffffffff80109d60 <lgdt>:
+{
+ffffffff80109d60:	55                   	push   %rbp
+ffffffff80109d61:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109d64:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80109d68:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80109d6c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  pd[0] = size-1;
+ffffffff80109d6f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80109d72:	83 e8 01             	sub    $0x1,%eax
+ffffffff80109d75:	66 89 45 f6          	mov    %ax,-0xa(%rbp)
+  pd[1] = (uintp)p;
+ffffffff80109d79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109d7d:	66 89 45 f8          	mov    %ax,-0x8(%rbp)
+  pd[2] = (uintp)p >> 16;
+ffffffff80109d81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109d85:	48 c1 e8 10          	shr    $0x10,%rax
+ffffffff80109d89:	66 89 45 fa          	mov    %ax,-0x6(%rbp)
+  pd[3] = (uintp)p >> 32;
+ffffffff80109d8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109d91:	48 c1 e8 20          	shr    $0x20,%rax
+ffffffff80109d95:	66 89 45 fc          	mov    %ax,-0x4(%rbp)
+  pd[4] = (uintp)p >> 48;
+ffffffff80109d99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109d9d:	48 c1 e8 30          	shr    $0x30,%rax
+ffffffff80109da1:	66 89 45 fe          	mov    %ax,-0x2(%rbp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+ffffffff80109da5:	48 8d 45 f6          	lea    -0xa(%rbp),%rax
+ffffffff80109da9:	0f 01 10             	lgdt   (%rax)
+}
+ffffffff80109dac:	90                   	nop
+ffffffff80109dad:	c9                   	leave
+ffffffff80109dae:	c3                   	ret
+
+ffffffff80109daf <lidt>:
+{
+ffffffff80109daf:	55                   	push   %rbp
+ffffffff80109db0:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109db3:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff80109db7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80109dbb:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  pd[0] = size-1;
+ffffffff80109dbe:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80109dc1:	83 e8 01             	sub    $0x1,%eax
+ffffffff80109dc4:	66 89 45 f6          	mov    %ax,-0xa(%rbp)
+  pd[1] = (uintp)p;
+ffffffff80109dc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109dcc:	66 89 45 f8          	mov    %ax,-0x8(%rbp)
+  pd[2] = (uintp)p >> 16;
+ffffffff80109dd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109dd4:	48 c1 e8 10          	shr    $0x10,%rax
+ffffffff80109dd8:	66 89 45 fa          	mov    %ax,-0x6(%rbp)
+  pd[3] = (uintp)p >> 32;
+ffffffff80109ddc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109de0:	48 c1 e8 20          	shr    $0x20,%rax
+ffffffff80109de4:	66 89 45 fc          	mov    %ax,-0x4(%rbp)
+  pd[4] = (uintp)p >> 48;
+ffffffff80109de8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109dec:	48 c1 e8 30          	shr    $0x30,%rax
+ffffffff80109df0:	66 89 45 fe          	mov    %ax,-0x2(%rbp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+ffffffff80109df4:	48 8d 45 f6          	lea    -0xa(%rbp),%rax
+ffffffff80109df8:	0f 01 18             	lidt   (%rax)
+}
+ffffffff80109dfb:	90                   	nop
+ffffffff80109dfc:	c9                   	leave
+ffffffff80109dfd:	c3                   	ret
+
+ffffffff80109dfe <ltr>:
+{
+ffffffff80109dfe:	55                   	push   %rbp
+ffffffff80109dff:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109e02:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80109e06:	89 f8                	mov    %edi,%eax
+ffffffff80109e08:	66 89 45 fc          	mov    %ax,-0x4(%rbp)
+  asm volatile("ltr %0" : : "r" (sel));
+ffffffff80109e0c:	0f b7 45 fc          	movzwl -0x4(%rbp),%eax
+ffffffff80109e10:	0f 00 d8             	ltr    %ax
+}
+ffffffff80109e13:	90                   	nop
+ffffffff80109e14:	c9                   	leave
+ffffffff80109e15:	c3                   	ret
+
+ffffffff80109e16 <lcr3>:
+
+static inline void
+lcr3(uintp val) 
+{
+ffffffff80109e16:	55                   	push   %rbp
+ffffffff80109e17:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109e1a:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80109e1e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  asm volatile("mov %0,%%cr3" : : "r" (val));
+ffffffff80109e22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109e26:	0f 22 d8             	mov    %rax,%cr3
+}
+ffffffff80109e29:	90                   	nop
+ffffffff80109e2a:	c9                   	leave
+ffffffff80109e2b:	c3                   	ret
+
+ffffffff80109e2c <v2p>:
+static inline uintp v2p(void *a) { return ((uintp) (a)) - ((uintp)KERNBASE); }
+ffffffff80109e2c:	55                   	push   %rbp
+ffffffff80109e2d:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109e30:	48 83 ec 08          	sub    $0x8,%rsp
+ffffffff80109e34:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80109e38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109e3c:	ba 00 00 00 80       	mov    $0x80000000,%edx
+ffffffff80109e41:	48 01 d0             	add    %rdx,%rax
+ffffffff80109e44:	c9                   	leave
+ffffffff80109e45:	c3                   	ret
+
+ffffffff80109e46 <tvinit>:
+static pde_t *kpgdir0;
+static pde_t *kpgdir1;
+
+void wrmsr(uint msr, uint64 val);
+
+void tvinit(void) {}
+ffffffff80109e46:	55                   	push   %rbp
+ffffffff80109e47:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109e4a:	90                   	nop
+ffffffff80109e4b:	5d                   	pop    %rbp
+ffffffff80109e4c:	c3                   	ret
+
+ffffffff80109e4d <idtinit>:
+void idtinit(void) {}
+ffffffff80109e4d:	55                   	push   %rbp
+ffffffff80109e4e:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109e51:	90                   	nop
+ffffffff80109e52:	5d                   	pop    %rbp
+ffffffff80109e53:	c3                   	ret
+
+ffffffff80109e54 <mkgate>:
+
+static void mkgate(uint *idt, uint n, void *kva, uint pl, uint trap) {
+ffffffff80109e54:	55                   	push   %rbp
+ffffffff80109e55:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109e58:	48 83 ec 30          	sub    $0x30,%rsp
+ffffffff80109e5c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+ffffffff80109e60:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+ffffffff80109e63:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+ffffffff80109e67:	89 4d e0             	mov    %ecx,-0x20(%rbp)
+ffffffff80109e6a:	44 89 45 d4          	mov    %r8d,-0x2c(%rbp)
+  uint64 addr = (uint64) kva;
+ffffffff80109e6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff80109e72:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  n *= 4;
+ffffffff80109e76:	c1 65 e4 02          	shll   $0x2,-0x1c(%rbp)
+  trap = trap ? 0x8F00 : 0x8E00; // TRAP vs INTERRUPT gate;
+ffffffff80109e7a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+ffffffff80109e7e:	74 07                	je     ffffffff80109e87 <mkgate+0x33>
+ffffffff80109e80:	b8 00 8f 00 00       	mov    $0x8f00,%eax
+ffffffff80109e85:	eb 05                	jmp    ffffffff80109e8c <mkgate+0x38>
+ffffffff80109e87:	b8 00 8e 00 00       	mov    $0x8e00,%eax
+ffffffff80109e8c:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  idt[n+0] = (addr & 0xFFFF) | ((SEG_KCODE << 3) << 16);
+ffffffff80109e8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109e93:	0f b7 d0             	movzwl %ax,%edx
+ffffffff80109e96:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80109e99:	48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+ffffffff80109ea0:	00 
+ffffffff80109ea1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109ea5:	48 01 c8             	add    %rcx,%rax
+ffffffff80109ea8:	81 ca 00 00 08 00    	or     $0x80000,%edx
+ffffffff80109eae:	89 10                	mov    %edx,(%rax)
+  idt[n+1] = (addr & 0xFFFF0000) | trap | ((pl & 3) << 13); // P=1 DPL=pl
+ffffffff80109eb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109eb4:	66 b8 00 00          	mov    $0x0,%ax
+ffffffff80109eb8:	0b 45 d4             	or     -0x2c(%rbp),%eax
+ffffffff80109ebb:	89 c2                	mov    %eax,%edx
+ffffffff80109ebd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+ffffffff80109ec0:	c1 e0 0d             	shl    $0xd,%eax
+ffffffff80109ec3:	25 00 60 00 00       	and    $0x6000,%eax
+ffffffff80109ec8:	89 c1                	mov    %eax,%ecx
+ffffffff80109eca:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80109ecd:	83 c0 01             	add    $0x1,%eax
+ffffffff80109ed0:	89 c0                	mov    %eax,%eax
+ffffffff80109ed2:	48 8d 34 85 00 00 00 	lea    0x0(,%rax,4),%rsi
+ffffffff80109ed9:	00 
+ffffffff80109eda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109ede:	48 01 f0             	add    %rsi,%rax
+ffffffff80109ee1:	09 ca                	or     %ecx,%edx
+ffffffff80109ee3:	89 10                	mov    %edx,(%rax)
+  idt[n+2] = addr >> 32;
+ffffffff80109ee5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109ee9:	48 c1 e8 20          	shr    $0x20,%rax
+ffffffff80109eed:	48 89 c2             	mov    %rax,%rdx
+ffffffff80109ef0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80109ef3:	83 c0 02             	add    $0x2,%eax
+ffffffff80109ef6:	89 c0                	mov    %eax,%eax
+ffffffff80109ef8:	48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+ffffffff80109eff:	00 
+ffffffff80109f00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109f04:	48 01 c8             	add    %rcx,%rax
+ffffffff80109f07:	89 10                	mov    %edx,(%rax)
+  idt[n+3] = 0;
+ffffffff80109f09:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+ffffffff80109f0c:	83 c0 03             	add    $0x3,%eax
+ffffffff80109f0f:	89 c0                	mov    %eax,%eax
+ffffffff80109f11:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+ffffffff80109f18:	00 
+ffffffff80109f19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109f1d:	48 01 d0             	add    %rdx,%rax
+ffffffff80109f20:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+ffffffff80109f26:	90                   	nop
+ffffffff80109f27:	c9                   	leave
+ffffffff80109f28:	c3                   	ret
+
+ffffffff80109f29 <tss_set_rsp>:
+
+static void tss_set_rsp(uint *tss, uint n, uint64 rsp) {
+ffffffff80109f29:	55                   	push   %rbp
+ffffffff80109f2a:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109f2d:	48 83 ec 18          	sub    $0x18,%rsp
+ffffffff80109f31:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+ffffffff80109f35:	89 75 f4             	mov    %esi,-0xc(%rbp)
+ffffffff80109f38:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  tss[n*2 + 1] = rsp;
+ffffffff80109f3c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80109f3f:	01 c0                	add    %eax,%eax
+ffffffff80109f41:	83 c0 01             	add    $0x1,%eax
+ffffffff80109f44:	89 c0                	mov    %eax,%eax
+ffffffff80109f46:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+ffffffff80109f4d:	00 
+ffffffff80109f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109f52:	48 01 d0             	add    %rdx,%rax
+ffffffff80109f55:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff80109f59:	89 10                	mov    %edx,(%rax)
+  tss[n*2 + 2] = rsp >> 32;
+ffffffff80109f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff80109f5f:	48 c1 e8 20          	shr    $0x20,%rax
+ffffffff80109f63:	48 89 c2             	mov    %rax,%rdx
+ffffffff80109f66:	8b 45 f4             	mov    -0xc(%rbp),%eax
+ffffffff80109f69:	83 c0 01             	add    $0x1,%eax
+ffffffff80109f6c:	01 c0                	add    %eax,%eax
+ffffffff80109f6e:	89 c0                	mov    %eax,%eax
+ffffffff80109f70:	48 8d 0c 85 00 00 00 	lea    0x0(,%rax,4),%rcx
+ffffffff80109f77:	00 
+ffffffff80109f78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff80109f7c:	48 01 c8             	add    %rcx,%rax
+ffffffff80109f7f:	89 10                	mov    %edx,(%rax)
+}
+ffffffff80109f81:	90                   	nop
+ffffffff80109f82:	c9                   	leave
+ffffffff80109f83:	c3                   	ret
+
+ffffffff80109f84 <seginit>:
+
+// Set up CPU's kernel segment descriptors.
+// Run once on entry on each CPU.
+void
+seginit(void)
+{
+ffffffff80109f84:	55                   	push   %rbp
+ffffffff80109f85:	48 89 e5             	mov    %rsp,%rbp
+ffffffff80109f88:	48 83 ec 40          	sub    $0x40,%rsp
+  uint64 *gdt;
+  uint *tss;
+  uint64 addr;
+  void *local;
+  struct cpu *c;
+  uint *idt = (uint*) kalloc();
+ffffffff80109f8c:	e8 d3 9d ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff80109f91:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int n;
+  memset(idt, 0, PGSIZE);
+ffffffff80109f95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80109f99:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff80109f9e:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff80109fa3:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109fa6:	e8 94 cd ff ff       	call   ffffffff80106d3f <memset>
+
+  for (n = 0; n < 256; n++)
+ffffffff80109fab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff80109fb2:	eb 2b                	jmp    ffffffff80109fdf <seginit+0x5b>
+    mkgate(idt, n, vectors[n], 0, 0);
+ffffffff80109fb4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff80109fb7:	48 98                	cltq
+ffffffff80109fb9:	48 8b 14 c5 78 b6 10 	mov    -0x7fef4988(,%rax,8),%rdx
+ffffffff80109fc0:	80 
+ffffffff80109fc1:	8b 75 fc             	mov    -0x4(%rbp),%esi
+ffffffff80109fc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80109fc8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+ffffffff80109fce:	b9 00 00 00 00       	mov    $0x0,%ecx
+ffffffff80109fd3:	48 89 c7             	mov    %rax,%rdi
+ffffffff80109fd6:	e8 79 fe ff ff       	call   ffffffff80109e54 <mkgate>
+  for (n = 0; n < 256; n++)
+ffffffff80109fdb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff80109fdf:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%rbp)
+ffffffff80109fe6:	7e cc                	jle    ffffffff80109fb4 <seginit+0x30>
+  mkgate(idt, 64, vectors[64], 3, 1);
+ffffffff80109fe8:	48 8b 15 89 18 00 00 	mov    0x1889(%rip),%rdx        # ffffffff8010b878 <vectors+0x200>
+ffffffff80109fef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff80109ff3:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ffffffff80109ff9:	b9 03 00 00 00       	mov    $0x3,%ecx
+ffffffff80109ffe:	be 40 00 00 00       	mov    $0x40,%esi
+ffffffff8010a003:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a006:	e8 49 fe ff ff       	call   ffffffff80109e54 <mkgate>
+
+  lidt((void*) idt, PGSIZE);
+ffffffff8010a00b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010a00f:	be 00 10 00 00       	mov    $0x1000,%esi
+ffffffff8010a014:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a017:	e8 93 fd ff ff       	call   ffffffff80109daf <lidt>
+
+  // create a page for cpu local storage 
+  local = kalloc();
+ffffffff8010a01c:	e8 43 9d ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010a021:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  memset(local, 0, PGSIZE);
+ffffffff8010a025:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a029:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff8010a02e:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010a033:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a036:	e8 04 cd ff ff       	call   ffffffff80106d3f <memset>
+
+  gdt = (uint64*) local;
+ffffffff8010a03b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a03f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  tss = (uint*) (((char*) local) + 1024);
+ffffffff8010a043:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a047:	48 05 00 04 00 00    	add    $0x400,%rax
+ffffffff8010a04d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  tss[16] = 0x00680000; // IO Map Base = End of TSS
+ffffffff8010a051:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff8010a055:	48 83 c0 40          	add    $0x40,%rax
+ffffffff8010a059:	c7 00 00 00 68 00    	movl   $0x680000,(%rax)
+
+  // point FS smack in the middle of our local storage page
+  wrmsr(0xC0000100, ((uint64) local) + (PGSIZE / 2));
+ffffffff8010a05f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a063:	48 05 00 08 00 00    	add    $0x800,%rax
+ffffffff8010a069:	48 89 c6             	mov    %rax,%rsi
+ffffffff8010a06c:	bf 00 01 00 c0       	mov    $0xc0000100,%edi
+ffffffff8010a071:	e8 a5 60 ff ff       	call   ffffffff8010011b <wrmsr>
+
+  c = &cpus[cpunum()];
+ffffffff8010a076:	e8 79 a0 ff ff       	call   ffffffff801040f4 <cpunum>
+ffffffff8010a07b:	48 63 d0             	movslq %eax,%rdx
+ffffffff8010a07e:	48 89 d0             	mov    %rdx,%rax
+ffffffff8010a081:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff8010a085:	48 29 d0             	sub    %rdx,%rax
+ffffffff8010a088:	48 c1 e0 04          	shl    $0x4,%rax
+ffffffff8010a08c:	48 05 e0 27 11 80    	add    $0xffffffff801127e0,%rax
+ffffffff8010a092:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  c->local = local;
+ffffffff8010a096:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff8010a09a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ffffffff8010a09e:	48 89 90 e8 00 00 00 	mov    %rdx,0xe8(%rax)
+
+  cpu = c;
+ffffffff8010a0a5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+ffffffff8010a0a9:	64 48 89 04 25 f0 ff 	mov    %rax,%fs:0xfffffffffffffff0
+ffffffff8010a0b0:	ff ff 
+  proc = 0;
+ffffffff8010a0b2:	64 48 c7 04 25 f8 ff 	movq   $0x0,%fs:0xfffffffffffffff8
+ffffffff8010a0b9:	ff ff 00 00 00 00 
+
+  addr = (uint64) tss;
+ffffffff8010a0bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+ffffffff8010a0c3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  gdt[0] =         0x0000000000000000;
+ffffffff8010a0c7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010a0cb:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  gdt[SEG_KCODE] = 0x0020980000000000;  // Code, DPL=0, R/X
+ffffffff8010a0d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010a0d6:	48 83 c0 08          	add    $0x8,%rax
+ffffffff8010a0da:	48 b9 00 00 00 00 00 	movabs $0x20980000000000,%rcx
+ffffffff8010a0e1:	98 20 00 
+ffffffff8010a0e4:	48 89 08             	mov    %rcx,(%rax)
+  gdt[SEG_UCODE] = 0x0020F80000000000;  // Code, DPL=3, R/X
+ffffffff8010a0e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010a0eb:	48 83 c0 20          	add    $0x20,%rax
+ffffffff8010a0ef:	48 bf 00 00 00 00 00 	movabs $0x20f80000000000,%rdi
+ffffffff8010a0f6:	f8 20 00 
+ffffffff8010a0f9:	48 89 38             	mov    %rdi,(%rax)
+  gdt[SEG_KDATA] = 0x0000920000000000;  // Data, DPL=0, W
+ffffffff8010a0fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010a100:	48 83 c0 10          	add    $0x10,%rax
+ffffffff8010a104:	48 b9 00 00 00 00 00 	movabs $0x920000000000,%rcx
+ffffffff8010a10b:	92 00 00 
+ffffffff8010a10e:	48 89 08             	mov    %rcx,(%rax)
+  gdt[SEG_KCPU]  = 0x0000000000000000;  // unused
+ffffffff8010a111:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010a115:	48 83 c0 18          	add    $0x18,%rax
+ffffffff8010a119:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  gdt[SEG_UDATA] = 0x0000F20000000000;  // Data, DPL=3, W
+ffffffff8010a120:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010a124:	48 83 c0 28          	add    $0x28,%rax
+ffffffff8010a128:	48 be 00 00 00 00 00 	movabs $0xf20000000000,%rsi
+ffffffff8010a12f:	f2 00 00 
+ffffffff8010a132:	48 89 30             	mov    %rsi,(%rax)
+  gdt[SEG_TSS+0] = (0x0067) | ((addr & 0xFFFFFF) << 16) |
+ffffffff8010a135:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff8010a139:	48 c1 e0 10          	shl    $0x10,%rax
+ffffffff8010a13d:	48 89 c2             	mov    %rax,%rdx
+ffffffff8010a140:	48 b8 00 00 ff ff ff 	movabs $0xffffff0000,%rax
+ffffffff8010a147:	00 00 00 
+ffffffff8010a14a:	48 21 c2             	and    %rax,%rdx
+                   (0x00E9LL << 40) | (((addr >> 24) & 0xFF) << 56);
+ffffffff8010a14d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ffffffff8010a151:	48 c1 e8 18          	shr    $0x18,%rax
+ffffffff8010a155:	48 c1 e0 38          	shl    $0x38,%rax
+ffffffff8010a159:	48 89 d1             	mov    %rdx,%rcx
+ffffffff8010a15c:	48 09 c1             	or     %rax,%rcx
+  gdt[SEG_TSS+0] = (0x0067) | ((addr & 0xFFFFFF) << 16) |
+ffffffff8010a15f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010a163:	48 83 c0 30          	add    $0x30,%rax
+                   (0x00E9LL << 40) | (((addr >> 24) & 0xFF) << 56);
+ffffffff8010a167:	48 ba 67 00 00 00 00 	movabs $0xe90000000067,%rdx
+ffffffff8010a16e:	e9 00 00 
+ffffffff8010a171:	48 09 ca             	or     %rcx,%rdx
+  gdt[SEG_TSS+0] = (0x0067) | ((addr & 0xFFFFFF) << 16) |
+ffffffff8010a174:	48 89 10             	mov    %rdx,(%rax)
+  gdt[SEG_TSS+1] = (addr >> 32);
+ffffffff8010a177:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010a17b:	48 83 c0 38          	add    $0x38,%rax
+ffffffff8010a17f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+ffffffff8010a183:	48 c1 ea 20          	shr    $0x20,%rdx
+ffffffff8010a187:	48 89 10             	mov    %rdx,(%rax)
+
+  lgdt((void*) gdt, 8 * sizeof(uint64));
+ffffffff8010a18a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+ffffffff8010a18e:	be 40 00 00 00       	mov    $0x40,%esi
+ffffffff8010a193:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a196:	e8 c5 fb ff ff       	call   ffffffff80109d60 <lgdt>
+
+  ltr(SEG_TSS << 3);
+ffffffff8010a19b:	bf 30 00 00 00       	mov    $0x30,%edi
+ffffffff8010a1a0:	e8 59 fc ff ff       	call   ffffffff80109dfe <ltr>
+};
+ffffffff8010a1a5:	90                   	nop
+ffffffff8010a1a6:	c9                   	leave
+ffffffff8010a1a7:	c3                   	ret
+
+ffffffff8010a1a8 <setupkvm>:
+// because we need to find the other levels later, we'll stash
+// backpointers to them in the top two entries of the level two
+// table.
+pde_t*
+setupkvm(void)
+{
+ffffffff8010a1a8:	55                   	push   %rbp
+ffffffff8010a1a9:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010a1ac:	48 83 ec 20          	sub    $0x20,%rsp
+  pde_t *pml4 = (pde_t*) kalloc();
+ffffffff8010a1b0:	e8 af 9b ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010a1b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  pde_t *pdpt = (pde_t*) kalloc();
+ffffffff8010a1b9:	e8 a6 9b ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010a1be:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  pde_t *pgdir = (pde_t*) kalloc();
+ffffffff8010a1c2:	e8 9d 9b ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010a1c7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+
+  memset(pml4, 0, PGSIZE);
+ffffffff8010a1cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010a1cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff8010a1d4:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010a1d9:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a1dc:	e8 5e cb ff ff       	call   ffffffff80106d3f <memset>
+  memset(pdpt, 0, PGSIZE);
+ffffffff8010a1e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010a1e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff8010a1ea:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010a1ef:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a1f2:	e8 48 cb ff ff       	call   ffffffff80106d3f <memset>
+  memset(pgdir, 0, PGSIZE);
+ffffffff8010a1f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a1fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff8010a200:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010a205:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a208:	e8 32 cb ff ff       	call   ffffffff80106d3f <memset>
+  pml4[511] = v2p(kpdpt) | PTE_P | PTE_W | PTE_U;
+ffffffff8010a20d:	48 8b 05 cc ce 00 00 	mov    0xcecc(%rip),%rax        # ffffffff801170e0 <kpdpt>
+ffffffff8010a214:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a217:	e8 10 fc ff ff       	call   ffffffff80109e2c <v2p>
+ffffffff8010a21c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff8010a220:	48 81 c2 f8 0f 00 00 	add    $0xff8,%rdx
+ffffffff8010a227:	48 83 c8 07          	or     $0x7,%rax
+ffffffff8010a22b:	48 89 02             	mov    %rax,(%rdx)
+  pml4[0] = v2p(pdpt) | PTE_P | PTE_W | PTE_U;
+ffffffff8010a22e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010a232:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a235:	e8 f2 fb ff ff       	call   ffffffff80109e2c <v2p>
+ffffffff8010a23a:	48 83 c8 07          	or     $0x7,%rax
+ffffffff8010a23e:	48 89 c2             	mov    %rax,%rdx
+ffffffff8010a241:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010a245:	48 89 10             	mov    %rdx,(%rax)
+  pdpt[0] = v2p(pgdir) | PTE_P | PTE_W | PTE_U; 
+ffffffff8010a248:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a24c:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a24f:	e8 d8 fb ff ff       	call   ffffffff80109e2c <v2p>
+ffffffff8010a254:	48 83 c8 07          	or     $0x7,%rax
+ffffffff8010a258:	48 89 c2             	mov    %rax,%rdx
+ffffffff8010a25b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010a25f:	48 89 10             	mov    %rdx,(%rax)
+
+  // virtual backpointers
+  pgdir[511] = ((uintp) pml4) | PTE_P;
+ffffffff8010a262:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+ffffffff8010a266:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a26a:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+ffffffff8010a270:	48 83 ca 01          	or     $0x1,%rdx
+ffffffff8010a274:	48 89 10             	mov    %rdx,(%rax)
+  pgdir[510] = ((uintp) pdpt) | PTE_P;
+ffffffff8010a277:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+ffffffff8010a27b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a27f:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+ffffffff8010a285:	48 83 ca 01          	or     $0x1,%rdx
+ffffffff8010a289:	48 89 10             	mov    %rdx,(%rax)
+
+  return pgdir;
+ffffffff8010a28c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+};
+ffffffff8010a290:	c9                   	leave
+ffffffff8010a291:	c3                   	ret
+
+ffffffff8010a292 <kvmalloc>:
+// space for scheduler processes.
+//
+// linear map the first 4GB of physical memory starting at 0xFFFFFFFF80000000
+void
+kvmalloc(void)
+{
+ffffffff8010a292:	55                   	push   %rbp
+ffffffff8010a293:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010a296:	48 83 ec 10          	sub    $0x10,%rsp
+  int n;
+  kpml4 = (pde_t*) kalloc();
+ffffffff8010a29a:	e8 c5 9a ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010a29f:	48 89 05 32 ce 00 00 	mov    %rax,0xce32(%rip)        # ffffffff801170d8 <kpml4>
+  kpdpt = (pde_t*) kalloc();
+ffffffff8010a2a6:	e8 b9 9a ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010a2ab:	48 89 05 2e ce 00 00 	mov    %rax,0xce2e(%rip)        # ffffffff801170e0 <kpdpt>
+  kpgdir0 = (pde_t*) kalloc();
+ffffffff8010a2b2:	e8 ad 9a ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010a2b7:	48 89 05 32 ce 00 00 	mov    %rax,0xce32(%rip)        # ffffffff801170f0 <kpgdir0>
+  kpgdir1 = (pde_t*) kalloc();
+ffffffff8010a2be:	e8 a1 9a ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010a2c3:	48 89 05 2e ce 00 00 	mov    %rax,0xce2e(%rip)        # ffffffff801170f8 <kpgdir1>
+  iopgdir = (pde_t*) kalloc();
+ffffffff8010a2ca:	e8 95 9a ff ff       	call   ffffffff80103d64 <kalloc>
+ffffffff8010a2cf:	48 89 05 12 ce 00 00 	mov    %rax,0xce12(%rip)        # ffffffff801170e8 <iopgdir>
+  memset(kpml4, 0, PGSIZE);
+ffffffff8010a2d6:	48 8b 05 fb cd 00 00 	mov    0xcdfb(%rip),%rax        # ffffffff801170d8 <kpml4>
+ffffffff8010a2dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff8010a2e2:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010a2e7:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a2ea:	e8 50 ca ff ff       	call   ffffffff80106d3f <memset>
+  memset(kpdpt, 0, PGSIZE);
+ffffffff8010a2ef:	48 8b 05 ea cd 00 00 	mov    0xcdea(%rip),%rax        # ffffffff801170e0 <kpdpt>
+ffffffff8010a2f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff8010a2fb:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010a300:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a303:	e8 37 ca ff ff       	call   ffffffff80106d3f <memset>
+  memset(iopgdir, 0, PGSIZE);
+ffffffff8010a308:	48 8b 05 d9 cd 00 00 	mov    0xcdd9(%rip),%rax        # ffffffff801170e8 <iopgdir>
+ffffffff8010a30f:	ba 00 10 00 00       	mov    $0x1000,%edx
+ffffffff8010a314:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010a319:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a31c:	e8 1e ca ff ff       	call   ffffffff80106d3f <memset>
+  kpml4[511] = v2p(kpdpt) | PTE_P | PTE_W;
+ffffffff8010a321:	48 8b 05 b8 cd 00 00 	mov    0xcdb8(%rip),%rax        # ffffffff801170e0 <kpdpt>
+ffffffff8010a328:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a32b:	e8 fc fa ff ff       	call   ffffffff80109e2c <v2p>
+ffffffff8010a330:	48 8b 15 a1 cd 00 00 	mov    0xcda1(%rip),%rdx        # ffffffff801170d8 <kpml4>
+ffffffff8010a337:	48 81 c2 f8 0f 00 00 	add    $0xff8,%rdx
+ffffffff8010a33e:	48 83 c8 03          	or     $0x3,%rax
+ffffffff8010a342:	48 89 02             	mov    %rax,(%rdx)
+  kpdpt[511] = v2p(kpgdir1) | PTE_P | PTE_W;
+ffffffff8010a345:	48 8b 05 ac cd 00 00 	mov    0xcdac(%rip),%rax        # ffffffff801170f8 <kpgdir1>
+ffffffff8010a34c:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a34f:	e8 d8 fa ff ff       	call   ffffffff80109e2c <v2p>
+ffffffff8010a354:	48 8b 15 85 cd 00 00 	mov    0xcd85(%rip),%rdx        # ffffffff801170e0 <kpdpt>
+ffffffff8010a35b:	48 81 c2 f8 0f 00 00 	add    $0xff8,%rdx
+ffffffff8010a362:	48 83 c8 03          	or     $0x3,%rax
+ffffffff8010a366:	48 89 02             	mov    %rax,(%rdx)
+  kpdpt[510] = v2p(kpgdir0) | PTE_P | PTE_W;
+ffffffff8010a369:	48 8b 05 80 cd 00 00 	mov    0xcd80(%rip),%rax        # ffffffff801170f0 <kpgdir0>
+ffffffff8010a370:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a373:	e8 b4 fa ff ff       	call   ffffffff80109e2c <v2p>
+ffffffff8010a378:	48 8b 15 61 cd 00 00 	mov    0xcd61(%rip),%rdx        # ffffffff801170e0 <kpdpt>
+ffffffff8010a37f:	48 81 c2 f0 0f 00 00 	add    $0xff0,%rdx
+ffffffff8010a386:	48 83 c8 03          	or     $0x3,%rax
+ffffffff8010a38a:	48 89 02             	mov    %rax,(%rdx)
+  kpdpt[509] = v2p(iopgdir) | PTE_P | PTE_W;
+ffffffff8010a38d:	48 8b 05 54 cd 00 00 	mov    0xcd54(%rip),%rax        # ffffffff801170e8 <iopgdir>
+ffffffff8010a394:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a397:	e8 90 fa ff ff       	call   ffffffff80109e2c <v2p>
+ffffffff8010a39c:	48 8b 15 3d cd 00 00 	mov    0xcd3d(%rip),%rdx        # ffffffff801170e0 <kpdpt>
+ffffffff8010a3a3:	48 81 c2 e8 0f 00 00 	add    $0xfe8,%rdx
+ffffffff8010a3aa:	48 83 c8 03          	or     $0x3,%rax
+ffffffff8010a3ae:	48 89 02             	mov    %rax,(%rdx)
+  for (n = 0; n < NPDENTRIES; n++) {
+ffffffff8010a3b1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff8010a3b8:	eb 51                	jmp    ffffffff8010a40b <kvmalloc+0x179>
+    kpgdir0[n] = (n << PDXSHIFT) | PTE_PS | PTE_P | PTE_W;
+ffffffff8010a3ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010a3bd:	c1 e0 15             	shl    $0x15,%eax
+ffffffff8010a3c0:	0c 83                	or     $0x83,%al
+ffffffff8010a3c2:	89 c1                	mov    %eax,%ecx
+ffffffff8010a3c4:	48 8b 05 25 cd 00 00 	mov    0xcd25(%rip),%rax        # ffffffff801170f0 <kpgdir0>
+ffffffff8010a3cb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010a3ce:	48 63 d2             	movslq %edx,%rdx
+ffffffff8010a3d1:	48 c1 e2 03          	shl    $0x3,%rdx
+ffffffff8010a3d5:	48 01 c2             	add    %rax,%rdx
+ffffffff8010a3d8:	48 63 c1             	movslq %ecx,%rax
+ffffffff8010a3db:	48 89 02             	mov    %rax,(%rdx)
+    kpgdir1[n] = ((n + 512) << PDXSHIFT) | PTE_PS | PTE_P | PTE_W;
+ffffffff8010a3de:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010a3e1:	05 00 02 00 00       	add    $0x200,%eax
+ffffffff8010a3e6:	c1 e0 15             	shl    $0x15,%eax
+ffffffff8010a3e9:	0c 83                	or     $0x83,%al
+ffffffff8010a3eb:	89 c1                	mov    %eax,%ecx
+ffffffff8010a3ed:	48 8b 05 04 cd 00 00 	mov    0xcd04(%rip),%rax        # ffffffff801170f8 <kpgdir1>
+ffffffff8010a3f4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010a3f7:	48 63 d2             	movslq %edx,%rdx
+ffffffff8010a3fa:	48 c1 e2 03          	shl    $0x3,%rdx
+ffffffff8010a3fe:	48 01 c2             	add    %rax,%rdx
+ffffffff8010a401:	48 63 c1             	movslq %ecx,%rax
+ffffffff8010a404:	48 89 02             	mov    %rax,(%rdx)
+  for (n = 0; n < NPDENTRIES; n++) {
+ffffffff8010a407:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff8010a40b:	81 7d fc ff 01 00 00 	cmpl   $0x1ff,-0x4(%rbp)
+ffffffff8010a412:	7e a6                	jle    ffffffff8010a3ba <kvmalloc+0x128>
+  }
+  for (n = 0; n < 16; n++)
+ffffffff8010a414:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+ffffffff8010a41b:	eb 2c                	jmp    ffffffff8010a449 <kvmalloc+0x1b7>
+    iopgdir[n] = (DEVSPACE + (n << PDXSHIFT)) | PTE_PS | PTE_P | PTE_W | PTE_PWT | PTE_PCD;
+ffffffff8010a41d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+ffffffff8010a420:	c1 e0 15             	shl    $0x15,%eax
+ffffffff8010a423:	2d 00 00 00 02       	sub    $0x2000000,%eax
+ffffffff8010a428:	0c 9b                	or     $0x9b,%al
+ffffffff8010a42a:	89 c1                	mov    %eax,%ecx
+ffffffff8010a42c:	48 8b 05 b5 cc 00 00 	mov    0xccb5(%rip),%rax        # ffffffff801170e8 <iopgdir>
+ffffffff8010a433:	8b 55 fc             	mov    -0x4(%rbp),%edx
+ffffffff8010a436:	48 63 d2             	movslq %edx,%rdx
+ffffffff8010a439:	48 c1 e2 03          	shl    $0x3,%rdx
+ffffffff8010a43d:	48 01 d0             	add    %rdx,%rax
+ffffffff8010a440:	89 ca                	mov    %ecx,%edx
+ffffffff8010a442:	48 89 10             	mov    %rdx,(%rax)
+  for (n = 0; n < 16; n++)
+ffffffff8010a445:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+ffffffff8010a449:	83 7d fc 0f          	cmpl   $0xf,-0x4(%rbp)
+ffffffff8010a44d:	7e ce                	jle    ffffffff8010a41d <kvmalloc+0x18b>
+  switchkvm();
+ffffffff8010a44f:	e8 03 00 00 00       	call   ffffffff8010a457 <switchkvm>
+}
+ffffffff8010a454:	90                   	nop
+ffffffff8010a455:	c9                   	leave
+ffffffff8010a456:	c3                   	ret
+
+ffffffff8010a457 <switchkvm>:
+
+void
+switchkvm(void)
+{
+ffffffff8010a457:	55                   	push   %rbp
+ffffffff8010a458:	48 89 e5             	mov    %rsp,%rbp
+  lcr3(v2p(kpml4));
+ffffffff8010a45b:	48 8b 05 76 cc 00 00 	mov    0xcc76(%rip),%rax        # ffffffff801170d8 <kpml4>
+ffffffff8010a462:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a465:	e8 c2 f9 ff ff       	call   ffffffff80109e2c <v2p>
+ffffffff8010a46a:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a46d:	e8 a4 f9 ff ff       	call   ffffffff80109e16 <lcr3>
+}
+ffffffff8010a472:	90                   	nop
+ffffffff8010a473:	5d                   	pop    %rbp
+ffffffff8010a474:	c3                   	ret
+
+ffffffff8010a475 <switchuvm>:
+
+void
+switchuvm(struct proc *p)
+{
+ffffffff8010a475:	55                   	push   %rbp
+ffffffff8010a476:	48 89 e5             	mov    %rsp,%rbp
+ffffffff8010a479:	48 83 ec 20          	sub    $0x20,%rsp
+ffffffff8010a47d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  void *pml4;
+  uint *tss;
+  pushcli();
+ffffffff8010a481:	e8 7c c7 ff ff       	call   ffffffff80106c02 <pushcli>
+  if(p->pgdir == 0)
+ffffffff8010a486:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a48a:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff8010a48e:	48 85 c0             	test   %rax,%rax
+ffffffff8010a491:	75 0c                	jne    ffffffff8010a49f <switchuvm+0x2a>
+    panic("switchuvm: no pgdir");
+ffffffff8010a493:	48 c7 c7 ee ae 10 80 	mov    $0xffffffff8010aeee,%rdi
+ffffffff8010a49a:	e8 90 64 ff ff       	call   ffffffff8010092f <panic>
+  tss = (uint*) (((char*) cpu->local) + 1024);
+ffffffff8010a49f:	64 48 8b 04 25 f0 ff 	mov    %fs:0xfffffffffffffff0,%rax
+ffffffff8010a4a6:	ff ff 
+ffffffff8010a4a8:	48 8b 80 e8 00 00 00 	mov    0xe8(%rax),%rax
+ffffffff8010a4af:	48 05 00 04 00 00    	add    $0x400,%rax
+ffffffff8010a4b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  tss_set_rsp(tss, 0, (uintp)proc->kstack + KSTACKSIZE);
+ffffffff8010a4b9:	64 48 8b 04 25 f8 ff 	mov    %fs:0xfffffffffffffff8,%rax
+ffffffff8010a4c0:	ff ff 
+ffffffff8010a4c2:	48 8b 40 10          	mov    0x10(%rax),%rax
+ffffffff8010a4c6:	48 8d 90 00 10 00 00 	lea    0x1000(%rax),%rdx
+ffffffff8010a4cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+ffffffff8010a4d1:	be 00 00 00 00       	mov    $0x0,%esi
+ffffffff8010a4d6:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a4d9:	e8 4b fa ff ff       	call   ffffffff80109f29 <tss_set_rsp>
+  pml4 = (void*) PTE_ADDR(p->pgdir[511]);
+ffffffff8010a4de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+ffffffff8010a4e2:	48 8b 40 08          	mov    0x8(%rax),%rax
+ffffffff8010a4e6:	48 05 f8 0f 00 00    	add    $0xff8,%rax
+ffffffff8010a4ec:	48 8b 00             	mov    (%rax),%rax
+ffffffff8010a4ef:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+ffffffff8010a4f5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  lcr3(v2p(pml4));
+ffffffff8010a4f9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+ffffffff8010a4fd:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a500:	e8 27 f9 ff ff       	call   ffffffff80109e2c <v2p>
+ffffffff8010a505:	48 89 c7             	mov    %rax,%rdi
+ffffffff8010a508:	e8 09 f9 ff ff       	call   ffffffff80109e16 <lcr3>
+  popcli();
+ffffffff8010a50d:	e8 40 c7 ff ff       	call   ffffffff80106c52 <popcli>
+}
+ffffffff8010a512:	90                   	nop
+ffffffff8010a513:	c9                   	leave
+ffffffff8010a514:	c3                   	ret
@@ -0,0 +1,899 @@
+
+.fs/kill:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	41 54                	push   %r12
+   6:	53                   	push   %rbx
+  int i;
+
+  if(argc < 2){
+   7:	83 ff 01             	cmp    $0x1,%edi
+   a:	7f 15                	jg     21 <main+0x21>
+    printf(2, "usage: kill pid...\n");
+   c:	48 c7 c6 b0 05 00 00 	mov    $0x5b0,%rsi
+  13:	bf 02 00 00 00       	mov    $0x2,%edi
+  18:	31 c0                	xor    %eax,%eax
+  1a:	e8 92 02 00 00       	call   2b1 <printf>
+    exit();
+  1f:	eb 24                	jmp    45 <main+0x45>
+  21:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  24:	48 8d 5e 08          	lea    0x8(%rsi),%rbx
+  28:	4c 8d 64 c6 10       	lea    0x10(%rsi,%rax,8),%r12
+  }
+  for(i=1; i<argc; i++)
+    kill(atoi(argv[i]));
+  2d:	48 8b 3b             	mov    (%rbx),%rdi
+  for(i=1; i<argc; i++)
+  30:	48 83 c3 08          	add    $0x8,%rbx
+    kill(atoi(argv[i]));
+  34:	e8 12 01 00 00       	call   14b <atoi>
+  39:	89 c7                	mov    %eax,%edi
+  3b:	e8 78 01 00 00       	call   1b8 <kill>
+  for(i=1; i<argc; i++)
+  40:	4c 39 e3             	cmp    %r12,%rbx
+  43:	75 e8                	jne    2d <main+0x2d>
+  exit();
+  45:	e8 3e 01 00 00       	call   188 <exit>
+
+000000000000004a <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  4a:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  4d:	31 d2                	xor    %edx,%edx
+  4f:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+  52:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  55:	48 ff c2             	inc    %rdx
+  58:	84 c9                	test   %cl,%cl
+  5a:	75 f3                	jne    4f <strcpy+0x5>
+    ;
+  return os;
+}
+  5c:	c3                   	ret
+
+000000000000005d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+  5d:	31 c9                	xor    %ecx,%ecx
+  5f:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+  63:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+  67:	84 c0                	test   %al,%al
+  69:	74 07                	je     72 <strcmp+0x15>
+  6b:	48 ff c1             	inc    %rcx
+  6e:	38 d0                	cmp    %dl,%al
+  70:	74 ed                	je     5f <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+  72:	29 d0                	sub    %edx,%eax
+}
+  74:	c3                   	ret
+
+0000000000000075 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+  75:	31 d2                	xor    %edx,%edx
+  77:	48 89 d0             	mov    %rdx,%rax
+  7a:	48 ff c2             	inc    %rdx
+  7d:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  82:	75 f3                	jne    77 <strlen+0x2>
+    ;
+  return n;
+}
+  84:	c3                   	ret
+
+0000000000000085 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  85:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  88:	89 d1                	mov    %edx,%ecx
+  8a:	89 f0                	mov    %esi,%eax
+  8c:	fc                   	cld
+  8d:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+  8f:	4c 89 c0             	mov    %r8,%rax
+  92:	c3                   	ret
+
+0000000000000093 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+  93:	48 89 f8             	mov    %rdi,%rax
+  96:	8a 10                	mov    (%rax),%dl
+  98:	84 d2                	test   %dl,%dl
+  9a:	74 0a                	je     a6 <strchr+0x13>
+    if(*s == c)
+  9c:	40 38 f2             	cmp    %sil,%dl
+  9f:	74 07                	je     a8 <strchr+0x15>
+  for(; *s; s++)
+  a1:	48 ff c0             	inc    %rax
+  a4:	eb f0                	jmp    96 <strchr+0x3>
+      return (char*)s;
+  return 0;
+  a6:	31 c0                	xor    %eax,%eax
+}
+  a8:	c3                   	ret
+
+00000000000000a9 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  a9:	55                   	push   %rbp
+  aa:	48 89 e5             	mov    %rsp,%rbp
+  ad:	41 56                	push   %r14
+  af:	41 89 f6             	mov    %esi,%r14d
+  b2:	41 55                	push   %r13
+  b4:	41 54                	push   %r12
+  b6:	49 89 fc             	mov    %rdi,%r12
+  b9:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  ba:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  bf:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+  c3:	41 89 dd             	mov    %ebx,%r13d
+  c6:	44 39 f3             	cmp    %r14d,%ebx
+  c9:	7d 29                	jge    f4 <gets+0x4b>
+    cc = read(0, &c, 1);
+  cb:	31 ff                	xor    %edi,%edi
+  cd:	ba 01 00 00 00       	mov    $0x1,%edx
+  d2:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+  d6:	e8 c5 00 00 00       	call   1a0 <read>
+    if(cc < 1)
+  db:	85 c0                	test   %eax,%eax
+  dd:	7e 15                	jle    f4 <gets+0x4b>
+      break;
+    buf[i++] = c;
+  df:	8a 45 df             	mov    -0x21(%rbp),%al
+  e2:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+  e7:	48 ff c3             	inc    %rbx
+  ea:	3c 0a                	cmp    $0xa,%al
+  ec:	74 0a                	je     f8 <gets+0x4f>
+  ee:	3c 0d                	cmp    $0xd,%al
+  f0:	75 d1                	jne    c3 <gets+0x1a>
+  f2:	eb 04                	jmp    f8 <gets+0x4f>
+  f4:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+  f8:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+  fb:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+  fe:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 103:	5a                   	pop    %rdx
+ 104:	59                   	pop    %rcx
+ 105:	5b                   	pop    %rbx
+ 106:	41 5c                	pop    %r12
+ 108:	41 5d                	pop    %r13
+ 10a:	41 5e                	pop    %r14
+ 10c:	5d                   	pop    %rbp
+ 10d:	c3                   	ret
+
+000000000000010e <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 10e:	55                   	push   %rbp
+ 10f:	48 89 e5             	mov    %rsp,%rbp
+ 112:	41 55                	push   %r13
+ 114:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 117:	31 f6                	xor    %esi,%esi
+{
+ 119:	41 54                	push   %r12
+ 11b:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 11f:	53                   	push   %rbx
+ 120:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 121:	e8 a2 00 00 00       	call   1c8 <open>
+  if(fd < 0)
+ 126:	85 c0                	test   %eax,%eax
+ 128:	78 16                	js     140 <stat+0x32>
+ 12a:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 12c:	89 c7                	mov    %eax,%edi
+ 12e:	4c 89 ee             	mov    %r13,%rsi
+ 131:	e8 aa 00 00 00       	call   1e0 <fstat>
+  close(fd);
+ 136:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 138:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 13b:	e8 70 00 00 00       	call   1b0 <close>
+  return r;
+}
+ 140:	5a                   	pop    %rdx
+ 141:	44 89 e0             	mov    %r12d,%eax
+ 144:	5b                   	pop    %rbx
+ 145:	41 5c                	pop    %r12
+ 147:	41 5d                	pop    %r13
+ 149:	5d                   	pop    %rbp
+ 14a:	c3                   	ret
+
+000000000000014b <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 14b:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 14d:	0f be 17             	movsbl (%rdi),%edx
+ 150:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 153:	80 f9 09             	cmp    $0x9,%cl
+ 156:	77 0c                	ja     164 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 158:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 15b:	48 ff c7             	inc    %rdi
+ 15e:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 162:	eb e9                	jmp    14d <atoi+0x2>
+  return n;
+}
+ 164:	c3                   	ret
+
+0000000000000165 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 165:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 168:	31 c9                	xor    %ecx,%ecx
+ 16a:	89 d7                	mov    %edx,%edi
+ 16c:	29 cf                	sub    %ecx,%edi
+ 16e:	85 ff                	test   %edi,%edi
+ 170:	7e 0d                	jle    17f <memmove+0x1a>
+    *dst++ = *src++;
+ 172:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 176:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 17a:	48 ff c1             	inc    %rcx
+ 17d:	eb eb                	jmp    16a <memmove+0x5>
+  return vdst;
+}
+ 17f:	c3                   	ret
+
+0000000000000180 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 180:	b8 01 00 00 00       	mov    $0x1,%eax
+ 185:	cd 40                	int    $0x40
+ 187:	c3                   	ret
+
+0000000000000188 <exit>:
+SYSCALL(exit)
+ 188:	b8 02 00 00 00       	mov    $0x2,%eax
+ 18d:	cd 40                	int    $0x40
+ 18f:	c3                   	ret
+
+0000000000000190 <wait>:
+SYSCALL(wait)
+ 190:	b8 03 00 00 00       	mov    $0x3,%eax
+ 195:	cd 40                	int    $0x40
+ 197:	c3                   	ret
+
+0000000000000198 <pipe>:
+SYSCALL(pipe)
+ 198:	b8 04 00 00 00       	mov    $0x4,%eax
+ 19d:	cd 40                	int    $0x40
+ 19f:	c3                   	ret
+
+00000000000001a0 <read>:
+SYSCALL(read)
+ 1a0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 1a5:	cd 40                	int    $0x40
+ 1a7:	c3                   	ret
+
+00000000000001a8 <write>:
+SYSCALL(write)
+ 1a8:	b8 10 00 00 00       	mov    $0x10,%eax
+ 1ad:	cd 40                	int    $0x40
+ 1af:	c3                   	ret
+
+00000000000001b0 <close>:
+SYSCALL(close)
+ 1b0:	b8 15 00 00 00       	mov    $0x15,%eax
+ 1b5:	cd 40                	int    $0x40
+ 1b7:	c3                   	ret
+
+00000000000001b8 <kill>:
+SYSCALL(kill)
+ 1b8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 1bd:	cd 40                	int    $0x40
+ 1bf:	c3                   	ret
+
+00000000000001c0 <exec>:
+SYSCALL(exec)
+ 1c0:	b8 07 00 00 00       	mov    $0x7,%eax
+ 1c5:	cd 40                	int    $0x40
+ 1c7:	c3                   	ret
+
+00000000000001c8 <open>:
+SYSCALL(open)
+ 1c8:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 1cd:	cd 40                	int    $0x40
+ 1cf:	c3                   	ret
+
+00000000000001d0 <mknod>:
+SYSCALL(mknod)
+ 1d0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 1d5:	cd 40                	int    $0x40
+ 1d7:	c3                   	ret
+
+00000000000001d8 <unlink>:
+SYSCALL(unlink)
+ 1d8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 1dd:	cd 40                	int    $0x40
+ 1df:	c3                   	ret
+
+00000000000001e0 <fstat>:
+SYSCALL(fstat)
+ 1e0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 1e5:	cd 40                	int    $0x40
+ 1e7:	c3                   	ret
+
+00000000000001e8 <link>:
+SYSCALL(link)
+ 1e8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 1ed:	cd 40                	int    $0x40
+ 1ef:	c3                   	ret
+
+00000000000001f0 <mkdir>:
+SYSCALL(mkdir)
+ 1f0:	b8 14 00 00 00       	mov    $0x14,%eax
+ 1f5:	cd 40                	int    $0x40
+ 1f7:	c3                   	ret
+
+00000000000001f8 <chdir>:
+SYSCALL(chdir)
+ 1f8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 1fd:	cd 40                	int    $0x40
+ 1ff:	c3                   	ret
+
+0000000000000200 <dup>:
+SYSCALL(dup)
+ 200:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 205:	cd 40                	int    $0x40
+ 207:	c3                   	ret
+
+0000000000000208 <getpid>:
+SYSCALL(getpid)
+ 208:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 20d:	cd 40                	int    $0x40
+ 20f:	c3                   	ret
+
+0000000000000210 <sbrk>:
+SYSCALL(sbrk)
+ 210:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 215:	cd 40                	int    $0x40
+ 217:	c3                   	ret
+
+0000000000000218 <sleep>:
+SYSCALL(sleep)
+ 218:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 21d:	cd 40                	int    $0x40
+ 21f:	c3                   	ret
+
+0000000000000220 <uptime>:
+SYSCALL(uptime)
+ 220:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 225:	cd 40                	int    $0x40
+ 227:	c3                   	ret
+
+0000000000000228 <chmod>:
+SYSCALL(chmod)
+ 228:	b8 16 00 00 00       	mov    $0x16,%eax
+ 22d:	cd 40                	int    $0x40
+ 22f:	c3                   	ret
+
+0000000000000230 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 230:	55                   	push   %rbp
+ 231:	48 89 e5             	mov    %rsp,%rbp
+ 234:	41 54                	push   %r12
+ 236:	41 89 fc             	mov    %edi,%r12d
+ 239:	89 d7                	mov    %edx,%edi
+ 23b:	53                   	push   %rbx
+ 23c:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 240:	85 f6                	test   %esi,%esi
+ 242:	79 0f                	jns    253 <printint+0x23>
+ 244:	80 e1 01             	and    $0x1,%cl
+ 247:	74 0a                	je     253 <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 249:	f7 de                	neg    %esi
+    neg = 1;
+ 24b:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 251:	eb 03                	jmp    256 <printint+0x26>
+  neg = 0;
+ 253:	45 31 c0             	xor    %r8d,%r8d
+ 256:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 258:	89 f0                	mov    %esi,%eax
+ 25a:	31 d2                	xor    %edx,%edx
+ 25c:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 25f:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 262:	f7 f7                	div    %edi
+ 264:	8a 92 d0 05 00 00    	mov    0x5d0(%rdx),%dl
+ 26a:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 26e:	89 f2                	mov    %esi,%edx
+ 270:	89 c6                	mov    %eax,%esi
+ 272:	39 fa                	cmp    %edi,%edx
+ 274:	73 e2                	jae    258 <printint+0x28>
+  if(neg)
+ 276:	45 85 c0             	test   %r8d,%r8d
+ 279:	74 0a                	je     285 <printint+0x55>
+    buf[i++] = digits[x % base];
+ 27b:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 27d:	48 63 c3             	movslq %ebx,%rax
+ 280:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 285:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 288:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 28c:	ba 01 00 00 00       	mov    $0x1,%edx
+ 291:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 295:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 298:	48 ff cb             	dec    %rbx
+ 29b:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 29e:	e8 05 ff ff ff       	call   1a8 <write>
+  while(--i >= 0)
+ 2a3:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 2a6:	75 e0                	jne    288 <printint+0x58>
+}
+ 2a8:	48 83 c4 20          	add    $0x20,%rsp
+ 2ac:	5b                   	pop    %rbx
+ 2ad:	41 5c                	pop    %r12
+ 2af:	5d                   	pop    %rbp
+ 2b0:	c3                   	ret
+
+00000000000002b1 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 2b1:	55                   	push   %rbp
+ 2b2:	48 89 e5             	mov    %rsp,%rbp
+ 2b5:	41 55                	push   %r13
+ 2b7:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 2b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 2bd:	53                   	push   %rbx
+ 2be:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 2c2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 2c6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 2ca:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 2ce:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 2d2:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 2d6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 2da:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 2de:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 2e0:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 2e7:	84 c0                	test   %al,%al
+ 2e9:	0f 84 6f 01 00 00    	je     45e <printf+0x1ad>
+ 2ef:	89 fb                	mov    %edi,%ebx
+ 2f1:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 2f4:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 2f7:	83 fa 25             	cmp    $0x25,%edx
+ 2fa:	75 44                	jne    340 <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 2fc:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 301:	49 ff c4             	inc    %r12
+ 304:	45 84 ed             	test   %r13b,%r13b
+ 307:	0f 84 51 01 00 00    	je     45e <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 30d:	41 0f b6 c5          	movzbl %r13b,%eax
+ 311:	41 0f be d5          	movsbl %r13b,%edx
+ 315:	83 f8 64             	cmp    $0x64,%eax
+ 318:	74 7c                	je     396 <printf+0xe5>
+ 31a:	7f 29                	jg     345 <printf+0x94>
+ 31c:	83 f8 25             	cmp    $0x25,%eax
+ 31f:	74 4c                	je     36d <printf+0xbc>
+ 321:	83 f8 63             	cmp    $0x63,%eax
+ 324:	75 33                	jne    359 <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 326:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 329:	83 fa 2f             	cmp    $0x2f,%edx
+ 32c:	0f 87 1b 01 00 00    	ja     44d <printf+0x19c>
+ 332:	89 d0                	mov    %edx,%eax
+ 334:	83 c2 08             	add    $0x8,%edx
+ 337:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 33b:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 33e:	8b 00                	mov    (%rax),%eax
+ 340:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 343:	eb 2c                	jmp    371 <printf+0xc0>
+ 345:	83 f8 73             	cmp    $0x73,%eax
+ 348:	0f 84 aa 00 00 00    	je     3f8 <printf+0x147>
+ 34e:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 354:	83 fa 70             	cmp    $0x70,%edx
+ 357:	74 6b                	je     3c4 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 359:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 35d:	ba 01 00 00 00       	mov    $0x1,%edx
+ 362:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 366:	89 df                	mov    %ebx,%edi
+ 368:	e8 3b fe ff ff       	call   1a8 <write>
+        putc(fd, c);
+ 36d:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 371:	ba 01 00 00 00       	mov    $0x1,%edx
+ 376:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 37a:	89 df                	mov    %ebx,%edi
+ 37c:	e8 27 fe ff ff       	call   1a8 <write>
+  for(i = 0; fmt[i]; i++){
+ 381:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 386:	49 ff c4             	inc    %r12
+ 389:	84 c0                	test   %al,%al
+ 38b:	0f 85 63 ff ff ff    	jne    2f4 <printf+0x43>
+ 391:	e9 c8 00 00 00       	jmp    45e <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 396:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 399:	83 fa 2f             	cmp    $0x2f,%edx
+ 39c:	77 0e                	ja     3ac <printf+0xfb>
+ 39e:	89 d0                	mov    %edx,%eax
+ 3a0:	83 c2 08             	add    $0x8,%edx
+ 3a3:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3a7:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3aa:	eb 0c                	jmp    3b8 <printf+0x107>
+ 3ac:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3b0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3b4:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3b8:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3bd:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3c2:	eb 29                	jmp    3ed <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 3c4:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3c7:	83 fa 2f             	cmp    $0x2f,%edx
+ 3ca:	77 0e                	ja     3da <printf+0x129>
+ 3cc:	89 d0                	mov    %edx,%eax
+ 3ce:	83 c2 08             	add    $0x8,%edx
+ 3d1:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3d5:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3d8:	eb 0c                	jmp    3e6 <printf+0x135>
+ 3da:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3de:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3e2:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3e6:	31 c9                	xor    %ecx,%ecx
+ 3e8:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3ed:	8b 30                	mov    (%rax),%esi
+ 3ef:	89 df                	mov    %ebx,%edi
+ 3f1:	e8 3a fe ff ff       	call   230 <printint>
+ 3f6:	eb 89                	jmp    381 <printf+0xd0>
+        s = va_arg(ap, char*);
+ 3f8:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3fb:	83 fa 2f             	cmp    $0x2f,%edx
+ 3fe:	77 0e                	ja     40e <printf+0x15d>
+ 400:	89 d0                	mov    %edx,%eax
+ 402:	83 c2 08             	add    $0x8,%edx
+ 405:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 409:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 40c:	eb 0c                	jmp    41a <printf+0x169>
+ 40e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 412:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 416:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 41a:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 41d:	4d 85 ed             	test   %r13,%r13
+ 420:	75 07                	jne    429 <printf+0x178>
+          s = "(null)";
+ 422:	49 c7 c5 c4 05 00 00 	mov    $0x5c4,%r13
+        while(*s != 0){
+ 429:	41 8a 45 00          	mov    0x0(%r13),%al
+ 42d:	84 c0                	test   %al,%al
+ 42f:	0f 84 4c ff ff ff    	je     381 <printf+0xd0>
+          putc(fd, *s);
+ 435:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 438:	ba 01 00 00 00       	mov    $0x1,%edx
+ 43d:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 441:	89 df                	mov    %ebx,%edi
+          s++;
+ 443:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 446:	e8 5d fd ff ff       	call   1a8 <write>
+          s++;
+ 44b:	eb dc                	jmp    429 <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 44d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 451:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 455:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 459:	e9 e0 fe ff ff       	jmp    33e <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 45e:	48 83 c4 58          	add    $0x58,%rsp
+ 462:	5b                   	pop    %rbx
+ 463:	41 5c                	pop    %r12
+ 465:	41 5d                	pop    %r13
+ 467:	5d                   	pop    %rbp
+ 468:	c3                   	ret
+
+0000000000000469 <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 469:	48 8b 05 40 03 00 00 	mov    0x340(%rip),%rax        # 7b0 <freep>
+{
+ 470:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 473:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 477:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 47a:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 47d:	48 39 f2             	cmp    %rsi,%rdx
+ 480:	72 0c                	jb     48e <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 482:	48 39 c6             	cmp    %rax,%rsi
+ 485:	73 f0                	jae    477 <free+0xe>
+ 487:	48 39 c2             	cmp    %rax,%rdx
+ 48a:	72 eb                	jb     477 <free+0xe>
+ 48c:	eb 05                	jmp    493 <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 48e:	48 39 c6             	cmp    %rax,%rsi
+ 491:	73 f4                	jae    487 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 493:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 496:	49 89 f8             	mov    %rdi,%r8
+ 499:	48 c1 e7 04          	shl    $0x4,%rdi
+ 49d:	48 01 f7             	add    %rsi,%rdi
+ 4a0:	48 39 f8             	cmp    %rdi,%rax
+ 4a3:	75 0e                	jne    4b3 <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 4a5:	44 03 40 08          	add    0x8(%rax),%r8d
+ 4a9:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 4ad:	48 8b 02             	mov    (%rdx),%rax
+ 4b0:	48 8b 00             	mov    (%rax),%rax
+ 4b3:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 4b7:	8b 42 08             	mov    0x8(%rdx),%eax
+ 4ba:	48 89 c7             	mov    %rax,%rdi
+ 4bd:	48 c1 e0 04          	shl    $0x4,%rax
+ 4c1:	48 01 d0             	add    %rdx,%rax
+ 4c4:	48 39 c6             	cmp    %rax,%rsi
+ 4c7:	75 0a                	jne    4d3 <free+0x6a>
+    p->s.size += bp->s.size;
+ 4c9:	03 79 f8             	add    -0x8(%rcx),%edi
+ 4cc:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 4cf:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 4d3:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 4d6:	48 89 15 d3 02 00 00 	mov    %rdx,0x2d3(%rip)        # 7b0 <freep>
+}
+ 4dd:	c3                   	ret
+
+00000000000004de <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 4de:	55                   	push   %rbp
+ 4df:	48 89 e5             	mov    %rsp,%rbp
+ 4e2:	41 55                	push   %r13
+ 4e4:	41 54                	push   %r12
+ 4e6:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4e7:	89 fb                	mov    %edi,%ebx
+{
+ 4e9:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4ea:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 4ee:	48 8b 0d bb 02 00 00 	mov    0x2bb(%rip),%rcx        # 7b0 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4f5:	48 c1 eb 04          	shr    $0x4,%rbx
+ 4f9:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 4fb:	48 85 c9             	test   %rcx,%rcx
+ 4fe:	75 25                	jne    525 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 500:	48 c7 05 a5 02 00 00 	movq   $0x7c0,0x2a5(%rip)        # 7b0 <freep>
+ 507:	c0 07 00 00 
+    base.s.size = 0;
+ 50b:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 50d:	48 c7 05 a8 02 00 00 	movq   $0x7c0,0x2a8(%rip)        # 7c0 <base>
+ 514:	c0 07 00 00 
+    base.s.size = 0;
+ 518:	89 0d aa 02 00 00    	mov    %ecx,0x2aa(%rip)        # 7c8 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 51e:	48 c7 c1 c0 07 00 00 	mov    $0x7c0,%rcx
+  if(nu < 4096)
+ 525:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 52b:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 52e:	44 39 e3             	cmp    %r12d,%ebx
+ 531:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 535:	45 89 e5             	mov    %r12d,%r13d
+ 538:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 53c:	8b 50 08             	mov    0x8(%rax),%edx
+ 53f:	39 da                	cmp    %ebx,%edx
+ 541:	72 26                	jb     569 <malloc+0x8b>
+      if(p->s.size == nunits)
+ 543:	75 08                	jne    54d <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 545:	48 8b 10             	mov    (%rax),%rdx
+ 548:	48 89 11             	mov    %rdx,(%rcx)
+ 54b:	eb 0f                	jmp    55c <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 54d:	29 da                	sub    %ebx,%edx
+ 54f:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 552:	48 c1 e2 04          	shl    $0x4,%rdx
+ 556:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 559:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 55c:	48 89 0d 4d 02 00 00 	mov    %rcx,0x24d(%rip)        # 7b0 <freep>
+      return (void*)(p + 1);
+ 563:	48 83 c0 10          	add    $0x10,%rax
+ 567:	eb 3a                	jmp    5a3 <malloc+0xc5>
+    }
+    if(p == freep)
+ 569:	48 39 05 40 02 00 00 	cmp    %rax,0x240(%rip)        # 7b0 <freep>
+ 570:	75 27                	jne    599 <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 572:	44 89 ef             	mov    %r13d,%edi
+ 575:	e8 96 fc ff ff       	call   210 <sbrk>
+  if(p == (char*)-1)
+ 57a:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 57e:	74 21                	je     5a1 <malloc+0xc3>
+  hp->s.size = nu;
+ 580:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 584:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 588:	e8 dc fe ff ff       	call   469 <free>
+  return freep;
+ 58d:	48 8b 05 1c 02 00 00 	mov    0x21c(%rip),%rax        # 7b0 <freep>
+      if((p = morecore(nunits)) == 0)
+ 594:	48 85 c0             	test   %rax,%rax
+ 597:	74 08                	je     5a1 <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 599:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 59c:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 59f:	eb 9b                	jmp    53c <malloc+0x5e>
+        return 0;
+ 5a1:	31 c0                	xor    %eax,%eax
+  }
+}
+ 5a3:	5a                   	pop    %rdx
+ 5a4:	5b                   	pop    %rbx
+ 5a5:	41 5c                	pop    %r12
+ 5a7:	41 5d                	pop    %r13
+ 5a9:	5d                   	pop    %rbp
+ 5aa:	c3                   	ret
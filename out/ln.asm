@@ -0,0 +1,896 @@
+
+.fs/ln:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	53                   	push   %rbx
+   5:	50                   	push   %rax
+  if(argc != 3){
+   6:	83 ff 03             	cmp    $0x3,%edi
+   9:	74 15                	je     20 <main+0x20>
+    printf(2, "Usage: ln old new\n");
+   b:	48 c7 c6 c0 05 00 00 	mov    $0x5c0,%rsi
+  12:	bf 02 00 00 00       	mov    $0x2,%edi
+  17:	31 c0                	xor    %eax,%eax
+  19:	e8 9d 02 00 00       	call   2bb <printf>
+    exit();
+  1e:	eb 2f                	jmp    4f <main+0x4f>
+  20:	48 89 f3             	mov    %rsi,%rbx
+  }
+  if(link(argv[1], argv[2]) < 0)
+  23:	48 8b 76 10          	mov    0x10(%rsi),%rsi
+  27:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+  2b:	e8 c2 01 00 00       	call   1f2 <link>
+  30:	85 c0                	test   %eax,%eax
+  32:	79 1b                	jns    4f <main+0x4f>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  34:	48 8b 4b 10          	mov    0x10(%rbx),%rcx
+  38:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  3c:	bf 02 00 00 00       	mov    $0x2,%edi
+  41:	31 c0                	xor    %eax,%eax
+  43:	48 c7 c6 d3 05 00 00 	mov    $0x5d3,%rsi
+  4a:	e8 6c 02 00 00       	call   2bb <printf>
+  exit();
+  4f:	e8 3e 01 00 00       	call   192 <exit>
+
+0000000000000054 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  54:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  57:	31 d2                	xor    %edx,%edx
+  59:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+  5c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  5f:	48 ff c2             	inc    %rdx
+  62:	84 c9                	test   %cl,%cl
+  64:	75 f3                	jne    59 <strcpy+0x5>
+    ;
+  return os;
+}
+  66:	c3                   	ret
+
+0000000000000067 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+  67:	31 c9                	xor    %ecx,%ecx
+  69:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+  6d:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+  71:	84 c0                	test   %al,%al
+  73:	74 07                	je     7c <strcmp+0x15>
+  75:	48 ff c1             	inc    %rcx
+  78:	38 d0                	cmp    %dl,%al
+  7a:	74 ed                	je     69 <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+  7c:	29 d0                	sub    %edx,%eax
+}
+  7e:	c3                   	ret
+
+000000000000007f <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+  7f:	31 d2                	xor    %edx,%edx
+  81:	48 89 d0             	mov    %rdx,%rax
+  84:	48 ff c2             	inc    %rdx
+  87:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  8c:	75 f3                	jne    81 <strlen+0x2>
+    ;
+  return n;
+}
+  8e:	c3                   	ret
+
+000000000000008f <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  8f:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  92:	89 d1                	mov    %edx,%ecx
+  94:	89 f0                	mov    %esi,%eax
+  96:	fc                   	cld
+  97:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+  99:	4c 89 c0             	mov    %r8,%rax
+  9c:	c3                   	ret
+
+000000000000009d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+  9d:	48 89 f8             	mov    %rdi,%rax
+  a0:	8a 10                	mov    (%rax),%dl
+  a2:	84 d2                	test   %dl,%dl
+  a4:	74 0a                	je     b0 <strchr+0x13>
+    if(*s == c)
+  a6:	40 38 f2             	cmp    %sil,%dl
+  a9:	74 07                	je     b2 <strchr+0x15>
+  for(; *s; s++)
+  ab:	48 ff c0             	inc    %rax
+  ae:	eb f0                	jmp    a0 <strchr+0x3>
+      return (char*)s;
+  return 0;
+  b0:	31 c0                	xor    %eax,%eax
+}
+  b2:	c3                   	ret
+
+00000000000000b3 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  b3:	55                   	push   %rbp
+  b4:	48 89 e5             	mov    %rsp,%rbp
+  b7:	41 56                	push   %r14
+  b9:	41 89 f6             	mov    %esi,%r14d
+  bc:	41 55                	push   %r13
+  be:	41 54                	push   %r12
+  c0:	49 89 fc             	mov    %rdi,%r12
+  c3:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  c4:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  c9:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+  cd:	41 89 dd             	mov    %ebx,%r13d
+  d0:	44 39 f3             	cmp    %r14d,%ebx
+  d3:	7d 29                	jge    fe <gets+0x4b>
+    cc = read(0, &c, 1);
+  d5:	31 ff                	xor    %edi,%edi
+  d7:	ba 01 00 00 00       	mov    $0x1,%edx
+  dc:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+  e0:	e8 c5 00 00 00       	call   1aa <read>
+    if(cc < 1)
+  e5:	85 c0                	test   %eax,%eax
+  e7:	7e 15                	jle    fe <gets+0x4b>
+      break;
+    buf[i++] = c;
+  e9:	8a 45 df             	mov    -0x21(%rbp),%al
+  ec:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+  f1:	48 ff c3             	inc    %rbx
+  f4:	3c 0a                	cmp    $0xa,%al
+  f6:	74 0a                	je     102 <gets+0x4f>
+  f8:	3c 0d                	cmp    $0xd,%al
+  fa:	75 d1                	jne    cd <gets+0x1a>
+  fc:	eb 04                	jmp    102 <gets+0x4f>
+  fe:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 102:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 105:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 108:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 10d:	5a                   	pop    %rdx
+ 10e:	59                   	pop    %rcx
+ 10f:	5b                   	pop    %rbx
+ 110:	41 5c                	pop    %r12
+ 112:	41 5d                	pop    %r13
+ 114:	41 5e                	pop    %r14
+ 116:	5d                   	pop    %rbp
+ 117:	c3                   	ret
+
+0000000000000118 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 118:	55                   	push   %rbp
+ 119:	48 89 e5             	mov    %rsp,%rbp
+ 11c:	41 55                	push   %r13
+ 11e:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 121:	31 f6                	xor    %esi,%esi
+{
+ 123:	41 54                	push   %r12
+ 125:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 129:	53                   	push   %rbx
+ 12a:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 12b:	e8 a2 00 00 00       	call   1d2 <open>
+  if(fd < 0)
+ 130:	85 c0                	test   %eax,%eax
+ 132:	78 16                	js     14a <stat+0x32>
+ 134:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 136:	89 c7                	mov    %eax,%edi
+ 138:	4c 89 ee             	mov    %r13,%rsi
+ 13b:	e8 aa 00 00 00       	call   1ea <fstat>
+  close(fd);
+ 140:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 142:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 145:	e8 70 00 00 00       	call   1ba <close>
+  return r;
+}
+ 14a:	5a                   	pop    %rdx
+ 14b:	44 89 e0             	mov    %r12d,%eax
+ 14e:	5b                   	pop    %rbx
+ 14f:	41 5c                	pop    %r12
+ 151:	41 5d                	pop    %r13
+ 153:	5d                   	pop    %rbp
+ 154:	c3                   	ret
+
+0000000000000155 <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 155:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 157:	0f be 17             	movsbl (%rdi),%edx
+ 15a:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 15d:	80 f9 09             	cmp    $0x9,%cl
+ 160:	77 0c                	ja     16e <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 162:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 165:	48 ff c7             	inc    %rdi
+ 168:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 16c:	eb e9                	jmp    157 <atoi+0x2>
+  return n;
+}
+ 16e:	c3                   	ret
+
+000000000000016f <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 16f:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 172:	31 c9                	xor    %ecx,%ecx
+ 174:	89 d7                	mov    %edx,%edi
+ 176:	29 cf                	sub    %ecx,%edi
+ 178:	85 ff                	test   %edi,%edi
+ 17a:	7e 0d                	jle    189 <memmove+0x1a>
+    *dst++ = *src++;
+ 17c:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 180:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 184:	48 ff c1             	inc    %rcx
+ 187:	eb eb                	jmp    174 <memmove+0x5>
+  return vdst;
+}
+ 189:	c3                   	ret
+
+000000000000018a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 18a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 18f:	cd 40                	int    $0x40
+ 191:	c3                   	ret
+
+0000000000000192 <exit>:
+SYSCALL(exit)
+ 192:	b8 02 00 00 00       	mov    $0x2,%eax
+ 197:	cd 40                	int    $0x40
+ 199:	c3                   	ret
+
+000000000000019a <wait>:
+SYSCALL(wait)
+ 19a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 19f:	cd 40                	int    $0x40
+ 1a1:	c3                   	ret
+
+00000000000001a2 <pipe>:
+SYSCALL(pipe)
+ 1a2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 1a7:	cd 40                	int    $0x40
+ 1a9:	c3                   	ret
+
+00000000000001aa <read>:
+SYSCALL(read)
+ 1aa:	b8 05 00 00 00       	mov    $0x5,%eax
+ 1af:	cd 40                	int    $0x40
+ 1b1:	c3                   	ret
+
+00000000000001b2 <write>:
+SYSCALL(write)
+ 1b2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 1b7:	cd 40                	int    $0x40
+ 1b9:	c3                   	ret
+
+00000000000001ba <close>:
+SYSCALL(close)
+ 1ba:	b8 15 00 00 00       	mov    $0x15,%eax
+ 1bf:	cd 40                	int    $0x40
+ 1c1:	c3                   	ret
+
+00000000000001c2 <kill>:
+SYSCALL(kill)
+ 1c2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 1c7:	cd 40                	int    $0x40
+ 1c9:	c3                   	ret
+
+00000000000001ca <exec>:
+SYSCALL(exec)
+ 1ca:	b8 07 00 00 00       	mov    $0x7,%eax
+ 1cf:	cd 40                	int    $0x40
+ 1d1:	c3                   	ret
+
+00000000000001d2 <open>:
+SYSCALL(open)
+ 1d2:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 1d7:	cd 40                	int    $0x40
+ 1d9:	c3                   	ret
+
+00000000000001da <mknod>:
+SYSCALL(mknod)
+ 1da:	b8 11 00 00 00       	mov    $0x11,%eax
+ 1df:	cd 40                	int    $0x40
+ 1e1:	c3                   	ret
+
+00000000000001e2 <unlink>:
+SYSCALL(unlink)
+ 1e2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 1e7:	cd 40                	int    $0x40
+ 1e9:	c3                   	ret
+
+00000000000001ea <fstat>:
+SYSCALL(fstat)
+ 1ea:	b8 08 00 00 00       	mov    $0x8,%eax
+ 1ef:	cd 40                	int    $0x40
+ 1f1:	c3                   	ret
+
+00000000000001f2 <link>:
+SYSCALL(link)
+ 1f2:	b8 13 00 00 00       	mov    $0x13,%eax
+ 1f7:	cd 40                	int    $0x40
+ 1f9:	c3                   	ret
+
+00000000000001fa <mkdir>:
+SYSCALL(mkdir)
+ 1fa:	b8 14 00 00 00       	mov    $0x14,%eax
+ 1ff:	cd 40                	int    $0x40
+ 201:	c3                   	ret
+
+0000000000000202 <chdir>:
+SYSCALL(chdir)
+ 202:	b8 09 00 00 00       	mov    $0x9,%eax
+ 207:	cd 40                	int    $0x40
+ 209:	c3                   	ret
+
+000000000000020a <dup>:
+SYSCALL(dup)
+ 20a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 20f:	cd 40                	int    $0x40
+ 211:	c3                   	ret
+
+0000000000000212 <getpid>:
+SYSCALL(getpid)
+ 212:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 217:	cd 40                	int    $0x40
+ 219:	c3                   	ret
+
+000000000000021a <sbrk>:
+SYSCALL(sbrk)
+ 21a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 21f:	cd 40                	int    $0x40
+ 221:	c3                   	ret
+
+0000000000000222 <sleep>:
+SYSCALL(sleep)
+ 222:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 227:	cd 40                	int    $0x40
+ 229:	c3                   	ret
+
+000000000000022a <uptime>:
+SYSCALL(uptime)
+ 22a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 22f:	cd 40                	int    $0x40
+ 231:	c3                   	ret
+
+0000000000000232 <chmod>:
+SYSCALL(chmod)
+ 232:	b8 16 00 00 00       	mov    $0x16,%eax
+ 237:	cd 40                	int    $0x40
+ 239:	c3                   	ret
+
+000000000000023a <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 23a:	55                   	push   %rbp
+ 23b:	48 89 e5             	mov    %rsp,%rbp
+ 23e:	41 54                	push   %r12
+ 240:	41 89 fc             	mov    %edi,%r12d
+ 243:	89 d7                	mov    %edx,%edi
+ 245:	53                   	push   %rbx
+ 246:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 24a:	85 f6                	test   %esi,%esi
+ 24c:	79 0f                	jns    25d <printint+0x23>
+ 24e:	80 e1 01             	and    $0x1,%cl
+ 251:	74 0a                	je     25d <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 253:	f7 de                	neg    %esi
+    neg = 1;
+ 255:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 25b:	eb 03                	jmp    260 <printint+0x26>
+  neg = 0;
+ 25d:	45 31 c0             	xor    %r8d,%r8d
+ 260:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 262:	89 f0                	mov    %esi,%eax
+ 264:	31 d2                	xor    %edx,%edx
+ 266:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 269:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 26c:	f7 f7                	div    %edi
+ 26e:	8a 92 f0 05 00 00    	mov    0x5f0(%rdx),%dl
+ 274:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 278:	89 f2                	mov    %esi,%edx
+ 27a:	89 c6                	mov    %eax,%esi
+ 27c:	39 fa                	cmp    %edi,%edx
+ 27e:	73 e2                	jae    262 <printint+0x28>
+  if(neg)
+ 280:	45 85 c0             	test   %r8d,%r8d
+ 283:	74 0a                	je     28f <printint+0x55>
+    buf[i++] = digits[x % base];
+ 285:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 287:	48 63 c3             	movslq %ebx,%rax
+ 28a:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 28f:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 292:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 296:	ba 01 00 00 00       	mov    $0x1,%edx
+ 29b:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 29f:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 2a2:	48 ff cb             	dec    %rbx
+ 2a5:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 2a8:	e8 05 ff ff ff       	call   1b2 <write>
+  while(--i >= 0)
+ 2ad:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 2b0:	75 e0                	jne    292 <printint+0x58>
+}
+ 2b2:	48 83 c4 20          	add    $0x20,%rsp
+ 2b6:	5b                   	pop    %rbx
+ 2b7:	41 5c                	pop    %r12
+ 2b9:	5d                   	pop    %rbp
+ 2ba:	c3                   	ret
+
+00000000000002bb <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 2bb:	55                   	push   %rbp
+ 2bc:	48 89 e5             	mov    %rsp,%rbp
+ 2bf:	41 55                	push   %r13
+ 2c1:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 2c3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 2c7:	53                   	push   %rbx
+ 2c8:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 2cc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 2d0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 2d4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 2d8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 2dc:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 2e0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 2e4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 2e8:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 2ea:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 2f1:	84 c0                	test   %al,%al
+ 2f3:	0f 84 6f 01 00 00    	je     468 <printf+0x1ad>
+ 2f9:	89 fb                	mov    %edi,%ebx
+ 2fb:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 2fe:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 301:	83 fa 25             	cmp    $0x25,%edx
+ 304:	75 44                	jne    34a <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 306:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 30b:	49 ff c4             	inc    %r12
+ 30e:	45 84 ed             	test   %r13b,%r13b
+ 311:	0f 84 51 01 00 00    	je     468 <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 317:	41 0f b6 c5          	movzbl %r13b,%eax
+ 31b:	41 0f be d5          	movsbl %r13b,%edx
+ 31f:	83 f8 64             	cmp    $0x64,%eax
+ 322:	74 7c                	je     3a0 <printf+0xe5>
+ 324:	7f 29                	jg     34f <printf+0x94>
+ 326:	83 f8 25             	cmp    $0x25,%eax
+ 329:	74 4c                	je     377 <printf+0xbc>
+ 32b:	83 f8 63             	cmp    $0x63,%eax
+ 32e:	75 33                	jne    363 <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 330:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 333:	83 fa 2f             	cmp    $0x2f,%edx
+ 336:	0f 87 1b 01 00 00    	ja     457 <printf+0x19c>
+ 33c:	89 d0                	mov    %edx,%eax
+ 33e:	83 c2 08             	add    $0x8,%edx
+ 341:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 345:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 348:	8b 00                	mov    (%rax),%eax
+ 34a:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 34d:	eb 2c                	jmp    37b <printf+0xc0>
+ 34f:	83 f8 73             	cmp    $0x73,%eax
+ 352:	0f 84 aa 00 00 00    	je     402 <printf+0x147>
+ 358:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 35e:	83 fa 70             	cmp    $0x70,%edx
+ 361:	74 6b                	je     3ce <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 363:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 367:	ba 01 00 00 00       	mov    $0x1,%edx
+ 36c:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 370:	89 df                	mov    %ebx,%edi
+ 372:	e8 3b fe ff ff       	call   1b2 <write>
+        putc(fd, c);
+ 377:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 37b:	ba 01 00 00 00       	mov    $0x1,%edx
+ 380:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 384:	89 df                	mov    %ebx,%edi
+ 386:	e8 27 fe ff ff       	call   1b2 <write>
+  for(i = 0; fmt[i]; i++){
+ 38b:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 390:	49 ff c4             	inc    %r12
+ 393:	84 c0                	test   %al,%al
+ 395:	0f 85 63 ff ff ff    	jne    2fe <printf+0x43>
+ 39b:	e9 c8 00 00 00       	jmp    468 <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 3a0:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3a3:	83 fa 2f             	cmp    $0x2f,%edx
+ 3a6:	77 0e                	ja     3b6 <printf+0xfb>
+ 3a8:	89 d0                	mov    %edx,%eax
+ 3aa:	83 c2 08             	add    $0x8,%edx
+ 3ad:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3b1:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3b4:	eb 0c                	jmp    3c2 <printf+0x107>
+ 3b6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3ba:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3be:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3c2:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3c7:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3cc:	eb 29                	jmp    3f7 <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 3ce:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3d1:	83 fa 2f             	cmp    $0x2f,%edx
+ 3d4:	77 0e                	ja     3e4 <printf+0x129>
+ 3d6:	89 d0                	mov    %edx,%eax
+ 3d8:	83 c2 08             	add    $0x8,%edx
+ 3db:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3df:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3e2:	eb 0c                	jmp    3f0 <printf+0x135>
+ 3e4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3e8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3ec:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+ 3f2:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3f7:	8b 30                	mov    (%rax),%esi
+ 3f9:	89 df                	mov    %ebx,%edi
+ 3fb:	e8 3a fe ff ff       	call   23a <printint>
+ 400:	eb 89                	jmp    38b <printf+0xd0>
+        s = va_arg(ap, char*);
+ 402:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 405:	83 fa 2f             	cmp    $0x2f,%edx
+ 408:	77 0e                	ja     418 <printf+0x15d>
+ 40a:	89 d0                	mov    %edx,%eax
+ 40c:	83 c2 08             	add    $0x8,%edx
+ 40f:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 413:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 416:	eb 0c                	jmp    424 <printf+0x169>
+ 418:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 41c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 420:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 424:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 427:	4d 85 ed             	test   %r13,%r13
+ 42a:	75 07                	jne    433 <printf+0x178>
+          s = "(null)";
+ 42c:	49 c7 c5 e7 05 00 00 	mov    $0x5e7,%r13
+        while(*s != 0){
+ 433:	41 8a 45 00          	mov    0x0(%r13),%al
+ 437:	84 c0                	test   %al,%al
+ 439:	0f 84 4c ff ff ff    	je     38b <printf+0xd0>
+          putc(fd, *s);
+ 43f:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 442:	ba 01 00 00 00       	mov    $0x1,%edx
+ 447:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 44b:	89 df                	mov    %ebx,%edi
+          s++;
+ 44d:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 450:	e8 5d fd ff ff       	call   1b2 <write>
+          s++;
+ 455:	eb dc                	jmp    433 <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 457:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 45b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 45f:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 463:	e9 e0 fe ff ff       	jmp    348 <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 468:	48 83 c4 58          	add    $0x58,%rsp
+ 46c:	5b                   	pop    %rbx
+ 46d:	41 5c                	pop    %r12
+ 46f:	41 5d                	pop    %r13
+ 471:	5d                   	pop    %rbp
+ 472:	c3                   	ret
+
+0000000000000473 <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 473:	48 8b 05 56 03 00 00 	mov    0x356(%rip),%rax        # 7d0 <freep>
+{
+ 47a:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 47d:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 481:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 484:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 487:	48 39 f2             	cmp    %rsi,%rdx
+ 48a:	72 0c                	jb     498 <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 48c:	48 39 c6             	cmp    %rax,%rsi
+ 48f:	73 f0                	jae    481 <free+0xe>
+ 491:	48 39 c2             	cmp    %rax,%rdx
+ 494:	72 eb                	jb     481 <free+0xe>
+ 496:	eb 05                	jmp    49d <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 498:	48 39 c6             	cmp    %rax,%rsi
+ 49b:	73 f4                	jae    491 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 49d:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 4a0:	49 89 f8             	mov    %rdi,%r8
+ 4a3:	48 c1 e7 04          	shl    $0x4,%rdi
+ 4a7:	48 01 f7             	add    %rsi,%rdi
+ 4aa:	48 39 f8             	cmp    %rdi,%rax
+ 4ad:	75 0e                	jne    4bd <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 4af:	44 03 40 08          	add    0x8(%rax),%r8d
+ 4b3:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 4b7:	48 8b 02             	mov    (%rdx),%rax
+ 4ba:	48 8b 00             	mov    (%rax),%rax
+ 4bd:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 4c1:	8b 42 08             	mov    0x8(%rdx),%eax
+ 4c4:	48 89 c7             	mov    %rax,%rdi
+ 4c7:	48 c1 e0 04          	shl    $0x4,%rax
+ 4cb:	48 01 d0             	add    %rdx,%rax
+ 4ce:	48 39 c6             	cmp    %rax,%rsi
+ 4d1:	75 0a                	jne    4dd <free+0x6a>
+    p->s.size += bp->s.size;
+ 4d3:	03 79 f8             	add    -0x8(%rcx),%edi
+ 4d6:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 4d9:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 4dd:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 4e0:	48 89 15 e9 02 00 00 	mov    %rdx,0x2e9(%rip)        # 7d0 <freep>
+}
+ 4e7:	c3                   	ret
+
+00000000000004e8 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 4e8:	55                   	push   %rbp
+ 4e9:	48 89 e5             	mov    %rsp,%rbp
+ 4ec:	41 55                	push   %r13
+ 4ee:	41 54                	push   %r12
+ 4f0:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4f1:	89 fb                	mov    %edi,%ebx
+{
+ 4f3:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4f4:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 4f8:	48 8b 0d d1 02 00 00 	mov    0x2d1(%rip),%rcx        # 7d0 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4ff:	48 c1 eb 04          	shr    $0x4,%rbx
+ 503:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 505:	48 85 c9             	test   %rcx,%rcx
+ 508:	75 25                	jne    52f <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 50a:	48 c7 05 bb 02 00 00 	movq   $0x7e0,0x2bb(%rip)        # 7d0 <freep>
+ 511:	e0 07 00 00 
+    base.s.size = 0;
+ 515:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 517:	48 c7 05 be 02 00 00 	movq   $0x7e0,0x2be(%rip)        # 7e0 <base>
+ 51e:	e0 07 00 00 
+    base.s.size = 0;
+ 522:	89 0d c0 02 00 00    	mov    %ecx,0x2c0(%rip)        # 7e8 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 528:	48 c7 c1 e0 07 00 00 	mov    $0x7e0,%rcx
+  if(nu < 4096)
+ 52f:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 535:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 538:	44 39 e3             	cmp    %r12d,%ebx
+ 53b:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 53f:	45 89 e5             	mov    %r12d,%r13d
+ 542:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 546:	8b 50 08             	mov    0x8(%rax),%edx
+ 549:	39 da                	cmp    %ebx,%edx
+ 54b:	72 26                	jb     573 <malloc+0x8b>
+      if(p->s.size == nunits)
+ 54d:	75 08                	jne    557 <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 54f:	48 8b 10             	mov    (%rax),%rdx
+ 552:	48 89 11             	mov    %rdx,(%rcx)
+ 555:	eb 0f                	jmp    566 <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 557:	29 da                	sub    %ebx,%edx
+ 559:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 55c:	48 c1 e2 04          	shl    $0x4,%rdx
+ 560:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 563:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 566:	48 89 0d 63 02 00 00 	mov    %rcx,0x263(%rip)        # 7d0 <freep>
+      return (void*)(p + 1);
+ 56d:	48 83 c0 10          	add    $0x10,%rax
+ 571:	eb 3a                	jmp    5ad <malloc+0xc5>
+    }
+    if(p == freep)
+ 573:	48 39 05 56 02 00 00 	cmp    %rax,0x256(%rip)        # 7d0 <freep>
+ 57a:	75 27                	jne    5a3 <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 57c:	44 89 ef             	mov    %r13d,%edi
+ 57f:	e8 96 fc ff ff       	call   21a <sbrk>
+  if(p == (char*)-1)
+ 584:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 588:	74 21                	je     5ab <malloc+0xc3>
+  hp->s.size = nu;
+ 58a:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 58e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 592:	e8 dc fe ff ff       	call   473 <free>
+  return freep;
+ 597:	48 8b 05 32 02 00 00 	mov    0x232(%rip),%rax        # 7d0 <freep>
+      if((p = morecore(nunits)) == 0)
+ 59e:	48 85 c0             	test   %rax,%rax
+ 5a1:	74 08                	je     5ab <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 5a3:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 5a6:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 5a9:	eb 9b                	jmp    546 <malloc+0x5e>
+        return 0;
+ 5ab:	31 c0                	xor    %eax,%eax
+  }
+}
+ 5ad:	5a                   	pop    %rdx
+ 5ae:	5b                   	pop    %rbx
+ 5af:	41 5c                	pop    %r12
+ 5b1:	41 5d                	pop    %r13
+ 5b3:	5d                   	pop    %rbp
+ 5b4:	c3                   	ret
@@ -0,0 +1,1135 @@
+
+.fs/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	41 54                	push   %r12
+   6:	53                   	push   %rbx
+  int i;
+
+  if(argc < 2){
+   7:	83 ff 01             	cmp    $0x1,%edi
+   a:	7f 0e                	jg     1a <main+0x1a>
+    ls(".");
+   c:	48 c7 c7 08 09 00 00 	mov    $0x908,%rdi
+  13:	e8 af 00 00 00       	call   c7 <ls>
+    exit();
+  18:	eb 1d                	jmp    37 <main+0x37>
+  1a:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  1d:	48 8d 5e 08          	lea    0x8(%rsi),%rbx
+  21:	4c 8d 64 c6 10       	lea    0x10(%rsi,%rax,8),%r12
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  26:	48 8b 3b             	mov    (%rbx),%rdi
+  for(i=1; i<argc; i++)
+  29:	48 83 c3 08          	add    $0x8,%rbx
+    ls(argv[i]);
+  2d:	e8 95 00 00 00       	call   c7 <ls>
+  for(i=1; i<argc; i++)
+  32:	4c 39 e3             	cmp    %r12,%rbx
+  35:	75 ef                	jne    26 <main+0x26>
+  exit();
+  37:	e8 3b 04 00 00       	call   477 <exit>
+
+000000000000003c <fmtname>:
+{
+  3c:	55                   	push   %rbp
+  3d:	48 89 e5             	mov    %rsp,%rbp
+  40:	41 54                	push   %r12
+  42:	49 89 fc             	mov    %rdi,%r12
+  45:	53                   	push   %rbx
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  46:	e8 19 03 00 00       	call   364 <strlen>
+  4b:	89 c3                	mov    %eax,%ebx
+  4d:	4c 01 e3             	add    %r12,%rbx
+  50:	4c 39 e3             	cmp    %r12,%rbx
+  53:	73 60                	jae    b5 <fmtname+0x79>
+  p++;
+  55:	48 ff c3             	inc    %rbx
+  if(strlen(p) >= DIRSIZ)
+  58:	48 89 df             	mov    %rbx,%rdi
+  5b:	e8 04 03 00 00       	call   364 <strlen>
+  60:	83 f8 0d             	cmp    $0xd,%eax
+  63:	77 5a                	ja     bf <fmtname+0x83>
+  memmove(buf, p, strlen(p));
+  65:	48 89 df             	mov    %rbx,%rdi
+  68:	e8 f7 02 00 00       	call   364 <strlen>
+  6d:	48 89 de             	mov    %rbx,%rsi
+  70:	48 c7 c7 80 0b 00 00 	mov    $0xb80,%rdi
+  77:	89 c2                	mov    %eax,%edx
+  79:	e8 d6 03 00 00       	call   454 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  7e:	48 89 df             	mov    %rbx,%rdi
+  81:	e8 de 02 00 00       	call   364 <strlen>
+  86:	48 89 df             	mov    %rbx,%rdi
+  return buf;
+  89:	48 c7 c3 80 0b 00 00 	mov    $0xb80,%rbx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  90:	41 89 c4             	mov    %eax,%r12d
+  93:	e8 cc 02 00 00       	call   364 <strlen>
+  98:	ba 0e 00 00 00       	mov    $0xe,%edx
+  9d:	be 20 00 00 00       	mov    $0x20,%esi
+  a2:	89 c7                	mov    %eax,%edi
+  a4:	44 29 e2             	sub    %r12d,%edx
+  a7:	48 81 c7 80 0b 00 00 	add    $0xb80,%rdi
+  ae:	e8 c1 02 00 00       	call   374 <memset>
+  return buf;
+  b3:	eb 0a                	jmp    bf <fmtname+0x83>
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  b5:	80 3b 2f             	cmpb   $0x2f,(%rbx)
+  b8:	74 9b                	je     55 <fmtname+0x19>
+  ba:	48 ff cb             	dec    %rbx
+  bd:	eb 91                	jmp    50 <fmtname+0x14>
+}
+  bf:	48 89 d8             	mov    %rbx,%rax
+  c2:	5b                   	pop    %rbx
+  c3:	41 5c                	pop    %r12
+  c5:	5d                   	pop    %rbp
+  c6:	c3                   	ret
+
+00000000000000c7 <ls>:
+{
+  c7:	55                   	push   %rbp
+  if((fd = open(path, 0)) < 0){
+  c8:	31 f6                	xor    %esi,%esi
+{
+  ca:	48 89 e5             	mov    %rsp,%rbp
+  cd:	41 57                	push   %r15
+  cf:	41 56                	push   %r14
+  d1:	41 55                	push   %r13
+  d3:	41 54                	push   %r12
+  d5:	53                   	push   %rbx
+  d6:	48 89 fb             	mov    %rdi,%rbx
+  d9:	48 81 ec 58 02 00 00 	sub    $0x258,%rsp
+  if((fd = open(path, 0)) < 0){
+  e0:	e8 d2 03 00 00       	call   4b7 <open>
+  e5:	85 c0                	test   %eax,%eax
+  e7:	79 24                	jns    10d <ls+0x46>
+}
+  e9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+    printf(2, "ls: cannot open %s\n", path);
+  ed:	48 89 da             	mov    %rbx,%rdx
+  f0:	48 c7 c6 a0 08 00 00 	mov    $0x8a0,%rsi
+  f7:	31 c0                	xor    %eax,%eax
+}
+  f9:	5b                   	pop    %rbx
+    printf(2, "ls: cannot open %s\n", path);
+  fa:	bf 02 00 00 00       	mov    $0x2,%edi
+}
+  ff:	41 5c                	pop    %r12
+ 101:	41 5d                	pop    %r13
+ 103:	41 5e                	pop    %r14
+ 105:	41 5f                	pop    %r15
+ 107:	5d                   	pop    %rbp
+    printf(2, "ls: cannot open %s\n", path);
+ 108:	e9 93 04 00 00       	jmp    5a0 <printf>
+  if(fstat(fd, &st) < 0){
+ 10d:	48 8d b5 b4 fd ff ff 	lea    -0x24c(%rbp),%rsi
+ 114:	89 c7                	mov    %eax,%edi
+ 116:	41 89 c4             	mov    %eax,%r12d
+ 119:	e8 b1 03 00 00       	call   4cf <fstat>
+ 11e:	85 c0                	test   %eax,%eax
+ 120:	79 1b                	jns    13d <ls+0x76>
+    printf(2, "ls: cannot stat %s\n", path);
+ 122:	48 89 da             	mov    %rbx,%rdx
+ 125:	48 c7 c6 b4 08 00 00 	mov    $0x8b4,%rsi
+ 12c:	bf 02 00 00 00       	mov    $0x2,%edi
+ 131:	31 c0                	xor    %eax,%eax
+ 133:	e8 68 04 00 00       	call   5a0 <printf>
+    close(fd);
+ 138:	e9 e5 01 00 00       	jmp    322 <ls+0x25b>
+  switch(st.type){
+ 13d:	8b 85 b4 fd ff ff    	mov    -0x24c(%rbp),%eax
+ 143:	66 83 f8 01          	cmp    $0x1,%ax
+ 147:	74 7e                	je     1c7 <ls+0x100>
+ 149:	66 83 f8 02          	cmp    $0x2,%ax
+ 14d:	0f 85 cf 01 00 00    	jne    322 <ls+0x25b>
+    printf(1, "%s %d %d %d %x %d %d\n", fmtname(path), st.type, st.ownerid, st.groupid, st.mode, st.ino, st.size);
+ 153:	44 0f bf 8d c4 fd ff 	movswl -0x23c(%rbp),%r9d
+ 15a:	ff 
+ 15b:	44 0f bf 85 c2 fd ff 	movswl -0x23e(%rbp),%r8d
+ 162:	ff 
+ 163:	48 89 df             	mov    %rbx,%rdi
+ 166:	44 8b bd cc fd ff ff 	mov    -0x234(%rbp),%r15d
+ 16d:	44 8b b5 bc fd ff ff 	mov    -0x244(%rbp),%r14d
+ 174:	44 8b ad c8 fd ff ff 	mov    -0x238(%rbp),%r13d
+ 17b:	44 89 8d 94 fd ff ff 	mov    %r9d,-0x26c(%rbp)
+ 182:	44 89 85 98 fd ff ff 	mov    %r8d,-0x268(%rbp)
+ 189:	e8 ae fe ff ff       	call   3c <fmtname>
+ 18e:	48 c7 c6 c8 08 00 00 	mov    $0x8c8,%rsi
+ 195:	bf 01 00 00 00       	mov    $0x1,%edi
+ 19a:	51                   	push   %rcx
+ 19b:	48 89 c2             	mov    %rax,%rdx
+ 19e:	b9 02 00 00 00       	mov    $0x2,%ecx
+ 1a3:	31 c0                	xor    %eax,%eax
+ 1a5:	41 57                	push   %r15
+ 1a7:	41 56                	push   %r14
+ 1a9:	41 55                	push   %r13
+ 1ab:	44 8b 8d 94 fd ff ff 	mov    -0x26c(%rbp),%r9d
+ 1b2:	44 8b 85 98 fd ff ff 	mov    -0x268(%rbp),%r8d
+ 1b9:	e8 e2 03 00 00       	call   5a0 <printf>
+    break;
+ 1be:	48 83 c4 20          	add    $0x20,%rsp
+ 1c2:	e9 5b 01 00 00       	jmp    322 <ls+0x25b>
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1c7:	48 89 df             	mov    %rbx,%rdi
+ 1ca:	e8 95 01 00 00       	call   364 <strlen>
+ 1cf:	83 c0 10             	add    $0x10,%eax
+ 1d2:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1d7:	76 18                	jbe    1f1 <ls+0x12a>
+      printf(1, "ls: path too long\n");
+ 1d9:	48 c7 c6 de 08 00 00 	mov    $0x8de,%rsi
+ 1e0:	bf 01 00 00 00       	mov    $0x1,%edi
+ 1e5:	31 c0                	xor    %eax,%eax
+ 1e7:	e8 b4 03 00 00       	call   5a0 <printf>
+      break;
+ 1ec:	e9 31 01 00 00       	jmp    322 <ls+0x25b>
+    strcpy(buf, path);
+ 1f1:	48 89 de             	mov    %rbx,%rsi
+ 1f4:	48 8d bd d0 fd ff ff 	lea    -0x230(%rbp),%rdi
+ 1fb:	e8 39 01 00 00       	call   339 <strcpy>
+    p = buf+strlen(buf);
+ 200:	48 8d bd d0 fd ff ff 	lea    -0x230(%rbp),%rdi
+ 207:	e8 58 01 00 00       	call   364 <strlen>
+ 20c:	89 c3                	mov    %eax,%ebx
+ 20e:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+ 215:	48 01 c3             	add    %rax,%rbx
+    *p++ = '/';
+ 218:	48 8d 43 01          	lea    0x1(%rbx),%rax
+ 21c:	c6 03 2f             	movb   $0x2f,(%rbx)
+ 21f:	48 89 85 98 fd ff ff 	mov    %rax,-0x268(%rbp)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 226:	ba 10 00 00 00       	mov    $0x10,%edx
+ 22b:	48 8d b5 a4 fd ff ff 	lea    -0x25c(%rbp),%rsi
+ 232:	44 89 e7             	mov    %r12d,%edi
+ 235:	e8 55 02 00 00       	call   48f <read>
+ 23a:	83 f8 10             	cmp    $0x10,%eax
+ 23d:	0f 85 df 00 00 00    	jne    322 <ls+0x25b>
+      if(de.inum == 0)
+ 243:	66 83 bd a4 fd ff ff 	cmpw   $0x0,-0x25c(%rbp)
+ 24a:	00 
+ 24b:	74 d9                	je     226 <ls+0x15f>
+      memmove(p, de.name, DIRSIZ);
+ 24d:	48 8b bd 98 fd ff ff 	mov    -0x268(%rbp),%rdi
+ 254:	48 8d b5 a6 fd ff ff 	lea    -0x25a(%rbp),%rsi
+ 25b:	ba 0e 00 00 00       	mov    $0xe,%edx
+ 260:	e8 ef 01 00 00       	call   454 <memmove>
+      p[DIRSIZ] = 0;
+ 265:	c6 43 0f 00          	movb   $0x0,0xf(%rbx)
+      if(stat(buf, &st) < 0){
+ 269:	48 8d b5 b4 fd ff ff 	lea    -0x24c(%rbp),%rsi
+ 270:	48 8d bd d0 fd ff ff 	lea    -0x230(%rbp),%rdi
+ 277:	e8 81 01 00 00       	call   3fd <stat>
+ 27c:	85 c0                	test   %eax,%eax
+ 27e:	79 1c                	jns    29c <ls+0x1d5>
+        printf(1, "ls: cannot stat %s\n", buf);
+ 280:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+ 287:	48 c7 c6 b4 08 00 00 	mov    $0x8b4,%rsi
+ 28e:	bf 01 00 00 00       	mov    $0x1,%edi
+ 293:	31 c0                	xor    %eax,%eax
+ 295:	e8 06 03 00 00       	call   5a0 <printf>
+        continue;
+ 29a:	eb 8a                	jmp    226 <ls+0x15f>
+      printf(1, "%s  %d %d %d %x %d %d\n", fmtname(buf), st.type, st.ownerid, st.groupid, st.mode, st.ino, st.size);
+ 29c:	44 0f bf 8d c4 fd ff 	movswl -0x23c(%rbp),%r9d
+ 2a3:	ff 
+ 2a4:	44 0f bf 85 c2 fd ff 	movswl -0x23e(%rbp),%r8d
+ 2ab:	ff 
+ 2ac:	48 8d bd d0 fd ff ff 	lea    -0x230(%rbp),%rdi
+ 2b3:	0f bf 8d b4 fd ff ff 	movswl -0x24c(%rbp),%ecx
+ 2ba:	44 8b b5 cc fd ff ff 	mov    -0x234(%rbp),%r14d
+ 2c1:	44 8b ad bc fd ff ff 	mov    -0x244(%rbp),%r13d
+ 2c8:	44 8b bd c8 fd ff ff 	mov    -0x238(%rbp),%r15d
+ 2cf:	44 89 8d 8c fd ff ff 	mov    %r9d,-0x274(%rbp)
+ 2d6:	44 89 85 90 fd ff ff 	mov    %r8d,-0x270(%rbp)
+ 2dd:	89 8d 94 fd ff ff    	mov    %ecx,-0x26c(%rbp)
+ 2e3:	e8 54 fd ff ff       	call   3c <fmtname>
+ 2e8:	48 c7 c6 f1 08 00 00 	mov    $0x8f1,%rsi
+ 2ef:	bf 01 00 00 00       	mov    $0x1,%edi
+ 2f4:	48 89 c2             	mov    %rax,%rdx
+ 2f7:	50                   	push   %rax
+ 2f8:	31 c0                	xor    %eax,%eax
+ 2fa:	41 56                	push   %r14
+ 2fc:	41 55                	push   %r13
+ 2fe:	41 57                	push   %r15
+ 300:	44 8b 8d 8c fd ff ff 	mov    -0x274(%rbp),%r9d
+ 307:	44 8b 85 90 fd ff ff 	mov    -0x270(%rbp),%r8d
+ 30e:	8b 8d 94 fd ff ff    	mov    -0x26c(%rbp),%ecx
+ 314:	e8 87 02 00 00       	call   5a0 <printf>
+ 319:	48 83 c4 20          	add    $0x20,%rsp
+ 31d:	e9 04 ff ff ff       	jmp    226 <ls+0x15f>
+  close(fd);
+ 322:	44 89 e7             	mov    %r12d,%edi
+ 325:	e8 75 01 00 00       	call   49f <close>
+}
+ 32a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+ 32e:	5b                   	pop    %rbx
+ 32f:	41 5c                	pop    %r12
+ 331:	41 5d                	pop    %r13
+ 333:	41 5e                	pop    %r14
+ 335:	41 5f                	pop    %r15
+ 337:	5d                   	pop    %rbp
+ 338:	c3                   	ret
+
+0000000000000339 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 339:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 33c:	31 d2                	xor    %edx,%edx
+ 33e:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+ 341:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+ 344:	48 ff c2             	inc    %rdx
+ 347:	84 c9                	test   %cl,%cl
+ 349:	75 f3                	jne    33e <strcpy+0x5>
+    ;
+  return os;
+}
+ 34b:	c3                   	ret
+
+000000000000034c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+ 34c:	31 c9                	xor    %ecx,%ecx
+ 34e:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+ 352:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+ 356:	84 c0                	test   %al,%al
+ 358:	74 07                	je     361 <strcmp+0x15>
+ 35a:	48 ff c1             	inc    %rcx
+ 35d:	38 d0                	cmp    %dl,%al
+ 35f:	74 ed                	je     34e <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+ 361:	29 d0                	sub    %edx,%eax
+}
+ 363:	c3                   	ret
+
+0000000000000364 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 364:	31 d2                	xor    %edx,%edx
+ 366:	48 89 d0             	mov    %rdx,%rax
+ 369:	48 ff c2             	inc    %rdx
+ 36c:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+ 371:	75 f3                	jne    366 <strlen+0x2>
+    ;
+  return n;
+}
+ 373:	c3                   	ret
+
+0000000000000374 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 374:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 377:	89 d1                	mov    %edx,%ecx
+ 379:	89 f0                	mov    %esi,%eax
+ 37b:	fc                   	cld
+ 37c:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 37e:	4c 89 c0             	mov    %r8,%rax
+ 381:	c3                   	ret
+
+0000000000000382 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+ 382:	48 89 f8             	mov    %rdi,%rax
+ 385:	8a 10                	mov    (%rax),%dl
+ 387:	84 d2                	test   %dl,%dl
+ 389:	74 0a                	je     395 <strchr+0x13>
+    if(*s == c)
+ 38b:	40 38 f2             	cmp    %sil,%dl
+ 38e:	74 07                	je     397 <strchr+0x15>
+  for(; *s; s++)
+ 390:	48 ff c0             	inc    %rax
+ 393:	eb f0                	jmp    385 <strchr+0x3>
+      return (char*)s;
+  return 0;
+ 395:	31 c0                	xor    %eax,%eax
+}
+ 397:	c3                   	ret
+
+0000000000000398 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 398:	55                   	push   %rbp
+ 399:	48 89 e5             	mov    %rsp,%rbp
+ 39c:	41 56                	push   %r14
+ 39e:	41 89 f6             	mov    %esi,%r14d
+ 3a1:	41 55                	push   %r13
+ 3a3:	41 54                	push   %r12
+ 3a5:	49 89 fc             	mov    %rdi,%r12
+ 3a8:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3a9:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+ 3ae:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+ 3b2:	41 89 dd             	mov    %ebx,%r13d
+ 3b5:	44 39 f3             	cmp    %r14d,%ebx
+ 3b8:	7d 29                	jge    3e3 <gets+0x4b>
+    cc = read(0, &c, 1);
+ 3ba:	31 ff                	xor    %edi,%edi
+ 3bc:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3c1:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 3c5:	e8 c5 00 00 00       	call   48f <read>
+    if(cc < 1)
+ 3ca:	85 c0                	test   %eax,%eax
+ 3cc:	7e 15                	jle    3e3 <gets+0x4b>
+      break;
+    buf[i++] = c;
+ 3ce:	8a 45 df             	mov    -0x21(%rbp),%al
+ 3d1:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+ 3d6:	48 ff c3             	inc    %rbx
+ 3d9:	3c 0a                	cmp    $0xa,%al
+ 3db:	74 0a                	je     3e7 <gets+0x4f>
+ 3dd:	3c 0d                	cmp    $0xd,%al
+ 3df:	75 d1                	jne    3b2 <gets+0x1a>
+ 3e1:	eb 04                	jmp    3e7 <gets+0x4f>
+ 3e3:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 3e7:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 3ea:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 3ed:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 3f2:	5a                   	pop    %rdx
+ 3f3:	59                   	pop    %rcx
+ 3f4:	5b                   	pop    %rbx
+ 3f5:	41 5c                	pop    %r12
+ 3f7:	41 5d                	pop    %r13
+ 3f9:	41 5e                	pop    %r14
+ 3fb:	5d                   	pop    %rbp
+ 3fc:	c3                   	ret
+
+00000000000003fd <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3fd:	55                   	push   %rbp
+ 3fe:	48 89 e5             	mov    %rsp,%rbp
+ 401:	41 55                	push   %r13
+ 403:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 406:	31 f6                	xor    %esi,%esi
+{
+ 408:	41 54                	push   %r12
+ 40a:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 40e:	53                   	push   %rbx
+ 40f:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 410:	e8 a2 00 00 00       	call   4b7 <open>
+  if(fd < 0)
+ 415:	85 c0                	test   %eax,%eax
+ 417:	78 16                	js     42f <stat+0x32>
+ 419:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 41b:	89 c7                	mov    %eax,%edi
+ 41d:	4c 89 ee             	mov    %r13,%rsi
+ 420:	e8 aa 00 00 00       	call   4cf <fstat>
+  close(fd);
+ 425:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 427:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 42a:	e8 70 00 00 00       	call   49f <close>
+  return r;
+}
+ 42f:	5a                   	pop    %rdx
+ 430:	44 89 e0             	mov    %r12d,%eax
+ 433:	5b                   	pop    %rbx
+ 434:	41 5c                	pop    %r12
+ 436:	41 5d                	pop    %r13
+ 438:	5d                   	pop    %rbp
+ 439:	c3                   	ret
+
+000000000000043a <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 43a:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 43c:	0f be 17             	movsbl (%rdi),%edx
+ 43f:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 442:	80 f9 09             	cmp    $0x9,%cl
+ 445:	77 0c                	ja     453 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 447:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 44a:	48 ff c7             	inc    %rdi
+ 44d:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 451:	eb e9                	jmp    43c <atoi+0x2>
+  return n;
+}
+ 453:	c3                   	ret
+
+0000000000000454 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 454:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 457:	31 c9                	xor    %ecx,%ecx
+ 459:	89 d7                	mov    %edx,%edi
+ 45b:	29 cf                	sub    %ecx,%edi
+ 45d:	85 ff                	test   %edi,%edi
+ 45f:	7e 0d                	jle    46e <memmove+0x1a>
+    *dst++ = *src++;
+ 461:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 465:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 469:	48 ff c1             	inc    %rcx
+ 46c:	eb eb                	jmp    459 <memmove+0x5>
+  return vdst;
+}
+ 46e:	c3                   	ret
+
+000000000000046f <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 46f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 474:	cd 40                	int    $0x40
+ 476:	c3                   	ret
+
+0000000000000477 <exit>:
+SYSCALL(exit)
+ 477:	b8 02 00 00 00       	mov    $0x2,%eax
+ 47c:	cd 40                	int    $0x40
+ 47e:	c3                   	ret
+
+000000000000047f <wait>:
+SYSCALL(wait)
+ 47f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 484:	cd 40                	int    $0x40
+ 486:	c3                   	ret
+
+0000000000000487 <pipe>:
+SYSCALL(pipe)
+ 487:	b8 04 00 00 00       	mov    $0x4,%eax
+ 48c:	cd 40                	int    $0x40
+ 48e:	c3                   	ret
+
+000000000000048f <read>:
+SYSCALL(read)
+ 48f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 494:	cd 40                	int    $0x40
+ 496:	c3                   	ret
+
+0000000000000497 <write>:
+SYSCALL(write)
+ 497:	b8 10 00 00 00       	mov    $0x10,%eax
+ 49c:	cd 40                	int    $0x40
+ 49e:	c3                   	ret
+
+000000000000049f <close>:
+SYSCALL(close)
+ 49f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4a4:	cd 40                	int    $0x40
+ 4a6:	c3                   	ret
+
+00000000000004a7 <kill>:
+SYSCALL(kill)
+ 4a7:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4ac:	cd 40                	int    $0x40
+ 4ae:	c3                   	ret
+
+00000000000004af <exec>:
+SYSCALL(exec)
+ 4af:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4b4:	cd 40                	int    $0x40
+ 4b6:	c3                   	ret
+
+00000000000004b7 <open>:
+SYSCALL(open)
+ 4b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+00000000000004bf <mknod>:
+SYSCALL(mknod)
+ 4bf:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c4:	cd 40                	int    $0x40
+ 4c6:	c3                   	ret
+
+00000000000004c7 <unlink>:
+SYSCALL(unlink)
+ 4c7:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4cc:	cd 40                	int    $0x40
+ 4ce:	c3                   	ret
+
+00000000000004cf <fstat>:
+SYSCALL(fstat)
+ 4cf:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4d4:	cd 40                	int    $0x40
+ 4d6:	c3                   	ret
+
+00000000000004d7 <link>:
+SYSCALL(link)
+ 4d7:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4dc:	cd 40                	int    $0x40
+ 4de:	c3                   	ret
+
+00000000000004df <mkdir>:
+SYSCALL(mkdir)
+ 4df:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e4:	cd 40                	int    $0x40
+ 4e6:	c3                   	ret
+
+00000000000004e7 <chdir>:
+SYSCALL(chdir)
+ 4e7:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4ec:	cd 40                	int    $0x40
+ 4ee:	c3                   	ret
+
+00000000000004ef <dup>:
+SYSCALL(dup)
+ 4ef:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4f4:	cd 40                	int    $0x40
+ 4f6:	c3                   	ret
+
+00000000000004f7 <getpid>:
+SYSCALL(getpid)
+ 4f7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4fc:	cd 40                	int    $0x40
+ 4fe:	c3                   	ret
+
+00000000000004ff <sbrk>:
+SYSCALL(sbrk)
+ 4ff:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 504:	cd 40                	int    $0x40
+ 506:	c3                   	ret
+
+0000000000000507 <sleep>:
+SYSCALL(sleep)
+ 507:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 50c:	cd 40                	int    $0x40
+ 50e:	c3                   	ret
+
+000000000000050f <uptime>:
+SYSCALL(uptime)
+ 50f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 514:	cd 40                	int    $0x40
+ 516:	c3                   	ret
+
+0000000000000517 <chmod>:
+SYSCALL(chmod)
+ 517:	b8 16 00 00 00       	mov    $0x16,%eax
+ 51c:	cd 40                	int    $0x40
+ 51e:	c3                   	ret
+
+000000000000051f <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 51f:	55                   	push   %rbp
+ 520:	48 89 e5             	mov    %rsp,%rbp
+ 523:	41 54                	push   %r12
+ 525:	41 89 fc             	mov    %edi,%r12d
+ 528:	89 d7                	mov    %edx,%edi
+ 52a:	53                   	push   %rbx
+ 52b:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 52f:	85 f6                	test   %esi,%esi
+ 531:	79 0f                	jns    542 <printint+0x23>
+ 533:	80 e1 01             	and    $0x1,%cl
+ 536:	74 0a                	je     542 <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 538:	f7 de                	neg    %esi
+    neg = 1;
+ 53a:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 540:	eb 03                	jmp    545 <printint+0x26>
+  neg = 0;
+ 542:	45 31 c0             	xor    %r8d,%r8d
+ 545:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 547:	89 f0                	mov    %esi,%eax
+ 549:	31 d2                	xor    %edx,%edx
+ 54b:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 54e:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 551:	f7 f7                	div    %edi
+ 553:	8a 92 20 09 00 00    	mov    0x920(%rdx),%dl
+ 559:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 55d:	89 f2                	mov    %esi,%edx
+ 55f:	89 c6                	mov    %eax,%esi
+ 561:	39 fa                	cmp    %edi,%edx
+ 563:	73 e2                	jae    547 <printint+0x28>
+  if(neg)
+ 565:	45 85 c0             	test   %r8d,%r8d
+ 568:	74 0a                	je     574 <printint+0x55>
+    buf[i++] = digits[x % base];
+ 56a:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 56c:	48 63 c3             	movslq %ebx,%rax
+ 56f:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 574:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 577:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 57b:	ba 01 00 00 00       	mov    $0x1,%edx
+ 580:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 584:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 587:	48 ff cb             	dec    %rbx
+ 58a:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 58d:	e8 05 ff ff ff       	call   497 <write>
+  while(--i >= 0)
+ 592:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 595:	75 e0                	jne    577 <printint+0x58>
+}
+ 597:	48 83 c4 20          	add    $0x20,%rsp
+ 59b:	5b                   	pop    %rbx
+ 59c:	41 5c                	pop    %r12
+ 59e:	5d                   	pop    %rbp
+ 59f:	c3                   	ret
+
+00000000000005a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5a0:	55                   	push   %rbp
+ 5a1:	48 89 e5             	mov    %rsp,%rbp
+ 5a4:	41 55                	push   %r13
+ 5a6:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 5a8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 5ac:	53                   	push   %rbx
+ 5ad:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 5b1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 5b5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 5b9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 5bd:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 5c1:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 5c5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 5c9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 5cd:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 5cf:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 5d6:	84 c0                	test   %al,%al
+ 5d8:	0f 84 6f 01 00 00    	je     74d <printf+0x1ad>
+ 5de:	89 fb                	mov    %edi,%ebx
+ 5e0:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 5e3:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 5e6:	83 fa 25             	cmp    $0x25,%edx
+ 5e9:	75 44                	jne    62f <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 5eb:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 5f0:	49 ff c4             	inc    %r12
+ 5f3:	45 84 ed             	test   %r13b,%r13b
+ 5f6:	0f 84 51 01 00 00    	je     74d <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 5fc:	41 0f b6 c5          	movzbl %r13b,%eax
+ 600:	41 0f be d5          	movsbl %r13b,%edx
+ 604:	83 f8 64             	cmp    $0x64,%eax
+ 607:	74 7c                	je     685 <printf+0xe5>
+ 609:	7f 29                	jg     634 <printf+0x94>
+ 60b:	83 f8 25             	cmp    $0x25,%eax
+ 60e:	74 4c                	je     65c <printf+0xbc>
+ 610:	83 f8 63             	cmp    $0x63,%eax
+ 613:	75 33                	jne    648 <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 615:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 618:	83 fa 2f             	cmp    $0x2f,%edx
+ 61b:	0f 87 1b 01 00 00    	ja     73c <printf+0x19c>
+ 621:	89 d0                	mov    %edx,%eax
+ 623:	83 c2 08             	add    $0x8,%edx
+ 626:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 62a:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 62d:	8b 00                	mov    (%rax),%eax
+ 62f:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 632:	eb 2c                	jmp    660 <printf+0xc0>
+ 634:	83 f8 73             	cmp    $0x73,%eax
+ 637:	0f 84 aa 00 00 00    	je     6e7 <printf+0x147>
+ 63d:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 643:	83 fa 70             	cmp    $0x70,%edx
+ 646:	74 6b                	je     6b3 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 648:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 64c:	ba 01 00 00 00       	mov    $0x1,%edx
+ 651:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 655:	89 df                	mov    %ebx,%edi
+ 657:	e8 3b fe ff ff       	call   497 <write>
+        putc(fd, c);
+ 65c:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 660:	ba 01 00 00 00       	mov    $0x1,%edx
+ 665:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 669:	89 df                	mov    %ebx,%edi
+ 66b:	e8 27 fe ff ff       	call   497 <write>
+  for(i = 0; fmt[i]; i++){
+ 670:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 675:	49 ff c4             	inc    %r12
+ 678:	84 c0                	test   %al,%al
+ 67a:	0f 85 63 ff ff ff    	jne    5e3 <printf+0x43>
+ 680:	e9 c8 00 00 00       	jmp    74d <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 685:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 688:	83 fa 2f             	cmp    $0x2f,%edx
+ 68b:	77 0e                	ja     69b <printf+0xfb>
+ 68d:	89 d0                	mov    %edx,%eax
+ 68f:	83 c2 08             	add    $0x8,%edx
+ 692:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 696:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 699:	eb 0c                	jmp    6a7 <printf+0x107>
+ 69b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 69f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 6a3:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 6a7:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 6ac:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 6b1:	eb 29                	jmp    6dc <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 6b3:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 6b6:	83 fa 2f             	cmp    $0x2f,%edx
+ 6b9:	77 0e                	ja     6c9 <printf+0x129>
+ 6bb:	89 d0                	mov    %edx,%eax
+ 6bd:	83 c2 08             	add    $0x8,%edx
+ 6c0:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 6c4:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 6c7:	eb 0c                	jmp    6d5 <printf+0x135>
+ 6c9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 6cd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 6d1:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 6d5:	31 c9                	xor    %ecx,%ecx
+ 6d7:	ba 10 00 00 00       	mov    $0x10,%edx
+ 6dc:	8b 30                	mov    (%rax),%esi
+ 6de:	89 df                	mov    %ebx,%edi
+ 6e0:	e8 3a fe ff ff       	call   51f <printint>
+ 6e5:	eb 89                	jmp    670 <printf+0xd0>
+        s = va_arg(ap, char*);
+ 6e7:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 6ea:	83 fa 2f             	cmp    $0x2f,%edx
+ 6ed:	77 0e                	ja     6fd <printf+0x15d>
+ 6ef:	89 d0                	mov    %edx,%eax
+ 6f1:	83 c2 08             	add    $0x8,%edx
+ 6f4:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 6f8:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 6fb:	eb 0c                	jmp    709 <printf+0x169>
+ 6fd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 701:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 705:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 709:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 70c:	4d 85 ed             	test   %r13,%r13
+ 70f:	75 07                	jne    718 <printf+0x178>
+          s = "(null)";
+ 711:	49 c7 c5 0a 09 00 00 	mov    $0x90a,%r13
+        while(*s != 0){
+ 718:	41 8a 45 00          	mov    0x0(%r13),%al
+ 71c:	84 c0                	test   %al,%al
+ 71e:	0f 84 4c ff ff ff    	je     670 <printf+0xd0>
+          putc(fd, *s);
+ 724:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 727:	ba 01 00 00 00       	mov    $0x1,%edx
+ 72c:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 730:	89 df                	mov    %ebx,%edi
+          s++;
+ 732:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 735:	e8 5d fd ff ff       	call   497 <write>
+          s++;
+ 73a:	eb dc                	jmp    718 <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 73c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 740:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 744:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 748:	e9 e0 fe ff ff       	jmp    62d <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 74d:	48 83 c4 58          	add    $0x58,%rsp
+ 751:	5b                   	pop    %rbx
+ 752:	41 5c                	pop    %r12
+ 754:	41 5d                	pop    %r13
+ 756:	5d                   	pop    %rbp
+ 757:	c3                   	ret
+
+0000000000000758 <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 758:	48 8b 05 31 04 00 00 	mov    0x431(%rip),%rax        # b90 <freep>
+{
+ 75f:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 762:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 766:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 769:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 76c:	48 39 f2             	cmp    %rsi,%rdx
+ 76f:	72 0c                	jb     77d <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 771:	48 39 c6             	cmp    %rax,%rsi
+ 774:	73 f0                	jae    766 <free+0xe>
+ 776:	48 39 c2             	cmp    %rax,%rdx
+ 779:	72 eb                	jb     766 <free+0xe>
+ 77b:	eb 05                	jmp    782 <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 77d:	48 39 c6             	cmp    %rax,%rsi
+ 780:	73 f4                	jae    776 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 782:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 785:	49 89 f8             	mov    %rdi,%r8
+ 788:	48 c1 e7 04          	shl    $0x4,%rdi
+ 78c:	48 01 f7             	add    %rsi,%rdi
+ 78f:	48 39 f8             	cmp    %rdi,%rax
+ 792:	75 0e                	jne    7a2 <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 794:	44 03 40 08          	add    0x8(%rax),%r8d
+ 798:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 79c:	48 8b 02             	mov    (%rdx),%rax
+ 79f:	48 8b 00             	mov    (%rax),%rax
+ 7a2:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7a6:	8b 42 08             	mov    0x8(%rdx),%eax
+ 7a9:	48 89 c7             	mov    %rax,%rdi
+ 7ac:	48 c1 e0 04          	shl    $0x4,%rax
+ 7b0:	48 01 d0             	add    %rdx,%rax
+ 7b3:	48 39 c6             	cmp    %rax,%rsi
+ 7b6:	75 0a                	jne    7c2 <free+0x6a>
+    p->s.size += bp->s.size;
+ 7b8:	03 79 f8             	add    -0x8(%rcx),%edi
+ 7bb:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 7be:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 7c2:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 7c5:	48 89 15 c4 03 00 00 	mov    %rdx,0x3c4(%rip)        # b90 <freep>
+}
+ 7cc:	c3                   	ret
+
+00000000000007cd <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7cd:	55                   	push   %rbp
+ 7ce:	48 89 e5             	mov    %rsp,%rbp
+ 7d1:	41 55                	push   %r13
+ 7d3:	41 54                	push   %r12
+ 7d5:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d6:	89 fb                	mov    %edi,%ebx
+{
+ 7d8:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d9:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 7dd:	48 8b 0d ac 03 00 00 	mov    0x3ac(%rip),%rcx        # b90 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7e4:	48 c1 eb 04          	shr    $0x4,%rbx
+ 7e8:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 7ea:	48 85 c9             	test   %rcx,%rcx
+ 7ed:	75 25                	jne    814 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 7ef:	48 c7 05 96 03 00 00 	movq   $0xba0,0x396(%rip)        # b90 <freep>
+ 7f6:	a0 0b 00 00 
+    base.s.size = 0;
+ 7fa:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 7fc:	48 c7 05 99 03 00 00 	movq   $0xba0,0x399(%rip)        # ba0 <base>
+ 803:	a0 0b 00 00 
+    base.s.size = 0;
+ 807:	89 0d 9b 03 00 00    	mov    %ecx,0x39b(%rip)        # ba8 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 80d:	48 c7 c1 a0 0b 00 00 	mov    $0xba0,%rcx
+  if(nu < 4096)
+ 814:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 81a:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 81d:	44 39 e3             	cmp    %r12d,%ebx
+ 820:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 824:	45 89 e5             	mov    %r12d,%r13d
+ 827:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 82b:	8b 50 08             	mov    0x8(%rax),%edx
+ 82e:	39 da                	cmp    %ebx,%edx
+ 830:	72 26                	jb     858 <malloc+0x8b>
+      if(p->s.size == nunits)
+ 832:	75 08                	jne    83c <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 834:	48 8b 10             	mov    (%rax),%rdx
+ 837:	48 89 11             	mov    %rdx,(%rcx)
+ 83a:	eb 0f                	jmp    84b <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 83c:	29 da                	sub    %ebx,%edx
+ 83e:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 841:	48 c1 e2 04          	shl    $0x4,%rdx
+ 845:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 848:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 84b:	48 89 0d 3e 03 00 00 	mov    %rcx,0x33e(%rip)        # b90 <freep>
+      return (void*)(p + 1);
+ 852:	48 83 c0 10          	add    $0x10,%rax
+ 856:	eb 3a                	jmp    892 <malloc+0xc5>
+    }
+    if(p == freep)
+ 858:	48 39 05 31 03 00 00 	cmp    %rax,0x331(%rip)        # b90 <freep>
+ 85f:	75 27                	jne    888 <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 861:	44 89 ef             	mov    %r13d,%edi
+ 864:	e8 96 fc ff ff       	call   4ff <sbrk>
+  if(p == (char*)-1)
+ 869:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 86d:	74 21                	je     890 <malloc+0xc3>
+  hp->s.size = nu;
+ 86f:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 873:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 877:	e8 dc fe ff ff       	call   758 <free>
+  return freep;
+ 87c:	48 8b 05 0d 03 00 00 	mov    0x30d(%rip),%rax        # b90 <freep>
+      if((p = morecore(nunits)) == 0)
+ 883:	48 85 c0             	test   %rax,%rax
+ 886:	74 08                	je     890 <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 888:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 88b:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 88e:	eb 9b                	jmp    82b <malloc+0x5e>
+        return 0;
+ 890:	31 c0                	xor    %eax,%eax
+  }
+}
+ 892:	5a                   	pop    %rdx
+ 893:	5b                   	pop    %rbx
+ 894:	41 5c                	pop    %r12
+ 896:	41 5d                	pop    %r13
+ 898:	5d                   	pop    %rbp
+ 899:	c3                   	ret
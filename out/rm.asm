@@ -0,0 +1,909 @@
+
+.fs/rm:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	41 54                	push   %r12
+   6:	53                   	push   %rbx
+  int i;
+
+  if(argc < 2){
+   7:	83 ff 01             	cmp    $0x1,%edi
+   a:	7f 15                	jg     21 <main+0x21>
+    printf(2, "Usage: rm files...\n");
+   c:	48 c7 c6 c0 05 00 00 	mov    $0x5c0,%rsi
+  13:	bf 02 00 00 00       	mov    $0x2,%edi
+  18:	31 c0                	xor    %eax,%eax
+  1a:	e8 a7 02 00 00       	call   2c6 <printf>
+    exit();
+  1f:	eb 39                	jmp    5a <main+0x5a>
+  21:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  24:	48 8d 5e 08          	lea    0x8(%rsi),%rbx
+  28:	4c 8d 64 c6 10       	lea    0x10(%rsi,%rax,8),%r12
+  }
+
+  for(i = 1; i < argc; i++){
+    if(unlink(argv[i]) < 0){
+  2d:	48 8b 3b             	mov    (%rbx),%rdi
+  30:	e8 b8 01 00 00       	call   1ed <unlink>
+  35:	85 c0                	test   %eax,%eax
+  37:	79 18                	jns    51 <main+0x51>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  39:	48 8b 13             	mov    (%rbx),%rdx
+  3c:	48 c7 c6 d4 05 00 00 	mov    $0x5d4,%rsi
+  43:	bf 02 00 00 00       	mov    $0x2,%edi
+  48:	31 c0                	xor    %eax,%eax
+  4a:	e8 77 02 00 00       	call   2c6 <printf>
+      break;
+  4f:	eb 09                	jmp    5a <main+0x5a>
+  for(i = 1; i < argc; i++){
+  51:	48 83 c3 08          	add    $0x8,%rbx
+  55:	4c 39 e3             	cmp    %r12,%rbx
+  58:	75 d3                	jne    2d <main+0x2d>
+    }
+  }
+
+  exit();
+  5a:	e8 3e 01 00 00       	call   19d <exit>
+
+000000000000005f <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  5f:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  62:	31 d2                	xor    %edx,%edx
+  64:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+  67:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  6a:	48 ff c2             	inc    %rdx
+  6d:	84 c9                	test   %cl,%cl
+  6f:	75 f3                	jne    64 <strcpy+0x5>
+    ;
+  return os;
+}
+  71:	c3                   	ret
+
+0000000000000072 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+  72:	31 c9                	xor    %ecx,%ecx
+  74:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+  78:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+  7c:	84 c0                	test   %al,%al
+  7e:	74 07                	je     87 <strcmp+0x15>
+  80:	48 ff c1             	inc    %rcx
+  83:	38 d0                	cmp    %dl,%al
+  85:	74 ed                	je     74 <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+  87:	29 d0                	sub    %edx,%eax
+}
+  89:	c3                   	ret
+
+000000000000008a <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+  8a:	31 d2                	xor    %edx,%edx
+  8c:	48 89 d0             	mov    %rdx,%rax
+  8f:	48 ff c2             	inc    %rdx
+  92:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  97:	75 f3                	jne    8c <strlen+0x2>
+    ;
+  return n;
+}
+  99:	c3                   	ret
+
+000000000000009a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  9a:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  9d:	89 d1                	mov    %edx,%ecx
+  9f:	89 f0                	mov    %esi,%eax
+  a1:	fc                   	cld
+  a2:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+  a4:	4c 89 c0             	mov    %r8,%rax
+  a7:	c3                   	ret
+
+00000000000000a8 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+  a8:	48 89 f8             	mov    %rdi,%rax
+  ab:	8a 10                	mov    (%rax),%dl
+  ad:	84 d2                	test   %dl,%dl
+  af:	74 0a                	je     bb <strchr+0x13>
+    if(*s == c)
+  b1:	40 38 f2             	cmp    %sil,%dl
+  b4:	74 07                	je     bd <strchr+0x15>
+  for(; *s; s++)
+  b6:	48 ff c0             	inc    %rax
+  b9:	eb f0                	jmp    ab <strchr+0x3>
+      return (char*)s;
+  return 0;
+  bb:	31 c0                	xor    %eax,%eax
+}
+  bd:	c3                   	ret
+
+00000000000000be <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  be:	55                   	push   %rbp
+  bf:	48 89 e5             	mov    %rsp,%rbp
+  c2:	41 56                	push   %r14
+  c4:	41 89 f6             	mov    %esi,%r14d
+  c7:	41 55                	push   %r13
+  c9:	41 54                	push   %r12
+  cb:	49 89 fc             	mov    %rdi,%r12
+  ce:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  cf:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  d4:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+  d8:	41 89 dd             	mov    %ebx,%r13d
+  db:	44 39 f3             	cmp    %r14d,%ebx
+  de:	7d 29                	jge    109 <gets+0x4b>
+    cc = read(0, &c, 1);
+  e0:	31 ff                	xor    %edi,%edi
+  e2:	ba 01 00 00 00       	mov    $0x1,%edx
+  e7:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+  eb:	e8 c5 00 00 00       	call   1b5 <read>
+    if(cc < 1)
+  f0:	85 c0                	test   %eax,%eax
+  f2:	7e 15                	jle    109 <gets+0x4b>
+      break;
+    buf[i++] = c;
+  f4:	8a 45 df             	mov    -0x21(%rbp),%al
+  f7:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+  fc:	48 ff c3             	inc    %rbx
+  ff:	3c 0a                	cmp    $0xa,%al
+ 101:	74 0a                	je     10d <gets+0x4f>
+ 103:	3c 0d                	cmp    $0xd,%al
+ 105:	75 d1                	jne    d8 <gets+0x1a>
+ 107:	eb 04                	jmp    10d <gets+0x4f>
+ 109:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 10d:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 110:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 113:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 118:	5a                   	pop    %rdx
+ 119:	59                   	pop    %rcx
+ 11a:	5b                   	pop    %rbx
+ 11b:	41 5c                	pop    %r12
+ 11d:	41 5d                	pop    %r13
+ 11f:	41 5e                	pop    %r14
+ 121:	5d                   	pop    %rbp
+ 122:	c3                   	ret
+
+0000000000000123 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 123:	55                   	push   %rbp
+ 124:	48 89 e5             	mov    %rsp,%rbp
+ 127:	41 55                	push   %r13
+ 129:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 12c:	31 f6                	xor    %esi,%esi
+{
+ 12e:	41 54                	push   %r12
+ 130:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 134:	53                   	push   %rbx
+ 135:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 136:	e8 a2 00 00 00       	call   1dd <open>
+  if(fd < 0)
+ 13b:	85 c0                	test   %eax,%eax
+ 13d:	78 16                	js     155 <stat+0x32>
+ 13f:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 141:	89 c7                	mov    %eax,%edi
+ 143:	4c 89 ee             	mov    %r13,%rsi
+ 146:	e8 aa 00 00 00       	call   1f5 <fstat>
+  close(fd);
+ 14b:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 14d:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 150:	e8 70 00 00 00       	call   1c5 <close>
+  return r;
+}
+ 155:	5a                   	pop    %rdx
+ 156:	44 89 e0             	mov    %r12d,%eax
+ 159:	5b                   	pop    %rbx
+ 15a:	41 5c                	pop    %r12
+ 15c:	41 5d                	pop    %r13
+ 15e:	5d                   	pop    %rbp
+ 15f:	c3                   	ret
+
+0000000000000160 <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 160:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 162:	0f be 17             	movsbl (%rdi),%edx
+ 165:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 168:	80 f9 09             	cmp    $0x9,%cl
+ 16b:	77 0c                	ja     179 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 16d:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 170:	48 ff c7             	inc    %rdi
+ 173:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 177:	eb e9                	jmp    162 <atoi+0x2>
+  return n;
+}
+ 179:	c3                   	ret
+
+000000000000017a <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 17a:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 17d:	31 c9                	xor    %ecx,%ecx
+ 17f:	89 d7                	mov    %edx,%edi
+ 181:	29 cf                	sub    %ecx,%edi
+ 183:	85 ff                	test   %edi,%edi
+ 185:	7e 0d                	jle    194 <memmove+0x1a>
+    *dst++ = *src++;
+ 187:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 18b:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 18f:	48 ff c1             	inc    %rcx
+ 192:	eb eb                	jmp    17f <memmove+0x5>
+  return vdst;
+}
+ 194:	c3                   	ret
+
+0000000000000195 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 195:	b8 01 00 00 00       	mov    $0x1,%eax
+ 19a:	cd 40                	int    $0x40
+ 19c:	c3                   	ret
+
+000000000000019d <exit>:
+SYSCALL(exit)
+ 19d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 1a2:	cd 40                	int    $0x40
+ 1a4:	c3                   	ret
+
+00000000000001a5 <wait>:
+SYSCALL(wait)
+ 1a5:	b8 03 00 00 00       	mov    $0x3,%eax
+ 1aa:	cd 40                	int    $0x40
+ 1ac:	c3                   	ret
+
+00000000000001ad <pipe>:
+SYSCALL(pipe)
+ 1ad:	b8 04 00 00 00       	mov    $0x4,%eax
+ 1b2:	cd 40                	int    $0x40
+ 1b4:	c3                   	ret
+
+00000000000001b5 <read>:
+SYSCALL(read)
+ 1b5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 1ba:	cd 40                	int    $0x40
+ 1bc:	c3                   	ret
+
+00000000000001bd <write>:
+SYSCALL(write)
+ 1bd:	b8 10 00 00 00       	mov    $0x10,%eax
+ 1c2:	cd 40                	int    $0x40
+ 1c4:	c3                   	ret
+
+00000000000001c5 <close>:
+SYSCALL(close)
+ 1c5:	b8 15 00 00 00       	mov    $0x15,%eax
+ 1ca:	cd 40                	int    $0x40
+ 1cc:	c3                   	ret
+
+00000000000001cd <kill>:
+SYSCALL(kill)
+ 1cd:	b8 06 00 00 00       	mov    $0x6,%eax
+ 1d2:	cd 40                	int    $0x40
+ 1d4:	c3                   	ret
+
+00000000000001d5 <exec>:
+SYSCALL(exec)
+ 1d5:	b8 07 00 00 00       	mov    $0x7,%eax
+ 1da:	cd 40                	int    $0x40
+ 1dc:	c3                   	ret
+
+00000000000001dd <open>:
+SYSCALL(open)
+ 1dd:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 1e2:	cd 40                	int    $0x40
+ 1e4:	c3                   	ret
+
+00000000000001e5 <mknod>:
+SYSCALL(mknod)
+ 1e5:	b8 11 00 00 00       	mov    $0x11,%eax
+ 1ea:	cd 40                	int    $0x40
+ 1ec:	c3                   	ret
+
+00000000000001ed <unlink>:
+SYSCALL(unlink)
+ 1ed:	b8 12 00 00 00       	mov    $0x12,%eax
+ 1f2:	cd 40                	int    $0x40
+ 1f4:	c3                   	ret
+
+00000000000001f5 <fstat>:
+SYSCALL(fstat)
+ 1f5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 1fa:	cd 40                	int    $0x40
+ 1fc:	c3                   	ret
+
+00000000000001fd <link>:
+SYSCALL(link)
+ 1fd:	b8 13 00 00 00       	mov    $0x13,%eax
+ 202:	cd 40                	int    $0x40
+ 204:	c3                   	ret
+
+0000000000000205 <mkdir>:
+SYSCALL(mkdir)
+ 205:	b8 14 00 00 00       	mov    $0x14,%eax
+ 20a:	cd 40                	int    $0x40
+ 20c:	c3                   	ret
+
+000000000000020d <chdir>:
+SYSCALL(chdir)
+ 20d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 212:	cd 40                	int    $0x40
+ 214:	c3                   	ret
+
+0000000000000215 <dup>:
+SYSCALL(dup)
+ 215:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 21a:	cd 40                	int    $0x40
+ 21c:	c3                   	ret
+
+000000000000021d <getpid>:
+SYSCALL(getpid)
+ 21d:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 222:	cd 40                	int    $0x40
+ 224:	c3                   	ret
+
+0000000000000225 <sbrk>:
+SYSCALL(sbrk)
+ 225:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 22a:	cd 40                	int    $0x40
+ 22c:	c3                   	ret
+
+000000000000022d <sleep>:
+SYSCALL(sleep)
+ 22d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 232:	cd 40                	int    $0x40
+ 234:	c3                   	ret
+
+0000000000000235 <uptime>:
+SYSCALL(uptime)
+ 235:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 23a:	cd 40                	int    $0x40
+ 23c:	c3                   	ret
+
+000000000000023d <chmod>:
+SYSCALL(chmod)
+ 23d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 242:	cd 40                	int    $0x40
+ 244:	c3                   	ret
+
+0000000000000245 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 245:	55                   	push   %rbp
+ 246:	48 89 e5             	mov    %rsp,%rbp
+ 249:	41 54                	push   %r12
+ 24b:	41 89 fc             	mov    %edi,%r12d
+ 24e:	89 d7                	mov    %edx,%edi
+ 250:	53                   	push   %rbx
+ 251:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 255:	85 f6                	test   %esi,%esi
+ 257:	79 0f                	jns    268 <printint+0x23>
+ 259:	80 e1 01             	and    $0x1,%cl
+ 25c:	74 0a                	je     268 <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 25e:	f7 de                	neg    %esi
+    neg = 1;
+ 260:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 266:	eb 03                	jmp    26b <printint+0x26>
+  neg = 0;
+ 268:	45 31 c0             	xor    %r8d,%r8d
+ 26b:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 26d:	89 f0                	mov    %esi,%eax
+ 26f:	31 d2                	xor    %edx,%edx
+ 271:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 274:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 277:	f7 f7                	div    %edi
+ 279:	8a 92 00 06 00 00    	mov    0x600(%rdx),%dl
+ 27f:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 283:	89 f2                	mov    %esi,%edx
+ 285:	89 c6                	mov    %eax,%esi
+ 287:	39 fa                	cmp    %edi,%edx
+ 289:	73 e2                	jae    26d <printint+0x28>
+  if(neg)
+ 28b:	45 85 c0             	test   %r8d,%r8d
+ 28e:	74 0a                	je     29a <printint+0x55>
+    buf[i++] = digits[x % base];
+ 290:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 292:	48 63 c3             	movslq %ebx,%rax
+ 295:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 29a:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 29d:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 2a1:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2a6:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 2aa:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 2ad:	48 ff cb             	dec    %rbx
+ 2b0:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 2b3:	e8 05 ff ff ff       	call   1bd <write>
+  while(--i >= 0)
+ 2b8:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 2bb:	75 e0                	jne    29d <printint+0x58>
+}
+ 2bd:	48 83 c4 20          	add    $0x20,%rsp
+ 2c1:	5b                   	pop    %rbx
+ 2c2:	41 5c                	pop    %r12
+ 2c4:	5d                   	pop    %rbp
+ 2c5:	c3                   	ret
+
+00000000000002c6 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 2c6:	55                   	push   %rbp
+ 2c7:	48 89 e5             	mov    %rsp,%rbp
+ 2ca:	41 55                	push   %r13
+ 2cc:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 2ce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 2d2:	53                   	push   %rbx
+ 2d3:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 2d7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 2db:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 2df:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 2e3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 2e7:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 2eb:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 2ef:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 2f3:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 2f5:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 2fc:	84 c0                	test   %al,%al
+ 2fe:	0f 84 6f 01 00 00    	je     473 <printf+0x1ad>
+ 304:	89 fb                	mov    %edi,%ebx
+ 306:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 309:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 30c:	83 fa 25             	cmp    $0x25,%edx
+ 30f:	75 44                	jne    355 <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 311:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 316:	49 ff c4             	inc    %r12
+ 319:	45 84 ed             	test   %r13b,%r13b
+ 31c:	0f 84 51 01 00 00    	je     473 <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 322:	41 0f b6 c5          	movzbl %r13b,%eax
+ 326:	41 0f be d5          	movsbl %r13b,%edx
+ 32a:	83 f8 64             	cmp    $0x64,%eax
+ 32d:	74 7c                	je     3ab <printf+0xe5>
+ 32f:	7f 29                	jg     35a <printf+0x94>
+ 331:	83 f8 25             	cmp    $0x25,%eax
+ 334:	74 4c                	je     382 <printf+0xbc>
+ 336:	83 f8 63             	cmp    $0x63,%eax
+ 339:	75 33                	jne    36e <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 33b:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 33e:	83 fa 2f             	cmp    $0x2f,%edx
+ 341:	0f 87 1b 01 00 00    	ja     462 <printf+0x19c>
+ 347:	89 d0                	mov    %edx,%eax
+ 349:	83 c2 08             	add    $0x8,%edx
+ 34c:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 350:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 353:	8b 00                	mov    (%rax),%eax
+ 355:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 358:	eb 2c                	jmp    386 <printf+0xc0>
+ 35a:	83 f8 73             	cmp    $0x73,%eax
+ 35d:	0f 84 aa 00 00 00    	je     40d <printf+0x147>
+ 363:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 369:	83 fa 70             	cmp    $0x70,%edx
+ 36c:	74 6b                	je     3d9 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 36e:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 372:	ba 01 00 00 00       	mov    $0x1,%edx
+ 377:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 37b:	89 df                	mov    %ebx,%edi
+ 37d:	e8 3b fe ff ff       	call   1bd <write>
+        putc(fd, c);
+ 382:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 386:	ba 01 00 00 00       	mov    $0x1,%edx
+ 38b:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 38f:	89 df                	mov    %ebx,%edi
+ 391:	e8 27 fe ff ff       	call   1bd <write>
+  for(i = 0; fmt[i]; i++){
+ 396:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 39b:	49 ff c4             	inc    %r12
+ 39e:	84 c0                	test   %al,%al
+ 3a0:	0f 85 63 ff ff ff    	jne    309 <printf+0x43>
+ 3a6:	e9 c8 00 00 00       	jmp    473 <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 3ab:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3ae:	83 fa 2f             	cmp    $0x2f,%edx
+ 3b1:	77 0e                	ja     3c1 <printf+0xfb>
+ 3b3:	89 d0                	mov    %edx,%eax
+ 3b5:	83 c2 08             	add    $0x8,%edx
+ 3b8:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3bc:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3bf:	eb 0c                	jmp    3cd <printf+0x107>
+ 3c1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3c5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3c9:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3cd:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3d2:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 3d7:	eb 29                	jmp    402 <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 3d9:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3dc:	83 fa 2f             	cmp    $0x2f,%edx
+ 3df:	77 0e                	ja     3ef <printf+0x129>
+ 3e1:	89 d0                	mov    %edx,%eax
+ 3e3:	83 c2 08             	add    $0x8,%edx
+ 3e6:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3ea:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3ed:	eb 0c                	jmp    3fb <printf+0x135>
+ 3ef:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3f3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3f7:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3fb:	31 c9                	xor    %ecx,%ecx
+ 3fd:	ba 10 00 00 00       	mov    $0x10,%edx
+ 402:	8b 30                	mov    (%rax),%esi
+ 404:	89 df                	mov    %ebx,%edi
+ 406:	e8 3a fe ff ff       	call   245 <printint>
+ 40b:	eb 89                	jmp    396 <printf+0xd0>
+        s = va_arg(ap, char*);
+ 40d:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 410:	83 fa 2f             	cmp    $0x2f,%edx
+ 413:	77 0e                	ja     423 <printf+0x15d>
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	83 c2 08             	add    $0x8,%edx
+ 41a:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 41e:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 421:	eb 0c                	jmp    42f <printf+0x169>
+ 423:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 427:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 42b:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 42f:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 432:	4d 85 ed             	test   %r13,%r13
+ 435:	75 07                	jne    43e <printf+0x178>
+          s = "(null)";
+ 437:	49 c7 c5 ed 05 00 00 	mov    $0x5ed,%r13
+        while(*s != 0){
+ 43e:	41 8a 45 00          	mov    0x0(%r13),%al
+ 442:	84 c0                	test   %al,%al
+ 444:	0f 84 4c ff ff ff    	je     396 <printf+0xd0>
+          putc(fd, *s);
+ 44a:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 44d:	ba 01 00 00 00       	mov    $0x1,%edx
+ 452:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 456:	89 df                	mov    %ebx,%edi
+          s++;
+ 458:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 45b:	e8 5d fd ff ff       	call   1bd <write>
+          s++;
+ 460:	eb dc                	jmp    43e <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 462:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 466:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 46a:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 46e:	e9 e0 fe ff ff       	jmp    353 <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 473:	48 83 c4 58          	add    $0x58,%rsp
+ 477:	5b                   	pop    %rbx
+ 478:	41 5c                	pop    %r12
+ 47a:	41 5d                	pop    %r13
+ 47c:	5d                   	pop    %rbp
+ 47d:	c3                   	ret
+
+000000000000047e <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 47e:	48 8b 05 5b 03 00 00 	mov    0x35b(%rip),%rax        # 7e0 <freep>
+{
+ 485:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 488:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 48c:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 48f:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 492:	48 39 f2             	cmp    %rsi,%rdx
+ 495:	72 0c                	jb     4a3 <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 497:	48 39 c6             	cmp    %rax,%rsi
+ 49a:	73 f0                	jae    48c <free+0xe>
+ 49c:	48 39 c2             	cmp    %rax,%rdx
+ 49f:	72 eb                	jb     48c <free+0xe>
+ 4a1:	eb 05                	jmp    4a8 <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 4a3:	48 39 c6             	cmp    %rax,%rsi
+ 4a6:	73 f4                	jae    49c <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 4a8:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 4ab:	49 89 f8             	mov    %rdi,%r8
+ 4ae:	48 c1 e7 04          	shl    $0x4,%rdi
+ 4b2:	48 01 f7             	add    %rsi,%rdi
+ 4b5:	48 39 f8             	cmp    %rdi,%rax
+ 4b8:	75 0e                	jne    4c8 <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 4ba:	44 03 40 08          	add    0x8(%rax),%r8d
+ 4be:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 4c2:	48 8b 02             	mov    (%rdx),%rax
+ 4c5:	48 8b 00             	mov    (%rax),%rax
+ 4c8:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 4cc:	8b 42 08             	mov    0x8(%rdx),%eax
+ 4cf:	48 89 c7             	mov    %rax,%rdi
+ 4d2:	48 c1 e0 04          	shl    $0x4,%rax
+ 4d6:	48 01 d0             	add    %rdx,%rax
+ 4d9:	48 39 c6             	cmp    %rax,%rsi
+ 4dc:	75 0a                	jne    4e8 <free+0x6a>
+    p->s.size += bp->s.size;
+ 4de:	03 79 f8             	add    -0x8(%rcx),%edi
+ 4e1:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 4e4:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 4e8:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 4eb:	48 89 15 ee 02 00 00 	mov    %rdx,0x2ee(%rip)        # 7e0 <freep>
+}
+ 4f2:	c3                   	ret
+
+00000000000004f3 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 4f3:	55                   	push   %rbp
+ 4f4:	48 89 e5             	mov    %rsp,%rbp
+ 4f7:	41 55                	push   %r13
+ 4f9:	41 54                	push   %r12
+ 4fb:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4fc:	89 fb                	mov    %edi,%ebx
+{
+ 4fe:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4ff:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 503:	48 8b 0d d6 02 00 00 	mov    0x2d6(%rip),%rcx        # 7e0 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 50a:	48 c1 eb 04          	shr    $0x4,%rbx
+ 50e:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 510:	48 85 c9             	test   %rcx,%rcx
+ 513:	75 25                	jne    53a <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 515:	48 c7 05 c0 02 00 00 	movq   $0x7f0,0x2c0(%rip)        # 7e0 <freep>
+ 51c:	f0 07 00 00 
+    base.s.size = 0;
+ 520:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 522:	48 c7 05 c3 02 00 00 	movq   $0x7f0,0x2c3(%rip)        # 7f0 <base>
+ 529:	f0 07 00 00 
+    base.s.size = 0;
+ 52d:	89 0d c5 02 00 00    	mov    %ecx,0x2c5(%rip)        # 7f8 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 533:	48 c7 c1 f0 07 00 00 	mov    $0x7f0,%rcx
+  if(nu < 4096)
+ 53a:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 540:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 543:	44 39 e3             	cmp    %r12d,%ebx
+ 546:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 54a:	45 89 e5             	mov    %r12d,%r13d
+ 54d:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 551:	8b 50 08             	mov    0x8(%rax),%edx
+ 554:	39 da                	cmp    %ebx,%edx
+ 556:	72 26                	jb     57e <malloc+0x8b>
+      if(p->s.size == nunits)
+ 558:	75 08                	jne    562 <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 55a:	48 8b 10             	mov    (%rax),%rdx
+ 55d:	48 89 11             	mov    %rdx,(%rcx)
+ 560:	eb 0f                	jmp    571 <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 562:	29 da                	sub    %ebx,%edx
+ 564:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 567:	48 c1 e2 04          	shl    $0x4,%rdx
+ 56b:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 56e:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 571:	48 89 0d 68 02 00 00 	mov    %rcx,0x268(%rip)        # 7e0 <freep>
+      return (void*)(p + 1);
+ 578:	48 83 c0 10          	add    $0x10,%rax
+ 57c:	eb 3a                	jmp    5b8 <malloc+0xc5>
+    }
+    if(p == freep)
+ 57e:	48 39 05 5b 02 00 00 	cmp    %rax,0x25b(%rip)        # 7e0 <freep>
+ 585:	75 27                	jne    5ae <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 587:	44 89 ef             	mov    %r13d,%edi
+ 58a:	e8 96 fc ff ff       	call   225 <sbrk>
+  if(p == (char*)-1)
+ 58f:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 593:	74 21                	je     5b6 <malloc+0xc3>
+  hp->s.size = nu;
+ 595:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 599:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 59d:	e8 dc fe ff ff       	call   47e <free>
+  return freep;
+ 5a2:	48 8b 05 37 02 00 00 	mov    0x237(%rip),%rax        # 7e0 <freep>
+      if((p = morecore(nunits)) == 0)
+ 5a9:	48 85 c0             	test   %rax,%rax
+ 5ac:	74 08                	je     5b6 <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 5ae:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 5b1:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 5b4:	eb 9b                	jmp    551 <malloc+0x5e>
+        return 0;
+ 5b6:	31 c0                	xor    %eax,%eax
+  }
+}
+ 5b8:	5a                   	pop    %rdx
+ 5b9:	5b                   	pop    %rbx
+ 5ba:	41 5c                	pop    %r12
+ 5bc:	41 5d                	pop    %r13
+ 5be:	5d                   	pop    %rbp
+ 5bf:	c3                   	ret
@@ -0,0 +1,2099 @@
+
+.fs/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+  static char buf[100];
+  int fd;
+  
+  // Assumes three file descriptors open.
+  while((fd = open("console", O_RDWR)) >= 0){
+   4:	48 c7 c7 51 0f 00 00 	mov    $0xf51,%rdi
+   b:	be 02 00 00 00       	mov    $0x2,%esi
+  10:	e8 ab 0a 00 00       	call   ac0 <open>
+  15:	89 c7                	mov    %eax,%edi
+  17:	85 c0                	test   %eax,%eax
+  19:	78 66                	js     81 <main+0x81>
+    if(fd >= 3){
+  1b:	83 ff 02             	cmp    $0x2,%edi
+  1e:	7e e4                	jle    4 <main+0x4>
+      close(fd);
+  20:	e8 83 0a 00 00       	call   aa8 <close>
+      break;
+  25:	eb 5a                	jmp    81 <main+0x81>
+    }
+  }
+  
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+  27:	80 3d d2 14 00 00 63 	cmpb   $0x63,0x14d2(%rip)        # 1500 <buf.0>
+  2e:	75 68                	jne    98 <main+0x98>
+  30:	80 3d ca 14 00 00 64 	cmpb   $0x64,0x14ca(%rip)        # 1501 <buf.0+0x1>
+  37:	75 5f                	jne    98 <main+0x98>
+  39:	80 3d c2 14 00 00 20 	cmpb   $0x20,0x14c2(%rip)        # 1502 <buf.0+0x2>
+  40:	75 56                	jne    98 <main+0x98>
+      // Clumsy but will have to do for now.
+      // Chdir has no effect on the parent if run in the child.
+      buf[strlen(buf)-1] = 0;  // chop \n
+  42:	48 c7 c7 00 15 00 00 	mov    $0x1500,%rdi
+  49:	e8 1f 09 00 00       	call   96d <strlen>
+      if(chdir(buf+3) < 0)
+  4e:	48 c7 c7 03 15 00 00 	mov    $0x1503,%rdi
+      buf[strlen(buf)-1] = 0;  // chop \n
+  55:	ff c8                	dec    %eax
+  57:	c6 80 00 15 00 00 00 	movb   $0x0,0x1500(%rax)
+      if(chdir(buf+3) < 0)
+  5e:	e8 8d 0a 00 00       	call   af0 <chdir>
+  63:	85 c0                	test   %eax,%eax
+  65:	79 1a                	jns    81 <main+0x81>
+        printf(2, "cannot cd %s\n", buf+3);
+  67:	48 c7 c2 03 15 00 00 	mov    $0x1503,%rdx
+  6e:	48 c7 c6 59 0f 00 00 	mov    $0xf59,%rsi
+  75:	bf 02 00 00 00       	mov    $0x2,%edi
+  7a:	31 c0                	xor    %eax,%eax
+  7c:	e8 28 0b 00 00       	call   ba9 <printf>
+  while(getcmd(buf, sizeof(buf)) >= 0){
+  81:	be 64 00 00 00       	mov    $0x64,%esi
+  86:	48 c7 c7 00 15 00 00 	mov    $0x1500,%rdi
+  8d:	e8 2f 00 00 00       	call   c1 <getcmd>
+  92:	85 c0                	test   %eax,%eax
+  94:	79 91                	jns    27 <main+0x27>
+  96:	eb 24                	jmp    bc <main+0xbc>
+      continue;
+    }
+    if(fork1() == 0)
+  98:	e8 85 00 00 00       	call   122 <fork1>
+  9d:	85 c0                	test   %eax,%eax
+  9f:	75 14                	jne    b5 <main+0xb5>
+      runcmd(parsecmd(buf));
+  a1:	48 c7 c7 00 15 00 00 	mov    $0x1500,%rdi
+  a8:	e8 1d 08 00 00       	call   8ca <parsecmd>
+  ad:	48 89 c7             	mov    %rax,%rdi
+  b0:	e8 89 00 00 00       	call   13e <runcmd>
+    wait();
+  b5:	e8 ce 09 00 00       	call   a88 <wait>
+  ba:	eb c5                	jmp    81 <main+0x81>
+  }
+  exit();
+  bc:	e8 bf 09 00 00       	call   a80 <exit>
+
+00000000000000c1 <getcmd>:
+{
+  c1:	55                   	push   %rbp
+  printf(2, "$ ");
+  c2:	31 c0                	xor    %eax,%eax
+{
+  c4:	48 89 e5             	mov    %rsp,%rbp
+  c7:	41 54                	push   %r12
+  c9:	41 89 f4             	mov    %esi,%r12d
+  printf(2, "$ ");
+  cc:	48 c7 c6 b0 0e 00 00 	mov    $0xeb0,%rsi
+{
+  d3:	53                   	push   %rbx
+  d4:	48 89 fb             	mov    %rdi,%rbx
+  printf(2, "$ ");
+  d7:	bf 02 00 00 00       	mov    $0x2,%edi
+  dc:	e8 c8 0a 00 00       	call   ba9 <printf>
+  memset(buf, 0, nbuf);
+  e1:	44 89 e2             	mov    %r12d,%edx
+  e4:	31 f6                	xor    %esi,%esi
+  e6:	48 89 df             	mov    %rbx,%rdi
+  e9:	e8 8f 08 00 00       	call   97d <memset>
+  gets(buf, nbuf);
+  ee:	44 89 e6             	mov    %r12d,%esi
+  f1:	48 89 df             	mov    %rbx,%rdi
+  f4:	e8 a8 08 00 00       	call   9a1 <gets>
+  if(buf[0] == 0) // EOF
+  f9:	80 3b 01             	cmpb   $0x1,(%rbx)
+}
+  fc:	5b                   	pop    %rbx
+  if(buf[0] == 0) // EOF
+  fd:	19 c0                	sbb    %eax,%eax
+}
+  ff:	41 5c                	pop    %r12
+ 101:	5d                   	pop    %rbp
+ 102:	c3                   	ret
+
+0000000000000103 <panic>:
+}
+
+void
+panic(char *s)
+{
+ 103:	55                   	push   %rbp
+ 104:	48 89 fa             	mov    %rdi,%rdx
+  printf(2, "%s\n", s);
+ 107:	48 c7 c6 4d 0f 00 00 	mov    $0xf4d,%rsi
+ 10e:	bf 02 00 00 00       	mov    $0x2,%edi
+ 113:	31 c0                	xor    %eax,%eax
+{
+ 115:	48 89 e5             	mov    %rsp,%rbp
+  printf(2, "%s\n", s);
+ 118:	e8 8c 0a 00 00       	call   ba9 <printf>
+  exit();
+ 11d:	e8 5e 09 00 00       	call   a80 <exit>
+
+0000000000000122 <fork1>:
+}
+
+int
+fork1(void)
+{
+ 122:	55                   	push   %rbp
+ 123:	48 89 e5             	mov    %rsp,%rbp
+  int pid;
+  
+  pid = fork();
+ 126:	e8 4d 09 00 00       	call   a78 <fork>
+  if(pid == -1)
+ 12b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 12e:	75 0c                	jne    13c <fork1+0x1a>
+    panic("fork");
+ 130:	48 c7 c7 b3 0e 00 00 	mov    $0xeb3,%rdi
+ 137:	e8 c7 ff ff ff       	call   103 <panic>
+  return pid;
+}
+ 13c:	5d                   	pop    %rbp
+ 13d:	c3                   	ret
+
+000000000000013e <runcmd>:
+{
+ 13e:	55                   	push   %rbp
+ 13f:	48 89 e5             	mov    %rsp,%rbp
+ 142:	53                   	push   %rbx
+ 143:	48 83 ec 18          	sub    $0x18,%rsp
+  if(cmd == 0)
+ 147:	48 85 ff             	test   %rdi,%rdi
+ 14a:	74 6e                	je     1ba <runcmd+0x7c>
+  switch(cmd->type){
+ 14c:	8b 07                	mov    (%rdi),%eax
+ 14e:	48 89 fb             	mov    %rdi,%rbx
+ 151:	ff c8                	dec    %eax
+ 153:	83 f8 04             	cmp    $0x4,%eax
+ 156:	77 07                	ja     15f <runcmd+0x21>
+ 158:	ff 24 c5 68 0f 00 00 	jmp    *0xf68(,%rax,8)
+    panic("runcmd");
+ 15f:	48 c7 c7 b8 0e 00 00 	mov    $0xeb8,%rdi
+ 166:	eb 7f                	jmp    1e7 <runcmd+0xa9>
+    if(ecmd->argv[0] == 0)
+ 168:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+ 16c:	48 85 ff             	test   %rdi,%rdi
+ 16f:	74 49                	je     1ba <runcmd+0x7c>
+    exec(ecmd->argv[0], ecmd->argv);
+ 171:	48 8d 73 08          	lea    0x8(%rbx),%rsi
+ 175:	e8 3e 09 00 00       	call   ab8 <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+ 17a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+ 17e:	48 c7 c6 bf 0e 00 00 	mov    $0xebf,%rsi
+ 185:	eb 27                	jmp    1ae <runcmd+0x70>
+    close(rcmd->fd);
+ 187:	8b 7f 24             	mov    0x24(%rdi),%edi
+ 18a:	e8 19 09 00 00       	call   aa8 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+ 18f:	8b 73 20             	mov    0x20(%rbx),%esi
+ 192:	48 8b 7b 10          	mov    0x10(%rbx),%rdi
+ 196:	e8 25 09 00 00       	call   ac0 <open>
+ 19b:	85 c0                	test   %eax,%eax
+ 19d:	0f 89 d0 00 00 00    	jns    273 <runcmd+0x135>
+      printf(2, "open %s failed\n", rcmd->file);
+ 1a3:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+ 1a7:	48 c7 c6 cf 0e 00 00 	mov    $0xecf,%rsi
+ 1ae:	bf 02 00 00 00       	mov    $0x2,%edi
+ 1b3:	31 c0                	xor    %eax,%eax
+ 1b5:	e8 ef 09 00 00       	call   ba9 <printf>
+      exit();
+ 1ba:	e8 c1 08 00 00       	call   a80 <exit>
+    if(fork1() == 0)
+ 1bf:	e8 5e ff ff ff       	call   122 <fork1>
+ 1c4:	85 c0                	test   %eax,%eax
+ 1c6:	0f 84 a7 00 00 00    	je     273 <runcmd+0x135>
+    wait();
+ 1cc:	e8 b7 08 00 00       	call   a88 <wait>
+    runcmd(lcmd->right);
+ 1d1:	eb 6e                	jmp    241 <runcmd+0x103>
+    if(pipe(p) < 0)
+ 1d3:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+ 1d7:	e8 b4 08 00 00       	call   a90 <pipe>
+ 1dc:	85 c0                	test   %eax,%eax
+ 1de:	79 0c                	jns    1ec <runcmd+0xae>
+      panic("pipe");
+ 1e0:	48 c7 c7 df 0e 00 00 	mov    $0xedf,%rdi
+ 1e7:	e8 17 ff ff ff       	call   103 <panic>
+    if(fork1() == 0){
+ 1ec:	e8 31 ff ff ff       	call   122 <fork1>
+ 1f1:	85 c0                	test   %eax,%eax
+ 1f3:	75 24                	jne    219 <runcmd+0xdb>
+      close(1);
+ 1f5:	bf 01 00 00 00       	mov    $0x1,%edi
+ 1fa:	e8 a9 08 00 00       	call   aa8 <close>
+      dup(p[1]);
+ 1ff:	8b 7d ec             	mov    -0x14(%rbp),%edi
+ 202:	e8 f1 08 00 00       	call   af8 <dup>
+      close(p[0]);
+ 207:	8b 7d e8             	mov    -0x18(%rbp),%edi
+ 20a:	e8 99 08 00 00       	call   aa8 <close>
+      close(p[1]);
+ 20f:	8b 7d ec             	mov    -0x14(%rbp),%edi
+ 212:	e8 91 08 00 00       	call   aa8 <close>
+      runcmd(pcmd->left);
+ 217:	eb 5a                	jmp    273 <runcmd+0x135>
+    if(fork1() == 0){
+ 219:	e8 04 ff ff ff       	call   122 <fork1>
+ 21e:	85 c0                	test   %eax,%eax
+ 220:	75 25                	jne    247 <runcmd+0x109>
+      close(0);
+ 222:	31 ff                	xor    %edi,%edi
+ 224:	e8 7f 08 00 00       	call   aa8 <close>
+      dup(p[0]);
+ 229:	8b 7d e8             	mov    -0x18(%rbp),%edi
+ 22c:	e8 c7 08 00 00       	call   af8 <dup>
+      close(p[0]);
+ 231:	8b 7d e8             	mov    -0x18(%rbp),%edi
+ 234:	e8 6f 08 00 00       	call   aa8 <close>
+      close(p[1]);
+ 239:	8b 7d ec             	mov    -0x14(%rbp),%edi
+ 23c:	e8 67 08 00 00       	call   aa8 <close>
+      runcmd(pcmd->right);
+ 241:	48 8b 7b 10          	mov    0x10(%rbx),%rdi
+ 245:	eb 30                	jmp    277 <runcmd+0x139>
+    close(p[0]);
+ 247:	8b 7d e8             	mov    -0x18(%rbp),%edi
+ 24a:	e8 59 08 00 00       	call   aa8 <close>
+    close(p[1]);
+ 24f:	8b 7d ec             	mov    -0x14(%rbp),%edi
+ 252:	e8 51 08 00 00       	call   aa8 <close>
+    wait();
+ 257:	e8 2c 08 00 00       	call   a88 <wait>
+    wait();
+ 25c:	e8 27 08 00 00       	call   a88 <wait>
+    break;
+ 261:	e9 54 ff ff ff       	jmp    1ba <runcmd+0x7c>
+    if(fork1() == 0)
+ 266:	e8 b7 fe ff ff       	call   122 <fork1>
+ 26b:	85 c0                	test   %eax,%eax
+ 26d:	0f 85 47 ff ff ff    	jne    1ba <runcmd+0x7c>
+      runcmd(bcmd->cmd);
+ 273:	48 8b 7b 08          	mov    0x8(%rbx),%rdi
+ 277:	e8 c2 fe ff ff       	call   13e <runcmd>
+
+000000000000027c <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+ 27c:	55                   	push   %rbp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+ 27d:	bf a8 00 00 00       	mov    $0xa8,%edi
+{
+ 282:	48 89 e5             	mov    %rsp,%rbp
+ 285:	53                   	push   %rbx
+ 286:	50                   	push   %rax
+  cmd = malloc(sizeof(*cmd));
+ 287:	e8 4a 0b 00 00       	call   dd6 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+ 28c:	ba a8 00 00 00       	mov    $0xa8,%edx
+ 291:	31 f6                	xor    %esi,%esi
+  cmd = malloc(sizeof(*cmd));
+ 293:	48 89 c3             	mov    %rax,%rbx
+  memset(cmd, 0, sizeof(*cmd));
+ 296:	48 89 c7             	mov    %rax,%rdi
+ 299:	e8 df 06 00 00       	call   97d <memset>
+  cmd->type = EXEC;
+ 29e:	c7 03 01 00 00 00    	movl   $0x1,(%rbx)
+  return (struct cmd*)cmd;
+}
+ 2a4:	48 89 d8             	mov    %rbx,%rax
+ 2a7:	5a                   	pop    %rdx
+ 2a8:	5b                   	pop    %rbx
+ 2a9:	5d                   	pop    %rbp
+ 2aa:	c3                   	ret
+
+00000000000002ab <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+ 2ab:	55                   	push   %rbp
+ 2ac:	48 89 e5             	mov    %rsp,%rbp
+ 2af:	41 57                	push   %r15
+ 2b1:	49 89 f7             	mov    %rsi,%r15
+ 2b4:	41 56                	push   %r14
+ 2b6:	49 89 d6             	mov    %rdx,%r14
+ 2b9:	41 55                	push   %r13
+ 2bb:	41 89 cd             	mov    %ecx,%r13d
+ 2be:	41 54                	push   %r12
+ 2c0:	45 89 c4             	mov    %r8d,%r12d
+ 2c3:	53                   	push   %rbx
+ 2c4:	48 83 ec 18          	sub    $0x18,%rsp
+ 2c8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+ 2cc:	bf 28 00 00 00       	mov    $0x28,%edi
+ 2d1:	e8 00 0b 00 00       	call   dd6 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+ 2d6:	ba 28 00 00 00       	mov    $0x28,%edx
+ 2db:	31 f6                	xor    %esi,%esi
+ 2dd:	48 89 c7             	mov    %rax,%rdi
+  cmd = malloc(sizeof(*cmd));
+ 2e0:	48 89 c3             	mov    %rax,%rbx
+  memset(cmd, 0, sizeof(*cmd));
+ 2e3:	e8 95 06 00 00       	call   97d <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+ 2e8:	4c 8b 4d c8          	mov    -0x38(%rbp),%r9
+  cmd->file = file;
+ 2ec:	4c 89 7b 10          	mov    %r15,0x10(%rbx)
+  cmd->efile = efile;
+  cmd->mode = mode;
+  cmd->fd = fd;
+  return (struct cmd*)cmd;
+}
+ 2f0:	48 89 d8             	mov    %rbx,%rax
+  cmd->type = REDIR;
+ 2f3:	c7 03 02 00 00 00    	movl   $0x2,(%rbx)
+  cmd->cmd = subcmd;
+ 2f9:	4c 89 4b 08          	mov    %r9,0x8(%rbx)
+  cmd->efile = efile;
+ 2fd:	4c 89 73 18          	mov    %r14,0x18(%rbx)
+  cmd->mode = mode;
+ 301:	44 89 6b 20          	mov    %r13d,0x20(%rbx)
+  cmd->fd = fd;
+ 305:	44 89 63 24          	mov    %r12d,0x24(%rbx)
+}
+ 309:	48 83 c4 18          	add    $0x18,%rsp
+ 30d:	5b                   	pop    %rbx
+ 30e:	41 5c                	pop    %r12
+ 310:	41 5d                	pop    %r13
+ 312:	41 5e                	pop    %r14
+ 314:	41 5f                	pop    %r15
+ 316:	5d                   	pop    %rbp
+ 317:	c3                   	ret
+
+0000000000000318 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+ 318:	55                   	push   %rbp
+ 319:	48 89 e5             	mov    %rsp,%rbp
+ 31c:	41 55                	push   %r13
+ 31e:	49 89 fd             	mov    %rdi,%r13
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+ 321:	bf 18 00 00 00       	mov    $0x18,%edi
+{
+ 326:	41 54                	push   %r12
+ 328:	49 89 f4             	mov    %rsi,%r12
+ 32b:	53                   	push   %rbx
+ 32c:	50                   	push   %rax
+  cmd = malloc(sizeof(*cmd));
+ 32d:	e8 a4 0a 00 00       	call   dd6 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+ 332:	ba 18 00 00 00       	mov    $0x18,%edx
+ 337:	31 f6                	xor    %esi,%esi
+  cmd = malloc(sizeof(*cmd));
+ 339:	48 89 c3             	mov    %rax,%rbx
+  memset(cmd, 0, sizeof(*cmd));
+ 33c:	48 89 c7             	mov    %rax,%rdi
+ 33f:	e8 39 06 00 00       	call   97d <memset>
+  cmd->type = PIPE;
+ 344:	c7 03 03 00 00 00    	movl   $0x3,(%rbx)
+  cmd->left = left;
+  cmd->right = right;
+  return (struct cmd*)cmd;
+}
+ 34a:	48 89 d8             	mov    %rbx,%rax
+  cmd->left = left;
+ 34d:	4c 89 6b 08          	mov    %r13,0x8(%rbx)
+  cmd->right = right;
+ 351:	4c 89 63 10          	mov    %r12,0x10(%rbx)
+}
+ 355:	5a                   	pop    %rdx
+ 356:	5b                   	pop    %rbx
+ 357:	41 5c                	pop    %r12
+ 359:	41 5d                	pop    %r13
+ 35b:	5d                   	pop    %rbp
+ 35c:	c3                   	ret
+
+000000000000035d <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+ 35d:	55                   	push   %rbp
+ 35e:	48 89 e5             	mov    %rsp,%rbp
+ 361:	41 55                	push   %r13
+ 363:	49 89 fd             	mov    %rdi,%r13
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+ 366:	bf 18 00 00 00       	mov    $0x18,%edi
+{
+ 36b:	41 54                	push   %r12
+ 36d:	49 89 f4             	mov    %rsi,%r12
+ 370:	53                   	push   %rbx
+ 371:	50                   	push   %rax
+  cmd = malloc(sizeof(*cmd));
+ 372:	e8 5f 0a 00 00       	call   dd6 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+ 377:	ba 18 00 00 00       	mov    $0x18,%edx
+ 37c:	31 f6                	xor    %esi,%esi
+  cmd = malloc(sizeof(*cmd));
+ 37e:	48 89 c3             	mov    %rax,%rbx
+  memset(cmd, 0, sizeof(*cmd));
+ 381:	48 89 c7             	mov    %rax,%rdi
+ 384:	e8 f4 05 00 00       	call   97d <memset>
+  cmd->type = LIST;
+ 389:	c7 03 04 00 00 00    	movl   $0x4,(%rbx)
+  cmd->left = left;
+  cmd->right = right;
+  return (struct cmd*)cmd;
+}
+ 38f:	48 89 d8             	mov    %rbx,%rax
+  cmd->left = left;
+ 392:	4c 89 6b 08          	mov    %r13,0x8(%rbx)
+  cmd->right = right;
+ 396:	4c 89 63 10          	mov    %r12,0x10(%rbx)
+}
+ 39a:	5a                   	pop    %rdx
+ 39b:	5b                   	pop    %rbx
+ 39c:	41 5c                	pop    %r12
+ 39e:	41 5d                	pop    %r13
+ 3a0:	5d                   	pop    %rbp
+ 3a1:	c3                   	ret
+
+00000000000003a2 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+ 3a2:	55                   	push   %rbp
+ 3a3:	48 89 e5             	mov    %rsp,%rbp
+ 3a6:	41 54                	push   %r12
+ 3a8:	49 89 fc             	mov    %rdi,%r12
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+ 3ab:	bf 10 00 00 00       	mov    $0x10,%edi
+{
+ 3b0:	53                   	push   %rbx
+  cmd = malloc(sizeof(*cmd));
+ 3b1:	e8 20 0a 00 00       	call   dd6 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+ 3b6:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3bb:	31 f6                	xor    %esi,%esi
+  cmd = malloc(sizeof(*cmd));
+ 3bd:	48 89 c3             	mov    %rax,%rbx
+  memset(cmd, 0, sizeof(*cmd));
+ 3c0:	48 89 c7             	mov    %rax,%rdi
+ 3c3:	e8 b5 05 00 00       	call   97d <memset>
+  cmd->type = BACK;
+ 3c8:	c7 03 05 00 00 00    	movl   $0x5,(%rbx)
+  cmd->cmd = subcmd;
+  return (struct cmd*)cmd;
+}
+ 3ce:	48 89 d8             	mov    %rbx,%rax
+  cmd->cmd = subcmd;
+ 3d1:	4c 89 63 08          	mov    %r12,0x8(%rbx)
+}
+ 3d5:	5b                   	pop    %rbx
+ 3d6:	41 5c                	pop    %r12
+ 3d8:	5d                   	pop    %rbp
+ 3d9:	c3                   	ret
+
+00000000000003da <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+ 3da:	55                   	push   %rbp
+ 3db:	48 89 e5             	mov    %rsp,%rbp
+ 3de:	41 57                	push   %r15
+ 3e0:	49 89 d7             	mov    %rdx,%r15
+ 3e3:	41 56                	push   %r14
+ 3e5:	49 89 ce             	mov    %rcx,%r14
+ 3e8:	41 55                	push   %r13
+ 3ea:	49 89 fd             	mov    %rdi,%r13
+ 3ed:	41 54                	push   %r12
+ 3ef:	49 89 f4             	mov    %rsi,%r12
+ 3f2:	53                   	push   %rbx
+ 3f3:	41 50                	push   %r8
+  char *s;
+  int ret;
+  
+  s = *ps;
+ 3f5:	48 8b 1f             	mov    (%rdi),%rbx
+  while(s < es && strchr(whitespace, *s))
+ 3f8:	4c 39 e3             	cmp    %r12,%rbx
+ 3fb:	72 0a                	jb     407 <gettoken+0x2d>
+    s++;
+  if(q)
+ 3fd:	4d 85 ff             	test   %r15,%r15
+ 400:	74 1e                	je     420 <gettoken+0x46>
+    *q = s;
+ 402:	49 89 1f             	mov    %rbx,(%r15)
+ 405:	eb 19                	jmp    420 <gettoken+0x46>
+  while(s < es && strchr(whitespace, *s))
+ 407:	0f be 33             	movsbl (%rbx),%esi
+ 40a:	48 c7 c7 e8 14 00 00 	mov    $0x14e8,%rdi
+ 411:	e8 75 05 00 00       	call   98b <strchr>
+ 416:	48 85 c0             	test   %rax,%rax
+ 419:	74 e2                	je     3fd <gettoken+0x23>
+    s++;
+ 41b:	48 ff c3             	inc    %rbx
+ 41e:	eb d8                	jmp    3f8 <gettoken+0x1e>
+  ret = *s;
+ 420:	8a 03                	mov    (%rbx),%al
+  switch(*s){
+ 422:	3c 3c                	cmp    $0x3c,%al
+ 424:	7f 1b                	jg     441 <gettoken+0x67>
+ 426:	3c 3a                	cmp    $0x3a,%al
+ 428:	7f 1f                	jg     449 <gettoken+0x6f>
+ 42a:	45 31 ff             	xor    %r15d,%r15d
+ 42d:	84 c0                	test   %al,%al
+ 42f:	74 74                	je     4a5 <gettoken+0xcb>
+ 431:	78 67                	js     49a <gettoken+0xc0>
+ 433:	3c 26                	cmp    $0x26,%al
+ 435:	74 12                	je     449 <gettoken+0x6f>
+ 437:	8d 50 d8             	lea    -0x28(%rax),%edx
+ 43a:	80 fa 01             	cmp    $0x1,%dl
+ 43d:	77 5b                	ja     49a <gettoken+0xc0>
+ 43f:	eb 08                	jmp    449 <gettoken+0x6f>
+ 441:	3c 3e                	cmp    $0x3e,%al
+ 443:	74 0d                	je     452 <gettoken+0x78>
+ 445:	3c 7c                	cmp    $0x7c,%al
+ 447:	75 51                	jne    49a <gettoken+0xc0>
+  ret = *s;
+ 449:	44 0f be f8          	movsbl %al,%r15d
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+ 44d:	48 ff c3             	inc    %rbx
+    break;
+ 450:	eb 53                	jmp    4a5 <gettoken+0xcb>
+  case '>':
+    s++;
+    if(*s == '>'){
+ 452:	80 7b 01 3e          	cmpb   $0x3e,0x1(%rbx)
+ 456:	74 0b                	je     463 <gettoken+0x89>
+    s++;
+ 458:	48 ff c3             	inc    %rbx
+  ret = *s;
+ 45b:	41 bf 3e 00 00 00    	mov    $0x3e,%r15d
+ 461:	eb 42                	jmp    4a5 <gettoken+0xcb>
+      ret = '+';
+      s++;
+ 463:	48 83 c3 02          	add    $0x2,%rbx
+      ret = '+';
+ 467:	41 bf 2b 00 00 00    	mov    $0x2b,%r15d
+ 46d:	eb 36                	jmp    4a5 <gettoken+0xcb>
+    }
+    break;
+  default:
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+ 46f:	0f be 33             	movsbl (%rbx),%esi
+ 472:	48 c7 c7 e8 14 00 00 	mov    $0x14e8,%rdi
+ 479:	e8 0d 05 00 00       	call   98b <strchr>
+ 47e:	48 85 c0             	test   %rax,%rax
+ 481:	75 1c                	jne    49f <gettoken+0xc5>
+ 483:	0f be 33             	movsbl (%rbx),%esi
+ 486:	48 c7 c7 e0 14 00 00 	mov    $0x14e0,%rdi
+ 48d:	e8 f9 04 00 00       	call   98b <strchr>
+ 492:	48 85 c0             	test   %rax,%rax
+ 495:	75 08                	jne    49f <gettoken+0xc5>
+      s++;
+ 497:	48 ff c3             	inc    %rbx
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+ 49a:	4c 39 e3             	cmp    %r12,%rbx
+ 49d:	72 d0                	jb     46f <gettoken+0x95>
+    ret = 'a';
+ 49f:	41 bf 61 00 00 00    	mov    $0x61,%r15d
+    break;
+  }
+  if(eq)
+ 4a5:	4d 85 f6             	test   %r14,%r14
+ 4a8:	74 1c                	je     4c6 <gettoken+0xec>
+    *eq = s;
+ 4aa:	49 89 1e             	mov    %rbx,(%r14)
+ 4ad:	eb 17                	jmp    4c6 <gettoken+0xec>
+  
+  while(s < es && strchr(whitespace, *s))
+ 4af:	0f be 33             	movsbl (%rbx),%esi
+ 4b2:	48 c7 c7 e8 14 00 00 	mov    $0x14e8,%rdi
+ 4b9:	e8 cd 04 00 00       	call   98b <strchr>
+ 4be:	48 85 c0             	test   %rax,%rax
+ 4c1:	74 08                	je     4cb <gettoken+0xf1>
+    s++;
+ 4c3:	48 ff c3             	inc    %rbx
+  while(s < es && strchr(whitespace, *s))
+ 4c6:	4c 39 e3             	cmp    %r12,%rbx
+ 4c9:	72 e4                	jb     4af <gettoken+0xd5>
+  *ps = s;
+ 4cb:	49 89 5d 00          	mov    %rbx,0x0(%r13)
+  return ret;
+}
+ 4cf:	44 89 f8             	mov    %r15d,%eax
+ 4d2:	5a                   	pop    %rdx
+ 4d3:	5b                   	pop    %rbx
+ 4d4:	41 5c                	pop    %r12
+ 4d6:	41 5d                	pop    %r13
+ 4d8:	41 5e                	pop    %r14
+ 4da:	41 5f                	pop    %r15
+ 4dc:	5d                   	pop    %rbp
+ 4dd:	c3                   	ret
+
+00000000000004de <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+ 4de:	55                   	push   %rbp
+ 4df:	48 89 e5             	mov    %rsp,%rbp
+ 4e2:	41 56                	push   %r14
+ 4e4:	49 89 f6             	mov    %rsi,%r14
+ 4e7:	41 55                	push   %r13
+ 4e9:	49 89 d5             	mov    %rdx,%r13
+ 4ec:	41 54                	push   %r12
+ 4ee:	49 89 fc             	mov    %rdi,%r12
+ 4f1:	53                   	push   %rbx
+  char *s;
+  
+  s = *ps;
+ 4f2:	48 8b 1f             	mov    (%rdi),%rbx
+  while(s < es && strchr(whitespace, *s))
+ 4f5:	4c 39 f3             	cmp    %r14,%rbx
+ 4f8:	72 21                	jb     51b <peek+0x3d>
+    s++;
+  *ps = s;
+ 4fa:	49 89 1c 24          	mov    %rbx,(%r12)
+  return *s && strchr(toks, *s);
+ 4fe:	0f be 33             	movsbl (%rbx),%esi
+ 501:	31 c0                	xor    %eax,%eax
+ 503:	40 84 f6             	test   %sil,%sil
+ 506:	74 2c                	je     534 <peek+0x56>
+ 508:	4c 89 ef             	mov    %r13,%rdi
+ 50b:	e8 7b 04 00 00       	call   98b <strchr>
+ 510:	48 85 c0             	test   %rax,%rax
+ 513:	0f 95 c0             	setne  %al
+ 516:	0f b6 c0             	movzbl %al,%eax
+ 519:	eb 19                	jmp    534 <peek+0x56>
+  while(s < es && strchr(whitespace, *s))
+ 51b:	0f be 33             	movsbl (%rbx),%esi
+ 51e:	48 c7 c7 e8 14 00 00 	mov    $0x14e8,%rdi
+ 525:	e8 61 04 00 00       	call   98b <strchr>
+ 52a:	48 85 c0             	test   %rax,%rax
+ 52d:	74 cb                	je     4fa <peek+0x1c>
+    s++;
+ 52f:	48 ff c3             	inc    %rbx
+ 532:	eb c1                	jmp    4f5 <peek+0x17>
+}
+ 534:	5b                   	pop    %rbx
+ 535:	41 5c                	pop    %r12
+ 537:	41 5d                	pop    %r13
+ 539:	41 5e                	pop    %r14
+ 53b:	5d                   	pop    %rbp
+ 53c:	c3                   	ret
+
+000000000000053d <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+ 53d:	55                   	push   %rbp
+ 53e:	48 89 e5             	mov    %rsp,%rbp
+ 541:	41 56                	push   %r14
+ 543:	41 55                	push   %r13
+ 545:	49 89 d5             	mov    %rdx,%r13
+ 548:	41 54                	push   %r12
+ 54a:	49 89 f4             	mov    %rsi,%r12
+ 54d:	53                   	push   %rbx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+ 54e:	48 89 fb             	mov    %rdi,%rbx
+{
+ 551:	48 83 ec 10          	sub    $0x10,%rsp
+  while(peek(ps, es, "<>")){
+ 555:	48 c7 c2 01 0f 00 00 	mov    $0xf01,%rdx
+ 55c:	4c 89 ee             	mov    %r13,%rsi
+ 55f:	4c 89 e7             	mov    %r12,%rdi
+ 562:	e8 77 ff ff ff       	call   4de <peek>
+ 567:	85 c0                	test   %eax,%eax
+ 569:	74 74                	je     5df <parseredirs+0xa2>
+    tok = gettoken(ps, es, 0, 0);
+ 56b:	31 c9                	xor    %ecx,%ecx
+ 56d:	31 d2                	xor    %edx,%edx
+ 56f:	4c 89 ee             	mov    %r13,%rsi
+ 572:	4c 89 e7             	mov    %r12,%rdi
+ 575:	e8 60 fe ff ff       	call   3da <gettoken>
+    if(gettoken(ps, es, &q, &eq) != 'a')
+ 57a:	48 8d 4d d8          	lea    -0x28(%rbp),%rcx
+ 57e:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+ 582:	4c 89 ee             	mov    %r13,%rsi
+ 585:	4c 89 e7             	mov    %r12,%rdi
+    tok = gettoken(ps, es, 0, 0);
+ 588:	41 89 c6             	mov    %eax,%r14d
+    if(gettoken(ps, es, &q, &eq) != 'a')
+ 58b:	e8 4a fe ff ff       	call   3da <gettoken>
+ 590:	83 f8 61             	cmp    $0x61,%eax
+ 593:	74 0c                	je     5a1 <parseredirs+0x64>
+      panic("missing file for redirection");
+ 595:	48 c7 c7 e4 0e 00 00 	mov    $0xee4,%rdi
+ 59c:	e8 62 fb ff ff       	call   103 <panic>
+    switch(tok){
+ 5a1:	41 83 fe 3c          	cmp    $0x3c,%r14d
+ 5a5:	74 0e                	je     5b5 <parseredirs+0x78>
+ 5a7:	41 83 fe 3e          	cmp    $0x3e,%r14d
+ 5ab:	74 0f                	je     5bc <parseredirs+0x7f>
+ 5ad:	41 83 fe 2b          	cmp    $0x2b,%r14d
+ 5b1:	75 a2                	jne    555 <parseredirs+0x18>
+ 5b3:	eb 07                	jmp    5bc <parseredirs+0x7f>
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+ 5b5:	45 31 c0             	xor    %r8d,%r8d
+ 5b8:	31 c9                	xor    %ecx,%ecx
+ 5ba:	eb 0b                	jmp    5c7 <parseredirs+0x8a>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+ 5bc:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 5c2:	b9 01 02 00 00       	mov    $0x201,%ecx
+ 5c7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+ 5cb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+ 5cf:	48 89 df             	mov    %rbx,%rdi
+ 5d2:	e8 d4 fc ff ff       	call   2ab <redircmd>
+ 5d7:	48 89 c3             	mov    %rax,%rbx
+      break;
+ 5da:	e9 76 ff ff ff       	jmp    555 <parseredirs+0x18>
+    }
+  }
+  return cmd;
+}
+ 5df:	5a                   	pop    %rdx
+ 5e0:	48 89 d8             	mov    %rbx,%rax
+ 5e3:	59                   	pop    %rcx
+ 5e4:	5b                   	pop    %rbx
+ 5e5:	41 5c                	pop    %r12
+ 5e7:	41 5d                	pop    %r13
+ 5e9:	41 5e                	pop    %r14
+ 5eb:	5d                   	pop    %rbp
+ 5ec:	c3                   	ret
+
+00000000000005ed <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+ 5ed:	55                   	push   %rbp
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+  
+  if(peek(ps, es, "("))
+ 5ee:	48 c7 c2 04 0f 00 00 	mov    $0xf04,%rdx
+{
+ 5f5:	48 89 e5             	mov    %rsp,%rbp
+ 5f8:	41 57                	push   %r15
+ 5fa:	41 56                	push   %r14
+ 5fc:	41 55                	push   %r13
+ 5fe:	49 89 f5             	mov    %rsi,%r13
+ 601:	41 54                	push   %r12
+ 603:	49 89 fc             	mov    %rdi,%r12
+ 606:	53                   	push   %rbx
+ 607:	48 83 ec 18          	sub    $0x18,%rsp
+  if(peek(ps, es, "("))
+ 60b:	e8 ce fe ff ff       	call   4de <peek>
+ 610:	85 c0                	test   %eax,%eax
+ 612:	74 19                	je     62d <parseexec+0x40>
+    ret = parseredirs(ret, ps, es);
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+ 614:	48 83 c4 18          	add    $0x18,%rsp
+    return parseblock(ps, es);
+ 618:	4c 89 ee             	mov    %r13,%rsi
+ 61b:	4c 89 e7             	mov    %r12,%rdi
+}
+ 61e:	5b                   	pop    %rbx
+ 61f:	41 5c                	pop    %r12
+ 621:	41 5d                	pop    %r13
+ 623:	41 5e                	pop    %r14
+ 625:	41 5f                	pop    %r15
+ 627:	5d                   	pop    %rbp
+    return parseblock(ps, es);
+ 628:	e9 ac 01 00 00       	jmp    7d9 <parseblock>
+  ret = execcmd();
+ 62d:	e8 4a fc ff ff       	call   27c <execcmd>
+  ret = parseredirs(ret, ps, es);
+ 632:	4c 89 ea             	mov    %r13,%rdx
+ 635:	4c 89 e6             	mov    %r12,%rsi
+  while(!peek(ps, es, "|)&;")){
+ 638:	31 db                	xor    %ebx,%ebx
+  ret = parseredirs(ret, ps, es);
+ 63a:	48 89 c7             	mov    %rax,%rdi
+  ret = execcmd();
+ 63d:	49 89 c7             	mov    %rax,%r15
+  ret = parseredirs(ret, ps, es);
+ 640:	e8 f8 fe ff ff       	call   53d <parseredirs>
+ 645:	49 89 c6             	mov    %rax,%r14
+  while(!peek(ps, es, "|)&;")){
+ 648:	48 c7 c2 1b 0f 00 00 	mov    $0xf1b,%rdx
+ 64f:	4c 89 ee             	mov    %r13,%rsi
+ 652:	4c 89 e7             	mov    %r12,%rdi
+ 655:	e8 84 fe ff ff       	call   4de <peek>
+ 65a:	85 c0                	test   %eax,%eax
+ 65c:	75 5f                	jne    6bd <parseexec+0xd0>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+ 65e:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+ 662:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+ 666:	4c 89 ee             	mov    %r13,%rsi
+ 669:	4c 89 e7             	mov    %r12,%rdi
+ 66c:	e8 69 fd ff ff       	call   3da <gettoken>
+ 671:	85 c0                	test   %eax,%eax
+ 673:	74 48                	je     6bd <parseexec+0xd0>
+    if(tok != 'a')
+ 675:	83 f8 61             	cmp    $0x61,%eax
+ 678:	74 09                	je     683 <parseexec+0x96>
+      panic("syntax");
+ 67a:	48 c7 c7 06 0f 00 00 	mov    $0xf06,%rdi
+ 681:	eb 22                	jmp    6a5 <parseexec+0xb8>
+    cmd->argv[argc] = q;
+ 683:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+ 687:	49 89 44 df 08       	mov    %rax,0x8(%r15,%rbx,8)
+    cmd->eargv[argc] = eq;
+ 68c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+ 690:	49 89 44 df 58       	mov    %rax,0x58(%r15,%rbx,8)
+    if(argc >= MAXARGS)
+ 695:	48 ff c3             	inc    %rbx
+ 698:	48 83 fb 0a          	cmp    $0xa,%rbx
+ 69c:	75 0c                	jne    6aa <parseexec+0xbd>
+      panic("too many args");
+ 69e:	48 c7 c7 0d 0f 00 00 	mov    $0xf0d,%rdi
+ 6a5:	e8 59 fa ff ff       	call   103 <panic>
+    ret = parseredirs(ret, ps, es);
+ 6aa:	4c 89 f7             	mov    %r14,%rdi
+ 6ad:	4c 89 ea             	mov    %r13,%rdx
+ 6b0:	4c 89 e6             	mov    %r12,%rsi
+ 6b3:	e8 85 fe ff ff       	call   53d <parseredirs>
+ 6b8:	49 89 c6             	mov    %rax,%r14
+ 6bb:	eb 8b                	jmp    648 <parseexec+0x5b>
+  cmd->argv[argc] = 0;
+ 6bd:	48 63 db             	movslq %ebx,%rbx
+  cmd->eargv[argc] = 0;
+ 6c0:	31 c0                	xor    %eax,%eax
+ 6c2:	49 89 44 df 08       	mov    %rax,0x8(%r15,%rbx,8)
+ 6c7:	49 89 44 df 58       	mov    %rax,0x58(%r15,%rbx,8)
+}
+ 6cc:	48 83 c4 18          	add    $0x18,%rsp
+ 6d0:	4c 89 f0             	mov    %r14,%rax
+ 6d3:	5b                   	pop    %rbx
+ 6d4:	41 5c                	pop    %r12
+ 6d6:	41 5d                	pop    %r13
+ 6d8:	41 5e                	pop    %r14
+ 6da:	41 5f                	pop    %r15
+ 6dc:	5d                   	pop    %rbp
+ 6dd:	c3                   	ret
+
+00000000000006de <parsepipe>:
+{
+ 6de:	55                   	push   %rbp
+ 6df:	48 89 e5             	mov    %rsp,%rbp
+ 6e2:	41 55                	push   %r13
+ 6e4:	41 54                	push   %r12
+ 6e6:	49 89 f4             	mov    %rsi,%r12
+ 6e9:	53                   	push   %rbx
+ 6ea:	48 89 fb             	mov    %rdi,%rbx
+ 6ed:	41 50                	push   %r8
+  cmd = parseexec(ps, es);
+ 6ef:	e8 f9 fe ff ff       	call   5ed <parseexec>
+  if(peek(ps, es, "|")){
+ 6f4:	48 c7 c2 20 0f 00 00 	mov    $0xf20,%rdx
+ 6fb:	4c 89 e6             	mov    %r12,%rsi
+ 6fe:	48 89 df             	mov    %rbx,%rdi
+  cmd = parseexec(ps, es);
+ 701:	49 89 c5             	mov    %rax,%r13
+  if(peek(ps, es, "|")){
+ 704:	e8 d5 fd ff ff       	call   4de <peek>
+ 709:	85 c0                	test   %eax,%eax
+ 70b:	74 2c                	je     739 <parsepipe+0x5b>
+    gettoken(ps, es, 0, 0);
+ 70d:	31 c9                	xor    %ecx,%ecx
+ 70f:	4c 89 e6             	mov    %r12,%rsi
+ 712:	48 89 df             	mov    %rbx,%rdi
+ 715:	31 d2                	xor    %edx,%edx
+ 717:	e8 be fc ff ff       	call   3da <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+ 71c:	4c 89 e6             	mov    %r12,%rsi
+ 71f:	48 89 df             	mov    %rbx,%rdi
+ 722:	e8 b7 ff ff ff       	call   6de <parsepipe>
+}
+ 727:	59                   	pop    %rcx
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+ 728:	4c 89 ef             	mov    %r13,%rdi
+}
+ 72b:	5b                   	pop    %rbx
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+ 72c:	48 89 c6             	mov    %rax,%rsi
+}
+ 72f:	41 5c                	pop    %r12
+ 731:	41 5d                	pop    %r13
+ 733:	5d                   	pop    %rbp
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+ 734:	e9 df fb ff ff       	jmp    318 <pipecmd>
+}
+ 739:	5a                   	pop    %rdx
+ 73a:	4c 89 e8             	mov    %r13,%rax
+ 73d:	5b                   	pop    %rbx
+ 73e:	41 5c                	pop    %r12
+ 740:	41 5d                	pop    %r13
+ 742:	5d                   	pop    %rbp
+ 743:	c3                   	ret
+
+0000000000000744 <parseline>:
+{
+ 744:	55                   	push   %rbp
+ 745:	48 89 e5             	mov    %rsp,%rbp
+ 748:	41 55                	push   %r13
+ 74a:	49 89 f5             	mov    %rsi,%r13
+ 74d:	41 54                	push   %r12
+ 74f:	49 89 fc             	mov    %rdi,%r12
+ 752:	53                   	push   %rbx
+ 753:	41 50                	push   %r8
+  cmd = parsepipe(ps, es);
+ 755:	e8 84 ff ff ff       	call   6de <parsepipe>
+  while(peek(ps, es, "&")){
+ 75a:	48 c7 c2 22 0f 00 00 	mov    $0xf22,%rdx
+ 761:	4c 89 ee             	mov    %r13,%rsi
+ 764:	4c 89 e7             	mov    %r12,%rdi
+    cmd = backcmd(cmd);
+ 767:	48 89 c3             	mov    %rax,%rbx
+  while(peek(ps, es, "&")){
+ 76a:	e8 6f fd ff ff       	call   4de <peek>
+ 76f:	85 c0                	test   %eax,%eax
+ 771:	74 19                	je     78c <parseline+0x48>
+    gettoken(ps, es, 0, 0);
+ 773:	4c 89 e7             	mov    %r12,%rdi
+ 776:	31 c9                	xor    %ecx,%ecx
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	4c 89 ee             	mov    %r13,%rsi
+ 77d:	e8 58 fc ff ff       	call   3da <gettoken>
+    cmd = backcmd(cmd);
+ 782:	48 89 df             	mov    %rbx,%rdi
+ 785:	e8 18 fc ff ff       	call   3a2 <backcmd>
+ 78a:	eb ce                	jmp    75a <parseline+0x16>
+  if(peek(ps, es, ";")){
+ 78c:	48 c7 c2 1e 0f 00 00 	mov    $0xf1e,%rdx
+ 793:	4c 89 ee             	mov    %r13,%rsi
+ 796:	4c 89 e7             	mov    %r12,%rdi
+ 799:	e8 40 fd ff ff       	call   4de <peek>
+ 79e:	85 c0                	test   %eax,%eax
+ 7a0:	74 2c                	je     7ce <parseline+0x8a>
+    gettoken(ps, es, 0, 0);
+ 7a2:	31 c9                	xor    %ecx,%ecx
+ 7a4:	4c 89 ee             	mov    %r13,%rsi
+ 7a7:	4c 89 e7             	mov    %r12,%rdi
+ 7aa:	31 d2                	xor    %edx,%edx
+ 7ac:	e8 29 fc ff ff       	call   3da <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+ 7b1:	4c 89 ee             	mov    %r13,%rsi
+ 7b4:	4c 89 e7             	mov    %r12,%rdi
+ 7b7:	e8 88 ff ff ff       	call   744 <parseline>
+}
+ 7bc:	59                   	pop    %rcx
+    cmd = listcmd(cmd, parseline(ps, es));
+ 7bd:	48 89 df             	mov    %rbx,%rdi
+}
+ 7c0:	5b                   	pop    %rbx
+    cmd = listcmd(cmd, parseline(ps, es));
+ 7c1:	48 89 c6             	mov    %rax,%rsi
+}
+ 7c4:	41 5c                	pop    %r12
+ 7c6:	41 5d                	pop    %r13
+ 7c8:	5d                   	pop    %rbp
+    cmd = listcmd(cmd, parseline(ps, es));
+ 7c9:	e9 8f fb ff ff       	jmp    35d <listcmd>
+}
+ 7ce:	5a                   	pop    %rdx
+ 7cf:	48 89 d8             	mov    %rbx,%rax
+ 7d2:	5b                   	pop    %rbx
+ 7d3:	41 5c                	pop    %r12
+ 7d5:	41 5d                	pop    %r13
+ 7d7:	5d                   	pop    %rbp
+ 7d8:	c3                   	ret
+
+00000000000007d9 <parseblock>:
+{
+ 7d9:	55                   	push   %rbp
+ 7da:	48 89 e5             	mov    %rsp,%rbp
+ 7dd:	41 55                	push   %r13
+ 7df:	41 54                	push   %r12
+ 7e1:	49 89 f4             	mov    %rsi,%r12
+ 7e4:	53                   	push   %rbx
+ 7e5:	48 89 fb             	mov    %rdi,%rbx
+ 7e8:	52                   	push   %rdx
+  if(!peek(ps, es, "("))
+ 7e9:	48 c7 c2 04 0f 00 00 	mov    $0xf04,%rdx
+ 7f0:	e8 e9 fc ff ff       	call   4de <peek>
+    panic("parseblock");
+ 7f5:	48 c7 c7 24 0f 00 00 	mov    $0xf24,%rdi
+  if(!peek(ps, es, "("))
+ 7fc:	85 c0                	test   %eax,%eax
+ 7fe:	74 3a                	je     83a <parseblock+0x61>
+  gettoken(ps, es, 0, 0);
+ 800:	31 d2                	xor    %edx,%edx
+ 802:	31 c9                	xor    %ecx,%ecx
+ 804:	4c 89 e6             	mov    %r12,%rsi
+ 807:	48 89 df             	mov    %rbx,%rdi
+ 80a:	e8 cb fb ff ff       	call   3da <gettoken>
+  cmd = parseline(ps, es);
+ 80f:	4c 89 e6             	mov    %r12,%rsi
+ 812:	48 89 df             	mov    %rbx,%rdi
+ 815:	e8 2a ff ff ff       	call   744 <parseline>
+  if(!peek(ps, es, ")"))
+ 81a:	48 c7 c2 40 0f 00 00 	mov    $0xf40,%rdx
+ 821:	4c 89 e6             	mov    %r12,%rsi
+ 824:	48 89 df             	mov    %rbx,%rdi
+  cmd = parseline(ps, es);
+ 827:	49 89 c5             	mov    %rax,%r13
+  if(!peek(ps, es, ")"))
+ 82a:	e8 af fc ff ff       	call   4de <peek>
+ 82f:	85 c0                	test   %eax,%eax
+ 831:	75 0c                	jne    83f <parseblock+0x66>
+    panic("syntax - missing )");
+ 833:	48 c7 c7 2f 0f 00 00 	mov    $0xf2f,%rdi
+ 83a:	e8 c4 f8 ff ff       	call   103 <panic>
+  gettoken(ps, es, 0, 0);
+ 83f:	4c 89 e6             	mov    %r12,%rsi
+ 842:	48 89 df             	mov    %rbx,%rdi
+ 845:	31 d2                	xor    %edx,%edx
+ 847:	31 c9                	xor    %ecx,%ecx
+ 849:	e8 8c fb ff ff       	call   3da <gettoken>
+}
+ 84e:	58                   	pop    %rax
+  cmd = parseredirs(cmd, ps, es);
+ 84f:	4c 89 e2             	mov    %r12,%rdx
+ 852:	48 89 de             	mov    %rbx,%rsi
+ 855:	4c 89 ef             	mov    %r13,%rdi
+}
+ 858:	5b                   	pop    %rbx
+ 859:	41 5c                	pop    %r12
+ 85b:	41 5d                	pop    %r13
+ 85d:	5d                   	pop    %rbp
+  cmd = parseredirs(cmd, ps, es);
+ 85e:	e9 da fc ff ff       	jmp    53d <parseredirs>
+
+0000000000000863 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+ 863:	55                   	push   %rbp
+ 864:	48 89 e5             	mov    %rsp,%rbp
+ 867:	53                   	push   %rbx
+ 868:	48 89 fb             	mov    %rdi,%rbx
+ 86b:	51                   	push   %rcx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+ 86c:	48 85 ff             	test   %rdi,%rdi
+ 86f:	74 52                	je     8c3 <nulterminate+0x60>
+    return 0;
+  
+  switch(cmd->type){
+ 871:	8b 07                	mov    (%rdi),%eax
+ 873:	ff c8                	dec    %eax
+ 875:	83 f8 04             	cmp    $0x4,%eax
+ 878:	77 49                	ja     8c3 <nulterminate+0x60>
+ 87a:	ff 24 c5 90 0f 00 00 	jmp    *0xf90(,%rax,8)
+ 881:	48 8d 47 08          	lea    0x8(%rdi),%rax
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+    for(i=0; ecmd->argv[i]; i++)
+ 885:	48 83 c0 08          	add    $0x8,%rax
+ 889:	48 83 78 f8 00       	cmpq   $0x0,-0x8(%rax)
+ 88e:	74 33                	je     8c3 <nulterminate+0x60>
+      *ecmd->eargv[i] = 0;
+ 890:	48 8b 50 48          	mov    0x48(%rax),%rdx
+ 894:	c6 02 00             	movb   $0x0,(%rdx)
+    for(i=0; ecmd->argv[i]; i++)
+ 897:	eb ec                	jmp    885 <nulterminate+0x22>
+    break;
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    nulterminate(rcmd->cmd);
+ 899:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+ 89d:	e8 c1 ff ff ff       	call   863 <nulterminate>
+    *rcmd->efile = 0;
+ 8a2:	48 8b 43 18          	mov    0x18(%rbx),%rax
+ 8a6:	c6 00 00             	movb   $0x0,(%rax)
+    break;
+ 8a9:	eb 18                	jmp    8c3 <nulterminate+0x60>
+    nulterminate(pcmd->right);
+    break;
+    
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+ 8ab:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+ 8af:	e8 af ff ff ff       	call   863 <nulterminate>
+    nulterminate(lcmd->right);
+ 8b4:	48 8b 7b 10          	mov    0x10(%rbx),%rdi
+ 8b8:	eb 04                	jmp    8be <nulterminate+0x5b>
+    break;
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+ 8ba:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+ 8be:	e8 a0 ff ff ff       	call   863 <nulterminate>
+    break;
+  }
+  return cmd;
+}
+ 8c3:	48 89 d8             	mov    %rbx,%rax
+ 8c6:	5a                   	pop    %rdx
+ 8c7:	5b                   	pop    %rbx
+ 8c8:	5d                   	pop    %rbp
+ 8c9:	c3                   	ret
+
+00000000000008ca <parsecmd>:
+{
+ 8ca:	55                   	push   %rbp
+ 8cb:	48 89 e5             	mov    %rsp,%rbp
+ 8ce:	41 54                	push   %r12
+ 8d0:	53                   	push   %rbx
+ 8d1:	48 89 fb             	mov    %rdi,%rbx
+ 8d4:	48 83 ec 10          	sub    $0x10,%rsp
+ 8d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  es = s + strlen(s);
+ 8dc:	e8 8c 00 00 00       	call   96d <strlen>
+  cmd = parseline(&s, es);
+ 8e1:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  es = s + strlen(s);
+ 8e5:	89 c0                	mov    %eax,%eax
+ 8e7:	48 01 c3             	add    %rax,%rbx
+  cmd = parseline(&s, es);
+ 8ea:	48 89 de             	mov    %rbx,%rsi
+ 8ed:	e8 52 fe ff ff       	call   744 <parseline>
+  peek(&s, es, "");
+ 8f2:	48 c7 c2 ce 0e 00 00 	mov    $0xece,%rdx
+ 8f9:	48 89 de             	mov    %rbx,%rsi
+ 8fc:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  cmd = parseline(&s, es);
+ 900:	49 89 c4             	mov    %rax,%r12
+  peek(&s, es, "");
+ 903:	e8 d6 fb ff ff       	call   4de <peek>
+  if(s != es){
+ 908:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+ 90c:	48 39 da             	cmp    %rbx,%rdx
+ 90f:	74 1f                	je     930 <parsecmd+0x66>
+    printf(2, "leftovers: %s\n", s);
+ 911:	bf 02 00 00 00       	mov    $0x2,%edi
+ 916:	48 c7 c6 42 0f 00 00 	mov    $0xf42,%rsi
+ 91d:	31 c0                	xor    %eax,%eax
+ 91f:	e8 85 02 00 00       	call   ba9 <printf>
+    panic("syntax");
+ 924:	48 c7 c7 06 0f 00 00 	mov    $0xf06,%rdi
+ 92b:	e8 d3 f7 ff ff       	call   103 <panic>
+  nulterminate(cmd);
+ 930:	4c 89 e7             	mov    %r12,%rdi
+ 933:	e8 2b ff ff ff       	call   863 <nulterminate>
+}
+ 938:	5a                   	pop    %rdx
+ 939:	4c 89 e0             	mov    %r12,%rax
+ 93c:	59                   	pop    %rcx
+ 93d:	5b                   	pop    %rbx
+ 93e:	41 5c                	pop    %r12
+ 940:	5d                   	pop    %rbp
+ 941:	c3                   	ret
+
+0000000000000942 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 942:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 945:	31 d2                	xor    %edx,%edx
+ 947:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+ 94a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+ 94d:	48 ff c2             	inc    %rdx
+ 950:	84 c9                	test   %cl,%cl
+ 952:	75 f3                	jne    947 <strcpy+0x5>
+    ;
+  return os;
+}
+ 954:	c3                   	ret
+
+0000000000000955 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+ 955:	31 c9                	xor    %ecx,%ecx
+ 957:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+ 95b:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+ 95f:	84 c0                	test   %al,%al
+ 961:	74 07                	je     96a <strcmp+0x15>
+ 963:	48 ff c1             	inc    %rcx
+ 966:	38 d0                	cmp    %dl,%al
+ 968:	74 ed                	je     957 <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+ 96a:	29 d0                	sub    %edx,%eax
+}
+ 96c:	c3                   	ret
+
+000000000000096d <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 96d:	31 d2                	xor    %edx,%edx
+ 96f:	48 89 d0             	mov    %rdx,%rax
+ 972:	48 ff c2             	inc    %rdx
+ 975:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+ 97a:	75 f3                	jne    96f <strlen+0x2>
+    ;
+  return n;
+}
+ 97c:	c3                   	ret
+
+000000000000097d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 97d:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 980:	89 d1                	mov    %edx,%ecx
+ 982:	89 f0                	mov    %esi,%eax
+ 984:	fc                   	cld
+ 985:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 987:	4c 89 c0             	mov    %r8,%rax
+ 98a:	c3                   	ret
+
+000000000000098b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+ 98b:	48 89 f8             	mov    %rdi,%rax
+ 98e:	8a 10                	mov    (%rax),%dl
+ 990:	84 d2                	test   %dl,%dl
+ 992:	74 0a                	je     99e <strchr+0x13>
+    if(*s == c)
+ 994:	40 38 f2             	cmp    %sil,%dl
+ 997:	74 07                	je     9a0 <strchr+0x15>
+  for(; *s; s++)
+ 999:	48 ff c0             	inc    %rax
+ 99c:	eb f0                	jmp    98e <strchr+0x3>
+      return (char*)s;
+  return 0;
+ 99e:	31 c0                	xor    %eax,%eax
+}
+ 9a0:	c3                   	ret
+
+00000000000009a1 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 9a1:	55                   	push   %rbp
+ 9a2:	48 89 e5             	mov    %rsp,%rbp
+ 9a5:	41 56                	push   %r14
+ 9a7:	41 89 f6             	mov    %esi,%r14d
+ 9aa:	41 55                	push   %r13
+ 9ac:	41 54                	push   %r12
+ 9ae:	49 89 fc             	mov    %rdi,%r12
+ 9b1:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 9b2:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+ 9b7:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+ 9bb:	41 89 dd             	mov    %ebx,%r13d
+ 9be:	44 39 f3             	cmp    %r14d,%ebx
+ 9c1:	7d 29                	jge    9ec <gets+0x4b>
+    cc = read(0, &c, 1);
+ 9c3:	31 ff                	xor    %edi,%edi
+ 9c5:	ba 01 00 00 00       	mov    $0x1,%edx
+ 9ca:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 9ce:	e8 c5 00 00 00       	call   a98 <read>
+    if(cc < 1)
+ 9d3:	85 c0                	test   %eax,%eax
+ 9d5:	7e 15                	jle    9ec <gets+0x4b>
+      break;
+    buf[i++] = c;
+ 9d7:	8a 45 df             	mov    -0x21(%rbp),%al
+ 9da:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+ 9df:	48 ff c3             	inc    %rbx
+ 9e2:	3c 0a                	cmp    $0xa,%al
+ 9e4:	74 0a                	je     9f0 <gets+0x4f>
+ 9e6:	3c 0d                	cmp    $0xd,%al
+ 9e8:	75 d1                	jne    9bb <gets+0x1a>
+ 9ea:	eb 04                	jmp    9f0 <gets+0x4f>
+ 9ec:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 9f0:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 9f3:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 9f6:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 9fb:	5a                   	pop    %rdx
+ 9fc:	59                   	pop    %rcx
+ 9fd:	5b                   	pop    %rbx
+ 9fe:	41 5c                	pop    %r12
+ a00:	41 5d                	pop    %r13
+ a02:	41 5e                	pop    %r14
+ a04:	5d                   	pop    %rbp
+ a05:	c3                   	ret
+
+0000000000000a06 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ a06:	55                   	push   %rbp
+ a07:	48 89 e5             	mov    %rsp,%rbp
+ a0a:	41 55                	push   %r13
+ a0c:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ a0f:	31 f6                	xor    %esi,%esi
+{
+ a11:	41 54                	push   %r12
+ a13:	41 83 cc ff          	or     $0xffffffff,%r12d
+ a17:	53                   	push   %rbx
+ a18:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ a19:	e8 a2 00 00 00       	call   ac0 <open>
+  if(fd < 0)
+ a1e:	85 c0                	test   %eax,%eax
+ a20:	78 16                	js     a38 <stat+0x32>
+ a22:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ a24:	89 c7                	mov    %eax,%edi
+ a26:	4c 89 ee             	mov    %r13,%rsi
+ a29:	e8 aa 00 00 00       	call   ad8 <fstat>
+  close(fd);
+ a2e:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ a30:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ a33:	e8 70 00 00 00       	call   aa8 <close>
+  return r;
+}
+ a38:	5a                   	pop    %rdx
+ a39:	44 89 e0             	mov    %r12d,%eax
+ a3c:	5b                   	pop    %rbx
+ a3d:	41 5c                	pop    %r12
+ a3f:	41 5d                	pop    %r13
+ a41:	5d                   	pop    %rbp
+ a42:	c3                   	ret
+
+0000000000000a43 <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ a43:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ a45:	0f be 17             	movsbl (%rdi),%edx
+ a48:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ a4b:	80 f9 09             	cmp    $0x9,%cl
+ a4e:	77 0c                	ja     a5c <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ a50:	6b c0 0a             	imul   $0xa,%eax,%eax
+ a53:	48 ff c7             	inc    %rdi
+ a56:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ a5a:	eb e9                	jmp    a45 <atoi+0x2>
+  return n;
+}
+ a5c:	c3                   	ret
+
+0000000000000a5d <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ a5d:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ a60:	31 c9                	xor    %ecx,%ecx
+ a62:	89 d7                	mov    %edx,%edi
+ a64:	29 cf                	sub    %ecx,%edi
+ a66:	85 ff                	test   %edi,%edi
+ a68:	7e 0d                	jle    a77 <memmove+0x1a>
+    *dst++ = *src++;
+ a6a:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ a6e:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ a72:	48 ff c1             	inc    %rcx
+ a75:	eb eb                	jmp    a62 <memmove+0x5>
+  return vdst;
+}
+ a77:	c3                   	ret
+
+0000000000000a78 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ a78:	b8 01 00 00 00       	mov    $0x1,%eax
+ a7d:	cd 40                	int    $0x40
+ a7f:	c3                   	ret
+
+0000000000000a80 <exit>:
+SYSCALL(exit)
+ a80:	b8 02 00 00 00       	mov    $0x2,%eax
+ a85:	cd 40                	int    $0x40
+ a87:	c3                   	ret
+
+0000000000000a88 <wait>:
+SYSCALL(wait)
+ a88:	b8 03 00 00 00       	mov    $0x3,%eax
+ a8d:	cd 40                	int    $0x40
+ a8f:	c3                   	ret
+
+0000000000000a90 <pipe>:
+SYSCALL(pipe)
+ a90:	b8 04 00 00 00       	mov    $0x4,%eax
+ a95:	cd 40                	int    $0x40
+ a97:	c3                   	ret
+
+0000000000000a98 <read>:
+SYSCALL(read)
+ a98:	b8 05 00 00 00       	mov    $0x5,%eax
+ a9d:	cd 40                	int    $0x40
+ a9f:	c3                   	ret
+
+0000000000000aa0 <write>:
+SYSCALL(write)
+ aa0:	b8 10 00 00 00       	mov    $0x10,%eax
+ aa5:	cd 40                	int    $0x40
+ aa7:	c3                   	ret
+
+0000000000000aa8 <close>:
+SYSCALL(close)
+ aa8:	b8 15 00 00 00       	mov    $0x15,%eax
+ aad:	cd 40                	int    $0x40
+ aaf:	c3                   	ret
+
+0000000000000ab0 <kill>:
+SYSCALL(kill)
+ ab0:	b8 06 00 00 00       	mov    $0x6,%eax
+ ab5:	cd 40                	int    $0x40
+ ab7:	c3                   	ret
+
+0000000000000ab8 <exec>:
+SYSCALL(exec)
+ ab8:	b8 07 00 00 00       	mov    $0x7,%eax
+ abd:	cd 40                	int    $0x40
+ abf:	c3                   	ret
+
+0000000000000ac0 <open>:
+SYSCALL(open)
+ ac0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ ac5:	cd 40                	int    $0x40
+ ac7:	c3                   	ret
+
+0000000000000ac8 <mknod>:
+SYSCALL(mknod)
+ ac8:	b8 11 00 00 00       	mov    $0x11,%eax
+ acd:	cd 40                	int    $0x40
+ acf:	c3                   	ret
+
+0000000000000ad0 <unlink>:
+SYSCALL(unlink)
+ ad0:	b8 12 00 00 00       	mov    $0x12,%eax
+ ad5:	cd 40                	int    $0x40
+ ad7:	c3                   	ret
+
+0000000000000ad8 <fstat>:
+SYSCALL(fstat)
+ ad8:	b8 08 00 00 00       	mov    $0x8,%eax
+ add:	cd 40                	int    $0x40
+ adf:	c3                   	ret
+
+0000000000000ae0 <link>:
+SYSCALL(link)
+ ae0:	b8 13 00 00 00       	mov    $0x13,%eax
+ ae5:	cd 40                	int    $0x40
+ ae7:	c3                   	ret
+
+0000000000000ae8 <mkdir>:
+SYSCALL(mkdir)
+ ae8:	b8 14 00 00 00       	mov    $0x14,%eax
+ aed:	cd 40                	int    $0x40
+ aef:	c3                   	ret
+
+0000000000000af0 <chdir>:
+SYSCALL(chdir)
+ af0:	b8 09 00 00 00       	mov    $0x9,%eax
+ af5:	cd 40                	int    $0x40
+ af7:	c3                   	ret
+
+0000000000000af8 <dup>:
+SYSCALL(dup)
+ af8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ afd:	cd 40                	int    $0x40
+ aff:	c3                   	ret
+
+0000000000000b00 <getpid>:
+SYSCALL(getpid)
+ b00:	b8 0b 00 00 00       	mov    $0xb,%eax
+ b05:	cd 40                	int    $0x40
+ b07:	c3                   	ret
+
+0000000000000b08 <sbrk>:
+SYSCALL(sbrk)
+ b08:	b8 0c 00 00 00       	mov    $0xc,%eax
+ b0d:	cd 40                	int    $0x40
+ b0f:	c3                   	ret
+
+0000000000000b10 <sleep>:
+SYSCALL(sleep)
+ b10:	b8 0d 00 00 00       	mov    $0xd,%eax
+ b15:	cd 40                	int    $0x40
+ b17:	c3                   	ret
+
+0000000000000b18 <uptime>:
+SYSCALL(uptime)
+ b18:	b8 0e 00 00 00       	mov    $0xe,%eax
+ b1d:	cd 40                	int    $0x40
+ b1f:	c3                   	ret
+
+0000000000000b20 <chmod>:
+SYSCALL(chmod)
+ b20:	b8 16 00 00 00       	mov    $0x16,%eax
+ b25:	cd 40                	int    $0x40
+ b27:	c3                   	ret
+
+0000000000000b28 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ b28:	55                   	push   %rbp
+ b29:	48 89 e5             	mov    %rsp,%rbp
+ b2c:	41 54                	push   %r12
+ b2e:	41 89 fc             	mov    %edi,%r12d
+ b31:	89 d7                	mov    %edx,%edi
+ b33:	53                   	push   %rbx
+ b34:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ b38:	85 f6                	test   %esi,%esi
+ b3a:	79 0f                	jns    b4b <printint+0x23>
+ b3c:	80 e1 01             	and    $0x1,%cl
+ b3f:	74 0a                	je     b4b <printint+0x23>
+    neg = 1;
+    x = -xx;
+ b41:	f7 de                	neg    %esi
+    neg = 1;
+ b43:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ b49:	eb 03                	jmp    b4e <printint+0x26>
+  neg = 0;
+ b4b:	45 31 c0             	xor    %r8d,%r8d
+ b4e:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ b50:	89 f0                	mov    %esi,%eax
+ b52:	31 d2                	xor    %edx,%edx
+ b54:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ b57:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ b5a:	f7 f7                	div    %edi
+ b5c:	8a 92 c0 0f 00 00    	mov    0xfc0(%rdx),%dl
+ b62:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ b66:	89 f2                	mov    %esi,%edx
+ b68:	89 c6                	mov    %eax,%esi
+ b6a:	39 fa                	cmp    %edi,%edx
+ b6c:	73 e2                	jae    b50 <printint+0x28>
+  if(neg)
+ b6e:	45 85 c0             	test   %r8d,%r8d
+ b71:	74 0a                	je     b7d <printint+0x55>
+    buf[i++] = digits[x % base];
+ b73:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ b75:	48 63 c3             	movslq %ebx,%rax
+ b78:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ b7d:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ b80:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ b84:	ba 01 00 00 00       	mov    $0x1,%edx
+ b89:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ b8d:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ b90:	48 ff cb             	dec    %rbx
+ b93:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ b96:	e8 05 ff ff ff       	call   aa0 <write>
+  while(--i >= 0)
+ b9b:	83 fb ff             	cmp    $0xffffffff,%ebx
+ b9e:	75 e0                	jne    b80 <printint+0x58>
+}
+ ba0:	48 83 c4 20          	add    $0x20,%rsp
+ ba4:	5b                   	pop    %rbx
+ ba5:	41 5c                	pop    %r12
+ ba7:	5d                   	pop    %rbp
+ ba8:	c3                   	ret
+
+0000000000000ba9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ ba9:	55                   	push   %rbp
+ baa:	48 89 e5             	mov    %rsp,%rbp
+ bad:	41 55                	push   %r13
+ baf:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ bb1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ bb5:	53                   	push   %rbx
+ bb6:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ bba:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ bbe:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ bc2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ bc6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ bca:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ bce:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ bd2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ bd6:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ bd8:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ bdf:	84 c0                	test   %al,%al
+ be1:	0f 84 6f 01 00 00    	je     d56 <printf+0x1ad>
+ be7:	89 fb                	mov    %edi,%ebx
+ be9:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ bec:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ bef:	83 fa 25             	cmp    $0x25,%edx
+ bf2:	75 44                	jne    c38 <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ bf4:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ bf9:	49 ff c4             	inc    %r12
+ bfc:	45 84 ed             	test   %r13b,%r13b
+ bff:	0f 84 51 01 00 00    	je     d56 <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ c05:	41 0f b6 c5          	movzbl %r13b,%eax
+ c09:	41 0f be d5          	movsbl %r13b,%edx
+ c0d:	83 f8 64             	cmp    $0x64,%eax
+ c10:	74 7c                	je     c8e <printf+0xe5>
+ c12:	7f 29                	jg     c3d <printf+0x94>
+ c14:	83 f8 25             	cmp    $0x25,%eax
+ c17:	74 4c                	je     c65 <printf+0xbc>
+ c19:	83 f8 63             	cmp    $0x63,%eax
+ c1c:	75 33                	jne    c51 <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ c1e:	8b 55 98             	mov    -0x68(%rbp),%edx
+ c21:	83 fa 2f             	cmp    $0x2f,%edx
+ c24:	0f 87 1b 01 00 00    	ja     d45 <printf+0x19c>
+ c2a:	89 d0                	mov    %edx,%eax
+ c2c:	83 c2 08             	add    $0x8,%edx
+ c2f:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ c33:	89 55 98             	mov    %edx,-0x68(%rbp)
+ c36:	8b 00                	mov    (%rax),%eax
+ c38:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ c3b:	eb 2c                	jmp    c69 <printf+0xc0>
+ c3d:	83 f8 73             	cmp    $0x73,%eax
+ c40:	0f 84 aa 00 00 00    	je     cf0 <printf+0x147>
+ c46:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ c4c:	83 fa 70             	cmp    $0x70,%edx
+ c4f:	74 6b                	je     cbc <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ c51:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ c55:	ba 01 00 00 00       	mov    $0x1,%edx
+ c5a:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ c5e:	89 df                	mov    %ebx,%edi
+ c60:	e8 3b fe ff ff       	call   aa0 <write>
+        putc(fd, c);
+ c65:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ c69:	ba 01 00 00 00       	mov    $0x1,%edx
+ c6e:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ c72:	89 df                	mov    %ebx,%edi
+ c74:	e8 27 fe ff ff       	call   aa0 <write>
+  for(i = 0; fmt[i]; i++){
+ c79:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ c7e:	49 ff c4             	inc    %r12
+ c81:	84 c0                	test   %al,%al
+ c83:	0f 85 63 ff ff ff    	jne    bec <printf+0x43>
+ c89:	e9 c8 00 00 00       	jmp    d56 <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ c8e:	8b 55 98             	mov    -0x68(%rbp),%edx
+ c91:	83 fa 2f             	cmp    $0x2f,%edx
+ c94:	77 0e                	ja     ca4 <printf+0xfb>
+ c96:	89 d0                	mov    %edx,%eax
+ c98:	83 c2 08             	add    $0x8,%edx
+ c9b:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ c9f:	89 55 98             	mov    %edx,-0x68(%rbp)
+ ca2:	eb 0c                	jmp    cb0 <printf+0x107>
+ ca4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ ca8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ cac:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ cb0:	b9 01 00 00 00       	mov    $0x1,%ecx
+ cb5:	ba 0a 00 00 00       	mov    $0xa,%edx
+ cba:	eb 29                	jmp    ce5 <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ cbc:	8b 55 98             	mov    -0x68(%rbp),%edx
+ cbf:	83 fa 2f             	cmp    $0x2f,%edx
+ cc2:	77 0e                	ja     cd2 <printf+0x129>
+ cc4:	89 d0                	mov    %edx,%eax
+ cc6:	83 c2 08             	add    $0x8,%edx
+ cc9:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ ccd:	89 55 98             	mov    %edx,-0x68(%rbp)
+ cd0:	eb 0c                	jmp    cde <printf+0x135>
+ cd2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ cd6:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ cda:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ cde:	31 c9                	xor    %ecx,%ecx
+ ce0:	ba 10 00 00 00       	mov    $0x10,%edx
+ ce5:	8b 30                	mov    (%rax),%esi
+ ce7:	89 df                	mov    %ebx,%edi
+ ce9:	e8 3a fe ff ff       	call   b28 <printint>
+ cee:	eb 89                	jmp    c79 <printf+0xd0>
+        s = va_arg(ap, char*);
+ cf0:	8b 55 98             	mov    -0x68(%rbp),%edx
+ cf3:	83 fa 2f             	cmp    $0x2f,%edx
+ cf6:	77 0e                	ja     d06 <printf+0x15d>
+ cf8:	89 d0                	mov    %edx,%eax
+ cfa:	83 c2 08             	add    $0x8,%edx
+ cfd:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ d01:	89 55 98             	mov    %edx,-0x68(%rbp)
+ d04:	eb 0c                	jmp    d12 <printf+0x169>
+ d06:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ d0a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ d0e:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ d12:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ d15:	4d 85 ed             	test   %r13,%r13
+ d18:	75 07                	jne    d21 <printf+0x178>
+          s = "(null)";
+ d1a:	49 c7 c5 b8 0f 00 00 	mov    $0xfb8,%r13
+        while(*s != 0){
+ d21:	41 8a 45 00          	mov    0x0(%r13),%al
+ d25:	84 c0                	test   %al,%al
+ d27:	0f 84 4c ff ff ff    	je     c79 <printf+0xd0>
+          putc(fd, *s);
+ d2d:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ d30:	ba 01 00 00 00       	mov    $0x1,%edx
+ d35:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ d39:	89 df                	mov    %ebx,%edi
+          s++;
+ d3b:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ d3e:	e8 5d fd ff ff       	call   aa0 <write>
+          s++;
+ d43:	eb dc                	jmp    d21 <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ d45:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ d49:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ d4d:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ d51:	e9 e0 fe ff ff       	jmp    c36 <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ d56:	48 83 c4 58          	add    $0x58,%rsp
+ d5a:	5b                   	pop    %rbx
+ d5b:	41 5c                	pop    %r12
+ d5d:	41 5d                	pop    %r13
+ d5f:	5d                   	pop    %rbp
+ d60:	c3                   	ret
+
+0000000000000d61 <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d61:	48 8b 05 08 08 00 00 	mov    0x808(%rip),%rax        # 1570 <freep>
+{
+ d68:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ d6b:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d6f:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d72:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d75:	48 39 f2             	cmp    %rsi,%rdx
+ d78:	72 0c                	jb     d86 <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d7a:	48 39 c6             	cmp    %rax,%rsi
+ d7d:	73 f0                	jae    d6f <free+0xe>
+ d7f:	48 39 c2             	cmp    %rax,%rdx
+ d82:	72 eb                	jb     d6f <free+0xe>
+ d84:	eb 05                	jmp    d8b <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d86:	48 39 c6             	cmp    %rax,%rsi
+ d89:	73 f4                	jae    d7f <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d8b:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ d8e:	49 89 f8             	mov    %rdi,%r8
+ d91:	48 c1 e7 04          	shl    $0x4,%rdi
+ d95:	48 01 f7             	add    %rsi,%rdi
+ d98:	48 39 f8             	cmp    %rdi,%rax
+ d9b:	75 0e                	jne    dab <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ d9d:	44 03 40 08          	add    0x8(%rax),%r8d
+ da1:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ da5:	48 8b 02             	mov    (%rdx),%rax
+ da8:	48 8b 00             	mov    (%rax),%rax
+ dab:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ daf:	8b 42 08             	mov    0x8(%rdx),%eax
+ db2:	48 89 c7             	mov    %rax,%rdi
+ db5:	48 c1 e0 04          	shl    $0x4,%rax
+ db9:	48 01 d0             	add    %rdx,%rax
+ dbc:	48 39 c6             	cmp    %rax,%rsi
+ dbf:	75 0a                	jne    dcb <free+0x6a>
+    p->s.size += bp->s.size;
+ dc1:	03 79 f8             	add    -0x8(%rcx),%edi
+ dc4:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ dc7:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ dcb:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ dce:	48 89 15 9b 07 00 00 	mov    %rdx,0x79b(%rip)        # 1570 <freep>
+}
+ dd5:	c3                   	ret
+
+0000000000000dd6 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ dd6:	55                   	push   %rbp
+ dd7:	48 89 e5             	mov    %rsp,%rbp
+ dda:	41 55                	push   %r13
+ ddc:	41 54                	push   %r12
+ dde:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ddf:	89 fb                	mov    %edi,%ebx
+{
+ de1:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ de2:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ de6:	48 8b 0d 83 07 00 00 	mov    0x783(%rip),%rcx        # 1570 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ded:	48 c1 eb 04          	shr    $0x4,%rbx
+ df1:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ df3:	48 85 c9             	test   %rcx,%rcx
+ df6:	75 25                	jne    e1d <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ df8:	48 c7 05 6d 07 00 00 	movq   $0x1580,0x76d(%rip)        # 1570 <freep>
+ dff:	80 15 00 00 
+    base.s.size = 0;
+ e03:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ e05:	48 c7 05 70 07 00 00 	movq   $0x1580,0x770(%rip)        # 1580 <base>
+ e0c:	80 15 00 00 
+    base.s.size = 0;
+ e10:	89 0d 72 07 00 00    	mov    %ecx,0x772(%rip)        # 1588 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ e16:	48 c7 c1 80 15 00 00 	mov    $0x1580,%rcx
+  if(nu < 4096)
+ e1d:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e23:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ e26:	44 39 e3             	cmp    %r12d,%ebx
+ e29:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ e2d:	45 89 e5             	mov    %r12d,%r13d
+ e30:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ e34:	8b 50 08             	mov    0x8(%rax),%edx
+ e37:	39 da                	cmp    %ebx,%edx
+ e39:	72 26                	jb     e61 <malloc+0x8b>
+      if(p->s.size == nunits)
+ e3b:	75 08                	jne    e45 <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ e3d:	48 8b 10             	mov    (%rax),%rdx
+ e40:	48 89 11             	mov    %rdx,(%rcx)
+ e43:	eb 0f                	jmp    e54 <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ e45:	29 da                	sub    %ebx,%edx
+ e47:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ e4a:	48 c1 e2 04          	shl    $0x4,%rdx
+ e4e:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ e51:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ e54:	48 89 0d 15 07 00 00 	mov    %rcx,0x715(%rip)        # 1570 <freep>
+      return (void*)(p + 1);
+ e5b:	48 83 c0 10          	add    $0x10,%rax
+ e5f:	eb 3a                	jmp    e9b <malloc+0xc5>
+    }
+    if(p == freep)
+ e61:	48 39 05 08 07 00 00 	cmp    %rax,0x708(%rip)        # 1570 <freep>
+ e68:	75 27                	jne    e91 <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ e6a:	44 89 ef             	mov    %r13d,%edi
+ e6d:	e8 96 fc ff ff       	call   b08 <sbrk>
+  if(p == (char*)-1)
+ e72:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ e76:	74 21                	je     e99 <malloc+0xc3>
+  hp->s.size = nu;
+ e78:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ e7c:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ e80:	e8 dc fe ff ff       	call   d61 <free>
+  return freep;
+ e85:	48 8b 05 e4 06 00 00 	mov    0x6e4(%rip),%rax        # 1570 <freep>
+      if((p = morecore(nunits)) == 0)
+ e8c:	48 85 c0             	test   %rax,%rax
+ e8f:	74 08                	je     e99 <malloc+0xc3>
+    if(p->s.size >= nunits){
+ e91:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e94:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ e97:	eb 9b                	jmp    e34 <malloc+0x5e>
+        return 0;
+ e99:	31 c0                	xor    %eax,%eax
+  }
+}
+ e9b:	5a                   	pop    %rdx
+ e9c:	5b                   	pop    %rbx
+ e9d:	41 5c                	pop    %r12
+ e9f:	41 5d                	pop    %r13
+ ea1:	5d                   	pop    %rbp
+ ea2:	c3                   	ret
@@ -0,0 +1,974 @@
+
+.fs/stressfs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+  int fd, i;
+  char path[] = "stressfs0";
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+   1:	48 c7 c6 70 06 00 00 	mov    $0x670,%rsi
+   8:	bf 01 00 00 00       	mov    $0x1,%edi
+  char path[] = "stressfs0";
+   d:	48 b8 73 74 72 65 73 	movabs $0x7366737365727473,%rax
+  14:	73 66 73 
+{
+  17:	48 89 e5             	mov    %rsp,%rbp
+  1a:	41 54                	push   %r12
+  1c:	53                   	push   %rbx
+  memset(data, 'a', sizeof(data));
+
+  for(i = 0; i < 4; i++)
+  1d:	31 db                	xor    %ebx,%ebx
+{
+  1f:	48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+  char path[] = "stressfs0";
+  26:	48 89 85 e6 fd ff ff 	mov    %rax,-0x21a(%rbp)
+  printf(1, "stressfs starting\n");
+  2d:	31 c0                	xor    %eax,%eax
+  char path[] = "stressfs0";
+  2f:	66 c7 85 ee fd ff ff 	movw   $0x30,-0x212(%rbp)
+  36:	30 00 
+  printf(1, "stressfs starting\n");
+  38:	e8 32 03 00 00       	call   36f <printf>
+  memset(data, 'a', sizeof(data));
+  3d:	ba 00 02 00 00       	mov    $0x200,%edx
+  42:	be 61 00 00 00       	mov    $0x61,%esi
+  47:	48 8d bd f0 fd ff ff 	lea    -0x210(%rbp),%rdi
+  4e:	e8 f0 00 00 00       	call   143 <memset>
+    if(fork() > 0)
+  53:	e8 e6 01 00 00       	call   23e <fork>
+  58:	85 c0                	test   %eax,%eax
+  5a:	7f 07                	jg     63 <main+0x63>
+  for(i = 0; i < 4; i++)
+  5c:	ff c3                	inc    %ebx
+  5e:	83 fb 04             	cmp    $0x4,%ebx
+  61:	75 f0                	jne    53 <main+0x53>
+      break;
+
+  printf(1, "write %d\n", i);
+  63:	89 da                	mov    %ebx,%edx
+  65:	48 c7 c6 83 06 00 00 	mov    $0x683,%rsi
+  6c:	bf 01 00 00 00       	mov    $0x1,%edi
+  71:	31 c0                	xor    %eax,%eax
+  73:	e8 f7 02 00 00       	call   36f <printf>
+
+  path[8] += i;
+  fd = open(path, O_CREATE | O_RDWR);
+  78:	be 02 02 00 00       	mov    $0x202,%esi
+  7d:	48 8d bd e6 fd ff ff 	lea    -0x21a(%rbp),%rdi
+  path[8] += i;
+  84:	00 9d ee fd ff ff    	add    %bl,-0x212(%rbp)
+  fd = open(path, O_CREATE | O_RDWR);
+  8a:	e8 f7 01 00 00       	call   286 <open>
+  8f:	41 bc 14 00 00 00    	mov    $0x14,%r12d
+  95:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 20; i++)
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  97:	ba 00 02 00 00       	mov    $0x200,%edx
+  9c:	48 8d b5 f0 fd ff ff 	lea    -0x210(%rbp),%rsi
+  a3:	89 df                	mov    %ebx,%edi
+  a5:	e8 bc 01 00 00       	call   266 <write>
+  for(i = 0; i < 20; i++)
+  aa:	41 ff cc             	dec    %r12d
+  ad:	75 e8                	jne    97 <main+0x97>
+  close(fd);
+  af:	89 df                	mov    %ebx,%edi
+
+  printf(1, "read\n");
+
+  fd = open(path, O_RDONLY);
+  b1:	41 bc 14 00 00 00    	mov    $0x14,%r12d
+  close(fd);
+  b7:	e8 b2 01 00 00       	call   26e <close>
+  printf(1, "read\n");
+  bc:	48 c7 c6 8d 06 00 00 	mov    $0x68d,%rsi
+  c3:	bf 01 00 00 00       	mov    $0x1,%edi
+  c8:	31 c0                	xor    %eax,%eax
+  ca:	e8 a0 02 00 00       	call   36f <printf>
+  fd = open(path, O_RDONLY);
+  cf:	31 f6                	xor    %esi,%esi
+  d1:	48 8d bd e6 fd ff ff 	lea    -0x21a(%rbp),%rdi
+  d8:	e8 a9 01 00 00       	call   286 <open>
+  dd:	89 c3                	mov    %eax,%ebx
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  df:	ba 00 02 00 00       	mov    $0x200,%edx
+  e4:	48 8d b5 f0 fd ff ff 	lea    -0x210(%rbp),%rsi
+  eb:	89 df                	mov    %ebx,%edi
+  ed:	e8 6c 01 00 00       	call   25e <read>
+  for (i = 0; i < 20; i++)
+  f2:	41 ff cc             	dec    %r12d
+  f5:	75 e8                	jne    df <main+0xdf>
+  close(fd);
+  f7:	89 df                	mov    %ebx,%edi
+  f9:	e8 70 01 00 00       	call   26e <close>
+
+  wait();
+  fe:	e8 4b 01 00 00       	call   24e <wait>
+  
+  exit();
+ 103:	e8 3e 01 00 00       	call   246 <exit>
+
+0000000000000108 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 108:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 10b:	31 d2                	xor    %edx,%edx
+ 10d:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+ 110:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+ 113:	48 ff c2             	inc    %rdx
+ 116:	84 c9                	test   %cl,%cl
+ 118:	75 f3                	jne    10d <strcpy+0x5>
+    ;
+  return os;
+}
+ 11a:	c3                   	ret
+
+000000000000011b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+ 11b:	31 c9                	xor    %ecx,%ecx
+ 11d:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+ 121:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+ 125:	84 c0                	test   %al,%al
+ 127:	74 07                	je     130 <strcmp+0x15>
+ 129:	48 ff c1             	inc    %rcx
+ 12c:	38 d0                	cmp    %dl,%al
+ 12e:	74 ed                	je     11d <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+ 130:	29 d0                	sub    %edx,%eax
+}
+ 132:	c3                   	ret
+
+0000000000000133 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 133:	31 d2                	xor    %edx,%edx
+ 135:	48 89 d0             	mov    %rdx,%rax
+ 138:	48 ff c2             	inc    %rdx
+ 13b:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+ 140:	75 f3                	jne    135 <strlen+0x2>
+    ;
+  return n;
+}
+ 142:	c3                   	ret
+
+0000000000000143 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 143:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 146:	89 d1                	mov    %edx,%ecx
+ 148:	89 f0                	mov    %esi,%eax
+ 14a:	fc                   	cld
+ 14b:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 14d:	4c 89 c0             	mov    %r8,%rax
+ 150:	c3                   	ret
+
+0000000000000151 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+ 151:	48 89 f8             	mov    %rdi,%rax
+ 154:	8a 10                	mov    (%rax),%dl
+ 156:	84 d2                	test   %dl,%dl
+ 158:	74 0a                	je     164 <strchr+0x13>
+    if(*s == c)
+ 15a:	40 38 f2             	cmp    %sil,%dl
+ 15d:	74 07                	je     166 <strchr+0x15>
+  for(; *s; s++)
+ 15f:	48 ff c0             	inc    %rax
+ 162:	eb f0                	jmp    154 <strchr+0x3>
+      return (char*)s;
+  return 0;
+ 164:	31 c0                	xor    %eax,%eax
+}
+ 166:	c3                   	ret
+
+0000000000000167 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 167:	55                   	push   %rbp
+ 168:	48 89 e5             	mov    %rsp,%rbp
+ 16b:	41 56                	push   %r14
+ 16d:	41 89 f6             	mov    %esi,%r14d
+ 170:	41 55                	push   %r13
+ 172:	41 54                	push   %r12
+ 174:	49 89 fc             	mov    %rdi,%r12
+ 177:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 178:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+ 17d:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+ 181:	41 89 dd             	mov    %ebx,%r13d
+ 184:	44 39 f3             	cmp    %r14d,%ebx
+ 187:	7d 29                	jge    1b2 <gets+0x4b>
+    cc = read(0, &c, 1);
+ 189:	31 ff                	xor    %edi,%edi
+ 18b:	ba 01 00 00 00       	mov    $0x1,%edx
+ 190:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 194:	e8 c5 00 00 00       	call   25e <read>
+    if(cc < 1)
+ 199:	85 c0                	test   %eax,%eax
+ 19b:	7e 15                	jle    1b2 <gets+0x4b>
+      break;
+    buf[i++] = c;
+ 19d:	8a 45 df             	mov    -0x21(%rbp),%al
+ 1a0:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+ 1a5:	48 ff c3             	inc    %rbx
+ 1a8:	3c 0a                	cmp    $0xa,%al
+ 1aa:	74 0a                	je     1b6 <gets+0x4f>
+ 1ac:	3c 0d                	cmp    $0xd,%al
+ 1ae:	75 d1                	jne    181 <gets+0x1a>
+ 1b0:	eb 04                	jmp    1b6 <gets+0x4f>
+ 1b2:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 1b6:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 1b9:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 1bc:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 1c1:	5a                   	pop    %rdx
+ 1c2:	59                   	pop    %rcx
+ 1c3:	5b                   	pop    %rbx
+ 1c4:	41 5c                	pop    %r12
+ 1c6:	41 5d                	pop    %r13
+ 1c8:	41 5e                	pop    %r14
+ 1ca:	5d                   	pop    %rbp
+ 1cb:	c3                   	ret
+
+00000000000001cc <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1cc:	55                   	push   %rbp
+ 1cd:	48 89 e5             	mov    %rsp,%rbp
+ 1d0:	41 55                	push   %r13
+ 1d2:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1d5:	31 f6                	xor    %esi,%esi
+{
+ 1d7:	41 54                	push   %r12
+ 1d9:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 1dd:	53                   	push   %rbx
+ 1de:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 1df:	e8 a2 00 00 00       	call   286 <open>
+  if(fd < 0)
+ 1e4:	85 c0                	test   %eax,%eax
+ 1e6:	78 16                	js     1fe <stat+0x32>
+ 1e8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 1ea:	89 c7                	mov    %eax,%edi
+ 1ec:	4c 89 ee             	mov    %r13,%rsi
+ 1ef:	e8 aa 00 00 00       	call   29e <fstat>
+  close(fd);
+ 1f4:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 1f6:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 1f9:	e8 70 00 00 00       	call   26e <close>
+  return r;
+}
+ 1fe:	5a                   	pop    %rdx
+ 1ff:	44 89 e0             	mov    %r12d,%eax
+ 202:	5b                   	pop    %rbx
+ 203:	41 5c                	pop    %r12
+ 205:	41 5d                	pop    %r13
+ 207:	5d                   	pop    %rbp
+ 208:	c3                   	ret
+
+0000000000000209 <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 209:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 20b:	0f be 17             	movsbl (%rdi),%edx
+ 20e:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 211:	80 f9 09             	cmp    $0x9,%cl
+ 214:	77 0c                	ja     222 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 216:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 219:	48 ff c7             	inc    %rdi
+ 21c:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 220:	eb e9                	jmp    20b <atoi+0x2>
+  return n;
+}
+ 222:	c3                   	ret
+
+0000000000000223 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 223:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 226:	31 c9                	xor    %ecx,%ecx
+ 228:	89 d7                	mov    %edx,%edi
+ 22a:	29 cf                	sub    %ecx,%edi
+ 22c:	85 ff                	test   %edi,%edi
+ 22e:	7e 0d                	jle    23d <memmove+0x1a>
+    *dst++ = *src++;
+ 230:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 234:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 238:	48 ff c1             	inc    %rcx
+ 23b:	eb eb                	jmp    228 <memmove+0x5>
+  return vdst;
+}
+ 23d:	c3                   	ret
+
+000000000000023e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 23e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 243:	cd 40                	int    $0x40
+ 245:	c3                   	ret
+
+0000000000000246 <exit>:
+SYSCALL(exit)
+ 246:	b8 02 00 00 00       	mov    $0x2,%eax
+ 24b:	cd 40                	int    $0x40
+ 24d:	c3                   	ret
+
+000000000000024e <wait>:
+SYSCALL(wait)
+ 24e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 253:	cd 40                	int    $0x40
+ 255:	c3                   	ret
+
+0000000000000256 <pipe>:
+SYSCALL(pipe)
+ 256:	b8 04 00 00 00       	mov    $0x4,%eax
+ 25b:	cd 40                	int    $0x40
+ 25d:	c3                   	ret
+
+000000000000025e <read>:
+SYSCALL(read)
+ 25e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 263:	cd 40                	int    $0x40
+ 265:	c3                   	ret
+
+0000000000000266 <write>:
+SYSCALL(write)
+ 266:	b8 10 00 00 00       	mov    $0x10,%eax
+ 26b:	cd 40                	int    $0x40
+ 26d:	c3                   	ret
+
+000000000000026e <close>:
+SYSCALL(close)
+ 26e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 273:	cd 40                	int    $0x40
+ 275:	c3                   	ret
+
+0000000000000276 <kill>:
+SYSCALL(kill)
+ 276:	b8 06 00 00 00       	mov    $0x6,%eax
+ 27b:	cd 40                	int    $0x40
+ 27d:	c3                   	ret
+
+000000000000027e <exec>:
+SYSCALL(exec)
+ 27e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 283:	cd 40                	int    $0x40
+ 285:	c3                   	ret
+
+0000000000000286 <open>:
+SYSCALL(open)
+ 286:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 28b:	cd 40                	int    $0x40
+ 28d:	c3                   	ret
+
+000000000000028e <mknod>:
+SYSCALL(mknod)
+ 28e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 293:	cd 40                	int    $0x40
+ 295:	c3                   	ret
+
+0000000000000296 <unlink>:
+SYSCALL(unlink)
+ 296:	b8 12 00 00 00       	mov    $0x12,%eax
+ 29b:	cd 40                	int    $0x40
+ 29d:	c3                   	ret
+
+000000000000029e <fstat>:
+SYSCALL(fstat)
+ 29e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2a3:	cd 40                	int    $0x40
+ 2a5:	c3                   	ret
+
+00000000000002a6 <link>:
+SYSCALL(link)
+ 2a6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2ab:	cd 40                	int    $0x40
+ 2ad:	c3                   	ret
+
+00000000000002ae <mkdir>:
+SYSCALL(mkdir)
+ 2ae:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2b3:	cd 40                	int    $0x40
+ 2b5:	c3                   	ret
+
+00000000000002b6 <chdir>:
+SYSCALL(chdir)
+ 2b6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2bb:	cd 40                	int    $0x40
+ 2bd:	c3                   	ret
+
+00000000000002be <dup>:
+SYSCALL(dup)
+ 2be:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2c3:	cd 40                	int    $0x40
+ 2c5:	c3                   	ret
+
+00000000000002c6 <getpid>:
+SYSCALL(getpid)
+ 2c6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 2cb:	cd 40                	int    $0x40
+ 2cd:	c3                   	ret
+
+00000000000002ce <sbrk>:
+SYSCALL(sbrk)
+ 2ce:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2d3:	cd 40                	int    $0x40
+ 2d5:	c3                   	ret
+
+00000000000002d6 <sleep>:
+SYSCALL(sleep)
+ 2d6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 2db:	cd 40                	int    $0x40
+ 2dd:	c3                   	ret
+
+00000000000002de <uptime>:
+SYSCALL(uptime)
+ 2de:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 2e3:	cd 40                	int    $0x40
+ 2e5:	c3                   	ret
+
+00000000000002e6 <chmod>:
+SYSCALL(chmod)
+ 2e6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 2eb:	cd 40                	int    $0x40
+ 2ed:	c3                   	ret
+
+00000000000002ee <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 2ee:	55                   	push   %rbp
+ 2ef:	48 89 e5             	mov    %rsp,%rbp
+ 2f2:	41 54                	push   %r12
+ 2f4:	41 89 fc             	mov    %edi,%r12d
+ 2f7:	89 d7                	mov    %edx,%edi
+ 2f9:	53                   	push   %rbx
+ 2fa:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 2fe:	85 f6                	test   %esi,%esi
+ 300:	79 0f                	jns    311 <printint+0x23>
+ 302:	80 e1 01             	and    $0x1,%cl
+ 305:	74 0a                	je     311 <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 307:	f7 de                	neg    %esi
+    neg = 1;
+ 309:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 30f:	eb 03                	jmp    314 <printint+0x26>
+  neg = 0;
+ 311:	45 31 c0             	xor    %r8d,%r8d
+ 314:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 316:	89 f0                	mov    %esi,%eax
+ 318:	31 d2                	xor    %edx,%edx
+ 31a:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 31d:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 320:	f7 f7                	div    %edi
+ 322:	8a 92 a0 06 00 00    	mov    0x6a0(%rdx),%dl
+ 328:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 32c:	89 f2                	mov    %esi,%edx
+ 32e:	89 c6                	mov    %eax,%esi
+ 330:	39 fa                	cmp    %edi,%edx
+ 332:	73 e2                	jae    316 <printint+0x28>
+  if(neg)
+ 334:	45 85 c0             	test   %r8d,%r8d
+ 337:	74 0a                	je     343 <printint+0x55>
+    buf[i++] = digits[x % base];
+ 339:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 33b:	48 63 c3             	movslq %ebx,%rax
+ 33e:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 343:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 346:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 34a:	ba 01 00 00 00       	mov    $0x1,%edx
+ 34f:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 353:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 356:	48 ff cb             	dec    %rbx
+ 359:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 35c:	e8 05 ff ff ff       	call   266 <write>
+  while(--i >= 0)
+ 361:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 364:	75 e0                	jne    346 <printint+0x58>
+}
+ 366:	48 83 c4 20          	add    $0x20,%rsp
+ 36a:	5b                   	pop    %rbx
+ 36b:	41 5c                	pop    %r12
+ 36d:	5d                   	pop    %rbp
+ 36e:	c3                   	ret
+
+000000000000036f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 36f:	55                   	push   %rbp
+ 370:	48 89 e5             	mov    %rsp,%rbp
+ 373:	41 55                	push   %r13
+ 375:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 377:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 37b:	53                   	push   %rbx
+ 37c:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 380:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 384:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 388:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 38c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 390:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 394:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 398:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 39c:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 39e:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 3a5:	84 c0                	test   %al,%al
+ 3a7:	0f 84 6f 01 00 00    	je     51c <printf+0x1ad>
+ 3ad:	89 fb                	mov    %edi,%ebx
+ 3af:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 3b2:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 3b5:	83 fa 25             	cmp    $0x25,%edx
+ 3b8:	75 44                	jne    3fe <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 3ba:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 3bf:	49 ff c4             	inc    %r12
+ 3c2:	45 84 ed             	test   %r13b,%r13b
+ 3c5:	0f 84 51 01 00 00    	je     51c <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 3cb:	41 0f b6 c5          	movzbl %r13b,%eax
+ 3cf:	41 0f be d5          	movsbl %r13b,%edx
+ 3d3:	83 f8 64             	cmp    $0x64,%eax
+ 3d6:	74 7c                	je     454 <printf+0xe5>
+ 3d8:	7f 29                	jg     403 <printf+0x94>
+ 3da:	83 f8 25             	cmp    $0x25,%eax
+ 3dd:	74 4c                	je     42b <printf+0xbc>
+ 3df:	83 f8 63             	cmp    $0x63,%eax
+ 3e2:	75 33                	jne    417 <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 3e4:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3e7:	83 fa 2f             	cmp    $0x2f,%edx
+ 3ea:	0f 87 1b 01 00 00    	ja     50b <printf+0x19c>
+ 3f0:	89 d0                	mov    %edx,%eax
+ 3f2:	83 c2 08             	add    $0x8,%edx
+ 3f5:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3f9:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3fc:	8b 00                	mov    (%rax),%eax
+ 3fe:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 401:	eb 2c                	jmp    42f <printf+0xc0>
+ 403:	83 f8 73             	cmp    $0x73,%eax
+ 406:	0f 84 aa 00 00 00    	je     4b6 <printf+0x147>
+ 40c:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 412:	83 fa 70             	cmp    $0x70,%edx
+ 415:	74 6b                	je     482 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 417:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 41b:	ba 01 00 00 00       	mov    $0x1,%edx
+ 420:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 424:	89 df                	mov    %ebx,%edi
+ 426:	e8 3b fe ff ff       	call   266 <write>
+        putc(fd, c);
+ 42b:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 42f:	ba 01 00 00 00       	mov    $0x1,%edx
+ 434:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 438:	89 df                	mov    %ebx,%edi
+ 43a:	e8 27 fe ff ff       	call   266 <write>
+  for(i = 0; fmt[i]; i++){
+ 43f:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 444:	49 ff c4             	inc    %r12
+ 447:	84 c0                	test   %al,%al
+ 449:	0f 85 63 ff ff ff    	jne    3b2 <printf+0x43>
+ 44f:	e9 c8 00 00 00       	jmp    51c <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 454:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 457:	83 fa 2f             	cmp    $0x2f,%edx
+ 45a:	77 0e                	ja     46a <printf+0xfb>
+ 45c:	89 d0                	mov    %edx,%eax
+ 45e:	83 c2 08             	add    $0x8,%edx
+ 461:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 465:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 468:	eb 0c                	jmp    476 <printf+0x107>
+ 46a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 46e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 472:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 476:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 47b:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 480:	eb 29                	jmp    4ab <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 482:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 485:	83 fa 2f             	cmp    $0x2f,%edx
+ 488:	77 0e                	ja     498 <printf+0x129>
+ 48a:	89 d0                	mov    %edx,%eax
+ 48c:	83 c2 08             	add    $0x8,%edx
+ 48f:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 493:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 496:	eb 0c                	jmp    4a4 <printf+0x135>
+ 498:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 49c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4a0:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 4a4:	31 c9                	xor    %ecx,%ecx
+ 4a6:	ba 10 00 00 00       	mov    $0x10,%edx
+ 4ab:	8b 30                	mov    (%rax),%esi
+ 4ad:	89 df                	mov    %ebx,%edi
+ 4af:	e8 3a fe ff ff       	call   2ee <printint>
+ 4b4:	eb 89                	jmp    43f <printf+0xd0>
+        s = va_arg(ap, char*);
+ 4b6:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 4b9:	83 fa 2f             	cmp    $0x2f,%edx
+ 4bc:	77 0e                	ja     4cc <printf+0x15d>
+ 4be:	89 d0                	mov    %edx,%eax
+ 4c0:	83 c2 08             	add    $0x8,%edx
+ 4c3:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 4c7:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 4ca:	eb 0c                	jmp    4d8 <printf+0x169>
+ 4cc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 4d0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4d4:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 4d8:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 4db:	4d 85 ed             	test   %r13,%r13
+ 4de:	75 07                	jne    4e7 <printf+0x178>
+          s = "(null)";
+ 4e0:	49 c7 c5 93 06 00 00 	mov    $0x693,%r13
+        while(*s != 0){
+ 4e7:	41 8a 45 00          	mov    0x0(%r13),%al
+ 4eb:	84 c0                	test   %al,%al
+ 4ed:	0f 84 4c ff ff ff    	je     43f <printf+0xd0>
+          putc(fd, *s);
+ 4f3:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 4f6:	ba 01 00 00 00       	mov    $0x1,%edx
+ 4fb:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 4ff:	89 df                	mov    %ebx,%edi
+          s++;
+ 501:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 504:	e8 5d fd ff ff       	call   266 <write>
+          s++;
+ 509:	eb dc                	jmp    4e7 <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 50b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 50f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 513:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 517:	e9 e0 fe ff ff       	jmp    3fc <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 51c:	48 83 c4 58          	add    $0x58,%rsp
+ 520:	5b                   	pop    %rbx
+ 521:	41 5c                	pop    %r12
+ 523:	41 5d                	pop    %r13
+ 525:	5d                   	pop    %rbp
+ 526:	c3                   	ret
+
+0000000000000527 <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 527:	48 8b 05 52 03 00 00 	mov    0x352(%rip),%rax        # 880 <freep>
+{
+ 52e:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 531:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 535:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 538:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 53b:	48 39 f2             	cmp    %rsi,%rdx
+ 53e:	72 0c                	jb     54c <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 540:	48 39 c6             	cmp    %rax,%rsi
+ 543:	73 f0                	jae    535 <free+0xe>
+ 545:	48 39 c2             	cmp    %rax,%rdx
+ 548:	72 eb                	jb     535 <free+0xe>
+ 54a:	eb 05                	jmp    551 <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 54c:	48 39 c6             	cmp    %rax,%rsi
+ 54f:	73 f4                	jae    545 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 551:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 554:	49 89 f8             	mov    %rdi,%r8
+ 557:	48 c1 e7 04          	shl    $0x4,%rdi
+ 55b:	48 01 f7             	add    %rsi,%rdi
+ 55e:	48 39 f8             	cmp    %rdi,%rax
+ 561:	75 0e                	jne    571 <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 563:	44 03 40 08          	add    0x8(%rax),%r8d
+ 567:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 56b:	48 8b 02             	mov    (%rdx),%rax
+ 56e:	48 8b 00             	mov    (%rax),%rax
+ 571:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 575:	8b 42 08             	mov    0x8(%rdx),%eax
+ 578:	48 89 c7             	mov    %rax,%rdi
+ 57b:	48 c1 e0 04          	shl    $0x4,%rax
+ 57f:	48 01 d0             	add    %rdx,%rax
+ 582:	48 39 c6             	cmp    %rax,%rsi
+ 585:	75 0a                	jne    591 <free+0x6a>
+    p->s.size += bp->s.size;
+ 587:	03 79 f8             	add    -0x8(%rcx),%edi
+ 58a:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 58d:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 591:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 594:	48 89 15 e5 02 00 00 	mov    %rdx,0x2e5(%rip)        # 880 <freep>
+}
+ 59b:	c3                   	ret
+
+000000000000059c <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 59c:	55                   	push   %rbp
+ 59d:	48 89 e5             	mov    %rsp,%rbp
+ 5a0:	41 55                	push   %r13
+ 5a2:	41 54                	push   %r12
+ 5a4:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5a5:	89 fb                	mov    %edi,%ebx
+{
+ 5a7:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5a8:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 5ac:	48 8b 0d cd 02 00 00 	mov    0x2cd(%rip),%rcx        # 880 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5b3:	48 c1 eb 04          	shr    $0x4,%rbx
+ 5b7:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 5b9:	48 85 c9             	test   %rcx,%rcx
+ 5bc:	75 25                	jne    5e3 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 5be:	48 c7 05 b7 02 00 00 	movq   $0x890,0x2b7(%rip)        # 880 <freep>
+ 5c5:	90 08 00 00 
+    base.s.size = 0;
+ 5c9:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 5cb:	48 c7 05 ba 02 00 00 	movq   $0x890,0x2ba(%rip)        # 890 <base>
+ 5d2:	90 08 00 00 
+    base.s.size = 0;
+ 5d6:	89 0d bc 02 00 00    	mov    %ecx,0x2bc(%rip)        # 898 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 5dc:	48 c7 c1 90 08 00 00 	mov    $0x890,%rcx
+  if(nu < 4096)
+ 5e3:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 5e9:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 5ec:	44 39 e3             	cmp    %r12d,%ebx
+ 5ef:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 5f3:	45 89 e5             	mov    %r12d,%r13d
+ 5f6:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 5fa:	8b 50 08             	mov    0x8(%rax),%edx
+ 5fd:	39 da                	cmp    %ebx,%edx
+ 5ff:	72 26                	jb     627 <malloc+0x8b>
+      if(p->s.size == nunits)
+ 601:	75 08                	jne    60b <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 603:	48 8b 10             	mov    (%rax),%rdx
+ 606:	48 89 11             	mov    %rdx,(%rcx)
+ 609:	eb 0f                	jmp    61a <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 60b:	29 da                	sub    %ebx,%edx
+ 60d:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 610:	48 c1 e2 04          	shl    $0x4,%rdx
+ 614:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 617:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 61a:	48 89 0d 5f 02 00 00 	mov    %rcx,0x25f(%rip)        # 880 <freep>
+      return (void*)(p + 1);
+ 621:	48 83 c0 10          	add    $0x10,%rax
+ 625:	eb 3a                	jmp    661 <malloc+0xc5>
+    }
+    if(p == freep)
+ 627:	48 39 05 52 02 00 00 	cmp    %rax,0x252(%rip)        # 880 <freep>
+ 62e:	75 27                	jne    657 <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 630:	44 89 ef             	mov    %r13d,%edi
+ 633:	e8 96 fc ff ff       	call   2ce <sbrk>
+  if(p == (char*)-1)
+ 638:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 63c:	74 21                	je     65f <malloc+0xc3>
+  hp->s.size = nu;
+ 63e:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 642:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 646:	e8 dc fe ff ff       	call   527 <free>
+  return freep;
+ 64b:	48 8b 05 2e 02 00 00 	mov    0x22e(%rip),%rax        # 880 <freep>
+      if((p = morecore(nunits)) == 0)
+ 652:	48 85 c0             	test   %rax,%rax
+ 655:	74 08                	je     65f <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 657:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 65a:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 65d:	eb 9b                	jmp    5fa <malloc+0x5e>
+        return 0;
+ 65f:	31 c0                	xor    %eax,%eax
+  }
+}
+ 661:	5a                   	pop    %rdx
+ 662:	5b                   	pop    %rbx
+ 663:	41 5c                	pop    %r12
+ 665:	41 5d                	pop    %r13
+ 667:	5d                   	pop    %rbp
+ 668:	c3                   	ret
@@ -0,0 +1,4908 @@
+
+.fs/usertests:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	55                   	push   %rbp
+  printf(1, "usertests starting\n");
+       1:	48 c7 c6 8c 45 00 00 	mov    $0x458c,%rsi
+       8:	bf 01 00 00 00       	mov    $0x1,%edi
+       d:	31 c0                	xor    %eax,%eax
+{
+       f:	48 89 e5             	mov    %rsp,%rbp
+  printf(1, "usertests starting\n");
+      12:	e8 fa 2b 00 00       	call   2c11 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      17:	31 f6                	xor    %esi,%esi
+      19:	48 c7 c7 a0 45 00 00 	mov    $0x45a0,%rdi
+      20:	e8 03 2b 00 00       	call   2b28 <open>
+      25:	85 c0                	test   %eax,%eax
+      27:	78 18                	js     41 <main+0x41>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      29:	48 c7 c6 ae 45 00 00 	mov    $0x45ae,%rsi
+      30:	bf 01 00 00 00       	mov    $0x1,%edi
+      35:	31 c0                	xor    %eax,%eax
+      37:	e8 d5 2b 00 00       	call   2c11 <printf>
+    exit();
+      3c:	e9 bf 00 00 00       	jmp    100 <main+0x100>
+  }
+  close(open("usertests.ran", O_CREATE));
+      41:	be 00 02 00 00       	mov    $0x200,%esi
+      46:	48 c7 c7 a0 45 00 00 	mov    $0x45a0,%rdi
+      4d:	e8 d6 2a 00 00       	call   2b28 <open>
+      52:	89 c7                	mov    %eax,%edi
+      54:	e8 b7 2a 00 00       	call   2b10 <close>
+
+  createdelete();
+      59:	e8 37 0e 00 00       	call   e95 <createdelete>
+  linkunlink();
+      5e:	31 c0                	xor    %eax,%eax
+      60:	e8 f3 14 00 00       	call   1558 <linkunlink>
+  concreate();
+      65:	e8 93 12 00 00       	call   12fd <concreate>
+  fourfiles();
+      6a:	e8 66 0c 00 00       	call   cd5 <fourfiles>
+  sharedfd();
+      6f:	e8 d7 0a 00 00       	call   b4b <sharedfd>
+
+  bigargtest();
+      74:	e8 c6 26 00 00       	call   273f <bigargtest>
+  bigwrite();
+      79:	e8 85 1b 00 00       	call   1c03 <bigwrite>
+  bigargtest();
+      7e:	e8 bc 26 00 00       	call   273f <bigargtest>
+  bsstest();
+      83:	e8 5b 26 00 00       	call   26e3 <bsstest>
+  sbrktest();
+      88:	e8 7a 22 00 00       	call   2307 <sbrktest>
+  validatetest();
+      8d:	e8 b9 25 00 00       	call   264b <validatetest>
+
+  opentest();
+      92:	e8 52 02 00 00       	call   2e9 <opentest>
+  writetest();
+      97:	e8 c5 02 00 00       	call   361 <writetest>
+  writetest1();
+      9c:	e8 45 04 00 00       	call   4e6 <writetest1>
+  createtest();
+      a1:	e8 a9 05 00 00       	call   64f <createtest>
+
+  openiputtest();
+      a6:	e8 92 01 00 00       	call   23d <openiputtest>
+  exitiputtest();
+      ab:	e8 f0 00 00 00       	call   1a0 <exitiputtest>
+  iputtest();
+      b0:	e8 50 00 00 00       	call   105 <iputtest>
+
+  mem();
+      b5:	e8 dd 09 00 00       	call   a97 <mem>
+  pipe1();
+      ba:	e8 04 07 00 00       	call   7c3 <pipe1>
+  preempt();
+      bf:	e8 57 08 00 00       	call   91b <preempt>
+  exitwait();
+      c4:	e8 78 09 00 00       	call   a41 <exitwait>
+
+  rmdot();
+      c9:	e8 52 1e 00 00       	call   1f20 <rmdot>
+  fourteen();
+      ce:	e8 68 1d 00 00       	call   1e3b <fourteen>
+  bigfile();
+      d3:	e8 07 1c 00 00       	call   1cdf <bigfile>
+  subdir();
+      d8:	e8 72 16 00 00       	call   174f <subdir>
+  linktest();
+      dd:	e8 89 10 00 00       	call   116b <linktest>
+  unlinkread();
+      e2:	e8 3d 0f 00 00       	call   1024 <unlinkread>
+  dirfile();
+      e7:	e8 36 1f 00 00       	call   2022 <dirfile>
+  iref();
+      ec:	e8 a4 20 00 00       	call   2195 <iref>
+  forktest();
+      f1:	e8 8b 21 00 00       	call   2281 <forktest>
+  bigdir(); // slow
+      f6:	e8 46 15 00 00       	call   1641 <bigdir>
+  exectest();
+      fb:	e8 79 06 00 00       	call   779 <exectest>
+
+  exit();
+     100:	e8 e3 29 00 00       	call   2ae8 <exit>
+
+0000000000000105 <iputtest>:
+{
+     105:	55                   	push   %rbp
+  printf(stdout, "iput test\n");
+     106:	8b 3d 7c 4c 00 00    	mov    0x4c7c(%rip),%edi        # 4d88 <stdout>
+     10c:	48 c7 c6 a4 2f 00 00 	mov    $0x2fa4,%rsi
+     113:	31 c0                	xor    %eax,%eax
+{
+     115:	48 89 e5             	mov    %rsp,%rbp
+  printf(stdout, "iput test\n");
+     118:	e8 f4 2a 00 00       	call   2c11 <printf>
+  if(mkdir("iputdir") < 0){
+     11d:	48 c7 c7 37 2f 00 00 	mov    $0x2f37,%rdi
+     124:	e8 27 2a 00 00       	call   2b50 <mkdir>
+    printf(stdout, "mkdir failed\n");
+     129:	48 c7 c6 10 2f 00 00 	mov    $0x2f10,%rsi
+  if(mkdir("iputdir") < 0){
+     130:	85 c0                	test   %eax,%eax
+     132:	78 17                	js     14b <iputtest+0x46>
+  if(chdir("iputdir") < 0){
+     134:	48 c7 c7 37 2f 00 00 	mov    $0x2f37,%rdi
+     13b:	e8 18 2a 00 00       	call   2b58 <chdir>
+     140:	85 c0                	test   %eax,%eax
+     142:	79 19                	jns    15d <iputtest+0x58>
+    printf(stdout, "chdir iputdir failed\n");
+     144:	48 c7 c6 1e 2f 00 00 	mov    $0x2f1e,%rsi
+     14b:	8b 3d 37 4c 00 00    	mov    0x4c37(%rip),%edi        # 4d88 <stdout>
+     151:	31 c0                	xor    %eax,%eax
+     153:	e8 b9 2a 00 00       	call   2c11 <printf>
+    exit();
+     158:	e8 8b 29 00 00       	call   2ae8 <exit>
+  if(unlink("../iputdir") < 0){
+     15d:	48 c7 c7 34 2f 00 00 	mov    $0x2f34,%rdi
+     164:	e8 cf 29 00 00       	call   2b38 <unlink>
+    printf(stdout, "unlink ../iputdir failed\n");
+     169:	48 c7 c6 3f 2f 00 00 	mov    $0x2f3f,%rsi
+  if(unlink("../iputdir") < 0){
+     170:	85 c0                	test   %eax,%eax
+     172:	78 d7                	js     14b <iputtest+0x46>
+  if(chdir("/") < 0){
+     174:	48 c7 c7 59 2f 00 00 	mov    $0x2f59,%rdi
+     17b:	e8 d8 29 00 00       	call   2b58 <chdir>
+    printf(stdout, "chdir / failed\n");
+     180:	48 c7 c6 5b 2f 00 00 	mov    $0x2f5b,%rsi
+  if(chdir("/") < 0){
+     187:	85 c0                	test   %eax,%eax
+     189:	78 c0                	js     14b <iputtest+0x46>
+  printf(stdout, "iput test ok\n");
+     18b:	8b 3d f7 4b 00 00    	mov    0x4bf7(%rip),%edi        # 4d88 <stdout>
+     191:	48 c7 c6 00 30 00 00 	mov    $0x3000,%rsi
+     198:	31 c0                	xor    %eax,%eax
+}
+     19a:	5d                   	pop    %rbp
+  printf(stdout, "iput test ok\n");
+     19b:	e9 71 2a 00 00       	jmp    2c11 <printf>
+
+00000000000001a0 <exitiputtest>:
+{
+     1a0:	55                   	push   %rbp
+  printf(stdout, "exitiput test\n");
+     1a1:	8b 3d e1 4b 00 00    	mov    0x4be1(%rip),%edi        # 4d88 <stdout>
+     1a7:	48 c7 c6 6b 2f 00 00 	mov    $0x2f6b,%rsi
+     1ae:	31 c0                	xor    %eax,%eax
+{
+     1b0:	48 89 e5             	mov    %rsp,%rbp
+  printf(stdout, "exitiput test\n");
+     1b3:	e8 59 2a 00 00       	call   2c11 <printf>
+  pid = fork();
+     1b8:	e8 23 29 00 00       	call   2ae0 <fork>
+    printf(stdout, "fork failed\n");
+     1bd:	48 c7 c6 1b 45 00 00 	mov    $0x451b,%rsi
+  if(pid < 0){
+     1c4:	85 c0                	test   %eax,%eax
+     1c6:	78 19                	js     1e1 <exitiputtest+0x41>
+  if(pid == 0){
+     1c8:	75 59                	jne    223 <exitiputtest+0x83>
+    if(mkdir("iputdir") < 0){
+     1ca:	48 c7 c7 37 2f 00 00 	mov    $0x2f37,%rdi
+     1d1:	e8 7a 29 00 00       	call   2b50 <mkdir>
+     1d6:	85 c0                	test   %eax,%eax
+     1d8:	79 19                	jns    1f3 <exitiputtest+0x53>
+      printf(stdout, "mkdir failed\n");
+     1da:	48 c7 c6 10 2f 00 00 	mov    $0x2f10,%rsi
+     1e1:	8b 3d a1 4b 00 00    	mov    0x4ba1(%rip),%edi        # 4d88 <stdout>
+     1e7:	31 c0                	xor    %eax,%eax
+     1e9:	e8 23 2a 00 00       	call   2c11 <printf>
+      exit();
+     1ee:	e8 f5 28 00 00       	call   2ae8 <exit>
+    if(chdir("iputdir") < 0){
+     1f3:	48 c7 c7 37 2f 00 00 	mov    $0x2f37,%rdi
+     1fa:	e8 59 29 00 00       	call   2b58 <chdir>
+      printf(stdout, "child chdir failed\n");
+     1ff:	48 c7 c6 7a 2f 00 00 	mov    $0x2f7a,%rsi
+    if(chdir("iputdir") < 0){
+     206:	85 c0                	test   %eax,%eax
+     208:	78 d7                	js     1e1 <exitiputtest+0x41>
+    if(unlink("../iputdir") < 0){
+     20a:	48 c7 c7 34 2f 00 00 	mov    $0x2f34,%rdi
+     211:	e8 22 29 00 00       	call   2b38 <unlink>
+      printf(stdout, "unlink ../iputdir failed\n");
+     216:	48 c7 c6 3f 2f 00 00 	mov    $0x2f3f,%rsi
+    if(unlink("../iputdir") < 0){
+     21d:	85 c0                	test   %eax,%eax
+     21f:	79 cd                	jns    1ee <exitiputtest+0x4e>
+     221:	eb be                	jmp    1e1 <exitiputtest+0x41>
+  wait();
+     223:	e8 c8 28 00 00       	call   2af0 <wait>
+  printf(stdout, "exitiput test ok\n");
+     228:	8b 3d 5a 4b 00 00    	mov    0x4b5a(%rip),%edi        # 4d88 <stdout>
+     22e:	31 c0                	xor    %eax,%eax
+}
+     230:	5d                   	pop    %rbp
+  printf(stdout, "exitiput test ok\n");
+     231:	48 c7 c6 8e 2f 00 00 	mov    $0x2f8e,%rsi
+     238:	e9 d4 29 00 00       	jmp    2c11 <printf>
+
+000000000000023d <openiputtest>:
+{
+     23d:	55                   	push   %rbp
+  printf(stdout, "openiput test\n");
+     23e:	8b 3d 44 4b 00 00    	mov    0x4b44(%rip),%edi        # 4d88 <stdout>
+     244:	48 c7 c6 a0 2f 00 00 	mov    $0x2fa0,%rsi
+     24b:	31 c0                	xor    %eax,%eax
+{
+     24d:	48 89 e5             	mov    %rsp,%rbp
+  printf(stdout, "openiput test\n");
+     250:	e8 bc 29 00 00       	call   2c11 <printf>
+  if(mkdir("oidir") < 0){
+     255:	48 c7 c7 af 2f 00 00 	mov    $0x2faf,%rdi
+     25c:	e8 ef 28 00 00       	call   2b50 <mkdir>
+    printf(stdout, "mkdir oidir failed\n");
+     261:	48 c7 c6 b5 2f 00 00 	mov    $0x2fb5,%rsi
+  if(mkdir("oidir") < 0){
+     268:	85 c0                	test   %eax,%eax
+     26a:	78 10                	js     27c <openiputtest+0x3f>
+  pid = fork();
+     26c:	e8 6f 28 00 00       	call   2ae0 <fork>
+  if(pid < 0){
+     271:	85 c0                	test   %eax,%eax
+     273:	79 19                	jns    28e <openiputtest+0x51>
+    printf(stdout, "fork failed\n");
+     275:	48 c7 c6 1b 45 00 00 	mov    $0x451b,%rsi
+     27c:	8b 3d 06 4b 00 00    	mov    0x4b06(%rip),%edi        # 4d88 <stdout>
+     282:	31 c0                	xor    %eax,%eax
+     284:	e8 88 29 00 00       	call   2c11 <printf>
+    exit();
+     289:	e8 5a 28 00 00       	call   2ae8 <exit>
+  if(pid == 0){
+     28e:	75 1e                	jne    2ae <openiputtest+0x71>
+    int fd = open("oidir", O_RDWR);
+     290:	be 02 00 00 00       	mov    $0x2,%esi
+     295:	48 c7 c7 af 2f 00 00 	mov    $0x2faf,%rdi
+     29c:	e8 87 28 00 00       	call   2b28 <open>
+      printf(stdout, "open directory for write succeeded\n");
+     2a1:	48 c7 c6 c9 2f 00 00 	mov    $0x2fc9,%rsi
+    if(fd >= 0){
+     2a8:	85 c0                	test   %eax,%eax
+     2aa:	79 d0                	jns    27c <openiputtest+0x3f>
+     2ac:	eb db                	jmp    289 <openiputtest+0x4c>
+  sleep(1);
+     2ae:	bf 01 00 00 00       	mov    $0x1,%edi
+     2b3:	e8 c0 28 00 00       	call   2b78 <sleep>
+  if(unlink("oidir") != 0){
+     2b8:	48 c7 c7 af 2f 00 00 	mov    $0x2faf,%rdi
+     2bf:	e8 74 28 00 00       	call   2b38 <unlink>
+    printf(stdout, "unlink failed\n");
+     2c4:	48 c7 c6 ed 2f 00 00 	mov    $0x2fed,%rsi
+  if(unlink("oidir") != 0){
+     2cb:	85 c0                	test   %eax,%eax
+     2cd:	75 ad                	jne    27c <openiputtest+0x3f>
+  wait();
+     2cf:	e8 1c 28 00 00       	call   2af0 <wait>
+  printf(stdout, "openiput test ok\n");
+     2d4:	8b 3d ae 4a 00 00    	mov    0x4aae(%rip),%edi        # 4d88 <stdout>
+     2da:	31 c0                	xor    %eax,%eax
+}
+     2dc:	5d                   	pop    %rbp
+  printf(stdout, "openiput test ok\n");
+     2dd:	48 c7 c6 fc 2f 00 00 	mov    $0x2ffc,%rsi
+     2e4:	e9 28 29 00 00       	jmp    2c11 <printf>
+
+00000000000002e9 <opentest>:
+{
+     2e9:	55                   	push   %rbp
+  printf(stdout, "open test\n");
+     2ea:	8b 3d 98 4a 00 00    	mov    0x4a98(%rip),%edi        # 4d88 <stdout>
+     2f0:	48 c7 c6 0e 30 00 00 	mov    $0x300e,%rsi
+     2f7:	31 c0                	xor    %eax,%eax
+{
+     2f9:	48 89 e5             	mov    %rsp,%rbp
+  printf(stdout, "open test\n");
+     2fc:	e8 10 29 00 00       	call   2c11 <printf>
+  fd = open("echo", 0);
+     301:	31 f6                	xor    %esi,%esi
+     303:	48 c7 c7 19 30 00 00 	mov    $0x3019,%rdi
+     30a:	e8 19 28 00 00       	call   2b28 <open>
+    printf(stdout, "open echo failed!\n");
+     30f:	48 c7 c6 1e 30 00 00 	mov    $0x301e,%rsi
+  if(fd < 0){
+     316:	85 c0                	test   %eax,%eax
+     318:	78 20                	js     33a <opentest+0x51>
+     31a:	89 c7                	mov    %eax,%edi
+  close(fd);
+     31c:	e8 ef 27 00 00       	call   2b10 <close>
+  fd = open("doesnotexist", 0);
+     321:	31 f6                	xor    %esi,%esi
+     323:	48 c7 c7 31 30 00 00 	mov    $0x3031,%rdi
+     32a:	e8 f9 27 00 00       	call   2b28 <open>
+  if(fd >= 0){
+     32f:	85 c0                	test   %eax,%eax
+     331:	78 19                	js     34c <opentest+0x63>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     333:	48 c7 c6 3e 30 00 00 	mov    $0x303e,%rsi
+     33a:	8b 3d 48 4a 00 00    	mov    0x4a48(%rip),%edi        # 4d88 <stdout>
+     340:	31 c0                	xor    %eax,%eax
+     342:	e8 ca 28 00 00       	call   2c11 <printf>
+    exit();
+     347:	e8 9c 27 00 00       	call   2ae8 <exit>
+  printf(stdout, "open test ok\n");
+     34c:	8b 3d 36 4a 00 00    	mov    0x4a36(%rip),%edi        # 4d88 <stdout>
+     352:	48 c7 c6 5c 30 00 00 	mov    $0x305c,%rsi
+     359:	31 c0                	xor    %eax,%eax
+}
+     35b:	5d                   	pop    %rbp
+  printf(stdout, "open test ok\n");
+     35c:	e9 b0 28 00 00       	jmp    2c11 <printf>
+
+0000000000000361 <writetest>:
+{
+     361:	55                   	push   %rbp
+  printf(stdout, "small file test\n");
+     362:	8b 3d 20 4a 00 00    	mov    0x4a20(%rip),%edi        # 4d88 <stdout>
+     368:	48 c7 c6 6a 30 00 00 	mov    $0x306a,%rsi
+     36f:	31 c0                	xor    %eax,%eax
+{
+     371:	48 89 e5             	mov    %rsp,%rbp
+     374:	41 54                	push   %r12
+     376:	53                   	push   %rbx
+  printf(stdout, "small file test\n");
+     377:	e8 95 28 00 00       	call   2c11 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     37c:	be 02 02 00 00       	mov    $0x202,%esi
+     381:	48 c7 c7 7b 30 00 00 	mov    $0x307b,%rdi
+     388:	e8 9b 27 00 00       	call   2b28 <open>
+  if(fd >= 0){
+     38d:	85 c0                	test   %eax,%eax
+     38f:	78 1b                	js     3ac <writetest+0x4b>
+    printf(stdout, "creat small succeeded; ok\n");
+     391:	8b 3d f1 49 00 00    	mov    0x49f1(%rip),%edi        # 4d88 <stdout>
+     397:	89 c3                	mov    %eax,%ebx
+     399:	48 c7 c6 81 30 00 00 	mov    $0x3081,%rsi
+     3a0:	31 c0                	xor    %eax,%eax
+  for(i = 0; i < 100; i++){
+     3a2:	45 31 e4             	xor    %r12d,%r12d
+    printf(stdout, "creat small succeeded; ok\n");
+     3a5:	e8 67 28 00 00       	call   2c11 <printf>
+  for(i = 0; i < 100; i++){
+     3aa:	eb 15                	jmp    3c1 <writetest+0x60>
+    printf(stdout, "error: creat small failed!\n");
+     3ac:	48 c7 c6 9c 30 00 00 	mov    $0x309c,%rsi
+     3b3:	e9 04 01 00 00       	jmp    4bc <writetest+0x15b>
+  for(i = 0; i < 100; i++){
+     3b8:	41 ff c4             	inc    %r12d
+     3bb:	41 83 fc 64          	cmp    $0x64,%r12d
+     3bf:	74 58                	je     419 <writetest+0xb8>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     3c1:	ba 0a 00 00 00       	mov    $0xa,%edx
+     3c6:	48 c7 c6 b8 30 00 00 	mov    $0x30b8,%rsi
+     3cd:	89 df                	mov    %ebx,%edi
+     3cf:	e8 34 27 00 00       	call   2b08 <write>
+     3d4:	83 f8 0a             	cmp    $0xa,%eax
+     3d7:	74 1c                	je     3f5 <writetest+0x94>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     3d9:	44 89 e2             	mov    %r12d,%edx
+     3dc:	48 c7 c6 c3 30 00 00 	mov    $0x30c3,%rsi
+     3e3:	8b 3d 9f 49 00 00    	mov    0x499f(%rip),%edi        # 4d88 <stdout>
+     3e9:	31 c0                	xor    %eax,%eax
+     3eb:	e8 21 28 00 00       	call   2c11 <printf>
+      exit();
+     3f0:	e8 f3 26 00 00       	call   2ae8 <exit>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     3f5:	ba 0a 00 00 00       	mov    $0xa,%edx
+     3fa:	48 c7 c6 e7 30 00 00 	mov    $0x30e7,%rsi
+     401:	89 df                	mov    %ebx,%edi
+     403:	e8 00 27 00 00       	call   2b08 <write>
+     408:	83 f8 0a             	cmp    $0xa,%eax
+     40b:	74 ab                	je     3b8 <writetest+0x57>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     40d:	44 89 e2             	mov    %r12d,%edx
+     410:	48 c7 c6 f2 30 00 00 	mov    $0x30f2,%rsi
+     417:	eb ca                	jmp    3e3 <writetest+0x82>
+  printf(stdout, "writes ok\n");
+     419:	8b 3d 69 49 00 00    	mov    0x4969(%rip),%edi        # 4d88 <stdout>
+     41f:	48 c7 c6 16 31 00 00 	mov    $0x3116,%rsi
+     426:	31 c0                	xor    %eax,%eax
+     428:	e8 e4 27 00 00       	call   2c11 <printf>
+  close(fd);
+     42d:	89 df                	mov    %ebx,%edi
+     42f:	e8 dc 26 00 00       	call   2b10 <close>
+  fd = open("small", O_RDONLY);
+     434:	31 f6                	xor    %esi,%esi
+     436:	48 c7 c7 7b 30 00 00 	mov    $0x307b,%rdi
+     43d:	e8 e6 26 00 00       	call   2b28 <open>
+     442:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     444:	85 c0                	test   %eax,%eax
+     446:	78 30                	js     478 <writetest+0x117>
+    printf(stdout, "open small succeeded ok\n");
+     448:	8b 3d 3a 49 00 00    	mov    0x493a(%rip),%edi        # 4d88 <stdout>
+     44e:	48 c7 c6 21 31 00 00 	mov    $0x3121,%rsi
+     455:	31 c0                	xor    %eax,%eax
+     457:	e8 b5 27 00 00       	call   2c11 <printf>
+  i = read(fd, buf, 2000);
+     45c:	ba d0 07 00 00       	mov    $0x7d0,%edx
+     461:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+     468:	89 df                	mov    %ebx,%edi
+     46a:	e8 91 26 00 00       	call   2b00 <read>
+  if(i == 2000){
+     46f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     474:	74 0b                	je     481 <writetest+0x120>
+     476:	eb 3d                	jmp    4b5 <writetest+0x154>
+    printf(stdout, "error: open small failed!\n");
+     478:	48 c7 c6 3a 31 00 00 	mov    $0x313a,%rsi
+     47f:	eb 3b                	jmp    4bc <writetest+0x15b>
+    printf(stdout, "read succeeded ok\n");
+     481:	8b 3d 01 49 00 00    	mov    0x4901(%rip),%edi        # 4d88 <stdout>
+     487:	31 c0                	xor    %eax,%eax
+     489:	48 c7 c6 55 31 00 00 	mov    $0x3155,%rsi
+     490:	e8 7c 27 00 00       	call   2c11 <printf>
+  close(fd);
+     495:	89 df                	mov    %ebx,%edi
+     497:	e8 74 26 00 00       	call   2b10 <close>
+  if(unlink("small") < 0){
+     49c:	48 c7 c7 7b 30 00 00 	mov    $0x307b,%rdi
+     4a3:	e8 90 26 00 00       	call   2b38 <unlink>
+     4a8:	85 c0                	test   %eax,%eax
+     4aa:	79 22                	jns    4ce <writetest+0x16d>
+    printf(stdout, "unlink small failed\n");
+     4ac:	48 c7 c6 68 31 00 00 	mov    $0x3168,%rsi
+     4b3:	eb 07                	jmp    4bc <writetest+0x15b>
+    printf(stdout, "read failed\n");
+     4b5:	48 c7 c6 a6 35 00 00 	mov    $0x35a6,%rsi
+    printf(stdout, "unlink small failed\n");
+     4bc:	8b 3d c6 48 00 00    	mov    0x48c6(%rip),%edi        # 4d88 <stdout>
+     4c2:	31 c0                	xor    %eax,%eax
+     4c4:	e8 48 27 00 00       	call   2c11 <printf>
+    exit();
+     4c9:	e9 22 ff ff ff       	jmp    3f0 <writetest+0x8f>
+  printf(stdout, "small file test ok\n");
+     4ce:	8b 3d b4 48 00 00    	mov    0x48b4(%rip),%edi        # 4d88 <stdout>
+}
+     4d4:	5b                   	pop    %rbx
+  printf(stdout, "small file test ok\n");
+     4d5:	48 c7 c6 7d 31 00 00 	mov    $0x317d,%rsi
+     4dc:	31 c0                	xor    %eax,%eax
+}
+     4de:	41 5c                	pop    %r12
+     4e0:	5d                   	pop    %rbp
+  printf(stdout, "small file test ok\n");
+     4e1:	e9 2b 27 00 00       	jmp    2c11 <printf>
+
+00000000000004e6 <writetest1>:
+{
+     4e6:	55                   	push   %rbp
+  printf(stdout, "big files test\n");
+     4e7:	8b 3d 9b 48 00 00    	mov    0x489b(%rip),%edi        # 4d88 <stdout>
+     4ed:	48 c7 c6 91 31 00 00 	mov    $0x3191,%rsi
+     4f4:	31 c0                	xor    %eax,%eax
+{
+     4f6:	48 89 e5             	mov    %rsp,%rbp
+     4f9:	41 54                	push   %r12
+     4fb:	53                   	push   %rbx
+  printf(stdout, "big files test\n");
+     4fc:	e8 10 27 00 00       	call   2c11 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     501:	be 02 02 00 00       	mov    $0x202,%esi
+     506:	48 c7 c7 0b 32 00 00 	mov    $0x320b,%rdi
+     50d:	e8 16 26 00 00       	call   2b28 <open>
+    printf(stdout, "error: creat big failed!\n");
+     512:	48 c7 c6 a1 31 00 00 	mov    $0x31a1,%rsi
+  if(fd < 0){
+     519:	85 c0                	test   %eax,%eax
+     51b:	0f 88 04 01 00 00    	js     625 <writetest1+0x13f>
+     521:	89 c3                	mov    %eax,%ebx
+     523:	45 31 e4             	xor    %r12d,%r12d
+    if(write(fd, buf, 512) != 512){
+     526:	ba 00 02 00 00       	mov    $0x200,%edx
+     52b:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+     532:	89 df                	mov    %ebx,%edi
+    ((int*)buf)[0] = i;
+     534:	44 89 25 c5 6f 00 00 	mov    %r12d,0x6fc5(%rip)        # 7500 <buf>
+    if(write(fd, buf, 512) != 512){
+     53b:	e8 c8 25 00 00       	call   2b08 <write>
+     540:	3d 00 02 00 00       	cmp    $0x200,%eax
+     545:	74 1c                	je     563 <writetest1+0x7d>
+      printf(stdout, "error: write big file failed\n", i);
+     547:	44 89 e2             	mov    %r12d,%edx
+     54a:	48 c7 c6 bb 31 00 00 	mov    $0x31bb,%rsi
+     551:	8b 3d 31 48 00 00    	mov    0x4831(%rip),%edi        # 4d88 <stdout>
+     557:	31 c0                	xor    %eax,%eax
+     559:	e8 b3 26 00 00       	call   2c11 <printf>
+      exit();
+     55e:	e8 85 25 00 00       	call   2ae8 <exit>
+  for(i = 0; i < MAXFILE; i++){
+     563:	41 ff c4             	inc    %r12d
+     566:	41 81 fc 8a 00 00 00 	cmp    $0x8a,%r12d
+     56d:	75 b7                	jne    526 <writetest1+0x40>
+  close(fd);
+     56f:	89 df                	mov    %ebx,%edi
+  n = 0;
+     571:	45 31 e4             	xor    %r12d,%r12d
+  close(fd);
+     574:	e8 97 25 00 00       	call   2b10 <close>
+  fd = open("big", O_RDONLY);
+     579:	31 f6                	xor    %esi,%esi
+     57b:	48 c7 c7 0b 32 00 00 	mov    $0x320b,%rdi
+     582:	e8 a1 25 00 00       	call   2b28 <open>
+    printf(stdout, "error: open big failed!\n");
+     587:	48 c7 c6 d9 31 00 00 	mov    $0x31d9,%rsi
+  fd = open("big", O_RDONLY);
+     58e:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     590:	85 c0                	test   %eax,%eax
+     592:	0f 88 8d 00 00 00    	js     625 <writetest1+0x13f>
+    i = read(fd, buf, 512);
+     598:	ba 00 02 00 00       	mov    $0x200,%edx
+     59d:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+     5a4:	89 df                	mov    %ebx,%edi
+     5a6:	e8 55 25 00 00       	call   2b00 <read>
+     5ab:	89 c2                	mov    %eax,%edx
+    if(i == 0){
+     5ad:	85 c0                	test   %eax,%eax
+     5af:	75 17                	jne    5c8 <writetest1+0xe2>
+      if(n == MAXFILE - 1){
+     5b1:	41 81 fc 89 00 00 00 	cmp    $0x89,%r12d
+     5b8:	75 4d                	jne    607 <writetest1+0x121>
+        printf(stdout, "read only %d blocks from big", n);
+     5ba:	ba 89 00 00 00       	mov    $0x89,%edx
+     5bf:	48 c7 c6 f2 31 00 00 	mov    $0x31f2,%rsi
+     5c6:	eb 89                	jmp    551 <writetest1+0x6b>
+    } else if(i != 512){
+     5c8:	3d 00 02 00 00       	cmp    $0x200,%eax
+     5cd:	74 0c                	je     5db <writetest1+0xf5>
+      printf(stdout, "read failed %d\n", i);
+     5cf:	48 c7 c6 0f 32 00 00 	mov    $0x320f,%rsi
+     5d6:	e9 76 ff ff ff       	jmp    551 <writetest1+0x6b>
+    if(((int*)buf)[0] != n){
+     5db:	8b 0d 1f 6f 00 00    	mov    0x6f1f(%rip),%ecx        # 7500 <buf>
+     5e1:	44 39 e1             	cmp    %r12d,%ecx
+     5e4:	74 1c                	je     602 <writetest1+0x11c>
+      printf(stdout, "read content of block %d is %d\n",
+     5e6:	8b 3d 9c 47 00 00    	mov    0x479c(%rip),%edi        # 4d88 <stdout>
+     5ec:	44 89 e2             	mov    %r12d,%edx
+     5ef:	48 c7 c6 1f 32 00 00 	mov    $0x321f,%rsi
+     5f6:	31 c0                	xor    %eax,%eax
+     5f8:	e8 14 26 00 00       	call   2c11 <printf>
+      exit();
+     5fd:	e9 5c ff ff ff       	jmp    55e <writetest1+0x78>
+    n++;
+     602:	41 ff c4             	inc    %r12d
+    i = read(fd, buf, 512);
+     605:	eb 91                	jmp    598 <writetest1+0xb2>
+  close(fd);
+     607:	89 df                	mov    %ebx,%edi
+     609:	e8 02 25 00 00       	call   2b10 <close>
+  if(unlink("big") < 0){
+     60e:	48 c7 c7 0b 32 00 00 	mov    $0x320b,%rdi
+     615:	e8 1e 25 00 00       	call   2b38 <unlink>
+     61a:	85 c0                	test   %eax,%eax
+     61c:	79 19                	jns    637 <writetest1+0x151>
+    printf(stdout, "unlink big failed\n");
+     61e:	48 c7 c6 3f 32 00 00 	mov    $0x323f,%rsi
+     625:	8b 3d 5d 47 00 00    	mov    0x475d(%rip),%edi        # 4d88 <stdout>
+     62b:	31 c0                	xor    %eax,%eax
+     62d:	e8 df 25 00 00       	call   2c11 <printf>
+    exit();
+     632:	e9 27 ff ff ff       	jmp    55e <writetest1+0x78>
+  printf(stdout, "big files ok\n");
+     637:	8b 3d 4b 47 00 00    	mov    0x474b(%rip),%edi        # 4d88 <stdout>
+}
+     63d:	5b                   	pop    %rbx
+  printf(stdout, "big files ok\n");
+     63e:	48 c7 c6 52 32 00 00 	mov    $0x3252,%rsi
+     645:	31 c0                	xor    %eax,%eax
+}
+     647:	41 5c                	pop    %r12
+     649:	5d                   	pop    %rbp
+  printf(stdout, "big files ok\n");
+     64a:	e9 c2 25 00 00       	jmp    2c11 <printf>
+
+000000000000064f <createtest>:
+{
+     64f:	55                   	push   %rbp
+  printf(stdout, "many creates, followed by unlink test\n");
+     650:	48 c7 c6 60 32 00 00 	mov    $0x3260,%rsi
+     657:	31 c0                	xor    %eax,%eax
+{
+     659:	48 89 e5             	mov    %rsp,%rbp
+     65c:	53                   	push   %rbx
+  name[2] = '\0';
+     65d:	b3 30                	mov    $0x30,%bl
+{
+     65f:	51                   	push   %rcx
+  printf(stdout, "many creates, followed by unlink test\n");
+     660:	8b 3d 22 47 00 00    	mov    0x4722(%rip),%edi        # 4d88 <stdout>
+     666:	e8 a6 25 00 00       	call   2c11 <printf>
+  name[0] = 'a';
+     66b:	c6 05 7e 6e 00 00 61 	movb   $0x61,0x6e7e(%rip)        # 74f0 <name>
+  name[2] = '\0';
+     672:	c6 05 79 6e 00 00 00 	movb   $0x0,0x6e79(%rip)        # 74f2 <name+0x2>
+    fd = open(name, O_CREATE|O_RDWR);
+     679:	be 02 02 00 00       	mov    $0x202,%esi
+     67e:	48 c7 c7 f0 74 00 00 	mov    $0x74f0,%rdi
+    name[1] = '0' + i;
+     685:	88 1d 66 6e 00 00    	mov    %bl,0x6e66(%rip)        # 74f1 <name+0x1>
+  for(i = 0; i < 52; i++){
+     68b:	ff c3                	inc    %ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     68d:	e8 96 24 00 00       	call   2b28 <open>
+     692:	89 c7                	mov    %eax,%edi
+    close(fd);
+     694:	e8 77 24 00 00       	call   2b10 <close>
+  for(i = 0; i < 52; i++){
+     699:	80 fb 64             	cmp    $0x64,%bl
+     69c:	75 db                	jne    679 <createtest+0x2a>
+  name[0] = 'a';
+     69e:	c6 05 4b 6e 00 00 61 	movb   $0x61,0x6e4b(%rip)        # 74f0 <name>
+  name[2] = '\0';
+     6a5:	b3 30                	mov    $0x30,%bl
+     6a7:	c6 05 44 6e 00 00 00 	movb   $0x0,0x6e44(%rip)        # 74f2 <name+0x2>
+    name[1] = '0' + i;
+     6ae:	88 1d 3d 6e 00 00    	mov    %bl,0x6e3d(%rip)        # 74f1 <name+0x1>
+    unlink(name);
+     6b4:	48 c7 c7 f0 74 00 00 	mov    $0x74f0,%rdi
+  for(i = 0; i < 52; i++){
+     6bb:	ff c3                	inc    %ebx
+    unlink(name);
+     6bd:	e8 76 24 00 00       	call   2b38 <unlink>
+  for(i = 0; i < 52; i++){
+     6c2:	80 fb 64             	cmp    $0x64,%bl
+     6c5:	75 e7                	jne    6ae <createtest+0x5f>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     6c7:	8b 3d bb 46 00 00    	mov    0x46bb(%rip),%edi        # 4d88 <stdout>
+     6cd:	48 c7 c6 87 32 00 00 	mov    $0x3287,%rsi
+}
+     6d4:	5a                   	pop    %rdx
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     6d5:	31 c0                	xor    %eax,%eax
+}
+     6d7:	5b                   	pop    %rbx
+     6d8:	5d                   	pop    %rbp
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     6d9:	e9 33 25 00 00       	jmp    2c11 <printf>
+
+00000000000006de <dirtest>:
+{
+     6de:	55                   	push   %rbp
+  printf(stdout, "mkdir test\n");
+     6df:	8b 3d a3 46 00 00    	mov    0x46a3(%rip),%edi        # 4d88 <stdout>
+     6e5:	48 c7 c6 ad 32 00 00 	mov    $0x32ad,%rsi
+     6ec:	31 c0                	xor    %eax,%eax
+{
+     6ee:	48 89 e5             	mov    %rsp,%rbp
+  printf(stdout, "mkdir test\n");
+     6f1:	e8 1b 25 00 00       	call   2c11 <printf>
+  if(mkdir("dir0") < 0){
+     6f6:	48 c7 c7 b9 32 00 00 	mov    $0x32b9,%rdi
+     6fd:	e8 4e 24 00 00       	call   2b50 <mkdir>
+    printf(stdout, "mkdir failed\n");
+     702:	48 c7 c6 10 2f 00 00 	mov    $0x2f10,%rsi
+  if(mkdir("dir0") < 0){
+     709:	85 c0                	test   %eax,%eax
+     70b:	78 17                	js     724 <dirtest+0x46>
+  if(chdir("dir0") < 0){
+     70d:	48 c7 c7 b9 32 00 00 	mov    $0x32b9,%rdi
+     714:	e8 3f 24 00 00       	call   2b58 <chdir>
+     719:	85 c0                	test   %eax,%eax
+     71b:	79 19                	jns    736 <dirtest+0x58>
+    printf(stdout, "chdir dir0 failed\n");
+     71d:	48 c7 c6 be 32 00 00 	mov    $0x32be,%rsi
+     724:	8b 3d 5e 46 00 00    	mov    0x465e(%rip),%edi        # 4d88 <stdout>
+     72a:	31 c0                	xor    %eax,%eax
+     72c:	e8 e0 24 00 00       	call   2c11 <printf>
+    exit();
+     731:	e8 b2 23 00 00       	call   2ae8 <exit>
+  if(chdir("..") < 0){
+     736:	48 c7 c7 fa 39 00 00 	mov    $0x39fa,%rdi
+     73d:	e8 16 24 00 00       	call   2b58 <chdir>
+    printf(stdout, "chdir .. failed\n");
+     742:	48 c7 c6 d1 32 00 00 	mov    $0x32d1,%rsi
+  if(chdir("..") < 0){
+     749:	85 c0                	test   %eax,%eax
+     74b:	78 d7                	js     724 <dirtest+0x46>
+  if(unlink("dir0") < 0){
+     74d:	48 c7 c7 b9 32 00 00 	mov    $0x32b9,%rdi
+     754:	e8 df 23 00 00       	call   2b38 <unlink>
+    printf(stdout, "unlink dir0 failed\n");
+     759:	48 c7 c6 e2 32 00 00 	mov    $0x32e2,%rsi
+  if(unlink("dir0") < 0){
+     760:	85 c0                	test   %eax,%eax
+     762:	78 c0                	js     724 <dirtest+0x46>
+  printf(stdout, "mkdir test ok\n");
+     764:	8b 3d 1e 46 00 00    	mov    0x461e(%rip),%edi        # 4d88 <stdout>
+     76a:	48 c7 c6 f6 32 00 00 	mov    $0x32f6,%rsi
+     771:	31 c0                	xor    %eax,%eax
+}
+     773:	5d                   	pop    %rbp
+  printf(stdout, "mkdir test ok\n");
+     774:	e9 98 24 00 00       	jmp    2c11 <printf>
+
+0000000000000779 <exectest>:
+{
+     779:	55                   	push   %rbp
+  printf(stdout, "exec test\n");
+     77a:	8b 3d 08 46 00 00    	mov    0x4608(%rip),%edi        # 4d88 <stdout>
+     780:	48 c7 c6 05 33 00 00 	mov    $0x3305,%rsi
+     787:	31 c0                	xor    %eax,%eax
+{
+     789:	48 89 e5             	mov    %rsp,%rbp
+  printf(stdout, "exec test\n");
+     78c:	e8 80 24 00 00       	call   2c11 <printf>
+  if(exec("echo", echoargv) < 0){
+     791:	48 c7 c6 a0 4d 00 00 	mov    $0x4da0,%rsi
+     798:	48 c7 c7 19 30 00 00 	mov    $0x3019,%rdi
+     79f:	e8 7c 23 00 00       	call   2b20 <exec>
+     7a4:	85 c0                	test   %eax,%eax
+     7a6:	79 19                	jns    7c1 <exectest+0x48>
+    printf(stdout, "exec echo failed\n");
+     7a8:	8b 3d da 45 00 00    	mov    0x45da(%rip),%edi        # 4d88 <stdout>
+     7ae:	48 c7 c6 10 33 00 00 	mov    $0x3310,%rsi
+     7b5:	31 c0                	xor    %eax,%eax
+     7b7:	e8 55 24 00 00       	call   2c11 <printf>
+    exit();
+     7bc:	e8 27 23 00 00       	call   2ae8 <exit>
+}
+     7c1:	5d                   	pop    %rbp
+     7c2:	c3                   	ret
+
+00000000000007c3 <pipe1>:
+{
+     7c3:	55                   	push   %rbp
+     7c4:	48 89 e5             	mov    %rsp,%rbp
+     7c7:	41 55                	push   %r13
+     7c9:	41 54                	push   %r12
+  if(pipe(fds) != 0){
+     7cb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+{
+     7cf:	53                   	push   %rbx
+     7d0:	48 83 ec 18          	sub    $0x18,%rsp
+  if(pipe(fds) != 0){
+     7d4:	e8 1f 23 00 00       	call   2af8 <pipe>
+    printf(1, "pipe() failed\n");
+     7d9:	48 c7 c6 22 33 00 00 	mov    $0x3322,%rsi
+  if(pipe(fds) != 0){
+     7e0:	85 c0                	test   %eax,%eax
+     7e2:	75 5e                	jne    842 <pipe1+0x7f>
+     7e4:	41 89 c4             	mov    %eax,%r12d
+  pid = fork();
+     7e7:	e8 f4 22 00 00       	call   2ae0 <fork>
+     7ec:	89 c3                	mov    %eax,%ebx
+  if(pid == 0){
+     7ee:	85 c0                	test   %eax,%eax
+     7f0:	75 61                	jne    853 <pipe1+0x90>
+    close(fds[0]);
+     7f2:	8b 7d d8             	mov    -0x28(%rbp),%edi
+     7f5:	e8 16 23 00 00       	call   2b10 <close>
+    for(n = 0; n < 5; n++){
+     7fa:	eb 08                	jmp    804 <pipe1+0x41>
+     7fc:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     802:	74 4a                	je     84e <pipe1+0x8b>
+{
+     804:	31 c0                	xor    %eax,%eax
+        buf[i] = seq++;
+     806:	8d 14 03             	lea    (%rbx,%rax,1),%edx
+     809:	88 90 00 75 00 00    	mov    %dl,0x7500(%rax)
+      for(i = 0; i < 1033; i++)
+     80f:	48 ff c0             	inc    %rax
+     812:	48 3d 09 04 00 00    	cmp    $0x409,%rax
+     818:	75 ec                	jne    806 <pipe1+0x43>
+      if(write(fds[1], buf, 1033) != 1033){
+     81a:	8b 7d dc             	mov    -0x24(%rbp),%edi
+     81d:	ba 09 04 00 00       	mov    $0x409,%edx
+     822:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+        buf[i] = seq++;
+     829:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     82f:	e8 d4 22 00 00       	call   2b08 <write>
+     834:	3d 09 04 00 00       	cmp    $0x409,%eax
+     839:	74 c1                	je     7fc <pipe1+0x39>
+        printf(1, "pipe1 oops 1\n");
+     83b:	48 c7 c6 31 33 00 00 	mov    $0x3331,%rsi
+     842:	bf 01 00 00 00       	mov    $0x1,%edi
+     847:	31 c0                	xor    %eax,%eax
+     849:	e8 c3 23 00 00       	call   2c11 <printf>
+        exit();
+     84e:	e8 95 22 00 00       	call   2ae8 <exit>
+  } else if(pid > 0){
+     853:	0f 8e b6 00 00 00    	jle    90f <pipe1+0x14c>
+    close(fds[1]);
+     859:	8b 7d dc             	mov    -0x24(%rbp),%edi
+    total = 0;
+     85c:	45 31 ed             	xor    %r13d,%r13d
+    cc = 1;
+     85f:	bb 01 00 00 00       	mov    $0x1,%ebx
+    close(fds[1]);
+     864:	e8 a7 22 00 00       	call   2b10 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     869:	8b 7d d8             	mov    -0x28(%rbp),%edi
+     86c:	89 da                	mov    %ebx,%edx
+     86e:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+     875:	e8 86 22 00 00       	call   2b00 <read>
+     87a:	85 c0                	test   %eax,%eax
+     87c:	7e 42                	jle    8c0 <pipe1+0xfd>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     87e:	44 38 25 7b 6c 00 00 	cmp    %r12b,0x6c7b(%rip)        # 7500 <buf>
+     885:	74 09                	je     890 <pipe1+0xcd>
+          printf(1, "pipe1 oops 2\n");
+     887:	48 c7 c6 3f 33 00 00 	mov    $0x333f,%rsi
+     88e:	eb 68                	jmp    8f8 <pipe1+0x135>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     890:	ba 01 00 00 00       	mov    $0x1,%edx
+     895:	41 8d 0c 14          	lea    (%r12,%rdx,1),%ecx
+      for(i = 0; i < n; i++){
+     899:	39 d0                	cmp    %edx,%eax
+     89b:	7e 0f                	jle    8ac <pipe1+0xe9>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     89d:	32 8a 00 75 00 00    	xor    0x7500(%rdx),%cl
+     8a3:	48 ff c2             	inc    %rdx
+     8a6:	84 c9                	test   %cl,%cl
+     8a8:	74 eb                	je     895 <pipe1+0xd2>
+     8aa:	eb db                	jmp    887 <pipe1+0xc4>
+      total += n;
+     8ac:	41 01 c5             	add    %eax,%r13d
+      cc = cc * 2;
+     8af:	01 db                	add    %ebx,%ebx
+      if(cc > sizeof(buf))
+     8b1:	b8 00 20 00 00       	mov    $0x2000,%eax
+     8b6:	41 89 cc             	mov    %ecx,%r12d
+     8b9:	39 c3                	cmp    %eax,%ebx
+     8bb:	0f 4f d8             	cmovg  %eax,%ebx
+     8be:	eb a9                	jmp    869 <pipe1+0xa6>
+    if(total != 5 * 1033){
+     8c0:	41 81 fd 2d 14 00 00 	cmp    $0x142d,%r13d
+     8c7:	74 1b                	je     8e4 <pipe1+0x121>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     8c9:	44 89 ea             	mov    %r13d,%edx
+     8cc:	48 c7 c6 4d 33 00 00 	mov    $0x334d,%rsi
+     8d3:	bf 01 00 00 00       	mov    $0x1,%edi
+     8d8:	31 c0                	xor    %eax,%eax
+     8da:	e8 32 23 00 00       	call   2c11 <printf>
+      exit();
+     8df:	e9 6a ff ff ff       	jmp    84e <pipe1+0x8b>
+    close(fds[0]);
+     8e4:	8b 7d d8             	mov    -0x28(%rbp),%edi
+     8e7:	e8 24 22 00 00       	call   2b10 <close>
+    wait();
+     8ec:	e8 ff 21 00 00       	call   2af0 <wait>
+  printf(1, "pipe1 ok\n");
+     8f1:	48 c7 c6 64 33 00 00 	mov    $0x3364,%rsi
+     8f8:	bf 01 00 00 00       	mov    $0x1,%edi
+     8fd:	31 c0                	xor    %eax,%eax
+     8ff:	e8 0d 23 00 00       	call   2c11 <printf>
+}
+     904:	48 83 c4 18          	add    $0x18,%rsp
+     908:	5b                   	pop    %rbx
+     909:	41 5c                	pop    %r12
+     90b:	41 5d                	pop    %r13
+     90d:	5d                   	pop    %rbp
+     90e:	c3                   	ret
+    printf(1, "fork() failed\n");
+     90f:	48 c7 c6 6e 33 00 00 	mov    $0x336e,%rsi
+     916:	e9 27 ff ff ff       	jmp    842 <pipe1+0x7f>
+
+000000000000091b <preempt>:
+{
+     91b:	55                   	push   %rbp
+  printf(1, "preempt: ");
+     91c:	31 c0                	xor    %eax,%eax
+     91e:	48 c7 c6 7d 33 00 00 	mov    $0x337d,%rsi
+     925:	bf 01 00 00 00       	mov    $0x1,%edi
+{
+     92a:	48 89 e5             	mov    %rsp,%rbp
+     92d:	41 55                	push   %r13
+     92f:	41 54                	push   %r12
+     931:	53                   	push   %rbx
+     932:	48 83 ec 18          	sub    $0x18,%rsp
+  printf(1, "preempt: ");
+     936:	e8 d6 22 00 00       	call   2c11 <printf>
+  pid1 = fork();
+     93b:	e8 a0 21 00 00       	call   2ae0 <fork>
+  if(pid1 == 0)
+     940:	85 c0                	test   %eax,%eax
+     942:	75 02                	jne    946 <preempt+0x2b>
+    for(;;)
+     944:	eb fe                	jmp    944 <preempt+0x29>
+     946:	41 89 c5             	mov    %eax,%r13d
+  pid2 = fork();
+     949:	e8 92 21 00 00       	call   2ae0 <fork>
+     94e:	41 89 c4             	mov    %eax,%r12d
+  if(pid2 == 0)
+     951:	85 c0                	test   %eax,%eax
+     953:	75 02                	jne    957 <preempt+0x3c>
+    for(;;)
+     955:	eb fe                	jmp    955 <preempt+0x3a>
+  pipe(pfds);
+     957:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+     95b:	e8 98 21 00 00       	call   2af8 <pipe>
+  pid3 = fork();
+     960:	e8 7b 21 00 00       	call   2ae0 <fork>
+     965:	89 c3                	mov    %eax,%ebx
+  if(pid3 == 0){
+     967:	85 c0                	test   %eax,%eax
+     969:	75 3d                	jne    9a8 <preempt+0x8d>
+    close(pfds[0]);
+     96b:	8b 7d d8             	mov    -0x28(%rbp),%edi
+     96e:	e8 9d 21 00 00       	call   2b10 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     973:	8b 7d dc             	mov    -0x24(%rbp),%edi
+     976:	ba 01 00 00 00       	mov    $0x1,%edx
+     97b:	48 c7 c6 03 3b 00 00 	mov    $0x3b03,%rsi
+     982:	e8 81 21 00 00       	call   2b08 <write>
+     987:	ff c8                	dec    %eax
+     989:	74 13                	je     99e <preempt+0x83>
+      printf(1, "preempt write error");
+     98b:	48 c7 c6 87 33 00 00 	mov    $0x3387,%rsi
+     992:	bf 01 00 00 00       	mov    $0x1,%edi
+     997:	31 c0                	xor    %eax,%eax
+     999:	e8 73 22 00 00       	call   2c11 <printf>
+    close(pfds[1]);
+     99e:	8b 7d dc             	mov    -0x24(%rbp),%edi
+     9a1:	e8 6a 21 00 00       	call   2b10 <close>
+    for(;;)
+     9a6:	eb fe                	jmp    9a6 <preempt+0x8b>
+  close(pfds[1]);
+     9a8:	8b 7d dc             	mov    -0x24(%rbp),%edi
+     9ab:	e8 60 21 00 00       	call   2b10 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     9b0:	8b 7d d8             	mov    -0x28(%rbp),%edi
+     9b3:	ba 00 20 00 00       	mov    $0x2000,%edx
+     9b8:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+     9bf:	e8 3c 21 00 00       	call   2b00 <read>
+    printf(1, "preempt read error");
+     9c4:	48 c7 c6 9b 33 00 00 	mov    $0x339b,%rsi
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     9cb:	ff c8                	dec    %eax
+     9cd:	75 5b                	jne    a2a <preempt+0x10f>
+  close(pfds[0]);
+     9cf:	8b 7d d8             	mov    -0x28(%rbp),%edi
+     9d2:	e8 39 21 00 00       	call   2b10 <close>
+  printf(1, "kill... ");
+     9d7:	48 c7 c6 ae 33 00 00 	mov    $0x33ae,%rsi
+     9de:	bf 01 00 00 00       	mov    $0x1,%edi
+     9e3:	31 c0                	xor    %eax,%eax
+     9e5:	e8 27 22 00 00       	call   2c11 <printf>
+  kill(pid1);
+     9ea:	44 89 ef             	mov    %r13d,%edi
+     9ed:	e8 26 21 00 00       	call   2b18 <kill>
+  kill(pid2);
+     9f2:	44 89 e7             	mov    %r12d,%edi
+     9f5:	e8 1e 21 00 00       	call   2b18 <kill>
+  kill(pid3);
+     9fa:	89 df                	mov    %ebx,%edi
+     9fc:	e8 17 21 00 00       	call   2b18 <kill>
+  printf(1, "wait... ");
+     a01:	48 c7 c6 b7 33 00 00 	mov    $0x33b7,%rsi
+     a08:	bf 01 00 00 00       	mov    $0x1,%edi
+     a0d:	31 c0                	xor    %eax,%eax
+     a0f:	e8 fd 21 00 00       	call   2c11 <printf>
+  wait();
+     a14:	e8 d7 20 00 00       	call   2af0 <wait>
+  wait();
+     a19:	e8 d2 20 00 00       	call   2af0 <wait>
+  wait();
+     a1e:	e8 cd 20 00 00       	call   2af0 <wait>
+  printf(1, "preempt ok\n");
+     a23:	48 c7 c6 c0 33 00 00 	mov    $0x33c0,%rsi
+     a2a:	bf 01 00 00 00       	mov    $0x1,%edi
+     a2f:	31 c0                	xor    %eax,%eax
+     a31:	e8 db 21 00 00       	call   2c11 <printf>
+}
+     a36:	48 83 c4 18          	add    $0x18,%rsp
+     a3a:	5b                   	pop    %rbx
+     a3b:	41 5c                	pop    %r12
+     a3d:	41 5d                	pop    %r13
+     a3f:	5d                   	pop    %rbp
+     a40:	c3                   	ret
+
+0000000000000a41 <exitwait>:
+{
+     a41:	55                   	push   %rbp
+     a42:	48 89 e5             	mov    %rsp,%rbp
+     a45:	41 54                	push   %r12
+     a47:	41 bc 64 00 00 00    	mov    $0x64,%r12d
+     a4d:	53                   	push   %rbx
+    pid = fork();
+     a4e:	e8 8d 20 00 00       	call   2ae0 <fork>
+     a53:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     a55:	85 c0                	test   %eax,%eax
+     a57:	79 09                	jns    a62 <exitwait+0x21>
+      printf(1, "fork failed\n");
+     a59:	48 c7 c6 1b 45 00 00 	mov    $0x451b,%rsi
+     a60:	eb 25                	jmp    a87 <exitwait+0x46>
+    if(pid){
+     a62:	74 12                	je     a76 <exitwait+0x35>
+      if(wait() != pid){
+     a64:	e8 87 20 00 00       	call   2af0 <wait>
+     a69:	39 d8                	cmp    %ebx,%eax
+     a6b:	74 0e                	je     a7b <exitwait+0x3a>
+        printf(1, "wait wrong pid\n");
+     a6d:	48 c7 c6 cc 33 00 00 	mov    $0x33cc,%rsi
+     a74:	eb 11                	jmp    a87 <exitwait+0x46>
+      exit();
+     a76:	e8 6d 20 00 00       	call   2ae8 <exit>
+  for(i = 0; i < 100; i++){
+     a7b:	41 ff cc             	dec    %r12d
+     a7e:	75 ce                	jne    a4e <exitwait+0xd>
+  printf(1, "exitwait ok\n");
+     a80:	48 c7 c6 dc 33 00 00 	mov    $0x33dc,%rsi
+}
+     a87:	5b                   	pop    %rbx
+  printf(1, "exitwait ok\n");
+     a88:	bf 01 00 00 00       	mov    $0x1,%edi
+}
+     a8d:	41 5c                	pop    %r12
+  printf(1, "exitwait ok\n");
+     a8f:	31 c0                	xor    %eax,%eax
+}
+     a91:	5d                   	pop    %rbp
+  printf(1, "exitwait ok\n");
+     a92:	e9 7a 21 00 00       	jmp    2c11 <printf>
+
+0000000000000a97 <mem>:
+{
+     a97:	55                   	push   %rbp
+  printf(1, "mem test\n");
+     a98:	48 c7 c6 e9 33 00 00 	mov    $0x33e9,%rsi
+     a9f:	bf 01 00 00 00       	mov    $0x1,%edi
+     aa4:	31 c0                	xor    %eax,%eax
+{
+     aa6:	48 89 e5             	mov    %rsp,%rbp
+     aa9:	41 55                	push   %r13
+     aab:	41 54                	push   %r12
+     aad:	53                   	push   %rbx
+     aae:	31 db                	xor    %ebx,%ebx
+     ab0:	52                   	push   %rdx
+  printf(1, "mem test\n");
+     ab1:	e8 5b 21 00 00       	call   2c11 <printf>
+  ppid = getpid();
+     ab6:	e8 ad 20 00 00       	call   2b68 <getpid>
+     abb:	41 89 c4             	mov    %eax,%r12d
+  if((pid = fork()) == 0){
+     abe:	e8 1d 20 00 00       	call   2ae0 <fork>
+     ac3:	85 c0                	test   %eax,%eax
+     ac5:	75 78                	jne    b3f <mem+0xa8>
+    while((m2 = malloc(10001)) != 0){
+     ac7:	bf 11 27 00 00       	mov    $0x2711,%edi
+     acc:	e8 6d 23 00 00       	call   2e3e <malloc>
+     ad1:	48 85 c0             	test   %rax,%rax
+     ad4:	74 08                	je     ade <mem+0x47>
+      *(char**)m2 = m1;
+     ad6:	48 89 18             	mov    %rbx,(%rax)
+     ad9:	48 89 c3             	mov    %rax,%rbx
+     adc:	eb e9                	jmp    ac7 <mem+0x30>
+    while(m1){
+     ade:	48 85 db             	test   %rbx,%rbx
+     ae1:	74 10                	je     af3 <mem+0x5c>
+      m2 = *(char**)m1;
+     ae3:	4c 8b 2b             	mov    (%rbx),%r13
+      free(m1);
+     ae6:	48 89 df             	mov    %rbx,%rdi
+     ae9:	e8 db 22 00 00       	call   2dc9 <free>
+      m1 = m2;
+     aee:	4c 89 eb             	mov    %r13,%rbx
+     af1:	eb eb                	jmp    ade <mem+0x47>
+    m1 = malloc(1024*20);
+     af3:	bf 00 50 00 00       	mov    $0x5000,%edi
+     af8:	e8 41 23 00 00       	call   2e3e <malloc>
+     afd:	48 89 c7             	mov    %rax,%rdi
+    if(m1 == 0){
+     b00:	48 85 c0             	test   %rax,%rax
+     b03:	75 1d                	jne    b22 <mem+0x8b>
+      printf(1, "couldn't allocate mem?!!\n");
+     b05:	48 c7 c6 f3 33 00 00 	mov    $0x33f3,%rsi
+     b0c:	bf 01 00 00 00       	mov    $0x1,%edi
+     b11:	31 c0                	xor    %eax,%eax
+     b13:	e8 f9 20 00 00       	call   2c11 <printf>
+      kill(ppid);
+     b18:	44 89 e7             	mov    %r12d,%edi
+     b1b:	e8 f8 1f 00 00       	call   2b18 <kill>
+      exit();
+     b20:	eb 18                	jmp    b3a <mem+0xa3>
+    free(m1);
+     b22:	e8 a2 22 00 00       	call   2dc9 <free>
+    printf(1, "mem ok\n");
+     b27:	48 c7 c6 0d 34 00 00 	mov    $0x340d,%rsi
+     b2e:	bf 01 00 00 00       	mov    $0x1,%edi
+     b33:	31 c0                	xor    %eax,%eax
+     b35:	e8 d7 20 00 00       	call   2c11 <printf>
+    exit();
+     b3a:	e8 a9 1f 00 00       	call   2ae8 <exit>
+}
+     b3f:	58                   	pop    %rax
+     b40:	5b                   	pop    %rbx
+     b41:	41 5c                	pop    %r12
+     b43:	41 5d                	pop    %r13
+     b45:	5d                   	pop    %rbp
+    wait();
+     b46:	e9 a5 1f 00 00       	jmp    2af0 <wait>
+
+0000000000000b4b <sharedfd>:
+{
+     b4b:	55                   	push   %rbp
+  printf(1, "sharedfd test\n");
+     b4c:	48 c7 c6 15 34 00 00 	mov    $0x3415,%rsi
+     b53:	31 c0                	xor    %eax,%eax
+     b55:	bf 01 00 00 00       	mov    $0x1,%edi
+{
+     b5a:	48 89 e5             	mov    %rsp,%rbp
+     b5d:	41 56                	push   %r14
+     b5f:	41 55                	push   %r13
+     b61:	41 54                	push   %r12
+     b63:	53                   	push   %rbx
+     b64:	48 83 ec 10          	sub    $0x10,%rsp
+  printf(1, "sharedfd test\n");
+     b68:	e8 a4 20 00 00       	call   2c11 <printf>
+  unlink("sharedfd");
+     b6d:	48 c7 c7 24 34 00 00 	mov    $0x3424,%rdi
+     b74:	e8 bf 1f 00 00       	call   2b38 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     b79:	be 02 02 00 00       	mov    $0x202,%esi
+     b7e:	48 c7 c7 24 34 00 00 	mov    $0x3424,%rdi
+     b85:	e8 9e 1f 00 00       	call   2b28 <open>
+  if(fd < 0){
+     b8a:	85 c0                	test   %eax,%eax
+     b8c:	79 1e                	jns    bac <sharedfd+0x61>
+}
+     b8e:	59                   	pop    %rcx
+    printf(1, "fstests: cannot open sharedfd for writing");
+     b8f:	48 c7 c6 2d 34 00 00 	mov    $0x342d,%rsi
+}
+     b96:	41 58                	pop    %r8
+    printf(1, "fstests: cannot open sharedfd for writing");
+     b98:	bf 01 00 00 00       	mov    $0x1,%edi
+}
+     b9d:	5b                   	pop    %rbx
+    printf(1, "fstests: cannot open sharedfd for writing");
+     b9e:	31 c0                	xor    %eax,%eax
+}
+     ba0:	41 5c                	pop    %r12
+     ba2:	41 5d                	pop    %r13
+     ba4:	41 5e                	pop    %r14
+     ba6:	5d                   	pop    %rbp
+    printf(1, "fstests: cannot open sharedfd for writing");
+     ba7:	e9 65 20 00 00       	jmp    2c11 <printf>
+     bac:	89 c3                	mov    %eax,%ebx
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     bae:	41 bd e8 03 00 00    	mov    $0x3e8,%r13d
+  pid = fork();
+     bb4:	e8 27 1f 00 00       	call   2ae0 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     bb9:	ba 0a 00 00 00       	mov    $0xa,%edx
+     bbe:	48 8d 7d d6          	lea    -0x2a(%rbp),%rdi
+     bc2:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     bc5:	41 89 c4             	mov    %eax,%r12d
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     bc8:	19 f6                	sbb    %esi,%esi
+     bca:	83 e6 f3             	and    $0xfffffff3,%esi
+     bcd:	83 c6 70             	add    $0x70,%esi
+     bd0:	e8 10 1e 00 00       	call   29e5 <memset>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     bd5:	ba 0a 00 00 00       	mov    $0xa,%edx
+     bda:	48 8d 75 d6          	lea    -0x2a(%rbp),%rsi
+     bde:	89 df                	mov    %ebx,%edi
+     be0:	e8 23 1f 00 00       	call   2b08 <write>
+     be5:	83 f8 0a             	cmp    $0xa,%eax
+     be8:	74 15                	je     bff <sharedfd+0xb4>
+      printf(1, "fstests: write sharedfd failed\n");
+     bea:	48 c7 c6 57 34 00 00 	mov    $0x3457,%rsi
+     bf1:	bf 01 00 00 00       	mov    $0x1,%edi
+     bf6:	31 c0                	xor    %eax,%eax
+     bf8:	e8 14 20 00 00       	call   2c11 <printf>
+      break;
+     bfd:	eb 05                	jmp    c04 <sharedfd+0xb9>
+  for(i = 0; i < 1000; i++){
+     bff:	41 ff cd             	dec    %r13d
+     c02:	75 d1                	jne    bd5 <sharedfd+0x8a>
+  if(pid == 0)
+     c04:	45 85 e4             	test   %r12d,%r12d
+     c07:	0f 84 c3 00 00 00    	je     cd0 <sharedfd+0x185>
+    wait();
+     c0d:	e8 de 1e 00 00       	call   2af0 <wait>
+  close(fd);
+     c12:	89 df                	mov    %ebx,%edi
+     c14:	e8 f7 1e 00 00       	call   2b10 <close>
+  fd = open("sharedfd", 0);
+     c19:	31 f6                	xor    %esi,%esi
+     c1b:	48 c7 c7 24 34 00 00 	mov    $0x3424,%rdi
+     c22:	e8 01 1f 00 00       	call   2b28 <open>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     c27:	48 c7 c6 77 34 00 00 	mov    $0x3477,%rsi
+  fd = open("sharedfd", 0);
+     c2e:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     c30:	85 c0                	test   %eax,%eax
+     c32:	78 6c                	js     ca0 <sharedfd+0x155>
+  nc = np = 0;
+     c34:	45 31 ed             	xor    %r13d,%r13d
+     c37:	45 31 e4             	xor    %r12d,%r12d
+     c3a:	4c 8d 75 e0          	lea    -0x20(%rbp),%r14
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     c3e:	ba 0a 00 00 00       	mov    $0xa,%edx
+     c43:	48 8d 75 d6          	lea    -0x2a(%rbp),%rsi
+     c47:	89 df                	mov    %ebx,%edi
+     c49:	e8 b2 1e 00 00       	call   2b00 <read>
+     c4e:	85 c0                	test   %eax,%eax
+     c50:	7e 22                	jle    c74 <sharedfd+0x129>
+     c52:	48 8d 45 d6          	lea    -0x2a(%rbp),%rax
+      if(buf[i] == 'c')
+     c56:	8a 10                	mov    (%rax),%dl
+     c58:	80 fa 63             	cmp    $0x63,%dl
+     c5b:	75 05                	jne    c62 <sharedfd+0x117>
+        nc++;
+     c5d:	41 ff c4             	inc    %r12d
+      if(buf[i] == 'p')
+     c60:	eb 08                	jmp    c6a <sharedfd+0x11f>
+     c62:	80 fa 70             	cmp    $0x70,%dl
+     c65:	75 03                	jne    c6a <sharedfd+0x11f>
+        np++;
+     c67:	41 ff c5             	inc    %r13d
+    for(i = 0; i < sizeof(buf); i++){
+     c6a:	48 ff c0             	inc    %rax
+     c6d:	4c 39 f0             	cmp    %r14,%rax
+     c70:	75 e4                	jne    c56 <sharedfd+0x10b>
+     c72:	eb ca                	jmp    c3e <sharedfd+0xf3>
+  close(fd);
+     c74:	89 df                	mov    %ebx,%edi
+     c76:	e8 95 1e 00 00       	call   2b10 <close>
+  unlink("sharedfd");
+     c7b:	48 c7 c7 24 34 00 00 	mov    $0x3424,%rdi
+     c82:	e8 b1 1e 00 00       	call   2b38 <unlink>
+  if(nc == 10000 && np == 10000){
+     c87:	41 81 fc 10 27 00 00 	cmp    $0x2710,%r12d
+     c8e:	75 27                	jne    cb7 <sharedfd+0x16c>
+     c90:	41 81 fd 10 27 00 00 	cmp    $0x2710,%r13d
+     c97:	75 1e                	jne    cb7 <sharedfd+0x16c>
+    printf(1, "sharedfd ok\n");
+     c99:	48 c7 c6 a2 34 00 00 	mov    $0x34a2,%rsi
+     ca0:	31 c0                	xor    %eax,%eax
+     ca2:	bf 01 00 00 00       	mov    $0x1,%edi
+     ca7:	e8 65 1f 00 00       	call   2c11 <printf>
+}
+     cac:	58                   	pop    %rax
+     cad:	5a                   	pop    %rdx
+     cae:	5b                   	pop    %rbx
+     caf:	41 5c                	pop    %r12
+     cb1:	41 5d                	pop    %r13
+     cb3:	41 5e                	pop    %r14
+     cb5:	5d                   	pop    %rbp
+     cb6:	c3                   	ret
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+     cb7:	44 89 e9             	mov    %r13d,%ecx
+     cba:	44 89 e2             	mov    %r12d,%edx
+     cbd:	48 c7 c6 af 34 00 00 	mov    $0x34af,%rsi
+     cc4:	31 c0                	xor    %eax,%eax
+     cc6:	bf 01 00 00 00       	mov    $0x1,%edi
+     ccb:	e8 41 1f 00 00       	call   2c11 <printf>
+    exit();
+     cd0:	e8 13 1e 00 00       	call   2ae8 <exit>
+
+0000000000000cd5 <fourfiles>:
+{
+     cd5:	55                   	push   %rbp
+  printf(1, "fourfiles test\n");
+     cd6:	48 c7 c6 ca 34 00 00 	mov    $0x34ca,%rsi
+     cdd:	bf 01 00 00 00       	mov    $0x1,%edi
+     ce2:	31 c0                	xor    %eax,%eax
+{
+     ce4:	48 89 e5             	mov    %rsp,%rbp
+     ce7:	41 57                	push   %r15
+     ce9:	41 56                	push   %r14
+     ceb:	41 55                	push   %r13
+     ced:	41 54                	push   %r12
+     cef:	53                   	push   %rbx
+  printf(1, "fourfiles test\n");
+     cf0:	31 db                	xor    %ebx,%ebx
+{
+     cf2:	48 83 ec 28          	sub    $0x28,%rsp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+     cf6:	48 c7 45 b0 c4 34 00 	movq   $0x34c4,-0x50(%rbp)
+     cfd:	00 
+     cfe:	48 c7 45 b8 50 36 00 	movq   $0x3650,-0x48(%rbp)
+     d05:	00 
+     d06:	48 c7 45 c0 54 36 00 	movq   $0x3654,-0x40(%rbp)
+     d0d:	00 
+     d0e:	48 c7 45 c8 c7 34 00 	movq   $0x34c7,-0x38(%rbp)
+     d15:	00 
+  printf(1, "fourfiles test\n");
+     d16:	e8 f6 1e 00 00       	call   2c11 <printf>
+    fname = names[pi];
+     d1b:	4c 8b 64 dd b0       	mov    -0x50(%rbp,%rbx,8),%r12
+    unlink(fname);
+     d20:	4c 89 e7             	mov    %r12,%rdi
+     d23:	e8 10 1e 00 00       	call   2b38 <unlink>
+    pid = fork();
+     d28:	e8 b3 1d 00 00       	call   2ae0 <fork>
+    if(pid < 0){
+     d2d:	85 c0                	test   %eax,%eax
+     d2f:	79 09                	jns    d3a <fourfiles+0x65>
+      printf(1, "fork failed\n");
+     d31:	48 c7 c6 1b 45 00 00 	mov    $0x451b,%rsi
+     d38:	eb 1d                	jmp    d57 <fourfiles+0x82>
+    if(pid == 0){
+     d3a:	75 74                	jne    db0 <fourfiles+0xdb>
+      fd = open(fname, O_CREATE | O_RDWR);
+     d3c:	4c 89 e7             	mov    %r12,%rdi
+     d3f:	be 02 02 00 00       	mov    $0x202,%esi
+     d44:	e8 df 1d 00 00       	call   2b28 <open>
+     d49:	41 89 c4             	mov    %eax,%r12d
+      if(fd < 0){
+     d4c:	85 c0                	test   %eax,%eax
+     d4e:	79 18                	jns    d68 <fourfiles+0x93>
+        printf(1, "create failed\n");
+     d50:	48 c7 c6 21 38 00 00 	mov    $0x3821,%rsi
+     d57:	bf 01 00 00 00       	mov    $0x1,%edi
+     d5c:	31 c0                	xor    %eax,%eax
+     d5e:	e8 ae 1e 00 00       	call   2c11 <printf>
+        exit();
+     d63:	e8 80 1d 00 00       	call   2ae8 <exit>
+      memset(buf, '0'+pi, 512);
+     d68:	8d 73 30             	lea    0x30(%rbx),%esi
+     d6b:	ba 00 02 00 00       	mov    $0x200,%edx
+     d70:	48 c7 c7 00 75 00 00 	mov    $0x7500,%rdi
+     d77:	bb 0c 00 00 00       	mov    $0xc,%ebx
+     d7c:	e8 64 1c 00 00       	call   29e5 <memset>
+        if((n = write(fd, buf, 500)) != 500){
+     d81:	ba f4 01 00 00       	mov    $0x1f4,%edx
+     d86:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+     d8d:	44 89 e7             	mov    %r12d,%edi
+     d90:	e8 73 1d 00 00       	call   2b08 <write>
+     d95:	89 c2                	mov    %eax,%edx
+     d97:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     d9c:	74 0c                	je     daa <fourfiles+0xd5>
+          printf(1, "write failed %d\n", n);
+     d9e:	48 c7 c6 da 34 00 00 	mov    $0x34da,%rsi
+     da5:	e9 a2 00 00 00       	jmp    e4c <fourfiles+0x177>
+      for(i = 0; i < 12; i++){
+     daa:	ff cb                	dec    %ebx
+     dac:	75 d3                	jne    d81 <fourfiles+0xac>
+     dae:	eb b3                	jmp    d63 <fourfiles+0x8e>
+  for(pi = 0; pi < 4; pi++){
+     db0:	48 ff c3             	inc    %rbx
+     db3:	48 83 fb 04          	cmp    $0x4,%rbx
+     db7:	0f 85 5e ff ff ff    	jne    d1b <fourfiles+0x46>
+    wait();
+     dbd:	e8 2e 1d 00 00       	call   2af0 <wait>
+     dc2:	31 db                	xor    %ebx,%ebx
+     dc4:	e8 27 1d 00 00       	call   2af0 <wait>
+     dc9:	e8 22 1d 00 00       	call   2af0 <wait>
+     dce:	e8 1d 1d 00 00       	call   2af0 <wait>
+    fname = names[i];
+     dd3:	4c 8b 6c dd b0       	mov    -0x50(%rbp,%rbx,8),%r13
+    fd = open(fname, 0);
+     dd8:	31 f6                	xor    %esi,%esi
+     dda:	41 89 de             	mov    %ebx,%r14d
+    total = 0;
+     ddd:	45 31 e4             	xor    %r12d,%r12d
+    fd = open(fname, 0);
+     de0:	4c 89 ef             	mov    %r13,%rdi
+     de3:	e8 40 1d 00 00       	call   2b28 <open>
+     de8:	41 89 c7             	mov    %eax,%r15d
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     deb:	ba 00 20 00 00       	mov    $0x2000,%edx
+     df0:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+     df7:	44 89 ff             	mov    %r15d,%edi
+     dfa:	e8 01 1d 00 00       	call   2b00 <read>
+     dff:	85 c0                	test   %eax,%eax
+     e01:	7e 2e                	jle    e31 <fourfiles+0x15c>
+     e03:	31 d2                	xor    %edx,%edx
+        if(buf[j] != '0'+i){
+     e05:	41 83 fe 01          	cmp    $0x1,%r14d
+     e09:	0f be b2 00 75 00 00 	movsbl 0x7500(%rdx),%esi
+     e10:	19 c9                	sbb    %ecx,%ecx
+     e12:	83 c1 31             	add    $0x31,%ecx
+     e15:	39 ce                	cmp    %ecx,%esi
+     e17:	74 0c                	je     e25 <fourfiles+0x150>
+          printf(1, "wrong char\n");
+     e19:	48 c7 c6 eb 34 00 00 	mov    $0x34eb,%rsi
+     e20:	e9 32 ff ff ff       	jmp    d57 <fourfiles+0x82>
+      for(j = 0; j < n; j++){
+     e25:	48 ff c2             	inc    %rdx
+     e28:	39 d0                	cmp    %edx,%eax
+     e2a:	7f d9                	jg     e05 <fourfiles+0x130>
+      total += n;
+     e2c:	41 01 c4             	add    %eax,%r12d
+     e2f:	eb ba                	jmp    deb <fourfiles+0x116>
+    close(fd);
+     e31:	44 89 ff             	mov    %r15d,%edi
+     e34:	e8 d7 1c 00 00       	call   2b10 <close>
+    if(total != 12*500){
+     e39:	41 81 fc 70 17 00 00 	cmp    $0x1770,%r12d
+     e40:	74 1b                	je     e5d <fourfiles+0x188>
+      printf(1, "wrong length %d\n", total);
+     e42:	44 89 e2             	mov    %r12d,%edx
+     e45:	48 c7 c6 f7 34 00 00 	mov    $0x34f7,%rsi
+     e4c:	bf 01 00 00 00       	mov    $0x1,%edi
+     e51:	31 c0                	xor    %eax,%eax
+     e53:	e8 b9 1d 00 00       	call   2c11 <printf>
+      exit();
+     e58:	e9 06 ff ff ff       	jmp    d63 <fourfiles+0x8e>
+    unlink(fname);
+     e5d:	4c 89 ef             	mov    %r13,%rdi
+     e60:	e8 d3 1c 00 00       	call   2b38 <unlink>
+  for(i = 0; i < 2; i++){
+     e65:	48 85 db             	test   %rbx,%rbx
+     e68:	75 0a                	jne    e74 <fourfiles+0x19f>
+     e6a:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e6f:	e9 5f ff ff ff       	jmp    dd3 <fourfiles+0xfe>
+}
+     e74:	48 83 c4 28          	add    $0x28,%rsp
+  printf(1, "fourfiles ok\n");
+     e78:	48 c7 c6 08 35 00 00 	mov    $0x3508,%rsi
+     e7f:	bf 01 00 00 00       	mov    $0x1,%edi
+     e84:	31 c0                	xor    %eax,%eax
+}
+     e86:	5b                   	pop    %rbx
+     e87:	41 5c                	pop    %r12
+     e89:	41 5d                	pop    %r13
+     e8b:	41 5e                	pop    %r14
+     e8d:	41 5f                	pop    %r15
+     e8f:	5d                   	pop    %rbp
+  printf(1, "fourfiles ok\n");
+     e90:	e9 7c 1d 00 00       	jmp    2c11 <printf>
+
+0000000000000e95 <createdelete>:
+{
+     e95:	55                   	push   %rbp
+  printf(1, "createdelete test\n");
+     e96:	48 c7 c6 16 35 00 00 	mov    $0x3516,%rsi
+     e9d:	bf 01 00 00 00       	mov    $0x1,%edi
+     ea2:	31 c0                	xor    %eax,%eax
+{
+     ea4:	48 89 e5             	mov    %rsp,%rbp
+     ea7:	41 55                	push   %r13
+     ea9:	41 54                	push   %r12
+  for(pi = 0; pi < 4; pi++){
+     eab:	45 31 e4             	xor    %r12d,%r12d
+{
+     eae:	53                   	push   %rbx
+     eaf:	48 83 ec 28          	sub    $0x28,%rsp
+  printf(1, "createdelete test\n");
+     eb3:	e8 59 1d 00 00       	call   2c11 <printf>
+    pid = fork();
+     eb8:	e8 23 1c 00 00       	call   2ae0 <fork>
+     ebd:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     ebf:	85 c0                	test   %eax,%eax
+     ec1:	79 09                	jns    ecc <createdelete+0x37>
+      printf(1, "fork failed\n");
+     ec3:	48 c7 c6 1b 45 00 00 	mov    $0x451b,%rsi
+     eca:	eb 2f                	jmp    efb <createdelete+0x66>
+    if(pid == 0){
+     ecc:	75 7c                	jne    f4a <createdelete+0xb5>
+      name[0] = 'p' + pi;
+     ece:	41 83 c4 70          	add    $0x70,%r12d
+      name[2] = '\0';
+     ed2:	c6 45 c2 00          	movb   $0x0,-0x3e(%rbp)
+      name[0] = 'p' + pi;
+     ed6:	44 88 65 c0          	mov    %r12b,-0x40(%rbp)
+        name[1] = '0' + i;
+     eda:	8d 43 30             	lea    0x30(%rbx),%eax
+        fd = open(name, O_CREATE | O_RDWR);
+     edd:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+     ee1:	be 02 02 00 00       	mov    $0x202,%esi
+        name[1] = '0' + i;
+     ee6:	88 45 c1             	mov    %al,-0x3f(%rbp)
+        fd = open(name, O_CREATE | O_RDWR);
+     ee9:	e8 3a 1c 00 00       	call   2b28 <open>
+     eee:	89 c7                	mov    %eax,%edi
+        if(fd < 0){
+     ef0:	85 c0                	test   %eax,%eax
+     ef2:	79 18                	jns    f0c <createdelete+0x77>
+          printf(1, "create failed\n");
+     ef4:	48 c7 c6 21 38 00 00 	mov    $0x3821,%rsi
+     efb:	bf 01 00 00 00       	mov    $0x1,%edi
+     f00:	31 c0                	xor    %eax,%eax
+     f02:	e8 0a 1d 00 00       	call   2c11 <printf>
+          exit();
+     f07:	e8 dc 1b 00 00       	call   2ae8 <exit>
+        close(fd);
+     f0c:	e8 ff 1b 00 00       	call   2b10 <close>
+        if(i > 0 && (i % 2 ) == 0){
+     f11:	85 db                	test   %ebx,%ebx
+     f13:	74 2e                	je     f43 <createdelete+0xae>
+     f15:	f6 c3 01             	test   $0x1,%bl
+     f18:	75 20                	jne    f3a <createdelete+0xa5>
+          name[1] = '0' + (i / 2);
+     f1a:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+     f1c:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+          name[1] = '0' + (i / 2);
+     f20:	d1 f8                	sar    %eax
+     f22:	83 c0 30             	add    $0x30,%eax
+     f25:	88 45 c1             	mov    %al,-0x3f(%rbp)
+          if(unlink(name) < 0){
+     f28:	e8 0b 1c 00 00       	call   2b38 <unlink>
+     f2d:	85 c0                	test   %eax,%eax
+     f2f:	79 09                	jns    f3a <createdelete+0xa5>
+            printf(1, "unlink failed\n");
+     f31:	48 c7 c6 ed 2f 00 00 	mov    $0x2fed,%rsi
+     f38:	eb c1                	jmp    efb <createdelete+0x66>
+      for(i = 0; i < N; i++){
+     f3a:	ff c3                	inc    %ebx
+     f3c:	83 fb 14             	cmp    $0x14,%ebx
+     f3f:	75 99                	jne    eda <createdelete+0x45>
+     f41:	eb c4                	jmp    f07 <createdelete+0x72>
+     f43:	bb 01 00 00 00       	mov    $0x1,%ebx
+     f48:	eb 90                	jmp    eda <createdelete+0x45>
+  for(pi = 0; pi < 4; pi++){
+     f4a:	41 ff c4             	inc    %r12d
+     f4d:	41 83 fc 04          	cmp    $0x4,%r12d
+     f51:	0f 85 61 ff ff ff    	jne    eb8 <createdelete+0x23>
+    wait();
+     f57:	e8 94 1b 00 00       	call   2af0 <wait>
+  for(i = 0; i < N; i++){
+     f5c:	31 db                	xor    %ebx,%ebx
+    wait();
+     f5e:	e8 8d 1b 00 00       	call   2af0 <wait>
+     f63:	e8 88 1b 00 00       	call   2af0 <wait>
+     f68:	e8 83 1b 00 00       	call   2af0 <wait>
+  name[0] = name[1] = name[2] = 0;
+     f6d:	c6 45 c2 00          	movb   $0x0,-0x3e(%rbp)
+      for(i = 0; i < N; i++){
+     f71:	41 b4 70             	mov    $0x70,%r12b
+      name[1] = '0' + i;
+     f74:	44 8d 6b 30          	lea    0x30(%rbx),%r13d
+      fd = open(name, 0);
+     f78:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+     f7c:	31 f6                	xor    %esi,%esi
+      name[0] = 'p' + pi;
+     f7e:	44 88 65 c0          	mov    %r12b,-0x40(%rbp)
+      name[1] = '0' + i;
+     f82:	44 88 6d c1          	mov    %r13b,-0x3f(%rbp)
+      fd = open(name, 0);
+     f86:	e8 9d 1b 00 00       	call   2b28 <open>
+     f8b:	89 c7                	mov    %eax,%edi
+      if((i == 0 || i >= N/2) && fd < 0){
+     f8d:	85 db                	test   %ebx,%ebx
+     f8f:	74 05                	je     f96 <createdelete+0x101>
+     f91:	83 fb 09             	cmp    $0x9,%ebx
+     f94:	7e 18                	jle    fae <createdelete+0x119>
+     f96:	85 ff                	test   %edi,%edi
+     f98:	78 07                	js     fa1 <createdelete+0x10c>
+        close(fd);
+     f9a:	e8 71 1b 00 00       	call   2b10 <close>
+     f9f:	eb 2d                	jmp    fce <createdelete+0x139>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+     fa1:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+     fa5:	48 c7 c6 29 35 00 00 	mov    $0x3529,%rsi
+     fac:	eb 0f                	jmp    fbd <createdelete+0x128>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+     fae:	85 c0                	test   %eax,%eax
+     fb0:	78 1c                	js     fce <createdelete+0x139>
+        printf(1, "oops createdelete %s did exist\n", name);
+     fb2:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+     fb6:	48 c7 c6 4c 35 00 00 	mov    $0x354c,%rsi
+     fbd:	bf 01 00 00 00       	mov    $0x1,%edi
+     fc2:	31 c0                	xor    %eax,%eax
+     fc4:	e8 48 1c 00 00       	call   2c11 <printf>
+        exit();
+     fc9:	e9 39 ff ff ff       	jmp    f07 <createdelete+0x72>
+    for(pi = 0; pi < 4; pi++){
+     fce:	41 ff c4             	inc    %r12d
+     fd1:	41 80 fc 74          	cmp    $0x74,%r12b
+     fd5:	75 a1                	jne    f78 <createdelete+0xe3>
+  for(i = 0; i < N; i++){
+     fd7:	ff c3                	inc    %ebx
+     fd9:	83 fb 14             	cmp    $0x14,%ebx
+     fdc:	75 93                	jne    f71 <createdelete+0xdc>
+     fde:	b3 70                	mov    $0x70,%bl
+     fe0:	41 bc 04 00 00 00    	mov    $0x4,%r12d
+      name[1] = '0' + i;
+     fe6:	44 8d 6b c0          	lea    -0x40(%rbx),%r13d
+      unlink(name);
+     fea:	48 8d 7d c0          	lea    -0x40(%rbp),%rdi
+      name[0] = 'p' + i;
+     fee:	88 5d c0             	mov    %bl,-0x40(%rbp)
+      name[1] = '0' + i;
+     ff1:	44 88 6d c1          	mov    %r13b,-0x3f(%rbp)
+      unlink(name);
+     ff5:	e8 3e 1b 00 00       	call   2b38 <unlink>
+    for(pi = 0; pi < 4; pi++){
+     ffa:	41 ff cc             	dec    %r12d
+     ffd:	75 eb                	jne    fea <createdelete+0x155>
+  for(i = 0; i < N; i++){
+     fff:	ff c3                	inc    %ebx
+    1001:	80 fb 84             	cmp    $0x84,%bl
+    1004:	75 da                	jne    fe0 <createdelete+0x14b>
+  printf(1, "createdelete ok\n");
+    1006:	48 c7 c6 6c 35 00 00 	mov    $0x356c,%rsi
+    100d:	bf 01 00 00 00       	mov    $0x1,%edi
+    1012:	31 c0                	xor    %eax,%eax
+    1014:	e8 f8 1b 00 00       	call   2c11 <printf>
+}
+    1019:	48 83 c4 28          	add    $0x28,%rsp
+    101d:	5b                   	pop    %rbx
+    101e:	41 5c                	pop    %r12
+    1020:	41 5d                	pop    %r13
+    1022:	5d                   	pop    %rbp
+    1023:	c3                   	ret
+
+0000000000001024 <unlinkread>:
+{
+    1024:	55                   	push   %rbp
+  printf(1, "unlinkread test\n");
+    1025:	48 c7 c6 7d 35 00 00 	mov    $0x357d,%rsi
+    102c:	bf 01 00 00 00       	mov    $0x1,%edi
+    1031:	31 c0                	xor    %eax,%eax
+{
+    1033:	48 89 e5             	mov    %rsp,%rbp
+    1036:	41 54                	push   %r12
+    1038:	53                   	push   %rbx
+  printf(1, "unlinkread test\n");
+    1039:	e8 d3 1b 00 00       	call   2c11 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    103e:	be 02 02 00 00       	mov    $0x202,%esi
+    1043:	48 c7 c7 8e 35 00 00 	mov    $0x358e,%rdi
+    104a:	e8 d9 1a 00 00       	call   2b28 <open>
+    printf(1, "create unlinkread failed\n");
+    104f:	48 c7 c6 99 35 00 00 	mov    $0x3599,%rsi
+  if(fd < 0){
+    1056:	85 c0                	test   %eax,%eax
+    1058:	78 3a                	js     1094 <unlinkread+0x70>
+    105a:	89 c3                	mov    %eax,%ebx
+  write(fd, "hello", 5);
+    105c:	ba 05 00 00 00       	mov    $0x5,%edx
+    1061:	48 c7 c6 b3 35 00 00 	mov    $0x35b3,%rsi
+    1068:	89 c7                	mov    %eax,%edi
+    106a:	e8 99 1a 00 00       	call   2b08 <write>
+  close(fd);
+    106f:	89 df                	mov    %ebx,%edi
+    1071:	e8 9a 1a 00 00       	call   2b10 <close>
+  fd = open("unlinkread", O_RDWR);
+    1076:	be 02 00 00 00       	mov    $0x2,%esi
+    107b:	48 c7 c7 8e 35 00 00 	mov    $0x358e,%rdi
+    1082:	e8 a1 1a 00 00       	call   2b28 <open>
+    1087:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1089:	85 c0                	test   %eax,%eax
+    108b:	79 18                	jns    10a5 <unlinkread+0x81>
+    printf(1, "open unlinkread failed\n");
+    108d:	48 c7 c6 b9 35 00 00 	mov    $0x35b9,%rsi
+    1094:	bf 01 00 00 00       	mov    $0x1,%edi
+    1099:	31 c0                	xor    %eax,%eax
+    109b:	e8 71 1b 00 00       	call   2c11 <printf>
+    exit();
+    10a0:	e8 43 1a 00 00       	call   2ae8 <exit>
+  if(unlink("unlinkread") != 0){
+    10a5:	48 c7 c7 8e 35 00 00 	mov    $0x358e,%rdi
+    10ac:	e8 87 1a 00 00       	call   2b38 <unlink>
+    printf(1, "unlink unlinkread failed\n");
+    10b1:	48 c7 c6 d1 35 00 00 	mov    $0x35d1,%rsi
+  if(unlink("unlinkread") != 0){
+    10b8:	85 c0                	test   %eax,%eax
+    10ba:	75 d8                	jne    1094 <unlinkread+0x70>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    10bc:	be 02 02 00 00       	mov    $0x202,%esi
+    10c1:	48 c7 c7 8e 35 00 00 	mov    $0x358e,%rdi
+    10c8:	e8 5b 1a 00 00       	call   2b28 <open>
+  write(fd1, "yyy", 3);
+    10cd:	ba 03 00 00 00       	mov    $0x3,%edx
+    10d2:	48 c7 c6 eb 35 00 00 	mov    $0x35eb,%rsi
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    10d9:	41 89 c4             	mov    %eax,%r12d
+  write(fd1, "yyy", 3);
+    10dc:	89 c7                	mov    %eax,%edi
+    10de:	e8 25 1a 00 00       	call   2b08 <write>
+  close(fd1);
+    10e3:	44 89 e7             	mov    %r12d,%edi
+    10e6:	e8 25 1a 00 00       	call   2b10 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    10eb:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    10f2:	ba 00 20 00 00       	mov    $0x2000,%edx
+    10f7:	89 df                	mov    %ebx,%edi
+    10f9:	e8 02 1a 00 00       	call   2b00 <read>
+    printf(1, "unlinkread read failed");
+    10fe:	48 c7 c6 ef 35 00 00 	mov    $0x35ef,%rsi
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1105:	83 f8 05             	cmp    $0x5,%eax
+    1108:	75 8a                	jne    1094 <unlinkread+0x70>
+  if(buf[0] != 'h'){
+    110a:	80 3d ef 63 00 00 68 	cmpb   $0x68,0x63ef(%rip)        # 7500 <buf>
+    printf(1, "unlinkread wrong data\n");
+    1111:	48 c7 c6 06 36 00 00 	mov    $0x3606,%rsi
+  if(buf[0] != 'h'){
+    1118:	0f 85 76 ff ff ff    	jne    1094 <unlinkread+0x70>
+  if(write(fd, buf, 10) != 10){
+    111e:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    1125:	ba 0a 00 00 00       	mov    $0xa,%edx
+    112a:	89 df                	mov    %ebx,%edi
+    112c:	e8 d7 19 00 00       	call   2b08 <write>
+    printf(1, "unlinkread write failed\n");
+    1131:	48 c7 c6 1d 36 00 00 	mov    $0x361d,%rsi
+  if(write(fd, buf, 10) != 10){
+    1138:	83 f8 0a             	cmp    $0xa,%eax
+    113b:	0f 85 53 ff ff ff    	jne    1094 <unlinkread+0x70>
+  close(fd);
+    1141:	89 df                	mov    %ebx,%edi
+    1143:	e8 c8 19 00 00       	call   2b10 <close>
+  unlink("unlinkread");
+    1148:	48 c7 c7 8e 35 00 00 	mov    $0x358e,%rdi
+    114f:	e8 e4 19 00 00       	call   2b38 <unlink>
+}
+    1154:	5b                   	pop    %rbx
+  printf(1, "unlinkread ok\n");
+    1155:	48 c7 c6 36 36 00 00 	mov    $0x3636,%rsi
+}
+    115c:	41 5c                	pop    %r12
+  printf(1, "unlinkread ok\n");
+    115e:	bf 01 00 00 00       	mov    $0x1,%edi
+    1163:	31 c0                	xor    %eax,%eax
+}
+    1165:	5d                   	pop    %rbp
+  printf(1, "unlinkread ok\n");
+    1166:	e9 a6 1a 00 00       	jmp    2c11 <printf>
+
+000000000000116b <linktest>:
+{
+    116b:	55                   	push   %rbp
+  printf(1, "linktest\n");
+    116c:	48 c7 c6 45 36 00 00 	mov    $0x3645,%rsi
+    1173:	bf 01 00 00 00       	mov    $0x1,%edi
+    1178:	31 c0                	xor    %eax,%eax
+{
+    117a:	48 89 e5             	mov    %rsp,%rbp
+    117d:	53                   	push   %rbx
+    117e:	51                   	push   %rcx
+  printf(1, "linktest\n");
+    117f:	e8 8d 1a 00 00       	call   2c11 <printf>
+  unlink("lf1");
+    1184:	48 c7 c7 4f 36 00 00 	mov    $0x364f,%rdi
+    118b:	e8 a8 19 00 00       	call   2b38 <unlink>
+  unlink("lf2");
+    1190:	48 c7 c7 53 36 00 00 	mov    $0x3653,%rdi
+    1197:	e8 9c 19 00 00       	call   2b38 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    119c:	be 02 02 00 00       	mov    $0x202,%esi
+    11a1:	48 c7 c7 4f 36 00 00 	mov    $0x364f,%rdi
+    11a8:	e8 7b 19 00 00       	call   2b28 <open>
+    printf(1, "create lf1 failed\n");
+    11ad:	48 c7 c6 57 36 00 00 	mov    $0x3657,%rsi
+  if(fd < 0){
+    11b4:	85 c0                	test   %eax,%eax
+    11b6:	78 21                	js     11d9 <linktest+0x6e>
+  if(write(fd, "hello", 5) != 5){
+    11b8:	ba 05 00 00 00       	mov    $0x5,%edx
+    11bd:	48 c7 c6 b3 35 00 00 	mov    $0x35b3,%rsi
+    11c4:	89 c7                	mov    %eax,%edi
+    11c6:	89 c3                	mov    %eax,%ebx
+    11c8:	e8 3b 19 00 00       	call   2b08 <write>
+    11cd:	83 f8 05             	cmp    $0x5,%eax
+    11d0:	74 18                	je     11ea <linktest+0x7f>
+    printf(1, "write lf1 failed\n");
+    11d2:	48 c7 c6 6a 36 00 00 	mov    $0x366a,%rsi
+    11d9:	bf 01 00 00 00       	mov    $0x1,%edi
+    11de:	31 c0                	xor    %eax,%eax
+    11e0:	e8 2c 1a 00 00       	call   2c11 <printf>
+    exit();
+    11e5:	e8 fe 18 00 00       	call   2ae8 <exit>
+  close(fd);
+    11ea:	89 df                	mov    %ebx,%edi
+    11ec:	e8 1f 19 00 00       	call   2b10 <close>
+  if(link("lf1", "lf2") < 0){
+    11f1:	48 c7 c6 53 36 00 00 	mov    $0x3653,%rsi
+    11f8:	48 c7 c7 4f 36 00 00 	mov    $0x364f,%rdi
+    11ff:	e8 44 19 00 00       	call   2b48 <link>
+    printf(1, "link lf1 lf2 failed\n");
+    1204:	48 c7 c6 7c 36 00 00 	mov    $0x367c,%rsi
+  if(link("lf1", "lf2") < 0){
+    120b:	85 c0                	test   %eax,%eax
+    120d:	78 ca                	js     11d9 <linktest+0x6e>
+  unlink("lf1");
+    120f:	48 c7 c7 4f 36 00 00 	mov    $0x364f,%rdi
+    1216:	e8 1d 19 00 00       	call   2b38 <unlink>
+  if(open("lf1", 0) >= 0){
+    121b:	31 f6                	xor    %esi,%esi
+    121d:	48 c7 c7 4f 36 00 00 	mov    $0x364f,%rdi
+    1224:	e8 ff 18 00 00       	call   2b28 <open>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1229:	48 c7 c6 91 36 00 00 	mov    $0x3691,%rsi
+  if(open("lf1", 0) >= 0){
+    1230:	85 c0                	test   %eax,%eax
+    1232:	79 a5                	jns    11d9 <linktest+0x6e>
+  fd = open("lf2", 0);
+    1234:	31 f6                	xor    %esi,%esi
+    1236:	48 c7 c7 53 36 00 00 	mov    $0x3653,%rdi
+    123d:	e8 e6 18 00 00       	call   2b28 <open>
+    printf(1, "open lf2 failed\n");
+    1242:	48 c7 c6 b6 36 00 00 	mov    $0x36b6,%rsi
+  fd = open("lf2", 0);
+    1249:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    124b:	85 c0                	test   %eax,%eax
+    124d:	78 8a                	js     11d9 <linktest+0x6e>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    124f:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    1256:	ba 00 20 00 00       	mov    $0x2000,%edx
+    125b:	89 c7                	mov    %eax,%edi
+    125d:	e8 9e 18 00 00       	call   2b00 <read>
+    printf(1, "read lf2 failed\n");
+    1262:	48 c7 c6 c7 36 00 00 	mov    $0x36c7,%rsi
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1269:	83 f8 05             	cmp    $0x5,%eax
+    126c:	0f 85 67 ff ff ff    	jne    11d9 <linktest+0x6e>
+  close(fd);
+    1272:	89 df                	mov    %ebx,%edi
+    1274:	e8 97 18 00 00       	call   2b10 <close>
+  if(link("lf2", "lf2") >= 0){
+    1279:	48 c7 c6 53 36 00 00 	mov    $0x3653,%rsi
+    1280:	48 89 f7             	mov    %rsi,%rdi
+    1283:	e8 c0 18 00 00       	call   2b48 <link>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1288:	48 c7 c6 d8 36 00 00 	mov    $0x36d8,%rsi
+  if(link("lf2", "lf2") >= 0){
+    128f:	85 c0                	test   %eax,%eax
+    1291:	0f 89 42 ff ff ff    	jns    11d9 <linktest+0x6e>
+  unlink("lf2");
+    1297:	48 c7 c7 53 36 00 00 	mov    $0x3653,%rdi
+    129e:	e8 95 18 00 00       	call   2b38 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    12a3:	48 c7 c6 4f 36 00 00 	mov    $0x364f,%rsi
+    12aa:	48 c7 c7 53 36 00 00 	mov    $0x3653,%rdi
+    12b1:	e8 92 18 00 00       	call   2b48 <link>
+    printf(1, "link non-existant succeeded! oops\n");
+    12b6:	48 c7 c6 f6 36 00 00 	mov    $0x36f6,%rsi
+  if(link("lf2", "lf1") >= 0){
+    12bd:	85 c0                	test   %eax,%eax
+    12bf:	0f 89 14 ff ff ff    	jns    11d9 <linktest+0x6e>
+  if(link(".", "lf1") >= 0){
+    12c5:	48 c7 c6 4f 36 00 00 	mov    $0x364f,%rsi
+    12cc:	48 c7 c7 fb 39 00 00 	mov    $0x39fb,%rdi
+    12d3:	e8 70 18 00 00       	call   2b48 <link>
+    printf(1, "link . lf1 succeeded! oops\n");
+    12d8:	48 c7 c6 19 37 00 00 	mov    $0x3719,%rsi
+  if(link(".", "lf1") >= 0){
+    12df:	85 c0                	test   %eax,%eax
+    12e1:	0f 89 f2 fe ff ff    	jns    11d9 <linktest+0x6e>
+}
+    12e7:	5a                   	pop    %rdx
+  printf(1, "linktest ok\n");
+    12e8:	48 c7 c6 35 37 00 00 	mov    $0x3735,%rsi
+}
+    12ef:	5b                   	pop    %rbx
+  printf(1, "linktest ok\n");
+    12f0:	bf 01 00 00 00       	mov    $0x1,%edi
+    12f5:	31 c0                	xor    %eax,%eax
+}
+    12f7:	5d                   	pop    %rbp
+  printf(1, "linktest ok\n");
+    12f8:	e9 14 19 00 00       	jmp    2c11 <printf>
+
+00000000000012fd <concreate>:
+{
+    12fd:	55                   	push   %rbp
+  printf(1, "concreate test\n");
+    12fe:	48 c7 c6 42 37 00 00 	mov    $0x3742,%rsi
+    1305:	bf 01 00 00 00       	mov    $0x1,%edi
+    130a:	31 c0                	xor    %eax,%eax
+{
+    130c:	48 89 e5             	mov    %rsp,%rbp
+    130f:	41 55                	push   %r13
+    1311:	41 54                	push   %r12
+    1313:	53                   	push   %rbx
+  for(i = 0; i < 40; i++){
+    1314:	31 db                	xor    %ebx,%ebx
+{
+    1316:	48 83 ec 48          	sub    $0x48,%rsp
+  printf(1, "concreate test\n");
+    131a:	e8 f2 18 00 00       	call   2c11 <printf>
+  file[0] = 'C';
+    131f:	c6 45 a5 43          	movb   $0x43,-0x5b(%rbp)
+  file[2] = '\0';
+    1323:	c6 45 a7 00          	movb   $0x0,-0x59(%rbp)
+    file[1] = '0' + i;
+    1327:	8d 43 30             	lea    0x30(%rbx),%eax
+    unlink(file);
+    132a:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    file[1] = '0' + i;
+    132e:	88 45 a6             	mov    %al,-0x5a(%rbp)
+    unlink(file);
+    1331:	e8 02 18 00 00       	call   2b38 <unlink>
+    pid = fork();
+    1336:	e8 a5 17 00 00       	call   2ae0 <fork>
+    133b:	41 89 c4             	mov    %eax,%r12d
+    if(pid && (i % 3) == 1){
+    133e:	85 c0                	test   %eax,%eax
+    1340:	74 20                	je     1362 <concreate+0x65>
+    1342:	89 d8                	mov    %ebx,%eax
+    1344:	b9 03 00 00 00       	mov    $0x3,%ecx
+    1349:	99                   	cltd
+    134a:	f7 f9                	idiv   %ecx
+    134c:	ff ca                	dec    %edx
+    134e:	75 35                	jne    1385 <concreate+0x88>
+      link("C0", file);
+    1350:	48 8d 75 a5          	lea    -0x5b(%rbp),%rsi
+    1354:	48 c7 c7 52 37 00 00 	mov    $0x3752,%rdi
+    135b:	e8 e8 17 00 00       	call   2b48 <link>
+    if(pid == 0)
+    1360:	eb 55                	jmp    13b7 <concreate+0xba>
+      link("C0", file);
+    1362:	89 d8                	mov    %ebx,%eax
+    1364:	b9 05 00 00 00       	mov    $0x5,%ecx
+    1369:	99                   	cltd
+    136a:	f7 f9                	idiv   %ecx
+    } else if(pid == 0 && (i % 5) == 1){
+    136c:	ff ca                	dec    %edx
+    136e:	75 15                	jne    1385 <concreate+0x88>
+      link("C0", file);
+    1370:	48 8d 75 a5          	lea    -0x5b(%rbp),%rsi
+    1374:	48 c7 c7 52 37 00 00 	mov    $0x3752,%rdi
+    137b:	e8 c8 17 00 00       	call   2b48 <link>
+    if(pid == 0)
+    1380:	e9 13 01 00 00       	jmp    1498 <concreate+0x19b>
+      fd = open(file, O_CREATE | O_RDWR);
+    1385:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    1389:	be 02 02 00 00       	mov    $0x202,%esi
+    138e:	e8 95 17 00 00       	call   2b28 <open>
+    1393:	89 c7                	mov    %eax,%edi
+      if(fd < 0){
+    1395:	85 c0                	test   %eax,%eax
+    1397:	79 10                	jns    13a9 <concreate+0xac>
+        printf(1, "concreate create %s failed\n", file);
+    1399:	48 8d 55 a5          	lea    -0x5b(%rbp),%rdx
+    139d:	48 c7 c6 55 37 00 00 	mov    $0x3755,%rsi
+    13a4:	e9 89 00 00 00       	jmp    1432 <concreate+0x135>
+      close(fd);
+    13a9:	e8 62 17 00 00       	call   2b10 <close>
+    if(pid == 0)
+    13ae:	45 85 e4             	test   %r12d,%r12d
+    13b1:	0f 84 e1 00 00 00    	je     1498 <concreate+0x19b>
+      wait();
+    13b7:	e8 34 17 00 00       	call   2af0 <wait>
+  for(i = 0; i < 40; i++){
+    13bc:	ff c3                	inc    %ebx
+    13be:	83 fb 28             	cmp    $0x28,%ebx
+    13c1:	0f 85 60 ff ff ff    	jne    1327 <concreate+0x2a>
+  memset(fa, 0, sizeof(fa));
+    13c7:	ba 28 00 00 00       	mov    $0x28,%edx
+    13cc:	31 f6                	xor    %esi,%esi
+    13ce:	48 8d 7d b8          	lea    -0x48(%rbp),%rdi
+  n = 0;
+    13d2:	45 31 e4             	xor    %r12d,%r12d
+  memset(fa, 0, sizeof(fa));
+    13d5:	e8 0b 16 00 00       	call   29e5 <memset>
+  fd = open(".", 0);
+    13da:	31 f6                	xor    %esi,%esi
+    13dc:	48 c7 c7 fb 39 00 00 	mov    $0x39fb,%rdi
+    13e3:	e8 40 17 00 00       	call   2b28 <open>
+    13e8:	89 c3                	mov    %eax,%ebx
+  while(read(fd, &de, sizeof(de)) > 0){
+    13ea:	eb 08                	jmp    13f4 <concreate+0xf7>
+      fa[i] = 1;
+    13ec:	c6 44 15 b8 01       	movb   $0x1,-0x48(%rbp,%rdx,1)
+      n++;
+    13f1:	41 ff c4             	inc    %r12d
+  while(read(fd, &de, sizeof(de)) > 0){
+    13f4:	ba 10 00 00 00       	mov    $0x10,%edx
+    13f9:	48 8d 75 a8          	lea    -0x58(%rbp),%rsi
+    13fd:	89 df                	mov    %ebx,%edi
+    13ff:	e8 fc 16 00 00       	call   2b00 <read>
+    1404:	85 c0                	test   %eax,%eax
+    1406:	7e 4f                	jle    1457 <concreate+0x15a>
+    if(de.inum == 0)
+    1408:	66 83 7d a8 00       	cmpw   $0x0,-0x58(%rbp)
+    140d:	74 e5                	je     13f4 <concreate+0xf7>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    140f:	80 7d aa 43          	cmpb   $0x43,-0x56(%rbp)
+    1413:	75 df                	jne    13f4 <concreate+0xf7>
+    1415:	80 7d ac 00          	cmpb   $0x0,-0x54(%rbp)
+    1419:	75 d9                	jne    13f4 <concreate+0xf7>
+      i = de.name[1] - '0';
+    141b:	0f be 55 ab          	movsbl -0x55(%rbp),%edx
+    141f:	83 ea 30             	sub    $0x30,%edx
+      if(i < 0 || i >= sizeof(fa)){
+    1422:	83 fa 27             	cmp    $0x27,%edx
+    1425:	76 19                	jbe    1440 <concreate+0x143>
+        printf(1, "concreate weird file %s\n", de.name);
+    1427:	48 8d 55 aa          	lea    -0x56(%rbp),%rdx
+    142b:	48 c7 c6 71 37 00 00 	mov    $0x3771,%rsi
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1432:	bf 01 00 00 00       	mov    $0x1,%edi
+    1437:	31 c0                	xor    %eax,%eax
+    1439:	e8 d3 17 00 00       	call   2c11 <printf>
+        exit();
+    143e:	eb 58                	jmp    1498 <concreate+0x19b>
+      if(fa[i]){
+    1440:	48 63 d2             	movslq %edx,%rdx
+    1443:	80 7c 15 b8 00       	cmpb   $0x0,-0x48(%rbp,%rdx,1)
+    1448:	74 a2                	je     13ec <concreate+0xef>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    144a:	48 8d 55 aa          	lea    -0x56(%rbp),%rdx
+    144e:	48 c7 c6 8a 37 00 00 	mov    $0x378a,%rsi
+    1455:	eb db                	jmp    1432 <concreate+0x135>
+  close(fd);
+    1457:	89 df                	mov    %ebx,%edi
+    if(((i % 3) == 0 && pid == 0) ||
+    1459:	41 bd 03 00 00 00    	mov    $0x3,%r13d
+  for(i = 0; i < 40; i++){
+    145f:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1461:	e8 aa 16 00 00       	call   2b10 <close>
+    printf(1, "concreate not enough files in directory listing\n");
+    1466:	48 c7 c6 a7 37 00 00 	mov    $0x37a7,%rsi
+  if(n != 40){
+    146d:	41 83 fc 28          	cmp    $0x28,%r12d
+    1471:	75 19                	jne    148c <concreate+0x18f>
+    file[1] = '0' + i;
+    1473:	8d 43 30             	lea    0x30(%rbx),%eax
+    1476:	88 45 a6             	mov    %al,-0x5a(%rbp)
+    pid = fork();
+    1479:	e8 62 16 00 00       	call   2ae0 <fork>
+    147e:	41 89 c4             	mov    %eax,%r12d
+    if(pid < 0){
+    1481:	85 c0                	test   %eax,%eax
+    1483:	79 18                	jns    149d <concreate+0x1a0>
+      printf(1, "fork failed\n");
+    1485:	48 c7 c6 1b 45 00 00 	mov    $0x451b,%rsi
+    148c:	bf 01 00 00 00       	mov    $0x1,%edi
+    1491:	31 c0                	xor    %eax,%eax
+    1493:	e8 79 17 00 00       	call   2c11 <printf>
+      exit();
+    1498:	e8 4b 16 00 00       	call   2ae8 <exit>
+    if(((i % 3) == 0 && pid == 0) ||
+    149d:	89 d8                	mov    %ebx,%eax
+    149f:	99                   	cltd
+    14a0:	41 f7 fd             	idiv   %r13d
+    14a3:	89 d0                	mov    %edx,%eax
+    14a5:	44 09 e0             	or     %r12d,%eax
+    14a8:	74 09                	je     14b3 <concreate+0x1b6>
+       ((i % 3) == 1 && pid != 0)){
+    14aa:	45 85 e4             	test   %r12d,%r12d
+    14ad:	74 4e                	je     14fd <concreate+0x200>
+    14af:	ff ca                	dec    %edx
+    14b1:	75 4a                	jne    14fd <concreate+0x200>
+      close(open(file, 0));
+    14b3:	31 f6                	xor    %esi,%esi
+    14b5:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    14b9:	e8 6a 16 00 00       	call   2b28 <open>
+    14be:	89 c7                	mov    %eax,%edi
+    14c0:	e8 4b 16 00 00       	call   2b10 <close>
+      close(open(file, 0));
+    14c5:	31 f6                	xor    %esi,%esi
+    14c7:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    14cb:	e8 58 16 00 00       	call   2b28 <open>
+    14d0:	89 c7                	mov    %eax,%edi
+    14d2:	e8 39 16 00 00       	call   2b10 <close>
+      close(open(file, 0));
+    14d7:	31 f6                	xor    %esi,%esi
+    14d9:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    14dd:	e8 46 16 00 00       	call   2b28 <open>
+    14e2:	89 c7                	mov    %eax,%edi
+    14e4:	e8 27 16 00 00       	call   2b10 <close>
+      close(open(file, 0));
+    14e9:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    14ed:	31 f6                	xor    %esi,%esi
+    14ef:	e8 34 16 00 00       	call   2b28 <open>
+    14f4:	89 c7                	mov    %eax,%edi
+    14f6:	e8 15 16 00 00       	call   2b10 <close>
+    14fb:	eb 24                	jmp    1521 <concreate+0x224>
+      unlink(file);
+    14fd:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    1501:	e8 32 16 00 00       	call   2b38 <unlink>
+      unlink(file);
+    1506:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    150a:	e8 29 16 00 00       	call   2b38 <unlink>
+      unlink(file);
+    150f:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    1513:	e8 20 16 00 00       	call   2b38 <unlink>
+      unlink(file);
+    1518:	48 8d 7d a5          	lea    -0x5b(%rbp),%rdi
+    151c:	e8 17 16 00 00       	call   2b38 <unlink>
+    if(pid == 0)
+    1521:	45 85 e4             	test   %r12d,%r12d
+    1524:	0f 84 6e ff ff ff    	je     1498 <concreate+0x19b>
+      wait();
+    152a:	e8 c1 15 00 00       	call   2af0 <wait>
+  for(i = 0; i < 40; i++){
+    152f:	ff c3                	inc    %ebx
+    1531:	83 fb 28             	cmp    $0x28,%ebx
+    1534:	0f 85 39 ff ff ff    	jne    1473 <concreate+0x176>
+  printf(1, "concreate ok\n");
+    153a:	48 c7 c6 d8 37 00 00 	mov    $0x37d8,%rsi
+    1541:	bf 01 00 00 00       	mov    $0x1,%edi
+    1546:	31 c0                	xor    %eax,%eax
+    1548:	e8 c4 16 00 00       	call   2c11 <printf>
+}
+    154d:	48 83 c4 48          	add    $0x48,%rsp
+    1551:	5b                   	pop    %rbx
+    1552:	41 5c                	pop    %r12
+    1554:	41 5d                	pop    %r13
+    1556:	5d                   	pop    %rbp
+    1557:	c3                   	ret
+
+0000000000001558 <linkunlink>:
+{
+    1558:	55                   	push   %rbp
+  printf(1, "linkunlink test\n");
+    1559:	48 c7 c6 e6 37 00 00 	mov    $0x37e6,%rsi
+    1560:	bf 01 00 00 00       	mov    $0x1,%edi
+    1565:	31 c0                	xor    %eax,%eax
+{
+    1567:	48 89 e5             	mov    %rsp,%rbp
+    156a:	41 56                	push   %r14
+    156c:	41 55                	push   %r13
+    156e:	41 54                	push   %r12
+    1570:	53                   	push   %rbx
+  printf(1, "linkunlink test\n");
+    1571:	e8 9b 16 00 00       	call   2c11 <printf>
+  unlink("x");
+    1576:	48 c7 c7 03 3b 00 00 	mov    $0x3b03,%rdi
+    157d:	e8 b6 15 00 00       	call   2b38 <unlink>
+  pid = fork();
+    1582:	e8 59 15 00 00       	call   2ae0 <fork>
+  if(pid < 0){
+    1587:	85 c0                	test   %eax,%eax
+    1589:	79 18                	jns    15a3 <linkunlink+0x4b>
+    printf(1, "fork failed\n");
+    158b:	48 c7 c6 1b 45 00 00 	mov    $0x451b,%rsi
+    1592:	bf 01 00 00 00       	mov    $0x1,%edi
+    1597:	31 c0                	xor    %eax,%eax
+    1599:	e8 73 16 00 00       	call   2c11 <printf>
+    exit();
+    159e:	e9 99 00 00 00       	jmp    163c <linkunlink+0xe4>
+  unsigned int x = (pid ? 1 : 97);
+    15a3:	83 f8 01             	cmp    $0x1,%eax
+    15a6:	41 89 c4             	mov    %eax,%r12d
+    15a9:	41 bd 64 00 00 00    	mov    $0x64,%r13d
+    if((x % 3) == 0){
+    15af:	41 be 03 00 00 00    	mov    $0x3,%r14d
+  unsigned int x = (pid ? 1 : 97);
+    15b5:	19 db                	sbb    %ebx,%ebx
+    15b7:	83 e3 60             	and    $0x60,%ebx
+    15ba:	ff c3                	inc    %ebx
+    x = x * 1103515245 + 12345;
+    15bc:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+    if((x % 3) == 0){
+    15c2:	31 d2                	xor    %edx,%edx
+    x = x * 1103515245 + 12345;
+    15c4:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+    if((x % 3) == 0){
+    15ca:	89 d8                	mov    %ebx,%eax
+    15cc:	41 f7 f6             	div    %r14d
+    15cf:	85 d2                	test   %edx,%edx
+    15d1:	75 1a                	jne    15ed <linkunlink+0x95>
+      close(open("x", O_RDWR | O_CREATE));
+    15d3:	be 02 02 00 00       	mov    $0x202,%esi
+    15d8:	48 c7 c7 03 3b 00 00 	mov    $0x3b03,%rdi
+    15df:	e8 44 15 00 00       	call   2b28 <open>
+    15e4:	89 c7                	mov    %eax,%edi
+    15e6:	e8 25 15 00 00       	call   2b10 <close>
+    15eb:	eb 25                	jmp    1612 <linkunlink+0xba>
+    } else if((x % 3) == 1){
+    15ed:	ff ca                	dec    %edx
+    15ef:	75 15                	jne    1606 <linkunlink+0xae>
+      link("cat", "x");
+    15f1:	48 c7 c6 03 3b 00 00 	mov    $0x3b03,%rsi
+    15f8:	48 c7 c7 f7 37 00 00 	mov    $0x37f7,%rdi
+    15ff:	e8 44 15 00 00       	call   2b48 <link>
+    1604:	eb 0c                	jmp    1612 <linkunlink+0xba>
+      unlink("x");
+    1606:	48 c7 c7 03 3b 00 00 	mov    $0x3b03,%rdi
+    160d:	e8 26 15 00 00       	call   2b38 <unlink>
+  for(i = 0; i < 100; i++){
+    1612:	41 ff cd             	dec    %r13d
+    1615:	75 a5                	jne    15bc <linkunlink+0x64>
+  if(pid)
+    1617:	45 85 e4             	test   %r12d,%r12d
+    161a:	74 20                	je     163c <linkunlink+0xe4>
+    wait();
+    161c:	e8 cf 14 00 00       	call   2af0 <wait>
+}
+    1621:	5b                   	pop    %rbx
+  printf(1, "linkunlink ok\n");
+    1622:	48 c7 c6 fb 37 00 00 	mov    $0x37fb,%rsi
+}
+    1629:	41 5c                	pop    %r12
+  printf(1, "linkunlink ok\n");
+    162b:	bf 01 00 00 00       	mov    $0x1,%edi
+}
+    1630:	41 5d                	pop    %r13
+  printf(1, "linkunlink ok\n");
+    1632:	31 c0                	xor    %eax,%eax
+}
+    1634:	41 5e                	pop    %r14
+    1636:	5d                   	pop    %rbp
+  printf(1, "linkunlink ok\n");
+    1637:	e9 d5 15 00 00       	jmp    2c11 <printf>
+    exit();
+    163c:	e8 a7 14 00 00       	call   2ae8 <exit>
+
+0000000000001641 <bigdir>:
+{
+    1641:	55                   	push   %rbp
+  printf(1, "bigdir test\n");
+    1642:	48 c7 c6 0a 38 00 00 	mov    $0x380a,%rsi
+    1649:	bf 01 00 00 00       	mov    $0x1,%edi
+    164e:	31 c0                	xor    %eax,%eax
+{
+    1650:	48 89 e5             	mov    %rsp,%rbp
+    1653:	41 54                	push   %r12
+    1655:	53                   	push   %rbx
+    1656:	48 83 ec 10          	sub    $0x10,%rsp
+  printf(1, "bigdir test\n");
+    165a:	e8 b2 15 00 00       	call   2c11 <printf>
+  unlink("bd");
+    165f:	48 c7 c7 17 38 00 00 	mov    $0x3817,%rdi
+    1666:	e8 cd 14 00 00       	call   2b38 <unlink>
+  fd = open("bd", O_CREATE);
+    166b:	be 00 02 00 00       	mov    $0x200,%esi
+    1670:	48 c7 c7 17 38 00 00 	mov    $0x3817,%rdi
+    1677:	e8 ac 14 00 00       	call   2b28 <open>
+    printf(1, "bigdir create failed\n");
+    167c:	48 c7 c6 1a 38 00 00 	mov    $0x381a,%rsi
+  if(fd < 0){
+    1683:	85 c0                	test   %eax,%eax
+    1685:	78 47                	js     16ce <bigdir+0x8d>
+    1687:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 500; i++){
+    1689:	45 31 e4             	xor    %r12d,%r12d
+  close(fd);
+    168c:	e8 7f 14 00 00       	call   2b10 <close>
+    name[1] = '0' + (i / 64);
+    1691:	44 89 e0             	mov    %r12d,%eax
+    if(link("bd", name) != 0){
+    1694:	48 8d 75 e6          	lea    -0x1a(%rbp),%rsi
+    1698:	48 c7 c7 17 38 00 00 	mov    $0x3817,%rdi
+    name[0] = 'x';
+    169f:	c6 45 e6 78          	movb   $0x78,-0x1a(%rbp)
+    name[1] = '0' + (i / 64);
+    16a3:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    16a6:	c6 45 e9 00          	movb   $0x0,-0x17(%rbp)
+    name[1] = '0' + (i / 64);
+    16aa:	83 c0 30             	add    $0x30,%eax
+    16ad:	88 45 e7             	mov    %al,-0x19(%rbp)
+    name[2] = '0' + (i % 64);
+    16b0:	44 89 e0             	mov    %r12d,%eax
+    16b3:	83 e0 3f             	and    $0x3f,%eax
+    16b6:	83 c0 30             	add    $0x30,%eax
+    16b9:	88 45 e8             	mov    %al,-0x18(%rbp)
+    if(link("bd", name) != 0){
+    16bc:	e8 87 14 00 00       	call   2b48 <link>
+    16c1:	89 c3                	mov    %eax,%ebx
+    16c3:	85 c0                	test   %eax,%eax
+    16c5:	74 18                	je     16df <bigdir+0x9e>
+      printf(1, "bigdir link failed\n");
+    16c7:	48 c7 c6 30 38 00 00 	mov    $0x3830,%rsi
+    16ce:	bf 01 00 00 00       	mov    $0x1,%edi
+    16d3:	31 c0                	xor    %eax,%eax
+    16d5:	e8 37 15 00 00       	call   2c11 <printf>
+      exit();
+    16da:	e8 09 14 00 00       	call   2ae8 <exit>
+  for(i = 0; i < 500; i++){
+    16df:	41 ff c4             	inc    %r12d
+    16e2:	41 81 fc f4 01 00 00 	cmp    $0x1f4,%r12d
+    16e9:	75 a6                	jne    1691 <bigdir+0x50>
+  unlink("bd");
+    16eb:	48 c7 c7 17 38 00 00 	mov    $0x3817,%rdi
+    16f2:	e8 41 14 00 00       	call   2b38 <unlink>
+    name[1] = '0' + (i / 64);
+    16f7:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    16f9:	48 8d 7d e6          	lea    -0x1a(%rbp),%rdi
+    name[0] = 'x';
+    16fd:	c6 45 e6 78          	movb   $0x78,-0x1a(%rbp)
+    name[1] = '0' + (i / 64);
+    1701:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1704:	c6 45 e9 00          	movb   $0x0,-0x17(%rbp)
+    name[1] = '0' + (i / 64);
+    1708:	83 c0 30             	add    $0x30,%eax
+    170b:	88 45 e7             	mov    %al,-0x19(%rbp)
+    name[2] = '0' + (i % 64);
+    170e:	89 d8                	mov    %ebx,%eax
+    1710:	83 e0 3f             	and    $0x3f,%eax
+    1713:	83 c0 30             	add    $0x30,%eax
+    1716:	88 45 e8             	mov    %al,-0x18(%rbp)
+    if(unlink(name) != 0){
+    1719:	e8 1a 14 00 00       	call   2b38 <unlink>
+    171e:	85 c0                	test   %eax,%eax
+    1720:	74 09                	je     172b <bigdir+0xea>
+      printf(1, "bigdir unlink failed");
+    1722:	48 c7 c6 44 38 00 00 	mov    $0x3844,%rsi
+    1729:	eb a3                	jmp    16ce <bigdir+0x8d>
+  for(i = 0; i < 500; i++){
+    172b:	ff c3                	inc    %ebx
+    172d:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1733:	75 c2                	jne    16f7 <bigdir+0xb6>
+  printf(1, "bigdir ok\n");
+    1735:	31 c0                	xor    %eax,%eax
+    1737:	48 c7 c6 59 38 00 00 	mov    $0x3859,%rsi
+    173e:	bf 01 00 00 00       	mov    $0x1,%edi
+    1743:	e8 c9 14 00 00       	call   2c11 <printf>
+}
+    1748:	58                   	pop    %rax
+    1749:	5a                   	pop    %rdx
+    174a:	5b                   	pop    %rbx
+    174b:	41 5c                	pop    %r12
+    174d:	5d                   	pop    %rbp
+    174e:	c3                   	ret
+
+000000000000174f <subdir>:
+{
+    174f:	55                   	push   %rbp
+  printf(1, "subdir test\n");
+    1750:	48 c7 c6 64 38 00 00 	mov    $0x3864,%rsi
+    1757:	bf 01 00 00 00       	mov    $0x1,%edi
+    175c:	31 c0                	xor    %eax,%eax
+{
+    175e:	48 89 e5             	mov    %rsp,%rbp
+    1761:	53                   	push   %rbx
+    1762:	51                   	push   %rcx
+  printf(1, "subdir test\n");
+    1763:	e8 a9 14 00 00       	call   2c11 <printf>
+  unlink("ff");
+    1768:	48 c7 c7 13 39 00 00 	mov    $0x3913,%rdi
+    176f:	e8 c4 13 00 00       	call   2b38 <unlink>
+  if(mkdir("dd") != 0){
+    1774:	48 c7 c7 f5 39 00 00 	mov    $0x39f5,%rdi
+    177b:	e8 d0 13 00 00       	call   2b50 <mkdir>
+    printf(1, "subdir mkdir dd failed\n");
+    1780:	48 c7 c6 71 38 00 00 	mov    $0x3871,%rsi
+  if(mkdir("dd") != 0){
+    1787:	85 c0                	test   %eax,%eax
+    1789:	75 1e                	jne    17a9 <subdir+0x5a>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    178b:	be 02 02 00 00       	mov    $0x202,%esi
+    1790:	48 c7 c7 e9 38 00 00 	mov    $0x38e9,%rdi
+    1797:	e8 8c 13 00 00       	call   2b28 <open>
+    179c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    179e:	85 c0                	test   %eax,%eax
+    17a0:	79 18                	jns    17ba <subdir+0x6b>
+    printf(1, "create dd/ff failed\n");
+    17a2:	48 c7 c6 89 38 00 00 	mov    $0x3889,%rsi
+    17a9:	bf 01 00 00 00       	mov    $0x1,%edi
+    17ae:	31 c0                	xor    %eax,%eax
+    17b0:	e8 5c 14 00 00       	call   2c11 <printf>
+    exit();
+    17b5:	e8 2e 13 00 00       	call   2ae8 <exit>
+  write(fd, "ff", 2);
+    17ba:	48 c7 c6 13 39 00 00 	mov    $0x3913,%rsi
+    17c1:	ba 02 00 00 00       	mov    $0x2,%edx
+    17c6:	89 c7                	mov    %eax,%edi
+    17c8:	e8 3b 13 00 00       	call   2b08 <write>
+  close(fd);
+    17cd:	89 df                	mov    %ebx,%edi
+    17cf:	e8 3c 13 00 00       	call   2b10 <close>
+  if(unlink("dd") >= 0){
+    17d4:	48 c7 c7 f5 39 00 00 	mov    $0x39f5,%rdi
+    17db:	e8 58 13 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    17e0:	48 c7 c6 9e 38 00 00 	mov    $0x389e,%rsi
+  if(unlink("dd") >= 0){
+    17e7:	85 c0                	test   %eax,%eax
+    17e9:	79 be                	jns    17a9 <subdir+0x5a>
+  if(mkdir("/dd/dd") != 0){
+    17eb:	48 c7 c7 c4 38 00 00 	mov    $0x38c4,%rdi
+    17f2:	e8 59 13 00 00       	call   2b50 <mkdir>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    17f7:	48 c7 c6 cb 38 00 00 	mov    $0x38cb,%rsi
+  if(mkdir("/dd/dd") != 0){
+    17fe:	85 c0                	test   %eax,%eax
+    1800:	75 a7                	jne    17a9 <subdir+0x5a>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1802:	be 02 02 00 00       	mov    $0x202,%esi
+    1807:	48 c7 c7 e6 38 00 00 	mov    $0x38e6,%rdi
+    180e:	e8 15 13 00 00       	call   2b28 <open>
+    printf(1, "create dd/dd/ff failed\n");
+    1813:	48 c7 c6 ef 38 00 00 	mov    $0x38ef,%rsi
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    181a:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    181c:	85 c0                	test   %eax,%eax
+    181e:	78 89                	js     17a9 <subdir+0x5a>
+  write(fd, "FF", 2);
+    1820:	ba 02 00 00 00       	mov    $0x2,%edx
+    1825:	48 c7 c6 07 39 00 00 	mov    $0x3907,%rsi
+    182c:	89 c7                	mov    %eax,%edi
+    182e:	e8 d5 12 00 00       	call   2b08 <write>
+  close(fd);
+    1833:	89 df                	mov    %ebx,%edi
+    1835:	e8 d6 12 00 00       	call   2b10 <close>
+  fd = open("dd/dd/../ff", 0);
+    183a:	31 f6                	xor    %esi,%esi
+    183c:	48 c7 c7 0a 39 00 00 	mov    $0x390a,%rdi
+    1843:	e8 e0 12 00 00       	call   2b28 <open>
+    printf(1, "open dd/dd/../ff failed\n");
+    1848:	48 c7 c6 16 39 00 00 	mov    $0x3916,%rsi
+  fd = open("dd/dd/../ff", 0);
+    184f:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1851:	85 c0                	test   %eax,%eax
+    1853:	0f 88 50 ff ff ff    	js     17a9 <subdir+0x5a>
+  cc = read(fd, buf, sizeof(buf));
+    1859:	ba 00 20 00 00       	mov    $0x2000,%edx
+    185e:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    1865:	89 c7                	mov    %eax,%edi
+    1867:	e8 94 12 00 00       	call   2b00 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    186c:	83 f8 02             	cmp    $0x2,%eax
+    186f:	75 09                	jne    187a <subdir+0x12b>
+    1871:	80 3d 88 5c 00 00 66 	cmpb   $0x66,0x5c88(%rip)        # 7500 <buf>
+    1878:	74 0c                	je     1886 <subdir+0x137>
+    printf(1, "dd/dd/../ff wrong content\n");
+    187a:	48 c7 c6 2f 39 00 00 	mov    $0x392f,%rsi
+    1881:	e9 23 ff ff ff       	jmp    17a9 <subdir+0x5a>
+  close(fd);
+    1886:	89 df                	mov    %ebx,%edi
+    1888:	e8 83 12 00 00       	call   2b10 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    188d:	48 c7 c6 4a 39 00 00 	mov    $0x394a,%rsi
+    1894:	48 c7 c7 e6 38 00 00 	mov    $0x38e6,%rdi
+    189b:	e8 a8 12 00 00       	call   2b48 <link>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    18a0:	48 c7 c6 55 39 00 00 	mov    $0x3955,%rsi
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    18a7:	85 c0                	test   %eax,%eax
+    18a9:	0f 85 fa fe ff ff    	jne    17a9 <subdir+0x5a>
+  if(unlink("dd/dd/ff") != 0){
+    18af:	48 c7 c7 e6 38 00 00 	mov    $0x38e6,%rdi
+    18b6:	e8 7d 12 00 00       	call   2b38 <unlink>
+    18bb:	85 c0                	test   %eax,%eax
+    18bd:	74 0c                	je     18cb <subdir+0x17c>
+    printf(1, "unlink dd/dd/ff failed\n");
+    18bf:	48 c7 c6 76 39 00 00 	mov    $0x3976,%rsi
+    18c6:	e9 de fe ff ff       	jmp    17a9 <subdir+0x5a>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    18cb:	31 f6                	xor    %esi,%esi
+    18cd:	48 c7 c7 e6 38 00 00 	mov    $0x38e6,%rdi
+    18d4:	e8 4f 12 00 00       	call   2b28 <open>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    18d9:	48 c7 c6 8e 39 00 00 	mov    $0x398e,%rsi
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    18e0:	85 c0                	test   %eax,%eax
+    18e2:	0f 89 c1 fe ff ff    	jns    17a9 <subdir+0x5a>
+  if(chdir("dd") != 0){
+    18e8:	48 c7 c7 f5 39 00 00 	mov    $0x39f5,%rdi
+    18ef:	e8 64 12 00 00       	call   2b58 <chdir>
+    printf(1, "chdir dd failed\n");
+    18f4:	48 c7 c6 b2 39 00 00 	mov    $0x39b2,%rsi
+  if(chdir("dd") != 0){
+    18fb:	85 c0                	test   %eax,%eax
+    18fd:	0f 85 a6 fe ff ff    	jne    17a9 <subdir+0x5a>
+  if(chdir("dd/../../dd") != 0){
+    1903:	48 c7 c7 c3 39 00 00 	mov    $0x39c3,%rdi
+    190a:	e8 49 12 00 00       	call   2b58 <chdir>
+    190f:	85 c0                	test   %eax,%eax
+    1911:	74 0c                	je     191f <subdir+0x1d0>
+    printf(1, "chdir dd/../../dd failed\n");
+    1913:	48 c7 c6 cf 39 00 00 	mov    $0x39cf,%rsi
+    191a:	e9 8a fe ff ff       	jmp    17a9 <subdir+0x5a>
+  if(chdir("dd/../../../dd") != 0){
+    191f:	48 c7 c7 e9 39 00 00 	mov    $0x39e9,%rdi
+    1926:	e8 2d 12 00 00       	call   2b58 <chdir>
+    192b:	85 c0                	test   %eax,%eax
+    192d:	75 e4                	jne    1913 <subdir+0x1c4>
+  if(chdir("./..") != 0){
+    192f:	48 c7 c7 f8 39 00 00 	mov    $0x39f8,%rdi
+    1936:	e8 1d 12 00 00       	call   2b58 <chdir>
+    printf(1, "chdir ./.. failed\n");
+    193b:	48 c7 c6 fd 39 00 00 	mov    $0x39fd,%rsi
+  if(chdir("./..") != 0){
+    1942:	85 c0                	test   %eax,%eax
+    1944:	0f 85 5f fe ff ff    	jne    17a9 <subdir+0x5a>
+  fd = open("dd/dd/ffff", 0);
+    194a:	31 f6                	xor    %esi,%esi
+    194c:	48 c7 c7 4a 39 00 00 	mov    $0x394a,%rdi
+    1953:	e8 d0 11 00 00       	call   2b28 <open>
+    printf(1, "open dd/dd/ffff failed\n");
+    1958:	48 c7 c6 10 3a 00 00 	mov    $0x3a10,%rsi
+  fd = open("dd/dd/ffff", 0);
+    195f:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1961:	85 c0                	test   %eax,%eax
+    1963:	0f 88 40 fe ff ff    	js     17a9 <subdir+0x5a>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1969:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    1970:	ba 00 20 00 00       	mov    $0x2000,%edx
+    1975:	89 c7                	mov    %eax,%edi
+    1977:	e8 84 11 00 00       	call   2b00 <read>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    197c:	48 c7 c6 28 3a 00 00 	mov    $0x3a28,%rsi
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1983:	83 f8 02             	cmp    $0x2,%eax
+    1986:	0f 85 1d fe ff ff    	jne    17a9 <subdir+0x5a>
+  close(fd);
+    198c:	89 df                	mov    %ebx,%edi
+    198e:	e8 7d 11 00 00       	call   2b10 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1993:	31 f6                	xor    %esi,%esi
+    1995:	48 c7 c7 e6 38 00 00 	mov    $0x38e6,%rdi
+    199c:	e8 87 11 00 00       	call   2b28 <open>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    19a1:	48 c7 c6 43 3a 00 00 	mov    $0x3a43,%rsi
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    19a8:	85 c0                	test   %eax,%eax
+    19aa:	0f 89 f9 fd ff ff    	jns    17a9 <subdir+0x5a>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    19b0:	be 02 02 00 00       	mov    $0x202,%esi
+    19b5:	48 c7 c7 68 3a 00 00 	mov    $0x3a68,%rdi
+    19bc:	e8 67 11 00 00       	call   2b28 <open>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    19c1:	48 c7 c6 71 3a 00 00 	mov    $0x3a71,%rsi
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    19c8:	85 c0                	test   %eax,%eax
+    19ca:	0f 89 d9 fd ff ff    	jns    17a9 <subdir+0x5a>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    19d0:	be 02 02 00 00       	mov    $0x202,%esi
+    19d5:	48 c7 c7 8d 3a 00 00 	mov    $0x3a8d,%rdi
+    19dc:	e8 47 11 00 00       	call   2b28 <open>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    19e1:	48 c7 c6 96 3a 00 00 	mov    $0x3a96,%rsi
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    19e8:	85 c0                	test   %eax,%eax
+    19ea:	0f 89 b9 fd ff ff    	jns    17a9 <subdir+0x5a>
+  if(open("dd", O_CREATE) >= 0){
+    19f0:	be 00 02 00 00       	mov    $0x200,%esi
+    19f5:	48 c7 c7 f5 39 00 00 	mov    $0x39f5,%rdi
+    19fc:	e8 27 11 00 00       	call   2b28 <open>
+    printf(1, "create dd succeeded!\n");
+    1a01:	48 c7 c6 b2 3a 00 00 	mov    $0x3ab2,%rsi
+  if(open("dd", O_CREATE) >= 0){
+    1a08:	85 c0                	test   %eax,%eax
+    1a0a:	0f 89 99 fd ff ff    	jns    17a9 <subdir+0x5a>
+  if(open("dd", O_RDWR) >= 0){
+    1a10:	be 02 00 00 00       	mov    $0x2,%esi
+    1a15:	48 c7 c7 f5 39 00 00 	mov    $0x39f5,%rdi
+    1a1c:	e8 07 11 00 00       	call   2b28 <open>
+    printf(1, "open dd rdwr succeeded!\n");
+    1a21:	48 c7 c6 c8 3a 00 00 	mov    $0x3ac8,%rsi
+  if(open("dd", O_RDWR) >= 0){
+    1a28:	85 c0                	test   %eax,%eax
+    1a2a:	0f 89 79 fd ff ff    	jns    17a9 <subdir+0x5a>
+  if(open("dd", O_WRONLY) >= 0){
+    1a30:	be 01 00 00 00       	mov    $0x1,%esi
+    1a35:	48 c7 c7 f5 39 00 00 	mov    $0x39f5,%rdi
+    1a3c:	e8 e7 10 00 00       	call   2b28 <open>
+    printf(1, "open dd wronly succeeded!\n");
+    1a41:	48 c7 c6 e1 3a 00 00 	mov    $0x3ae1,%rsi
+  if(open("dd", O_WRONLY) >= 0){
+    1a48:	85 c0                	test   %eax,%eax
+    1a4a:	0f 89 59 fd ff ff    	jns    17a9 <subdir+0x5a>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1a50:	48 c7 c6 fc 3a 00 00 	mov    $0x3afc,%rsi
+    1a57:	48 c7 c7 68 3a 00 00 	mov    $0x3a68,%rdi
+    1a5e:	e8 e5 10 00 00       	call   2b48 <link>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    1a63:	48 c7 c6 05 3b 00 00 	mov    $0x3b05,%rsi
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1a6a:	85 c0                	test   %eax,%eax
+    1a6c:	0f 84 3b 01 00 00    	je     1bad <subdir+0x45e>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1a72:	48 c7 c6 fc 3a 00 00 	mov    $0x3afc,%rsi
+    1a79:	48 c7 c7 8d 3a 00 00 	mov    $0x3a8d,%rdi
+    1a80:	e8 c3 10 00 00       	call   2b48 <link>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    1a85:	48 c7 c6 28 3b 00 00 	mov    $0x3b28,%rsi
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1a8c:	85 c0                	test   %eax,%eax
+    1a8e:	0f 84 19 01 00 00    	je     1bad <subdir+0x45e>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1a94:	48 c7 c6 4a 39 00 00 	mov    $0x394a,%rsi
+    1a9b:	48 c7 c7 e9 38 00 00 	mov    $0x38e9,%rdi
+    1aa2:	e8 a1 10 00 00       	call   2b48 <link>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    1aa7:	48 c7 c6 4b 3b 00 00 	mov    $0x3b4b,%rsi
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1aae:	85 c0                	test   %eax,%eax
+    1ab0:	0f 84 f7 00 00 00    	je     1bad <subdir+0x45e>
+  if(mkdir("dd/ff/ff") == 0){
+    1ab6:	48 c7 c7 68 3a 00 00 	mov    $0x3a68,%rdi
+    1abd:	e8 8e 10 00 00       	call   2b50 <mkdir>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    1ac2:	48 c7 c6 6d 3b 00 00 	mov    $0x3b6d,%rsi
+  if(mkdir("dd/ff/ff") == 0){
+    1ac9:	85 c0                	test   %eax,%eax
+    1acb:	0f 84 dc 00 00 00    	je     1bad <subdir+0x45e>
+  if(mkdir("dd/xx/ff") == 0){
+    1ad1:	48 c7 c7 8d 3a 00 00 	mov    $0x3a8d,%rdi
+    1ad8:	e8 73 10 00 00       	call   2b50 <mkdir>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    1add:	48 c7 c6 88 3b 00 00 	mov    $0x3b88,%rsi
+  if(mkdir("dd/xx/ff") == 0){
+    1ae4:	85 c0                	test   %eax,%eax
+    1ae6:	0f 84 c1 00 00 00    	je     1bad <subdir+0x45e>
+  if(mkdir("dd/dd/ffff") == 0){
+    1aec:	48 c7 c7 4a 39 00 00 	mov    $0x394a,%rdi
+    1af3:	e8 58 10 00 00       	call   2b50 <mkdir>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    1af8:	48 c7 c6 a3 3b 00 00 	mov    $0x3ba3,%rsi
+  if(mkdir("dd/dd/ffff") == 0){
+    1aff:	85 c0                	test   %eax,%eax
+    1b01:	0f 84 a6 00 00 00    	je     1bad <subdir+0x45e>
+  if(unlink("dd/xx/ff") == 0){
+    1b07:	48 c7 c7 8d 3a 00 00 	mov    $0x3a8d,%rdi
+    1b0e:	e8 25 10 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    1b13:	48 c7 c6 c0 3b 00 00 	mov    $0x3bc0,%rsi
+  if(unlink("dd/xx/ff") == 0){
+    1b1a:	85 c0                	test   %eax,%eax
+    1b1c:	0f 84 8b 00 00 00    	je     1bad <subdir+0x45e>
+  if(unlink("dd/ff/ff") == 0){
+    1b22:	48 c7 c7 68 3a 00 00 	mov    $0x3a68,%rdi
+    1b29:	e8 0a 10 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    1b2e:	48 c7 c6 dc 3b 00 00 	mov    $0x3bdc,%rsi
+  if(unlink("dd/ff/ff") == 0){
+    1b35:	85 c0                	test   %eax,%eax
+    1b37:	74 74                	je     1bad <subdir+0x45e>
+  if(chdir("dd/ff") == 0){
+    1b39:	48 c7 c7 e9 38 00 00 	mov    $0x38e9,%rdi
+    1b40:	e8 13 10 00 00       	call   2b58 <chdir>
+    printf(1, "chdir dd/ff succeeded!\n");
+    1b45:	48 c7 c6 f8 3b 00 00 	mov    $0x3bf8,%rsi
+  if(chdir("dd/ff") == 0){
+    1b4c:	85 c0                	test   %eax,%eax
+    1b4e:	74 5d                	je     1bad <subdir+0x45e>
+  if(chdir("dd/xx") == 0){
+    1b50:	48 c7 c7 ff 3a 00 00 	mov    $0x3aff,%rdi
+    1b57:	e8 fc 0f 00 00       	call   2b58 <chdir>
+    printf(1, "chdir dd/xx succeeded!\n");
+    1b5c:	48 c7 c6 10 3c 00 00 	mov    $0x3c10,%rsi
+  if(chdir("dd/xx") == 0){
+    1b63:	85 c0                	test   %eax,%eax
+    1b65:	74 46                	je     1bad <subdir+0x45e>
+  if(unlink("dd/dd/ffff") != 0){
+    1b67:	48 c7 c7 4a 39 00 00 	mov    $0x394a,%rdi
+    1b6e:	e8 c5 0f 00 00       	call   2b38 <unlink>
+    1b73:	85 c0                	test   %eax,%eax
+    1b75:	0f 85 44 fd ff ff    	jne    18bf <subdir+0x170>
+  if(unlink("dd/ff") != 0){
+    1b7b:	48 c7 c7 e9 38 00 00 	mov    $0x38e9,%rdi
+    1b82:	e8 b1 0f 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dd/ff failed\n");
+    1b87:	48 c7 c6 28 3c 00 00 	mov    $0x3c28,%rsi
+  if(unlink("dd/ff") != 0){
+    1b8e:	85 c0                	test   %eax,%eax
+    1b90:	0f 85 13 fc ff ff    	jne    17a9 <subdir+0x5a>
+  if(unlink("dd") == 0){
+    1b96:	48 c7 c7 f5 39 00 00 	mov    $0x39f5,%rdi
+    1b9d:	e8 96 0f 00 00       	call   2b38 <unlink>
+    1ba2:	85 c0                	test   %eax,%eax
+    1ba4:	75 11                	jne    1bb7 <subdir+0x468>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    1ba6:	48 c7 c6 3d 3c 00 00 	mov    $0x3c3d,%rsi
+    1bad:	bf 01 00 00 00       	mov    $0x1,%edi
+    1bb2:	e9 f9 fb ff ff       	jmp    17b0 <subdir+0x61>
+  if(unlink("dd/dd") < 0){
+    1bb7:	48 c7 c7 c5 38 00 00 	mov    $0x38c5,%rdi
+    1bbe:	e8 75 0f 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dd/dd failed\n");
+    1bc3:	48 c7 c6 5d 3c 00 00 	mov    $0x3c5d,%rsi
+  if(unlink("dd/dd") < 0){
+    1bca:	85 c0                	test   %eax,%eax
+    1bcc:	0f 88 d7 fb ff ff    	js     17a9 <subdir+0x5a>
+  if(unlink("dd") < 0){
+    1bd2:	48 c7 c7 f5 39 00 00 	mov    $0x39f5,%rdi
+    1bd9:	e8 5a 0f 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dd failed\n");
+    1bde:	48 c7 c6 72 3c 00 00 	mov    $0x3c72,%rsi
+  if(unlink("dd") < 0){
+    1be5:	85 c0                	test   %eax,%eax
+    1be7:	0f 88 bc fb ff ff    	js     17a9 <subdir+0x5a>
+}
+    1bed:	5a                   	pop    %rdx
+  printf(1, "subdir ok\n");
+    1bee:	48 c7 c6 84 3c 00 00 	mov    $0x3c84,%rsi
+}
+    1bf5:	5b                   	pop    %rbx
+  printf(1, "subdir ok\n");
+    1bf6:	bf 01 00 00 00       	mov    $0x1,%edi
+    1bfb:	31 c0                	xor    %eax,%eax
+}
+    1bfd:	5d                   	pop    %rbp
+  printf(1, "subdir ok\n");
+    1bfe:	e9 0e 10 00 00       	jmp    2c11 <printf>
+
+0000000000001c03 <bigwrite>:
+{
+    1c03:	55                   	push   %rbp
+  printf(1, "bigwrite test\n");
+    1c04:	48 c7 c6 8f 3c 00 00 	mov    $0x3c8f,%rsi
+    1c0b:	bf 01 00 00 00       	mov    $0x1,%edi
+    1c10:	31 c0                	xor    %eax,%eax
+{
+    1c12:	48 89 e5             	mov    %rsp,%rbp
+    1c15:	41 54                	push   %r12
+    1c17:	53                   	push   %rbx
+  for(sz = 499; sz < 12*512; sz += 471){
+    1c18:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    1c1d:	e8 ef 0f 00 00       	call   2c11 <printf>
+  unlink("bigwrite");
+    1c22:	48 c7 c7 9e 3c 00 00 	mov    $0x3c9e,%rdi
+    1c29:	e8 0a 0f 00 00       	call   2b38 <unlink>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    1c2e:	be 02 02 00 00       	mov    $0x202,%esi
+    1c33:	48 c7 c7 9e 3c 00 00 	mov    $0x3c9e,%rdi
+    1c3a:	e8 e9 0e 00 00       	call   2b28 <open>
+    1c3f:	41 89 c4             	mov    %eax,%r12d
+    if(fd < 0){
+    1c42:	85 c0                	test   %eax,%eax
+    1c44:	78 2b                	js     1c71 <bigwrite+0x6e>
+      int cc = write(fd, buf, sz);
+    1c46:	89 da                	mov    %ebx,%edx
+    1c48:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    1c4f:	89 c7                	mov    %eax,%edi
+    1c51:	e8 b2 0e 00 00       	call   2b08 <write>
+      if(cc != sz){
+    1c56:	39 d8                	cmp    %ebx,%eax
+    1c58:	75 2c                	jne    1c86 <bigwrite+0x83>
+      int cc = write(fd, buf, sz);
+    1c5a:	89 da                	mov    %ebx,%edx
+    1c5c:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    1c63:	44 89 e7             	mov    %r12d,%edi
+    1c66:	e8 9d 0e 00 00       	call   2b08 <write>
+      if(cc != sz){
+    1c6b:	39 c3                	cmp    %eax,%ebx
+    1c6d:	74 33                	je     1ca2 <bigwrite+0x9f>
+    1c6f:	eb 15                	jmp    1c86 <bigwrite+0x83>
+      printf(1, "cannot create bigwrite\n");
+    1c71:	48 c7 c6 a7 3c 00 00 	mov    $0x3ca7,%rsi
+    1c78:	bf 01 00 00 00       	mov    $0x1,%edi
+    1c7d:	31 c0                	xor    %eax,%eax
+    1c7f:	e8 8d 0f 00 00       	call   2c11 <printf>
+      exit();
+    1c84:	eb 17                	jmp    1c9d <bigwrite+0x9a>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    1c86:	89 c1                	mov    %eax,%ecx
+    1c88:	89 da                	mov    %ebx,%edx
+    1c8a:	48 c7 c6 bf 3c 00 00 	mov    $0x3cbf,%rsi
+    1c91:	bf 01 00 00 00       	mov    $0x1,%edi
+    1c96:	31 c0                	xor    %eax,%eax
+    1c98:	e8 74 0f 00 00       	call   2c11 <printf>
+        exit();
+    1c9d:	e8 46 0e 00 00       	call   2ae8 <exit>
+    close(fd);
+    1ca2:	44 89 e7             	mov    %r12d,%edi
+  for(sz = 499; sz < 12*512; sz += 471){
+    1ca5:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    1cab:	e8 60 0e 00 00       	call   2b10 <close>
+    unlink("bigwrite");
+    1cb0:	48 c7 c7 9e 3c 00 00 	mov    $0x3c9e,%rdi
+    1cb7:	e8 7c 0e 00 00       	call   2b38 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    1cbc:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    1cc2:	0f 85 66 ff ff ff    	jne    1c2e <bigwrite+0x2b>
+}
+    1cc8:	5b                   	pop    %rbx
+  printf(1, "bigwrite ok\n");
+    1cc9:	48 c7 c6 d1 3c 00 00 	mov    $0x3cd1,%rsi
+}
+    1cd0:	41 5c                	pop    %r12
+  printf(1, "bigwrite ok\n");
+    1cd2:	bf 01 00 00 00       	mov    $0x1,%edi
+    1cd7:	31 c0                	xor    %eax,%eax
+}
+    1cd9:	5d                   	pop    %rbp
+  printf(1, "bigwrite ok\n");
+    1cda:	e9 32 0f 00 00       	jmp    2c11 <printf>
+
+0000000000001cdf <bigfile>:
+{
+    1cdf:	55                   	push   %rbp
+  printf(1, "bigfile test\n");
+    1ce0:	48 c7 c6 de 3c 00 00 	mov    $0x3cde,%rsi
+    1ce7:	bf 01 00 00 00       	mov    $0x1,%edi
+    1cec:	31 c0                	xor    %eax,%eax
+{
+    1cee:	48 89 e5             	mov    %rsp,%rbp
+    1cf1:	41 54                	push   %r12
+    1cf3:	53                   	push   %rbx
+  printf(1, "bigfile test\n");
+    1cf4:	e8 18 0f 00 00       	call   2c11 <printf>
+  unlink("bigfile");
+    1cf9:	48 c7 c7 fa 3c 00 00 	mov    $0x3cfa,%rdi
+    1d00:	e8 33 0e 00 00       	call   2b38 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    1d05:	be 02 02 00 00       	mov    $0x202,%esi
+    1d0a:	48 c7 c7 fa 3c 00 00 	mov    $0x3cfa,%rdi
+    1d11:	e8 12 0e 00 00       	call   2b28 <open>
+    printf(1, "cannot create bigfile");
+    1d16:	48 c7 c6 ec 3c 00 00 	mov    $0x3cec,%rsi
+  if(fd < 0){
+    1d1d:	85 c0                	test   %eax,%eax
+    1d1f:	78 3a                	js     1d5b <bigfile+0x7c>
+    1d21:	89 c3                	mov    %eax,%ebx
+    1d23:	45 31 e4             	xor    %r12d,%r12d
+    memset(buf, i, 600);
+    1d26:	ba 58 02 00 00       	mov    $0x258,%edx
+    1d2b:	44 89 e6             	mov    %r12d,%esi
+    1d2e:	48 c7 c7 00 75 00 00 	mov    $0x7500,%rdi
+    1d35:	e8 ab 0c 00 00       	call   29e5 <memset>
+    if(write(fd, buf, 600) != 600){
+    1d3a:	ba 58 02 00 00       	mov    $0x258,%edx
+    1d3f:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    1d46:	89 df                	mov    %ebx,%edi
+    1d48:	e8 bb 0d 00 00       	call   2b08 <write>
+    1d4d:	3d 58 02 00 00       	cmp    $0x258,%eax
+    1d52:	74 18                	je     1d6c <bigfile+0x8d>
+      printf(1, "write bigfile failed\n");
+    1d54:	48 c7 c6 02 3d 00 00 	mov    $0x3d02,%rsi
+    1d5b:	bf 01 00 00 00       	mov    $0x1,%edi
+    1d60:	31 c0                	xor    %eax,%eax
+    1d62:	e8 aa 0e 00 00       	call   2c11 <printf>
+      exit();
+    1d67:	e8 7c 0d 00 00       	call   2ae8 <exit>
+  for(i = 0; i < 20; i++){
+    1d6c:	41 ff c4             	inc    %r12d
+    1d6f:	41 83 fc 14          	cmp    $0x14,%r12d
+    1d73:	75 b1                	jne    1d26 <bigfile+0x47>
+  close(fd);
+    1d75:	89 df                	mov    %ebx,%edi
+  for(i = 0; ; i++){
+    1d77:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1d79:	e8 92 0d 00 00       	call   2b10 <close>
+  fd = open("bigfile", 0);
+    1d7e:	31 f6                	xor    %esi,%esi
+    1d80:	48 c7 c7 fa 3c 00 00 	mov    $0x3cfa,%rdi
+    1d87:	e8 9c 0d 00 00       	call   2b28 <open>
+    printf(1, "cannot open bigfile\n");
+    1d8c:	48 c7 c6 18 3d 00 00 	mov    $0x3d18,%rsi
+  fd = open("bigfile", 0);
+    1d93:	41 89 c4             	mov    %eax,%r12d
+  if(fd < 0){
+    1d96:	85 c0                	test   %eax,%eax
+    1d98:	78 c1                	js     1d5b <bigfile+0x7c>
+    cc = read(fd, buf, 300);
+    1d9a:	ba 2c 01 00 00       	mov    $0x12c,%edx
+    1d9f:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    1da6:	44 89 e7             	mov    %r12d,%edi
+    1da9:	e8 52 0d 00 00       	call   2b00 <read>
+    if(cc < 0){
+    1dae:	85 c0                	test   %eax,%eax
+    1db0:	79 09                	jns    1dbb <bigfile+0xdc>
+      printf(1, "read bigfile failed\n");
+    1db2:	48 c7 c6 2d 3d 00 00 	mov    $0x3d2d,%rsi
+    1db9:	eb a0                	jmp    1d5b <bigfile+0x7c>
+    if(cc == 0)
+    1dbb:	74 3a                	je     1df7 <bigfile+0x118>
+    if(cc != 300){
+    1dbd:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    1dc2:	74 09                	je     1dcd <bigfile+0xee>
+      printf(1, "short read bigfile\n");
+    1dc4:	48 c7 c6 42 3d 00 00 	mov    $0x3d42,%rsi
+    1dcb:	eb 8e                	jmp    1d5b <bigfile+0x7c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    1dcd:	89 da                	mov    %ebx,%edx
+    1dcf:	0f be 05 2a 57 00 00 	movsbl 0x572a(%rip),%eax        # 7500 <buf>
+    1dd6:	d1 fa                	sar    %edx
+    1dd8:	39 d0                	cmp    %edx,%eax
+    1dda:	75 0b                	jne    1de7 <bigfile+0x108>
+    1ddc:	0f be 15 48 58 00 00 	movsbl 0x5848(%rip),%edx        # 762b <buf+0x12b>
+    1de3:	39 d0                	cmp    %edx,%eax
+    1de5:	74 0c                	je     1df3 <bigfile+0x114>
+      printf(1, "read bigfile wrong data\n");
+    1de7:	48 c7 c6 56 3d 00 00 	mov    $0x3d56,%rsi
+    1dee:	e9 68 ff ff ff       	jmp    1d5b <bigfile+0x7c>
+  for(i = 0; ; i++){
+    1df3:	ff c3                	inc    %ebx
+    cc = read(fd, buf, 300);
+    1df5:	eb a3                	jmp    1d9a <bigfile+0xbb>
+  if(total != 20*600){
+    1df7:	69 db 2c 01 00 00    	imul   $0x12c,%ebx,%ebx
+  close(fd);
+    1dfd:	44 89 e7             	mov    %r12d,%edi
+    1e00:	e8 0b 0d 00 00       	call   2b10 <close>
+    printf(1, "read bigfile wrong total\n");
+    1e05:	48 c7 c6 6f 3d 00 00 	mov    $0x3d6f,%rsi
+  if(total != 20*600){
+    1e0c:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    1e12:	0f 85 43 ff ff ff    	jne    1d5b <bigfile+0x7c>
+  unlink("bigfile");
+    1e18:	48 c7 c7 fa 3c 00 00 	mov    $0x3cfa,%rdi
+    1e1f:	e8 14 0d 00 00       	call   2b38 <unlink>
+}
+    1e24:	5b                   	pop    %rbx
+  printf(1, "bigfile test ok\n");
+    1e25:	48 c7 c6 89 3d 00 00 	mov    $0x3d89,%rsi
+}
+    1e2c:	41 5c                	pop    %r12
+  printf(1, "bigfile test ok\n");
+    1e2e:	bf 01 00 00 00       	mov    $0x1,%edi
+    1e33:	31 c0                	xor    %eax,%eax
+}
+    1e35:	5d                   	pop    %rbp
+  printf(1, "bigfile test ok\n");
+    1e36:	e9 d6 0d 00 00       	jmp    2c11 <printf>
+
+0000000000001e3b <fourteen>:
+{
+    1e3b:	55                   	push   %rbp
+  printf(1, "fourteen test\n");
+    1e3c:	48 c7 c6 9a 3d 00 00 	mov    $0x3d9a,%rsi
+    1e43:	bf 01 00 00 00       	mov    $0x1,%edi
+    1e48:	31 c0                	xor    %eax,%eax
+{
+    1e4a:	48 89 e5             	mov    %rsp,%rbp
+  printf(1, "fourteen test\n");
+    1e4d:	e8 bf 0d 00 00       	call   2c11 <printf>
+  if(mkdir("12345678901234") != 0){
+    1e52:	48 c7 c7 9f 3e 00 00 	mov    $0x3e9f,%rdi
+    1e59:	e8 f2 0c 00 00       	call   2b50 <mkdir>
+    printf(1, "mkdir 12345678901234 failed\n");
+    1e5e:	48 c7 c6 a9 3d 00 00 	mov    $0x3da9,%rsi
+  if(mkdir("12345678901234") != 0){
+    1e65:	85 c0                	test   %eax,%eax
+    1e67:	75 17                	jne    1e80 <fourteen+0x45>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    1e69:	48 c7 c7 c6 3d 00 00 	mov    $0x3dc6,%rdi
+    1e70:	e8 db 0c 00 00       	call   2b50 <mkdir>
+    1e75:	85 c0                	test   %eax,%eax
+    1e77:	74 18                	je     1e91 <fourteen+0x56>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    1e79:	48 c7 c6 e5 3d 00 00 	mov    $0x3de5,%rsi
+    1e80:	bf 01 00 00 00       	mov    $0x1,%edi
+    1e85:	31 c0                	xor    %eax,%eax
+    1e87:	e8 85 0d 00 00       	call   2c11 <printf>
+    exit();
+    1e8c:	e8 57 0c 00 00       	call   2ae8 <exit>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    1e91:	be 00 02 00 00       	mov    $0x200,%esi
+    1e96:	48 c7 c7 12 3e 00 00 	mov    $0x3e12,%rdi
+    1e9d:	e8 86 0c 00 00       	call   2b28 <open>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    1ea2:	48 c7 c6 42 3e 00 00 	mov    $0x3e42,%rsi
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    1ea9:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    1eab:	85 c0                	test   %eax,%eax
+    1ead:	78 d1                	js     1e80 <fourteen+0x45>
+  close(fd);
+    1eaf:	e8 5c 0c 00 00       	call   2b10 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    1eb4:	31 f6                	xor    %esi,%esi
+    1eb6:	48 c7 c7 81 3e 00 00 	mov    $0x3e81,%rdi
+    1ebd:	e8 66 0c 00 00       	call   2b28 <open>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    1ec2:	48 c7 c6 ae 3e 00 00 	mov    $0x3eae,%rsi
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    1ec9:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    1ecb:	85 c0                	test   %eax,%eax
+    1ecd:	78 b1                	js     1e80 <fourteen+0x45>
+  close(fd);
+    1ecf:	e8 3c 0c 00 00       	call   2b10 <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    1ed4:	48 c7 c7 90 3e 00 00 	mov    $0x3e90,%rdi
+    1edb:	e8 70 0c 00 00       	call   2b50 <mkdir>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    1ee0:	48 c7 c6 e8 3e 00 00 	mov    $0x3ee8,%rsi
+  if(mkdir("12345678901234/12345678901234") == 0){
+    1ee7:	85 c0                	test   %eax,%eax
+    1ee9:	74 17                	je     1f02 <fourteen+0xc7>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    1eeb:	48 c7 c7 18 3f 00 00 	mov    $0x3f18,%rdi
+    1ef2:	e8 59 0c 00 00       	call   2b50 <mkdir>
+    1ef7:	85 c0                	test   %eax,%eax
+    1ef9:	75 11                	jne    1f0c <fourteen+0xd1>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    1efb:	48 c7 c6 37 3f 00 00 	mov    $0x3f37,%rsi
+    1f02:	bf 01 00 00 00       	mov    $0x1,%edi
+    1f07:	e9 7b ff ff ff       	jmp    1e87 <fourteen+0x4c>
+  printf(1, "fourteen ok\n");
+    1f0c:	48 c7 c6 68 3f 00 00 	mov    $0x3f68,%rsi
+    1f13:	bf 01 00 00 00       	mov    $0x1,%edi
+    1f18:	31 c0                	xor    %eax,%eax
+}
+    1f1a:	5d                   	pop    %rbp
+  printf(1, "fourteen ok\n");
+    1f1b:	e9 f1 0c 00 00       	jmp    2c11 <printf>
+
+0000000000001f20 <rmdot>:
+{
+    1f20:	55                   	push   %rbp
+  printf(1, "rmdot test\n");
+    1f21:	48 c7 c6 75 3f 00 00 	mov    $0x3f75,%rsi
+    1f28:	bf 01 00 00 00       	mov    $0x1,%edi
+    1f2d:	31 c0                	xor    %eax,%eax
+{
+    1f2f:	48 89 e5             	mov    %rsp,%rbp
+  printf(1, "rmdot test\n");
+    1f32:	e8 da 0c 00 00       	call   2c11 <printf>
+  if(mkdir("dots") != 0){
+    1f37:	48 c7 c7 81 3f 00 00 	mov    $0x3f81,%rdi
+    1f3e:	e8 0d 0c 00 00       	call   2b50 <mkdir>
+    printf(1, "mkdir dots failed\n");
+    1f43:	48 c7 c6 86 3f 00 00 	mov    $0x3f86,%rsi
+  if(mkdir("dots") != 0){
+    1f4a:	85 c0                	test   %eax,%eax
+    1f4c:	75 17                	jne    1f65 <rmdot+0x45>
+  if(chdir("dots") != 0){
+    1f4e:	48 c7 c7 81 3f 00 00 	mov    $0x3f81,%rdi
+    1f55:	e8 fe 0b 00 00       	call   2b58 <chdir>
+    1f5a:	85 c0                	test   %eax,%eax
+    1f5c:	74 18                	je     1f76 <rmdot+0x56>
+    printf(1, "chdir dots failed\n");
+    1f5e:	48 c7 c6 99 3f 00 00 	mov    $0x3f99,%rsi
+    1f65:	bf 01 00 00 00       	mov    $0x1,%edi
+    1f6a:	31 c0                	xor    %eax,%eax
+    1f6c:	e8 a0 0c 00 00       	call   2c11 <printf>
+    exit();
+    1f71:	e8 72 0b 00 00       	call   2ae8 <exit>
+  if(unlink(".") == 0){
+    1f76:	48 c7 c7 fb 39 00 00 	mov    $0x39fb,%rdi
+    1f7d:	e8 b6 0b 00 00       	call   2b38 <unlink>
+    printf(1, "rm . worked!\n");
+    1f82:	48 c7 c6 ac 3f 00 00 	mov    $0x3fac,%rsi
+  if(unlink(".") == 0){
+    1f89:	85 c0                	test   %eax,%eax
+    1f8b:	74 5c                	je     1fe9 <rmdot+0xc9>
+  if(unlink("..") == 0){
+    1f8d:	48 c7 c7 fa 39 00 00 	mov    $0x39fa,%rdi
+    1f94:	e8 9f 0b 00 00       	call   2b38 <unlink>
+    printf(1, "rm .. worked!\n");
+    1f99:	48 c7 c6 ba 3f 00 00 	mov    $0x3fba,%rsi
+  if(unlink("..") == 0){
+    1fa0:	85 c0                	test   %eax,%eax
+    1fa2:	74 45                	je     1fe9 <rmdot+0xc9>
+  if(chdir("/") != 0){
+    1fa4:	48 c7 c7 59 2f 00 00 	mov    $0x2f59,%rdi
+    1fab:	e8 a8 0b 00 00       	call   2b58 <chdir>
+    printf(1, "chdir / failed\n");
+    1fb0:	48 c7 c6 5b 2f 00 00 	mov    $0x2f5b,%rsi
+  if(chdir("/") != 0){
+    1fb7:	85 c0                	test   %eax,%eax
+    1fb9:	75 aa                	jne    1f65 <rmdot+0x45>
+  if(unlink("dots/.") == 0){
+    1fbb:	48 c7 c7 c9 3f 00 00 	mov    $0x3fc9,%rdi
+    1fc2:	e8 71 0b 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dots/. worked!\n");
+    1fc7:	48 c7 c6 d0 3f 00 00 	mov    $0x3fd0,%rsi
+  if(unlink("dots/.") == 0){
+    1fce:	85 c0                	test   %eax,%eax
+    1fd0:	74 17                	je     1fe9 <rmdot+0xc9>
+  if(unlink("dots/..") == 0){
+    1fd2:	48 c7 c7 e7 3f 00 00 	mov    $0x3fe7,%rdi
+    1fd9:	e8 5a 0b 00 00       	call   2b38 <unlink>
+    1fde:	85 c0                	test   %eax,%eax
+    1fe0:	75 11                	jne    1ff3 <rmdot+0xd3>
+    printf(1, "unlink dots/.. worked!\n");
+    1fe2:	48 c7 c6 ef 3f 00 00 	mov    $0x3fef,%rsi
+    1fe9:	bf 01 00 00 00       	mov    $0x1,%edi
+    1fee:	e9 79 ff ff ff       	jmp    1f6c <rmdot+0x4c>
+  if(unlink("dots") != 0){
+    1ff3:	48 c7 c7 81 3f 00 00 	mov    $0x3f81,%rdi
+    1ffa:	e8 39 0b 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dots failed!\n");
+    1fff:	48 c7 c6 07 40 00 00 	mov    $0x4007,%rsi
+  if(unlink("dots") != 0){
+    2006:	85 c0                	test   %eax,%eax
+    2008:	0f 85 57 ff ff ff    	jne    1f65 <rmdot+0x45>
+  printf(1, "rmdot ok\n");
+    200e:	48 c7 c6 1c 40 00 00 	mov    $0x401c,%rsi
+    2015:	bf 01 00 00 00       	mov    $0x1,%edi
+    201a:	31 c0                	xor    %eax,%eax
+}
+    201c:	5d                   	pop    %rbp
+  printf(1, "rmdot ok\n");
+    201d:	e9 ef 0b 00 00       	jmp    2c11 <printf>
+
+0000000000002022 <dirfile>:
+{
+    2022:	55                   	push   %rbp
+  printf(1, "dir vs file\n");
+    2023:	48 c7 c6 26 40 00 00 	mov    $0x4026,%rsi
+    202a:	bf 01 00 00 00       	mov    $0x1,%edi
+    202f:	31 c0                	xor    %eax,%eax
+{
+    2031:	48 89 e5             	mov    %rsp,%rbp
+    2034:	53                   	push   %rbx
+    2035:	51                   	push   %rcx
+  printf(1, "dir vs file\n");
+    2036:	e8 d6 0b 00 00       	call   2c11 <printf>
+  fd = open("dirfile", O_CREATE);
+    203b:	be 00 02 00 00       	mov    $0x200,%esi
+    2040:	48 c7 c7 33 40 00 00 	mov    $0x4033,%rdi
+    2047:	e8 dc 0a 00 00       	call   2b28 <open>
+    printf(1, "create dirfile failed\n");
+    204c:	48 c7 c6 3b 40 00 00 	mov    $0x403b,%rsi
+  if(fd < 0){
+    2053:	85 c0                	test   %eax,%eax
+    2055:	0f 88 11 01 00 00    	js     216c <dirfile+0x14a>
+    205b:	89 c7                	mov    %eax,%edi
+  close(fd);
+    205d:	e8 ae 0a 00 00       	call   2b10 <close>
+  if(chdir("dirfile") == 0){
+    2062:	48 c7 c7 33 40 00 00 	mov    $0x4033,%rdi
+    2069:	e8 ea 0a 00 00       	call   2b58 <chdir>
+    206e:	85 c0                	test   %eax,%eax
+    2070:	75 16                	jne    2088 <dirfile+0x66>
+    printf(1, "chdir dirfile succeeded!\n");
+    2072:	48 c7 c6 52 40 00 00 	mov    $0x4052,%rsi
+    2079:	bf 01 00 00 00       	mov    $0x1,%edi
+    207e:	e8 8e 0b 00 00       	call   2c11 <printf>
+    exit();
+    2083:	e8 60 0a 00 00       	call   2ae8 <exit>
+  fd = open("dirfile/xx", 0);
+    2088:	31 f6                	xor    %esi,%esi
+    208a:	48 c7 c7 6c 40 00 00 	mov    $0x406c,%rdi
+    2091:	e8 92 0a 00 00       	call   2b28 <open>
+  if(fd >= 0){
+    2096:	85 c0                	test   %eax,%eax
+    2098:	78 0c                	js     20a6 <dirfile+0x84>
+    printf(1, "create dirfile/xx succeeded!\n");
+    209a:	48 c7 c6 77 40 00 00 	mov    $0x4077,%rsi
+    20a1:	e9 c6 00 00 00       	jmp    216c <dirfile+0x14a>
+  fd = open("dirfile/xx", O_CREATE);
+    20a6:	be 00 02 00 00       	mov    $0x200,%esi
+    20ab:	48 c7 c7 6c 40 00 00 	mov    $0x406c,%rdi
+    20b2:	e8 71 0a 00 00       	call   2b28 <open>
+  if(fd >= 0){
+    20b7:	85 c0                	test   %eax,%eax
+    20b9:	79 df                	jns    209a <dirfile+0x78>
+  if(mkdir("dirfile/xx") == 0){
+    20bb:	48 c7 c7 6c 40 00 00 	mov    $0x406c,%rdi
+    20c2:	e8 89 0a 00 00       	call   2b50 <mkdir>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    20c7:	48 c7 c6 95 40 00 00 	mov    $0x4095,%rsi
+  if(mkdir("dirfile/xx") == 0){
+    20ce:	85 c0                	test   %eax,%eax
+    20d0:	74 a7                	je     2079 <dirfile+0x57>
+  if(unlink("dirfile/xx") == 0){
+    20d2:	48 c7 c7 6c 40 00 00 	mov    $0x406c,%rdi
+    20d9:	e8 5a 0a 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    20de:	48 c7 c6 b2 40 00 00 	mov    $0x40b2,%rsi
+  if(unlink("dirfile/xx") == 0){
+    20e5:	85 c0                	test   %eax,%eax
+    20e7:	74 90                	je     2079 <dirfile+0x57>
+  if(link("README", "dirfile/xx") == 0){
+    20e9:	48 c7 c6 6c 40 00 00 	mov    $0x406c,%rsi
+    20f0:	48 c7 c7 d0 40 00 00 	mov    $0x40d0,%rdi
+    20f7:	e8 4c 0a 00 00       	call   2b48 <link>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    20fc:	48 c7 c6 d7 40 00 00 	mov    $0x40d7,%rsi
+  if(link("README", "dirfile/xx") == 0){
+    2103:	85 c0                	test   %eax,%eax
+    2105:	0f 84 6e ff ff ff    	je     2079 <dirfile+0x57>
+  if(unlink("dirfile") != 0){
+    210b:	48 c7 c7 33 40 00 00 	mov    $0x4033,%rdi
+    2112:	e8 21 0a 00 00       	call   2b38 <unlink>
+    printf(1, "unlink dirfile failed!\n");
+    2117:	48 c7 c6 f6 40 00 00 	mov    $0x40f6,%rsi
+  if(unlink("dirfile") != 0){
+    211e:	85 c0                	test   %eax,%eax
+    2120:	75 4a                	jne    216c <dirfile+0x14a>
+  fd = open(".", O_RDWR);
+    2122:	be 02 00 00 00       	mov    $0x2,%esi
+    2127:	48 c7 c7 fb 39 00 00 	mov    $0x39fb,%rdi
+    212e:	e8 f5 09 00 00       	call   2b28 <open>
+    printf(1, "open . for writing succeeded!\n");
+    2133:	48 c7 c6 0e 41 00 00 	mov    $0x410e,%rsi
+  if(fd >= 0){
+    213a:	85 c0                	test   %eax,%eax
+    213c:	79 2e                	jns    216c <dirfile+0x14a>
+  fd = open(".", 0);
+    213e:	31 f6                	xor    %esi,%esi
+    2140:	48 c7 c7 fb 39 00 00 	mov    $0x39fb,%rdi
+    2147:	e8 dc 09 00 00       	call   2b28 <open>
+  if(write(fd, "x", 1) > 0){
+    214c:	ba 01 00 00 00       	mov    $0x1,%edx
+    2151:	48 c7 c6 03 3b 00 00 	mov    $0x3b03,%rsi
+    2158:	89 c7                	mov    %eax,%edi
+  fd = open(".", 0);
+    215a:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    215c:	e8 a7 09 00 00       	call   2b08 <write>
+    2161:	85 c0                	test   %eax,%eax
+    2163:	7e 13                	jle    2178 <dirfile+0x156>
+    printf(1, "write . succeeded!\n");
+    2165:	48 c7 c6 2d 41 00 00 	mov    $0x412d,%rsi
+    216c:	bf 01 00 00 00       	mov    $0x1,%edi
+    2171:	31 c0                	xor    %eax,%eax
+    2173:	e9 06 ff ff ff       	jmp    207e <dirfile+0x5c>
+  close(fd);
+    2178:	89 df                	mov    %ebx,%edi
+    217a:	e8 91 09 00 00       	call   2b10 <close>
+}
+    217f:	5a                   	pop    %rdx
+  printf(1, "dir vs file OK\n");
+    2180:	48 c7 c6 41 41 00 00 	mov    $0x4141,%rsi
+}
+    2187:	5b                   	pop    %rbx
+  printf(1, "dir vs file OK\n");
+    2188:	bf 01 00 00 00       	mov    $0x1,%edi
+    218d:	31 c0                	xor    %eax,%eax
+}
+    218f:	5d                   	pop    %rbp
+  printf(1, "dir vs file OK\n");
+    2190:	e9 7c 0a 00 00       	jmp    2c11 <printf>
+
+0000000000002195 <iref>:
+{
+    2195:	55                   	push   %rbp
+  printf(1, "empty file name\n");
+    2196:	48 c7 c6 51 41 00 00 	mov    $0x4151,%rsi
+    219d:	bf 01 00 00 00       	mov    $0x1,%edi
+    21a2:	31 c0                	xor    %eax,%eax
+{
+    21a4:	48 89 e5             	mov    %rsp,%rbp
+    21a7:	53                   	push   %rbx
+  printf(1, "empty file name\n");
+    21a8:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    21ad:	51                   	push   %rcx
+  printf(1, "empty file name\n");
+    21ae:	e8 5e 0a 00 00       	call   2c11 <printf>
+    if(mkdir("irefd") != 0){
+    21b3:	48 c7 c7 62 41 00 00 	mov    $0x4162,%rdi
+    21ba:	e8 91 09 00 00       	call   2b50 <mkdir>
+    21bf:	85 c0                	test   %eax,%eax
+    21c1:	74 09                	je     21cc <iref+0x37>
+      printf(1, "mkdir irefd failed\n");
+    21c3:	48 c7 c6 68 41 00 00 	mov    $0x4168,%rsi
+    21ca:	eb 17                	jmp    21e3 <iref+0x4e>
+    if(chdir("irefd") != 0){
+    21cc:	48 c7 c7 62 41 00 00 	mov    $0x4162,%rdi
+    21d3:	e8 80 09 00 00       	call   2b58 <chdir>
+    21d8:	85 c0                	test   %eax,%eax
+    21da:	74 18                	je     21f4 <iref+0x5f>
+      printf(1, "chdir irefd failed\n");
+    21dc:	48 c7 c6 7c 41 00 00 	mov    $0x417c,%rsi
+    21e3:	bf 01 00 00 00       	mov    $0x1,%edi
+    21e8:	31 c0                	xor    %eax,%eax
+    21ea:	e8 22 0a 00 00       	call   2c11 <printf>
+      exit();
+    21ef:	e8 f4 08 00 00       	call   2ae8 <exit>
+    mkdir("");
+    21f4:	48 c7 c7 0c 34 00 00 	mov    $0x340c,%rdi
+    21fb:	e8 50 09 00 00       	call   2b50 <mkdir>
+    link("README", "");
+    2200:	48 c7 c6 0c 34 00 00 	mov    $0x340c,%rsi
+    2207:	48 c7 c7 d0 40 00 00 	mov    $0x40d0,%rdi
+    220e:	e8 35 09 00 00       	call   2b48 <link>
+    fd = open("", O_CREATE);
+    2213:	48 c7 c7 0c 34 00 00 	mov    $0x340c,%rdi
+    221a:	be 00 02 00 00       	mov    $0x200,%esi
+    221f:	e8 04 09 00 00       	call   2b28 <open>
+    2224:	89 c7                	mov    %eax,%edi
+    if(fd >= 0)
+    2226:	85 c0                	test   %eax,%eax
+    2228:	78 05                	js     222f <iref+0x9a>
+      close(fd);
+    222a:	e8 e1 08 00 00       	call   2b10 <close>
+    fd = open("xx", O_CREATE);
+    222f:	48 c7 c7 02 3b 00 00 	mov    $0x3b02,%rdi
+    2236:	be 00 02 00 00       	mov    $0x200,%esi
+    223b:	e8 e8 08 00 00       	call   2b28 <open>
+    2240:	89 c7                	mov    %eax,%edi
+    if(fd >= 0)
+    2242:	85 c0                	test   %eax,%eax
+    2244:	78 05                	js     224b <iref+0xb6>
+      close(fd);
+    2246:	e8 c5 08 00 00       	call   2b10 <close>
+    unlink("xx");
+    224b:	48 c7 c7 02 3b 00 00 	mov    $0x3b02,%rdi
+    2252:	e8 e1 08 00 00       	call   2b38 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2257:	ff cb                	dec    %ebx
+    2259:	0f 85 54 ff ff ff    	jne    21b3 <iref+0x1e>
+  chdir("/");
+    225f:	48 c7 c7 59 2f 00 00 	mov    $0x2f59,%rdi
+    2266:	e8 ed 08 00 00       	call   2b58 <chdir>
+}
+    226b:	5a                   	pop    %rdx
+  printf(1, "empty file name OK\n");
+    226c:	48 c7 c6 90 41 00 00 	mov    $0x4190,%rsi
+}
+    2273:	5b                   	pop    %rbx
+  printf(1, "empty file name OK\n");
+    2274:	bf 01 00 00 00       	mov    $0x1,%edi
+    2279:	31 c0                	xor    %eax,%eax
+}
+    227b:	5d                   	pop    %rbp
+  printf(1, "empty file name OK\n");
+    227c:	e9 90 09 00 00       	jmp    2c11 <printf>
+
+0000000000002281 <forktest>:
+{
+    2281:	55                   	push   %rbp
+  printf(1, "fork test\n");
+    2282:	48 c7 c6 a4 41 00 00 	mov    $0x41a4,%rsi
+    2289:	bf 01 00 00 00       	mov    $0x1,%edi
+    228e:	31 c0                	xor    %eax,%eax
+{
+    2290:	48 89 e5             	mov    %rsp,%rbp
+    2293:	53                   	push   %rbx
+  for(n=0; n<1000; n++){
+    2294:	31 db                	xor    %ebx,%ebx
+{
+    2296:	51                   	push   %rcx
+  printf(1, "fork test\n");
+    2297:	e8 75 09 00 00       	call   2c11 <printf>
+    pid = fork();
+    229c:	e8 3f 08 00 00       	call   2ae0 <fork>
+    if(pid < 0)
+    22a1:	85 c0                	test   %eax,%eax
+    22a3:	78 26                	js     22cb <forktest+0x4a>
+    if(pid == 0)
+    22a5:	74 1d                	je     22c4 <forktest+0x43>
+  for(n=0; n<1000; n++){
+    22a7:	ff c3                	inc    %ebx
+    22a9:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    22af:	75 eb                	jne    229c <forktest+0x1b>
+    printf(1, "fork claimed to work 1000 times!\n");
+    22b1:	48 c7 c6 af 41 00 00 	mov    $0x41af,%rsi
+    22b8:	bf 01 00 00 00       	mov    $0x1,%edi
+    22bd:	31 c0                	xor    %eax,%eax
+    22bf:	e8 4d 09 00 00       	call   2c11 <printf>
+    exit();
+    22c4:	e8 1f 08 00 00       	call   2ae8 <exit>
+  for(; n > 0; n--){
+    22c9:	ff cb                	dec    %ebx
+    22cb:	85 db                	test   %ebx,%ebx
+    22cd:	74 12                	je     22e1 <forktest+0x60>
+    if(wait() < 0){
+    22cf:	e8 1c 08 00 00       	call   2af0 <wait>
+    22d4:	85 c0                	test   %eax,%eax
+    22d6:	79 f1                	jns    22c9 <forktest+0x48>
+      printf(1, "wait stopped early\n");
+    22d8:	48 c7 c6 d1 41 00 00 	mov    $0x41d1,%rsi
+    22df:	eb d7                	jmp    22b8 <forktest+0x37>
+  if(wait() != -1){
+    22e1:	e8 0a 08 00 00       	call   2af0 <wait>
+    printf(1, "wait got too many\n");
+    22e6:	48 c7 c6 e5 41 00 00 	mov    $0x41e5,%rsi
+  if(wait() != -1){
+    22ed:	ff c0                	inc    %eax
+    22ef:	75 c7                	jne    22b8 <forktest+0x37>
+}
+    22f1:	5a                   	pop    %rdx
+  printf(1, "fork test OK\n");
+    22f2:	48 c7 c6 f8 41 00 00 	mov    $0x41f8,%rsi
+}
+    22f9:	5b                   	pop    %rbx
+  printf(1, "fork test OK\n");
+    22fa:	bf 01 00 00 00       	mov    $0x1,%edi
+    22ff:	31 c0                	xor    %eax,%eax
+}
+    2301:	5d                   	pop    %rbp
+  printf(1, "fork test OK\n");
+    2302:	e9 0a 09 00 00       	jmp    2c11 <printf>
+
+0000000000002307 <sbrktest>:
+{
+    2307:	55                   	push   %rbp
+  printf(stdout, "sbrk test\n");
+    2308:	48 c7 c6 06 42 00 00 	mov    $0x4206,%rsi
+    230f:	31 c0                	xor    %eax,%eax
+{
+    2311:	48 89 e5             	mov    %rsp,%rbp
+    2314:	41 56                	push   %r14
+    2316:	41 55                	push   %r13
+  for(i = 0; i < 5000; i++){ 
+    2318:	45 31 ed             	xor    %r13d,%r13d
+{
+    231b:	41 54                	push   %r12
+    231d:	53                   	push   %rbx
+    231e:	48 83 ec 40          	sub    $0x40,%rsp
+  printf(stdout, "sbrk test\n");
+    2322:	8b 3d 60 2a 00 00    	mov    0x2a60(%rip),%edi        # 4d88 <stdout>
+    2328:	e8 e4 08 00 00       	call   2c11 <printf>
+  oldbrk = sbrk(0);
+    232d:	31 ff                	xor    %edi,%edi
+    232f:	e8 3c 08 00 00       	call   2b70 <sbrk>
+  a = sbrk(0);
+    2334:	31 ff                	xor    %edi,%edi
+  oldbrk = sbrk(0);
+    2336:	49 89 c4             	mov    %rax,%r12
+  a = sbrk(0);
+    2339:	e8 32 08 00 00       	call   2b70 <sbrk>
+    233e:	48 89 c3             	mov    %rax,%rbx
+    b = sbrk(1);
+    2341:	bf 01 00 00 00       	mov    $0x1,%edi
+    2346:	e8 25 08 00 00       	call   2b70 <sbrk>
+    234b:	49 89 c0             	mov    %rax,%r8
+    if(b != a){
+    234e:	48 39 d8             	cmp    %rbx,%rax
+    2351:	74 1c                	je     236f <sbrktest+0x68>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    2353:	8b 3d 2f 2a 00 00    	mov    0x2a2f(%rip),%edi        # 4d88 <stdout>
+    2359:	48 89 d9             	mov    %rbx,%rcx
+    235c:	44 89 ea             	mov    %r13d,%edx
+    235f:	31 c0                	xor    %eax,%eax
+    2361:	48 c7 c6 11 42 00 00 	mov    $0x4211,%rsi
+    2368:	e8 a4 08 00 00       	call   2c11 <printf>
+      exit();
+    236d:	eb 38                	jmp    23a7 <sbrktest+0xa0>
+  for(i = 0; i < 5000; i++){ 
+    236f:	41 ff c5             	inc    %r13d
+    *b = 1;
+    2372:	c6 03 01             	movb   $0x1,(%rbx)
+    a = b + 1;
+    2375:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  for(i = 0; i < 5000; i++){ 
+    2379:	41 81 fd 88 13 00 00 	cmp    $0x1388,%r13d
+    2380:	74 05                	je     2387 <sbrktest+0x80>
+    a = b + 1;
+    2382:	48 89 c3             	mov    %rax,%rbx
+    2385:	eb ba                	jmp    2341 <sbrktest+0x3a>
+  pid = fork();
+    2387:	e8 54 07 00 00       	call   2ae0 <fork>
+    238c:	41 89 c5             	mov    %eax,%r13d
+  if(pid < 0){
+    238f:	85 c0                	test   %eax,%eax
+    2391:	79 19                	jns    23ac <sbrktest+0xa5>
+    printf(stdout, "sbrk test fork failed\n");
+    2393:	48 c7 c6 2c 42 00 00 	mov    $0x422c,%rsi
+    239a:	8b 3d e8 29 00 00    	mov    0x29e8(%rip),%edi        # 4d88 <stdout>
+    23a0:	31 c0                	xor    %eax,%eax
+    23a2:	e8 6a 08 00 00       	call   2c11 <printf>
+    exit();
+    23a7:	e8 3c 07 00 00       	call   2ae8 <exit>
+  c = sbrk(1);
+    23ac:	bf 01 00 00 00       	mov    $0x1,%edi
+  if(c != a + 1){
+    23b1:	48 83 c3 02          	add    $0x2,%rbx
+  c = sbrk(1);
+    23b5:	e8 b6 07 00 00       	call   2b70 <sbrk>
+  c = sbrk(1);
+    23ba:	bf 01 00 00 00       	mov    $0x1,%edi
+    23bf:	e8 ac 07 00 00       	call   2b70 <sbrk>
+    printf(stdout, "sbrk test failed post-fork\n");
+    23c4:	48 c7 c6 43 42 00 00 	mov    $0x4243,%rsi
+  if(c != a + 1){
+    23cb:	48 39 c3             	cmp    %rax,%rbx
+    23ce:	75 ca                	jne    239a <sbrktest+0x93>
+  if(pid == 0)
+    23d0:	45 85 ed             	test   %r13d,%r13d
+    23d3:	74 d2                	je     23a7 <sbrktest+0xa0>
+  wait();
+    23d5:	e8 16 07 00 00       	call   2af0 <wait>
+  a = sbrk(0);
+    23da:	31 ff                	xor    %edi,%edi
+    23dc:	e8 8f 07 00 00       	call   2b70 <sbrk>
+  amt = (BIG) - (uint)(uintp)a;
+    23e1:	bf 00 00 40 06       	mov    $0x6400000,%edi
+    23e6:	29 c7                	sub    %eax,%edi
+  a = sbrk(0);
+    23e8:	48 89 c3             	mov    %rax,%rbx
+  p = sbrk(amt);
+    23eb:	e8 80 07 00 00       	call   2b70 <sbrk>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    23f0:	48 c7 c6 5f 42 00 00 	mov    $0x425f,%rsi
+  if (p != a) { 
+    23f7:	48 39 c3             	cmp    %rax,%rbx
+    23fa:	75 9e                	jne    239a <sbrktest+0x93>
+  *lastaddr = 99;
+    23fc:	c6 04 25 ff ff 3f 06 	movb   $0x63,0x63fffff
+    2403:	63 
+  a = sbrk(0);
+    2404:	31 ff                	xor    %edi,%edi
+    2406:	e8 65 07 00 00       	call   2b70 <sbrk>
+  c = sbrk(-4096);
+    240b:	bf 00 f0 ff ff       	mov    $0xfffff000,%edi
+  a = sbrk(0);
+    2410:	48 89 c3             	mov    %rax,%rbx
+  c = sbrk(-4096);
+    2413:	e8 58 07 00 00       	call   2b70 <sbrk>
+    printf(stdout, "sbrk could not deallocate\n");
+    2418:	48 c7 c6 9d 42 00 00 	mov    $0x429d,%rsi
+  c = sbrk(-4096);
+    241f:	48 89 c2             	mov    %rax,%rdx
+  if(c == (char*)0xffffffff){
+    2422:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    2427:	48 39 c2             	cmp    %rax,%rdx
+    242a:	0f 84 6a ff ff ff    	je     239a <sbrktest+0x93>
+  c = sbrk(0);
+    2430:	31 ff                	xor    %edi,%edi
+    2432:	e8 39 07 00 00       	call   2b70 <sbrk>
+    2437:	48 89 c1             	mov    %rax,%rcx
+  if(c != a - 4096){
+    243a:	48 8d 83 00 f0 ff ff 	lea    -0x1000(%rbx),%rax
+    2441:	48 39 c1             	cmp    %rax,%rcx
+    2444:	74 0f                	je     2455 <sbrktest+0x14e>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    2446:	48 89 da             	mov    %rbx,%rdx
+    2449:	48 c7 c6 b8 42 00 00 	mov    $0x42b8,%rsi
+    2450:	e9 87 00 00 00       	jmp    24dc <sbrktest+0x1d5>
+  a = sbrk(0);
+    2455:	31 ff                	xor    %edi,%edi
+    2457:	e8 14 07 00 00       	call   2b70 <sbrk>
+  c = sbrk(4096);
+    245c:	bf 00 10 00 00       	mov    $0x1000,%edi
+  a = sbrk(0);
+    2461:	48 89 c3             	mov    %rax,%rbx
+  c = sbrk(4096);
+    2464:	e8 07 07 00 00       	call   2b70 <sbrk>
+    2469:	49 89 c5             	mov    %rax,%r13
+  if(c != a || sbrk(0) != a + 4096){
+    246c:	48 39 c3             	cmp    %rax,%rbx
+    246f:	74 0f                	je     2480 <sbrktest+0x179>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    2471:	4c 89 e9             	mov    %r13,%rcx
+    2474:	48 89 da             	mov    %rbx,%rdx
+    2477:	48 c7 c6 ed 42 00 00 	mov    $0x42ed,%rsi
+    247e:	eb 5c                	jmp    24dc <sbrktest+0x1d5>
+  if(c != a || sbrk(0) != a + 4096){
+    2480:	31 ff                	xor    %edi,%edi
+    2482:	e8 e9 06 00 00       	call   2b70 <sbrk>
+    2487:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+    248e:	48 39 c2             	cmp    %rax,%rdx
+    2491:	75 de                	jne    2471 <sbrktest+0x16a>
+  if(*lastaddr == 99){
+    2493:	80 3c 25 ff ff 3f 06 	cmpb   $0x63,0x63fffff
+    249a:	63 
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    249b:	48 c7 c6 13 43 00 00 	mov    $0x4313,%rsi
+  if(*lastaddr == 99){
+    24a2:	0f 84 f2 fe ff ff    	je     239a <sbrktest+0x93>
+  a = sbrk(0);
+    24a8:	31 ff                	xor    %edi,%edi
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    24aa:	48 c7 c3 00 00 00 80 	mov    $0xffffffff80000000,%rbx
+  a = sbrk(0);
+    24b1:	e8 ba 06 00 00       	call   2b70 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    24b6:	31 ff                	xor    %edi,%edi
+  a = sbrk(0);
+    24b8:	49 89 c5             	mov    %rax,%r13
+  c = sbrk(-(sbrk(0) - oldbrk));
+    24bb:	e8 b0 06 00 00       	call   2b70 <sbrk>
+    24c0:	44 89 e7             	mov    %r12d,%edi
+    24c3:	29 c7                	sub    %eax,%edi
+    24c5:	e8 a6 06 00 00       	call   2b70 <sbrk>
+    24ca:	48 89 c1             	mov    %rax,%rcx
+  if(c != a){
+    24cd:	49 39 c5             	cmp    %rax,%r13
+    24d0:	74 31                	je     2503 <sbrktest+0x1fc>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    24d2:	4c 89 ea             	mov    %r13,%rdx
+    24d5:	48 c7 c6 40 43 00 00 	mov    $0x4340,%rsi
+    24dc:	8b 3d a6 28 00 00    	mov    0x28a6(%rip),%edi        # 4d88 <stdout>
+    24e2:	31 c0                	xor    %eax,%eax
+    24e4:	e8 28 07 00 00       	call   2c11 <printf>
+    exit();
+    24e9:	e9 b9 fe ff ff       	jmp    23a7 <sbrktest+0xa0>
+    wait();
+    24ee:	e8 fd 05 00 00       	call   2af0 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    24f3:	48 81 c3 50 c3 00 00 	add    $0xc350,%rbx
+    24fa:	48 81 fb 80 84 1e 80 	cmp    $0xffffffff801e8480,%rbx
+    2501:	74 46                	je     2549 <sbrktest+0x242>
+    ppid = getpid();
+    2503:	e8 60 06 00 00       	call   2b68 <getpid>
+    2508:	41 89 c5             	mov    %eax,%r13d
+    pid = fork();
+    250b:	e8 d0 05 00 00       	call   2ae0 <fork>
+    if(pid < 0){
+    2510:	85 c0                	test   %eax,%eax
+    2512:	79 0c                	jns    2520 <sbrktest+0x219>
+      printf(stdout, "fork failed\n");
+    2514:	48 c7 c6 1b 45 00 00 	mov    $0x451b,%rsi
+    251b:	e9 7a fe ff ff       	jmp    239a <sbrktest+0x93>
+    if(pid == 0){
+    2520:	75 cc                	jne    24ee <sbrktest+0x1e7>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    2522:	0f be 0b             	movsbl (%rbx),%ecx
+    2525:	8b 3d 5d 28 00 00    	mov    0x285d(%rip),%edi        # 4d88 <stdout>
+    252b:	48 89 da             	mov    %rbx,%rdx
+    252e:	31 c0                	xor    %eax,%eax
+    2530:	48 c7 c6 61 43 00 00 	mov    $0x4361,%rsi
+    2537:	e8 d5 06 00 00       	call   2c11 <printf>
+      kill(ppid);
+    253c:	44 89 ef             	mov    %r13d,%edi
+    253f:	e8 d4 05 00 00       	call   2b18 <kill>
+      exit();
+    2544:	e9 5e fe ff ff       	jmp    23a7 <sbrktest+0xa0>
+  if(pipe(fds) != 0){
+    2549:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+    254d:	e8 a6 05 00 00       	call   2af8 <pipe>
+    2552:	85 c0                	test   %eax,%eax
+    2554:	74 11                	je     2567 <sbrktest+0x260>
+    printf(1, "pipe() failed\n");
+    2556:	48 c7 c6 22 33 00 00 	mov    $0x3322,%rsi
+    255d:	bf 01 00 00 00       	mov    $0x1,%edi
+    2562:	e9 39 fe ff ff       	jmp    23a0 <sbrktest+0x99>
+    2567:	48 8d 5d b8          	lea    -0x48(%rbp),%rbx
+    256b:	4c 8d 75 e0          	lea    -0x20(%rbp),%r14
+  if(pipe(fds) != 0){
+    256f:	49 89 dd             	mov    %rbx,%r13
+    if((pids[i] = fork()) == 0){
+    2572:	e8 69 05 00 00       	call   2ae0 <fork>
+    2577:	41 89 45 00          	mov    %eax,0x0(%r13)
+    257b:	85 c0                	test   %eax,%eax
+    257d:	75 33                	jne    25b2 <sbrktest+0x2ab>
+      sbrk(BIG - (uint)(uintp)sbrk(0));
+    257f:	31 ff                	xor    %edi,%edi
+    2581:	e8 ea 05 00 00       	call   2b70 <sbrk>
+    2586:	bf 00 00 40 06       	mov    $0x6400000,%edi
+    258b:	29 c7                	sub    %eax,%edi
+    258d:	e8 de 05 00 00       	call   2b70 <sbrk>
+      write(fds[1], "x", 1);
+    2592:	8b 7d b4             	mov    -0x4c(%rbp),%edi
+    2595:	ba 01 00 00 00       	mov    $0x1,%edx
+    259a:	48 c7 c6 03 3b 00 00 	mov    $0x3b03,%rsi
+    25a1:	e8 62 05 00 00       	call   2b08 <write>
+      for(;;) sleep(1000);
+    25a6:	bf e8 03 00 00       	mov    $0x3e8,%edi
+    25ab:	e8 c8 05 00 00       	call   2b78 <sleep>
+    25b0:	eb f4                	jmp    25a6 <sbrktest+0x29f>
+    if(pids[i] != -1)
+    25b2:	ff c0                	inc    %eax
+    25b4:	74 11                	je     25c7 <sbrktest+0x2c0>
+      read(fds[0], &scratch, 1);
+    25b6:	8b 7d b0             	mov    -0x50(%rbp),%edi
+    25b9:	ba 01 00 00 00       	mov    $0x1,%edx
+    25be:	48 8d 75 af          	lea    -0x51(%rbp),%rsi
+    25c2:	e8 39 05 00 00       	call   2b00 <read>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    25c7:	49 83 c5 04          	add    $0x4,%r13
+    25cb:	4d 39 f5             	cmp    %r14,%r13
+    25ce:	75 a2                	jne    2572 <sbrktest+0x26b>
+  c = sbrk(4096);
+    25d0:	bf 00 10 00 00       	mov    $0x1000,%edi
+    25d5:	e8 96 05 00 00       	call   2b70 <sbrk>
+    25da:	49 89 c5             	mov    %rax,%r13
+    if(pids[i] == -1)
+    25dd:	8b 3b                	mov    (%rbx),%edi
+    25df:	83 ff ff             	cmp    $0xffffffff,%edi
+    25e2:	74 0a                	je     25ee <sbrktest+0x2e7>
+    kill(pids[i]);
+    25e4:	e8 2f 05 00 00       	call   2b18 <kill>
+    wait();
+    25e9:	e8 02 05 00 00       	call   2af0 <wait>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    25ee:	48 83 c3 04          	add    $0x4,%rbx
+    25f2:	4c 39 f3             	cmp    %r14,%rbx
+    25f5:	75 e6                	jne    25dd <sbrktest+0x2d6>
+  if(c == (char*)0xffffffff){
+    25f7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    printf(stdout, "failed sbrk leaked memory\n");
+    25fc:	48 c7 c6 7a 43 00 00 	mov    $0x437a,%rsi
+  if(c == (char*)0xffffffff){
+    2603:	49 39 c5             	cmp    %rax,%r13
+    2606:	0f 84 8e fd ff ff    	je     239a <sbrktest+0x93>
+  if(sbrk(0) > oldbrk)
+    260c:	31 ff                	xor    %edi,%edi
+    260e:	e8 5d 05 00 00       	call   2b70 <sbrk>
+    2613:	49 39 c4             	cmp    %rax,%r12
+    2616:	73 11                	jae    2629 <sbrktest+0x322>
+    sbrk(-(sbrk(0) - oldbrk));
+    2618:	31 ff                	xor    %edi,%edi
+    261a:	e8 51 05 00 00       	call   2b70 <sbrk>
+    261f:	44 89 e7             	mov    %r12d,%edi
+    2622:	29 c7                	sub    %eax,%edi
+    2624:	e8 47 05 00 00       	call   2b70 <sbrk>
+  printf(stdout, "sbrk test OK\n");
+    2629:	8b 3d 59 27 00 00    	mov    0x2759(%rip),%edi        # 4d88 <stdout>
+    262f:	48 c7 c6 95 43 00 00 	mov    $0x4395,%rsi
+    2636:	31 c0                	xor    %eax,%eax
+    2638:	e8 d4 05 00 00       	call   2c11 <printf>
+}
+    263d:	48 83 c4 40          	add    $0x40,%rsp
+    2641:	5b                   	pop    %rbx
+    2642:	41 5c                	pop    %r12
+    2644:	41 5d                	pop    %r13
+    2646:	41 5e                	pop    %r14
+    2648:	5d                   	pop    %rbp
+    2649:	c3                   	ret
+
+000000000000264a <validateint>:
+}
+    264a:	c3                   	ret
+
+000000000000264b <validatetest>:
+{
+    264b:	55                   	push   %rbp
+  printf(stdout, "validate test\n");
+    264c:	8b 3d 36 27 00 00    	mov    0x2736(%rip),%edi        # 4d88 <stdout>
+    2652:	48 c7 c6 a3 43 00 00 	mov    $0x43a3,%rsi
+    2659:	31 c0                	xor    %eax,%eax
+{
+    265b:	48 89 e5             	mov    %rsp,%rbp
+    265e:	41 54                	push   %r12
+    2660:	53                   	push   %rbx
+  printf(stdout, "validate test\n");
+    2661:	31 db                	xor    %ebx,%ebx
+    2663:	e8 a9 05 00 00       	call   2c11 <printf>
+    if((pid = fork()) == 0){
+    2668:	e8 73 04 00 00       	call   2ae0 <fork>
+    266d:	41 89 c4             	mov    %eax,%r12d
+    2670:	85 c0                	test   %eax,%eax
+    2672:	74 42                	je     26b6 <validatetest+0x6b>
+    sleep(0);
+    2674:	31 ff                	xor    %edi,%edi
+    2676:	e8 fd 04 00 00       	call   2b78 <sleep>
+    sleep(0);
+    267b:	31 ff                	xor    %edi,%edi
+    267d:	e8 f6 04 00 00       	call   2b78 <sleep>
+    kill(pid);
+    2682:	44 89 e7             	mov    %r12d,%edi
+    2685:	e8 8e 04 00 00       	call   2b18 <kill>
+    wait();
+    268a:	e8 61 04 00 00       	call   2af0 <wait>
+    if(link("nosuchfile", (char*)(uintp)p) != -1){
+    268f:	48 89 de             	mov    %rbx,%rsi
+    2692:	48 c7 c7 b2 43 00 00 	mov    $0x43b2,%rdi
+    2699:	e8 aa 04 00 00       	call   2b48 <link>
+    269e:	ff c0                	inc    %eax
+    26a0:	74 19                	je     26bb <validatetest+0x70>
+      printf(stdout, "link should not succeed\n");
+    26a2:	8b 3d e0 26 00 00    	mov    0x26e0(%rip),%edi        # 4d88 <stdout>
+    26a8:	48 c7 c6 bd 43 00 00 	mov    $0x43bd,%rsi
+    26af:	31 c0                	xor    %eax,%eax
+    26b1:	e8 5b 05 00 00       	call   2c11 <printf>
+      exit();
+    26b6:	e8 2d 04 00 00       	call   2ae8 <exit>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    26bb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+    26c2:	48 81 fb 00 40 11 00 	cmp    $0x114000,%rbx
+    26c9:	75 9d                	jne    2668 <validatetest+0x1d>
+  printf(stdout, "validate ok\n");
+    26cb:	8b 3d b7 26 00 00    	mov    0x26b7(%rip),%edi        # 4d88 <stdout>
+}
+    26d1:	5b                   	pop    %rbx
+  printf(stdout, "validate ok\n");
+    26d2:	48 c7 c6 d6 43 00 00 	mov    $0x43d6,%rsi
+    26d9:	31 c0                	xor    %eax,%eax
+}
+    26db:	41 5c                	pop    %r12
+    26dd:	5d                   	pop    %rbp
+  printf(stdout, "validate ok\n");
+    26de:	e9 2e 05 00 00       	jmp    2c11 <printf>
+
+00000000000026e3 <bsstest>:
+{
+    26e3:	55                   	push   %rbp
+  printf(stdout, "bss test\n");
+    26e4:	8b 3d 9e 26 00 00    	mov    0x269e(%rip),%edi        # 4d88 <stdout>
+    26ea:	31 c0                	xor    %eax,%eax
+    26ec:	48 c7 c6 e3 43 00 00 	mov    $0x43e3,%rsi
+{
+    26f3:	48 89 e5             	mov    %rsp,%rbp
+  printf(stdout, "bss test\n");
+    26f6:	e8 16 05 00 00       	call   2c11 <printf>
+    26fb:	31 c0                	xor    %eax,%eax
+    if(uninit[i] != '\0'){
+    26fd:	80 b8 e0 4d 00 00 00 	cmpb   $0x0,0x4de0(%rax)
+    2704:	74 19                	je     271f <bsstest+0x3c>
+      printf(stdout, "bss test failed\n");
+    2706:	8b 3d 7c 26 00 00    	mov    0x267c(%rip),%edi        # 4d88 <stdout>
+    270c:	48 c7 c6 ed 43 00 00 	mov    $0x43ed,%rsi
+    2713:	31 c0                	xor    %eax,%eax
+    2715:	e8 f7 04 00 00       	call   2c11 <printf>
+      exit();
+    271a:	e8 c9 03 00 00       	call   2ae8 <exit>
+  for(i = 0; i < sizeof(uninit); i++){
+    271f:	48 ff c0             	inc    %rax
+    2722:	48 3d 10 27 00 00    	cmp    $0x2710,%rax
+    2728:	75 d3                	jne    26fd <bsstest+0x1a>
+  printf(stdout, "bss test ok\n");
+    272a:	8b 3d 58 26 00 00    	mov    0x2658(%rip),%edi        # 4d88 <stdout>
+    2730:	48 c7 c6 fe 43 00 00 	mov    $0x43fe,%rsi
+    2737:	31 c0                	xor    %eax,%eax
+}
+    2739:	5d                   	pop    %rbp
+  printf(stdout, "bss test ok\n");
+    273a:	e9 d2 04 00 00       	jmp    2c11 <printf>
+
+000000000000273f <bigargtest>:
+{
+    273f:	55                   	push   %rbp
+  unlink("bigarg-ok");
+    2740:	48 c7 c7 0b 44 00 00 	mov    $0x440b,%rdi
+{
+    2747:	48 89 e5             	mov    %rsp,%rbp
+  unlink("bigarg-ok");
+    274a:	e8 e9 03 00 00       	call   2b38 <unlink>
+  pid = fork();
+    274f:	e8 8c 03 00 00       	call   2ae0 <fork>
+  if(pid == 0){
+    2754:	85 c0                	test   %eax,%eax
+    2756:	75 75                	jne    27cd <bigargtest+0x8e>
+    2758:	31 c0                	xor    %eax,%eax
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    275a:	48 c7 04 c5 00 95 00 	movq   $0x4415,0x9500(,%rax,8)
+    2761:	00 15 44 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    2766:	48 ff c0             	inc    %rax
+    2769:	48 83 f8 1f          	cmp    $0x1f,%rax
+    276d:	75 eb                	jne    275a <bigargtest+0x1b>
+    args[MAXARG-1] = 0;
+    276f:	31 c0                	xor    %eax,%eax
+    printf(stdout, "bigarg test\n");
+    2771:	8b 3d 11 26 00 00    	mov    0x2611(%rip),%edi        # 4d88 <stdout>
+    2777:	48 c7 c6 f2 44 00 00 	mov    $0x44f2,%rsi
+    args[MAXARG-1] = 0;
+    277e:	48 89 05 73 6e 00 00 	mov    %rax,0x6e73(%rip)        # 95f8 <args.0+0xf8>
+    printf(stdout, "bigarg test\n");
+    2785:	31 c0                	xor    %eax,%eax
+    2787:	e8 85 04 00 00       	call   2c11 <printf>
+    exec("echo", args);
+    278c:	48 c7 c6 00 95 00 00 	mov    $0x9500,%rsi
+    2793:	48 c7 c7 19 30 00 00 	mov    $0x3019,%rdi
+    279a:	e8 81 03 00 00       	call   2b20 <exec>
+    printf(stdout, "bigarg test ok\n");
+    279f:	8b 3d e3 25 00 00    	mov    0x25e3(%rip),%edi        # 4d88 <stdout>
+    27a5:	31 c0                	xor    %eax,%eax
+    27a7:	48 c7 c6 ff 44 00 00 	mov    $0x44ff,%rsi
+    27ae:	e8 5e 04 00 00       	call   2c11 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    27b3:	be 00 02 00 00       	mov    $0x200,%esi
+    27b8:	48 c7 c7 0b 44 00 00 	mov    $0x440b,%rdi
+    27bf:	e8 64 03 00 00       	call   2b28 <open>
+    27c4:	89 c7                	mov    %eax,%edi
+    close(fd);
+    27c6:	e8 45 03 00 00       	call   2b10 <close>
+    exit();
+    27cb:	eb 16                	jmp    27e3 <bigargtest+0xa4>
+  } else if(pid < 0){
+    27cd:	79 19                	jns    27e8 <bigargtest+0xa9>
+    printf(stdout, "bigargtest: fork failed\n");
+    27cf:	48 c7 c6 0f 45 00 00 	mov    $0x450f,%rsi
+    27d6:	8b 3d ac 25 00 00    	mov    0x25ac(%rip),%edi        # 4d88 <stdout>
+    27dc:	31 c0                	xor    %eax,%eax
+    27de:	e8 2e 04 00 00       	call   2c11 <printf>
+    exit();
+    27e3:	e8 00 03 00 00       	call   2ae8 <exit>
+  wait();
+    27e8:	e8 03 03 00 00       	call   2af0 <wait>
+  fd = open("bigarg-ok", 0);
+    27ed:	31 f6                	xor    %esi,%esi
+    27ef:	48 c7 c7 0b 44 00 00 	mov    $0x440b,%rdi
+    27f6:	e8 2d 03 00 00       	call   2b28 <open>
+    printf(stdout, "bigarg test failed!\n");
+    27fb:	48 c7 c6 28 45 00 00 	mov    $0x4528,%rsi
+  fd = open("bigarg-ok", 0);
+    2802:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    2804:	85 c0                	test   %eax,%eax
+    2806:	78 ce                	js     27d6 <bigargtest+0x97>
+  close(fd);
+    2808:	e8 03 03 00 00       	call   2b10 <close>
+  unlink("bigarg-ok");
+    280d:	48 c7 c7 0b 44 00 00 	mov    $0x440b,%rdi
+}
+    2814:	5d                   	pop    %rbp
+  unlink("bigarg-ok");
+    2815:	e9 1e 03 00 00       	jmp    2b38 <unlink>
+
+000000000000281a <fsfull>:
+{
+    281a:	55                   	push   %rbp
+  printf(1, "fsfull test\n");
+    281b:	48 c7 c6 3d 45 00 00 	mov    $0x453d,%rsi
+    2822:	bf 01 00 00 00       	mov    $0x1,%edi
+    2827:	31 c0                	xor    %eax,%eax
+{
+    2829:	48 89 e5             	mov    %rsp,%rbp
+    282c:	41 56                	push   %r14
+    282e:	41 55                	push   %r13
+    2830:	41 54                	push   %r12
+    name[1] = '0' + nfiles / 1000;
+    2832:	41 bc e8 03 00 00    	mov    $0x3e8,%r12d
+{
+    2838:	53                   	push   %rbx
+  for(nfiles = 0; ; nfiles++){
+    2839:	31 db                	xor    %ebx,%ebx
+{
+    283b:	48 83 ec 40          	sub    $0x40,%rsp
+  printf(1, "fsfull test\n");
+    283f:	e8 cd 03 00 00       	call   2c11 <printf>
+    name[1] = '0' + nfiles / 1000;
+    2844:	89 d8                	mov    %ebx,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    2846:	b9 64 00 00 00       	mov    $0x64,%ecx
+    name[0] = 'f';
+    284b:	c6 45 a0 66          	movb   $0x66,-0x60(%rbp)
+    printf(1, "writing %s\n", name);
+    284f:	bf 01 00 00 00       	mov    $0x1,%edi
+    name[1] = '0' + nfiles / 1000;
+    2854:	99                   	cltd
+    name[5] = '\0';
+    2855:	c6 45 a5 00          	movb   $0x0,-0x5b(%rbp)
+    printf(1, "writing %s\n", name);
+    2859:	48 c7 c6 4a 45 00 00 	mov    $0x454a,%rsi
+    name[1] = '0' + nfiles / 1000;
+    2860:	41 f7 fc             	idiv   %r12d
+    2863:	83 c0 30             	add    $0x30,%eax
+    2866:	88 45 a1             	mov    %al,-0x5f(%rbp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    2869:	89 d0                	mov    %edx,%eax
+    286b:	99                   	cltd
+    286c:	f7 f9                	idiv   %ecx
+    286e:	83 c0 30             	add    $0x30,%eax
+    2871:	88 45 a2             	mov    %al,-0x5e(%rbp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    2874:	89 d8                	mov    %ebx,%eax
+    2876:	99                   	cltd
+    2877:	f7 f9                	idiv   %ecx
+    2879:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    287e:	89 d0                	mov    %edx,%eax
+    2880:	99                   	cltd
+    2881:	f7 f9                	idiv   %ecx
+    2883:	83 c0 30             	add    $0x30,%eax
+    2886:	88 45 a3             	mov    %al,-0x5d(%rbp)
+    name[4] = '0' + (nfiles % 10);
+    2889:	89 d8                	mov    %ebx,%eax
+    288b:	99                   	cltd
+    288c:	f7 f9                	idiv   %ecx
+    printf(1, "writing %s\n", name);
+    288e:	31 c0                	xor    %eax,%eax
+    name[4] = '0' + (nfiles % 10);
+    2890:	83 c2 30             	add    $0x30,%edx
+    2893:	88 55 a4             	mov    %dl,-0x5c(%rbp)
+    printf(1, "writing %s\n", name);
+    2896:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    289a:	e8 72 03 00 00       	call   2c11 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    289f:	be 02 02 00 00       	mov    $0x202,%esi
+    28a4:	48 8d 7d a0          	lea    -0x60(%rbp),%rdi
+    28a8:	e8 7b 02 00 00       	call   2b28 <open>
+    28ad:	41 89 c5             	mov    %eax,%r13d
+    if(fd < 0){
+    28b0:	85 c0                	test   %eax,%eax
+    28b2:	79 19                	jns    28cd <fsfull+0xb3>
+      printf(1, "open %s failed\n", name);
+    28b4:	48 8d 55 a0          	lea    -0x60(%rbp),%rdx
+    28b8:	48 c7 c6 56 45 00 00 	mov    $0x4556,%rsi
+    28bf:	bf 01 00 00 00       	mov    $0x1,%edi
+    28c4:	31 c0                	xor    %eax,%eax
+    28c6:	e8 46 03 00 00       	call   2c11 <printf>
+      break;
+    28cb:	eb 4d                	jmp    291a <fsfull+0x100>
+    int total = 0;
+    28cd:	45 31 f6             	xor    %r14d,%r14d
+      int cc = write(fd, buf, 512);
+    28d0:	ba 00 02 00 00       	mov    $0x200,%edx
+    28d5:	48 c7 c6 00 75 00 00 	mov    $0x7500,%rsi
+    28dc:	44 89 ef             	mov    %r13d,%edi
+    28df:	e8 24 02 00 00       	call   2b08 <write>
+      if(cc < 512)
+    28e4:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    28e9:	7e 05                	jle    28f0 <fsfull+0xd6>
+      total += cc;
+    28eb:	41 01 c6             	add    %eax,%r14d
+    while(1){
+    28ee:	eb e0                	jmp    28d0 <fsfull+0xb6>
+    printf(1, "wrote %d bytes\n", total);
+    28f0:	bf 01 00 00 00       	mov    $0x1,%edi
+    28f5:	31 c0                	xor    %eax,%eax
+    28f7:	44 89 f2             	mov    %r14d,%edx
+    28fa:	48 c7 c6 66 45 00 00 	mov    $0x4566,%rsi
+    2901:	e8 0b 03 00 00       	call   2c11 <printf>
+    close(fd);
+    2906:	44 89 ef             	mov    %r13d,%edi
+    2909:	e8 02 02 00 00       	call   2b10 <close>
+    if(total == 0)
+    290e:	45 85 f6             	test   %r14d,%r14d
+    2911:	74 07                	je     291a <fsfull+0x100>
+  for(nfiles = 0; ; nfiles++){
+    2913:	ff c3                	inc    %ebx
+    2915:	e9 2a ff ff ff       	jmp    2844 <fsfull+0x2a>
+    name[1] = '0' + nfiles / 1000;
+    291a:	41 bc e8 03 00 00    	mov    $0x3e8,%r12d
+    2920:	89 d8                	mov    %ebx,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    2922:	b9 64 00 00 00       	mov    $0x64,%ecx
+    name[0] = 'f';
+    2927:	c6 45 a0 66          	movb   $0x66,-0x60(%rbp)
+    unlink(name);
+    292b:	48 8d 7d a0          	lea    -0x60(%rbp),%rdi
+    name[1] = '0' + nfiles / 1000;
+    292f:	99                   	cltd
+    name[5] = '\0';
+    2930:	c6 45 a5 00          	movb   $0x0,-0x5b(%rbp)
+    name[1] = '0' + nfiles / 1000;
+    2934:	41 f7 fc             	idiv   %r12d
+    2937:	83 c0 30             	add    $0x30,%eax
+    293a:	88 45 a1             	mov    %al,-0x5f(%rbp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    293d:	89 d0                	mov    %edx,%eax
+    293f:	99                   	cltd
+    2940:	f7 f9                	idiv   %ecx
+    2942:	83 c0 30             	add    $0x30,%eax
+    2945:	88 45 a2             	mov    %al,-0x5e(%rbp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    2948:	89 d8                	mov    %ebx,%eax
+    294a:	99                   	cltd
+    294b:	f7 f9                	idiv   %ecx
+    294d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    2952:	89 d0                	mov    %edx,%eax
+    2954:	99                   	cltd
+    2955:	f7 f9                	idiv   %ecx
+    2957:	83 c0 30             	add    $0x30,%eax
+    295a:	88 45 a3             	mov    %al,-0x5d(%rbp)
+    name[4] = '0' + (nfiles % 10);
+    295d:	89 d8                	mov    %ebx,%eax
+    295f:	99                   	cltd
+    2960:	f7 f9                	idiv   %ecx
+    2962:	83 c2 30             	add    $0x30,%edx
+    2965:	88 55 a4             	mov    %dl,-0x5c(%rbp)
+    unlink(name);
+    2968:	e8 cb 01 00 00       	call   2b38 <unlink>
+  while(nfiles >= 0){
+    296d:	83 eb 01             	sub    $0x1,%ebx
+    2970:	73 ae                	jae    2920 <fsfull+0x106>
+}
+    2972:	48 83 c4 40          	add    $0x40,%rsp
+  printf(1, "fsfull test finished\n");
+    2976:	48 c7 c6 76 45 00 00 	mov    $0x4576,%rsi
+    297d:	bf 01 00 00 00       	mov    $0x1,%edi
+    2982:	31 c0                	xor    %eax,%eax
+}
+    2984:	5b                   	pop    %rbx
+    2985:	41 5c                	pop    %r12
+    2987:	41 5d                	pop    %r13
+    2989:	41 5e                	pop    %r14
+    298b:	5d                   	pop    %rbp
+  printf(1, "fsfull test finished\n");
+    298c:	e9 80 02 00 00       	jmp    2c11 <printf>
+
+0000000000002991 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    2991:	48 69 05 e4 23 00 00 	imul   $0x19660d,0x23e4(%rip),%rax        # 4d80 <randstate>
+    2998:	0d 66 19 00 
+    299c:	48 05 5f f3 6e 3c    	add    $0x3c6ef35f,%rax
+    29a2:	48 89 05 d7 23 00 00 	mov    %rax,0x23d7(%rip)        # 4d80 <randstate>
+}
+    29a9:	c3                   	ret
+
+00000000000029aa <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    29aa:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    29ad:	31 d2                	xor    %edx,%edx
+    29af:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+    29b2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+    29b5:	48 ff c2             	inc    %rdx
+    29b8:	84 c9                	test   %cl,%cl
+    29ba:	75 f3                	jne    29af <strcpy+0x5>
+    ;
+  return os;
+}
+    29bc:	c3                   	ret
+
+00000000000029bd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+    29bd:	31 c9                	xor    %ecx,%ecx
+    29bf:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+    29c3:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+    29c7:	84 c0                	test   %al,%al
+    29c9:	74 07                	je     29d2 <strcmp+0x15>
+    29cb:	48 ff c1             	inc    %rcx
+    29ce:	38 d0                	cmp    %dl,%al
+    29d0:	74 ed                	je     29bf <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+    29d2:	29 d0                	sub    %edx,%eax
+}
+    29d4:	c3                   	ret
+
+00000000000029d5 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+    29d5:	31 d2                	xor    %edx,%edx
+    29d7:	48 89 d0             	mov    %rdx,%rax
+    29da:	48 ff c2             	inc    %rdx
+    29dd:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+    29e2:	75 f3                	jne    29d7 <strlen+0x2>
+    ;
+  return n;
+}
+    29e4:	c3                   	ret
+
+00000000000029e5 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    29e5:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    29e8:	89 d1                	mov    %edx,%ecx
+    29ea:	89 f0                	mov    %esi,%eax
+    29ec:	fc                   	cld
+    29ed:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+    29ef:	4c 89 c0             	mov    %r8,%rax
+    29f2:	c3                   	ret
+
+00000000000029f3 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    29f3:	48 89 f8             	mov    %rdi,%rax
+    29f6:	8a 10                	mov    (%rax),%dl
+    29f8:	84 d2                	test   %dl,%dl
+    29fa:	74 0a                	je     2a06 <strchr+0x13>
+    if(*s == c)
+    29fc:	40 38 f2             	cmp    %sil,%dl
+    29ff:	74 07                	je     2a08 <strchr+0x15>
+  for(; *s; s++)
+    2a01:	48 ff c0             	inc    %rax
+    2a04:	eb f0                	jmp    29f6 <strchr+0x3>
+      return (char*)s;
+  return 0;
+    2a06:	31 c0                	xor    %eax,%eax
+}
+    2a08:	c3                   	ret
+
+0000000000002a09 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    2a09:	55                   	push   %rbp
+    2a0a:	48 89 e5             	mov    %rsp,%rbp
+    2a0d:	41 56                	push   %r14
+    2a0f:	41 89 f6             	mov    %esi,%r14d
+    2a12:	41 55                	push   %r13
+    2a14:	41 54                	push   %r12
+    2a16:	49 89 fc             	mov    %rdi,%r12
+    2a19:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    2a1a:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+    2a1f:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+    2a23:	41 89 dd             	mov    %ebx,%r13d
+    2a26:	44 39 f3             	cmp    %r14d,%ebx
+    2a29:	7d 29                	jge    2a54 <gets+0x4b>
+    cc = read(0, &c, 1);
+    2a2b:	31 ff                	xor    %edi,%edi
+    2a2d:	ba 01 00 00 00       	mov    $0x1,%edx
+    2a32:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+    2a36:	e8 c5 00 00 00       	call   2b00 <read>
+    if(cc < 1)
+    2a3b:	85 c0                	test   %eax,%eax
+    2a3d:	7e 15                	jle    2a54 <gets+0x4b>
+      break;
+    buf[i++] = c;
+    2a3f:	8a 45 df             	mov    -0x21(%rbp),%al
+    2a42:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+    2a47:	48 ff c3             	inc    %rbx
+    2a4a:	3c 0a                	cmp    $0xa,%al
+    2a4c:	74 0a                	je     2a58 <gets+0x4f>
+    2a4e:	3c 0d                	cmp    $0xd,%al
+    2a50:	75 d1                	jne    2a23 <gets+0x1a>
+    2a52:	eb 04                	jmp    2a58 <gets+0x4f>
+    2a54:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+    2a58:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+    2a5b:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+    2a5e:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+    2a63:	5a                   	pop    %rdx
+    2a64:	59                   	pop    %rcx
+    2a65:	5b                   	pop    %rbx
+    2a66:	41 5c                	pop    %r12
+    2a68:	41 5d                	pop    %r13
+    2a6a:	41 5e                	pop    %r14
+    2a6c:	5d                   	pop    %rbp
+    2a6d:	c3                   	ret
+
+0000000000002a6e <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    2a6e:	55                   	push   %rbp
+    2a6f:	48 89 e5             	mov    %rsp,%rbp
+    2a72:	41 55                	push   %r13
+    2a74:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    2a77:	31 f6                	xor    %esi,%esi
+{
+    2a79:	41 54                	push   %r12
+    2a7b:	41 83 cc ff          	or     $0xffffffff,%r12d
+    2a7f:	53                   	push   %rbx
+    2a80:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+    2a81:	e8 a2 00 00 00       	call   2b28 <open>
+  if(fd < 0)
+    2a86:	85 c0                	test   %eax,%eax
+    2a88:	78 16                	js     2aa0 <stat+0x32>
+    2a8a:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+    2a8c:	89 c7                	mov    %eax,%edi
+    2a8e:	4c 89 ee             	mov    %r13,%rsi
+    2a91:	e8 aa 00 00 00       	call   2b40 <fstat>
+  close(fd);
+    2a96:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+    2a98:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+    2a9b:	e8 70 00 00 00       	call   2b10 <close>
+  return r;
+}
+    2aa0:	5a                   	pop    %rdx
+    2aa1:	44 89 e0             	mov    %r12d,%eax
+    2aa4:	5b                   	pop    %rbx
+    2aa5:	41 5c                	pop    %r12
+    2aa7:	41 5d                	pop    %r13
+    2aa9:	5d                   	pop    %rbp
+    2aaa:	c3                   	ret
+
+0000000000002aab <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+    2aab:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+    2aad:	0f be 17             	movsbl (%rdi),%edx
+    2ab0:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+    2ab3:	80 f9 09             	cmp    $0x9,%cl
+    2ab6:	77 0c                	ja     2ac4 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+    2ab8:	6b c0 0a             	imul   $0xa,%eax,%eax
+    2abb:	48 ff c7             	inc    %rdi
+    2abe:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+    2ac2:	eb e9                	jmp    2aad <atoi+0x2>
+  return n;
+}
+    2ac4:	c3                   	ret
+
+0000000000002ac5 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    2ac5:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    2ac8:	31 c9                	xor    %ecx,%ecx
+    2aca:	89 d7                	mov    %edx,%edi
+    2acc:	29 cf                	sub    %ecx,%edi
+    2ace:	85 ff                	test   %edi,%edi
+    2ad0:	7e 0d                	jle    2adf <memmove+0x1a>
+    *dst++ = *src++;
+    2ad2:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+    2ad6:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+    2ada:	48 ff c1             	inc    %rcx
+    2add:	eb eb                	jmp    2aca <memmove+0x5>
+  return vdst;
+}
+    2adf:	c3                   	ret
+
+0000000000002ae0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    2ae0:	b8 01 00 00 00       	mov    $0x1,%eax
+    2ae5:	cd 40                	int    $0x40
+    2ae7:	c3                   	ret
+
+0000000000002ae8 <exit>:
+SYSCALL(exit)
+    2ae8:	b8 02 00 00 00       	mov    $0x2,%eax
+    2aed:	cd 40                	int    $0x40
+    2aef:	c3                   	ret
+
+0000000000002af0 <wait>:
+SYSCALL(wait)
+    2af0:	b8 03 00 00 00       	mov    $0x3,%eax
+    2af5:	cd 40                	int    $0x40
+    2af7:	c3                   	ret
+
+0000000000002af8 <pipe>:
+SYSCALL(pipe)
+    2af8:	b8 04 00 00 00       	mov    $0x4,%eax
+    2afd:	cd 40                	int    $0x40
+    2aff:	c3                   	ret
+
+0000000000002b00 <read>:
+SYSCALL(read)
+    2b00:	b8 05 00 00 00       	mov    $0x5,%eax
+    2b05:	cd 40                	int    $0x40
+    2b07:	c3                   	ret
+
+0000000000002b08 <write>:
+SYSCALL(write)
+    2b08:	b8 10 00 00 00       	mov    $0x10,%eax
+    2b0d:	cd 40                	int    $0x40
+    2b0f:	c3                   	ret
+
+0000000000002b10 <close>:
+SYSCALL(close)
+    2b10:	b8 15 00 00 00       	mov    $0x15,%eax
+    2b15:	cd 40                	int    $0x40
+    2b17:	c3                   	ret
+
+0000000000002b18 <kill>:
+SYSCALL(kill)
+    2b18:	b8 06 00 00 00       	mov    $0x6,%eax
+    2b1d:	cd 40                	int    $0x40
+    2b1f:	c3                   	ret
+
+0000000000002b20 <exec>:
+SYSCALL(exec)
+    2b20:	b8 07 00 00 00       	mov    $0x7,%eax
+    2b25:	cd 40                	int    $0x40
+    2b27:	c3                   	ret
+
+0000000000002b28 <open>:
+SYSCALL(open)
+    2b28:	b8 0f 00 00 00       	mov    $0xf,%eax
+    2b2d:	cd 40                	int    $0x40
+    2b2f:	c3                   	ret
+
+0000000000002b30 <mknod>:
+SYSCALL(mknod)
+    2b30:	b8 11 00 00 00       	mov    $0x11,%eax
+    2b35:	cd 40                	int    $0x40
+    2b37:	c3                   	ret
+
+0000000000002b38 <unlink>:
+SYSCALL(unlink)
+    2b38:	b8 12 00 00 00       	mov    $0x12,%eax
+    2b3d:	cd 40                	int    $0x40
+    2b3f:	c3                   	ret
+
+0000000000002b40 <fstat>:
+SYSCALL(fstat)
+    2b40:	b8 08 00 00 00       	mov    $0x8,%eax
+    2b45:	cd 40                	int    $0x40
+    2b47:	c3                   	ret
+
+0000000000002b48 <link>:
+SYSCALL(link)
+    2b48:	b8 13 00 00 00       	mov    $0x13,%eax
+    2b4d:	cd 40                	int    $0x40
+    2b4f:	c3                   	ret
+
+0000000000002b50 <mkdir>:
+SYSCALL(mkdir)
+    2b50:	b8 14 00 00 00       	mov    $0x14,%eax
+    2b55:	cd 40                	int    $0x40
+    2b57:	c3                   	ret
+
+0000000000002b58 <chdir>:
+SYSCALL(chdir)
+    2b58:	b8 09 00 00 00       	mov    $0x9,%eax
+    2b5d:	cd 40                	int    $0x40
+    2b5f:	c3                   	ret
+
+0000000000002b60 <dup>:
+SYSCALL(dup)
+    2b60:	b8 0a 00 00 00       	mov    $0xa,%eax
+    2b65:	cd 40                	int    $0x40
+    2b67:	c3                   	ret
+
+0000000000002b68 <getpid>:
+SYSCALL(getpid)
+    2b68:	b8 0b 00 00 00       	mov    $0xb,%eax
+    2b6d:	cd 40                	int    $0x40
+    2b6f:	c3                   	ret
+
+0000000000002b70 <sbrk>:
+SYSCALL(sbrk)
+    2b70:	b8 0c 00 00 00       	mov    $0xc,%eax
+    2b75:	cd 40                	int    $0x40
+    2b77:	c3                   	ret
+
+0000000000002b78 <sleep>:
+SYSCALL(sleep)
+    2b78:	b8 0d 00 00 00       	mov    $0xd,%eax
+    2b7d:	cd 40                	int    $0x40
+    2b7f:	c3                   	ret
+
+0000000000002b80 <uptime>:
+SYSCALL(uptime)
+    2b80:	b8 0e 00 00 00       	mov    $0xe,%eax
+    2b85:	cd 40                	int    $0x40
+    2b87:	c3                   	ret
+
+0000000000002b88 <chmod>:
+SYSCALL(chmod)
+    2b88:	b8 16 00 00 00       	mov    $0x16,%eax
+    2b8d:	cd 40                	int    $0x40
+    2b8f:	c3                   	ret
+
+0000000000002b90 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    2b90:	55                   	push   %rbp
+    2b91:	48 89 e5             	mov    %rsp,%rbp
+    2b94:	41 54                	push   %r12
+    2b96:	41 89 fc             	mov    %edi,%r12d
+    2b99:	89 d7                	mov    %edx,%edi
+    2b9b:	53                   	push   %rbx
+    2b9c:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    2ba0:	85 f6                	test   %esi,%esi
+    2ba2:	79 0f                	jns    2bb3 <printint+0x23>
+    2ba4:	80 e1 01             	and    $0x1,%cl
+    2ba7:	74 0a                	je     2bb3 <printint+0x23>
+    neg = 1;
+    x = -xx;
+    2ba9:	f7 de                	neg    %esi
+    neg = 1;
+    2bab:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+    2bb1:	eb 03                	jmp    2bb6 <printint+0x26>
+  neg = 0;
+    2bb3:	45 31 c0             	xor    %r8d,%r8d
+    2bb6:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+    2bb8:	89 f0                	mov    %esi,%eax
+    2bba:	31 d2                	xor    %edx,%edx
+    2bbc:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+    2bbf:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+    2bc2:	f7 f7                	div    %edi
+    2bc4:	8a 92 f0 45 00 00    	mov    0x45f0(%rdx),%dl
+    2bca:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+    2bce:	89 f2                	mov    %esi,%edx
+    2bd0:	89 c6                	mov    %eax,%esi
+    2bd2:	39 fa                	cmp    %edi,%edx
+    2bd4:	73 e2                	jae    2bb8 <printint+0x28>
+  if(neg)
+    2bd6:	45 85 c0             	test   %r8d,%r8d
+    2bd9:	74 0a                	je     2be5 <printint+0x55>
+    buf[i++] = digits[x % base];
+    2bdb:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+    2bdd:	48 63 c3             	movslq %ebx,%rax
+    2be0:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+    2be5:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+    2be8:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+    2bec:	ba 01 00 00 00       	mov    $0x1,%edx
+    2bf1:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+    2bf5:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+    2bf8:	48 ff cb             	dec    %rbx
+    2bfb:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+    2bfe:	e8 05 ff ff ff       	call   2b08 <write>
+  while(--i >= 0)
+    2c03:	83 fb ff             	cmp    $0xffffffff,%ebx
+    2c06:	75 e0                	jne    2be8 <printint+0x58>
+}
+    2c08:	48 83 c4 20          	add    $0x20,%rsp
+    2c0c:	5b                   	pop    %rbx
+    2c0d:	41 5c                	pop    %r12
+    2c0f:	5d                   	pop    %rbp
+    2c10:	c3                   	ret
+
+0000000000002c11 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    2c11:	55                   	push   %rbp
+    2c12:	48 89 e5             	mov    %rsp,%rbp
+    2c15:	41 55                	push   %r13
+    2c17:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+    2c19:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+    2c1d:	53                   	push   %rbx
+    2c1e:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+    2c22:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    2c26:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+    2c2a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    2c2e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+    2c32:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+    2c36:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+    2c3a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+    2c3e:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+    2c40:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+    2c47:	84 c0                	test   %al,%al
+    2c49:	0f 84 6f 01 00 00    	je     2dbe <printf+0x1ad>
+    2c4f:	89 fb                	mov    %edi,%ebx
+    2c51:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+    2c54:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+    2c57:	83 fa 25             	cmp    $0x25,%edx
+    2c5a:	75 44                	jne    2ca0 <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+    2c5c:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+    2c61:	49 ff c4             	inc    %r12
+    2c64:	45 84 ed             	test   %r13b,%r13b
+    2c67:	0f 84 51 01 00 00    	je     2dbe <printf+0x1ad>
+    c = fmt[i] & 0xff;
+    2c6d:	41 0f b6 c5          	movzbl %r13b,%eax
+    2c71:	41 0f be d5          	movsbl %r13b,%edx
+    2c75:	83 f8 64             	cmp    $0x64,%eax
+    2c78:	74 7c                	je     2cf6 <printf+0xe5>
+    2c7a:	7f 29                	jg     2ca5 <printf+0x94>
+    2c7c:	83 f8 25             	cmp    $0x25,%eax
+    2c7f:	74 4c                	je     2ccd <printf+0xbc>
+    2c81:	83 f8 63             	cmp    $0x63,%eax
+    2c84:	75 33                	jne    2cb9 <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+    2c86:	8b 55 98             	mov    -0x68(%rbp),%edx
+    2c89:	83 fa 2f             	cmp    $0x2f,%edx
+    2c8c:	0f 87 1b 01 00 00    	ja     2dad <printf+0x19c>
+    2c92:	89 d0                	mov    %edx,%eax
+    2c94:	83 c2 08             	add    $0x8,%edx
+    2c97:	48 03 45 a8          	add    -0x58(%rbp),%rax
+    2c9b:	89 55 98             	mov    %edx,-0x68(%rbp)
+    2c9e:	8b 00                	mov    (%rax),%eax
+    2ca0:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+    2ca3:	eb 2c                	jmp    2cd1 <printf+0xc0>
+    2ca5:	83 f8 73             	cmp    $0x73,%eax
+    2ca8:	0f 84 aa 00 00 00    	je     2d58 <printf+0x147>
+    2cae:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+    2cb4:	83 fa 70             	cmp    $0x70,%edx
+    2cb7:	74 6b                	je     2d24 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    2cb9:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+    2cbd:	ba 01 00 00 00       	mov    $0x1,%edx
+    2cc2:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+    2cc6:	89 df                	mov    %ebx,%edi
+    2cc8:	e8 3b fe ff ff       	call   2b08 <write>
+        putc(fd, c);
+    2ccd:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+    2cd1:	ba 01 00 00 00       	mov    $0x1,%edx
+    2cd6:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+    2cda:	89 df                	mov    %ebx,%edi
+    2cdc:	e8 27 fe ff ff       	call   2b08 <write>
+  for(i = 0; fmt[i]; i++){
+    2ce1:	41 8a 44 24 01       	mov    0x1(%r12),%al
+    2ce6:	49 ff c4             	inc    %r12
+    2ce9:	84 c0                	test   %al,%al
+    2ceb:	0f 85 63 ff ff ff    	jne    2c54 <printf+0x43>
+    2cf1:	e9 c8 00 00 00       	jmp    2dbe <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+    2cf6:	8b 55 98             	mov    -0x68(%rbp),%edx
+    2cf9:	83 fa 2f             	cmp    $0x2f,%edx
+    2cfc:	77 0e                	ja     2d0c <printf+0xfb>
+    2cfe:	89 d0                	mov    %edx,%eax
+    2d00:	83 c2 08             	add    $0x8,%edx
+    2d03:	48 03 45 a8          	add    -0x58(%rbp),%rax
+    2d07:	89 55 98             	mov    %edx,-0x68(%rbp)
+    2d0a:	eb 0c                	jmp    2d18 <printf+0x107>
+    2d0c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    2d10:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2d14:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+    2d18:	b9 01 00 00 00       	mov    $0x1,%ecx
+    2d1d:	ba 0a 00 00 00       	mov    $0xa,%edx
+    2d22:	eb 29                	jmp    2d4d <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+    2d24:	8b 55 98             	mov    -0x68(%rbp),%edx
+    2d27:	83 fa 2f             	cmp    $0x2f,%edx
+    2d2a:	77 0e                	ja     2d3a <printf+0x129>
+    2d2c:	89 d0                	mov    %edx,%eax
+    2d2e:	83 c2 08             	add    $0x8,%edx
+    2d31:	48 03 45 a8          	add    -0x58(%rbp),%rax
+    2d35:	89 55 98             	mov    %edx,-0x68(%rbp)
+    2d38:	eb 0c                	jmp    2d46 <printf+0x135>
+    2d3a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    2d3e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2d42:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+    2d46:	31 c9                	xor    %ecx,%ecx
+    2d48:	ba 10 00 00 00       	mov    $0x10,%edx
+    2d4d:	8b 30                	mov    (%rax),%esi
+    2d4f:	89 df                	mov    %ebx,%edi
+    2d51:	e8 3a fe ff ff       	call   2b90 <printint>
+    2d56:	eb 89                	jmp    2ce1 <printf+0xd0>
+        s = va_arg(ap, char*);
+    2d58:	8b 55 98             	mov    -0x68(%rbp),%edx
+    2d5b:	83 fa 2f             	cmp    $0x2f,%edx
+    2d5e:	77 0e                	ja     2d6e <printf+0x15d>
+    2d60:	89 d0                	mov    %edx,%eax
+    2d62:	83 c2 08             	add    $0x8,%edx
+    2d65:	48 03 45 a8          	add    -0x58(%rbp),%rax
+    2d69:	89 55 98             	mov    %edx,-0x68(%rbp)
+    2d6c:	eb 0c                	jmp    2d7a <printf+0x169>
+    2d6e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    2d72:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2d76:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+    2d7a:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+    2d7d:	4d 85 ed             	test   %r13,%r13
+    2d80:	75 07                	jne    2d89 <printf+0x178>
+          s = "(null)";
+    2d82:	49 c7 c5 e9 45 00 00 	mov    $0x45e9,%r13
+        while(*s != 0){
+    2d89:	41 8a 45 00          	mov    0x0(%r13),%al
+    2d8d:	84 c0                	test   %al,%al
+    2d8f:	0f 84 4c ff ff ff    	je     2ce1 <printf+0xd0>
+          putc(fd, *s);
+    2d95:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+    2d98:	ba 01 00 00 00       	mov    $0x1,%edx
+    2d9d:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+    2da1:	89 df                	mov    %ebx,%edi
+          s++;
+    2da3:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+    2da6:	e8 5d fd ff ff       	call   2b08 <write>
+          s++;
+    2dab:	eb dc                	jmp    2d89 <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+    2dad:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+    2db1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+    2db5:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+    2db9:	e9 e0 fe ff ff       	jmp    2c9e <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+    2dbe:	48 83 c4 58          	add    $0x58,%rsp
+    2dc2:	5b                   	pop    %rbx
+    2dc3:	41 5c                	pop    %r12
+    2dc5:	41 5d                	pop    %r13
+    2dc7:	5d                   	pop    %rbp
+    2dc8:	c3                   	ret
+
+0000000000002dc9 <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2dc9:	48 8b 05 30 68 00 00 	mov    0x6830(%rip),%rax        # 9600 <freep>
+{
+    2dd0:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+    2dd3:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2dd7:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2dda:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2ddd:	48 39 f2             	cmp    %rsi,%rdx
+    2de0:	72 0c                	jb     2dee <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    2de2:	48 39 c6             	cmp    %rax,%rsi
+    2de5:	73 f0                	jae    2dd7 <free+0xe>
+    2de7:	48 39 c2             	cmp    %rax,%rdx
+    2dea:	72 eb                	jb     2dd7 <free+0xe>
+    2dec:	eb 05                	jmp    2df3 <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    2dee:	48 39 c6             	cmp    %rax,%rsi
+    2df1:	73 f4                	jae    2de7 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2df3:	8b 79 f8             	mov    -0x8(%rcx),%edi
+    2df6:	49 89 f8             	mov    %rdi,%r8
+    2df9:	48 c1 e7 04          	shl    $0x4,%rdi
+    2dfd:	48 01 f7             	add    %rsi,%rdi
+    2e00:	48 39 f8             	cmp    %rdi,%rax
+    2e03:	75 0e                	jne    2e13 <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+    2e05:	44 03 40 08          	add    0x8(%rax),%r8d
+    2e09:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2e0d:	48 8b 02             	mov    (%rdx),%rax
+    2e10:	48 8b 00             	mov    (%rax),%rax
+    2e13:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    2e17:	8b 42 08             	mov    0x8(%rdx),%eax
+    2e1a:	48 89 c7             	mov    %rax,%rdi
+    2e1d:	48 c1 e0 04          	shl    $0x4,%rax
+    2e21:	48 01 d0             	add    %rdx,%rax
+    2e24:	48 39 c6             	cmp    %rax,%rsi
+    2e27:	75 0a                	jne    2e33 <free+0x6a>
+    p->s.size += bp->s.size;
+    2e29:	03 79 f8             	add    -0x8(%rcx),%edi
+    2e2c:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+    2e2f:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+    2e33:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+    2e36:	48 89 15 c3 67 00 00 	mov    %rdx,0x67c3(%rip)        # 9600 <freep>
+}
+    2e3d:	c3                   	ret
+
+0000000000002e3e <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    2e3e:	55                   	push   %rbp
+    2e3f:	48 89 e5             	mov    %rsp,%rbp
+    2e42:	41 55                	push   %r13
+    2e44:	41 54                	push   %r12
+    2e46:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2e47:	89 fb                	mov    %edi,%ebx
+{
+    2e49:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2e4a:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+    2e4e:	48 8b 0d ab 67 00 00 	mov    0x67ab(%rip),%rcx        # 9600 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    2e55:	48 c1 eb 04          	shr    $0x4,%rbx
+    2e59:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+    2e5b:	48 85 c9             	test   %rcx,%rcx
+    2e5e:	75 25                	jne    2e85 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+    2e60:	48 c7 05 95 67 00 00 	movq   $0x9610,0x6795(%rip)        # 9600 <freep>
+    2e67:	10 96 00 00 
+    base.s.size = 0;
+    2e6b:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+    2e6d:	48 c7 05 98 67 00 00 	movq   $0x9610,0x6798(%rip)        # 9610 <base>
+    2e74:	10 96 00 00 
+    base.s.size = 0;
+    2e78:	89 0d 9a 67 00 00    	mov    %ecx,0x679a(%rip)        # 9618 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+    2e7e:	48 c7 c1 10 96 00 00 	mov    $0x9610,%rcx
+  if(nu < 4096)
+    2e85:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2e8b:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+    2e8e:	44 39 e3             	cmp    %r12d,%ebx
+    2e91:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+    2e95:	45 89 e5             	mov    %r12d,%r13d
+    2e98:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+    2e9c:	8b 50 08             	mov    0x8(%rax),%edx
+    2e9f:	39 da                	cmp    %ebx,%edx
+    2ea1:	72 26                	jb     2ec9 <malloc+0x8b>
+      if(p->s.size == nunits)
+    2ea3:	75 08                	jne    2ead <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+    2ea5:	48 8b 10             	mov    (%rax),%rdx
+    2ea8:	48 89 11             	mov    %rdx,(%rcx)
+    2eab:	eb 0f                	jmp    2ebc <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+    2ead:	29 da                	sub    %ebx,%edx
+    2eaf:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+    2eb2:	48 c1 e2 04          	shl    $0x4,%rdx
+    2eb6:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+    2eb9:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+    2ebc:	48 89 0d 3d 67 00 00 	mov    %rcx,0x673d(%rip)        # 9600 <freep>
+      return (void*)(p + 1);
+    2ec3:	48 83 c0 10          	add    $0x10,%rax
+    2ec7:	eb 3a                	jmp    2f03 <malloc+0xc5>
+    }
+    if(p == freep)
+    2ec9:	48 39 05 30 67 00 00 	cmp    %rax,0x6730(%rip)        # 9600 <freep>
+    2ed0:	75 27                	jne    2ef9 <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+    2ed2:	44 89 ef             	mov    %r13d,%edi
+    2ed5:	e8 96 fc ff ff       	call   2b70 <sbrk>
+  if(p == (char*)-1)
+    2eda:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+    2ede:	74 21                	je     2f01 <malloc+0xc3>
+  hp->s.size = nu;
+    2ee0:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+    2ee4:	48 8d 78 10          	lea    0x10(%rax),%rdi
+    2ee8:	e8 dc fe ff ff       	call   2dc9 <free>
+  return freep;
+    2eed:	48 8b 05 0c 67 00 00 	mov    0x670c(%rip),%rax        # 9600 <freep>
+      if((p = morecore(nunits)) == 0)
+    2ef4:	48 85 c0             	test   %rax,%rax
+    2ef7:	74 08                	je     2f01 <malloc+0xc3>
+    if(p->s.size >= nunits){
+    2ef9:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2efc:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+    2eff:	eb 9b                	jmp    2e9c <malloc+0x5e>
+        return 0;
+    2f01:	31 c0                	xor    %eax,%eax
+  }
+}
+    2f03:	5a                   	pop    %rdx
+    2f04:	5b                   	pop    %rbx
+    2f05:	41 5c                	pop    %r12
+    2f07:	41 5d                	pop    %r13
+    2f09:	5d                   	pop    %rbp
+    2f0a:	c3                   	ret
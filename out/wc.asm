@@ -0,0 +1,1017 @@
+
+.fs/wc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+   4:	41 55                	push   %r13
+   6:	41 54                	push   %r12
+   8:	53                   	push   %rbx
+   9:	50                   	push   %rax
+  int fd, i;
+
+  if(argc <= 1){
+   a:	83 ff 01             	cmp    $0x1,%edi
+   d:	7f 10                	jg     1f <main+0x1f>
+    wc(0, "");
+   f:	48 c7 c6 c5 06 00 00 	mov    $0x6c5,%rsi
+  16:	31 ff                	xor    %edi,%edi
+  18:	e8 57 00 00 00       	call   74 <wc>
+    exit();
+  1d:	eb 33                	jmp    52 <main+0x52>
+  1f:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  22:	48 8d 5e 08          	lea    0x8(%rsi),%rbx
+  26:	4c 8d 6c c6 10       	lea    0x10(%rsi,%rax,8),%r13
+  }
+
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+  2b:	48 8b 3b             	mov    (%rbx),%rdi
+  2e:	31 f6                	xor    %esi,%esi
+  30:	e8 8d 02 00 00       	call   2c2 <open>
+  35:	41 89 c4             	mov    %eax,%r12d
+  38:	85 c0                	test   %eax,%eax
+  3a:	79 1b                	jns    57 <main+0x57>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  3c:	48 8b 13             	mov    (%rbx),%rdx
+  3f:	48 c7 c6 d3 06 00 00 	mov    $0x6d3,%rsi
+  46:	bf 01 00 00 00       	mov    $0x1,%edi
+  4b:	31 c0                	xor    %eax,%eax
+  4d:	e8 59 03 00 00       	call   3ab <printf>
+      exit();
+  52:	e8 2b 02 00 00       	call   282 <exit>
+    }
+    wc(fd, argv[i]);
+  57:	48 8b 33             	mov    (%rbx),%rsi
+  5a:	89 c7                	mov    %eax,%edi
+  for(i = 1; i < argc; i++){
+  5c:	48 83 c3 08          	add    $0x8,%rbx
+    wc(fd, argv[i]);
+  60:	e8 0f 00 00 00       	call   74 <wc>
+    close(fd);
+  65:	44 89 e7             	mov    %r12d,%edi
+  68:	e8 3d 02 00 00       	call   2aa <close>
+  for(i = 1; i < argc; i++){
+  6d:	4c 39 eb             	cmp    %r13,%rbx
+  70:	75 b9                	jne    2b <main+0x2b>
+  72:	eb de                	jmp    52 <main+0x52>
+
+0000000000000074 <wc>:
+{
+  74:	55                   	push   %rbp
+  75:	48 89 e5             	mov    %rsp,%rbp
+  78:	41 57                	push   %r15
+  inword = 0;
+  7a:	45 31 ff             	xor    %r15d,%r15d
+{
+  7d:	41 56                	push   %r14
+  l = w = c = 0;
+  7f:	45 31 f6             	xor    %r14d,%r14d
+{
+  82:	41 55                	push   %r13
+  l = w = c = 0;
+  84:	45 31 ed             	xor    %r13d,%r13d
+{
+  87:	41 54                	push   %r12
+  l = w = c = 0;
+  89:	45 31 e4             	xor    %r12d,%r12d
+{
+  8c:	53                   	push   %rbx
+  8d:	48 83 ec 28          	sub    $0x28,%rsp
+  91:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  94:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  98:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  9b:	ba 00 02 00 00       	mov    $0x200,%edx
+  a0:	48 c7 c6 20 09 00 00 	mov    $0x920,%rsi
+  a7:	e8 ee 01 00 00       	call   29a <read>
+  ac:	89 c3                	mov    %eax,%ebx
+  ae:	85 c0                	test   %eax,%eax
+  b0:	7e 4a                	jle    fc <wc+0x88>
+  b2:	31 d2                	xor    %edx,%edx
+      if(buf[i] == '\n')
+  b4:	0f be b2 20 09 00 00 	movsbl 0x920(%rdx),%esi
+  bb:	40 80 fe 0a          	cmp    $0xa,%sil
+  bf:	75 03                	jne    c4 <wc+0x50>
+        l++;
+  c1:	41 ff c4             	inc    %r12d
+      if(strchr(" \r\t\n\v", buf[i]))
+  c4:	48 c7 c7 b0 06 00 00 	mov    $0x6b0,%rdi
+  cb:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  cf:	e8 b9 00 00 00       	call   18d <strchr>
+  d4:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  d8:	48 85 c0             	test   %rax,%rax
+  db:	75 10                	jne    ed <wc+0x79>
+      else if(!inword){
+  dd:	45 85 ff             	test   %r15d,%r15d
+  e0:	75 0e                	jne    f0 <wc+0x7c>
+        w++;
+  e2:	41 ff c5             	inc    %r13d
+        inword = 1;
+  e5:	41 bf 01 00 00 00    	mov    $0x1,%r15d
+  eb:	eb 03                	jmp    f0 <wc+0x7c>
+        inword = 0;
+  ed:	45 31 ff             	xor    %r15d,%r15d
+    for(i=0; i<n; i++){
+  f0:	48 ff c2             	inc    %rdx
+  f3:	39 d3                	cmp    %edx,%ebx
+  f5:	7f bd                	jg     b4 <wc+0x40>
+      c++;
+  f7:	41 01 de             	add    %ebx,%r14d
+  fa:	eb 9c                	jmp    98 <wc+0x24>
+  if(n < 0){
+  fc:	74 18                	je     116 <wc+0xa2>
+    printf(1, "wc: read error\n");
+  fe:	48 c7 c6 b6 06 00 00 	mov    $0x6b6,%rsi
+ 105:	bf 01 00 00 00       	mov    $0x1,%edi
+ 10a:	31 c0                	xor    %eax,%eax
+ 10c:	e8 9a 02 00 00       	call   3ab <printf>
+    exit();
+ 111:	e8 6c 01 00 00       	call   282 <exit>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 116:	4c 8b 4d c0          	mov    -0x40(%rbp),%r9
+}
+ 11a:	48 83 c4 28          	add    $0x28,%rsp
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 11e:	45 89 f0             	mov    %r14d,%r8d
+ 121:	44 89 e9             	mov    %r13d,%ecx
+}
+ 124:	5b                   	pop    %rbx
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 125:	44 89 e2             	mov    %r12d,%edx
+ 128:	48 c7 c6 c6 06 00 00 	mov    $0x6c6,%rsi
+}
+ 12f:	41 5c                	pop    %r12
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 131:	bf 01 00 00 00       	mov    $0x1,%edi
+}
+ 136:	41 5d                	pop    %r13
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 138:	31 c0                	xor    %eax,%eax
+}
+ 13a:	41 5e                	pop    %r14
+ 13c:	41 5f                	pop    %r15
+ 13e:	5d                   	pop    %rbp
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 13f:	e9 67 02 00 00       	jmp    3ab <printf>
+
+0000000000000144 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 144:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 147:	31 d2                	xor    %edx,%edx
+ 149:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+ 14c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+ 14f:	48 ff c2             	inc    %rdx
+ 152:	84 c9                	test   %cl,%cl
+ 154:	75 f3                	jne    149 <strcpy+0x5>
+    ;
+  return os;
+}
+ 156:	c3                   	ret
+
+0000000000000157 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+ 157:	31 c9                	xor    %ecx,%ecx
+ 159:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+ 15d:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+ 161:	84 c0                	test   %al,%al
+ 163:	74 07                	je     16c <strcmp+0x15>
+ 165:	48 ff c1             	inc    %rcx
+ 168:	38 d0                	cmp    %dl,%al
+ 16a:	74 ed                	je     159 <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+ 16c:	29 d0                	sub    %edx,%eax
+}
+ 16e:	c3                   	ret
+
+000000000000016f <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 16f:	31 d2                	xor    %edx,%edx
+ 171:	48 89 d0             	mov    %rdx,%rax
+ 174:	48 ff c2             	inc    %rdx
+ 177:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+ 17c:	75 f3                	jne    171 <strlen+0x2>
+    ;
+  return n;
+}
+ 17e:	c3                   	ret
+
+000000000000017f <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 17f:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 182:	89 d1                	mov    %edx,%ecx
+ 184:	89 f0                	mov    %esi,%eax
+ 186:	fc                   	cld
+ 187:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 189:	4c 89 c0             	mov    %r8,%rax
+ 18c:	c3                   	ret
+
+000000000000018d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+ 18d:	48 89 f8             	mov    %rdi,%rax
+ 190:	8a 10                	mov    (%rax),%dl
+ 192:	84 d2                	test   %dl,%dl
+ 194:	74 0a                	je     1a0 <strchr+0x13>
+    if(*s == c)
+ 196:	40 38 f2             	cmp    %sil,%dl
+ 199:	74 07                	je     1a2 <strchr+0x15>
+  for(; *s; s++)
+ 19b:	48 ff c0             	inc    %rax
+ 19e:	eb f0                	jmp    190 <strchr+0x3>
+      return (char*)s;
+  return 0;
+ 1a0:	31 c0                	xor    %eax,%eax
+}
+ 1a2:	c3                   	ret
+
+00000000000001a3 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a3:	55                   	push   %rbp
+ 1a4:	48 89 e5             	mov    %rsp,%rbp
+ 1a7:	41 56                	push   %r14
+ 1a9:	41 89 f6             	mov    %esi,%r14d
+ 1ac:	41 55                	push   %r13
+ 1ae:	41 54                	push   %r12
+ 1b0:	49 89 fc             	mov    %rdi,%r12
+ 1b3:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1b4:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+ 1b9:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+ 1bd:	41 89 dd             	mov    %ebx,%r13d
+ 1c0:	44 39 f3             	cmp    %r14d,%ebx
+ 1c3:	7d 29                	jge    1ee <gets+0x4b>
+    cc = read(0, &c, 1);
+ 1c5:	31 ff                	xor    %edi,%edi
+ 1c7:	ba 01 00 00 00       	mov    $0x1,%edx
+ 1cc:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 1d0:	e8 c5 00 00 00       	call   29a <read>
+    if(cc < 1)
+ 1d5:	85 c0                	test   %eax,%eax
+ 1d7:	7e 15                	jle    1ee <gets+0x4b>
+      break;
+    buf[i++] = c;
+ 1d9:	8a 45 df             	mov    -0x21(%rbp),%al
+ 1dc:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+ 1e1:	48 ff c3             	inc    %rbx
+ 1e4:	3c 0a                	cmp    $0xa,%al
+ 1e6:	74 0a                	je     1f2 <gets+0x4f>
+ 1e8:	3c 0d                	cmp    $0xd,%al
+ 1ea:	75 d1                	jne    1bd <gets+0x1a>
+ 1ec:	eb 04                	jmp    1f2 <gets+0x4f>
+ 1ee:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+ 1f2:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+ 1f5:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+ 1f8:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+ 1fd:	5a                   	pop    %rdx
+ 1fe:	59                   	pop    %rcx
+ 1ff:	5b                   	pop    %rbx
+ 200:	41 5c                	pop    %r12
+ 202:	41 5d                	pop    %r13
+ 204:	41 5e                	pop    %r14
+ 206:	5d                   	pop    %rbp
+ 207:	c3                   	ret
+
+0000000000000208 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 208:	55                   	push   %rbp
+ 209:	48 89 e5             	mov    %rsp,%rbp
+ 20c:	41 55                	push   %r13
+ 20e:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 211:	31 f6                	xor    %esi,%esi
+{
+ 213:	41 54                	push   %r12
+ 215:	41 83 cc ff          	or     $0xffffffff,%r12d
+ 219:	53                   	push   %rbx
+ 21a:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+ 21b:	e8 a2 00 00 00       	call   2c2 <open>
+  if(fd < 0)
+ 220:	85 c0                	test   %eax,%eax
+ 222:	78 16                	js     23a <stat+0x32>
+ 224:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+ 226:	89 c7                	mov    %eax,%edi
+ 228:	4c 89 ee             	mov    %r13,%rsi
+ 22b:	e8 aa 00 00 00       	call   2da <fstat>
+  close(fd);
+ 230:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 232:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 235:	e8 70 00 00 00       	call   2aa <close>
+  return r;
+}
+ 23a:	5a                   	pop    %rdx
+ 23b:	44 89 e0             	mov    %r12d,%eax
+ 23e:	5b                   	pop    %rbx
+ 23f:	41 5c                	pop    %r12
+ 241:	41 5d                	pop    %r13
+ 243:	5d                   	pop    %rbp
+ 244:	c3                   	ret
+
+0000000000000245 <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 245:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 17             	movsbl (%rdi),%edx
+ 24a:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+ 250:	77 0c                	ja     25e <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 252:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 255:	48 ff c7             	inc    %rdi
+ 258:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 25c:	eb e9                	jmp    247 <atoi+0x2>
+  return n;
+}
+ 25e:	c3                   	ret
+
+000000000000025f <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 25f:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 262:	31 c9                	xor    %ecx,%ecx
+ 264:	89 d7                	mov    %edx,%edi
+ 266:	29 cf                	sub    %ecx,%edi
+ 268:	85 ff                	test   %edi,%edi
+ 26a:	7e 0d                	jle    279 <memmove+0x1a>
+    *dst++ = *src++;
+ 26c:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 270:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 274:	48 ff c1             	inc    %rcx
+ 277:	eb eb                	jmp    264 <memmove+0x5>
+  return vdst;
+}
+ 279:	c3                   	ret
+
+000000000000027a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 27a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 27f:	cd 40                	int    $0x40
+ 281:	c3                   	ret
+
+0000000000000282 <exit>:
+SYSCALL(exit)
+ 282:	b8 02 00 00 00       	mov    $0x2,%eax
+ 287:	cd 40                	int    $0x40
+ 289:	c3                   	ret
+
+000000000000028a <wait>:
+SYSCALL(wait)
+ 28a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 28f:	cd 40                	int    $0x40
+ 291:	c3                   	ret
+
+0000000000000292 <pipe>:
+SYSCALL(pipe)
+ 292:	b8 04 00 00 00       	mov    $0x4,%eax
+ 297:	cd 40                	int    $0x40
+ 299:	c3                   	ret
+
+000000000000029a <read>:
+SYSCALL(read)
+ 29a:	b8 05 00 00 00       	mov    $0x5,%eax
+ 29f:	cd 40                	int    $0x40
+ 2a1:	c3                   	ret
+
+00000000000002a2 <write>:
+SYSCALL(write)
+ 2a2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2a7:	cd 40                	int    $0x40
+ 2a9:	c3                   	ret
+
+00000000000002aa <close>:
+SYSCALL(close)
+ 2aa:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2af:	cd 40                	int    $0x40
+ 2b1:	c3                   	ret
+
+00000000000002b2 <kill>:
+SYSCALL(kill)
+ 2b2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2b7:	cd 40                	int    $0x40
+ 2b9:	c3                   	ret
+
+00000000000002ba <exec>:
+SYSCALL(exec)
+ 2ba:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2bf:	cd 40                	int    $0x40
+ 2c1:	c3                   	ret
+
+00000000000002c2 <open>:
+SYSCALL(open)
+ 2c2:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 2c7:	cd 40                	int    $0x40
+ 2c9:	c3                   	ret
+
+00000000000002ca <mknod>:
+SYSCALL(mknod)
+ 2ca:	b8 11 00 00 00       	mov    $0x11,%eax
+ 2cf:	cd 40                	int    $0x40
+ 2d1:	c3                   	ret
+
+00000000000002d2 <unlink>:
+SYSCALL(unlink)
+ 2d2:	b8 12 00 00 00       	mov    $0x12,%eax
+ 2d7:	cd 40                	int    $0x40
+ 2d9:	c3                   	ret
+
+00000000000002da <fstat>:
+SYSCALL(fstat)
+ 2da:	b8 08 00 00 00       	mov    $0x8,%eax
+ 2df:	cd 40                	int    $0x40
+ 2e1:	c3                   	ret
+
+00000000000002e2 <link>:
+SYSCALL(link)
+ 2e2:	b8 13 00 00 00       	mov    $0x13,%eax
+ 2e7:	cd 40                	int    $0x40
+ 2e9:	c3                   	ret
+
+00000000000002ea <mkdir>:
+SYSCALL(mkdir)
+ 2ea:	b8 14 00 00 00       	mov    $0x14,%eax
+ 2ef:	cd 40                	int    $0x40
+ 2f1:	c3                   	ret
+
+00000000000002f2 <chdir>:
+SYSCALL(chdir)
+ 2f2:	b8 09 00 00 00       	mov    $0x9,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+00000000000002fa <dup>:
+SYSCALL(dup)
+ 2fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+0000000000000302 <getpid>:
+SYSCALL(getpid)
+ 302:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+000000000000030a <sbrk>:
+SYSCALL(sbrk)
+ 30a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+0000000000000312 <sleep>:
+SYSCALL(sleep)
+ 312:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+000000000000031a <uptime>:
+SYSCALL(uptime)
+ 31a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+0000000000000322 <chmod>:
+SYSCALL(chmod)
+ 322:	b8 16 00 00 00       	mov    $0x16,%eax
+ 327:	cd 40                	int    $0x40
+ 329:	c3                   	ret
+
+000000000000032a <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 32a:	55                   	push   %rbp
+ 32b:	48 89 e5             	mov    %rsp,%rbp
+ 32e:	41 54                	push   %r12
+ 330:	41 89 fc             	mov    %edi,%r12d
+ 333:	89 d7                	mov    %edx,%edi
+ 335:	53                   	push   %rbx
+ 336:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 33a:	85 f6                	test   %esi,%esi
+ 33c:	79 0f                	jns    34d <printint+0x23>
+ 33e:	80 e1 01             	and    $0x1,%cl
+ 341:	74 0a                	je     34d <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 343:	f7 de                	neg    %esi
+    neg = 1;
+ 345:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 34b:	eb 03                	jmp    350 <printint+0x26>
+  neg = 0;
+ 34d:	45 31 c0             	xor    %r8d,%r8d
+ 350:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 352:	89 f0                	mov    %esi,%eax
+ 354:	31 d2                	xor    %edx,%edx
+ 356:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 359:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 35c:	f7 f7                	div    %edi
+ 35e:	8a 92 f0 06 00 00    	mov    0x6f0(%rdx),%dl
+ 364:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 368:	89 f2                	mov    %esi,%edx
+ 36a:	89 c6                	mov    %eax,%esi
+ 36c:	39 fa                	cmp    %edi,%edx
+ 36e:	73 e2                	jae    352 <printint+0x28>
+  if(neg)
+ 370:	45 85 c0             	test   %r8d,%r8d
+ 373:	74 0a                	je     37f <printint+0x55>
+    buf[i++] = digits[x % base];
+ 375:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 377:	48 63 c3             	movslq %ebx,%rax
+ 37a:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 37f:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 382:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 386:	ba 01 00 00 00       	mov    $0x1,%edx
+ 38b:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 38f:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 392:	48 ff cb             	dec    %rbx
+ 395:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 398:	e8 05 ff ff ff       	call   2a2 <write>
+  while(--i >= 0)
+ 39d:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 3a0:	75 e0                	jne    382 <printint+0x58>
+}
+ 3a2:	48 83 c4 20          	add    $0x20,%rsp
+ 3a6:	5b                   	pop    %rbx
+ 3a7:	41 5c                	pop    %r12
+ 3a9:	5d                   	pop    %rbp
+ 3aa:	c3                   	ret
+
+00000000000003ab <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 3ab:	55                   	push   %rbp
+ 3ac:	48 89 e5             	mov    %rsp,%rbp
+ 3af:	41 55                	push   %r13
+ 3b1:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 3b3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 3b7:	53                   	push   %rbx
+ 3b8:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 3bc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 3c0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 3c4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 3c8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 3cc:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 3d0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 3d4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 3d8:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 3da:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 3e1:	84 c0                	test   %al,%al
+ 3e3:	0f 84 6f 01 00 00    	je     558 <printf+0x1ad>
+ 3e9:	89 fb                	mov    %edi,%ebx
+ 3eb:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 3ee:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 3f1:	83 fa 25             	cmp    $0x25,%edx
+ 3f4:	75 44                	jne    43a <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 3f6:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 3fb:	49 ff c4             	inc    %r12
+ 3fe:	45 84 ed             	test   %r13b,%r13b
+ 401:	0f 84 51 01 00 00    	je     558 <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 407:	41 0f b6 c5          	movzbl %r13b,%eax
+ 40b:	41 0f be d5          	movsbl %r13b,%edx
+ 40f:	83 f8 64             	cmp    $0x64,%eax
+ 412:	74 7c                	je     490 <printf+0xe5>
+ 414:	7f 29                	jg     43f <printf+0x94>
+ 416:	83 f8 25             	cmp    $0x25,%eax
+ 419:	74 4c                	je     467 <printf+0xbc>
+ 41b:	83 f8 63             	cmp    $0x63,%eax
+ 41e:	75 33                	jne    453 <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 420:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 423:	83 fa 2f             	cmp    $0x2f,%edx
+ 426:	0f 87 1b 01 00 00    	ja     547 <printf+0x19c>
+ 42c:	89 d0                	mov    %edx,%eax
+ 42e:	83 c2 08             	add    $0x8,%edx
+ 431:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 435:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 438:	8b 00                	mov    (%rax),%eax
+ 43a:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 43d:	eb 2c                	jmp    46b <printf+0xc0>
+ 43f:	83 f8 73             	cmp    $0x73,%eax
+ 442:	0f 84 aa 00 00 00    	je     4f2 <printf+0x147>
+ 448:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 44e:	83 fa 70             	cmp    $0x70,%edx
+ 451:	74 6b                	je     4be <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 453:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 457:	ba 01 00 00 00       	mov    $0x1,%edx
+ 45c:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 460:	89 df                	mov    %ebx,%edi
+ 462:	e8 3b fe ff ff       	call   2a2 <write>
+        putc(fd, c);
+ 467:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 46b:	ba 01 00 00 00       	mov    $0x1,%edx
+ 470:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 474:	89 df                	mov    %ebx,%edi
+ 476:	e8 27 fe ff ff       	call   2a2 <write>
+  for(i = 0; fmt[i]; i++){
+ 47b:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 480:	49 ff c4             	inc    %r12
+ 483:	84 c0                	test   %al,%al
+ 485:	0f 85 63 ff ff ff    	jne    3ee <printf+0x43>
+ 48b:	e9 c8 00 00 00       	jmp    558 <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 490:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 493:	83 fa 2f             	cmp    $0x2f,%edx
+ 496:	77 0e                	ja     4a6 <printf+0xfb>
+ 498:	89 d0                	mov    %edx,%eax
+ 49a:	83 c2 08             	add    $0x8,%edx
+ 49d:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 4a1:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 4a4:	eb 0c                	jmp    4b2 <printf+0x107>
+ 4a6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 4aa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4ae:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 4b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 4b7:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 4bc:	eb 29                	jmp    4e7 <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 4be:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 4c1:	83 fa 2f             	cmp    $0x2f,%edx
+ 4c4:	77 0e                	ja     4d4 <printf+0x129>
+ 4c6:	89 d0                	mov    %edx,%eax
+ 4c8:	83 c2 08             	add    $0x8,%edx
+ 4cb:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 4cf:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 4d2:	eb 0c                	jmp    4e0 <printf+0x135>
+ 4d4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 4d8:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 4dc:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 4e0:	31 c9                	xor    %ecx,%ecx
+ 4e2:	ba 10 00 00 00       	mov    $0x10,%edx
+ 4e7:	8b 30                	mov    (%rax),%esi
+ 4e9:	89 df                	mov    %ebx,%edi
+ 4eb:	e8 3a fe ff ff       	call   32a <printint>
+ 4f0:	eb 89                	jmp    47b <printf+0xd0>
+        s = va_arg(ap, char*);
+ 4f2:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 4f5:	83 fa 2f             	cmp    $0x2f,%edx
+ 4f8:	77 0e                	ja     508 <printf+0x15d>
+ 4fa:	89 d0                	mov    %edx,%eax
+ 4fc:	83 c2 08             	add    $0x8,%edx
+ 4ff:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 503:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 506:	eb 0c                	jmp    514 <printf+0x169>
+ 508:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 50c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 510:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 514:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 517:	4d 85 ed             	test   %r13,%r13
+ 51a:	75 07                	jne    523 <printf+0x178>
+          s = "(null)";
+ 51c:	49 c7 c5 e7 06 00 00 	mov    $0x6e7,%r13
+        while(*s != 0){
+ 523:	41 8a 45 00          	mov    0x0(%r13),%al
+ 527:	84 c0                	test   %al,%al
+ 529:	0f 84 4c ff ff ff    	je     47b <printf+0xd0>
+          putc(fd, *s);
+ 52f:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 532:	ba 01 00 00 00       	mov    $0x1,%edx
+ 537:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 53b:	89 df                	mov    %ebx,%edi
+          s++;
+ 53d:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 540:	e8 5d fd ff ff       	call   2a2 <write>
+          s++;
+ 545:	eb dc                	jmp    523 <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 547:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 54b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 54f:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 553:	e9 e0 fe ff ff       	jmp    438 <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 558:	48 83 c4 58          	add    $0x58,%rsp
+ 55c:	5b                   	pop    %rbx
+ 55d:	41 5c                	pop    %r12
+ 55f:	41 5d                	pop    %r13
+ 561:	5d                   	pop    %rbp
+ 562:	c3                   	ret
+
+0000000000000563 <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 563:	48 8b 05 b6 05 00 00 	mov    0x5b6(%rip),%rax        # b20 <freep>
+{
+ 56a:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 56d:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 571:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 574:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 577:	48 39 f2             	cmp    %rsi,%rdx
+ 57a:	72 0c                	jb     588 <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 57c:	48 39 c6             	cmp    %rax,%rsi
+ 57f:	73 f0                	jae    571 <free+0xe>
+ 581:	48 39 c2             	cmp    %rax,%rdx
+ 584:	72 eb                	jb     571 <free+0xe>
+ 586:	eb 05                	jmp    58d <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 588:	48 39 c6             	cmp    %rax,%rsi
+ 58b:	73 f4                	jae    581 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 58d:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 590:	49 89 f8             	mov    %rdi,%r8
+ 593:	48 c1 e7 04          	shl    $0x4,%rdi
+ 597:	48 01 f7             	add    %rsi,%rdi
+ 59a:	48 39 f8             	cmp    %rdi,%rax
+ 59d:	75 0e                	jne    5ad <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 59f:	44 03 40 08          	add    0x8(%rax),%r8d
+ 5a3:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5a7:	48 8b 02             	mov    (%rdx),%rax
+ 5aa:	48 8b 00             	mov    (%rax),%rax
+ 5ad:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 5b1:	8b 42 08             	mov    0x8(%rdx),%eax
+ 5b4:	48 89 c7             	mov    %rax,%rdi
+ 5b7:	48 c1 e0 04          	shl    $0x4,%rax
+ 5bb:	48 01 d0             	add    %rdx,%rax
+ 5be:	48 39 c6             	cmp    %rax,%rsi
+ 5c1:	75 0a                	jne    5cd <free+0x6a>
+    p->s.size += bp->s.size;
+ 5c3:	03 79 f8             	add    -0x8(%rcx),%edi
+ 5c6:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 5c9:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 5cd:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 5d0:	48 89 15 49 05 00 00 	mov    %rdx,0x549(%rip)        # b20 <freep>
+}
+ 5d7:	c3                   	ret
+
+00000000000005d8 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 5d8:	55                   	push   %rbp
+ 5d9:	48 89 e5             	mov    %rsp,%rbp
+ 5dc:	41 55                	push   %r13
+ 5de:	41 54                	push   %r12
+ 5e0:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5e1:	89 fb                	mov    %edi,%ebx
+{
+ 5e3:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5e4:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 5e8:	48 8b 0d 31 05 00 00 	mov    0x531(%rip),%rcx        # b20 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 5ef:	48 c1 eb 04          	shr    $0x4,%rbx
+ 5f3:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 5f5:	48 85 c9             	test   %rcx,%rcx
+ 5f8:	75 25                	jne    61f <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 5fa:	48 c7 05 1b 05 00 00 	movq   $0xb30,0x51b(%rip)        # b20 <freep>
+ 601:	30 0b 00 00 
+    base.s.size = 0;
+ 605:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 607:	48 c7 05 1e 05 00 00 	movq   $0xb30,0x51e(%rip)        # b30 <base>
+ 60e:	30 0b 00 00 
+    base.s.size = 0;
+ 612:	89 0d 20 05 00 00    	mov    %ecx,0x520(%rip)        # b38 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 618:	48 c7 c1 30 0b 00 00 	mov    $0xb30,%rcx
+  if(nu < 4096)
+ 61f:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 625:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 628:	44 39 e3             	cmp    %r12d,%ebx
+ 62b:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 62f:	45 89 e5             	mov    %r12d,%r13d
+ 632:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 636:	8b 50 08             	mov    0x8(%rax),%edx
+ 639:	39 da                	cmp    %ebx,%edx
+ 63b:	72 26                	jb     663 <malloc+0x8b>
+      if(p->s.size == nunits)
+ 63d:	75 08                	jne    647 <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 63f:	48 8b 10             	mov    (%rax),%rdx
+ 642:	48 89 11             	mov    %rdx,(%rcx)
+ 645:	eb 0f                	jmp    656 <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 647:	29 da                	sub    %ebx,%edx
+ 649:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 64c:	48 c1 e2 04          	shl    $0x4,%rdx
+ 650:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 653:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 656:	48 89 0d c3 04 00 00 	mov    %rcx,0x4c3(%rip)        # b20 <freep>
+      return (void*)(p + 1);
+ 65d:	48 83 c0 10          	add    $0x10,%rax
+ 661:	eb 3a                	jmp    69d <malloc+0xc5>
+    }
+    if(p == freep)
+ 663:	48 39 05 b6 04 00 00 	cmp    %rax,0x4b6(%rip)        # b20 <freep>
+ 66a:	75 27                	jne    693 <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 66c:	44 89 ef             	mov    %r13d,%edi
+ 66f:	e8 96 fc ff ff       	call   30a <sbrk>
+  if(p == (char*)-1)
+ 674:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 678:	74 21                	je     69b <malloc+0xc3>
+  hp->s.size = nu;
+ 67a:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 67e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 682:	e8 dc fe ff ff       	call   563 <free>
+  return freep;
+ 687:	48 8b 05 92 04 00 00 	mov    0x492(%rip),%rax        # b20 <freep>
+      if((p = morecore(nunits)) == 0)
+ 68e:	48 85 c0             	test   %rax,%rax
+ 691:	74 08                	je     69b <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 693:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 696:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 699:	eb 9b                	jmp    636 <malloc+0x5e>
+        return 0;
+ 69b:	31 c0                	xor    %eax,%eax
+  }
+}
+ 69d:	5a                   	pop    %rdx
+ 69e:	5b                   	pop    %rbx
+ 69f:	41 5c                	pop    %r12
+ 6a1:	41 5d                	pop    %r13
+ 6a3:	5d                   	pop    %rbp
+ 6a4:	c3                   	ret
@@ -0,0 +1,876 @@
+
+.fs/zombie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	55                   	push   %rbp
+   1:	48 89 e5             	mov    %rsp,%rbp
+  if(fork() > 0)
+   4:	e8 49 01 00 00       	call   152 <fork>
+   9:	85 c0                	test   %eax,%eax
+   b:	7e 0a                	jle    17 <main+0x17>
+    sleep(5);  // Let child exit before parent.
+   d:	bf 05 00 00 00       	mov    $0x5,%edi
+  12:	e8 d3 01 00 00       	call   1ea <sleep>
+  exit();
+  17:	e8 3e 01 00 00       	call   15a <exit>
+
+000000000000001c <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  1c:	48 89 f8             	mov    %rdi,%rax
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  1f:	31 d2                	xor    %edx,%edx
+  21:	8a 0c 16             	mov    (%rsi,%rdx,1),%cl
+  24:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  27:	48 ff c2             	inc    %rdx
+  2a:	84 c9                	test   %cl,%cl
+  2c:	75 f3                	jne    21 <strcpy+0x5>
+    ;
+  return os;
+}
+  2e:	c3                   	ret
+
+000000000000002f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  while(*p && *p == *q)
+  2f:	31 c9                	xor    %ecx,%ecx
+  31:	0f b6 04 0f          	movzbl (%rdi,%rcx,1),%eax
+  35:	0f b6 14 0e          	movzbl (%rsi,%rcx,1),%edx
+  39:	84 c0                	test   %al,%al
+  3b:	74 07                	je     44 <strcmp+0x15>
+  3d:	48 ff c1             	inc    %rcx
+  40:	38 d0                	cmp    %dl,%al
+  42:	74 ed                	je     31 <strcmp+0x2>
+    p++, q++;
+  return (uchar)*p - (uchar)*q;
+  44:	29 d0                	sub    %edx,%eax
+}
+  46:	c3                   	ret
+
+0000000000000047 <strlen>:
+uint
+strlen(const char *s)
+{
+  int n;
+
+  for(n = 0; s[n]; n++)
+  47:	31 d2                	xor    %edx,%edx
+  49:	48 89 d0             	mov    %rdx,%rax
+  4c:	48 ff c2             	inc    %rdx
+  4f:	80 7c 17 ff 00       	cmpb   $0x0,-0x1(%rdi,%rdx,1)
+  54:	75 f3                	jne    49 <strlen+0x2>
+    ;
+  return n;
+}
+  56:	c3                   	ret
+
+0000000000000057 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  57:	49 89 f8             	mov    %rdi,%r8
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  5a:	89 d1                	mov    %edx,%ecx
+  5c:	89 f0                	mov    %esi,%eax
+  5e:	fc                   	cld
+  5f:	f3 aa                	rep stos %al,%es:(%rdi)
+  stosb(dst, c, n);
+  return dst;
+}
+  61:	4c 89 c0             	mov    %r8,%rax
+  64:	c3                   	ret
+
+0000000000000065 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+  65:	48 89 f8             	mov    %rdi,%rax
+  68:	8a 10                	mov    (%rax),%dl
+  6a:	84 d2                	test   %dl,%dl
+  6c:	74 0a                	je     78 <strchr+0x13>
+    if(*s == c)
+  6e:	40 38 f2             	cmp    %sil,%dl
+  71:	74 07                	je     7a <strchr+0x15>
+  for(; *s; s++)
+  73:	48 ff c0             	inc    %rax
+  76:	eb f0                	jmp    68 <strchr+0x3>
+      return (char*)s;
+  return 0;
+  78:	31 c0                	xor    %eax,%eax
+}
+  7a:	c3                   	ret
+
+000000000000007b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+  7b:	55                   	push   %rbp
+  7c:	48 89 e5             	mov    %rsp,%rbp
+  7f:	41 56                	push   %r14
+  81:	41 89 f6             	mov    %esi,%r14d
+  84:	41 55                	push   %r13
+  86:	41 54                	push   %r12
+  88:	49 89 fc             	mov    %rdi,%r12
+  8b:	53                   	push   %rbx
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+  8c:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+  91:	48 83 ec 10          	sub    $0x10,%rsp
+  for(i=0; i+1 < max; ){
+  95:	41 89 dd             	mov    %ebx,%r13d
+  98:	44 39 f3             	cmp    %r14d,%ebx
+  9b:	7d 29                	jge    c6 <gets+0x4b>
+    cc = read(0, &c, 1);
+  9d:	31 ff                	xor    %edi,%edi
+  9f:	ba 01 00 00 00       	mov    $0x1,%edx
+  a4:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+  a8:	e8 c5 00 00 00       	call   172 <read>
+    if(cc < 1)
+  ad:	85 c0                	test   %eax,%eax
+  af:	7e 15                	jle    c6 <gets+0x4b>
+      break;
+    buf[i++] = c;
+  b1:	8a 45 df             	mov    -0x21(%rbp),%al
+  b4:	41 88 44 1c ff       	mov    %al,-0x1(%r12,%rbx,1)
+    if(c == '\n' || c == '\r')
+  b9:	48 ff c3             	inc    %rbx
+  bc:	3c 0a                	cmp    $0xa,%al
+  be:	74 0a                	je     ca <gets+0x4f>
+  c0:	3c 0d                	cmp    $0xd,%al
+  c2:	75 d1                	jne    95 <gets+0x1a>
+  c4:	eb 04                	jmp    ca <gets+0x4f>
+  c6:	44 8d 6b ff          	lea    -0x1(%rbx),%r13d
+      break;
+  }
+  buf[i] = '\0';
+  ca:	4d 63 ed             	movslq %r13d,%r13
+  return buf;
+}
+  cd:	4c 89 e0             	mov    %r12,%rax
+  buf[i] = '\0';
+  d0:	43 c6 04 2c 00       	movb   $0x0,(%r12,%r13,1)
+}
+  d5:	5a                   	pop    %rdx
+  d6:	59                   	pop    %rcx
+  d7:	5b                   	pop    %rbx
+  d8:	41 5c                	pop    %r12
+  da:	41 5d                	pop    %r13
+  dc:	41 5e                	pop    %r14
+  de:	5d                   	pop    %rbp
+  df:	c3                   	ret
+
+00000000000000e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+  e0:	55                   	push   %rbp
+  e1:	48 89 e5             	mov    %rsp,%rbp
+  e4:	41 55                	push   %r13
+  e6:	49 89 f5             	mov    %rsi,%r13
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+  e9:	31 f6                	xor    %esi,%esi
+{
+  eb:	41 54                	push   %r12
+  ed:	41 83 cc ff          	or     $0xffffffff,%r12d
+  f1:	53                   	push   %rbx
+  f2:	51                   	push   %rcx
+  fd = open(n, O_RDONLY);
+  f3:	e8 a2 00 00 00       	call   19a <open>
+  if(fd < 0)
+  f8:	85 c0                	test   %eax,%eax
+  fa:	78 16                	js     112 <stat+0x32>
+  fc:	89 c3                	mov    %eax,%ebx
+    return -1;
+  r = fstat(fd, st);
+  fe:	89 c7                	mov    %eax,%edi
+ 100:	4c 89 ee             	mov    %r13,%rsi
+ 103:	e8 aa 00 00 00       	call   1b2 <fstat>
+  close(fd);
+ 108:	89 df                	mov    %ebx,%edi
+  r = fstat(fd, st);
+ 10a:	41 89 c4             	mov    %eax,%r12d
+  close(fd);
+ 10d:	e8 70 00 00 00       	call   182 <close>
+  return r;
+}
+ 112:	5a                   	pop    %rdx
+ 113:	44 89 e0             	mov    %r12d,%eax
+ 116:	5b                   	pop    %rbx
+ 117:	41 5c                	pop    %r12
+ 119:	41 5d                	pop    %r13
+ 11b:	5d                   	pop    %rbp
+ 11c:	c3                   	ret
+
+000000000000011d <atoi>:
+int
+atoi(const char *s)
+{
+  int n;
+
+  n = 0;
+ 11d:	31 c0                	xor    %eax,%eax
+  while('0' <= *s && *s <= '9')
+ 11f:	0f be 17             	movsbl (%rdi),%edx
+ 122:	8d 4a d0             	lea    -0x30(%rdx),%ecx
+ 125:	80 f9 09             	cmp    $0x9,%cl
+ 128:	77 0c                	ja     136 <atoi+0x19>
+    n = n*10 + *s++ - '0';
+ 12a:	6b c0 0a             	imul   $0xa,%eax,%eax
+ 12d:	48 ff c7             	inc    %rdi
+ 130:	8d 44 10 d0          	lea    -0x30(%rax,%rdx,1),%eax
+ 134:	eb e9                	jmp    11f <atoi+0x2>
+  return n;
+}
+ 136:	c3                   	ret
+
+0000000000000137 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 137:	48 89 f8             	mov    %rdi,%rax
+  char *dst;
+  const char *src;
+  
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 13a:	31 c9                	xor    %ecx,%ecx
+ 13c:	89 d7                	mov    %edx,%edi
+ 13e:	29 cf                	sub    %ecx,%edi
+ 140:	85 ff                	test   %edi,%edi
+ 142:	7e 0d                	jle    151 <memmove+0x1a>
+    *dst++ = *src++;
+ 144:	40 8a 3c 0e          	mov    (%rsi,%rcx,1),%dil
+ 148:	40 88 3c 08          	mov    %dil,(%rax,%rcx,1)
+ 14c:	48 ff c1             	inc    %rcx
+ 14f:	eb eb                	jmp    13c <memmove+0x5>
+  return vdst;
+}
+ 151:	c3                   	ret
+
+0000000000000152 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 152:	b8 01 00 00 00       	mov    $0x1,%eax
+ 157:	cd 40                	int    $0x40
+ 159:	c3                   	ret
+
+000000000000015a <exit>:
+SYSCALL(exit)
+ 15a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 15f:	cd 40                	int    $0x40
+ 161:	c3                   	ret
+
+0000000000000162 <wait>:
+SYSCALL(wait)
+ 162:	b8 03 00 00 00       	mov    $0x3,%eax
+ 167:	cd 40                	int    $0x40
+ 169:	c3                   	ret
+
+000000000000016a <pipe>:
+SYSCALL(pipe)
+ 16a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 16f:	cd 40                	int    $0x40
+ 171:	c3                   	ret
+
+0000000000000172 <read>:
+SYSCALL(read)
+ 172:	b8 05 00 00 00       	mov    $0x5,%eax
+ 177:	cd 40                	int    $0x40
+ 179:	c3                   	ret
+
+000000000000017a <write>:
+SYSCALL(write)
+ 17a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 17f:	cd 40                	int    $0x40
+ 181:	c3                   	ret
+
+0000000000000182 <close>:
+SYSCALL(close)
+ 182:	b8 15 00 00 00       	mov    $0x15,%eax
+ 187:	cd 40                	int    $0x40
+ 189:	c3                   	ret
+
+000000000000018a <kill>:
+SYSCALL(kill)
+ 18a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 18f:	cd 40                	int    $0x40
+ 191:	c3                   	ret
+
+0000000000000192 <exec>:
+SYSCALL(exec)
+ 192:	b8 07 00 00 00       	mov    $0x7,%eax
+ 197:	cd 40                	int    $0x40
+ 199:	c3                   	ret
+
+000000000000019a <open>:
+SYSCALL(open)
+ 19a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 19f:	cd 40                	int    $0x40
+ 1a1:	c3                   	ret
+
+00000000000001a2 <mknod>:
+SYSCALL(mknod)
+ 1a2:	b8 11 00 00 00       	mov    $0x11,%eax
+ 1a7:	cd 40                	int    $0x40
+ 1a9:	c3                   	ret
+
+00000000000001aa <unlink>:
+SYSCALL(unlink)
+ 1aa:	b8 12 00 00 00       	mov    $0x12,%eax
+ 1af:	cd 40                	int    $0x40
+ 1b1:	c3                   	ret
+
+00000000000001b2 <fstat>:
+SYSCALL(fstat)
+ 1b2:	b8 08 00 00 00       	mov    $0x8,%eax
+ 1b7:	cd 40                	int    $0x40
+ 1b9:	c3                   	ret
+
+00000000000001ba <link>:
+SYSCALL(link)
+ 1ba:	b8 13 00 00 00       	mov    $0x13,%eax
+ 1bf:	cd 40                	int    $0x40
+ 1c1:	c3                   	ret
+
+00000000000001c2 <mkdir>:
+SYSCALL(mkdir)
+ 1c2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 1c7:	cd 40                	int    $0x40
+ 1c9:	c3                   	ret
+
+00000000000001ca <chdir>:
+SYSCALL(chdir)
+ 1ca:	b8 09 00 00 00       	mov    $0x9,%eax
+ 1cf:	cd 40                	int    $0x40
+ 1d1:	c3                   	ret
+
+00000000000001d2 <dup>:
+SYSCALL(dup)
+ 1d2:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 1d7:	cd 40                	int    $0x40
+ 1d9:	c3                   	ret
+
+00000000000001da <getpid>:
+SYSCALL(getpid)
+ 1da:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 1df:	cd 40                	int    $0x40
+ 1e1:	c3                   	ret
+
+00000000000001e2 <sbrk>:
+SYSCALL(sbrk)
+ 1e2:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 1e7:	cd 40                	int    $0x40
+ 1e9:	c3                   	ret
+
+00000000000001ea <sleep>:
+SYSCALL(sleep)
+ 1ea:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 1ef:	cd 40                	int    $0x40
+ 1f1:	c3                   	ret
+
+00000000000001f2 <uptime>:
+SYSCALL(uptime)
+ 1f2:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 1f7:	cd 40                	int    $0x40
+ 1f9:	c3                   	ret
+
+00000000000001fa <chmod>:
+SYSCALL(chmod)
+ 1fa:	b8 16 00 00 00       	mov    $0x16,%eax
+ 1ff:	cd 40                	int    $0x40
+ 201:	c3                   	ret
+
+0000000000000202 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 202:	55                   	push   %rbp
+ 203:	48 89 e5             	mov    %rsp,%rbp
+ 206:	41 54                	push   %r12
+ 208:	41 89 fc             	mov    %edi,%r12d
+ 20b:	89 d7                	mov    %edx,%edi
+ 20d:	53                   	push   %rbx
+ 20e:	48 83 ec 20          	sub    $0x20,%rsp
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+ 212:	85 f6                	test   %esi,%esi
+ 214:	79 0f                	jns    225 <printint+0x23>
+ 216:	80 e1 01             	and    $0x1,%cl
+ 219:	74 0a                	je     225 <printint+0x23>
+    neg = 1;
+    x = -xx;
+ 21b:	f7 de                	neg    %esi
+    neg = 1;
+ 21d:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+ 223:	eb 03                	jmp    228 <printint+0x26>
+  neg = 0;
+ 225:	45 31 c0             	xor    %r8d,%r8d
+ 228:	31 c9                	xor    %ecx,%ecx
+    x = xx;
+  }
+
+  i = 0;
+  do{
+    buf[i++] = digits[x % base];
+ 22a:	89 f0                	mov    %esi,%eax
+ 22c:	31 d2                	xor    %edx,%edx
+ 22e:	48 89 cb             	mov    %rcx,%rbx
+  }while((x /= base) != 0);
+ 231:	48 ff c1             	inc    %rcx
+    buf[i++] = digits[x % base];
+ 234:	f7 f7                	div    %edi
+ 236:	8a 92 90 05 00 00    	mov    0x590(%rdx),%dl
+ 23c:	88 54 29 df          	mov    %dl,-0x21(%rcx,%rbp,1)
+  }while((x /= base) != 0);
+ 240:	89 f2                	mov    %esi,%edx
+ 242:	89 c6                	mov    %eax,%esi
+ 244:	39 fa                	cmp    %edi,%edx
+ 246:	73 e2                	jae    22a <printint+0x28>
+  if(neg)
+ 248:	45 85 c0             	test   %r8d,%r8d
+ 24b:	74 0a                	je     257 <printint+0x55>
+    buf[i++] = digits[x % base];
+ 24d:	ff c3                	inc    %ebx
+    buf[i++] = '-';
+ 24f:	48 63 c3             	movslq %ebx,%rax
+ 252:	c6 44 05 e0 2d       	movb   $0x2d,-0x20(%rbp,%rax,1)
+
+  while(--i >= 0)
+ 257:	48 63 db             	movslq %ebx,%rbx
+    putc(fd, buf[i]);
+ 25a:	8a 44 1d e0          	mov    -0x20(%rbp,%rbx,1),%al
+  write(fd, &c, 1);
+ 25e:	ba 01 00 00 00       	mov    $0x1,%edx
+ 263:	48 8d 75 df          	lea    -0x21(%rbp),%rsi
+ 267:	44 89 e7             	mov    %r12d,%edi
+  while(--i >= 0)
+ 26a:	48 ff cb             	dec    %rbx
+ 26d:	88 45 df             	mov    %al,-0x21(%rbp)
+  write(fd, &c, 1);
+ 270:	e8 05 ff ff ff       	call   17a <write>
+  while(--i >= 0)
+ 275:	83 fb ff             	cmp    $0xffffffff,%ebx
+ 278:	75 e0                	jne    25a <printint+0x58>
+}
+ 27a:	48 83 c4 20          	add    $0x20,%rsp
+ 27e:	5b                   	pop    %rbx
+ 27f:	41 5c                	pop    %r12
+ 281:	5d                   	pop    %rbp
+ 282:	c3                   	ret
+
+0000000000000283 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 283:	55                   	push   %rbp
+ 284:	48 89 e5             	mov    %rsp,%rbp
+ 287:	41 55                	push   %r13
+ 289:	41 54                	push   %r12
+  va_list ap;
+  char *s;
+  int c, i, state;
+  va_start(ap, fmt);
+ 28b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+{
+ 28f:	53                   	push   %rbx
+ 290:	48 83 ec 58          	sub    $0x58,%rsp
+  va_start(ap, fmt);
+ 294:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+ 298:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+{
+ 29c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+ 2a0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+ 2a4:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+ 2a8:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+  va_start(ap, fmt);
+ 2ac:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+  state = 0;
+  for(i = 0; fmt[i]; i++){
+ 2b0:	8a 06                	mov    (%rsi),%al
+  va_start(ap, fmt);
+ 2b2:	c7 45 98 10 00 00 00 	movl   $0x10,-0x68(%rbp)
+  for(i = 0; fmt[i]; i++){
+ 2b9:	84 c0                	test   %al,%al
+ 2bb:	0f 84 6f 01 00 00    	je     430 <printf+0x1ad>
+ 2c1:	89 fb                	mov    %edi,%ebx
+ 2c3:	49 89 f4             	mov    %rsi,%r12
+    c = fmt[i] & 0xff;
+ 2c6:	0f b6 d0             	movzbl %al,%edx
+    if(state == 0){
+      if(c == '%'){
+ 2c9:	83 fa 25             	cmp    $0x25,%edx
+ 2cc:	75 44                	jne    312 <printf+0x8f>
+  for(i = 0; fmt[i]; i++){
+ 2ce:	45 8a 6c 24 01       	mov    0x1(%r12),%r13b
+ 2d3:	49 ff c4             	inc    %r12
+ 2d6:	45 84 ed             	test   %r13b,%r13b
+ 2d9:	0f 84 51 01 00 00    	je     430 <printf+0x1ad>
+    c = fmt[i] & 0xff;
+ 2df:	41 0f b6 c5          	movzbl %r13b,%eax
+ 2e3:	41 0f be d5          	movsbl %r13b,%edx
+ 2e7:	83 f8 64             	cmp    $0x64,%eax
+ 2ea:	74 7c                	je     368 <printf+0xe5>
+ 2ec:	7f 29                	jg     317 <printf+0x94>
+ 2ee:	83 f8 25             	cmp    $0x25,%eax
+ 2f1:	74 4c                	je     33f <printf+0xbc>
+ 2f3:	83 f8 63             	cmp    $0x63,%eax
+ 2f6:	75 33                	jne    32b <printf+0xa8>
+        while(*s != 0){
+          putc(fd, *s);
+          s++;
+        }
+      } else if(c == 'c'){
+        putc(fd, va_arg(ap, uint));
+ 2f8:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 2fb:	83 fa 2f             	cmp    $0x2f,%edx
+ 2fe:	0f 87 1b 01 00 00    	ja     41f <printf+0x19c>
+ 304:	89 d0                	mov    %edx,%eax
+ 306:	83 c2 08             	add    $0x8,%edx
+ 309:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 30d:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 310:	8b 00                	mov    (%rax),%eax
+ 312:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 315:	eb 2c                	jmp    343 <printf+0xc0>
+ 317:	83 f8 73             	cmp    $0x73,%eax
+ 31a:	0f 84 aa 00 00 00    	je     3ca <printf+0x147>
+ 320:	81 e2 f7 00 00 00    	and    $0xf7,%edx
+ 326:	83 fa 70             	cmp    $0x70,%edx
+ 329:	74 6b                	je     396 <printf+0x113>
+      } else if(c == '%'){
+        putc(fd, c);
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 32b:	c6 45 97 25          	movb   $0x25,-0x69(%rbp)
+  write(fd, &c, 1);
+ 32f:	ba 01 00 00 00       	mov    $0x1,%edx
+ 334:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 338:	89 df                	mov    %ebx,%edi
+ 33a:	e8 3b fe ff ff       	call   17a <write>
+        putc(fd, c);
+ 33f:	44 88 6d 97          	mov    %r13b,-0x69(%rbp)
+  write(fd, &c, 1);
+ 343:	ba 01 00 00 00       	mov    $0x1,%edx
+ 348:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 34c:	89 df                	mov    %ebx,%edi
+ 34e:	e8 27 fe ff ff       	call   17a <write>
+  for(i = 0; fmt[i]; i++){
+ 353:	41 8a 44 24 01       	mov    0x1(%r12),%al
+ 358:	49 ff c4             	inc    %r12
+ 35b:	84 c0                	test   %al,%al
+ 35d:	0f 85 63 ff ff ff    	jne    2c6 <printf+0x43>
+ 363:	e9 c8 00 00 00       	jmp    430 <printf+0x1ad>
+        printint(fd, va_arg(ap, int), 10, 1);
+ 368:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 36b:	83 fa 2f             	cmp    $0x2f,%edx
+ 36e:	77 0e                	ja     37e <printf+0xfb>
+ 370:	89 d0                	mov    %edx,%eax
+ 372:	83 c2 08             	add    $0x8,%edx
+ 375:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 379:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 37c:	eb 0c                	jmp    38a <printf+0x107>
+ 37e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 382:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 386:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 38a:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 38f:	ba 0a 00 00 00       	mov    $0xa,%edx
+ 394:	eb 29                	jmp    3bf <printf+0x13c>
+        printint(fd, va_arg(ap, int), 16, 0);
+ 396:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 399:	83 fa 2f             	cmp    $0x2f,%edx
+ 39c:	77 0e                	ja     3ac <printf+0x129>
+ 39e:	89 d0                	mov    %edx,%eax
+ 3a0:	83 c2 08             	add    $0x8,%edx
+ 3a3:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3a7:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3aa:	eb 0c                	jmp    3b8 <printf+0x135>
+ 3ac:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3b0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3b4:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3b8:	31 c9                	xor    %ecx,%ecx
+ 3ba:	ba 10 00 00 00       	mov    $0x10,%edx
+ 3bf:	8b 30                	mov    (%rax),%esi
+ 3c1:	89 df                	mov    %ebx,%edi
+ 3c3:	e8 3a fe ff ff       	call   202 <printint>
+ 3c8:	eb 89                	jmp    353 <printf+0xd0>
+        s = va_arg(ap, char*);
+ 3ca:	8b 55 98             	mov    -0x68(%rbp),%edx
+ 3cd:	83 fa 2f             	cmp    $0x2f,%edx
+ 3d0:	77 0e                	ja     3e0 <printf+0x15d>
+ 3d2:	89 d0                	mov    %edx,%eax
+ 3d4:	83 c2 08             	add    $0x8,%edx
+ 3d7:	48 03 45 a8          	add    -0x58(%rbp),%rax
+ 3db:	89 55 98             	mov    %edx,-0x68(%rbp)
+ 3de:	eb 0c                	jmp    3ec <printf+0x169>
+ 3e0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 3e4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 3e8:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 3ec:	4c 8b 28             	mov    (%rax),%r13
+        if(s == 0)
+ 3ef:	4d 85 ed             	test   %r13,%r13
+ 3f2:	75 07                	jne    3fb <printf+0x178>
+          s = "(null)";
+ 3f4:	49 c7 c5 80 05 00 00 	mov    $0x580,%r13
+        while(*s != 0){
+ 3fb:	41 8a 45 00          	mov    0x0(%r13),%al
+ 3ff:	84 c0                	test   %al,%al
+ 401:	0f 84 4c ff ff ff    	je     353 <printf+0xd0>
+          putc(fd, *s);
+ 407:	88 45 97             	mov    %al,-0x69(%rbp)
+  write(fd, &c, 1);
+ 40a:	ba 01 00 00 00       	mov    $0x1,%edx
+ 40f:	48 8d 75 97          	lea    -0x69(%rbp),%rsi
+ 413:	89 df                	mov    %ebx,%edi
+          s++;
+ 415:	49 ff c5             	inc    %r13
+  write(fd, &c, 1);
+ 418:	e8 5d fd ff ff       	call   17a <write>
+          s++;
+ 41d:	eb dc                	jmp    3fb <printf+0x178>
+        putc(fd, va_arg(ap, uint));
+ 41f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+ 423:	48 8d 50 08          	lea    0x8(%rax),%rdx
+ 427:	48 89 55 a0          	mov    %rdx,-0x60(%rbp)
+ 42b:	e9 e0 fe ff ff       	jmp    310 <printf+0x8d>
+      }
+      state = 0;
+    }
+  }
+}
+ 430:	48 83 c4 58          	add    $0x58,%rsp
+ 434:	5b                   	pop    %rbx
+ 435:	41 5c                	pop    %r12
+ 437:	41 5d                	pop    %r13
+ 439:	5d                   	pop    %rbp
+ 43a:	c3                   	ret
+
+000000000000043b <free>:
+free(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 43b:	48 8b 05 2e 03 00 00 	mov    0x32e(%rip),%rax        # 770 <freep>
+{
+ 442:	48 89 f9             	mov    %rdi,%rcx
+  bp = (Header*)ap - 1;
+ 445:	48 8d 77 f0          	lea    -0x10(%rdi),%rsi
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 449:	48 89 c2             	mov    %rax,%rdx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 44c:	48 8b 00             	mov    (%rax),%rax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 44f:	48 39 f2             	cmp    %rsi,%rdx
+ 452:	72 0c                	jb     460 <free+0x25>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 454:	48 39 c6             	cmp    %rax,%rsi
+ 457:	73 f0                	jae    449 <free+0xe>
+ 459:	48 39 c2             	cmp    %rax,%rdx
+ 45c:	72 eb                	jb     449 <free+0xe>
+ 45e:	eb 05                	jmp    465 <free+0x2a>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 460:	48 39 c6             	cmp    %rax,%rsi
+ 463:	73 f4                	jae    459 <free+0x1e>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 465:	8b 79 f8             	mov    -0x8(%rcx),%edi
+ 468:	49 89 f8             	mov    %rdi,%r8
+ 46b:	48 c1 e7 04          	shl    $0x4,%rdi
+ 46f:	48 01 f7             	add    %rsi,%rdi
+ 472:	48 39 f8             	cmp    %rdi,%rax
+ 475:	75 0e                	jne    485 <free+0x4a>
+    bp->s.size += p->s.ptr->s.size;
+ 477:	44 03 40 08          	add    0x8(%rax),%r8d
+ 47b:	44 89 41 f8          	mov    %r8d,-0x8(%rcx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 47f:	48 8b 02             	mov    (%rdx),%rax
+ 482:	48 8b 00             	mov    (%rax),%rax
+ 485:	48 89 41 f0          	mov    %rax,-0x10(%rcx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 489:	8b 42 08             	mov    0x8(%rdx),%eax
+ 48c:	48 89 c7             	mov    %rax,%rdi
+ 48f:	48 c1 e0 04          	shl    $0x4,%rax
+ 493:	48 01 d0             	add    %rdx,%rax
+ 496:	48 39 c6             	cmp    %rax,%rsi
+ 499:	75 0a                	jne    4a5 <free+0x6a>
+    p->s.size += bp->s.size;
+ 49b:	03 79 f8             	add    -0x8(%rcx),%edi
+ 49e:	89 7a 08             	mov    %edi,0x8(%rdx)
+    p->s.ptr = bp->s.ptr;
+ 4a1:	48 8b 71 f0          	mov    -0x10(%rcx),%rsi
+ 4a5:	48 89 32             	mov    %rsi,(%rdx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+ 4a8:	48 89 15 c1 02 00 00 	mov    %rdx,0x2c1(%rip)        # 770 <freep>
+}
+ 4af:	c3                   	ret
+
+00000000000004b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 4b0:	55                   	push   %rbp
+ 4b1:	48 89 e5             	mov    %rsp,%rbp
+ 4b4:	41 55                	push   %r13
+ 4b6:	41 54                	push   %r12
+ 4b8:	53                   	push   %rbx
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4b9:	89 fb                	mov    %edi,%ebx
+{
+ 4bb:	56                   	push   %rsi
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4bc:	48 83 c3 0f          	add    $0xf,%rbx
+  if((prevp = freep) == 0){
+ 4c0:	48 8b 0d a9 02 00 00 	mov    0x2a9(%rip),%rcx        # 770 <freep>
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 4c7:	48 c1 eb 04          	shr    $0x4,%rbx
+ 4cb:	ff c3                	inc    %ebx
+  if((prevp = freep) == 0){
+ 4cd:	48 85 c9             	test   %rcx,%rcx
+ 4d0:	75 25                	jne    4f7 <malloc+0x47>
+    base.s.ptr = freep = prevp = &base;
+ 4d2:	48 c7 05 93 02 00 00 	movq   $0x780,0x293(%rip)        # 770 <freep>
+ 4d9:	80 07 00 00 
+    base.s.size = 0;
+ 4dd:	31 c9                	xor    %ecx,%ecx
+    base.s.ptr = freep = prevp = &base;
+ 4df:	48 c7 05 96 02 00 00 	movq   $0x780,0x296(%rip)        # 780 <base>
+ 4e6:	80 07 00 00 
+    base.s.size = 0;
+ 4ea:	89 0d 98 02 00 00    	mov    %ecx,0x298(%rip)        # 788 <base+0x8>
+    base.s.ptr = freep = prevp = &base;
+ 4f0:	48 c7 c1 80 07 00 00 	mov    $0x780,%rcx
+  if(nu < 4096)
+ 4f7:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 4fd:	48 8b 01             	mov    (%rcx),%rax
+  if(nu < 4096)
+ 500:	44 39 e3             	cmp    %r12d,%ebx
+ 503:	44 0f 43 e3          	cmovae %ebx,%r12d
+  p = sbrk(nu * sizeof(Header));
+ 507:	45 89 e5             	mov    %r12d,%r13d
+ 50a:	41 c1 e5 04          	shl    $0x4,%r13d
+    if(p->s.size >= nunits){
+ 50e:	8b 50 08             	mov    0x8(%rax),%edx
+ 511:	39 da                	cmp    %ebx,%edx
+ 513:	72 26                	jb     53b <malloc+0x8b>
+      if(p->s.size == nunits)
+ 515:	75 08                	jne    51f <malloc+0x6f>
+        prevp->s.ptr = p->s.ptr;
+ 517:	48 8b 10             	mov    (%rax),%rdx
+ 51a:	48 89 11             	mov    %rdx,(%rcx)
+ 51d:	eb 0f                	jmp    52e <malloc+0x7e>
+      else {
+        p->s.size -= nunits;
+ 51f:	29 da                	sub    %ebx,%edx
+ 521:	89 50 08             	mov    %edx,0x8(%rax)
+        p += p->s.size;
+ 524:	48 c1 e2 04          	shl    $0x4,%rdx
+ 528:	48 01 d0             	add    %rdx,%rax
+        p->s.size = nunits;
+ 52b:	89 58 08             	mov    %ebx,0x8(%rax)
+      }
+      freep = prevp;
+ 52e:	48 89 0d 3b 02 00 00 	mov    %rcx,0x23b(%rip)        # 770 <freep>
+      return (void*)(p + 1);
+ 535:	48 83 c0 10          	add    $0x10,%rax
+ 539:	eb 3a                	jmp    575 <malloc+0xc5>
+    }
+    if(p == freep)
+ 53b:	48 39 05 2e 02 00 00 	cmp    %rax,0x22e(%rip)        # 770 <freep>
+ 542:	75 27                	jne    56b <malloc+0xbb>
+  p = sbrk(nu * sizeof(Header));
+ 544:	44 89 ef             	mov    %r13d,%edi
+ 547:	e8 96 fc ff ff       	call   1e2 <sbrk>
+  if(p == (char*)-1)
+ 54c:	48 83 f8 ff          	cmp    $0xffffffffffffffff,%rax
+ 550:	74 21                	je     573 <malloc+0xc3>
+  hp->s.size = nu;
+ 552:	44 89 60 08          	mov    %r12d,0x8(%rax)
+  free((void*)(hp + 1));
+ 556:	48 8d 78 10          	lea    0x10(%rax),%rdi
+ 55a:	e8 dc fe ff ff       	call   43b <free>
+  return freep;
+ 55f:	48 8b 05 0a 02 00 00 	mov    0x20a(%rip),%rax        # 770 <freep>
+      if((p = morecore(nunits)) == 0)
+ 566:	48 85 c0             	test   %rax,%rax
+ 569:	74 08                	je     573 <malloc+0xc3>
+    if(p->s.size >= nunits){
+ 56b:	48 89 c1             	mov    %rax,%rcx
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 56e:	48 8b 00             	mov    (%rax),%rax
+    if(p->s.size >= nunits){
+ 571:	eb 9b                	jmp    50e <malloc+0x5e>
+        return 0;
+ 573:	31 c0                	xor    %eax,%eax
+  }
+}
+ 575:	5a                   	pop    %rdx
+ 576:	5b                   	pop    %rbx
+ 577:	41 5c                	pop    %r12
+ 579:	41 5d                	pop    %r13
+ 57b:	5d                   	pop    %rbp
+ 57c:	c3                   	ret
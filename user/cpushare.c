@@ -0,0 +1,99 @@
+// Show how a CPU is shared out between processes that compete
+// for it.  cpushare forks one spinning child per nice value given
+// (default 0 0 5), lets them run for a while, and prints the share
+// of the work each got done.  On more than one CPU the children
+// spread out, so boot with CPUS=1 to see a single CPU's shares.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define WARMUP   10     // ticks for the children to get going
+#define DURATION 300    // ticks to compete for
+
+struct result {
+  int nice;
+  uint work;            // units of 10000 loop iterations
+};
+
+static int
+atoni(char *s)
+{
+  if(*s == '-')
+    return -atoi(s+1);
+  return atoi(s);
+}
+
+static void
+spin(int fd, int n, int start)
+{
+  struct result r;
+  volatile int i;
+
+  nice(n);
+  r.nice = n;
+  r.work = 0;
+  while(uptime() < start)
+    ;
+  while(uptime() < start + DURATION){
+    for(i = 0; i < 10000; i++)
+      ;
+    r.work++;
+  }
+  write(fd, &r, sizeof(r));
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  static char *def[] = { "cpushare", "0", "0", "5" };
+  struct result r[16];
+  int fd[2], i, n, start;
+  uint total;
+
+  if(argc < 2){
+    argc = 4;
+    argv = def;
+  }
+  n = argc - 1;
+  if(n > 16){
+    printf(2, "cpushare: at most 16 processes\n");
+    exit();
+  }
+  if(pipe(fd) < 0){
+    printf(2, "cpushare: pipe failed\n");
+    exit();
+  }
+
+  start = uptime() + WARMUP;
+  for(i = 0; i < n; i++){
+    switch(fork()){
+    case -1:
+      printf(2, "cpushare: fork failed\n");
+      exit();
+    case 0:
+      close(fd[0]);
+      spin(fd[1], atoni(argv[i+1]), start);
+    }
+  }
+  close(fd[1]);
+
+  total = 0;
+  for(i = 0; i < n; i++){
+    if(read(fd[0], &r[i], sizeof(r[i])) != sizeof(r[i])){
+      printf(2, "cpushare: lost a result\n");
+      exit();
+    }
+    total += r[i].work;
+  }
+  for(i = 0; i < n; i++)
+    wait();
+
+  if(total == 0)
+    total = 1;
+  for(i = 0; i < n; i++)
+    printf(1, "nice %d: %d units, %d%%\n",
+           r[i].nice, r[i].work, r[i].work * 100 / total);
+  exit();
+}
@@ -23,6 +23,7 @@ main(void)
   dup(0);  // stderr
 
   mknod("cpuid", CPUID, 1);
+  mknod("kstat", KSTAT, 1);
 
   for(;;){
     printf(1, "init: starting sh\n");
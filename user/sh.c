@@ -52,6 +52,7 @@ struct backcmd {
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
 struct cmd *parsecmd(char*);
+int gettoken(char**, char*, char**, char**);
 
 // Execute cmd.  Never returns.
 void
@@ -130,6 +131,73 @@ runcmd(struct cmd *cmd)
   exit();
 }
 
+// Return 1 if buf holds a single command with nothing but
+// redirections around it, which parsecmd() is sure to accept.
+int
+simplecmd(char *buf)
+{
+  char *s, *es;
+  int tok, argc;
+
+  s = buf;
+  es = s + strlen(s);
+  argc = 0;
+  while((tok = gettoken(&s, es, 0, 0)) != 0){
+    if(tok == 'a')
+      argc++;
+    else if(tok == '<' || tok == '>' || tok == '+'){
+      if(gettoken(&s, es, 0, 0) != 'a')
+        return 0;
+    } else
+      return 0;
+  }
+  return argc > 0 && argc < MAXARGS;
+}
+
+// Run a simple command with spawn(), which saves forking
+// the shell only for the child to exec at once, and wait
+// for it.
+void
+spawncmd(struct cmd *cmd)
+{
+  int fds[NSPAWNFD], i, fd;
+  struct execcmd *ecmd;
+  struct redircmd *rcmd;
+
+  for(i = 0; i < NSPAWNFD; i++)
+    fds[i] = i;
+  while(cmd->type == REDIR){
+    rcmd = (struct redircmd*)cmd;
+    if((fd = open(rcmd->file, rcmd->mode)) < 0){
+      printf(2, "open %s failed\n", rcmd->file);
+      goto out;
+    }
+    if(fds[rcmd->fd] != rcmd->fd)
+      close(fds[rcmd->fd]);
+    fds[rcmd->fd] = fd;
+    cmd = rcmd->cmd;
+  }
+  ecmd = (struct execcmd*)cmd;
+  if(spawn(ecmd->argv[0], ecmd->argv, fds) < 0)
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+  else
+    wait();
+
+out:
+  for(i = 0; i < NSPAWNFD; i++)
+    if(fds[i] != i)
+      close(fds[i]);
+}
+
+// Free a simple command built by parsecmd().
+void
+freecmd(struct cmd *cmd)
+{
+  if(cmd->type == REDIR)
+    freecmd(((struct redircmd*)cmd)->cmd);
+  free(cmd);
+}
+
 int
 getcmd(char *buf, int nbuf)
 {
@@ -145,6 +213,7 @@ int
 main(void)
 {
   static char buf[100];
+  struct cmd *cmd;
   int fd;
   
   // Assumes three file descriptors open.
@@ -165,6 +234,12 @@ main(void)
         printf(2, "cannot cd %s\n", buf+3);
       continue;
     }
+    if(simplecmd(buf)){
+      cmd = parsecmd(buf);
+      spawncmd(cmd);
+      freecmd(cmd);
+      continue;
+    }
     if(fork1() == 0)
       runcmd(parsecmd(buf));
     wait();
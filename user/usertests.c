@@ -7,6 +7,7 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "mman.h"
 
 char buf[8192];
 char name[3];
@@ -1411,6 +1412,525 @@ forktest(void)
   printf(1, "fork test OK\n");
 }
 
+// fork shares pages copy-on-write: make sure writes by the
+// child, including ones done by the kernel on its behalf,
+// do not show up in the parent, and vice versa.
+void
+cowtest(void)
+{
+  enum { N = 64*4096 };
+  char *p;
+  int i, pid, fds[2];
+
+  printf(1, "cow test\n");
+
+  p = sbrk(N);
+  if(p == (char*)-1){
+    printf(1, "sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < N; i++)
+    p[i] = i % 251;
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < N; i += 4096)
+      p[i] = 'c';
+    close(fds[1]);
+    if(read(fds[0], p + 4096 + 1, 5) != 5){
+      printf(1, "cow read failed\n");
+      exit();
+    }
+    if(p[0] != 'c' || p[4096+1] != 'x' || p[N-4096] != 'c'){
+      printf(1, "cow child sees wrong data\n");
+      exit();
+    }
+    exit();
+  }
+
+  close(fds[0]);
+  for(i = 0; i < N; i += 4096)
+    if(p[i] != (char)(i % 251)){
+      printf(1, "cow parent sees child's write\n");
+      exit();
+    }
+  p[8192] = 'p';
+  if(write(fds[1], "xxxxx", 5) != 5){
+    printf(1, "cow write failed\n");
+    exit();
+  }
+  close(fds[1]);
+  wait();
+
+  for(i = 0; i < N; i++){
+    if(i == 8192)
+      continue;
+    if(p[i] != (char)(i % 251)){
+      printf(1, "cow parent memory changed at %d\n", i);
+      exit();
+    }
+  }
+  sbrk(-N);
+  printf(1, "cow test OK\n");
+}
+
+void
+mmaptest(void)
+{
+  enum { N = 3*4096 + 100 };
+  char *p, buf[16];
+  int fd, i;
+
+  printf(1, "mmap test\n");
+
+  unlink("mmapfile");
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "mmap create failed\n");
+    exit();
+  }
+  for(i = 0; i < N; i++){
+    buf[0] = i % 251;
+    if(write(fd, buf, 1) != 1){
+      printf(1, "mmap write file failed\n");
+      exit();
+    }
+  }
+
+  // Private mapping: sees the file, writes stay private,
+  // and the part of the last page past the end reads as zero.
+  p = mmap(0, N, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED){
+    printf(1, "mmap private failed\n");
+    exit();
+  }
+  for(i = 0; i < N; i++)
+    if(p[i] != (char)(i % 251)){
+      printf(1, "mmap private wrong data at %d\n", i);
+      exit();
+    }
+  if(p[N] != 0 || p[4*4096-1] != 0){
+    printf(1, "mmap tail not zero\n");
+    exit();
+  }
+  p[0] = 'x';
+  if(munmap(p, N) != 0){
+    printf(1, "munmap private failed\n");
+    exit();
+  }
+
+  // Shared mapping: writes reach the file.
+  p = mmap(0, N, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED){
+    printf(1, "mmap shared failed\n");
+    exit();
+  }
+  if(p[0] != 0){
+    printf(1, "mmap private write reached file\n");
+    exit();
+  }
+  p[1] = 'a';
+  p[N-1] = 'b';
+  if(msync(p, N) != 0){
+    printf(1, "msync failed\n");
+    exit();
+  }
+  p[4096] = 'c';
+  // The kernel can write into a mapping, too.
+  if(read(fd, p + 8192, 1) != 0){
+    printf(1, "mmap read at eof failed\n");
+    exit();
+  }
+  if(munmap(p, N) != 0){
+    printf(1, "munmap shared failed\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("mmapfile", O_RDONLY);
+  if(read(fd, buf, 2) != 2 || buf[1] != 'a'){
+    printf(1, "msync data not in file\n");
+    exit();
+  }
+  // A read-only descriptor cannot be mapped shared and writable.
+  if(mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0) != MAP_FAILED){
+    printf(1, "mmap of read-only fd succeeded\n");
+    exit();
+  }
+  // munmap wrote the other dirty pages back.
+  p = mmap(0, N, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(p == MAP_FAILED || p[4096] != 'c' || p[N-1] != 'b'){
+    printf(1, "munmap data not in file\n");
+    exit();
+  }
+  munmap(p, N);
+  close(fd);
+  unlink("mmapfile");
+
+  // Anonymous memory starts out zero; unmapping the middle
+  // leaves both ends.
+  p = mmap(0, 3*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED){
+    printf(1, "mmap anonymous failed\n");
+    exit();
+  }
+  for(i = 0; i < 3*4096; i++)
+    if(p[i] != 0){
+      printf(1, "mmap anonymous not zero\n");
+      exit();
+    }
+  p[0] = 1;
+  p[2*4096] = 2;
+  if(munmap(p + 4096, 4096) != 0 || p[0] != 1 || p[2*4096] != 2){
+    printf(1, "munmap middle failed\n");
+    exit();
+  }
+  munmap(p, 4096);
+  munmap(p + 2*4096, 4096);
+  printf(1, "mmap test OK\n");
+}
+
+// MAP_SHARED anonymous memory is shared with children,
+// both the pages touched before fork and those that are not.
+void
+shmtest(void)
+{
+  enum { N = 16*4096 };
+  char *p, *q;
+  int i, pid, fds[2];
+
+  printf(1, "shm test\n");
+
+  p = mmap(0, N, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+  q = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if(p == MAP_FAILED || q == MAP_FAILED){
+    printf(1, "shm mmap failed\n");
+    exit();
+  }
+  p[0] = 'p';
+  q[0] = 'q';
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    if(p[0] != 'p' || q[0] != 'q'){
+      printf(1, "shm child sees wrong data\n");
+      exit();
+    }
+    for(i = 0; i < N; i++)
+      p[i] = i % 251;
+    q[0] = 'c';
+    // Pass data the kernel reads straight out of the segment.
+    write(fds[1], p + 4096, 1);
+    exit();
+  }
+
+  close(fds[1]);
+  if(read(fds[0], q + 1, 1) != 1 || q[1] != (char)(4096 % 251)){
+    printf(1, "shm pipe read failed\n");
+    exit();
+  }
+  close(fds[0]);
+  wait();
+  for(i = 0; i < N; i++)
+    if(p[i] != (char)(i % 251)){
+      printf(1, "shm parent doesn't see child's write at %d\n", i);
+      exit();
+    }
+  if(q[0] != 'q'){
+    printf(1, "shm private mapping was shared\n");
+    exit();
+  }
+  munmap(p, N);
+  munmap(q, 4096);
+  printf(1, "shm test OK\n");
+}
+
+// Large heaps are backed by huge pages where possible; check
+// that they behave like small ones across fork and partial
+// sbrk shrinks.
+void
+hugetest(void)
+{
+  enum { HUGE = 4*1024*1024, N = 3*HUGE };
+  char *old, *p;
+  int i, pid;
+
+  printf(1, "huge test\n");
+
+  old = sbrk(0);
+  p = sbrk(N + HUGE);
+  if(p == (char*)-1){
+    printf(1, "huge sbrk failed\n");
+    exit();
+  }
+  // Start on a huge page boundary.
+  p = (char*)(((uintp)p + HUGE - 1) & ~(HUGE - 1));
+  for(i = 0; i < N; i += 4096)
+    p[i] = i / 4096;
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < N; i += 4096)
+      if(p[i] != (char)(i / 4096)){
+        printf(1, "huge child sees wrong data\n");
+        exit();
+      }
+    p[0] = 'c';
+    exit();
+  }
+  // The child may still share this page; it must not see the write.
+  p[HUGE] = 'p';
+  wait();
+  if(p[0] != 0){
+    printf(1, "huge parent sees child's write\n");
+    exit();
+  }
+  if(p[HUGE] != 'p'){
+    printf(1, "huge parent lost its write\n");
+    exit();
+  }
+  p[HUGE] = (char)(HUGE / 4096);
+
+  // Shrink to the middle of the last huge page.
+  sbrk(-(old + N + HUGE - (p + N - HUGE/2)));
+  for(i = 0; i < N - HUGE/2; i += 4096)
+    if(p[i] != (char)(i / 4096)){
+      printf(1, "huge data lost by sbrk shrink\n");
+      exit();
+    }
+  sbrk(old - sbrk(0));
+  printf(1, "huge test OK\n");
+}
+
+// spawn() a child with its stdout on a pipe.
+void
+spawntest(void)
+{
+  char *argv[] = { "echo", "spawned", 0 };
+  int p[2], fds[NSPAWNFD], n, total;
+
+  printf(1, "spawn test\n");
+  if(spawn("nonexistent", argv, 0) >= 0){
+    printf(1, "spawn nonexistent succeeded\n");
+    exit();
+  }
+  if(pipe(p) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  fds[0] = 0;
+  fds[1] = p[1];
+  fds[2] = -1;
+  if(spawn("echo", argv, fds) < 0){
+    printf(1, "spawn echo failed\n");
+    exit();
+  }
+  close(p[1]);
+  total = 0;
+  while((n = read(p[0], buf + total, sizeof(buf) - 1 - total)) > 0)
+    total += n;
+  buf[total] = 0;
+  close(p[0]);
+  wait();
+  if(strcmp(buf, "spawned\n") != 0){
+    printf(1, "spawn child wrote the wrong output\n");
+    exit();
+  }
+  printf(1, "spawn test OK\n");
+}
+
+// Program text is mapped read-only, and shared by
+// processes running the same program.
+void
+texttest(void)
+{
+  char *argv[] = { "echo", "shared", 0 };
+  int p[2], fds[NSPAWNFD], i, n, total;
+
+  printf(1, "text test\n");
+  if(pipe(p) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    close(p[0]);
+    *(volatile char*)texttest = 0;
+    write(p[1], "x", 1);   // should not get here
+    exit();
+  }
+  close(p[1]);
+  if(read(p[0], buf, 1) != 0){
+    printf(1, "wrote to program text\n");
+    exit();
+  }
+  close(p[0]);
+  wait();
+
+  if(pipe(p) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  fds[0] = 0;
+  fds[1] = p[1];
+  fds[2] = -1;
+  for(i = 0; i < 4; i++){
+    if(spawn("echo", argv, fds) < 0){
+      printf(1, "spawn echo failed\n");
+      exit();
+    }
+  }
+  close(p[1]);
+  total = 0;
+  while((n = read(p[0], buf + total, sizeof(buf) - total)) > 0)
+    total += n;
+  close(p[0]);
+  for(i = 0; i < 4; i++)
+    wait();
+  if(total != 4*strlen("shared\n")){
+    printf(1, "echo children wrote %d bytes\n", total);
+    exit();
+  }
+  printf(1, "text test OK\n");
+}
+
+// Sum 0..n using a page of stack per call.
+int
+stackdepth(int n)
+{
+  volatile char frame[4096];
+
+  frame[0] = n;
+  if(n == 0)
+    return 0;
+  return stackdepth(n - 1) + frame[0];
+}
+
+// The stack grows on demand, both when the program touches
+// it and when a system call writes into it, up to STACKMAX.
+void
+stacktest(void)
+{
+  char big[4*4096];
+  int p[2];
+
+  printf(1, "stack test\n");
+  if(pipe(p) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    // read() into untouched stack pages.
+    write(p[1], "x", 1);
+    if(read(p[0], big, 1) != 1 || big[0] != 'x'){
+      printf(1, "read into stack failed\n");
+      exit();
+    }
+    if(stackdepth(100) != 100*101/2){
+      printf(1, "deep stack gave the wrong sum\n");
+      exit();
+    }
+    write(p[1], "y", 1);
+    // Growing past the limit should kill the process.
+    stackdepth(STACKMAX/4096 + 1);
+    write(p[1], "x", 1);
+    exit();
+  }
+  close(p[1]);
+  wait();
+  if(read(p[0], big, 1) != 1 || big[0] != 'y'){
+    printf(1, "stack did not grow\n");
+    exit();
+  }
+  if(read(p[0], big, 1) != 0){
+    printf(1, "stack grew past STACKMAX\n");
+    exit();
+  }
+  close(p[0]);
+  printf(1, "stack test OK\n");
+}
+
+// nice() and setpriority() change nice values within
+// [NICEMIN, NICEMAX], and children inherit them.
+void
+nicetest(void)
+{
+  int pid;
+
+  printf(1, "nice test\n");
+  if(nice(0) != 0 || nice(5) != 5 || nice(100) != NICEMAX ||
+     nice(-100) != NICEMIN){
+    printf(1, "nice() gave the wrong value\n");
+    exit();
+  }
+  if(setpriority(getpid(), 3) != 0 || nice(0) != 3){
+    printf(1, "setpriority() failed\n");
+    exit();
+  }
+  if(setpriority(-1, 0) != -1){
+    printf(1, "setpriority() of a bad pid succeeded\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    if(nice(0) != 3)
+      printf(1, "child did not inherit nice value\n");
+    exit();
+  }
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  wait();
+  nice(-3);
+  printf(1, "nice test OK\n");
+}
+
+// CPUs stop their timers when they have nothing to switch
+// between, but a sleep must still end on time, and the clock
+// must move for a process that has a CPU to itself.
+void
+sleeptest(void)
+{
+  int t0, t1;
+
+  printf(1, "sleep test\n");
+  t0 = uptime();
+  if(sleep(20) < 0){
+    printf(1, "sleep failed\n");
+    exit();
+  }
+  t1 = uptime();
+  if(t1 - t0 < 20 || t1 - t0 >= 20 + TICKLESSMAX){
+    printf(1, "sleep(20) took %d ticks\n", t1 - t0);
+    exit();
+  }
+  t0 = uptime();
+  while(uptime() < t0 + 5)
+    ;
+  printf(1, "sleep test OK\n");
+}
+
 void
 sbrktest(void)
 {
@@ -1752,6 +2272,15 @@ main(int argc, char *argv[])
   dirfile();
   iref();
   forktest();
+  cowtest();
+  mmaptest();
+  shmtest();
+  hugetest();
+  spawntest();
+  texttest();
+  stacktest();
+  nicetest();
+  sleeptest();
   bigdir(); // slow
   exectest();
 